@@ -0,0 +1,789 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "tudat/simulation/simulation.h"
+#include "tudat/simulation/estimation_setup/simulateObservations.h"
+#include "tudat/simulation/estimation_setup/orbitDeterminationManager.h"
+#include "tudat/simulation/environment_setup/createGroundStations.h"
+#include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/tleEphemeris.h"
+#include "tudat/astro/mission_segments/lambertTargeterIzzo.h"
+#include "tudat/math/basic/legendrePolynomials.h"
+
+#include "benchmarkScenarios.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::observation_models;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::basic_astrodynamics;
+
+//! Epoch (seconds since J2000) at which the Earth-centered scenarios start
+static const double earthScenarioStartEpoch = 1.0E7;
+
+//! Function to create the vertices and facets of a triaxial ellipsoid, from a recursively subdivided octahedron
+/*!
+ *  Function to create the vertices and facets of a triaxial ellipsoid, from a recursively subdivided octahedron. The
+ *  vertices of each facet are ordered such that the facet normal (by right-hand rule) points outward.
+ *  \param semiAxes Semi-axes of the ellipsoid along the x, y and z axis
+ *  \param numberOfSubdivisions Number of times each facet is subdivided into four (8 * 4^n facets in total)
+ *  \param verticesCoordinates Coordinates of the vertices (returned by reference)
+ *  \param verticesDefiningEachFacet Indices of the vertices of each facet (returned by reference)
+ */
+static void createEllipsoidPolyhedron( const Eigen::Vector3d& semiAxes,
+                                       const int numberOfSubdivisions,
+                                       Eigen::MatrixXd& verticesCoordinates,
+                                       Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    std::vector< Eigen::Vector3d > vertices =
+    { Eigen::Vector3d::UnitX( ), -Eigen::Vector3d::UnitX( ), Eigen::Vector3d::UnitY( ),
+      -Eigen::Vector3d::UnitY( ), Eigen::Vector3d::UnitZ( ), -Eigen::Vector3d::UnitZ( ) };
+    std::vector< Eigen::Vector3i > facets =
+    { Eigen::Vector3i( 0, 2, 4 ), Eigen::Vector3i( 2, 1, 4 ), Eigen::Vector3i( 1, 3, 4 ), Eigen::Vector3i( 3, 0, 4 ),
+      Eigen::Vector3i( 2, 0, 5 ), Eigen::Vector3i( 1, 2, 5 ), Eigen::Vector3i( 3, 1, 5 ), Eigen::Vector3i( 0, 3, 5 ) };
+
+    for( int subdivision = 0; subdivision < numberOfSubdivisions; subdivision++ )
+    {
+        // Create (or retrieve) vertex at midpoint of each edge, projected onto the unit sphere
+        std::map< std::pair< int, int >, int > midpointIndices;
+        auto getMidpointIndex = [ & ]( const int firstIndex, const int secondIndex )
+        {
+            std::pair< int, int > edge = std::make_pair( std::min( firstIndex, secondIndex ),
+                                                         std::max( firstIndex, secondIndex ) );
+            if( midpointIndices.count( edge ) == 0 )
+            {
+                midpointIndices[ edge ] = static_cast< int >( vertices.size( ) );
+                vertices.push_back( ( vertices.at( firstIndex ) + vertices.at( secondIndex ) ).normalized( ) );
+            }
+            return midpointIndices.at( edge );
+        };
+
+        std::vector< Eigen::Vector3i > subdividedFacets;
+        for( unsigned int i = 0; i < facets.size( ); i++ )
+        {
+            const Eigen::Vector3i& facet = facets.at( i );
+            int midpoint01 = getMidpointIndex( facet( 0 ), facet( 1 ) );
+            int midpoint12 = getMidpointIndex( facet( 1 ), facet( 2 ) );
+            int midpoint20 = getMidpointIndex( facet( 2 ), facet( 0 ) );
+            subdividedFacets.push_back( Eigen::Vector3i( facet( 0 ), midpoint01, midpoint20 ) );
+            subdividedFacets.push_back( Eigen::Vector3i( midpoint01, facet( 1 ), midpoint12 ) );
+            subdividedFacets.push_back( Eigen::Vector3i( midpoint20, midpoint12, facet( 2 ) ) );
+            subdividedFacets.push_back( Eigen::Vector3i( midpoint01, midpoint12, midpoint20 ) );
+        }
+        facets = subdividedFacets;
+    }
+
+    verticesCoordinates.resize( vertices.size( ), 3 );
+    for( unsigned int i = 0; i < vertices.size( ); i++ )
+    {
+        verticesCoordinates.row( i ) = vertices.at( i ).cwiseProduct( semiAxes ).transpose( );
+    }
+    verticesDefiningEachFacet.resize( facets.size( ), 3 );
+    for( unsigned int i = 0; i < facets.size( ); i++ )
+    {
+        verticesDefiningEachFacet.row( i ) = facets.at( i ).transpose( );
+    }
+}
+
+//! Per-entry computation of geodesy-normalized Legendre polynomials and derivatives, as reference for Legendre benchmark
+/*!
+ *  Per-entry computation of geodesy-normalized Legendre polynomials, and their first and second derivatives, in which
+ *  each polynomial is computed through a std::function from the polynomials stored in a rectangular
+ *  ( maximumDegree + 1 ) x ( maximumOrder + 1 ) layout, and the derivatives are computed in separate passes. This
+ *  reproduces the structure of the LegendreCache::update function before the fused, packed computation was introduced,
+ *  and is used to measure the speed-up of the latter.
+ */
+class PerEntryGeodesyLegendreReference
+{
+public:
+
+    PerEntryGeodesyLegendreReference( const int maximumDegree, const int maximumOrder ):
+        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ),
+        legendreValues_( ( maximumDegree + 1 ) * ( maximumOrder + 1 ), 0.0 ),
+        legendreDerivatives_( ( maximumDegree + 1 ) * ( maximumOrder + 1 ), 0.0 ),
+        legendreSecondDerivatives_( ( maximumDegree + 1 ) * ( maximumOrder + 1 ), 0.0 ),
+        firstMultipliers_( ( maximumDegree + 1 ) * ( maximumOrder + 1 ), 0.0 ),
+        secondMultipliers_( ( maximumDegree + 1 ) * ( maximumOrder + 1 ), 0.0 ),
+        derivativeNormalizations_( ( maximumDegree + 1 ) * ( maximumOrder + 1 ), 0.0 )
+    {
+        for( int i = 0; i <= maximumDegree_; i++ )
+        {
+            for( int j = 0; ( j <= i ) && ( j <= maximumOrder_ ); j++ )
+            {
+                derivativeNormalizations_[ getIndex( i, j ) ] =
+                        std::sqrt( static_cast< double >( i + j + 1 ) * static_cast< double >( i - j ) ) *
+                        ( ( j == 0 ) ? std::sqrt( 0.5 ) : 1.0 );
+                firstMultipliers_[ getIndex( i, j ) ] = std::sqrt(
+                            ( 2.0 * static_cast< double >( i ) + 1.0 ) /
+                            ( static_cast< double >( i + j ) * static_cast< double >( i - j ) ) );
+                secondMultipliers_[ getIndex( i, j ) ] = std::sqrt(
+                            ( static_cast< double >( i + j ) - 1.0 ) * ( static_cast< double >( i - j ) - 1.0 ) /
+                            ( 2.0 * static_cast< double >( i ) - 3.0 ) );
+            }
+        }
+
+        polynomialFunction_ = [ = ]( const int degree, const int order )
+        {
+            if( degree <= 1 )
+            {
+                return basic_mathematics::computeGeodesyLegendrePolynomialExplicit( degree, order, polynomialParameter_ );
+            }
+            else if( degree == order )
+            {
+                return basic_mathematics::computeGeodesyLegendrePolynomialDiagonal(
+                            degree, legendreValues_[ getIndex( 1, 1 ) ], legendreValues_[ getIndex( degree - 1, order - 1 ) ] );
+            }
+            else
+            {
+                return basic_mathematics::computeGeodesyLegendrePolynomialVertical(
+                            degree, order, polynomialParameter_,
+                            firstMultipliers_[ getIndex( degree, order ) ], secondMultipliers_[ getIndex( degree, order ) ],
+                            legendreValues_[ getIndex( degree - 1, order ) ],
+                            ( order <= degree - 2 ) ? legendreValues_[ getIndex( degree - 2, order ) ] : 0.0 );
+            }
+        };
+    }
+
+    void update( const double polynomialParameter )
+    {
+        polynomialParameter_ = polynomialParameter;
+        const double oneOverComplement = 1.0 / std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
+        for( int i = 0; i <= maximumDegree_; i++ )
+        {
+            const int maximumOrderAtDegree = std::min( i, maximumOrder_ );
+            for( int j = 0; j <= maximumOrderAtDegree; j++ )
+            {
+                legendreValues_[ getIndex( i, j ) ] = polynomialFunction_( i, j );
+            }
+            for( int j = 0; j <= maximumOrderAtDegree; j++ )
+            {
+                legendreDerivatives_[ getIndex( i, j ) ] = basic_mathematics::computeGeodesyLegendrePolynomialDerivative(
+                            j, polynomialParameter, oneOverComplement, legendreValues_[ getIndex( i, j ) ],
+                            ( j < maximumOrderAtDegree ) ? legendreValues_[ getIndex( i, j + 1 ) ] : 0.0,
+                            derivativeNormalizations_[ getIndex( i, j ) ] );
+            }
+        }
+        for( int i = 0; i <= maximumDegree_; i++ )
+        {
+            const int maximumOrderAtDegree = std::min( i, maximumOrder_ );
+            for( int j = 0; j <= maximumOrderAtDegree; j++ )
+            {
+                legendreSecondDerivatives_[ getIndex( i, j ) ] =
+                        basic_mathematics::computeGeodesyLegendrePolynomialSecondDerivative(
+                            j, polynomialParameter, oneOverComplement, legendreValues_[ getIndex( i, j ) ],
+                            ( j < maximumOrderAtDegree ) ? legendreValues_[ getIndex( i, j + 1 ) ] : 0.0,
+                            legendreDerivatives_[ getIndex( i, j ) ],
+                            ( j < maximumOrderAtDegree ) ? legendreDerivatives_[ getIndex( i, j + 1 ) ] : 0.0,
+                            derivativeNormalizations_[ getIndex( i, j ) ] );
+            }
+        }
+    }
+
+    double getLegendrePolynomial( const int degree, const int order )
+    {
+        return legendreValues_[ getIndex( degree, order ) ];
+    }
+
+private:
+
+    int getIndex( const int degree, const int order ) const
+    {
+        return degree * ( maximumOrder_ + 1 ) + order;
+    }
+
+    int maximumDegree_;
+
+    int maximumOrder_;
+
+    double polynomialParameter_ = 0.0;
+
+    std::vector< double > legendreValues_;
+
+    std::vector< double > legendreDerivatives_;
+
+    std::vector< double > legendreSecondDerivatives_;
+
+    std::vector< double > firstMultipliers_;
+
+    std::vector< double > secondMultipliers_;
+
+    std::vector< double > derivativeNormalizations_;
+
+    std::function< double( const int, const int ) > polynomialFunction_;
+};
+
+//! Propagation of a low Earth orbiter for one day, with 120x120 gravity field and drag (NRLMSISE-00 if available)
+void runLeoGravityFieldAndDragBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    double initialTime = earthScenarioStartEpoch;
+    double finalTime = initialTime + physical_constants::JULIAN_DAY;
+
+    // Create environment
+    std::vector< std::string > bodiesToCreate = { "Earth", "Sun", "Moon" };
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                bodiesToCreate, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+#if TUDAT_BUILD_WITH_NRLMSISE
+    bodySettings.at( "Earth" )->atmosphereSettings = nrlmsise00AtmosphereSettings( );
+    result.metrics_[ "nrlmsise00_atmosphere" ] = 1.0;
+#else
+    bodySettings.at( "Earth" )->atmosphereSettings = exponentialAtmosphereSettings( "Earth" );
+    result.metrics_[ "nrlmsise00_atmosphere" ] = 0.0;
+#endif
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 400.0 );
+    addAerodynamicCoefficientInterface(
+                bodies, "Vehicle", constantAerodynamicCoefficientSettings(
+                    4.0, 1.2 * Eigen::Vector3d::UnitX( ), true, true ) );
+
+    // Create accelerations
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ] = { sphericalHarmonicAcceleration( 120, 120 ), aerodynamicAcceleration( ) };
+    accelerationSettings[ "Vehicle" ][ "Sun" ] = { pointMassGravityAcceleration( ) };
+    accelerationSettings[ "Vehicle" ][ "Moon" ] = { pointMassGravityAcceleration( ) };
+
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    // Create propagation settings
+    Eigen::Vector6d initialKeplerianState;
+    initialKeplerianState( semiMajorAxisIndex ) = 6378.0E3 + 450.0E3;
+    initialKeplerianState( eccentricityIndex ) = 1.0E-3;
+    initialKeplerianState( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 51.6 );
+    initialKeplerianState( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 30.0 );
+    initialKeplerianState( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 60.0 );
+    initialKeplerianState( trueAnomalyIndex ) = 0.0;
+    Eigen::VectorXd initialState = convertKeplerianToCartesianElements(
+                initialKeplerianState, bodies.at( "Earth" )->getGravitationalParameter( ) );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, initialTime,
+                rungeKutta4Settings< double >( 10.0 ), propagationTimeTerminationSettings( finalTime ) );
+
+    // Propagate
+    measurement.start( );
+    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+    measurement.stop( result );
+
+    const std::map< double, Eigen::VectorXd >& stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    result.functionEvaluations_ = dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( );
+    result.metrics_[ "number_of_steps" ] = static_cast< double >( stateHistory.size( ) );
+    result.metrics_[ "final_radius_m" ] = stateHistory.rbegin( )->second.segment( 0, 3 ).norm( );
+}
+
+//! Propagation of an Earth-Mars cruise with point-mass perturbations of all planets, including variational equations
+void runInterplanetaryCruiseVariationalEquationsBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    double initialTime = 8.3E8;
+    double finalTime = initialTime + 200.0 * physical_constants::JULIAN_DAY;
+
+    // Create environment
+    std::vector< std::string > bodiesToCreate =
+    { "Sun", "Mercury", "Venus", "Earth", "Moon", "Mars", "Jupiter", "Saturn" };
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                bodiesToCreate, initialTime - 86400.0, finalTime + 86400.0 );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Spacecraft" );
+    bodies.at( "Spacecraft" )->setConstantBodyMass( 1000.0 );
+
+    // Create accelerations
+    SelectedAccelerationMap accelerationSettings;
+    for( unsigned int i = 0; i < bodiesToCreate.size( ); i++ )
+    {
+        accelerationSettings[ "Spacecraft" ][ bodiesToCreate.at( i ) ] = { pointMassGravityAcceleration( ) };
+    }
+
+    std::vector< std::string > bodiesToPropagate = { "Spacecraft" };
+    std::vector< std::string > centralBodies = { "Sun" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    // Start one million km ahead of the Earth, with an excess velocity of 3 km/s along the Earth's velocity
+    Eigen::Vector6d earthState = spice_interface::getBodyCartesianStateAtEpoch(
+                "Earth", "Sun", "ECLIPJ2000", "None", initialTime );
+    Eigen::Vector3d velocityDirection = earthState.segment( 3, 3 ).normalized( );
+    Eigen::VectorXd initialState = earthState;
+    initialState.segment( 0, 3 ) += 1.0E9 * velocityDirection;
+    initialState.segment( 3, 3 ) += 3.0E3 * velocityDirection;
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, initialTime,
+                rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                    3600.0, rungeKuttaFehlberg78, 60.0, 5.0 * physical_constants::JULIAN_DAY, 1.0E-12, 1.0E-12 ),
+                propagationTimeTerminationSettings( finalTime ) );
+
+    // Define parameters for variational equations
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+            getInitialStateParameterSettings< double >( propagatorSettings, bodies );
+    parameterNames.push_back( gravitationalParameter( "Sun" ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate< double >( parameterNames, bodies );
+
+    // Propagate dynamics and variational equations
+    measurement.start( );
+    SingleArcVariationalEquationsSolver< > variationalEquationsSolver(
+                bodies, propagatorSettings, parametersToEstimate, true, true );
+    measurement.stop( result );
+
+    result.functionEvaluations_ =
+            variationalEquationsSolver.getDynamicsSimulator( )->getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( );
+    result.metrics_[ "number_of_parameters" ] = static_cast< double >( parametersToEstimate->getParameterSetSize( ) );
+}
+
+//! Multi-arc orbit determination of a low Earth orbiter with one month of range and Doppler data
+void runMultiArcOrbitDeterminationBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    const int numberOfArcs = 30;
+    const double arcDuration = physical_constants::JULIAN_DAY;
+    double initialTime = earthScenarioStartEpoch;
+    double finalTime = initialTime + numberOfArcs * arcDuration;
+
+    // Create environment
+    std::vector< std::string > bodiesToCreate = { "Earth", "Sun", "Moon" };
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                bodiesToCreate, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 400.0 );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::MultiArcEphemeris >(
+                                              std::map< double, std::shared_ptr< ephemerides::Ephemeris > >( ),
+                                              "Earth", "J2000" ) );
+    bodies.processBodyFrameDefinitions( );
+
+    // Create ground stations (altitude, latitude, longitude)
+    std::map< std::string, Eigen::Vector3d > groundStationPositions;
+    groundStationPositions[ "Delft" ] = Eigen::Vector3d( 0.0, unit_conversions::convertDegreesToRadians( 52.0 ),
+                                                         unit_conversions::convertDegreesToRadians( 4.4 ) );
+    groundStationPositions[ "Canberra" ] = Eigen::Vector3d( 0.0, unit_conversions::convertDegreesToRadians( -35.4 ),
+                                                            unit_conversions::convertDegreesToRadians( 149.0 ) );
+    groundStationPositions[ "Goldstone" ] = Eigen::Vector3d( 0.0, unit_conversions::convertDegreesToRadians( 35.4 ),
+                                                             unit_conversions::convertDegreesToRadians( -116.9 ) );
+    for( auto stationIterator : groundStationPositions )
+    {
+        createGroundStation( bodies.at( "Earth" ), stationIterator.first, stationIterator.second,
+                             coordinate_conversions::geodetic_position );
+    }
+
+    // Create accelerations
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ] = { sphericalHarmonicAcceleration( 16, 16 ) };
+    accelerationSettings[ "Vehicle" ][ "Sun" ] = { pointMassGravityAcceleration( ) };
+    accelerationSettings[ "Vehicle" ][ "Moon" ] = { pointMassGravityAcceleration( ) };
+
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    // Create multi-arc propagation settings, with arc initial states from a Keplerian reference orbit
+    double earthGravitationalParameter = bodies.at( "Earth" )->getGravitationalParameter( );
+    Eigen::Vector6d referenceKeplerianState;
+    referenceKeplerianState( semiMajorAxisIndex ) = 6378.0E3 + 800.0E3;
+    referenceKeplerianState( eccentricityIndex ) = 2.0E-3;
+    referenceKeplerianState( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 98.6 );
+    referenceKeplerianState( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 90.0 );
+    referenceKeplerianState( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 20.0 );
+    referenceKeplerianState( trueAnomalyIndex ) = 0.0;
+
+    std::vector< double > arcStartTimes;
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagatorSettings;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        double arcStartTime = initialTime + i * arcDuration;
+        arcStartTimes.push_back( arcStartTime );
+        Eigen::VectorXd arcInitialState = convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( referenceKeplerianState, arcStartTime - initialTime, earthGravitationalParameter ),
+                    earthGravitationalParameter );
+        arcPropagatorSettings.push_back(
+                    translationalStatePropagatorSettings< double >(
+                        centralBodies, accelerationModelMap, bodiesToPropagate, arcInitialState, arcStartTime,
+                        rungeKutta4Settings< double >( 60.0 ),
+                        propagationTimeTerminationSettings( arcStartTime + arcDuration ) ) );
+    }
+    std::shared_ptr< MultiArcPropagatorSettings< double > > propagatorSettings =
+            std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagatorSettings );
+
+    // Define estimated parameters
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+            getInitialMultiArcParameterSettings< double, double >( propagatorSettings, bodies, arcStartTimes );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate< double >( parameterNames, bodies );
+
+    // Define observation models (one-way range and Doppler from vehicle to each station)
+    std::vector< LinkDefinition > stationLinks;
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    for( auto stationIterator : groundStationPositions )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ transmitter ] = LinkEndId( "Vehicle", "" );
+        linkEnds[ receiver ] = LinkEndId( "Earth", stationIterator.first );
+        stationLinks.push_back( LinkDefinition( linkEnds ) );
+        observationSettingsList.push_back( oneWayRangeSettings( stationLinks.back( ) ) );
+        observationSettingsList.push_back( oneWayOpenLoopDoppler( stationLinks.back( ) ) );
+    }
+
+    // Define observation times (every minute, excluding the first and last ten minutes of each arc)
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( double currentTime = arcStartTimes.at( i ) + 600.0; currentTime <= arcStartTimes.at( i ) + arcDuration - 600.0;
+             currentTime += 60.0 )
+        {
+            observationTimes.push_back( currentTime );
+        }
+    }
+
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > observationSimulationSettings;
+    for( unsigned int i = 0; i < stationLinks.size( ); i++ )
+    {
+        std::vector< std::shared_ptr< ObservationViabilitySettings > > viabilitySettings =
+        { elevationAngleViabilitySettings( stationLinks.at( i ).at( receiver ).getDualStringLinkEnd( ),
+                                           unit_conversions::convertDegreesToRadians( 15.0 ) ) };
+        observationSimulationSettings.push_back(
+                    tabulatedObservationSimulationSettings< double >(
+                        one_way_range, stationLinks.at( i ), observationTimes, receiver, viabilitySettings ) );
+        observationSimulationSettings.push_back(
+                    tabulatedObservationSimulationSettings< double >(
+                        one_way_doppler, stationLinks.at( i ), observationTimes, receiver, viabilitySettings ) );
+    }
+
+    measurement.start( );
+
+    // Create orbit determination manager (propagating the nominal dynamics), and simulate observations
+    OrbitDeterminationManager< double, double > orbitDeterminationManager(
+                bodies, parametersToEstimate, observationSettingsList, propagatorSettings );
+    std::shared_ptr< ObservationCollection< double, double > > simulatedObservations = simulateObservations< double, double >(
+                observationSimulationSettings, orbitDeterminationManager.getObservationSimulators( ), bodies );
+
+    // Perturb arc initial states, and estimate
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+    Eigen::VectorXd initialParameterEstimate = truthParameters;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        initialParameterEstimate.segment( 6 * i, 3 ) += Eigen::Vector3d::Constant( 10.0 );
+        initialParameterEstimate.segment( 6 * i + 3, 3 ) += Eigen::Vector3d::Constant( 1.0E-2 );
+    }
+    parametersToEstimate->resetParameterValues( initialParameterEstimate );
+
+    std::shared_ptr< EstimationInput< double, double > > estimationInput =
+            std::make_shared< EstimationInput< double, double > >(
+                simulatedObservations, Eigen::MatrixXd::Zero( 0, 0 ), estimationConvergenceChecker( 3 ) );
+    estimationInput->defineEstimationSettings( true, true, false, false, true, false );
+    std::shared_ptr< EstimationOutput< double, double > > estimationOutput =
+            orbitDeterminationManager.estimateParameters( estimationInput );
+
+    measurement.stop( result );
+
+    // Retrieve number of function evaluations of final propagation
+    std::shared_ptr< MultiArcDynamicsSimulator< double, double > > dynamicsSimulator =
+            std::dynamic_pointer_cast< MultiArcDynamicsSimulator< double, double > >(
+                orbitDeterminationManager.getVariationalEquationsSolver( )->getDynamicsSimulatorBase( ) );
+    if( dynamicsSimulator != nullptr )
+    {
+        std::vector< std::shared_ptr< DynamicsStateDerivativeModel< double, double > > > stateDerivativeModels =
+                dynamicsSimulator->getDynamicsStateDerivative( );
+        for( unsigned int i = 0; i < stateDerivativeModels.size( ); i++ )
+        {
+            result.functionEvaluations_ += stateDerivativeModels.at( i )->getNumberOfFunctionEvaluations( );
+        }
+    }
+
+    double maximumPositionError = 0.0;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        maximumPositionError = std::max(
+                    maximumPositionError,
+                    ( estimationOutput->parameterEstimate_.segment( 6 * i, 3 ) - truthParameters.segment( 6 * i, 3 ) ).norm( ) );
+    }
+
+    result.metrics_[ "number_of_arcs" ] = static_cast< double >( numberOfArcs );
+    result.metrics_[ "number_of_parameters" ] = static_cast< double >( parametersToEstimate->getParameterSetSize( ) );
+    result.metrics_[ "number_of_observations" ] = static_cast< double >( simulatedObservations->getTotalObservableSize( ) );
+    result.metrics_[ "estimation_iterations" ] = static_cast< double >( estimationOutput->residualHistory_.size( ) );
+    result.metrics_[ "maximum_position_error_m" ] = maximumPositionError;
+}
+
+//! Computation of an Earth-Mars porkchop plot on a grid of departure dates and times of flight, using Lambert targeting
+void runLambertPorkchopBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement )
+{
+    const int numberOfDepartureTimes = 200;
+    const int numberOfTimesOfFlight = 200;
+    const double firstDepartureTime = 8.2E8;
+    const double departureWindow = 400.0 * physical_constants::JULIAN_DAY;
+    const double minimumTimeOfFlight = 100.0 * physical_constants::JULIAN_DAY;
+    const double maximumTimeOfFlight = 500.0 * physical_constants::JULIAN_DAY;
+    const double sunGravitationalParameter = 1.32712440018e20;
+
+    ephemerides::ApproximateJplEphemeris earthEphemeris( "Earth", sunGravitationalParameter );
+    ephemerides::ApproximateJplEphemeris marsEphemeris( "Mars", sunGravitationalParameter );
+
+    double minimumDeltaV = std::numeric_limits< double >::infinity( );
+    double optimalDepartureTime = TUDAT_NAN, optimalTimeOfFlight = TUDAT_NAN;
+    int numberOfFailedSolutions = 0;
+
+    measurement.start( );
+    for( int i = 0; i < numberOfDepartureTimes; i++ )
+    {
+        double departureTime = firstDepartureTime +
+                departureWindow * static_cast< double >( i ) / static_cast< double >( numberOfDepartureTimes - 1 );
+        Eigen::Vector6d departureState = earthEphemeris.getCartesianState( departureTime );
+        for( int j = 0; j < numberOfTimesOfFlight; j++ )
+        {
+            double timeOfFlight = minimumTimeOfFlight + ( maximumTimeOfFlight - minimumTimeOfFlight ) *
+                    static_cast< double >( j ) / static_cast< double >( numberOfTimesOfFlight - 1 );
+            Eigen::Vector6d arrivalState = marsEphemeris.getCartesianState( departureTime + timeOfFlight );
+            try
+            {
+                mission_segments::LambertTargeterIzzo lambertTargeter(
+                            departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ), timeOfFlight,
+                            sunGravitationalParameter );
+                std::pair< Eigen::Vector3d, Eigen::Vector3d > transferVelocities =
+                        lambertTargeter.getInertialVelocityVectors( );
+                double deltaV = ( transferVelocities.first - departureState.segment( 3, 3 ) ).norm( ) +
+                        ( arrivalState.segment( 3, 3 ) - transferVelocities.second ).norm( );
+                if( deltaV < minimumDeltaV )
+                {
+                    minimumDeltaV = deltaV;
+                    optimalDepartureTime = departureTime;
+                    optimalTimeOfFlight = timeOfFlight;
+                }
+            }
+            catch( const std::exception& )
+            {
+                numberOfFailedSolutions++;
+            }
+        }
+    }
+    measurement.stop( result );
+
+    result.functionEvaluations_ = static_cast< unsigned long long >( numberOfDepartureTimes * numberOfTimesOfFlight );
+    result.metrics_[ "failed_solutions" ] = static_cast< double >( numberOfFailedSolutions );
+    result.metrics_[ "minimum_delta_v_m_s" ] = minimumDeltaV;
+    result.metrics_[ "optimal_departure_time_s" ] = optimalDepartureTime;
+    result.metrics_[ "optimal_time_of_flight_s" ] = optimalTimeOfFlight;
+}
+
+//! Propagation of a proximity orbit around an elongated asteroid, with a polyhedron gravity field
+void runPolyhedronProximityOrbitBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement )
+{
+    const double asteroidDensity = 2670.0;
+    const Eigen::Vector3d asteroidSemiAxes( 8.0E3, 4.0E3, 3.5E3 );
+    const double asteroidRotationPeriod = 5.27 * 3600.0;
+    const double orbitRadius = 25.0E3;
+    double initialTime = 0.0;
+    double finalTime = initialTime + 2.0 * physical_constants::JULIAN_DAY;
+
+    Eigen::MatrixXd verticesCoordinates;
+    Eigen::MatrixXi verticesDefiningEachFacet;
+    createEllipsoidPolyhedron( asteroidSemiAxes, 4, verticesCoordinates, verticesDefiningEachFacet );
+
+    // Create environment (no Spice kernels required)
+    BodyListSettings bodySettings( "SSB", "J2000" );
+    bodySettings.addSettings( "Asteroid" );
+    bodySettings.at( "Asteroid" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings.at( "Asteroid" )->rotationModelSettings = simpleRotationModelSettings(
+                "J2000", "Asteroid_Fixed", Eigen::Quaterniond::Identity( ), initialTime,
+                2.0 * mathematical_constants::PI / asteroidRotationPeriod );
+    bodySettings.at( "Asteroid" )->gravityFieldSettings = polyhedronGravitySettings(
+                asteroidDensity, verticesCoordinates, verticesDefiningEachFacet, "Asteroid_Fixed" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+
+    // Create accelerations
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Asteroid" ] = { polyhedronAcceleration( ) };
+
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Asteroid" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    // Start on an inclined, near-circular orbit
+    double circularVelocity = std::sqrt( bodies.at( "Asteroid" )->getGravitationalParameter( ) / orbitRadius );
+    double inclination = unit_conversions::convertDegreesToRadians( 30.0 );
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState( 0 ) = orbitRadius;
+    initialState( 4 ) = circularVelocity * std::cos( inclination );
+    initialState( 5 ) = circularVelocity * std::sin( inclination );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, initialTime,
+                rungeKutta4Settings< double >( 20.0 ), propagationTimeTerminationSettings( finalTime ) );
+
+    // Propagate
+    measurement.start( );
+    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+    measurement.stop( result );
+
+    const std::map< double, Eigen::VectorXd >& stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    result.functionEvaluations_ = dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( );
+    result.metrics_[ "number_of_facets" ] = static_cast< double >( verticesDefiningEachFacet.rows( ) );
+    result.metrics_[ "number_of_steps" ] = static_cast< double >( stateHistory.size( ) );
+    result.metrics_[ "final_radius_m" ] = stateHistory.rbegin( )->second.segment( 0, 3 ).norm( );
+}
+
+//! Evaluation of a synthetic catalog of TLEs over one day, using SGP4
+void runTleCatalogBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement )
+{
+    const int numberOfObjects = 1000;
+    const int numberOfEpochs = 145;
+    const double evaluationInterval = 600.0;
+    const double tleEpoch = 6.0E8;
+    const double earthGravitationalParameter = 3.986004418E14;
+
+    // Generate catalog from fixed seed (mapping the generator output explicitly, as the output of the standard
+    // distributions is implementation-dependent)
+    std::mt19937 randomNumberGenerator( 42 );
+    auto getUniformSample = [ & ]( const double lowerBound, const double upperBound )
+    {
+        return lowerBound + ( upperBound - lowerBound ) * static_cast< double >( randomNumberGenerator( ) ) /
+                ( static_cast< double >( std::mt19937::max( ) ) + 1.0 );
+    };
+
+    std::vector< std::shared_ptr< ephemerides::TleEphemeris > > tleEphemerides;
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        double semiMajorAxis = 6378.0E3 + getUniformSample( 400.0E3, 1500.0E3 );
+        double meanMotion = std::sqrt( earthGravitationalParameter / std::pow( semiMajorAxis, 3 ) ) * 60.0;
+        double bStar = getUniformSample( 1.0E-5, 1.0E-4 );
+        double inclination = unit_conversions::convertDegreesToRadians( getUniformSample( 0.0, 100.0 ) );
+        double rightAscension = getUniformSample( 0.0, 2.0 * mathematical_constants::PI );
+        double eccentricity = getUniformSample( 1.0E-4, 2.0E-2 );
+        double argumentOfPerigee = getUniformSample( 0.0, 2.0 * mathematical_constants::PI );
+        double meanAnomaly = getUniformSample( 0.0, 2.0 * mathematical_constants::PI );
+        tleEphemerides.push_back(
+                    std::make_shared< ephemerides::TleEphemeris >(
+                        "Earth", "J2000", std::make_shared< ephemerides::Tle >(
+                            tleEpoch, bStar, inclination, rightAscension, eccentricity, argumentOfPerigee, meanAnomaly,
+                            meanMotion ), false ) );
+    }
+
+    // Evaluate all objects at all epochs
+    double sumOfRadii = 0.0;
+    measurement.start( );
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        for( int j = 0; j < numberOfEpochs; j++ )
+        {
+            sumOfRadii += tleEphemerides.at( i )->getCartesianState( tleEpoch + j * evaluationInterval ).segment( 0, 3 ).norm( );
+        }
+    }
+    measurement.stop( result );
+
+    result.functionEvaluations_ = static_cast< unsigned long long >( numberOfObjects * numberOfEpochs );
+    result.metrics_[ "number_of_objects" ] = static_cast< double >( numberOfObjects );
+    result.metrics_[ "mean_radius_m" ] = sumOfRadii / static_cast< double >( numberOfObjects * numberOfEpochs );
+}
+
+//! Computation of geodesy-normalized Legendre polynomials and derivatives up to degree and order 150
+void runLegendreCacheBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement )
+{
+    const int maximumDegree = 150;
+    const int numberOfEvaluations = 2000;
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+    legendreCache.setComputeSecondDerivatives( true );
+    std::unique_ptr< basic_mathematics::FixedDegreeLegendreCache< maximumDegree, maximumDegree > > fixedDegreeLegendreCache =
+            std::unique_ptr< basic_mathematics::FixedDegreeLegendreCache< maximumDegree, maximumDegree > >(
+                new basic_mathematics::FixedDegreeLegendreCache< maximumDegree, maximumDegree >( true ) );
+    PerEntryGeodesyLegendreReference perEntryReference( maximumDegree, maximumDegree );
+
+    auto getPolynomialParameter = [ = ]( const int evaluation )
+    {
+        return -0.99 + 1.98 * static_cast< double >( evaluation ) / static_cast< double >( numberOfEvaluations );
+    };
+
+    // Measure fused computation in (run-time sized) Legendre cache
+    double checkSum = 0.0;
+    measurement.start( );
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        legendreCache.update( getPolynomialParameter( i ) );
+        checkSum += legendreCache.getLegendrePolynomial( maximumDegree, 1 );
+    }
+    measurement.stop( result );
+
+    // Time fixed-degree cache and per-entry reference computation for comparison
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        fixedDegreeLegendreCache->update( getPolynomialParameter( i ) );
+        checkSum += fixedDegreeLegendreCache->getLegendrePolynomial( maximumDegree, 1 );
+    }
+    std::chrono::steady_clock::time_point fixedDegreeStopTime = std::chrono::steady_clock::now( );
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        perEntryReference.update( getPolynomialParameter( i ) );
+        checkSum += perEntryReference.getLegendrePolynomial( maximumDegree, 1 );
+    }
+    std::chrono::steady_clock::time_point perEntryStopTime = std::chrono::steady_clock::now( );
+
+    double fixedDegreeTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                fixedDegreeStopTime - startTime ).count( ) * 1.0E-9;
+    double perEntryTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                perEntryStopTime - fixedDegreeStopTime ).count( ) * 1.0E-9;
+
+    result.functionEvaluations_ = static_cast< unsigned long long >( numberOfEvaluations );
+    result.metrics_[ "fixed_degree_wall_time_s" ] = fixedDegreeTime;
+    result.metrics_[ "per_entry_reference_wall_time_s" ] = perEntryTime;
+    result.metrics_[ "speedup_over_per_entry" ] = perEntryTime / result.wallTime_;
+    result.metrics_[ "fixed_degree_speedup_over_per_entry" ] = perEntryTime / fixedDegreeTime;
+    result.metrics_[ "check_sum" ] = checkSum;
+}
+
+//! Function to retrieve all benchmark scenarios that are available in this build, with their names, in order of execution
+std::vector< std::pair< std::string, BenchmarkScenarioFunction > > getBenchmarkScenarios( )
+{
+    return {
+        { "leo_gravity_120x120_drag", &runLeoGravityFieldAndDragBenchmark },
+        { "interplanetary_cruise_variational", &runInterplanetaryCruiseVariationalEquationsBenchmark },
+        { "multi_arc_od_range_doppler", &runMultiArcOrbitDeterminationBenchmark },
+        { "lambert_porkchop", &runLambertPorkchopBenchmark },
+        { "polyhedron_proximity", &runPolyhedronProximityOrbitBenchmark },
+        { "tle_catalog", &runTleCatalogBenchmark },
+        { "legendre_cache_150x150", &runLegendreCacheBenchmark } };
+}
+
+} // namespace benchmarks
+
+} // namespace tudat
@@ -0,0 +1,92 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BENCHMARKSCENARIOS_H
+#define TUDAT_BENCHMARKSCENARIOS_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmarkUtilities.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Propagation of a low Earth orbiter for one day, with 120x120 gravity field and drag (NRLMSISE-00 if available)
+/*!
+ *  Propagation of a low Earth orbiter for one day, with 120x120 Earth gravity field, drag and third-body
+ *  perturbations, using a fixed-step RK4 integrator. The NRLMSISE-00 atmosphere is used if Tudat is built with it, and an
+ *  exponential atmosphere otherwise (denoted by the nrlmsise00_atmosphere metric). Function evaluations are the number
+ *  of state derivative evaluations.
+ */
+void runLeoGravityFieldAndDragBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement );
+
+//! Propagation of an Earth-Mars cruise with point-mass perturbations of all planets, including variational equations
+/*!
+ *  Propagation of a 200-day Earth-Mars cruise with point-mass gravity of the Sun, all planets and the Moon, with
+ *  concurrent propagation of the variational equations w.r.t. the initial state and the gravitational parameter of the
+ *  Sun, using a variable-step RKF7(8) integrator. Function evaluations are the number of state derivative evaluations.
+ */
+void runInterplanetaryCruiseVariationalEquationsBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement );
+
+//! Multi-arc orbit determination of a low Earth orbiter with one month of range and Doppler data
+/*!
+ *  Multi-arc orbit determination of a low Earth orbiter from one month (30 daily arcs) of one-way range and Doppler
+ *  data from three ground stations, estimating the initial state of each arc. The measured part consists of the
+ *  observation simulation and the estimation. Function evaluations are the number of state derivative evaluations
+ *  (summed over all arcs) of the final propagation of the estimation; the number of iterations is provided as metric.
+ */
+void runMultiArcOrbitDeterminationBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement );
+
+//! Computation of an Earth-Mars porkchop plot on a grid of departure dates and times of flight, using Lambert targeting
+/*!
+ *  Computation of an Earth-Mars porkchop plot on a 200x200 grid of departure dates and times of flight, using the Izzo
+ *  Lambert targeter and approximate JPL planet positions. Function evaluations are the number of Lambert solutions.
+ */
+void runLambertPorkchopBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement );
+
+//! Propagation of a proximity orbit around an elongated asteroid, with a polyhedron gravity field
+/*!
+ *  Propagation of a two-day proximity orbit around a rotating, elongated (ellipsoidal) asteroid, with a polyhedron
+ *  gravity field of 2048 facets, using a fixed-step RK4 integrator. Function evaluations are the number of state
+ *  derivative evaluations.
+ */
+void runPolyhedronProximityOrbitBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement );
+
+//! Evaluation of a synthetic catalog of TLEs over one day, using SGP4
+/*!
+ *  Evaluation of a synthetic (reproducibly generated) catalog of 1000 low Earth orbit TLEs over one day at 10 minute
+ *  intervals, using the TLE ephemeris (SGP4 and conversion to J2000). Function evaluations are the number of TLE
+ *  ephemeris evaluations.
+ */
+void runTleCatalogBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement );
+
+//! Computation of geodesy-normalized Legendre polynomials and derivatives up to degree and order 150
+/*!
+ *  Computation of geodesy-normalized Legendre polynomials, and their first and second derivatives, up to degree and
+ *  order 150 at 2000 latitudes, using the fused computation in the LegendreCache. Function evaluations are the number
+ *  of cache updates. The same computation with the FixedDegreeLegendreCache and with a per-entry reference
+ *  implementation (one std::function call per polynomial, separate derivative passes) is timed as well, and their wall
+ *  times and the speed-ups over the per-entry reference are provided as metrics.
+ */
+void runLegendreCacheBenchmark( BenchmarkResult& result, BenchmarkMeasurement& measurement );
+
+//! Function to retrieve all benchmark scenarios that are available in this build, with their names, in order of execution
+std::vector< std::pair< std::string, BenchmarkScenarioFunction > > getBenchmarkScenarios( );
+
+} // namespace benchmarks
+
+} // namespace tudat
+
+#endif // TUDAT_BENCHMARKSCENARIOS_H
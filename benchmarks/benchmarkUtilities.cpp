@@ -0,0 +1,270 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/resource.h>
+#endif
+
+#include "benchmarkUtilities.h"
+
+#if defined( __GLIBC__ )
+// Count heap allocations, by interposing the allocation functions of the C library (also used by Eigen and operator
+// new). Allocations are only counted while a benchmark measurement is running.
+extern "C"
+{
+void* __libc_malloc( std::size_t size );
+void* __libc_calloc( std::size_t numberOfElements, std::size_t size );
+void* __libc_realloc( void* pointer, std::size_t size );
+}
+
+namespace
+{
+
+//! Boolean denoting whether heap allocations are currently counted
+std::atomic< bool > isHeapAllocationCountActive( false );
+
+//! Number of heap allocations since start of the current measurement
+std::atomic< unsigned long long > numberOfHeapAllocations( 0 );
+
+//! Function to increment the number of heap allocations, if a measurement is running
+inline void countHeapAllocation( )
+{
+    if( isHeapAllocationCountActive.load( std::memory_order_relaxed ) )
+    {
+        numberOfHeapAllocations.fetch_add( 1, std::memory_order_relaxed );
+    }
+}
+
+} // namespace
+
+extern "C"
+{
+void* malloc( std::size_t size )
+{
+    countHeapAllocation( );
+    return __libc_malloc( size );
+}
+
+void* calloc( std::size_t numberOfElements, std::size_t size )
+{
+    countHeapAllocation( );
+    return __libc_calloc( numberOfElements, size );
+}
+
+void* realloc( void* pointer, std::size_t size )
+{
+    countHeapAllocation( );
+    return __libc_realloc( pointer, size );
+}
+}
+#define TUDAT_BENCHMARK_COUNT_HEAP_ALLOCATIONS
+#endif
+
+namespace
+{
+
+//! Function to write a string as a JSON string literal
+void writeJsonString( const std::string& inputString, std::ostream& outputStream )
+{
+    outputStream << "\"";
+    for( unsigned int i = 0; i < inputString.size( ); i++ )
+    {
+        if( inputString.at( i ) == '"' || inputString.at( i ) == '\\' )
+        {
+            outputStream << "\\";
+        }
+        outputStream << inputString.at( i );
+    }
+    outputStream << "\"";
+}
+
+//! Function to write a floating point value as JSON number (or null if not finite)
+void writeJsonNumber( const double value, std::ostream& outputStream )
+{
+    if( std::isfinite( value ) )
+    {
+        outputStream << value;
+    }
+    else
+    {
+        outputStream << "null";
+    }
+}
+
+} // namespace
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Function to retrieve the peak resident set size (in kB) of the process, or -1 if not available on this platform
+long getPeakResidentSetSize( )
+{
+#if defined( __unix__ ) || defined( __APPLE__ )
+    struct rusage resourceUsage;
+    if( getrusage( RUSAGE_SELF, &resourceUsage ) != 0 )
+    {
+        return -1;
+    }
+#if defined( __APPLE__ )
+    // ru_maxrss is given in bytes on macOS, and in kB on Linux
+    return static_cast< long >( resourceUsage.ru_maxrss / 1024 );
+#else
+    return static_cast< long >( resourceUsage.ru_maxrss );
+#endif
+#else
+    return -1;
+#endif
+}
+
+//! Function to start the measurement
+void BenchmarkMeasurement::start( )
+{
+    isStarted_ = true;
+    isStopped_ = false;
+#if defined( TUDAT_BENCHMARK_COUNT_HEAP_ALLOCATIONS )
+    numberOfHeapAllocations.store( 0 );
+    isHeapAllocationCountActive.store( true );
+#endif
+    startTime_ = std::chrono::steady_clock::now( );
+}
+
+//! Function to stop the measurement, and set the wall time and number of heap allocations in the results
+void BenchmarkMeasurement::stop( BenchmarkResult& result )
+{
+    std::chrono::steady_clock::time_point stopTime = std::chrono::steady_clock::now( );
+#if defined( TUDAT_BENCHMARK_COUNT_HEAP_ALLOCATIONS )
+    isHeapAllocationCountActive.store( false );
+#endif
+    if( !isStarted_ )
+    {
+        throw std::runtime_error( "Error when stopping benchmark measurement of " + result.scenarioName_ +
+                                  ", measurement was not started." );
+    }
+    result.wallTime_ = std::chrono::duration_cast< std::chrono::nanoseconds >( stopTime - startTime_ ).count( ) * 1.0E-9;
+#if defined( TUDAT_BENCHMARK_COUNT_HEAP_ALLOCATIONS )
+    result.heapAllocations_ = static_cast< long long >( numberOfHeapAllocations.load( ) );
+#endif
+    isStopped_ = true;
+}
+
+//! Function to run a single benchmark scenario
+BenchmarkResult runBenchmarkScenario( const std::string& scenarioName,
+                                      const BenchmarkScenarioFunction& scenarioFunction )
+{
+    BenchmarkResult result;
+    result.scenarioName_ = scenarioName;
+
+    BenchmarkMeasurement measurement;
+    scenarioFunction( result, measurement );
+    if( !measurement.isCompleted( ) )
+    {
+        throw std::runtime_error( "Error when running benchmark scenario " + scenarioName +
+                                  ", measurement was not completed." );
+    }
+
+    result.peakResidentSetSize_ = getPeakResidentSetSize( );
+    return result;
+}
+
+//! Function to write the results of a single scenario as a single-line JSON object
+void writeBenchmarkResultAsJson( const BenchmarkResult& result, std::ostream& outputStream )
+{
+    std::streamsize originalPrecision = outputStream.precision( );
+    outputStream << std::setprecision( 17 );
+
+    outputStream << "{\"scenario\": ";
+    writeJsonString( result.scenarioName_, outputStream );
+    outputStream << ", \"wall_time_s\": ";
+    writeJsonNumber( result.wallTime_, outputStream );
+    outputStream << ", \"function_evaluations\": " << result.functionEvaluations_
+                 << ", \"heap_allocations\": ";
+    if( result.heapAllocations_ >= 0 )
+    {
+        outputStream << result.heapAllocations_;
+    }
+    else
+    {
+        outputStream << "null";
+    }
+    outputStream << ", \"peak_rss_kb\": ";
+    if( result.peakResidentSetSize_ >= 0 )
+    {
+        outputStream << result.peakResidentSetSize_;
+    }
+    else
+    {
+        outputStream << "null";
+    }
+    outputStream << ", \"metrics\": {";
+    for( auto metricIterator = result.metrics_.begin( ); metricIterator != result.metrics_.end( ); metricIterator++ )
+    {
+        if( metricIterator != result.metrics_.begin( ) )
+        {
+            outputStream << ", ";
+        }
+        writeJsonString( metricIterator->first, outputStream );
+        outputStream << ": ";
+        writeJsonNumber( metricIterator->second, outputStream );
+    }
+    outputStream << "}}" << std::endl;
+
+    outputStream.precision( originalPrecision );
+}
+
+//! Function to write the header line of the CSV benchmark output
+void writeBenchmarkCsvHeader( std::ostream& outputStream )
+{
+    outputStream << "scenario,wall_time_s,function_evaluations,heap_allocations,peak_rss_kb,metrics"
+                 << std::endl;
+}
+
+//! Function to write the results of a single scenario as a single CSV line
+void writeBenchmarkResultAsCsv( const BenchmarkResult& result, std::ostream& outputStream )
+{
+    std::streamsize originalPrecision = outputStream.precision( );
+    outputStream << std::setprecision( 17 );
+
+    outputStream << result.scenarioName_ << "," << result.wallTime_ << "," << result.functionEvaluations_ << ",";
+    if( result.heapAllocations_ >= 0 )
+    {
+        outputStream << result.heapAllocations_;
+    }
+    outputStream << ",";
+    if( result.peakResidentSetSize_ >= 0 )
+    {
+        outputStream << result.peakResidentSetSize_;
+    }
+    outputStream << ",";
+    for( auto metricIterator = result.metrics_.begin( ); metricIterator != result.metrics_.end( ); metricIterator++ )
+    {
+        if( metricIterator != result.metrics_.begin( ) )
+        {
+            outputStream << ";";
+        }
+        outputStream << metricIterator->first << "=" << metricIterator->second;
+    }
+    outputStream << std::endl;
+
+    outputStream.precision( originalPrecision );
+}
+
+} // namespace benchmarks
+
+} // namespace tudat
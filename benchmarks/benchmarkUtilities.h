@@ -0,0 +1,130 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BENCHMARKUTILITIES_H
+#define TUDAT_BENCHMARKUTILITIES_H
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Function to retrieve the peak resident set size (in kB) of the process, or -1 if not available on this platform
+/*!
+ *  Function to retrieve the peak resident set size (in kB) of the process, or -1 if not available on this platform.
+ *  Note that the peak resident set size cannot be reset, so that it includes all scenarios that have been run before
+ *  in the same process. To obtain the peak memory of a single scenario, it should be run in a separate process. If
+ *  not available, the peak resident set size is written as null (JSON) or as an empty field (CSV).
+ */
+long getPeakResidentSetSize( );
+
+//! Results of a single benchmark scenario
+struct BenchmarkResult
+{
+    //! Name of the scenario
+    std::string scenarioName_;
+
+    //! Wall clock time (in seconds) of the measured part of the scenario
+    double wallTime_ = 0.0;
+
+    //! Number of function evaluations of the dominant model in the scenario (e.g. state derivative evaluations)
+    unsigned long long functionEvaluations_ = 0;
+
+    //! Number of heap allocations (calls to malloc, calloc and realloc, from all threads) in the measured part of the
+    //! scenario, or -1 if not available on this platform (only counted for glibc). If not available, it is written as
+    //! null (JSON) or as an empty field (CSV).
+    long long heapAllocations_ = -1;
+
+    //! Peak resident set size (in kB) of the process after the scenario, see getPeakResidentSetSize
+    long peakResidentSetSize_ = -1;
+
+    //! Scenario-specific metrics (e.g. number of observations, converged residual)
+    std::map< std::string, double > metrics_;
+};
+
+//! Class that measures wall time and heap allocations of the part of a benchmark scenario between start and stop
+/*!
+ *  Class that measures wall time and heap allocations of the part of a benchmark scenario between start and stop, so
+ *  that the set-up of the scenario (e.g. loading of Spice kernels) can be excluded from the measurement.
+ */
+class BenchmarkMeasurement
+{
+public:
+
+    //! Constructor
+    BenchmarkMeasurement( ): isStarted_( false ), isStopped_( false ){ }
+
+    //! Function to start the measurement
+    void start( );
+
+    //! Function to stop the measurement, and set the wall time and number of heap allocations in the results
+    void stop( BenchmarkResult& result );
+
+    //! Function to check whether the measurement has been both started and stopped
+    bool isCompleted( ) const
+    {
+        return isStarted_ && isStopped_;
+    }
+
+private:
+
+    //! Boolean denoting whether start has been called
+    bool isStarted_;
+
+    //! Boolean denoting whether stop has been called
+    bool isStopped_;
+
+    //! Wall clock time at start of measurement
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+//! Function that runs a benchmark scenario, setting the function evaluations and metrics in the results
+typedef std::function< void( BenchmarkResult&, BenchmarkMeasurement& ) > BenchmarkScenarioFunction;
+
+//! Function to run a single benchmark scenario
+/*!
+ *  Function to run a single benchmark scenario. The scenario function is responsible for calling start and stop on the
+ *  measurement object around the part of the scenario that is to be measured, and for setting the number of function
+ *  evaluations and scenario-specific metrics. An exception is thrown if the measurement is not completed.
+ *  \param scenarioName Name of the scenario
+ *  \param scenarioFunction Function that runs the scenario
+ *  \return Results of the scenario
+ */
+BenchmarkResult runBenchmarkScenario( const std::string& scenarioName,
+                                      const BenchmarkScenarioFunction& scenarioFunction );
+
+//! Function to write the results of a single scenario as a single-line JSON object
+void writeBenchmarkResultAsJson( const BenchmarkResult& result, std::ostream& outputStream );
+
+//! Function to write the header line of the CSV benchmark output
+void writeBenchmarkCsvHeader( std::ostream& outputStream );
+
+//! Function to write the results of a single scenario as a single CSV line
+/*!
+ *  Function to write the results of a single scenario as a single CSV line, with the scenario-specific metrics combined
+ *  in the final column as semicolon-separated name=value pairs.
+ *  \param result Results of the scenario
+ *  \param outputStream Stream to which the line is written
+ */
+void writeBenchmarkResultAsCsv( const BenchmarkResult& result, std::ostream& outputStream );
+
+} // namespace benchmarks
+
+} // namespace tudat
+
+#endif // TUDAT_BENCHMARKUTILITIES_H
@@ -0,0 +1,131 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "benchmarkScenarios.h"
+
+//! Run the standard Tudat benchmark scenarios, and write the results in machine-readable format
+/*!
+ *  Run the standard Tudat benchmark scenarios, and write the results in machine-readable format. Usage:
+ *
+ *      tudat_benchmarks [--list] [--format=json|csv] [--output=<file>] [scenario ...]
+ *
+ *  If no scenarios are given, all scenarios are run. JSON output consists of one JSON object per line (per scenario).
+ *  Since the peak resident set size of a process cannot be reset, a single scenario should be run per process when
+ *  comparing peak memory between scenarios.
+ */
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat::benchmarks;
+
+    std::vector< std::pair< std::string, BenchmarkScenarioFunction > > availableScenarios = getBenchmarkScenarios( );
+
+    // Parse command line arguments
+    std::string outputFormat = "json";
+    std::string outputFile = "";
+    std::set< std::string > selectedScenarios;
+    for( int i = 1; i < argc; i++ )
+    {
+        std::string argument = argv[ i ];
+        if( argument == "--list" )
+        {
+            for( unsigned int j = 0; j < availableScenarios.size( ); j++ )
+            {
+                std::cout << availableScenarios.at( j ).first << std::endl;
+            }
+            return EXIT_SUCCESS;
+        }
+        else if( argument.find( "--format=" ) == 0 )
+        {
+            outputFormat = argument.substr( 9 );
+            if( outputFormat != "json" && outputFormat != "csv" )
+            {
+                std::cerr << "Error, benchmark output format " << outputFormat << " not recognized (use json or csv)"
+                          << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if( argument.find( "--output=" ) == 0 )
+        {
+            outputFile = argument.substr( 9 );
+        }
+        else
+        {
+            bool scenarioFound = false;
+            for( unsigned int j = 0; j < availableScenarios.size( ); j++ )
+            {
+                if( availableScenarios.at( j ).first == argument )
+                {
+                    scenarioFound = true;
+                }
+            }
+            if( !scenarioFound )
+            {
+                std::cerr << "Error, benchmark scenario " << argument << " not recognized (use --list for options)"
+                          << std::endl;
+                return EXIT_FAILURE;
+            }
+            selectedScenarios.insert( argument );
+        }
+    }
+
+    std::ofstream outputFileStream;
+    if( outputFile != "" )
+    {
+        outputFileStream.open( outputFile );
+        if( !outputFileStream.is_open( ) )
+        {
+            std::cerr << "Error, could not open benchmark output file " << outputFile << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::ostream& outputStream = ( outputFile != "" ) ? outputFileStream : std::cout;
+
+    if( outputFormat == "csv" )
+    {
+        writeBenchmarkCsvHeader( outputStream );
+    }
+
+    // Run scenarios, in fixed order
+    int numberOfFailedScenarios = 0;
+    for( unsigned int i = 0; i < availableScenarios.size( ); i++ )
+    {
+        if( selectedScenarios.size( ) > 0 && selectedScenarios.count( availableScenarios.at( i ).first ) == 0 )
+        {
+            continue;
+        }
+
+        try
+        {
+            BenchmarkResult result = runBenchmarkScenario(
+                        availableScenarios.at( i ).first, availableScenarios.at( i ).second );
+            if( outputFormat == "csv" )
+            {
+                writeBenchmarkResultAsCsv( result, outputStream );
+            }
+            else
+            {
+                writeBenchmarkResultAsJson( result, outputStream );
+            }
+        }
+        catch( const std::exception& caughtException )
+        {
+            std::cerr << "Error in benchmark scenario " << availableScenarios.at( i ).first << ": "
+                      << caughtException.what( ) << std::endl;
+            numberOfFailedScenarios++;
+        }
+    }
+
+    return ( numberOfFailedScenarios == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -85,6 +85,18 @@ public:
     //! Default destructor.
     virtual ~AerodynamicCoefficientInterface( ) { }
 
+    //! Function to create a copy of this object, with independent current coefficients.
+    /*!
+     *  Function to create a copy of this object, with independent current coefficients (including those of the
+     *  control surfaces), but sharing the (possibly large) data from which the coefficients are computed, so that the
+     *  copy and the original can be updated concurrently. Must be implemented in derived classes that support this.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< AerodynamicCoefficientInterface > clone( ) const
+    {
+        throw std::runtime_error( "Error, cloning not supported for this type of aerodynamic coefficient interface" );
+    }
+
     //! Get reference area.
     /*!
      * Returns reference area used to non-dimensionalize aerodynamic forces and moments.
@@ -466,6 +478,15 @@ public:
 
 protected:
 
+    //! Function to replace the control surface interfaces by copies, with independent current coefficient increments.
+    void cloneControlSurfaceIncrementInterfaces( )
+    {
+        for( auto controlSurfaceIterator: controlSurfaceIncrementInterfaces_ )
+        {
+            controlSurfaceIncrementInterfaces_[ controlSurfaceIterator.first ] = controlSurfaceIterator.second->clone( );
+        }
+    }
+
     //! The current force coefficients.
     /*!
      * The force coefficients at the current flight condition.
@@ -595,6 +616,15 @@ public:
 
     }
 
+    std::shared_ptr< AerodynamicCoefficientInterface > clone( ) const
+    {
+        std::shared_ptr< ScaledAerodynamicCoefficientInterface > clonedInterface =
+                std::make_shared< ScaledAerodynamicCoefficientInterface >( *this );
+        clonedInterface->baseCoefficientInterface_ = baseCoefficientInterface_->clone( );
+        clonedInterface->cloneControlSurfaceIncrementInterfaces( );
+        return clonedInterface;
+    }
+
 private:
 
     std::shared_ptr< AerodynamicCoefficientInterface > baseCoefficientInterface_;
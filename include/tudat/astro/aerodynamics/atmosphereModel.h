@@ -13,6 +13,7 @@
 #define TUDAT_ATMOSPHERE_MODEL_H
 
 #include <memory>
+#include <stdexcept>
 
 #include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/astro/aerodynamics/windModel.h"
@@ -65,6 +66,18 @@ public:
     */
     virtual ~AtmosphereModel( ) { }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original (e.g. in a propagation
+     *  in a different thread), with its own current atmospheric properties. The wind model (which keeps no evaluation
+     *  state) is shared with the original. Must be implemented in derived classes that support this.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< AtmosphereModel > clone( ) const
+    {
+        throw std::runtime_error( "Error, cloning not supported for this type of atmosphere model" );
+    }
+
     //! Get local density.
     /*!
     * Returns the local density parameter of the atmosphere in kg per meter^3.
@@ -155,6 +168,14 @@ public:
         densityScalingFunction_( densityScalingFunction ),
         isScalingAbsolute_( isScalingAbsolute ){ }
 
+    //! Function to create a copy of this object (and its base atmosphere) that can be evaluated concurrently with the original
+    std::shared_ptr< AtmosphereModel > clone( ) const
+    {
+        std::shared_ptr< ScaledAtmosphereModel > clonedAtmosphere = std::make_shared< ScaledAtmosphereModel >( *this );
+        clonedAtmosphere->baseAtmosphere_ = baseAtmosphere_->clone( );
+        return clonedAtmosphere;
+    }
+
     double getDensity( const double altitude, const double longitude,
                        const double latitude, const double time )
     {
@@ -12,7 +12,8 @@
 #define TUDAT_CONTROLSURFACEAERODYNAMICCOEFFICIENTINTERFACE_H
 
 #include <vector>
-
+#include <memory>
+#include <stdexcept>
 #include <functional>
 
 
@@ -77,6 +78,18 @@ public:
     //! Destructor
     virtual ~ControlSurfaceIncrementAerodynamicInterface( ){ }
 
+    //! Function to create a copy of this object, with independent current coefficient increments.
+    /*!
+     *  Function to create a copy of this object, with independent current coefficient increments, but sharing the
+     *  (possibly large) data from which the increments are computed. Must be implemented in derived classes that
+     *  support this.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > clone( ) const
+    {
+        throw std::runtime_error( "Error, cloning not supported for this type of control surface aerodynamic interface" );
+    }
+
     //! Compute the aerodynamic coefficient increments of the control surface.
     /*!
      *  Computes the current force and moment coefficients increments of the control surface, and is to be
@@ -261,6 +274,17 @@ public:
         currentMomentCoefficients_ = currentCoefficients.segment( 3, 3 );
     }
 
+    //! Function to create a copy of this object, with independent current coefficient increments.
+    /*!
+     *  Function to create a copy of this object, with independent current coefficient increments. The coefficient
+     *  function is shared with the copy.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > clone( ) const
+    {
+        return std::make_shared< CustomControlSurfaceIncrementAerodynamicInterface >( *this );
+    }
+
 protected:
 
     //! Function returning the concatenated aerodynamic force and moment coefficient increments as function of the set of
@@ -197,6 +197,20 @@ public:
        return coefficientFunction_( std::vector< double >( ) );
    }
 
+    //! Function to create a copy of this object, with independent current coefficients.
+    /*!
+     *  Function to create a copy of this object, with independent current coefficients. The coefficient (and time
+     *  update) functions are shared with the copy.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< AerodynamicCoefficientInterface > clone( ) const
+    {
+        std::shared_ptr< CustomAerodynamicCoefficientInterface > clonedInterface =
+                std::make_shared< CustomAerodynamicCoefficientInterface >( *this );
+        clonedInterface->cloneControlSurfaceIncrementInterfaces( );
+        return clonedInterface;
+    }
+
    //! Function to perform the closure for time-varying (arc-wise constant) coefficients
    /*!
     * Function to perform the closure for time-varying (arc-wise constant) coefficients
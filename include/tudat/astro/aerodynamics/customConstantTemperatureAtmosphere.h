@@ -154,6 +154,17 @@ public:
             const double ratioOfSpecificHeats,
             const std::vector< double >& modelSpecificParameters );
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original. The density function
+     *  is shared with the original, and must be safe to call from multiple threads.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< AtmosphereModel > clone( ) const
+    {
+        return std::make_shared< CustomConstantTemperatureAtmosphere >( *this );
+    }
+
     //! Get the function to compute the density at the current conditions.
     /*!
      *  Function to return the function to compute the density at the current conditions.
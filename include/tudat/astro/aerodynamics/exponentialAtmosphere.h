@@ -89,6 +89,12 @@ public:
     ExponentialAtmosphere(
          const BodiesWithPredefinedExponentialAtmospheres bodyWithPredefinedExponentialAtmosphere );
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    std::shared_ptr< AtmosphereModel > clone( ) const
+    {
+        return std::make_shared< ExponentialAtmosphere >( *this );
+    }
+
     //! Get scale height.
     /*!
      * Returns the scale height (property of exponential atmosphere) in meters.
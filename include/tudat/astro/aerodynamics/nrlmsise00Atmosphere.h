@@ -378,6 +378,21 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         hashKey_ = 0;
     }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original, with its own
+     *  NRLMSISE00 input and output data and current atmospheric properties. The input function and solar activity data
+     *  are shared with the original (a custom input function must be safe to call from multiple threads).
+     *  \return Copy of this object
+     */
+    std::shared_ptr< AtmosphereModel > clone( ) const
+    {
+        std::shared_ptr< NRLMSISE00Atmosphere > clonedAtmosphere = std::make_shared< NRLMSISE00Atmosphere >( *this );
+        clonedAtmosphere->input_.ap_a = &clonedAtmosphere->aph_;
+        clonedAtmosphere->resetHashKey( );
+        return clonedAtmosphere;
+    }
+
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > getSolarActivityContainer( )
     {
         return solarActivityContainer_;
@@ -200,6 +200,18 @@ public:
     //! Destructor
     ~TabulatedAtmosphere( ){ }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original, with its own buffer
+     *  of independent variables. The interpolators (whose lookup schemes keep only an atomic index as evaluation state)
+     *  are shared with the original.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< AtmosphereModel > clone( ) const
+    {
+        return std::make_shared< TabulatedAtmosphere >( *this );
+    }
+
     //! Get atmosphere table file name.
     /*!
      *  Returns atmosphere table file name.
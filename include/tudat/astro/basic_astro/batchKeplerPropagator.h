@@ -0,0 +1,499 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Danby, J.M.A., The solution of Kepler's equation, III, Celestial Mechanics 40, 303-312, 1987.
+ *
+ *    Notes
+ *      The fixed-iteration solution of Kepler's equation converges to machine precision for eccentricities up to
+ *      (approximately) 0.99 with the default number of iterations. For higher eccentricities, each solution is checked
+ *      against a tolerance, and the (scalar) root-finder based convertMeanAnomalyToEccentricAnomaly function is used
+ *      for solutions that have not converged.
+ *
+ */
+
+#ifndef TUDAT_BATCH_KEPLER_PROPAGATOR_H
+#define TUDAT_BATCH_KEPLER_PROPAGATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/utilities.h"
+#include "tudat/astro/basic_astro/keplerPropagator.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/basic_astro/convertMeanToEccentricAnomalies.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Number of entries that are processed together by the batch Kepler equation solver.
+const int BATCH_KEPLER_SOLVER_CHUNK_SIZE = 256;
+
+//! Function to reduce a mean anomaly to the interval [-PI, PI].
+/*!
+ * Function to reduce a mean anomaly to the interval [-PI, PI], without branches.
+ * \param meanAnomaly Mean anomaly [rad].
+ * \return Mean anomaly reduced to the interval [-PI, PI] [rad].
+ */
+template< typename ScalarType = double >
+inline ScalarType reduceMeanAnomaly( const ScalarType meanAnomaly )
+{
+    const ScalarType twoPi = mathematical_constants::getFloatingInteger< ScalarType >( 2 ) *
+            mathematical_constants::getPi< ScalarType >( );
+    return meanAnomaly - twoPi * std::nearbyint( meanAnomaly / twoPi );
+}
+
+//! Compute eccentric anomaly for elliptical orbits, using a fixed number of iterations.
+/*!
+ * Computes the eccentric anomaly for elliptical orbits, using the starter of (Danby, 1987) and a fixed number of
+ * quartic (Danby) iterations on Kepler's equation. The function contains no branches and no convergence check, so that
+ * loops over this function can be vectorized by the compiler. With the default number of iterations, the solution is
+ * converged to machine precision for all mean anomalies, for eccentricities up to (approximately) 0.99. The convergence
+ * of the solution can be checked with isFixedIterationEccentricAnomalyConverged.
+ * \param eccentricity Eccentricity of the orbit (>= 0.0 and < 1.0) [-].
+ * \param reducedMeanAnomaly Mean anomaly, reduced to the interval [-PI, PI] (see reduceMeanAnomaly) [rad].
+ * \param numberOfIterations Number of iterations on Kepler's equation.
+ * \return Eccentric anomaly, in the interval [-PI, PI] [rad].
+ */
+template< typename ScalarType = double >
+inline ScalarType computeEccentricAnomalyWithFixedIterations(
+        const ScalarType eccentricity, const ScalarType reducedMeanAnomaly, const int numberOfIterations = 4 )
+{
+    const ScalarType one = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+    const ScalarType half = one / mathematical_constants::getFloatingInteger< ScalarType >( 2 );
+    const ScalarType sixth = one / mathematical_constants::getFloatingInteger< ScalarType >( 6 );
+
+    // Set starter.
+    ScalarType eccentricAnomaly = reducedMeanAnomaly + static_cast< ScalarType >( 0.85 ) * eccentricity *
+            std::copysign( one, reducedMeanAnomaly );
+
+    // Perform quartic iterations.
+    for( int i = 0; i < numberOfIterations; i++ )
+    {
+        const ScalarType eccentricitySine = eccentricity * std::sin( eccentricAnomaly );
+        const ScalarType eccentricityCosine = eccentricity * std::cos( eccentricAnomaly );
+        const ScalarType functionValue = eccentricAnomaly - eccentricitySine - reducedMeanAnomaly;
+        const ScalarType firstDerivative = one - eccentricityCosine;
+
+        const ScalarType firstCorrection = -functionValue / firstDerivative;
+        const ScalarType secondCorrection = -functionValue /
+                ( firstDerivative + half * firstCorrection * eccentricitySine );
+        eccentricAnomaly += -functionValue /
+                ( firstDerivative + half * secondCorrection * eccentricitySine +
+                  sixth * secondCorrection * secondCorrection * eccentricityCosine );
+    }
+    return eccentricAnomaly;
+}
+
+//! Function to check whether an eccentric anomaly computed with a fixed number of iterations is converged.
+/*!
+ * Function to check whether an eccentric anomaly computed with computeEccentricAnomalyWithFixedIterations is converged,
+ * i.e. whether the (first-order) estimate of its error, computed from the residual of Kepler's equation, is below the
+ * tolerance.
+ * \param eccentricity Eccentricity of the orbit [-].
+ * \param reducedMeanAnomaly Mean anomaly, reduced to the interval [-PI, PI] [rad].
+ * \param eccentricAnomaly Eccentric anomaly that is to be checked [rad].
+ * \param tolerance Tolerance on eccentric anomaly [rad].
+ * \return True if the eccentric anomaly is converged.
+ */
+template< typename ScalarType = double >
+inline bool isFixedIterationEccentricAnomalyConverged(
+        const ScalarType eccentricity, const ScalarType reducedMeanAnomaly, const ScalarType eccentricAnomaly,
+        const ScalarType tolerance )
+{
+    return std::fabs( computeKeplersFunctionForEllipticalOrbits< ScalarType >(
+                          eccentricAnomaly, eccentricity, reducedMeanAnomaly ) ) <=
+            tolerance * computeFirstDerivativeKeplersFunctionForEllipticalOrbits< ScalarType >(
+                eccentricAnomaly, eccentricity );
+}
+
+//! Convert mean anomaly to eccentric anomaly, using a fixed number of iterations.
+/*!
+ * Converts mean anomaly to eccentric anomaly for elliptical orbits, using computeEccentricAnomalyWithFixedIterations.
+ * If the solution is not converged to within the tolerance, convertMeanAnomalyToEccentricAnomaly is used instead.
+ * \param eccentricity Eccentricity of the orbit (>= 0.0 and < 1.0) [-].
+ * \param meanAnomaly Mean anomaly [rad].
+ * \param numberOfIterations Number of iterations on Kepler's equation.
+ * \param tolerance Tolerance on eccentric anomaly, below which the fixed-iteration solution is accepted [rad].
+ * \param fallbackRootFinder Root finder used by convertMeanAnomalyToEccentricAnomaly if the fixed-iteration solution
+ * is not converged (default if nullptr).
+ * \return Eccentric anomaly, in the interval [-PI, PI] [rad].
+ */
+template< typename ScalarType = double >
+ScalarType convertMeanAnomalyToEccentricAnomalyWithFixedIterations(
+        const ScalarType eccentricity, const ScalarType meanAnomaly,
+        const int numberOfIterations = 4,
+        const ScalarType tolerance = 10.0 * std::numeric_limits< ScalarType >::epsilon( ),
+        const std::shared_ptr< root_finders::RootFinder< ScalarType > > fallbackRootFinder = nullptr )
+{
+    const ScalarType reducedMeanAnomaly = reduceMeanAnomaly< ScalarType >( meanAnomaly );
+    ScalarType eccentricAnomaly = computeEccentricAnomalyWithFixedIterations< ScalarType >(
+                eccentricity, reducedMeanAnomaly, numberOfIterations );
+
+    if( !isFixedIterationEccentricAnomalyConverged< ScalarType >(
+            eccentricity, reducedMeanAnomaly, eccentricAnomaly, tolerance ) )
+    {
+        eccentricAnomaly = convertMeanAnomalyToEccentricAnomaly< ScalarType >(
+                    eccentricity, reducedMeanAnomaly, true, TUDAT_NAN, fallbackRootFinder );
+        if( eccentricAnomaly > mathematical_constants::getPi< ScalarType >( ) )
+        {
+            eccentricAnomaly -= mathematical_constants::getFloatingInteger< ScalarType >( 2 ) *
+                    mathematical_constants::getPi< ScalarType >( );
+        }
+    }
+    return eccentricAnomaly;
+}
+
+//! Propagate Kepler orbit, using a fixed number of iterations to solve Kepler's equation.
+/*!
+ * Propagates Kepler orbit, identical to propagateKeplerOrbit, but using
+ * convertMeanAnomalyToEccentricAnomalyWithFixedIterations to solve Kepler's equation for elliptical orbits. Hyperbolic
+ * orbits are propagated using propagateKeplerOrbit.
+ * \param initialStateInKeplerianElements Initial state vector in classical Keplerian elements.
+ * \param propagationTime propagation time [s].
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param numberOfIterations Number of iterations on Kepler's equation.
+ * \param tolerance Tolerance on eccentric anomaly, below which the fixed-iteration solution is accepted [rad].
+ * \param fallbackRootFinder Root finder used if the fixed-iteration solution is not converged, and for hyperbolic
+ * orbits (default if nullptr).
+ * \return Final state vector in classical Keplerian elements (true anomaly in the interval [-PI, PI]).
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, 6, 1 > propagateKeplerOrbitWithFixedIterations(
+        const Eigen::Matrix< ScalarType, 6, 1 >& initialStateInKeplerianElements,
+        const ScalarType propagationTime,
+        const ScalarType centralBodyGravitationalParameter,
+        const int numberOfIterations = 4,
+        const ScalarType tolerance = 10.0 * std::numeric_limits< ScalarType >::epsilon( ),
+        const std::shared_ptr< root_finders::RootFinder< ScalarType > > fallbackRootFinder = nullptr )
+{
+    const ScalarType eccentricity = initialStateInKeplerianElements( eccentricityIndex );
+    if( !( eccentricity >= mathematical_constants::getFloatingInteger< ScalarType >( 0 ) &&
+           eccentricity < mathematical_constants::getFloatingInteger< ScalarType >( 1 ) ) )
+    {
+        return propagateKeplerOrbit< ScalarType >(
+                    initialStateInKeplerianElements, propagationTime, centralBodyGravitationalParameter,
+                    fallbackRootFinder );
+    }
+
+    // Compute mean anomaly at end of propagation.
+    const ScalarType meanAnomaly =
+            convertEllipticalEccentricAnomalyToMeanAnomaly< ScalarType >(
+                convertTrueAnomalyToEllipticalEccentricAnomaly< ScalarType >(
+                    initialStateInKeplerianElements( trueAnomalyIndex ), eccentricity ), eccentricity ) +
+            convertElapsedTimeToEllipticalMeanAnomalyChange< ScalarType >(
+                propagationTime, centralBodyGravitationalParameter,
+                initialStateInKeplerianElements( semiMajorAxisIndex ) );
+
+    // Compute true anomaly at end of propagation.
+    Eigen::Matrix< ScalarType, 6, 1 > finalStateInKeplerianElements = initialStateInKeplerianElements;
+    finalStateInKeplerianElements( trueAnomalyIndex ) =
+            convertEllipticalEccentricAnomalyToTrueAnomaly< ScalarType >(
+                convertMeanAnomalyToEccentricAnomalyWithFixedIterations< ScalarType >(
+                    eccentricity, meanAnomaly, numberOfIterations, tolerance, fallbackRootFinder ), eccentricity );
+    return finalStateInKeplerianElements;
+}
+
+//! Convert list of mean anomalies to eccentric anomalies, using a fixed number of iterations.
+/*!
+ * Converts list of mean anomalies to eccentric anomalies for elliptical orbits, using
+ * computeEccentricAnomalyWithFixedIterations on contiguous arrays (so that the solution can be vectorized by the
+ * compiler), distributed over the requested number of threads. Solutions that are not converged to within the
+ * tolerance are recomputed using convertMeanAnomalyToEccentricAnomaly.
+ * \param eccentricities Eccentricities of the orbits (each >= 0.0 and < 1.0) [-].
+ * \param meanAnomalies Mean anomalies (same size as eccentricities) [rad].
+ * \param numberOfThreads Number of threads over which the conversions are distributed.
+ * \param numberOfIterations Number of iterations on Kepler's equation.
+ * \param tolerance Tolerance on eccentric anomaly, below which the fixed-iteration solution is accepted [rad].
+ * \return Eccentric anomalies, each in the interval [-PI, PI] [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        const int numberOfThreads = 1,
+        const int numberOfIterations = 4,
+        const ScalarType tolerance = 10.0 * std::numeric_limits< ScalarType >::epsilon( ) )
+{
+    if( eccentricities.rows( ) != meanAnomalies.rows( ) )
+    {
+        throw std::runtime_error( "Error when converting mean to eccentric anomalies, input sizes are inconsistent (" +
+                                  std::to_string( eccentricities.rows( ) ) + " eccentricities and " +
+                                  std::to_string( meanAnomalies.rows( ) ) + " mean anomalies)" );
+    }
+    for( int i = 0; i < eccentricities.rows( ); i++ )
+    {
+        if( !( eccentricities( i ) >= mathematical_constants::getFloatingInteger< ScalarType >( 0 ) &&
+               eccentricities( i ) < mathematical_constants::getFloatingInteger< ScalarType >( 1 ) ) )
+        {
+            throw std::runtime_error( "Error when converting mean to eccentric anomalies, eccentricity " +
+                                      std::to_string( i ) + " is not elliptical" );
+        }
+    }
+
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > reducedMeanAnomalies( meanAnomalies.rows( ) );
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > eccentricAnomalies( meanAnomalies.rows( ) );
+    utilities::parallelForEachBlock(
+                static_cast< int >( meanAnomalies.rows( ) ), numberOfThreads,
+                [ & ]( const int startIndex, const int endIndex, const int )
+    {
+        const ScalarType* eccentricityData = eccentricities.data( );
+        const ScalarType* meanAnomalyData = meanAnomalies.data( );
+        ScalarType* reducedMeanAnomalyData = reducedMeanAnomalies.data( );
+        ScalarType* eccentricAnomalyData = eccentricAnomalies.data( );
+
+        // Solve Kepler's equation for all entries, without branches
+        for( int i = startIndex; i < endIndex; i++ )
+        {
+            reducedMeanAnomalyData[ i ] = reduceMeanAnomaly< ScalarType >( meanAnomalyData[ i ] );
+        }
+        for( int i = startIndex; i < endIndex; i++ )
+        {
+            eccentricAnomalyData[ i ] = computeEccentricAnomalyWithFixedIterations< ScalarType >(
+                        eccentricityData[ i ], reducedMeanAnomalyData[ i ], numberOfIterations );
+        }
+
+        // Recompute solutions that have not converged
+        for( int i = startIndex; i < endIndex; i++ )
+        {
+            if( !isFixedIterationEccentricAnomalyConverged< ScalarType >(
+                    eccentricityData[ i ], reducedMeanAnomalyData[ i ], eccentricAnomalyData[ i ], tolerance ) )
+            {
+                eccentricAnomalyData[ i ] = convertMeanAnomalyToEccentricAnomalyWithFixedIterations< ScalarType >(
+                            eccentricityData[ i ], reducedMeanAnomalyData[ i ], 0, tolerance );
+            }
+        }
+    } );
+
+    return eccentricAnomalies;
+}
+
+//! Propagate list of Kepler orbits to list of times, using a fixed number of iterations to solve Kepler's equation.
+/*!
+ * Propagates list of Kepler orbits (e.g. a catalog of objects) about a single central body to a list of propagation
+ * times. The orbits are distributed over the requested number of threads. For each thread, Kepler's equation is solved
+ * for chunks of (orbit, time) combinations at once using computeEccentricAnomalyWithFixedIterations on contiguous
+ * arrays (so that the solution can be vectorized by the compiler). Solutions that are not converged to within the
+ * tolerance are recomputed using convertMeanAnomalyToEccentricAnomaly. Hyperbolic orbits are propagated using
+ * propagateKeplerOrbit.
+ * \param initialStatesInKeplerianElements Initial states of the orbits in classical Keplerian elements (one orbit per
+ * column).
+ * \param propagationTimes Propagation times to which the orbits are propagated [s].
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param convertToCartesianElements Boolean denoting whether the propagated states are to be provided in Cartesian
+ * (if true) or Keplerian elements (if false).
+ * \param numberOfThreads Number of threads over which the orbits are distributed.
+ * \param numberOfIterations Number of iterations on Kepler's equation.
+ * \param tolerance Tolerance on eccentric anomaly, below which the fixed-iteration solution is accepted [rad].
+ * \return Propagated states of the orbits (one orbit per column), for each propagation time.
+ */
+template< typename ScalarType = double >
+std::vector< Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > > propagateKeplerOrbitsToPropagationTimes(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& initialStatesInKeplerianElements,
+        const std::vector< ScalarType >& propagationTimes,
+        const ScalarType centralBodyGravitationalParameter,
+        const bool convertToCartesianElements,
+        const int numberOfThreads = 1,
+        const int numberOfIterations = 4,
+        const ScalarType tolerance = 10.0 * std::numeric_limits< ScalarType >::epsilon( ) )
+{
+    const int numberOfOrbits = static_cast< int >( initialStatesInKeplerianElements.cols( ) );
+    const int numberOfTimes = static_cast< int >( propagationTimes.size( ) );
+
+    std::vector< Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > > propagatedStates(
+                numberOfTimes, Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >( 6, numberOfOrbits ) );
+
+    utilities::parallelForEachBlock(
+                numberOfOrbits, numberOfThreads,
+                [ & ]( const int startIndex, const int endIndex, const int )
+    {
+        // Compute mean anomaly at initial time, and mean motion, of elliptical orbits in this block.
+        const int numberOfBlockOrbits = endIndex - startIndex;
+        std::vector< char > isOrbitElliptical( numberOfBlockOrbits );
+        std::vector< ScalarType > initialMeanAnomalies( numberOfBlockOrbits );
+        std::vector< ScalarType > meanMotions( numberOfBlockOrbits );
+        for( int i = 0; i < numberOfBlockOrbits; i++ )
+        {
+            const ScalarType eccentricity = initialStatesInKeplerianElements( eccentricityIndex, startIndex + i );
+            isOrbitElliptical[ i ] =
+                    ( eccentricity >= mathematical_constants::getFloatingInteger< ScalarType >( 0 ) &&
+                      eccentricity < mathematical_constants::getFloatingInteger< ScalarType >( 1 ) );
+            if( isOrbitElliptical[ i ] )
+            {
+                initialMeanAnomalies[ i ] = convertEllipticalEccentricAnomalyToMeanAnomaly< ScalarType >(
+                            convertTrueAnomalyToEllipticalEccentricAnomaly< ScalarType >(
+                                initialStatesInKeplerianElements( trueAnomalyIndex, startIndex + i ), eccentricity ),
+                            eccentricity );
+                meanMotions[ i ] = convertElapsedTimeToEllipticalMeanAnomalyChange< ScalarType >(
+                            mathematical_constants::getFloatingInteger< ScalarType >( 1 ),
+                            centralBodyGravitationalParameter,
+                            initialStatesInKeplerianElements( semiMajorAxisIndex, startIndex + i ) );
+            }
+        }
+
+        // Process (orbit, time) combinations of this block in chunks, in order of orbit, then time.
+        ScalarType chunkEccentricities[ BATCH_KEPLER_SOLVER_CHUNK_SIZE ];
+        ScalarType chunkMeanAnomalies[ BATCH_KEPLER_SOLVER_CHUNK_SIZE ];
+        ScalarType chunkEccentricAnomalies[ BATCH_KEPLER_SOLVER_CHUNK_SIZE ];
+        const long long numberOfBlockEntries = static_cast< long long >( numberOfBlockOrbits ) * numberOfTimes;
+        for( long long chunkStart = 0; chunkStart < numberOfBlockEntries; chunkStart += BATCH_KEPLER_SOLVER_CHUNK_SIZE )
+        {
+            const int chunkSize = static_cast< int >(
+                        std::min< long long >( BATCH_KEPLER_SOLVER_CHUNK_SIZE, numberOfBlockEntries - chunkStart ) );
+
+            // Set mean anomalies (eccentricity and mean anomaly of non-elliptical orbits set to zero).
+            for( int j = 0; j < chunkSize; j++ )
+            {
+                const int orbitIndex = static_cast< int >( ( chunkStart + j ) / numberOfTimes );
+                const int timeIndex = static_cast< int >( ( chunkStart + j ) % numberOfTimes );
+                if( isOrbitElliptical[ orbitIndex ] )
+                {
+                    chunkEccentricities[ j ] =
+                            initialStatesInKeplerianElements( eccentricityIndex, startIndex + orbitIndex );
+                    chunkMeanAnomalies[ j ] = reduceMeanAnomaly< ScalarType >(
+                                initialMeanAnomalies[ orbitIndex ] +
+                                meanMotions[ orbitIndex ] * propagationTimes[ timeIndex ] );
+                }
+                else
+                {
+                    chunkEccentricities[ j ] = mathematical_constants::getFloatingInteger< ScalarType >( 0 );
+                    chunkMeanAnomalies[ j ] = mathematical_constants::getFloatingInteger< ScalarType >( 0 );
+                }
+            }
+
+            // Solve Kepler's equation for all entries, without branches
+            for( int j = 0; j < chunkSize; j++ )
+            {
+                chunkEccentricAnomalies[ j ] = computeEccentricAnomalyWithFixedIterations< ScalarType >(
+                            chunkEccentricities[ j ], chunkMeanAnomalies[ j ], numberOfIterations );
+            }
+
+            // Check convergence, and set propagated states
+            for( int j = 0; j < chunkSize; j++ )
+            {
+                const int orbitIndex = static_cast< int >( ( chunkStart + j ) / numberOfTimes );
+                const int timeIndex = static_cast< int >( ( chunkStart + j ) % numberOfTimes );
+                const int columnIndex = startIndex + orbitIndex;
+
+                Eigen::Matrix< ScalarType, 6, 1 > propagatedState;
+                if( isOrbitElliptical[ orbitIndex ] )
+                {
+                    if( !isFixedIterationEccentricAnomalyConverged< ScalarType >(
+                            chunkEccentricities[ j ], chunkMeanAnomalies[ j ], chunkEccentricAnomalies[ j ], tolerance ) )
+                    {
+                        chunkEccentricAnomalies[ j ] = convertMeanAnomalyToEccentricAnomalyWithFixedIterations< ScalarType >(
+                                    chunkEccentricities[ j ], chunkMeanAnomalies[ j ], 0, tolerance );
+                    }
+                    propagatedState = initialStatesInKeplerianElements.col( columnIndex );
+                    propagatedState( trueAnomalyIndex ) = convertEllipticalEccentricAnomalyToTrueAnomaly< ScalarType >(
+                                chunkEccentricAnomalies[ j ], chunkEccentricities[ j ] );
+                }
+                else
+                {
+                    propagatedState = propagateKeplerOrbit< ScalarType >(
+                                initialStatesInKeplerianElements.col( columnIndex ), propagationTimes[ timeIndex ],
+                                centralBodyGravitationalParameter );
+                }
+
+                if( convertToCartesianElements )
+                {
+                    propagatedStates[ timeIndex ].col( columnIndex ) = convertKeplerianToCartesianElements< ScalarType >(
+                                propagatedState, centralBodyGravitationalParameter );
+                }
+                else
+                {
+                    propagatedStates[ timeIndex ].col( columnIndex ) = propagatedState;
+                }
+            }
+        }
+    } );
+
+    return propagatedStates;
+}
+
+//! Propagate list of Kepler orbits, using a fixed number of iterations to solve Kepler's equation.
+/*!
+ * Propagates list of Kepler orbits about a single central body over a single propagation time, using
+ * propagateKeplerOrbitsToPropagationTimes.
+ * \param initialStatesInKeplerianElements Initial states of the orbits in classical Keplerian elements (one orbit per
+ * column).
+ * \param propagationTime Propagation time [s].
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param numberOfThreads Number of threads over which the orbits are distributed.
+ * \param numberOfIterations Number of iterations on Kepler's equation.
+ * \return Final states of the orbits in classical Keplerian elements (one orbit per column).
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > propagateKeplerOrbits(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& initialStatesInKeplerianElements,
+        const ScalarType propagationTime,
+        const ScalarType centralBodyGravitationalParameter,
+        const int numberOfThreads = 1,
+        const int numberOfIterations = 4 )
+{
+    return propagateKeplerOrbitsToPropagationTimes< ScalarType >(
+                initialStatesInKeplerianElements, std::vector< ScalarType >( { propagationTime } ),
+                centralBodyGravitationalParameter, false, numberOfThreads, numberOfIterations ).at( 0 );
+}
+
+//! Function to compute the Cartesian state histories of a list of Kepler orbits.
+/*!
+ * Function to compute the Cartesian state histories of a list of Kepler orbits about a single central body, using
+ * propagateKeplerOrbitsToPropagationTimes.
+ * \param initialStatesInKeplerianElements States of the orbits in classical Keplerian elements at the initial time
+ * (one orbit per column).
+ * \param initialTime Time at which initialStatesInKeplerianElements is valid.
+ * \param outputTimes Times at which the Cartesian states are to be computed.
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param numberOfThreads Number of threads over which the orbits are distributed.
+ * \param numberOfIterations Number of iterations on Kepler's equation.
+ * \return Cartesian states of the orbits (one orbit per column), with the output times as key.
+ */
+template< typename ScalarType = double, typename TimeType = double >
+std::map< TimeType, Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > > getKeplerOrbitsCartesianStateHistory(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& initialStatesInKeplerianElements,
+        const TimeType initialTime,
+        const std::vector< TimeType >& outputTimes,
+        const ScalarType centralBodyGravitationalParameter,
+        const int numberOfThreads = 1,
+        const int numberOfIterations = 4 )
+{
+    std::vector< ScalarType > propagationTimes;
+    for( unsigned int i = 0; i < outputTimes.size( ); i++ )
+    {
+        propagationTimes.push_back( static_cast< ScalarType >( outputTimes.at( i ) - initialTime ) );
+    }
+
+    std::vector< Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > > cartesianStates =
+            propagateKeplerOrbitsToPropagationTimes< ScalarType >(
+                initialStatesInKeplerianElements, propagationTimes, centralBodyGravitationalParameter, true,
+                numberOfThreads, numberOfIterations );
+
+    std::map< TimeType, Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > > cartesianStateHistory;
+    for( unsigned int i = 0; i < outputTimes.size( ); i++ )
+    {
+        cartesianStateHistory[ outputTimes.at( i ) ] = cartesianStates.at( i );
+    }
+    return cartesianStateHistory;
+}
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_KEPLER_PROPAGATOR_H
@@ -20,7 +20,9 @@
 #include "tudat/astro/basic_astro/bodyShapeModel.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
+#include "tudat/math/basic/polyhedronSpatialIndex.h"
 #include <iostream>
+#include <memory>
 
 namespace tudat
 {
@@ -43,12 +45,16 @@ public:
      * above surface, <0 otherwise) or having always a positive value.
      * @param justComputeDistanceToVertices Flag indicating whether the distance should be computed wrt to all the
      * polyhedron features or wrt to just the vertices.
+     * @param useSpatialIndex Flag indicating whether a bounding volume hierarchy over the vertices and facets should be
+     * built at construction, and used for the closest-feature queries (O(log n) instead of O(n) per query). If the
+     * distance is computed wrt to all features, the index gives the exact distance to the surface.
      */
     PolyhedronBodyShapeModel(
             const Eigen::MatrixXd& verticesCoordinates,
             const Eigen::MatrixXi& verticesDefiningEachFacet,
             const bool computeAltitudeWithSign,
-            const bool justComputeDistanceToVertices ):
+            const bool justComputeDistanceToVertices,
+            const bool useSpatialIndex = false ):
         verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         computeAltitudeWithSign_( computeAltitudeWithSign ),
@@ -58,9 +64,15 @@ public:
         // Check if provided settings are valid
         basic_mathematics::checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
 
-        // If necessary, get list with vertices defining each edge
-        if ( !justComputeDistanceToVertices_ )
+        if ( useSpatialIndex )
         {
+            // Build spatial index, used instead of the linear search over the features
+            spatialIndex_ = std::make_shared< basic_mathematics::PolyhedronSpatialIndex >(
+                        verticesCoordinates_, verticesDefiningEachFacet_ );
+        }
+        else if ( !justComputeDistanceToVertices_ )
+        {
+            // Get list with vertices defining each edge
             computeVerticesDefiningEachEdge();
         }
     }
@@ -79,6 +91,17 @@ public:
      */
     double getAltitude( const Eigen::Vector3d& bodyFixedPosition );
 
+    //! Calculates the altitude above the polyhedron for a list of positions
+    /*!
+     *  Function to calculate the altitude above the polyhedron for a list of body fixed positions (e.g. along a
+     *  trajectory). The result for each position is identical to that of getAltitude.
+     *  \param bodyFixedPositions Cartesian, body-fixed positions (one per column) at which the altitude is to be
+     *  determined.
+     *  \param numberOfThreads Number of threads over which the positions are distributed.
+     *  \return Altitude above the polyhedron, for each position.
+     */
+    Eigen::VectorXd getAltitudes( const Eigen::Matrix3Xd& bodyFixedPositions, const int numberOfThreads = 1 );
+
     //! Function to return the average radius of the polyhedron.
     /*!
      *  Function to return the average radius of the polyhedron.
@@ -118,6 +141,12 @@ public:
         return justComputeDistanceToVertices_;
     }
 
+    // Function to return whether a spatial index is used for the closest-feature queries.
+    bool getUseSpatialIndex( )
+    {
+        return ( spatialIndex_ != nullptr );
+    }
+
 private:
 
     /*! Computes the distance to the vertex closest to the field point.
@@ -183,6 +212,9 @@ private:
     // Average radius of the polyhedron
     double averageRadius_;
 
+    // Spatial index used for the closest-feature queries (nullptr if linear search is used)
+    std::shared_ptr< basic_mathematics::PolyhedronSpatialIndex > spatialIndex_;
+
 };
 
 } // namespace basic_astrodynamics
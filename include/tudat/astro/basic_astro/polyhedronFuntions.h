@@ -11,6 +11,8 @@
  *      A. Dobrovolskis (1996), "Inertia of Any Polyhedron", Icarus, 124 (243), 698-704
  *      D.J. Scheeres (2012), "Orbital Motion in Strongly Perturbed Environments: Applications to Asteroid, Comet and
  *          Planetary Satellite Orbiters", Springer-Praxis.
+ *      A. Grundmann and H.M. Moeller (1978), "Invariant Integration Formulas for the N-Simplex by Combinatorial
+ *          Methods", SIAM Journal on Numerical Analysis, 15 (2), 282-290
  */
 
 #ifndef TUDAT_POLYHEDRONFUNTIONS_H
@@ -21,6 +23,7 @@
 #include <Eigen/Eigenvalues>
 
 #include <iostream>
+#include <utility>
 
 namespace tudat
 {
@@ -116,6 +119,44 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
                                                 const double gravitationalParameter,
                                                 const double gravitationalConstant );
 
+/*! Computes a quadrature rule for the integration of polynomials over a tetrahedron.
+ *
+ * Computes the Grundmann-Moeller quadrature rule for a tetrahedron (Grundmann and Moeller, 1978), which exactly
+ * integrates polynomials up to (at least) the requested degree. The nodes are returned as barycentric coordinates, and
+ * the weights are normalized such that they sum to one (i.e. the integral is obtained by multiplying the weighted sum
+ * of the integrand by the volume of the tetrahedron). Note that some of the weights are negative.
+ *
+ * @param polynomialDegree Degree of the polynomials that are to be integrated exactly.
+ * @param barycentricCoordinates Barycentric coordinates of the quadrature nodes (one row per node, 4 columns;
+ * returned by reference).
+ * @param weights Normalized weights of the quadrature nodes (returned by reference).
+ */
+void computeTetrahedronQuadratureRule( const int polynomialDegree,
+                                       Eigen::MatrixXd& barycentricCoordinates,
+                                       Eigen::VectorXd& weights );
+
+/*! Computes the spherical harmonic coefficients of a constant density polyhedron.
+ *
+ * Computes the geodesy-normalized spherical harmonic coefficients of a constant density polyhedron, w.r.t. the origin
+ * of the frame in which the vertices are defined. The volume integrals of the solid spherical harmonics are computed
+ * exactly, by applying the quadrature rule of computeTetrahedronQuadratureRule to the tetrahedra formed by each facet
+ * and the origin. The resulting expansion converges outside the Brillouin sphere of the polyhedron.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @param maximumDegree Maximum degree (and order) of the expansion.
+ * @param referenceRadius Reference radius of the expansion.
+ * @param numberOfThreads Number of threads over which the facets are distributed (values smaller than 2 denote serial
+ * computation).
+ * @return Pair with the cosine and sine coefficients (first and second entry, respectively).
+ */
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > computePolyhedronSphericalHarmonicCoefficients(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int maximumDegree,
+        const double referenceRadius,
+        const int numberOfThreads = 1 );
+
 } // namespace basic_astrodynamics
 } // namespace tudat
 
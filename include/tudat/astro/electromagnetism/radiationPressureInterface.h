@@ -14,6 +14,9 @@
 
 #include <vector>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <typeinfo>
 
 #include <functional>
 #include <boost/lambda/lambda.hpp>
@@ -115,6 +118,44 @@ public:
     //! Destructor
     virtual ~RadiationPressureInterface( ){ }
 
+    //! Function to create a copy of this object for a copy of the environment
+    /*!
+     *  Function to create a copy of this object for a copy of the environment (e.g. for a propagation in a different
+     *  thread), with its own current radiation pressure and source direction. Since the position functions of the source,
+     *  target and occulting bodies are bound to the original body objects, they must be provided for the copy of the
+     *  environment. The (constant) source power function and the radiation pressure coefficient function are shared with
+     *  the original. Cloning is not supported by derived classes (which depend on additional environment models).
+     *  \param sourcePositionFunction Function returning the position of the source in the copy of the environment
+     *  \param targetPositionFunction Function returning the position of the target in the copy of the environment
+     *  \param occultingBodyPositions Functions returning the positions of the occulting bodies in the copy of the
+     *  environment (in the same order as getOccultingBodies)
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< RadiationPressureInterface > clone(
+            const std::function< Eigen::Vector3d( ) > sourcePositionFunction,
+            const std::function< Eigen::Vector3d( ) > targetPositionFunction,
+            const std::vector< std::function< Eigen::Vector3d( ) > >& occultingBodyPositions ) const
+    {
+        if( typeid( *this ) != typeid( RadiationPressureInterface ) )
+        {
+            throw std::runtime_error( "Error, cloning not supported for this type of radiation pressure interface" );
+        }
+        if( occultingBodyPositions.size( ) != occultingBodyPositions_.size( ) )
+        {
+            throw std::runtime_error( "Error when cloning radiation pressure interface, inconsistent number of occulting bodies" );
+        }
+
+        std::shared_ptr< RadiationPressureInterface > clonedInterface =
+                std::make_shared< RadiationPressureInterface >( *this );
+        clonedInterface->sourcePositionFunction_ = sourcePositionFunction;
+        clonedInterface->targetPositionFunction_ = targetPositionFunction;
+        clonedInterface->occultingBodyPositions_ = occultingBodyPositions;
+        clonedInterface->currentRadiationPressure_ = TUDAT_NAN;
+        clonedInterface->currentSolarVector_.setZero( );
+        clonedInterface->currentTime_ = TUDAT_NAN;
+        return clonedInterface;
+    }
+
     //! Base class function to update the current properties of radiation pressure
     /*!
      *  Base class function to update the current properties of radiation pressure. This function is nominally called by the
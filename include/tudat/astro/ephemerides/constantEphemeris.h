@@ -55,6 +55,17 @@ public:
         Ephemeris( referenceFrameOrigin, referenceFrameOrientation )
         { constantStateFunction_ = [ = ]( ){ return constantState; }; }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original. The constant state
+     *  of the copy can be modified independently of the original.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< Ephemeris > clone( ) const
+    {
+        return std::make_shared< ConstantEphemeris >( *this );
+    }
+
     //! Get state from ephemeris.
     /*!
      * Returns state from ephemeris at given time.
@@ -42,6 +42,12 @@ public:
         updateConstantState( constantState );
     }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    std::shared_ptr< RotationalEphemeris > clone( ) const
+    {
+        return std::make_shared< ConstantRotationalEphemeris >( *this );
+    }
+
     ConstantRotationalEphemeris( const Eigen::Quaterniond& constantRotationToGlobalFrame,
                                  const std::string& baseFrameOrientation = "",
                                  const std::string& targetFrameOrientation = "" ):
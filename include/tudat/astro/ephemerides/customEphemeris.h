@@ -42,6 +42,17 @@ public:
         Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
         stateFunction_( stateFunction ) { }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original. The custom state
+     *  function is shared with the original, and must be safe to call from multiple threads.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< Ephemeris > clone( ) const
+    {
+        return std::make_shared< CustomEphemeris >( *this );
+    }
+
     //! Get state from ephemeris according to custom function
     /*!
      * Returns state from ephemeris at given time.
@@ -35,6 +35,17 @@ public:
      */
     virtual ~CustomRotationalEphemeris( ) { }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original. The custom orientation
+     *  function is shared with the original, and must be safe to call from multiple threads.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< RotationalEphemeris > clone( ) const
+    {
+        return std::make_shared< CustomRotationalEphemeris >( *this );
+    }
+
     virtual Eigen::Quaterniond getRotationToBaseFrame(
             const double secondsSinceEpoch )
     {
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <functional>
+#include <stdexcept>
 
 #include "tudat/astro/ephemerides/ephemeris.h"
 #include "tudat/math/basic/linearAlgebra.h"
@@ -66,6 +67,18 @@ public:
      */
     virtual ~Ephemeris( ) { }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original (e.g. in a propagation
+     *  in a different thread), sharing only data that is not modified when evaluating the ephemeris. Must be implemented
+     *  in derived classes that support this.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< Ephemeris > clone( ) const
+    {
+        throw std::runtime_error( "Error, cloning not supported for this type of ephemeris" );
+    }
+
     //! Get state from ephemeris.
     /*!
      * Returns state from ephemeris at given time
@@ -195,6 +208,14 @@ public:
     stateScalingFunction_( stateScalingFunction ),
     isScalingAbsolute_( isScalingAbsolute ){ }
 
+    //! Function to create a copy of this object (and its base ephemeris) that can be evaluated concurrently with the original
+    std::shared_ptr< Ephemeris > clone( ) const
+    {
+        std::shared_ptr< ScaledEphemeris > clonedEphemeris = std::make_shared< ScaledEphemeris >( *this );
+        clonedEphemeris->baseEphemeris_ = baseEphemeris_->clone( );
+        return clonedEphemeris;
+    }
+
     Eigen::Vector6d getCartesianState(
             const double secondsSinceEpoch  )
     {
@@ -51,9 +51,9 @@ public:
      *  \param referenceFrameOrigin Origin of reference frame (string identifier) (default SSB).
      *  \param referenceFrameOrientation Orientation of reference frame (string identifier)
      *  (default ECLIPJ000
-     *  \param rootFinderAbsoluteTolerance Convergence tolerance for root finder used to
-     *  convert mean to eccentric anomaly on each call to getCartesianState
-     *  (default 200*epsilon).
+     *  \param rootFinderAbsoluteTolerance Convergence tolerance for conversion from mean to eccentric
+     *  anomaly on each call to getCartesianState, used both for the fixed-iteration solution and for the
+     *  root finder that is used if the fixed-iteration solution does not converge (default 200*epsilon).
      *  \param rootFinderMaximumNumberOfIterations Maximum iteration for root finder used to
      *  convert mean to eccentric anomaly on each call to getCartesianState
      *  (default 1000).
@@ -76,6 +76,20 @@ public:
     Eigen::Vector6d getCartesianState(
             const double secondsSinceEpoch );
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original, with its own root
+     *  finder to convert mean to eccentric anomalies.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< Ephemeris > clone( ) const
+    {
+        return std::make_shared< KeplerEphemeris >(
+                    initialStateInKeplerianElements_, epochOfInitialState_, centralBodyGravitationalParameter_,
+                    referenceFrameOrigin_, referenceFrameOrientation_, rootFinderAbsoluteTolerance_,
+                    rootFinderMaximumNumberOfIterations_ );
+    }
+
 private:
 
     //! Kepler elements at time epochOfInitialState.
@@ -96,9 +110,15 @@ private:
     //! Rotation from orbital plane to frame in which the orbit is defined.
     Eigen::Quaterniond rotationFromOrbitalPlane_;
 
-    //! Root finder used to convert mean to eccentric anomalies.
+    //! Root finder used to convert mean to eccentric anomalies, if the fixed-iteration solution does not converge.
     std::shared_ptr< root_finders::RootFinder< double > > rootFinder_;
 
+    //! Tolerance on eccentric anomaly, below which the fixed-iteration solution of Kepler's equation is accepted.
+    double rootFinderAbsoluteTolerance_;
+
+    //! Maximum number of iterations of the root finder.
+    double rootFinderMaximumNumberOfIterations_;
+
     //! Initial epoch from which propagation of Kepler orbit is performed.
     double epochOfInitialState_;
 
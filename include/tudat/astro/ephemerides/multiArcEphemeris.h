@@ -63,6 +63,27 @@ public:
     //! Destructor
     ~MultiArcEphemeris( ){ }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original, in which each of the
+     *  constituent arc ephemerides is cloned, so that the arcs of the copy may be reset independently of the original.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< Ephemeris > clone( ) const
+    {
+        std::shared_ptr< MultiArcEphemeris > clonedEphemeris = std::make_shared< MultiArcEphemeris >( *this );
+        for( unsigned int i = 0; i < singleArcEphemerides_.size( ); i++ )
+        {
+            if( singleArcEphemerides_.at( i ) != nullptr )
+            {
+                clonedEphemeris->singleArcEphemerides_[ i ] = singleArcEphemerides_.at( i )->clone( );
+            }
+        }
+        clonedEphemeris->lookUpscheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+                    arcSplitTimes_ );
+        return clonedEphemeris;
+    }
+
     //! Get state from ephemeris.
     /*!
      * Returns state from ephemeris at given Julian date.
@@ -17,6 +17,7 @@
 #include <memory>
 
 #include <functional>
+#include <stdexcept>
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -200,6 +201,18 @@ public:
      */
     virtual ~RotationalEphemeris( ) { }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original (e.g. in a propagation
+     *  in a different thread), sharing only data that is not modified when evaluating the rotation. Must be implemented in
+     *  derived classes that support this.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< RotationalEphemeris > clone( ) const
+    {
+        throw std::runtime_error( "Error, cloning not supported for this type of rotation model" );
+    }
+
     //! Get rotation quaternion from target frame to base frame.
     /*!
      * Pure virtual function to calculate and return the rotation quaternion from target frame to
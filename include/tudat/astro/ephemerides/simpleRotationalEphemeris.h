@@ -91,6 +91,12 @@ public:
     //! Destructor
     ~SimpleRotationalEphemeris( ){ }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    std::shared_ptr< RotationalEphemeris > clone( ) const
+    {
+        return std::make_shared< SimpleRotationalEphemeris >( *this );
+    }
+
     //! Calculate rotation quaternion from target frame to base frame.
     /*!
      * Pure virtual function that calculates the rotation quaternion from target frame to base
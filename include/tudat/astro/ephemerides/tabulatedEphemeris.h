@@ -86,6 +86,18 @@ public:
      */
     ~TabulatedCartesianEphemeris( ){ }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original. The interpolator is
+     *  shared with the original (its lookup scheme keeps only an atomic index as evaluation state), but may be reset
+     *  independently of the original, for instance after a propagation using the copy.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< Ephemeris > clone( ) const
+    {
+        return std::make_shared< TabulatedCartesianEphemeris< StateScalarType, TimeType > >( *this );
+    }
+
     //! Function to reset the state interpolator.
     /*!
      *  Function to reset the state interpolator, for instance following an update of the states of
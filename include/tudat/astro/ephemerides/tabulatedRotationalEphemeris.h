@@ -68,6 +68,17 @@ public:
     //! Destructor
     ~TabulatedRotationalEphemeris( ){ }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original, with its own current
+     *  rotational state. The interpolator is shared with the original, but may be reset independently of the original.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< RotationalEphemeris > clone( ) const
+    {
+        return std::make_shared< TabulatedRotationalEphemeris< StateScalarType, TimeType > >( *this );
+    }
+
     //! Function to reset the rotational state interpolator.
     /*!
      *  Function to reset the rotational state interpolator, for instance following an update of the rotational state of the body
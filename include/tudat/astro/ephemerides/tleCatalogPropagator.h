@@ -0,0 +1,171 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hoots, F.R. and Roehrich, R.L., Spacetrack Report No. 3: Models for Propagation of NORAD Element Sets, 1980.
+ *      Vallado, D.A. et al., Revisiting Spacetrack Report #3, AIAA 2006-6753, 2006.
+ *
+ */
+
+#ifndef TUDAT_TLECATALOGPROPAGATOR_H
+#define TUDAT_TLECATALOGPROPAGATOR_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/ephemerides/tleEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Number of objects for which the SGP4 model is evaluated in a single pass by the TleCatalogPropagator.
+const int TLE_CATALOG_CHUNK_SIZE = 128;
+
+//! Class to propagate a catalog of two-line element sets with the SGP4 model, for many epochs at once.
+/*!
+ *  Class to propagate a catalog of two-line element sets with the SGP4 model, for many epochs at once. The elements,
+ *  and all epoch-independent SGP4 coefficients, are stored in structure-of-arrays form upon construction. The
+ *  model is then evaluated in branch-free passes over chunks of objects (allowing the compiler to vectorize the
+ *  evaluation), with the objects distributed over threads. The rotation from the TEME frame to the J2000 frame is
+ *  computed only once per epoch, for all objects.
+ *
+ *  The implementation follows the near-Earth SGP4 model of Spacetrack Report No. 3, with the same physical constants
+ *  as the Spice implementation used by the TleEphemeris class, so that the states of both are consistent. As for the
+ *  TleEphemeris, the deep-space (SDP4) model is not implemented. Objects that require it (orbital period of 225 minutes
+ *  or longer) are rejected upon construction, unless explicitly allowed, in which case their states are set to NaN (and
+ *  they are flagged by the isDeepSpaceObject function).
+ */
+class TleCatalogPropagator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, precomputes the epoch-independent SGP4 coefficients for all objects.
+     *  \param tles List of two-line element sets, one per object.
+     *  \param allowDeepSpaceObjects Boolean denoting whether deep-space objects, for which the (unimplemented) SDP4 model
+     *  is required, are allowed in the catalog. If false, an exception is thrown if the catalog contains such an object.
+     *  If true, the states of these objects are set to NaN.
+     */
+    TleCatalogPropagator( const std::vector< std::shared_ptr< Tle > >& tles,
+                          const bool allowDeepSpaceObjects = false );
+
+    //! Function to propagate all objects to a list of epochs.
+    /*!
+     *  Function to propagate all objects to a list of epochs, writing the Cartesian states (in m and m/s, w.r.t. the
+     *  center of the Earth) into a single contiguous matrix. The states of object i at epoch j are stored in column
+     *  i * epochs.size( ) + j, so that the state history of each object is stored in a contiguous block of columns.
+     *  The output matrix is resized if required, so that it may be reused for successive calls without reallocation.
+     *  The states of deep-space objects (see isDeepSpaceObject) are set to NaN.
+     *  \param epochs Epochs (in seconds since J2000) at which the states are to be computed.
+     *  \param states Cartesian states of all objects at all epochs (returned by reference).
+     *  \param frameOrientation Orientation of the output states, either "TEME" or "J2000".
+     *  \param numberOfThreads Number of threads over which the objects are distributed.
+     */
+    void propagateToEpochs( const std::vector< double >& epochs,
+                            Eigen::Matrix< double, 6, Eigen::Dynamic >& states,
+                            const std::string& frameOrientation = "J2000",
+                            const int numberOfThreads = 1 ) const;
+
+    //! Function to propagate all objects to a list of epochs.
+    /*!
+     *  Function to propagate all objects to a list of epochs, see overloaded function for details.
+     *  \param epochs Epochs (in seconds since J2000) at which the states are to be computed.
+     *  \param frameOrientation Orientation of the output states, either "TEME" or "J2000".
+     *  \param numberOfThreads Number of threads over which the objects are distributed.
+     *  \return Cartesian states of all objects at all epochs, with the state of object i at epoch j in column
+     *  i * epochs.size( ) + j.
+     */
+    Eigen::Matrix< double, 6, Eigen::Dynamic > propagateToEpochs( const std::vector< double >& epochs,
+                                                                  const std::string& frameOrientation = "J2000",
+                                                                  const int numberOfThreads = 1 ) const
+    {
+        Eigen::Matrix< double, 6, Eigen::Dynamic > states;
+        propagateToEpochs( epochs, states, frameOrientation, numberOfThreads );
+        return states;
+    }
+
+    //! Function to retrieve the state history of a single object from the output of propagateToEpochs.
+    /*!
+     *  Function to retrieve the state history of a single object from the output of propagateToEpochs.
+     *  \param epochs Epochs that were used as input to propagateToEpochs.
+     *  \param states States that were produced by propagateToEpochs.
+     *  \param objectIndex Index of object (in list of TLEs used for construction) for which history is to be retrieved.
+     *  \return State history of requested object.
+     */
+    std::map< double, Eigen::Vector6d > getObjectStateHistory( const std::vector< double >& epochs,
+                                                               const Eigen::Matrix< double, 6, Eigen::Dynamic >& states,
+                                                               const int objectIndex ) const;
+
+    //! Function to retrieve the number of objects in the catalog.
+    /*!
+     *  Function to retrieve the number of objects in the catalog.
+     *  \return Number of objects in the catalog.
+     */
+    int getNumberOfObjects( ) const
+    {
+        return numberOfObjects_;
+    }
+
+    //! Function to check whether an object requires the (unimplemented) deep-space SDP4 model.
+    /*!
+     *  Function to check whether an object requires the (unimplemented) deep-space SDP4 model, i.e. whether its orbital
+     *  period is at least 225 minutes. The states of such objects are not computed, but set to NaN.
+     *  \param objectIndex Index of object (in list of TLEs used for construction).
+     *  \return True if the object is a deep-space object.
+     */
+    bool isDeepSpaceObject( const int objectIndex ) const
+    {
+        return isDeepSpaceObject_.at( objectIndex );
+    }
+
+private:
+
+    //! Function to propagate a chunk of objects to a single epoch, in the TEME frame.
+    /*!
+     *  Function to propagate a chunk of objects to a single epoch, in the TEME frame (in km and km/s).
+     *  \param epoch Epoch (in seconds since J2000) at which the states are to be computed.
+     *  \param startIndex Index of first object in chunk.
+     *  \param chunkSize Number of objects in chunk (at most TLE_CATALOG_CHUNK_SIZE).
+     *  \param chunkStates Cartesian state components of all objects in chunk (returned by reference), with component
+     *  k of object j at index k * TLE_CATALOG_CHUNK_SIZE + j.
+     */
+    void propagateChunkInTemeFrame( const double epoch, const int startIndex, const int chunkSize,
+                                    double* chunkStates ) const;
+
+    //! Function to retrieve a pointer to the values of a single SGP4 coefficient for all objects.
+    const double* getCoefficients( const int coefficientIndex ) const
+    {
+        return coefficients_.data( ) + static_cast< long long >( coefficientIndex ) * numberOfObjects_;
+    }
+
+    //! Number of objects in the catalog.
+    int numberOfObjects_;
+
+    //! Epoch-independent SGP4 elements and coefficients of all objects, with coefficient k of object i at index
+    //! k * numberOfObjects_ + i.
+    std::vector< double > coefficients_;
+
+    //! List of booleans denoting whether each object requires the (unimplemented) deep-space SDP4 model.
+    std::vector< bool > isDeepSpaceObject_;
+
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_TLECATALOGPROPAGATOR_H
@@ -134,6 +134,17 @@ private:
 
 };
 
+//! Function to compute the rotation matrix from the True Equator, Mean Equinox (TEME) frame to the J2000 frame.
+/*!
+ * Function to compute the rotation matrix from the True Equator, Mean Equinox (TEME) frame, in which states obtained from
+ * SGP4/SDP4 propagation of two-line elements are expressed, to the J2000 frame. The rotation consists of a rotation about the
+ * pole by the equation of the equinoxes (to the True Of Date frame), followed by the inverse IAU 1976/1980 precession-nutation
+ * (see Vallado: Fundamentals of Astrodynamics and Applications 4th ed. (2013)).
+ * @param secondsSinceEpoch Seconds since J2000 epoch at which the rotation is to be computed.
+ * @return Rotation matrix from TEME to J2000 frame.
+ */
+Eigen::Matrix3d getTemeToJ2000RotationMatrix( const double secondsSinceEpoch );
+
 //! Ephemeris derived class that calculates the Cartesian position as a function of time assuming
 //! a two-line elements based orbit.
 /*!
@@ -168,6 +179,13 @@ public:
 	 */
 	Eigen::Vector6d getCartesianState(const double secondsSinceEpoch) override;
 
+	//! Function to create a copy of this object that can be evaluated concurrently with the original (calls into spice are
+	//! serialized, and the two-line elements are shared).
+	std::shared_ptr< Ephemeris > clone( ) const override
+	{
+		return std::make_shared< TleEphemeris >( *this );
+	}
+
 private:
 
 	std::shared_ptr< Tle > tle_;
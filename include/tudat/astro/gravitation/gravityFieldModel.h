@@ -12,7 +12,10 @@
 #ifndef TUDAT_GRAVITY_FIELD_MODEL_H
 #define TUDAT_GRAVITY_FIELD_MODEL_H
 
+#include <functional>
 #include <memory>
+#include <stdexcept>
+#include <typeinfo>
 #include <Eigen/Core>
 #include "tudat/math/basic/mathematicalConstants.h"
 
@@ -48,6 +51,23 @@ public:
      */
     virtual ~GravityFieldModel( ) { }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original (e.g. in a propagation
+     *  in a different thread), with its own evaluation cache. The copy calls the same inertia tensor update function as the
+     *  original; it may be redefined using resetUpdateInertiaTensorFunction. Must be implemented in derived classes that
+     *  support this.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< GravityFieldModel > clone( ) const
+    {
+        if( typeid( *this ) != typeid( GravityFieldModel ) )
+        {
+            throw std::runtime_error( "Error, cloning not supported for this type of gravity field model" );
+        }
+        return std::make_shared< GravityFieldModel >( *this );
+    }
+
     //! Set the gravitational parameter.
     /*!
      * Define the gravitational parameter in meter^3 per second^2.
@@ -73,6 +93,26 @@ public:
     }
 
 
+    //! Function to retrieve the function that is called to update the inertia tensor when the field is modified
+    /*!
+     * Function to retrieve the function that is called to update the inertia tensor when the field is modified
+     * \return Function that is called to update the inertia tensor (empty if none)
+     */
+    std::function< void( ) > getUpdateInertiaTensorFunction( ) const
+    {
+        return updateInertiaTensor_;
+    }
+
+    //! Function to reset the function that is called to update the inertia tensor when the field is modified
+    /*!
+     * Function to reset the function that is called to update the inertia tensor when the field is modified
+     * \param updateInertiaTensor Function that is to be called to update the inertia tensor
+     */
+    void resetUpdateInertiaTensorFunction( const std::function< void( ) > updateInertiaTensor )
+    {
+        updateInertiaTensor_ = updateInertiaTensor;
+    }
+
     //! Get the gravitational potential at given body-fixed position.
     /*!
      * Return the gravitational potential at given body-fixed position.
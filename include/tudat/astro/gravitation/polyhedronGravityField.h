@@ -54,7 +54,8 @@ public:
             const Eigen::MatrixXi& verticesDefiningEachEdge)
             : verticesCoordinates_( verticesCoordinates ),
               verticesDefiningEachFacet_( verticesDefiningEachFacet ),
-              verticesDefiningEachEdge_( verticesDefiningEachEdge )
+              verticesDefiningEachEdge_( verticesDefiningEachEdge ),
+              numberOfThreads_( 1 )
     {
         currentBodyFixedPosition_ = (Eigen::Vector3d() << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN).finished();
     }
@@ -90,6 +91,21 @@ public:
     Eigen::VectorXd& getPerEdgeFactor ( )
     { return currentPerEdgeFactor_; }
 
+    /*! Function to set the number of threads used to compute the per-facet and per-edge factors.
+     *
+     * Function to set the number of threads used to compute the per-facet and per-edge factors. The computed factors
+     * do not depend on the number of threads.
+     * @param numberOfThreads Number of threads (values smaller than 2 denote serial computation).
+     * @param threadPool Persistent pool of threads on which the factors are computed (typically shared with the
+     * object using this cache; nullptr if threads are to be started for each update).
+     */
+    void setNumberOfThreads( const int numberOfThreads,
+                             const std::shared_ptr< utilities::ThreadPool > threadPool = nullptr )
+    {
+        numberOfThreads_ = numberOfThreads;
+        threadPool_ = threadPool;
+    }
+
 
 protected:
 
@@ -115,6 +131,12 @@ private:
 
     // Current value of the per-edge factors.
     Eigen::VectorXd currentPerEdgeFactor_;
+
+    // Number of threads used to compute the per-facet and per-edge factors.
+    int numberOfThreads_;
+
+    // Persistent pool of threads used to compute the per-facet and per-edge factors (nullptr if none).
+    std::shared_ptr< utilities::ThreadPool > threadPool_;
 };
 
 
@@ -144,7 +166,11 @@ public:
         gravitationalParameter_( gravitationalParameter ),
         verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
-        fixedReferenceFrame_( fixedReferenceFrame )
+        fixedReferenceFrame_( fixedReferenceFrame ),
+        numberOfThreads_( 1 ),
+        farFieldReferenceRadius_( TUDAT_NAN ),
+        farFieldSwitchRadius_( TUDAT_NAN ),
+        farFieldTransitionWidth_( TUDAT_NAN )
     {
         // Check if provided arguments are valid
         basic_mathematics::checkValidityOfPolyhedronSettings(verticesCoordinates, verticesDefiningEachFacet);
@@ -181,10 +207,12 @@ public:
                 polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint(),
                 verticesDefiningEachFacet_,
                 verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
+                *packedFacetDyads_,
+                *packedEdgeDyads_,
                 polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+                polyhedronGravityCache_->getPerEdgeFactor(),
+                numberOfThreads_,
+                threadPool_.get( ) );
     }
 
     /*! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
@@ -202,10 +230,12 @@ public:
                 polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint(),
                 verticesDefiningEachFacet_,
                 verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
+                *packedFacetDyads_,
+                *packedEdgeDyads_,
                 polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+                polyhedronGravityCache_->getPerEdgeFactor(),
+                numberOfThreads_,
+                threadPool_.get( ) );
     }
 
     /*! Function to calculate the hessian matrix of the gravitational potential.
@@ -220,8 +250,8 @@ public:
 
         return basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
                 gravitationalParameter_ / volume_,
-                facetDyads_,
-                edgeDyads_,
+                *packedFacetDyads_,
+                *packedEdgeDyads_,
                 polyhedronGravityCache_->getPerFacetFactor(),
                 polyhedronGravityCache_->getPerEdgeFactor() );
     }
@@ -261,13 +291,94 @@ public:
     const Eigen::MatrixXi& getVerticesDefiningEachEdge( )
     { return verticesDefiningEachEdge_; }
 
-    //! Function to return the facet dyads.
-    const std::vector< Eigen::MatrixXd >& getFacetDyads( )
-    { return facetDyads_; }
+    //! Function to return the facet dyads (unpacked from the packed representation used by the field).
+    std::vector< Eigen::MatrixXd > getFacetDyads( )
+    { return basic_mathematics::unpackPolyhedronDyads( *packedFacetDyads_ ); }
+
+    //! Function to return the edge dyads (unpacked from the packed representation used by the field).
+    std::vector< Eigen::MatrixXd > getEdgeDyads( )
+    { return basic_mathematics::unpackPolyhedronDyads( *packedEdgeDyads_ ); }
+
+    //! Function to return the facet dyads, packed as structure-of-arrays (shared with copies of this field and
+    //! acceleration models created from it).
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > getPackedFacetDyads( )
+    { return packedFacetDyads_; }
+
+    //! Function to return the edge dyads, packed as structure-of-arrays (shared with copies of this field and
+    //! acceleration models created from it).
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > getPackedEdgeDyads( )
+    { return packedEdgeDyads_; }
+
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original, with its own
+     *  polyhedron gravity cache and thread pool. The (constant) packed dyads are shared with the original.
+     *  \return Copy of this object
+     */
+    std::shared_ptr< GravityFieldModel > clone( ) const
+    {
+        std::shared_ptr< PolyhedronGravityField > clonedField = std::make_shared< PolyhedronGravityField >( *this );
+        clonedField->polyhedronGravityCache_ = std::make_shared< PolyhedronGravityCache >(
+                    verticesCoordinates_, verticesDefiningEachFacet_, verticesDefiningEachEdge_ );
+        clonedField->setNumberOfThreads( numberOfThreads_ );
+        return clonedField;
+    }
+
+    //! Function to set the maximum number of threads used to evaluate the gravity field (values smaller than 2 denote serial
+    //! evaluation); the results do not depend on the number of threads. For more than one thread, a persistent thread
+    //! pool is created, which is reused for each evaluation of the field.
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        numberOfThreads_ = numberOfThreads;
+        threadPool_ = ( numberOfThreads > 1 ) ? std::make_shared< utilities::ThreadPool >( numberOfThreads ) : nullptr;
+        polyhedronGravityCache_->setNumberOfThreads( numberOfThreads_, threadPool_ );
+    }
 
-    //! Function to return the edge dyads.
-    const std::vector< Eigen::MatrixXd >& getEdgeDyads( )
-    { return edgeDyads_; }
+    //! Function to return the number of threads used to evaluate the gravity field.
+    int getNumberOfThreads( )
+    { return numberOfThreads_; }
+
+    /*! Function to compute the far-field spherical harmonic expansion of the polyhedron.
+     *
+     * Function to compute the spherical harmonic expansion of the polyhedron, which acceleration models created from
+     * this field use instead of the polyhedron outside the switch radius. The reference radius of the expansion is the
+     * radius of the Brillouin sphere (maximum distance of a vertex to the origin), outside of which the expansion
+     * converges. Between the switch radius and the switch radius plus the transition width, the polyhedron and
+     * spherical harmonic accelerations are smoothly blended. Note that the field itself (e.g. getGradientOfPotential)
+     * always evaluates the polyhedron.
+     * @param maximumDegree Maximum degree (and order) of the expansion.
+     * @param switchRadius Radius beyond which the spherical harmonic expansion is (partially) used; may not be smaller
+     * than the Brillouin sphere radius.
+     * @param transitionWidth Width of the radial interval over which the polyhedron and spherical harmonic
+     * accelerations are blended (0 denotes a discontinuous switch).
+     */
+    void setFarFieldSphericalHarmonicExpansion( const int maximumDegree,
+                                                const double switchRadius,
+                                                const double transitionWidth = 0.0 );
+
+    //! Function to return whether a far-field spherical harmonic expansion has been set.
+    bool hasFarFieldSphericalHarmonicExpansion( )
+    { return farFieldCosineCoefficients_.rows( ) > 0; }
+
+    //! Function to return the cosine coefficients of the far-field spherical harmonic expansion.
+    const Eigen::MatrixXd& getFarFieldCosineCoefficients( )
+    { return farFieldCosineCoefficients_; }
+
+    //! Function to return the sine coefficients of the far-field spherical harmonic expansion.
+    const Eigen::MatrixXd& getFarFieldSineCoefficients( )
+    { return farFieldSineCoefficients_; }
+
+    //! Function to return the reference radius of the far-field spherical harmonic expansion.
+    double getFarFieldReferenceRadius( )
+    { return farFieldReferenceRadius_; }
+
+    //! Function to return the radius beyond which the far-field spherical harmonic expansion is used.
+    double getFarFieldSwitchRadius( )
+    { return farFieldSwitchRadius_; }
+
+    //! Function to return the width of the transition between the polyhedron and far-field expansion.
+    double getFarFieldTransitionWidth( )
+    { return farFieldTransitionWidth_; }
 
 protected:
 
@@ -287,16 +398,16 @@ private:
      *
      * Function to compute the facet normals and facet dyads, according to Werner and Scheeres (1997).
      * Computes a vector of facet normals, each member of the
-     * vector being the normal to one facet. Computes a vector of facet dyads, each member of the vector being the ´
-     * dyad associated with one facet. The function saves the two computed vectors into member variables of the class.
+     * vector being the normal to one facet. Computes the facet dyads, each being the dyad associated with one facet.
+     * The function saves the facet normals and the packed facet dyads into member variables of the class.
      */
     void computeFacetNormalsAndDyads ( );
 
     /*! Function to compute the edge dyads.
      *
-     * Function to compute the edge dyads, according to Werner and Scheeres (1997). Computes a vector of edge dyads,
-     * each member of the vector being the dyad associated with one edge. The function saves the computed vector
-     * into a member variable of the class.
+     * Function to compute the edge dyads, according to Werner and Scheeres (1997). Computes the edge dyads, each
+     * being the dyad associated with one edge. The function saves the packed edge dyads into a member variable of the
+     * class.
      */
     void computeEdgeDyads ( );
 
@@ -321,11 +432,11 @@ private:
     //! Vector with the outward-pointing normal vector of each facet.
     std::vector< Eigen::Vector3d > facetNormalVectors_;
 
-    //! Vector with the facet dyad of each facet.
-    std::vector< Eigen::MatrixXd > facetDyads_;
+    //! Facet dyad of each facet, packed as structure-of-arrays.
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > packedFacetDyads_;
 
-    //! Vector with the edge dyad of each edge.
-    std::vector< Eigen::MatrixXd > edgeDyads_;
+    //! Edge dyad of each edge, packed as structure-of-arrays.
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > packedEdgeDyads_;
 
     //! Polyhedron cache.
     std::shared_ptr< PolyhedronGravityCache > polyhedronGravityCache_;
@@ -333,6 +444,27 @@ private:
     //! Identifier for body-fixed reference frame
     std::string fixedReferenceFrame_;
 
+    //! Number of threads used to evaluate the gravity field.
+    int numberOfThreads_;
+
+    //! Persistent pool of threads used to evaluate the gravity field (nullptr for serial evaluation).
+    std::shared_ptr< utilities::ThreadPool > threadPool_;
+
+    //! Cosine coefficients of the far-field spherical harmonic expansion (empty if none).
+    Eigen::MatrixXd farFieldCosineCoefficients_;
+
+    //! Sine coefficients of the far-field spherical harmonic expansion (empty if none).
+    Eigen::MatrixXd farFieldSineCoefficients_;
+
+    //! Reference radius of the far-field spherical harmonic expansion.
+    double farFieldReferenceRadius_;
+
+    //! Radius beyond which the far-field spherical harmonic expansion is used.
+    double farFieldSwitchRadius_;
+
+    //! Width of the transition between the polyhedron and far-field expansion.
+    double farFieldTransitionWidth_;
+
 };
 
 } // namespace gravitation
@@ -22,6 +22,7 @@
 #include "tudat/astro/basic_astro/accelerationModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 #include "tudat/math/basic/polyhedron.h"
+#include "tudat/math/basic/sphericalHarmonics.h"
 
 namespace tudat
 {
@@ -92,8 +93,6 @@ public:
           getVerticesCoordinates_( [ = ]( ){ return aVerticesCoordinatesMatrix; } ),
           getVerticesDefiningEachFacet_( [ = ]( ){ return aVerticesDefiningEachFacetMatrix; } ),
           getVerticesDefiningEachEdge_( [ = ]( ){ return aVerticesDefiningEachEdgeMatrix; } ),
-          getFacetDyads_( [ = ]( ){ return aFacetDyadsVector; } ),
-          getEdgeDyads_( [ = ]( ){ return aEdgeDyadsVector; } ),
           sourcePositionFunction_( positionOfBodyExertingAccelerationFunction ),
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           isMutualAttractionUsed_( isMutualAttractionUsed ),
@@ -102,8 +101,27 @@ public:
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
-          updateLaplacianOfPotential_( updateLaplacianOfGravitationalPotential )
-    { }
+          updateLaplacianOfPotential_( updateLaplacianOfGravitationalPotential ),
+          numberOfThreads_( 1 ),
+          farFieldReferenceRadius_( TUDAT_NAN ),
+          farFieldSwitchRadius_( TUDAT_NAN ),
+          farFieldTransitionWidth_( TUDAT_NAN ),
+          currentFarFieldWeight_( 0.0 ),
+          currentFarFieldWeightGradient_( Eigen::Vector3d::Zero( ) )
+    {
+        // Pack dyads once, for use by this model and its partials
+        std::shared_ptr< basic_mathematics::PackedPolyhedronDyads > packedFacetDyads =
+                std::make_shared< basic_mathematics::PackedPolyhedronDyads >( );
+        basic_mathematics::packPolyhedronDyads( *packedFacetDyads, aFacetDyadsVector );
+        packedFacetDyads_ = packedFacetDyads;
+
+        std::shared_ptr< basic_mathematics::PackedPolyhedronDyads > packedEdgeDyads =
+                std::make_shared< basic_mathematics::PackedPolyhedronDyads >( );
+        basic_mathematics::packPolyhedronDyads( *packedEdgeDyads, aEdgeDyadsVector );
+        packedEdgeDyads_ = packedEdgeDyads;
+
+        initializePolyhedronData( );
+    }
 
     //! Constructor taking functions for position of bodies, and parameters of polyhedron.
     /*!
@@ -115,6 +133,10 @@ public:
      * \param positionOfBodySubjectToAccelerationFunction Pointer to function returning position of
      *          body subject to gravitational acceleration.
      *
+     * \param packedFacetDyads Facet dyads, packed as structure-of-arrays (shared with, and not copied from, the
+     *          gravity field).
+     * \param packedEdgeDyads Edge dyads, packed as structure-of-arrays (shared with, and not copied from, the
+     *          gravity field).
      * \param positionOfBodyExertingAccelerationFunction Pointer to function returning position of
      *          body exerting gravitational acceleration (default = (0,0,0)).
      * \param rotationFromBodyFixedToIntegrationFrameFunction Function providing the rotation from
@@ -137,8 +159,8 @@ public:
             const std::function< Eigen::MatrixXd() > verticesCoordinatesFunction,
             const std::function< Eigen::MatrixXi() > verticesDefiningEachFacetFunction,
             const std::function< Eigen::MatrixXi() > verticesDefiningEachEdgeFunction,
-            const std::function< std::vector< Eigen::MatrixXd >() > facetDyadsFunction,
-            const std::function< std::vector< Eigen::MatrixXd >() > edgeDyadsFunction,
+            const std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > packedFacetDyads,
+            const std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > packedEdgeDyads,
             const StateFunction positionOfBodyExertingAccelerationFunction =
                 [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
             const std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToIntegrationFrameFunction =
@@ -152,8 +174,6 @@ public:
           getVerticesCoordinates_( verticesCoordinatesFunction ),
           getVerticesDefiningEachFacet_( verticesDefiningEachFacetFunction ),
           getVerticesDefiningEachEdge_( verticesDefiningEachEdgeFunction ),
-          getFacetDyads_( facetDyadsFunction ),
-          getEdgeDyads_( edgeDyadsFunction ),
           sourcePositionFunction_( positionOfBodyExertingAccelerationFunction ),
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           isMutualAttractionUsed_( isMutualAttractionUsed ),
@@ -163,8 +183,18 @@ public:
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
-          updateLaplacianOfPotential_( updateLaplacianOfGravitationalPotential )
-    { }
+          updateLaplacianOfPotential_( updateLaplacianOfGravitationalPotential ),
+          numberOfThreads_( 1 ),
+          packedFacetDyads_( packedFacetDyads ),
+          packedEdgeDyads_( packedEdgeDyads ),
+          farFieldReferenceRadius_( TUDAT_NAN ),
+          farFieldSwitchRadius_( TUDAT_NAN ),
+          farFieldTransitionWidth_( TUDAT_NAN ),
+          currentFarFieldWeight_( 0.0 ),
+          currentFarFieldWeightGradient_( Eigen::Vector3d::Zero( ) )
+    {
+        initializePolyhedronData( );
+    }
 
     //! Update class members.
     /*!
@@ -212,16 +242,116 @@ public:
         return volumeFunction_;
     }
 
-    //! Function to return the function returning the facet dyads.
-    std::function< std::vector< Eigen::MatrixXd >( ) > getFacetDyadsFunction( )
+    //! Function to return the facet dyads, packed as structure-of-arrays.
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > getPackedFacetDyads( )
+    {
+        return packedFacetDyads_;
+    }
+
+    //! Function to return the edge dyads, packed as structure-of-arrays.
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > getPackedEdgeDyads( )
+    {
+        return packedEdgeDyads_;
+    }
+
+    //! Function to set the number of threads used to evaluate the acceleration.
+    /*!
+     * Function to set the number of threads over which the facets and edges are distributed when evaluating the
+     * acceleration (values smaller than 2 denote serial evaluation). Threads are only used for polyhedra with at least
+     * basic_mathematics::minimumPolyhedronIterationsPerThread facets (or edges) per thread, and the acceleration does not
+     * depend on the number of threads. For more than one thread, a persistent thread pool is created (and shared with
+     * the polyhedron cache), which is reused for each evaluation of the acceleration.
+     * \param numberOfThreads Maximum number of threads used to evaluate the acceleration.
+     */
+    void setNumberOfThreads( const int numberOfThreads )
     {
-        return getFacetDyads_;
+        numberOfThreads_ = numberOfThreads;
+        threadPool_ = ( numberOfThreads > 1 ) ? std::make_shared< utilities::ThreadPool >( numberOfThreads ) : nullptr;
+        polyhedronCache_->setNumberOfThreads( numberOfThreads_, threadPool_ );
     }
 
-    //! Function to return the function returning the facet dyads.
-    std::function< std::vector< Eigen::MatrixXd >( ) > getEdgeDyadsFunction( )
+    //! Function to return the number of threads used to evaluate the acceleration.
+    int getNumberOfThreads( )
     {
-        return getEdgeDyads_;
+        return numberOfThreads_;
+    }
+
+    //! Function to set the far-field spherical harmonic expansion of the polyhedron.
+    /*!
+     * Function to set a spherical harmonic expansion of the polyhedron (typically computed by
+     * PolyhedronGravityField::setFarFieldSphericalHarmonicExpansion), which is used instead of the polyhedron far from
+     * the body. The polyhedron and expansion accelerations are blended with a weight w that increases smoothly
+     * (cubic smoothstep in the distance r) from 0 at the switch radius to 1 at the switch radius plus the transition
+     * width. The polyhedron is only evaluated for w < 1, and the expansion only for w > 0.
+     * \param cosineCoefficients Geodesy-normalized cosine coefficients of the expansion.
+     * \param sineCoefficients Geodesy-normalized sine coefficients of the expansion.
+     * \param referenceRadius Reference radius of the expansion.
+     * \param switchRadius Radius beyond which the expansion is (partially) used.
+     * \param transitionWidth Width of the radial interval over which the accelerations are blended (0 denotes a
+     * discontinuous switch).
+     */
+    void setFarFieldSphericalHarmonicExpansion( const Eigen::MatrixXd& cosineCoefficients,
+                                                const Eigen::MatrixXd& sineCoefficients,
+                                                const double referenceRadius,
+                                                const double switchRadius,
+                                                const double transitionWidth );
+
+    //! Function to return whether a far-field spherical harmonic expansion is used.
+    bool hasFarFieldSphericalHarmonicExpansion( )
+    {
+        return farFieldSphericalHarmonicsCache_ != nullptr;
+    }
+
+    //! Function to return the cosine coefficients of the far-field spherical harmonic expansion.
+    const Eigen::MatrixXd& getFarFieldCosineCoefficients( )
+    {
+        return farFieldCosineCoefficients_;
+    }
+
+    //! Function to return the sine coefficients of the far-field spherical harmonic expansion.
+    const Eigen::MatrixXd& getFarFieldSineCoefficients( )
+    {
+        return farFieldSineCoefficients_;
+    }
+
+    //! Function to return the reference radius of the far-field spherical harmonic expansion.
+    double getFarFieldReferenceRadius( )
+    {
+        return farFieldReferenceRadius_;
+    }
+
+    //! Function to return the current weight of the far-field expansion (0: polyhedron only; 1: expansion only).
+    double getCurrentFarFieldWeight( )
+    {
+        return currentFarFieldWeight_;
+    }
+
+    //! Function to return the current gradient (w.r.t. body-fixed position) of the weight of the far-field expansion.
+    Eigen::Vector3d getCurrentFarFieldWeightGradient( )
+    {
+        return currentFarFieldWeightGradient_;
+    }
+
+    //! Function to return the current (unweighted) polyhedron acceleration in body-fixed frame.
+    /*!
+     * Function to return the current (unweighted) polyhedron acceleration in body-fixed frame, as computed by last call
+     * to updateMembers function (only updated if the weight of the far-field expansion is smaller than 1).
+     * \return Current polyhedron acceleration in body-fixed frame.
+     */
+    Eigen::Vector3d getCurrentPolyhedronAccelerationInBodyFixedFrame( )
+    {
+        return currentPolyhedronAccelerationInBodyFixedFrame_;
+    }
+
+    //! Function to return the current (unweighted) far-field expansion acceleration in body-fixed frame.
+    /*!
+     * Function to return the current (unweighted) far-field expansion acceleration in body-fixed frame, as computed by
+     * last call to updateMembers function (only updated if the weight of the far-field expansion is larger than 0).
+     * \return Current far-field expansion acceleration in body-fixed frame.
+     */
+    Eigen::Vector3d getCurrentFarFieldAccelerationInBodyFixedFrame( )
+    {
+        return currentFarFieldAccelerationInBodyFixedFrame_;
     }
 
     //! Function to return current position vector of body exerting gravitational acceleration in inertial frame.
@@ -284,6 +414,9 @@ public:
 
 private:
 
+    //! Function to retrieve the (constant) facet and edge definitions, and pack the facet and edge dyads
+    void initializePolyhedronData( );
+
     //! Pointer to function returning position of body subject to acceleration.
     const StateFunction subjectPositionFunction_;
 
@@ -302,12 +435,6 @@ private:
     //! Pointer to function returning the vertices defining each edge
     const std::function< Eigen::MatrixXi( ) > getVerticesDefiningEachEdge_;
 
-    //! Pointer to function returning the facet dyads
-    const std::function< std::vector< Eigen::MatrixXd >( ) > getFacetDyads_;
-
-    //! Pointer to function returning the edge dyads
-    const std::function< std::vector< Eigen::MatrixXd >( ) > getEdgeDyads_;
-
     //! Pointer to function returning position of body exerting acceleration.
     const StateFunction sourcePositionFunction_;
 
@@ -352,6 +479,54 @@ private:
 
     //! Flag indicating whether to update the laplacian of the gravitational potential when calling the updateMembers function.
     bool updateLaplacianOfPotential_;
+
+    //! Number of threads used to evaluate the acceleration.
+    int numberOfThreads_;
+
+    //! Persistent pool of threads used to evaluate the acceleration (nullptr for serial evaluation).
+    std::shared_ptr< utilities::ThreadPool > threadPool_;
+
+    //! Vertices defining each facet, as retrieved at construction.
+    Eigen::MatrixXi verticesDefiningEachFacet_;
+
+    //! Vertices defining each edge, as retrieved at construction.
+    Eigen::MatrixXi verticesDefiningEachEdge_;
+
+    //! Facet dyads, packed as structure-of-arrays (typically shared with the gravity field).
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > packedFacetDyads_;
+
+    //! Edge dyads, packed as structure-of-arrays (typically shared with the gravity field).
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > packedEdgeDyads_;
+
+    //! Cosine coefficients of the far-field spherical harmonic expansion.
+    Eigen::MatrixXd farFieldCosineCoefficients_;
+
+    //! Sine coefficients of the far-field spherical harmonic expansion.
+    Eigen::MatrixXd farFieldSineCoefficients_;
+
+    //! Reference radius of the far-field spherical harmonic expansion.
+    double farFieldReferenceRadius_;
+
+    //! Radius beyond which the far-field spherical harmonic expansion is used.
+    double farFieldSwitchRadius_;
+
+    //! Width of the transition between the polyhedron and far-field expansion.
+    double farFieldTransitionWidth_;
+
+    //! Spherical harmonics cache for the far-field expansion (nullptr if no expansion is used).
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > farFieldSphericalHarmonicsCache_;
+
+    //! Current weight of the far-field expansion.
+    double currentFarFieldWeight_;
+
+    //! Current gradient (w.r.t. body-fixed position) of the weight of the far-field expansion.
+    Eigen::Vector3d currentFarFieldWeightGradient_;
+
+    //! Current (unweighted) polyhedron acceleration in body-fixed frame.
+    Eigen::Vector3d currentPolyhedronAccelerationInBodyFixedFrame_;
+
+    //! Current (unweighted) far-field expansion acceleration in body-fixed frame.
+    Eigen::Vector3d currentFarFieldAccelerationInBodyFixedFrame_;
 };
 
 
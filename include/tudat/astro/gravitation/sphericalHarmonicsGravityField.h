@@ -25,6 +25,7 @@
 #include <Eigen/Geometry>
 
 #include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/coordinateConversions.h"
 #include "tudat/math/basic/legendrePolynomials.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/gravitation/gravityFieldModel.h"
@@ -96,6 +97,148 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const bool saveSeparateTerms = 0,
         const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
 
+//! Compute gradient of a spherical harmonic potential, defined using geodesy-normalization, in spherical coordinates.
+/*!
+ * Compute gradient of a spherical harmonic potential, defined using geodesy-normalization, in spherical coordinates,
+ * by summation over all degrees and orders of the coefficient matrices. The Legendre polynomials and their derivatives
+ * are read directly from the packed triangular layout of the Legendre cache (see getPackedLegendreDegreeOffset), one
+ * contiguous row per degree, which must have been updated to the current latitude. The Legendre cache type may be
+ * either a LegendreCache or a FixedDegreeLegendreCache, the results are identical for both.
+ * \param sphericalPosition Spherical position (radius, latitude, longitude) at which the gradient is to be computed
+ * \param preMultiplier Gravitational parameter divided by reference radius
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ * \param legendreCache Cache of Legendre polynomials and derivatives, updated to the current latitude. As for the
+ * derivatives, its maximum order should exceed the maximum order of the coefficients, unless it is equal to the
+ * maximum degree.
+ * \param sphericalHarmonicsCache Cache of sines/cosines of longitude and radius ratio powers, updated to the current
+ * longitude and radius.
+ * \return Gradient of the potential in spherical coordinates.
+ */
+template< typename LegendreCacheType >
+Eigen::Vector3d computeGeodesyNormalizedPotentialGradientSum(
+        const Eigen::Vector3d& sphericalPosition,
+        const double preMultiplier,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        LegendreCacheType& legendreCache,
+        basic_mathematics::SphericalHarmonicsCache& sphericalHarmonicsCache )
+{
+    const int highestDegree = cosineHarmonicCoefficients.rows( );
+    const int highestOrder = cosineHarmonicCoefficients.cols( );
+
+    if( highestDegree - 1 > legendreCache.getMaximumDegree( ) || highestOrder - 1 > legendreCache.getMaximumOrder( ) )
+    {
+        throw std::runtime_error( "Error when computing spherical harmonic potential gradient, Legendre cache is of "
+                                  "insufficient degree or order" );
+    }
+
+    const double* legendreValues = legendreCache.getLegendreValues( ).data( );
+    const double* legendreDerivatives = legendreCache.getLegendreDerivatives( ).data( );
+    const double cosineOfLatitude = legendreCache.getCurrentPolynomialParameterComplement( );
+
+    Eigen::Vector3d sphericalGradient = Eigen::Vector3d::Zero( );
+    for ( int degree = 0; degree < highestDegree; degree++ )
+    {
+        const int degreeOffset = legendreCache.getDegreeOffset( degree );
+        const double radiusPowerTerm = sphericalHarmonicsCache.getReferenceRadiusRatioPowers( degree + 1 );
+        for ( int order = 0; ( order <= degree ) && ( order < highestOrder ); order++ )
+        {
+            sphericalGradient += basic_mathematics::computePotentialGradient(
+                        sphericalPosition( 0 ),
+                        radiusPowerTerm,
+                        sphericalHarmonicsCache.getCosineOfMultipleLongitude( order ),
+                        sphericalHarmonicsCache.getSineOfMultipleLongitude( order ),
+                        cosineOfLatitude,
+                        preMultiplier,
+                        degree,
+                        order,
+                        cosineHarmonicCoefficients( degree, order ),
+                        sineHarmonicCoefficients( degree, order ),
+                        legendreValues[ degreeOffset + order ],
+                        legendreDerivatives[ degreeOffset + order ] );
+        }
+    }
+    return sphericalGradient;
+}
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using geodesy-normalization,
+//! using a fixed-degree Legendre cache.
+/*!
+ * Compute gravitational acceleration due to multiple spherical harmonics terms, defined using geodesy-normalization,
+ * identical to computeGeodesyNormalizedGravitationalAccelerationSum, but with the Legendre polynomials computed by a
+ * FixedDegreeLegendreCache (with compile-time loop bounds and storage) instead of the run-time sized LegendreCache of
+ * the spherical harmonics cache. The spherical harmonics cache is only used for the sines and cosines of longitude
+ * and the radius ratio powers; its own Legendre cache is not updated.
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the reference frame that is
+ *          associated with the harmonic coefficients [m].
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ * \param legendreCache Fixed-degree cache from which the Legendre polynomials are computed.
+ * \param sphericalHarmonicsCache Cache object for the sines and cosines of longitude and the radius ratio powers.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+template< int MaximumDegree, int MaximumOrder >
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        basic_mathematics::FixedDegreeLegendreCache< MaximumDegree, MaximumOrder >& legendreCache,
+        basic_mathematics::SphericalHarmonicsCache& sphericalHarmonicsCache,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) )
+{
+    Eigen::Vector3d sphericalPosition = coordinate_conversions::convertCartesianToSpherical(
+                positionOfBodySubjectToAcceleration );
+    sphericalPosition( 1 ) = mathematical_constants::PI / 2.0 - sphericalPosition( 1 );
+
+    legendreCache.update( std::sin( sphericalPosition( 1 ) ) );
+    sphericalHarmonicsCache.updateLongitudeAndRadiusTerms(
+                sphericalPosition( 0 ), sphericalPosition( 2 ), equatorialRadius );
+
+    return accelerationRotation * (
+                coordinate_conversions::getSphericalToCartesianGradientMatrix( positionOfBodySubjectToAcceleration ) *
+                computeGeodesyNormalizedPotentialGradientSum(
+                    sphericalPosition, gravitationalParameter / equatorialRadius,
+                    cosineHarmonicCoefficients, sineHarmonicCoefficients, legendreCache, sphericalHarmonicsCache ) );
+}
+
+//! Compute gravitational accelerations due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, for a batch of positions.
+/*!
+ * This function computes the acceleration caused by gravitational spherical harmonics (with the coefficients
+ * expressed using a geodesy-normalization) at a list of positions, yielding results identical (to within numerical
+ * round-off) to repeated calls of computeGeodesyNormalizedGravitationalAccelerationSum. The positions are processed in
+ * blocks of SphericalHarmonicsBatchCache::numberOfLanes, for which the Legendre recurrences, the trigonometric
+ * recurrences for the longitude and the summation over degree and order are performed simultaneously, and vectorized
+ * across positions. The Legendre polynomials and their derivatives are computed on the fly (one degree at a time), so
+ * that the memory footprint is independent of the number of positions.
+ * \param positionsOfBodiesSubjectToAcceleration Cartesian position vectors (one per column) with respect to the
+ *          reference frame that is associated with the harmonic coefficients [m].
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ * \param batchCache Cache object containing the recurrence multipliers and work arrays for the batched computation.
+ *          Its maximum degree and order are reset if they do not match the size of the coefficient matrices.
+ * \param accelerations Cartesian acceleration vectors (one per column) resulting from the summation of all harmonic
+ *          terms (returned by reference) [m s^-2].
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ */
+void computeGeodesyNormalizedGravitationalAccelerationSumBatch(
+        const Eigen::Matrix3Xd& positionsOfBodiesSubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsBatchCache > batchCache,
+        Eigen::Matrix3Xd& accelerations,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 /*!
  * This function computes the acceleration caused by a single gravitational spherical harmonics
@@ -221,6 +364,25 @@ public:
      */
     virtual ~SphericalHarmonicsGravityField( ) { }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be evaluated concurrently with the original, with its own
+     *  spherical harmonics cache. The coefficients of the copy may be modified independently of the original.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< GravityFieldModel > clone( ) const
+    {
+        if( typeid( *this ) != typeid( SphericalHarmonicsGravityField ) )
+        {
+            throw std::runtime_error( "Error, cloning not supported for this type of spherical harmonic gravity field" );
+        }
+        std::shared_ptr< SphericalHarmonicsGravityField > clonedField =
+                std::make_shared< SphericalHarmonicsGravityField >( *this );
+        clonedField->sphericalHarmonicsCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+        clonedField->sphericalHarmonicsCache_->resetMaximumDegreeAndOrder( maximumDegree_ + 2, maximumOrder_ + 2 );
+        return clonedField;
+    }
+
     //! Function to get the reference radius.
     /*!
      *  Returns the reference radius used for the spherical harmonics expansion in meters.
@@ -14,11 +14,14 @@
 #ifndef TUDAT_SPHERICAL_HARMONICS_GRAVITY_MODEL_H
 #define TUDAT_SPHERICAL_HARMONICS_GRAVITY_MODEL_H
 
+#include <cmath>
 #include <iostream>
 
 #include <functional>
 #include <boost/lambda/lambda.hpp>
+#include <map>
 #include <memory>
+#include <vector>
 
 
 #include <Eigen/Core>
@@ -34,6 +37,8 @@ namespace tudat
 namespace gravitation
 {
 
+class SphericalHarmonicsAccelerationBatch;
+
 //! Template class for general spherical harmonics gravitational acceleration model.
 /*!
  * This templated class implements a general spherical harmonics gravitational acceleration model.
@@ -109,7 +114,8 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_(
               rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          batchIndex_( -1 )
     {
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
@@ -170,7 +176,8 @@ public:
           getSineHarmonicsCoefficients( sineHarmonicCoefficientsFunction ),
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          batchIndex_( -1 )
     {
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
@@ -204,30 +211,27 @@ public:
     {
         if( !( this->currentTime_ == currentTime ) )
         {
-
-            cosineHarmonicCoefficients = getCosineHarmonicsCoefficients( );
-            sineHarmonicCoefficients = getSineHarmonicsCoefficients( );
-
-            rotationToIntegrationFrame_ = rotationFromBodyFixedToIntegrationFrameFunction_( );
-            this->updateBaseMembers( );
-
-            currentInertialRelativePosition_ =
-                    this->positionOfBodySubjectToAcceleration - this->positionOfBodyExertingAcceleration ;
-
-            currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
-                        currentInertialRelativePosition_ );
-
-            currentAcceleration_ =
-                    computeGeodesyNormalizedGravitationalAccelerationSum(
-                        currentRelativePosition_,
-                        gravitationalParameter,
-                        equatorialRadius,
-                        cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients, sphericalHarmonicsCache_,
-                        accelerationPerTerm_,
-                        saveSphericalHarmonicTermsSeparately_,
-                        rotationToIntegrationFrame_.toRotationMatrix( ) );
-            currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
+            // Use batched computation if this model is part of a batch (and acceleration terms need not be saved).
+            if( accelerationBatch_ != nullptr && !saveSphericalHarmonicTermsSeparately_ && !std::isnan( currentTime ) )
+            {
+                updateAccelerationFromBatch( currentTime );
+            }
+            else
+            {
+                updateRelativePosition( );
+
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSum(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, sphericalHarmonicsCache_,
+                            accelerationPerTerm_,
+                            saveSphericalHarmonicTermsSeparately_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+                currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
+            }
 
             if ( this->updatePotential_ )
             {
@@ -242,6 +246,72 @@ public:
         }
     }
 
+    //! Function to update the coefficients, rotation and the relative position of the bodies to the current state
+    /*!
+     * Function to update the coefficients, rotation to integration frame and the relative position of the bodies to
+     * the current state, without computing the acceleration. Called from updateMembers, or by the
+     * SphericalHarmonicsAccelerationBatch of which this model is a part (if any).
+     */
+    void updateRelativePosition( )
+    {
+        cosineHarmonicCoefficients = getCosineHarmonicsCoefficients( );
+        sineHarmonicCoefficients = getSineHarmonicsCoefficients( );
+
+        rotationToIntegrationFrame_ = rotationFromBodyFixedToIntegrationFrameFunction_( );
+        this->updateBaseMembers( );
+
+        currentInertialRelativePosition_ =
+                this->positionOfBodySubjectToAcceleration - this->positionOfBodyExertingAcceleration ;
+
+        currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
+                    currentInertialRelativePosition_ );
+    }
+
+    //! Function to set the batch object, through which the acceleration is computed together with other accelerations
+    /*!
+     * Function to set the batch object, through which the acceleration is computed together with other accelerations
+     * due to the same gravity field, but acting on different bodies (see SphericalHarmonicsAccelerationBatch). Typically
+     * called by the createSphericalHarmonicsAccelerationBatch function.
+     * \param accelerationBatch Batch object of which this acceleration model is a part (nullptr to disable batching)
+     * \param batchIndex Index of this acceleration model in the batch object.
+     */
+    void setAccelerationBatch( const std::shared_ptr< SphericalHarmonicsAccelerationBatch > accelerationBatch,
+                               const int batchIndex )
+    {
+        accelerationBatch_ = accelerationBatch;
+        batchIndex_ = batchIndex;
+    }
+
+    //! Function to reset the current time of the acceleration model, so that it is recomputed at the next update
+    /*!
+     * Function to reset the current time of the acceleration model, so that it is recomputed at the next update. If the
+     * model is part of a batch, the current time of the batch is reset as well, so that the batch is recomputed at the
+     * next update of any of its models (e.g. for a different state at the same time).
+     */
+    virtual void resetCurrentTime( );
+
+    //! Function to retrieve the batch object through which the acceleration is computed (nullptr if none).
+    /*!
+     * Function to retrieve the batch object through which the acceleration is computed (nullptr if none).
+     * \return Batch object through which the acceleration is computed.
+     */
+    std::shared_ptr< SphericalHarmonicsAccelerationBatch > getAccelerationBatch( )
+    {
+        return accelerationBatch_;
+    }
+
+    //! Function to retrieve the current matrix of cosine coefficients, as set by last call to updateMembers.
+    const Eigen::MatrixXd& getCurrentCosineHarmonicCoefficients( )
+    {
+        return cosineHarmonicCoefficients;
+    }
+
+    //! Function to retrieve the current matrix of sine coefficients, as set by last call to updateMembers.
+    const Eigen::MatrixXd& getCurrentSineHarmonicCoefficients( )
+    {
+        return sineHarmonicCoefficients;
+    }
+
     //! Function to retrieve total spherical harmonic acceleration in inertial frame, with alternative coefficients
     /*!
      * Function to retrieve total spherical harmonic acceleration in inertial frame, with alternative coefficients, e.g.
@@ -477,6 +547,15 @@ protected:
 
 private:
 
+    //! Function to retrieve the current acceleration from the batch object of which this model is a part.
+    /*!
+     * Function to retrieve the current acceleration from the batch object of which this model is a part. The batch
+     * object updates the relative positions of (and computes the accelerations for) all its models if it has not yet
+     * been updated to the current time.
+     * \param currentTime Time at which acceleration model is to be updated.
+     */
+    void updateAccelerationFromBatch( const double currentTime );
+
     //! Equatorial radius [m].
     /*!
      * Current value of equatorial (planetary) radius used for spherical harmonics expansion [m].
@@ -540,8 +619,115 @@ private:
     //! Maximum order of gravity field expansion
     int maximumOrder_;
 
+    //! Batch object through which the acceleration is computed (nullptr if acceleration is computed individually)
+    std::shared_ptr< SphericalHarmonicsAccelerationBatch > accelerationBatch_;
+
+    //! Index of this acceleration model in accelerationBatch_
+    int batchIndex_;
+
 };
 
+//! Class for the simultaneous computation of spherical harmonic accelerations exerted by a single gravity field on
+//! multiple bodies.
+/*!
+ * Class for the simultaneous computation of spherical harmonic accelerations exerted by a single gravity field on
+ * multiple bodies (e.g. the satellites of a constellation), using the batched (and vectorized) evaluation in
+ * computeGeodesyNormalizedGravitationalAccelerationSumBatch. When the first of its acceleration models is updated to a
+ * new time, the relative positions of all bodies are updated, and the accelerations on all bodies are computed in a
+ * single call. The remaining acceleration models then retrieve their (already computed) acceleration. All models must
+ * have the same reference radius and coefficients, and must be updated to the same time (as is the case when they are
+ * part of the same propagation). Objects of this class should be created using the
+ * createSphericalHarmonicsAccelerationBatch function.
+ */
+class SphericalHarmonicsAccelerationBatch
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param accelerationModels List of acceleration models (exerted by the same gravity field) to compute in batch.
+     */
+    SphericalHarmonicsAccelerationBatch(
+            const std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > >& accelerationModels );
+
+    //! Function to update the accelerations of all models to the current time
+    /*!
+     * Function to update the accelerations of all models to the current time. The computation is only performed if
+     * the batch has not yet been updated to the current time.
+     * \param currentTime Time at which accelerations are to be computed.
+     */
+    void updateAccelerations( const double currentTime );
+
+    //! Function to retrieve the acceleration (in the body-fixed frame of the gravity field) of a single model
+    /*!
+     * Function to retrieve the acceleration (in the body-fixed frame of the gravity field) of a single model, as
+     * computed by the last call to updateAccelerations
+     * \param batchIndex Index of acceleration model in the batch
+     * \return Acceleration (in the body-fixed frame of the gravity field) of the requested model
+     */
+    Eigen::Vector3d getAccelerationInBodyFixedFrame( const int batchIndex )
+    {
+        return currentAccelerations_.col( batchIndex );
+    }
+
+    //! Function to reset the current time of the batch, so that the accelerations are recomputed at the next update
+    void resetCurrentTime( )
+    {
+        currentTime_ = TUDAT_NAN;
+    }
+
+    //! Function to retrieve the number of acceleration models in the batch
+    int getNumberOfAccelerationModels( )
+    {
+        return static_cast< int >( accelerationModels_.size( ) );
+    }
+
+private:
+
+    //! List of acceleration models that are computed in batch (weak pointers to prevent circular references)
+    std::vector< std::weak_ptr< SphericalHarmonicsGravitationalAccelerationModel > > accelerationModels_;
+
+    //! Reference radius of the gravity field
+    double referenceRadius_;
+
+    //! Time to which the batch was last updated.
+    double currentTime_;
+
+    //! Current relative positions of the bodies in frame fixed to body exerting the acceleration (one per column)
+    Eigen::Matrix3Xd currentRelativePositions_;
+
+    //! Current accelerations per unit gravitational parameter, in frame fixed to body exerting the acceleration
+    Eigen::Matrix3Xd currentAccelerations_;
+
+    //! Cache object containing recurrence multipliers and work arrays for the batched computation
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsBatchCache > batchCache_;
+
+};
+
+//! Function to create a batch object for a list of spherical harmonic acceleration models, and assign it to the models
+/*!
+ * Function to create a batch object for a list of spherical harmonic acceleration models (exerted by the same gravity
+ * field on different bodies), and assign it to each of the models, so that they are subsequently computed in batch.
+ * \param accelerationModels List of acceleration models (exerted by the same gravity field) to compute in batch.
+ * \return Batch object for the acceleration models
+ */
+std::shared_ptr< SphericalHarmonicsAccelerationBatch > createSphericalHarmonicsAccelerationBatch(
+        const std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > >& accelerationModels );
+
+//! Function to create batch objects for all spherical harmonic accelerations in an acceleration map
+/*!
+ * Function to create batch objects for all spherical harmonic accelerations in an acceleration map. The spherical
+ * harmonic accelerations are grouped by body exerting the acceleration, and a batch object is created for each body
+ * exerting a spherical harmonic acceleration on at least minimumBatchSize bodies.
+ * \param accelerationModelMap List of acceleration models, per body undergoing and body exerting the acceleration.
+ * \param minimumBatchSize Minimum number of accelerations exerted by a single gravity field for which a batch is created.
+ * \return Batch objects that were created, with the name of the body exerting the accelerations as key.
+ */
+std::map< std::string, std::shared_ptr< SphericalHarmonicsAccelerationBatch > > createSphericalHarmonicsAccelerationBatches(
+        const basic_astrodynamics::AccelerationMap& accelerationModelMap,
+        const int minimumBatchSize = 2 );
+
 
 //! Typedef for shared-pointer to SphericalHarmonicsGravitationalAccelerationModel.
 typedef std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel >
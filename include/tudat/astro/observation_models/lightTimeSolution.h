@@ -388,66 +388,100 @@ public:
         StateType transmitterState =
                 stateFunctionOfTransmittingBody_( transmissionTime );
 
-        // Set initial light-time correction.
-        setTotalLightTimeCorrection(
-                    transmitterState, receiverState, transmissionTime, receptionTime );
-
-        // Calculate light-time solution assuming infinte speed of signal as initial estimate.
-        ObservationScalarType previousLightTimeCalculation =
-                calculateNewLightTimeEstime( receiverState, transmitterState );
+        // Iterate light-time solution, and set output variables.
+        ObservationScalarType lightTime = iterateLightTimeSolution(
+                    receiverState, transmitterState, receptionTime, transmissionTime, time, isTimeAtReception );
+        receiverStateOutput = receiverState;
+        transmitterStateOutput = transmitterState;
 
-        // Set variables for iteration
-        ObservationScalarType newLightTimeCalculation = 0.0;
-        bool isToleranceReached = false;
+        return lightTime;
+    }
 
-        // Recalculate light-time solution until tolerance is reached.
-        int counter = 0;
+    //! Function to calculate the light times and link-ends states for a list of (sorted) times.
+    /*!
+     *  Function to calculate the light times and link-ends states for a list of times, typically the (densely spaced)
+     *  observation times of a single tracking pass, sorted in time. For each time, the light time is computed as in
+     *  calculateLightTimeWithLinkEndsStates, but the iteration is started from the light time extrapolated (linearly) from
+     *  the solutions at the preceding two times, instead of from the light time of the instantaneous geometry (zero
+     *  light time). For closely spaced times, the initial light time is then typically accurate to well below a
+     *  microsecond, so that fewer iterations (and calls to the link end state functions) are needed. The solution at a
+     *  time is only used to start the iteration at the next time if the two are separated by at most
+     *  maximumTimeStepForInitialGuess (e.g. not between two tracking passes). The light times are equal to those of
+     *  calculateLightTimeWithLinkEndsStates to within the light-time convergence tolerance.
+     *  \param receiverStatesOutput Output by reference of receiver state for each time.
+     *  \param transmitterStatesOutput Output by reference of transmitter state for each time.
+     *  \param times Times at reception or transmission.
+     *  \param isTimeAtReception True if input times are at reception, false if at transmission.
+     *  \param maximumTimeStepForInitialGuess Maximum difference between two subsequent times for which the light time
+     *  at the first is used to start the iteration at the second.
+     *  \return The values of the light time between the reciever state and the transmitter state for each time.
+     */
+    std::vector< ObservationScalarType > calculateLightTimesWithLinkEndsStates(
+            std::vector< StateType >& receiverStatesOutput,
+            std::vector< StateType >& transmitterStatesOutput,
+            const std::vector< TimeType >& times,
+            const bool isTimeAtReception = 1,
+            const double maximumTimeStepForInitialGuess = 600.0 )
+    {
+        std::vector< ObservationScalarType > lightTimes;
+        lightTimes.reserve( times.size( ) );
+        receiverStatesOutput.resize( times.size( ) );
+        transmitterStatesOutput.resize( times.size( ) );
 
-        // Set variable determining whether to update the light time each iteration.
-        bool updateLightTimeCorrections = false;
-        if( lightTimeConvergenceCriteria_->iterateCorrections_ )
-        {
-            updateLightTimeCorrections = true;
-        }
+        TimeType receptionTime, transmissionTime;
+        StateType receiverState, transmitterState;
 
-        // Iterate until tolerance reached.
-        while( !isToleranceReached )
+        // Number of preceding times from which the light time can be extrapolated
+        int numberOfPrecedingSolutions = 0;
+        for( unsigned int i = 0; i < times.size( ); i++ )
         {
-            // Update light-time corrections, if necessary.
-            if( updateLightTimeCorrections )
+            if( numberOfPrecedingSolutions > 0 &&
+                    std::fabs( static_cast< double >( times.at( i ) - times.at( i - 1 ) ) ) > maximumTimeStepForInitialGuess )
             {
-                setTotalLightTimeCorrection(
-                            transmitterState, receiverState, transmissionTime, receptionTime );
+                numberOfPrecedingSolutions = 0;
             }
 
-            // Update light-time estimate for this iteration.
-            if( isTimeAtReception )
+            if( numberOfPrecedingSolutions == 0 )
             {
-                receptionTime = time;
-                transmissionTime = time - previousLightTimeCalculation;
-                transmitterState = ( stateFunctionOfTransmittingBody_( transmissionTime ) );
+                lightTimes.push_back( calculateLightTimeWithLinkEndsStates(
+                                          receiverStatesOutput[ i ], transmitterStatesOutput[ i ], times.at( i ),
+                                          isTimeAtReception ) );
             }
             else
             {
-                receptionTime = time + previousLightTimeCalculation;
-                transmissionTime = time;
-                receiverState = ( stateFunctionOfReceivingBody_( receptionTime ) );
+                // Extrapolate light time from preceding solution(s)
+                ObservationScalarType initialLightTime = lightTimes.at( i - 1 );
+                if( numberOfPrecedingSolutions > 1 && !( times.at( i - 1 ) == times.at( i - 2 ) ) )
+                {
+                    initialLightTime += ( lightTimes.at( i - 1 ) - lightTimes.at( i - 2 ) ) *
+                            static_cast< ObservationScalarType >( times.at( i ) - times.at( i - 1 ) ) /
+                            static_cast< ObservationScalarType >( times.at( i - 1 ) - times.at( i - 2 ) );
+                }
+
+                // Initialize reception and transmission times and states to extrapolated light time
+                if( isTimeAtReception )
+                {
+                    receptionTime = times.at( i );
+                    transmissionTime = times.at( i ) - initialLightTime;
+                }
+                else
+                {
+                    receptionTime = times.at( i ) + initialLightTime;
+                    transmissionTime = times.at( i );
+                }
+                receiverState = stateFunctionOfReceivingBody_( receptionTime );
+                transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+
+                lightTimes.push_back( iterateLightTimeSolution(
+                                          receiverState, transmitterState, receptionTime, transmissionTime, times.at( i ),
+                                          isTimeAtReception ) );
+                receiverStatesOutput[ i ] = receiverState;
+                transmitterStatesOutput[ i ] = transmitterState;
             }
-            newLightTimeCalculation = calculateNewLightTimeEstime( receiverState, transmitterState );
-            isToleranceReached = isLightTimeSolutionConverged(
-                        lightTimeConvergenceCriteria_, previousLightTimeCalculation, newLightTimeCalculation, counter,
-                        currentCorrection_, time, updateLightTimeCorrections );
-
-            // Update light time for new iteration.
-            previousLightTimeCalculation = newLightTimeCalculation;
-            counter++;
+            numberOfPrecedingSolutions++;
         }
 
-        // Set output variables and return the light time.
-        receiverStateOutput = receiverState;
-        transmitterStateOutput = transmitterState;
-
-        return newLightTimeCalculation;
+        return lightTimes;
     }
 
     //! Function to get the part wrt linkend position
@@ -524,6 +558,85 @@ protected:
     //! Current light-time correction.
     double currentCorrection_;
 
+    //! Function to iterate the light-time solution, starting from a given estimate of the link-ends states.
+    /*!
+     *  Function to iterate the light-time solution, starting from a given estimate of the link-ends states, until the
+     *  convergence criteria are met.
+     *  \param receiverState Estimate of receiver state (input) and converged receiver state (output, by reference).
+     *  \param transmitterState Estimate of transmitter state (input) and converged transmitter state (output, by
+     *  reference).
+     *  \param receptionTime Time at reception for the input estimate of the receiver state.
+     *  \param transmissionTime Time at transmission for the input estimate of the transmitter state.
+     *  \param time Time at reception or transmission.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     *  \return The value of the light time between the reciever state and the transmitter state.
+     */
+    ObservationScalarType iterateLightTimeSolution(
+            StateType& receiverState,
+            StateType& transmitterState,
+            TimeType receptionTime,
+            TimeType transmissionTime,
+            const TimeType time,
+            const bool isTimeAtReception )
+    {
+        // Set initial light-time correction.
+        setTotalLightTimeCorrection(
+                    transmitterState, receiverState, transmissionTime, receptionTime );
+
+        // Calculate light-time solution from input link-ends states as initial estimate.
+        ObservationScalarType previousLightTimeCalculation =
+                calculateNewLightTimeEstime( receiverState, transmitterState );
+
+        // Set variables for iteration
+        ObservationScalarType newLightTimeCalculation = 0.0;
+        bool isToleranceReached = false;
+
+        // Recalculate light-time solution until tolerance is reached.
+        int counter = 0;
+
+        // Set variable determining whether to update the light time each iteration.
+        bool updateLightTimeCorrections = false;
+        if( lightTimeConvergenceCriteria_->iterateCorrections_ )
+        {
+            updateLightTimeCorrections = true;
+        }
+
+        // Iterate until tolerance reached.
+        while( !isToleranceReached )
+        {
+            // Update light-time corrections, if necessary.
+            if( updateLightTimeCorrections )
+            {
+                setTotalLightTimeCorrection(
+                            transmitterState, receiverState, transmissionTime, receptionTime );
+            }
+
+            // Update light-time estimate for this iteration.
+            if( isTimeAtReception )
+            {
+                receptionTime = time;
+                transmissionTime = time - previousLightTimeCalculation;
+                transmitterState = ( stateFunctionOfTransmittingBody_( transmissionTime ) );
+            }
+            else
+            {
+                receptionTime = time + previousLightTimeCalculation;
+                transmissionTime = time;
+                receiverState = ( stateFunctionOfReceivingBody_( receptionTime ) );
+            }
+            newLightTimeCalculation = calculateNewLightTimeEstime( receiverState, transmitterState );
+            isToleranceReached = isLightTimeSolutionConverged(
+                        lightTimeConvergenceCriteria_, previousLightTimeCalculation, newLightTimeCalculation, counter,
+                        currentCorrection_, time, updateLightTimeCorrections );
+
+            // Update light time for new iteration.
+            previousLightTimeCalculation = newLightTimeCalculation;
+            counter++;
+        }
+
+        return newLightTimeCalculation;
+    }
+
     //! Function to calculate a new light-time estimate from the link-ends states.
     /*!
      *  Function to calculate a new light-time estimate from the states of the two ends of the
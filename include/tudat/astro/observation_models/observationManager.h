@@ -244,36 +244,28 @@ public:
         std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
                 observationSimulator_->getObservationModel( linkEnds );
 
-        // Initialize vectors of states and times of link ends to be used in calculations.
-        std::vector< Eigen::Vector6d > vectorOfStates;
-        std::vector< double > vectorOfTimes;
-
-        Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
+        // Compute observations at all times in a single call, so that the observation model can exploit the similarity
+        // of subsequent observations (e.g. in the light-time solution)
+        std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observationList;
+        std::vector< std::vector< double > > linkEndTimesList;
+        std::vector< std::vector< Eigen::Vector6d > > linkEndStatesList;
+        selectedObservationModel->computeObservationsWithLinkEndDataForTimes(
+                    times, linkEndAssociatedWithTime, observationList, linkEndTimesList, linkEndStatesList,
+                    ancilliarySettings );
 
         // Iterate over all observation times
         int currentObservationSize;
         for( unsigned int i = 0; i < times.size( ); i++ )
         {
-            vectorOfTimes.clear( );
-            vectorOfStates.clear( );
-
-            // Compute observation
-            currentObservation = selectedObservationModel->computeObservationsWithLinkEndData(
-                        times[ i ], linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates, ancilliarySettings );
-            observations[ times[ i ] ] = currentObservation;
+            observations[ times[ i ] ] = observationList[ i ];
 
             // Compute observation partial
-            currentObservationSize = currentObservation.rows( );
-//            std::cout << "before call to determineObservationPartialMatrix" << "\n\n";
+            currentObservationSize = observationList[ i ].rows( );
             observationMatrices[ times[ i ] ] = determineObservationPartialMatrix(
-                        currentObservationSize, vectorOfStates, vectorOfTimes, linkEnds, currentObservation,
+                        currentObservationSize, linkEndStatesList[ i ], linkEndTimesList[ i ], linkEnds, observationList[ i ],
                         linkEndAssociatedWithTime );
-//            std::cout << "after call to determineObservationPartialMatrix" << "\n\n";
-
         }
 
-//        std::cout << "end computeObservationsWithPartials" << "\n\n";
-
         return std::make_pair(
                 utilities::createConcatenatedEigenMatrixFromMapValues< TimeType, ObservationScalarType, ObservationSize, 1 >( observations ),
                 utilities::createConcatenatedEigenMatrixFromMapValues< TimeType, ObservationScalarType, ObservationSize, Eigen::Dynamic >( observationMatrices ) );
@@ -365,7 +357,14 @@ protected:
         // Perform updates of dependent variables used by (subset of) observation partials.
         updatePartials( states, times, linkEnds, linkEndAssociatedWithTime, currentObservation );
 
-        currentLinkEndPartials = observationPartials_[ linkEnds ];
+        // Retrieve partials of current link ends, without modifying this object, so that partials for different link ends
+        // may be computed concurrently
+        std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
+                currentLinkEndPartials;
+        if( observationPartials_.count( linkEnds ) > 0 )
+        {
+            currentLinkEndPartials = observationPartials_.at( linkEnds );
+        }
 
         // Get list of bodies involved in linkEnds
         std::vector< std::string > bodiesInLinkEnds;
@@ -524,10 +523,6 @@ protected:
     std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
     observation_partials::ObservationPartial< ObservationSize > > > > observationPartials_;
 
-    //! Pre-declared map used in computation of partials.
-    std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
-    currentLinkEndPartials;
-
     std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface_;
 
 };
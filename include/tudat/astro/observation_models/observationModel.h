@@ -20,6 +20,7 @@
 #include <Eigen/Core>
 
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/modelEvaluationProfiler.h"
 #include "tudat/basics/timeType.h"
 #include "tudat/basics/tudatTypeTraits.h"
 #include "tudat/basics/utilities.h"
@@ -319,6 +320,9 @@ public:
             std::vector< Eigen::Matrix< double, 6, 1 > >& linkEndStates,
             const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
     {
+        // Record clock time of observation computation, if profiled
+        utilities::ScopedModelEvaluationTimer timer( modelEvaluationProfiler_.get( ), modelEvaluationProfileIndex_ );
+
         // Add time bias if necessary
         TimeType observationTime = computeBiasedObservationTime( time );
 
@@ -343,6 +347,90 @@ public:
         }
     }
 
+    //! Function to compute the observable without any corrections, for a list of times
+    /*!
+     *  Function to compute the observable without any corrections (see computeIdealObservationsWithLinkEndData) for a
+     *  list of times, typically the (sorted) observation times of a single link. This base class implementation
+     *  computes the observables one at a time; derived classes may redefine it to exploit the similarity of
+     *  subsequent observations (e.g. to start the light-time iteration from the preceding solution).
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param observations Ideal observable at each time (returned by reference).
+     *  \param linkEndTimes List of times at each link end during each observation (returned by reference).
+     *  \param linkEndStates List of states at each link end during each observation (returned by reference).
+     */
+    virtual void computeIdealObservationsWithLinkEndDataForTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        observations.resize( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            observations[ i ] = computeIdealObservationsWithLinkEndData(
+                        times[ i ], linkEndAssociatedWithTime, linkEndTimes[ i ], linkEndStates[ i ], ancilliarySetings );
+        }
+    }
+
+    //! Function to compute full observations at a list of times.
+    /*!
+     *  Function to compute observations (including any defined non-ideal corrections) at a list of times, typically the
+     *  (sorted) observation times of a single link, with the same results as computeObservationsWithLinkEndData
+     *  for each of the times. The ideal observations are computed by computeIdealObservationsWithLinkEndDataForTimes.
+     *  \param times Times at which observations are to be simulated
+     *  \param linkEndAssociatedWithTime Link end at which current times are measured, i.e. reference
+     *  link end for observable.
+     *  \param observations Calculated observable value at each time (returned by reference).
+     *  \param linkEndTimes List of times at each link end during each observation (returned by reference).
+     *  \param linkEndStates List of states at each link end during each observation (returned by reference).
+     */
+    void computeObservationsWithLinkEndDataForTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        // Record clock time of observation computations, if profiled
+        utilities::ScopedModelEvaluationTimer timer(
+                    modelEvaluationProfiler_.get( ), modelEvaluationProfileIndex_, static_cast< int >( times.size( ) ) );
+
+        // Add time bias if necessary
+        std::vector< TimeType > observationTimes( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            observationTimes[ i ] = computeBiasedObservationTime( times[ i ] );
+        }
+
+        if( !isBiasnullptr_ )
+        {
+            // Check that time biases are associated with the time reference time link.
+            checkReferenceLinkEndForTimeBiases( linkEndAssociatedWithTime );
+        }
+
+        // Compute ideal observables
+        computeIdealObservationsWithLinkEndDataForTimes(
+                    observationTimes, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates, ancilliarySetings );
+
+        // Add corrections
+        if( !isBiasnullptr_ )
+        {
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                observations[ i ] += this->observationBiasCalculator_->getObservationBias(
+                            linkEndTimes[ i ], linkEndStates[ i ], observations[ i ].template cast< double >( ) ).
+                        template cast< ObservationScalarType >( );
+            }
+        }
+    }
+
     //! Function to compute the observable without any corrections.
     /*!
      * Function to compute the observable without any corrections, i.e. the ideal physical observable as computed
@@ -377,6 +465,9 @@ public:
             const LinkEndType linkEndAssociatedWithTime,
             const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
     {
+        // Record clock time of observation computation, if profiled
+        utilities::ScopedModelEvaluationTimer timer( modelEvaluationProfiler_.get( ), modelEvaluationProfileIndex_ );
+
         // Check if any non-ideal models are set.
         if( isBiasnullptr_ )
         {
@@ -458,6 +549,25 @@ public:
         return observationBiasCalculator_;
     }
 
+    //! Function to set the object recording the number of calls and clock time of the observation computations
+    /*!
+     * Function to set the object recording the number of calls and clock time of the observation computations (nullptr
+     * to disable profiling). The model is registered in the category "observation model", with the observable type and
+     * link ends as name.
+     * \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    void setModelEvaluationProfiler( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        modelEvaluationProfileIndex_ = -1;
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            modelEvaluationProfileIndex_ = modelEvaluationProfiler_->registerModel(
+                        "observation model", getObservableName( observableType_, linkEnds_.size( ) ) + " " +
+                        getLinkEndsString( linkEnds_ ) );
+        }
+    }
+
 
 protected:
 
@@ -569,6 +679,12 @@ protected:
     //! List of time biases functions, if any.
     std::vector< std::function< double( const double ) > > getTimeBiasFunctions_;
 
+    //! Object recording the number of calls and clock time of the observation computations (nullptr if not profiled).
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    //! Index of this model in modelEvaluationProfiler_
+    int modelEvaluationProfileIndex_ = -1;
+
 };
 
 extern template class ObservationModel< 1, double, double >;
@@ -64,6 +64,15 @@ public:
      */
     virtual int getObservationSize( ) = 0;
 
+    //! Function to set the object recording the number of calls and clock time of the observation models
+    /*!
+     * Function to set the object recording the number of calls and clock time of the observation models (nullptr to
+     * disable profiling).
+     * \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    virtual void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler ) = 0;
+
 
 protected:
 
@@ -133,6 +142,21 @@ public:
         return observationModels_;
     }
 
+    //! Function to set the object recording the number of calls and clock time of the observation models
+    /*!
+     * Function to set the object recording the number of calls and clock time of the observation models (nullptr to
+     * disable profiling).
+     * \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        for( auto modelIterator : observationModels_ )
+        {
+            modelIterator.second->setModelEvaluationProfiler( modelEvaluationProfiler );
+        }
+    }
+
 protected:
 
     //! List of observation models of type observableType
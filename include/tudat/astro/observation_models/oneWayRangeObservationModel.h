@@ -131,6 +131,63 @@ public:
         return ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) << observation ).finished( );
     }
 
+    //! Function to compute one-way range observables without any corrections, for a list of times.
+    /*!
+     *  Function to compute one-way range observables without any corrections (see
+     *  computeIdealObservationsWithLinkEndData) for a list of times. The light times are computed with
+     *  LightTimeCalculator::calculateLightTimesWithLinkEndsStates, so that for (densely spaced) sorted times each
+     *  light-time iteration is started from the solution at the preceding times.
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param observations Ideal one-way range observable at each time.
+     *  \param linkEndTimes List of times at each link end during each observation.
+     *  \param linkEndStates List of states at each link end during each observation.
+     */
+    void computeIdealObservationsWithLinkEndDataForTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        if( ancilliarySetings != nullptr )
+        {
+            throw std::runtime_error( "Error, calling one-way range observable with ancilliary settings, but none are supported." );
+        }
+
+        if( linkEndAssociatedWithTime != receiver && linkEndAssociatedWithTime != transmitter )
+        {
+            std::string errorMessage = "Error, cannot have link end type: " +
+                    std::to_string( linkEndAssociatedWithTime ) + "for one-way range";
+            throw std::runtime_error( errorMessage );
+        }
+        bool isTimeAtReception = ( linkEndAssociatedWithTime == receiver );
+
+        // Compute light times, and link end states
+        std::vector< ObservationScalarType > lightTimes = lightTimeCalculator_->calculateLightTimesWithLinkEndsStates(
+                    receiverStates_, transmitterStates_, times, isTimeAtReception );
+
+        observations.resize( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            // Convert light time to range.
+            observations[ i ]( 0 ) = lightTimes[ i ] * physical_constants::getSpeedOfLight< ObservationScalarType >( );
+
+            // Set link end states and times.
+            linkEndTimes[ i ].clear( );
+            linkEndTimes[ i ].push_back( static_cast< double >( isTimeAtReception ? ( times[ i ] - lightTimes[ i ] ) : times[ i ] ) );
+            linkEndTimes[ i ].push_back( static_cast< double >( isTimeAtReception ? times[ i ] : ( times[ i ] + lightTimes[ i ] ) ) );
+
+            linkEndStates[ i ].clear( );
+            linkEndStates[ i ].push_back( transmitterStates_[ i ].template cast< double >( ) );
+            linkEndStates[ i ].push_back( receiverStates_[ i ].template cast< double >( ) );
+        }
+    }
+
     //! Function to get the object to calculate light time.
     /*!
      * Function to get the object to calculate light time.
@@ -157,6 +214,12 @@ private:
     //! Pre-declared transmitter state, to prevent many (de-)allocations
     StateType transmitterState;
 
+    //! Pre-declared receiver states for a list of times, to prevent many (de-)allocations
+    std::vector< StateType > receiverStates_;
+
+    //! Pre-declared transmitter states for a list of times, to prevent many (de-)allocations
+    std::vector< StateType > transmitterStates_;
+
 };
 
 } // namespace observation_models
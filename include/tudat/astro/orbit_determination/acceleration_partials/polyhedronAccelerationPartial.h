@@ -241,11 +241,11 @@ private:
     //!  Polyhedron cache for this acceleration
     std::shared_ptr< gravitation::PolyhedronGravityCache > polyhedronCache_;
 
-    //! Polyhedron facets dyads.
-    std::vector< Eigen::MatrixXd > facetDyads_;
+    //! Polyhedron facets dyads, packed as structure-of-arrays (shared with the acceleration model).
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > facetDyads_;
 
-    //! Polyhedron edge dyads.
-    std::vector< Eigen::MatrixXd > edgeDyads_;
+    //! Polyhedron edge dyads, packed as structure-of-arrays (shared with the acceleration model).
+    std::shared_ptr< const basic_mathematics::PackedPolyhedronDyads > edgeDyads_;
 
     //! Function returning position of body undergoing acceleration.
     std::function< Eigen::Vector3d( ) > positionFunctionOfAcceleratedBody_;
@@ -275,6 +275,12 @@ private:
      */
     observation_partials::RotationMatrixPartialNamedList rotationMatrixPartials_;
 
+    //! Acceleration model from which the partials are computed.
+    std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel > accelerationModel_;
+
+    //! Spherical harmonics cache for the far-field expansion (nullptr if acceleration uses no far-field expansion).
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > farFieldSphericalHarmonicsCache_;
+
 };
 
 } // namespace acceleration_partials
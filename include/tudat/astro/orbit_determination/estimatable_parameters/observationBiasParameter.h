@@ -109,11 +109,28 @@ public:
      * are typically created after the estimated parameter objects
      * \param getCurrentBias New function to retrieve the current observation bias.
      * \param resetCurrentBias New function to reset the current observation bias
+     * \param addToExistingFunctions Boolean denoting whether the bias object is to be linked in addition to the existing
+     * one(s) (e.g. for a copy of the observation models used by another thread). If true, the new bias object is set to
+     * the current value, the existing get function is retained, and subsequent resets are applied to all bias objects.
      */
     void setObservationBiasFunctions(
             const std::function< Eigen::VectorXd( ) > getCurrentBias,
-            const std::function< void( const Eigen::VectorXd& ) > resetCurrentBias )
+            const std::function< void( const Eigen::VectorXd& ) > resetCurrentBias,
+            const bool addToExistingFunctions = false )
     {
+        // Link an additional bias object to this parameter, retaining the existing one(s)
+        if( addToExistingFunctions && ( resetCurrentBias_ != nullptr ) )
+        {
+            resetCurrentBias( getCurrentBias_( ) );
+            std::function< void( const Eigen::VectorXd& ) > existingResetFunction = resetCurrentBias_;
+            resetCurrentBias_ = [ = ]( const Eigen::VectorXd& newValue )
+            {
+                existingResetFunction( newValue );
+                resetCurrentBias( newValue );
+            };
+            return;
+        }
+
         // Check if functions already exist
         if( !( getCurrentBias_ == nullptr ) || !( resetCurrentBias_ == nullptr ) )
         {
@@ -294,11 +311,28 @@ public:
      * models/biases are typically created after the estimated parameter objects
      * \param getBiasList New function to retrieve the current observation bias list.
      * \param resetBiasList New function to reset the current observation bias list
+     * \param addToExistingFunctions Boolean denoting whether the bias object is to be linked in addition to the existing
+     * one(s) (e.g. for a copy of the observation models used by another thread). If true, the new bias object is set to
+     * the current value, the existing get function is retained, and subsequent resets are applied to all bias objects.
      */
     void setObservationBiasFunctions(
             const std::function< std::vector< Eigen::VectorXd >( ) > getBiasList,
-            const std::function< void( const std::vector< Eigen::VectorXd >& ) > resetBiasList )
+            const std::function< void( const std::vector< Eigen::VectorXd >& ) > resetBiasList,
+            const bool addToExistingFunctions = false )
     {
+        // Link an additional bias object to this parameter, retaining the existing one(s)
+        if( addToExistingFunctions && ( resetBiasList_ != nullptr ) )
+        {
+            resetBiasList( getBiasList_( ) );
+            std::function< void( const std::vector< Eigen::VectorXd >& ) > existingResetFunction = resetBiasList_;
+            resetBiasList_ = [ = ]( const std::vector< Eigen::VectorXd >& newValue )
+            {
+                existingResetFunction( newValue );
+                resetBiasList( newValue );
+            };
+            return;
+        }
+
         // Check if functions already exist
         if( !( getBiasList_ == nullptr ) || !( resetBiasList_ == nullptr ) )
         {
@@ -527,11 +561,28 @@ public:
      * are typically created after the estimated parameter objects
      * \param getCurrentBias New function to retrieve the current observation bias.
      * \param resetCurrentBias New function to reset the current observation bias
+     * \param addToExistingFunctions Boolean denoting whether the bias object is to be linked in addition to the existing
+     * one(s) (e.g. for a copy of the observation models used by another thread). If true, the new bias object is set to
+     * the current value, the existing get function is retained, and subsequent resets are applied to all bias objects.
      */
     void setObservationBiasFunctions(
             const std::function< Eigen::VectorXd( ) > getCurrentBias,
-            const std::function< void( const Eigen::VectorXd& ) > resetCurrentBias )
+            const std::function< void( const Eigen::VectorXd& ) > resetCurrentBias,
+            const bool addToExistingFunctions = false )
     {
+        // Link an additional bias object to this parameter, retaining the existing one(s)
+        if( addToExistingFunctions && ( resetCurrentBias_ != nullptr ) )
+        {
+            resetCurrentBias( getCurrentBias_( ) );
+            std::function< void( const Eigen::VectorXd& ) > existingResetFunction = resetCurrentBias_;
+            resetCurrentBias_ = [ = ]( const Eigen::VectorXd& newValue )
+            {
+                existingResetFunction( newValue );
+                resetCurrentBias( newValue );
+            };
+            return;
+        }
+
         // Check if functions already exist
         if( !( getCurrentBias_ == nullptr ) || !( resetCurrentBias_ == nullptr ) )
         {
@@ -740,11 +791,28 @@ public:
      * models/biases are typically created after the estimated parameter objects
      * \param getBiasList New function to retrieve the current observation bias list.
      * \param resetBiasList New function to reset the current observation bias list
+     * \param addToExistingFunctions Boolean denoting whether the bias object is to be linked in addition to the existing
+     * one(s) (e.g. for a copy of the observation models used by another thread). If true, the new bias object is set to
+     * the current value, the existing get function is retained, and subsequent resets are applied to all bias objects.
      */
     void setObservationBiasFunctions(
             const std::function< std::vector< Eigen::VectorXd >( ) > getBiasList,
-            const std::function< void( const std::vector< Eigen::VectorXd >& ) > resetBiasList )
+            const std::function< void( const std::vector< Eigen::VectorXd >& ) > resetBiasList,
+            const bool addToExistingFunctions = false )
     {
+        // Link an additional bias object to this parameter, retaining the existing one(s)
+        if( addToExistingFunctions && ( resetBiasList_ != nullptr ) )
+        {
+            resetBiasList( getBiasList_( ) );
+            std::function< void( const std::vector< Eigen::VectorXd >& ) > existingResetFunction = resetBiasList_;
+            resetBiasList_ = [ = ]( const std::vector< Eigen::VectorXd >& newValue )
+            {
+                existingResetFunction( newValue );
+                resetBiasList( newValue );
+            };
+            return;
+        }
+
         // Check if functions already exist
         if( !( getBiasList_ == nullptr ) || !( resetBiasList_ == nullptr ) )
         {
@@ -970,11 +1038,28 @@ public:
      * are typically created after the estimated parameter objects
      * \param getCurrentBias New function to retrieve the current observation bias.
      * \param resetCurrentBias New function to reset the current observation bias
+     * \param addToExistingFunctions Boolean denoting whether the bias object is to be linked in addition to the existing
+     * one(s) (e.g. for a copy of the observation models used by another thread). If true, the new bias object is set to
+     * the current value, the existing get function is retained, and subsequent resets are applied to all bias objects.
      */
     void setObservationBiasFunctions(
             const std::function< Eigen::VectorXd( ) > getCurrentBias,
-            const std::function< void( const Eigen::VectorXd& ) > resetCurrentBias )
+            const std::function< void( const Eigen::VectorXd& ) > resetCurrentBias,
+            const bool addToExistingFunctions = false )
     {
+        // Link an additional bias object to this parameter, retaining the existing one(s)
+        if( addToExistingFunctions && ( resetCurrentBias_ != nullptr ) )
+        {
+            resetCurrentBias( getCurrentBias_( ) );
+            std::function< void( const Eigen::VectorXd& ) > existingResetFunction = resetCurrentBias_;
+            resetCurrentBias_ = [ = ]( const Eigen::VectorXd& newValue )
+            {
+                existingResetFunction( newValue );
+                resetCurrentBias( newValue );
+            };
+            return;
+        }
+
         // Check if functions already exist
         if( !( getCurrentBias_ == nullptr ) || !( resetCurrentBias_ == nullptr ) )
         {
@@ -1168,11 +1253,28 @@ public:
      * models/biases are typically created after the estimated parameter objects
      * \param getBiasList New function to retrieve the current observation bias list.
      * \param resetBiasList New function to reset the current observation bias list
+     * \param addToExistingFunctions Boolean denoting whether the bias object is to be linked in addition to the existing
+     * one(s) (e.g. for a copy of the observation models used by another thread). If true, the new bias object is set to
+     * the current value, the existing get function is retained, and subsequent resets are applied to all bias objects.
      */
     void setObservationBiasFunctions(
             const std::function< std::vector< Eigen::VectorXd >( ) > getBiasList,
-            const std::function< void( const std::vector< Eigen::VectorXd >& ) > resetBiasList )
+            const std::function< void( const std::vector< Eigen::VectorXd >& ) > resetBiasList,
+            const bool addToExistingFunctions = false )
     {
+        // Link an additional bias object to this parameter, retaining the existing one(s)
+        if( addToExistingFunctions && ( resetBiasList_ != nullptr ) )
+        {
+            resetBiasList( getBiasList_( ) );
+            std::function< void( const std::vector< Eigen::VectorXd >& ) > existingResetFunction = resetBiasList_;
+            resetBiasList_ = [ = ]( const std::vector< Eigen::VectorXd >& newValue )
+            {
+                existingResetFunction( newValue );
+                resetBiasList( newValue );
+            };
+            return;
+        }
+
         // Check if functions already exist
         if( !( getBiasList_ == nullptr ) || !( resetBiasList_ == nullptr ) )
         {
@@ -11,6 +11,7 @@
 #ifndef TUDAT_PODINPUTOUTPUTTYPES_H
 #define TUDAT_PODINPUTOUTPUTTYPES_H
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <iostream>
@@ -22,6 +23,7 @@
 #include "tudat/basics/timeType.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
 #include "tudat/astro/observation_models/observableTypes.h"
+#include "tudat/math/basic/blockArrowheadNormalEquations.h"
 #include "tudat/simulation/estimation_setup/observations.h"
 #include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
 
@@ -43,7 +45,11 @@ public:
         reintegrateEquationsOnFirstIteration_( true ),
         reintegrateVariationalEquations_( true ),
         saveDesignMatrix_( true ),
-        printOutput_( true )
+        printOutput_( true ),
+        accumulateNormalEquations_( false ),
+        useSvdForIllConditionedNormalEquations_( false ),
+        reduceArcWiseParameters_( false ),
+        numberOfObservationSetThreads_( 1 )
     {
         weightsMatrixDiagonals_ = Eigen::VectorXd::Zero( observationCollection->getTotalObservableSize( ) );
         setConstantWeightsMatrix( 1.0 );
@@ -265,7 +271,90 @@ public:
         this->printOutput_ = printOutput;
     }
 
+    //! Function to return the boolean denoting whether the normal equations are accumulated per set of observations
+    /*!
+     * Function to return the boolean denoting whether the normal equations are accumulated per set of observations, without
+     * storing the full design matrix, and solved with a Cholesky decomposition.
+     * \return Boolean denoting whether the normal equations are accumulated per set of observations
+     */
+    bool getAccumulateNormalEquations( )
+    {
+        return accumulateNormalEquations_;
+    }
 
+    //! Function to return the boolean denoting whether an SVD is used if the (accumulated) normal equations are ill-conditioned
+    /*!
+     * Function to return the boolean denoting whether an SVD is used if the (accumulated) normal equations are not positive
+     * definite, or ill-conditioned
+     * \return Boolean denoting whether an SVD is used if the (accumulated) normal equations are ill-conditioned
+     */
+    bool getUseSvdForIllConditionedNormalEquations( )
+    {
+        return useSvdForIllConditionedNormalEquations_;
+    }
+
+    //! Function to return the boolean denoting whether arc-wise parameters are reduced from the (accumulated) normal equations
+    /*!
+     * Function to return the boolean denoting whether arc-wise parameters are reduced from the (accumulated) normal equations
+     * \return Boolean denoting whether arc-wise parameters are reduced from the (accumulated) normal equations
+     */
+    bool getReduceArcWiseParameters( )
+    {
+        return reduceArcWiseParameters_;
+    }
+
+    //! Function to define the settings for the accumulation and solution of the normal equations
+    /*!
+     * Function to define the settings for the accumulation and solution of the normal equations. If the normal equations are
+     * accumulated, the partials of each set of observations are computed, and added to the normal equations, one set at a
+     * time, so that the full design matrix is never stored (and the design matrix is not saved in the output, regardless of
+     * the settings in defineCovarianceSettings). The normal equations are then solved with a Cholesky decomposition.
+     * \param accumulateNormalEquations Boolean denoting whether the normal equations are accumulated per set of observations
+     * \param useSvdForIllConditionedNormalEquations Boolean denoting whether an SVD is used if the accumulated normal
+     * equations are not positive definite, or ill-conditioned (if false, an exception is thrown for the former case, and a
+     * warning is printed for the latter)
+     * \param reduceArcWiseParameters Boolean denoting whether, in a multi-arc estimation, the normal equations are stored per
+     * arc, with the arc-wise parameters (initial states and arc-wise observation biases) eliminated by a Schur complement
+     * when solving the normal equations (see BlockArrowheadNormalEquations). The storage and solution time of the normal
+     * equations then scale linearly with the number of arcs. This requires the observations of each arc to depend only on
+     * the arc-wise parameters of that arc (i.e. the arcs must not be linked), otherwise an exception is thrown. The inverse
+     * covariance in the output is then stored in block form (see CovarianceAnalysisOutput::getNormalizedInverseCovarianceBlocks),
+     * and the full matrix is only assembled when requested. An a priori covariance, if provided, must not couple the
+     * arc-wise parameters of different arcs.
+     */
+    void defineNormalEquationsSettings( const bool accumulateNormalEquations = 1,
+                                        const bool useSvdForIllConditionedNormalEquations = 0,
+                                        const bool reduceArcWiseParameters = 0 )
+    {
+        this->accumulateNormalEquations_ = accumulateNormalEquations;
+        this->useSvdForIllConditionedNormalEquations_ = useSvdForIllConditionedNormalEquations;
+        this->reduceArcWiseParameters_ = reduceArcWiseParameters;
+    }
+
+    //! Function to set the number of threads over which the observation sets are distributed
+    /*!
+     * Function to set the number of threads over which the observation sets are distributed when computing the residuals
+     * and partials of the observations (if the normal equations are not accumulated). Observation sets are split into
+     * segments of consecutive observations, which are distributed over the threads, each of which uses its own copy of the
+     * observation models and partials. The results are equal to those of a single-threaded computation up to the light-time
+     * convergence tolerance (see OrbitDeterminationManager::calculateDesignMatrixAndResiduals). Consequently, no speedup is obtained for observations of a single
+     * observable type and set of link ends (see OrbitDeterminationManager::calculateDesignMatrixAndResiduals).
+     * \param numberOfObservationSetThreads Number of threads over which the observation sets are distributed
+     */
+    void setNumberOfObservationSetThreads( const int numberOfObservationSetThreads )
+    {
+        numberOfObservationSetThreads_ = std::max( numberOfObservationSetThreads, 1 );
+    }
+
+    //! Function to return the number of threads over which the observation sets are distributed
+    /*!
+     * Function to return the number of threads over which the observation sets are distributed
+     * \return Number of threads over which the observation sets are distributed
+     */
+    int getNumberOfObservationSetThreads( )
+    {
+        return numberOfObservationSetThreads_;
+    }
 
 protected:
     //! Total data structure of observations and associated times/link ends/type
@@ -288,6 +377,18 @@ protected:
 
     //! Boolean denoting whether to print output to th terminal when running the estimation.
     bool printOutput_;
+
+    //! Boolean denoting whether the normal equations are accumulated per set of observations
+    bool accumulateNormalEquations_;
+
+    //! Boolean denoting whether an SVD is used if the (accumulated) normal equations are ill-conditioned
+    bool useSvdForIllConditionedNormalEquations_;
+
+    //! Boolean denoting whether arc-wise parameters are reduced from the (accumulated) normal equations
+    bool reduceArcWiseParameters_;
+
+    //! Number of threads over which the observation sets are distributed when computing residuals and partials
+    int numberOfObservationSetThreads_;
 };
 
 
@@ -509,11 +610,45 @@ struct CovarianceAnalysisOutput
         return designMatrixTransformationDiagonal_;
     }
 
+    //! Function to retrieve the normalized inverse estimation covariance matrix
+    /*!
+     * Function to retrieve the normalized inverse estimation covariance matrix. If the inverse covariance is stored in block
+     * form, the full matrix is assembled from the blocks.
+     * \return Normalized inverse estimation covariance matrix
+     */
     Eigen::MatrixXd getNormalizedInverseCovarianceMatrix( )
     {
+        if( inverseNormalizedCovarianceBlocks_ != nullptr )
+        {
+            return inverseNormalizedCovarianceBlocks_->getFullNormalMatrix( );
+        }
         return inverseNormalizedCovarianceMatrix_;
     }
 
+    //! Function to retrieve the normalized inverse estimation covariance matrix in block form
+    /*!
+     * Function to retrieve the normalized inverse estimation covariance matrix in block form, which is set (instead of the
+     * full matrix) if the arc-wise parameters are reduced from the normal equations (see
+     * CovarianceAnalysisInput::defineNormalEquationsSettings).
+     * \return Normalized inverse estimation covariance matrix in block form (nullptr if not set)
+     */
+    std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > getNormalizedInverseCovarianceBlocks( )
+    {
+        return inverseNormalizedCovarianceBlocks_;
+    }
+
+    //! Function to set the normalized inverse estimation covariance matrix in block form
+    /*!
+     * Function to set the normalized inverse estimation covariance matrix in block form, which is then used instead of the
+     * full matrix.
+     * \param inverseNormalizedCovarianceBlocks Normalized inverse estimation covariance matrix in block form
+     */
+    void setNormalizedInverseCovarianceBlocks(
+            const std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > inverseNormalizedCovarianceBlocks )
+    {
+        inverseNormalizedCovarianceBlocks_ = inverseNormalizedCovarianceBlocks;
+    }
+
     //! Function to retrieve the unnormalized inverse estimation covariance matrix
     /*!
      * Function to retrieve the unnormalized inverse estimation covariance matrix
@@ -538,7 +673,7 @@ struct CovarianceAnalysisOutput
 
     Eigen::MatrixXd getNormalizedCovarianceMatrix( )
     {
-        return inverseNormalizedCovarianceMatrix_.inverse( );
+        return getNormalizedInverseCovarianceMatrix( ).inverse( );
     }
 
     //! Function to retrieve the unnormalized estimation covariance matrix
@@ -608,11 +743,17 @@ struct CovarianceAnalysisOutput
 
     //! Function to retrieve the unnormalized formal error vector of the estimation result.
     /*!
-     * Function to retrieve the unnormalized formal error vector of the estimation result.
+     * Function to retrieve the unnormalized formal error vector of the estimation result. If the inverse covariance is
+     * stored in block form, the formal errors are computed from the blocks, without assembling the full covariance matrix.
      * \return Formal error vector of the estimation result.
      */
     Eigen::VectorXd getFormalErrorVector( )
     {
+        if( inverseNormalizedCovarianceBlocks_ != nullptr )
+        {
+            return ( inverseNormalizedCovarianceBlocks_->getCovarianceDiagonal( ).cwiseQuotient(
+                         designMatrixTransformationDiagonal_.cwiseAbs2( ) ) ).cwiseSqrt( );
+        }
         return ( getUnnormalizedCovarianceMatrix( ).diagonal( ) ).cwiseSqrt( );
     }
 
@@ -623,7 +764,9 @@ struct CovarianceAnalysisOutput
      */
     Eigen::MatrixXd getCorrelationMatrix( )
     {
-        return getUnnormalizedCovarianceMatrix( ).cwiseQuotient( getFormalErrorVector( ) * getFormalErrorVector( ).transpose( ) );
+        Eigen::MatrixXd unnormalizedCovarianceMatrix = getUnnormalizedCovarianceMatrix( );
+        Eigen::VectorXd formalErrorVector = ( unnormalizedCovarianceMatrix.diagonal( ) ).cwiseSqrt( );
+        return unnormalizedCovarianceMatrix.cwiseQuotient( formalErrorVector * formalErrorVector.transpose( ) );
     }
 
     //! Matrix of observation partials (normalixed) used in estimation (may be empty if so requested)
@@ -638,6 +781,9 @@ struct CovarianceAnalysisOutput
     //! Inverse of postfit normalized covariance matrix
     Eigen::MatrixXd inverseNormalizedCovarianceMatrix_;
 
+    //! Inverse of postfit normalized covariance matrix in block form (nullptr if the full matrix is stored)
+    std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > inverseNormalizedCovarianceBlocks_;
+
     //! Boolean denoting whether an exception was caught during (re)propagation of equations of motion (and variational equations)
     bool exceptionDuringPropagation_;
 };
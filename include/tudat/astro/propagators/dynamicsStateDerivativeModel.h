@@ -22,6 +22,7 @@
 
 #include <Eigen/Core>
 
+#include "tudat/basics/columnarTimeHistory.h"
 #include "tudat/astro/basic_astro/torqueModelTypes.h"
 #include "tudat/astro/propagators/bodyMassStateDerivative.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
@@ -144,6 +145,21 @@ public:
      *  \return Calculated state derivative.
      */
     StateType computeStateDerivative( const TimeType time, const StateType& state )
+    {
+        computeStateDerivativeInPlace( time, state, stateDerivative_ );
+        return stateDerivative_;
+    }
+
+    //! Function to calculate the system state derivative, writing it into a preallocated matrix
+    /*!
+     *  Function to calculate the system state derivative, identical to computeStateDerivative, but writing the result into
+     *  the stateDerivative argument (resized only if its size is inconsistent with the state), so that the integrator
+     *  can evaluate it directly into its own buffers.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \param stateDerivative Calculated state derivative (returned by reference).
+     */
+    void computeStateDerivativeInPlace( const TimeType time, const StateType& state, StateType& stateDerivative )
     {
 
         if( !( time == time ) )
@@ -151,21 +167,25 @@ public:
             throw std::invalid_argument( "Error when computing system state derivative. Input time is NaN" );
         }
 
-        if( state.hasNaN( ) )
+        // Check input state (NaN/Inf in the propagated state is otherwise detected after each integration step)
+        if( diagnosticsLevel_ == full_state_derivative_diagnostics )
         {
-            std::cout<<"State with NaN "<<std::endl<<state<<std::endl;
-            throw std::invalid_argument( "Error when computing system state derivative. State vector contains NaN" );
-        }
+            if( state.hasNaN( ) )
+            {
+                std::cout<<"State with NaN "<<std::endl<<state<<std::endl;
+                throw std::invalid_argument( "Error when computing system state derivative. State vector contains NaN" );
+            }
 
-        if( !state.allFinite( ) )
-        {
-            throw std::invalid_argument( "Error when computing system state derivative. State vector contains Inf" );
+            if( !state.allFinite( ) )
+            {
+                throw std::invalid_argument( "Error when computing system state derivative. State vector contains Inf" );
+            }
         }
 
         // Initialize state derivative
-        if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
+        if( stateDerivative.rows( ) != state.rows( ) || stateDerivative.cols( ) != state.cols( )  )
         {
-            stateDerivative_.resize( state.rows( ), state.cols( ) );
+            stateDerivative.resize( state.rows( ), state.cols( ) );
         }
 
         // If dynamical equations are integrated, update the environment with the current state.
@@ -227,7 +247,7 @@ public:
 
                     stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
                                 time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
-                                stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
+                                stateDerivative.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
                 }
             }
         }
@@ -239,15 +259,40 @@ public:
 
             variationalEquations_->evaluateVariationalEquations< StateScalarType >(
                         time, state.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ),
-                        stateDerivative_.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ) );
+                        stateDerivative.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ) );
         }
 
         // Update counters
-        functionEvaluationCounter_++;
-        cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
-
-        return stateDerivative_;
+        if( diagnosticsLevel_ != no_state_derivative_diagnostics )
+        {
+            functionEvaluationCounter_++;
+            lastEvaluationTime_ = time;
+            if( diagnosticsLevel_ == full_state_derivative_diagnostics )
+            {
+                cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
+            }
+        }
+    }
 
+    //! Function to calculate the system state derivative for a state with a fixed number of columns, writing it into a
+    //! preallocated matrix
+    /*!
+     *  Function to calculate the system state derivative for a state with a fixed number of columns (e.g. a column vector
+     *  when propagating only the dynamics), writing it into a preallocated matrix. The state and state derivative are
+     *  copied to/from buffers of this object, which are sized only once.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \param stateDerivative Calculated state derivative (returned by reference).
+     */
+    template< int NumberOfColumns >
+    void computeStateDerivativeInPlace(
+            const TimeType time,
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, NumberOfColumns >& state,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, NumberOfColumns >& stateDerivative )
+    {
+        stateBuffer_ = state;
+        computeStateDerivativeInPlace( time, stateBuffer_, stateDerivative_ );
+        stateDerivative = stateDerivative_;
     }
 
     //! Function to calculate the system state derivative with double precision, regardless of template arguments.
@@ -371,6 +416,30 @@ public:
         }
     }
 
+    //! Function to convert a columnar state history from propagator-specific form to the conventional form
+    /*!
+     * Function to convert a columnar state history from propagator-specific form to the conventional form
+     * (not necessarily in inertial frame).
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param convertedSolution State history (rawSolution), converted to the 'conventional form' (by reference)
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in
+     *        numerical integration).
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            utilities::ColumnarTimeHistory< TimeType, StateScalarType >& convertedSolution,
+            const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& rawSolution )
+    {
+        convertedSolution.clear( );
+        convertedSolution.reserve( rawSolution.size( ) );
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > internalSolution;
+        for( int i = 0; i < rawSolution.size( ); i++ )
+        {
+            internalSolution = rawSolution.getValue( i );
+            convertedSolution.pushBack( rawSolution.getTime( i ),
+                                        convertToOutputSolution( internalSolution, rawSolution.getTime( i ) ) );
+        }
+    }
+
     //! Function to process the state vector during propagation.
     /*!
      * Function to process the state vector during propagation.
@@ -585,6 +654,11 @@ public:
      */
     std::map< TimeType, unsigned int > getCumulativeNumberOfFunctionEvaluations( )
     {
+        // If only counters are recorded, return number of evaluations at time of last evaluation
+        if( diagnosticsLevel_ == state_derivative_evaluation_counters && functionEvaluationCounter_ > 0 )
+        {
+            return { { lastEvaluationTime_, functionEvaluationCounter_ } };
+        }
         return cumulativeFunctionEvaluationCounter_;
     }
 
@@ -598,6 +672,48 @@ public:
         cumulativeFunctionEvaluationCounter_.clear( );
     }
 
+    //! Function to set the level of diagnostics that is recorded by the computeStateDerivative function
+    /*!
+     * Function to set the level of diagnostics that is recorded by the computeStateDerivative function. If no diagnostics
+     * are recorded, the number of function evaluations is not available. If only counters are recorded, the cumulative
+     * number of function evaluations is only available at the time of the last evaluation.
+     * \param diagnosticsLevel Level of diagnostics that is to be recorded
+     */
+    void setDiagnosticsLevel( const StateDerivativeDiagnosticsLevel diagnosticsLevel )
+    {
+        diagnosticsLevel_ = diagnosticsLevel;
+    }
+
+    //! Function to retrieve the level of diagnostics that is recorded by the computeStateDerivative function
+    StateDerivativeDiagnosticsLevel getDiagnosticsLevel( )
+    {
+        return diagnosticsLevel_;
+    }
+
+    //! Function to set the object recording the number of calls and clock time of the models evaluated by this object
+    /*!
+     * Function to set the object recording the number of calls and clock time of the models evaluated by this object
+     * (i.e. by the single-state-type derivative models and variational equations), nullptr to disable profiling.
+     * \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    void setModelEvaluationProfiler( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+             stateDerivativeModelsIterator_++ )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+            {
+                stateDerivativeModelsIterator_->second.at( i )->setModelEvaluationProfiler( modelEvaluationProfiler );
+            }
+        }
+
+        if( variationalEquations_ != nullptr )
+        {
+            variationalEquations_->setModelEvaluationProfiler( modelEvaluationProfiler );
+        }
+    }
+
     //! Function to retrieve the object used for computing the state derivative in the variational equations
     /*!
      * Function to retrieve the object used for computing the state derivative in the variational equations
@@ -725,6 +841,9 @@ private:
     //! Current state derivative, as computed by computeStateDerivative.
     StateType stateDerivative_;
 
+    //! Buffer for the state, used by computeStateDerivativeInPlace for states with a fixed number of columns.
+    StateType stateBuffer_;
+
     //! Current state in 'conventional' representation, computed from current propagated state by
     //! convertCurrentStateToGlobalRepresentationPerType
     std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
@@ -735,6 +854,12 @@ private:
 
     //! Variable to keep track of the number of calls to the computeStateDerivative function per time step
     std::map< TimeType, unsigned int > cumulativeFunctionEvaluationCounter_;
+
+    //! Time of last call to the computeStateDerivative function (only recorded if diagnostics are recorded)
+    TimeType lastEvaluationTime_ = TimeType( );
+
+    //! Level of diagnostics that is recorded by the computeStateDerivative function
+    StateDerivativeDiagnosticsLevel diagnosticsLevel_ = state_derivative_evaluation_counters;
 };
 
 extern template class DynamicsStateDerivativeModel< double, double >;
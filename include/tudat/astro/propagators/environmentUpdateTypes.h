@@ -46,6 +46,14 @@ void addEnvironmentUpdates(
         const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >
         updatesToAdd );
 
+//! Function to get a string representing an environment model update type
+/*!
+ * Function to get a string representing an environment model update type
+ * \param environmentModelUpdate Environment model update type
+ * \return String representing the environment model update type
+ */
+std::string getEnvironmentModelUpdateName( const EnvironmentModelsToUpdate environmentModelUpdate );
+
 } // namespace propagators
 
 } // namespace tudat
@@ -19,11 +19,13 @@
 
 #include <Eigen/Core>
 #include <boost/lambda/lambda.hpp>
+#include <algorithm>
 #include <chrono>
 #include <limits>
 
 #include <map>
 
+#include "tudat/basics/columnarTimeHistory.h"
 #include "tudat/math/integrators/numericalIntegrator.h"
 #include "tudat/astro/basic_astro/timeConversions.h"
 #include "tudat/basics/timeType.h"
@@ -153,6 +155,132 @@ void getFinalStateForExactDependentVariableTerminationCondition(
     }
 }
 
+//! Function to determine, for a given time step in the last integrator step, the error in termination dependent variable,
+//! using the dense output of the integrator
+/*!
+ *  Function to determine, for a given time step in the last integrator step, the error in termination dependent
+ *  variable, using the continuous extension (dense output) of the last integrator step. The state derivative function
+ *  is evaluated at the interpolated state (to update the environment and dependent variables), but no integrator step
+ *  is taken. This function is used as input for the root finder when the propagation must terminate exactly on a
+ *  dependent variable value, and the final condition is to be located on the dense output.
+ *  \param timeStep Time step w.r.t. the start of the last integrator step
+ *  \param integrator Numerical integrator used for propagation, with dense output available for the last step
+ *  \param dependentVariableTerminationCondition Settings used to determine value/type of dependent variable at which
+ *  propagation is to terminate
+ *  \return The difference between the reached and required value of the termination dependent variable
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+TimeStepType getTerminationDependentVariableErrorForGivenDenseOutputTimeStep(
+        TimeStepType timeStep,
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > >
+        integrator,
+        const std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition )
+{
+    // Interpolate state in last step
+    TimeType currentTime = integrator->getPreviousIndependentVariable( ) + timeStep;
+    StateType interpolatedState = integrator->getDenseOutputState( currentTime );
+
+    // Retrieve value of dependent variable at interpolated state
+    integrator->getStateDerivativeFunction( )( currentTime, interpolatedState );
+    return static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+}
+
+//! Function that propagates to an exact final condition for dependent variable termination condition, located on the
+//! dense output of the last integrator step
+/*!
+ * Function that propagates to an exact final condition for dependent variable termination condition, located on the
+ * continuous extension (dense output) of the last integrator step. The root finder of the termination condition is
+ * used to find the time at which the termination condition is met on the interpolated states, after which a single
+ * integrator step from the start of the last step to this time is taken. If the integrator provides no dense output,
+ * the root finder does not converge, or the error in the dependent variable after this step exceeds the dense output
+ * termination tolerance of the condition, this function returns false, and the final condition must be located using
+ * getFinalStateForExactDependentVariableTerminationCondition. In that case, the integrator may have been modified, but
+ * its previous state is unchanged.
+ * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is at
+ * the end of the step in which the termination condition was first exceeded.
+ * \param dependentVariableTerminationCondition Termination condition that is to be used
+ * \param endTime Time at which exact termination condition is met (returned by reference).
+ * \param endState State at time where exact termination condition is met (returned by reference).
+ * \return True if the final condition was succesfully located on the dense output.
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+bool getFinalStateForExactDependentVariableTerminationConditionFromDenseOutput(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > >
+        integrator,
+        const std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition,
+        TimeType& endTime,
+        StateType& endState )
+{
+    if( !integrator->isDenseOutputAvailable( ) )
+    {
+        return false;
+    }
+
+    TimeStepType lastTimeStep = static_cast< TimeStepType >(
+                integrator->getCurrentIndependentVariable( ) - integrator->getPreviousIndependentVariable( ) );
+    if( !( static_cast< double >( lastTimeStep ) != 0.0 ) )
+    {
+        return false;
+    }
+
+    // Function for which the root (zero value) occurs at the required end time/state, evaluated on dense output
+    std::function< TimeStepType( TimeStepType ) > dependentVariableErrorFunction =
+            std::bind( &getTerminationDependentVariableErrorForGivenDenseOutputTimeStep< StateType, TimeType, TimeStepType >,
+                       std::placeholders::_1, integrator, dependentVariableTerminationCondition );
+
+    // Create root finder.
+    std::shared_ptr< root_finders::RootFinder< TimeStepType > > finalConditionRootFinder;
+    if( static_cast< double >( lastTimeStep ) > 0.0 )
+    {
+        finalConditionRootFinder = root_finders::createRootFinder< TimeStepType >(
+                    dependentVariableTerminationCondition->getTerminationRootFinderSettings( ),
+                    static_cast< TimeStepType >( std::numeric_limits< double >::min( ) ),
+                    lastTimeStep,
+                    static_cast< TimeStepType >( std::numeric_limits< double >::min( ) ) );
+    }
+    else
+    {
+        finalConditionRootFinder = root_finders::createRootFinder< TimeStepType >(
+                    dependentVariableTerminationCondition->getTerminationRootFinderSettings( ),
+                    lastTimeStep,
+                    static_cast< TimeStepType >( -std::numeric_limits< double >::min( ) ),
+                    lastTimeStep );
+    }
+
+    // Solve root-finding problem on dense output.
+    TimeStepType finalTimeStep;
+    try
+    {
+        finalTimeStep = finalConditionRootFinder->execute(
+                    std::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >(
+                        dependentVariableErrorFunction ), lastTimeStep / 2.0 );
+    }
+    catch( std::runtime_error& )
+    {
+        return false;
+    }
+
+    // Take single integrator step to final condition, and check the error in the dependent variable
+    integrator->rollbackToPreviousState( );
+    StateType finalState = integrator->performIntegrationStep( finalTimeStep );
+    TimeType finalTime = integrator->getCurrentIndependentVariable( );
+
+    double denseOutputTerminationTolerance = dependentVariableTerminationCondition->getDenseOutputTerminationTolerance( );
+    if( denseOutputTerminationTolerance == denseOutputTerminationTolerance )
+    {
+        integrator->getStateDerivativeFunction( )( finalTime, finalState );
+        if( !( std::fabs( dependentVariableTerminationCondition->getStopConditionError( ) ) <=
+               denseOutputTerminationTolerance ) )
+        {
+            return false;
+        }
+    }
+
+    endTime = finalTime;
+    endState = finalState;
+    return true;
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for hybrid termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for hybrid termination condition. Determines
@@ -320,13 +448,29 @@ bool getFinalStateForExactTerminationCondition(
     }
     case dependent_variable_stopping_condition:
     {
-        integrator->rollbackToPreviousState( );
-
         std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition =
                 std::dynamic_pointer_cast< SingleVariableLimitPropagationTerminationCondition >( terminationCondition );
-        getFinalStateForExactDependentVariableTerminationCondition(
-                    integrator, dependentVariableTerminationCondition, secondToLastTime, lastTime,
-                    secondToLastState, lastState, endTime, endState, isOnlyTerminationCondition );
+
+        // Locate final condition on dense output of last step, if requested (before rollback, which discards it)
+        bool isFinalStateFound = false;
+        if( dependentVariableTerminationCondition->getUseDenseOutputForExactTermination( ) )
+        {
+            isFinalStateFound = getFinalStateForExactDependentVariableTerminationConditionFromDenseOutput(
+                        integrator, dependentVariableTerminationCondition, endTime, endState );
+            if( !isFinalStateFound )
+            {
+                dependentVariableTerminationCondition->registerDenseOutputTerminationFallback( );
+            }
+        }
+
+        // Locate final condition by repeated integrator steps
+        if( !isFinalStateFound )
+        {
+            integrator->rollbackToPreviousState( );
+            getFinalStateForExactDependentVariableTerminationCondition(
+                        integrator, dependentVariableTerminationCondition, secondToLastTime, lastTime,
+                        secondToLastState, lastState, endTime, endState, isOnlyTerminationCondition );
+        }
 
         break;
     }
@@ -364,10 +508,10 @@ bool getFinalStateForExactTerminationCondition(
  * \param timeStep Last time step taken by integrator.
  * \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  * derivative model).
- * \param solutionHistory History of state variables that are to be saved given as map
- * (time as key; returned by reference)
- * \param dependentVariableHistory History of dependent variables that are to be saved given as map
- * (time as key; returned by reference)
+ * \param solutionHistory History of state variables that are to be saved, in order of propagation (returned by
+ * reference)
+ * \param dependentVariableHistory History of dependent variables that are to be saved, in order of propagation
+ * (returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -376,10 +520,12 @@ void propagateToExactTerminationCondition(
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const TimeStepType timeStep,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        utilities::ColumnarTimeHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        utilities::ColumnarTimeHistory< TimeType, double >& dependentVariableHistory,
         const double currentCpuTime )
 {
+    TUDAT_UNUSED_PARAMETER( timeStep );
+
     // Turn off step size control
     integrator->setStepSizeControl( false );
 
@@ -399,37 +545,22 @@ void propagateToExactTerminationCondition(
         bool recomputeDependentVariables = false;
         if( dependentVariableHistory.size( ) > 0 )
         {
-            if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+            if( dependentVariableHistory.backTime( ) == solutionHistory.backTime( ) )
             {
-                if( timeStep > 0 )
-                {
-                    dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-                }
-                else
-                {
-                    dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-                }
+                dependentVariableHistory.popBack( );
                 recomputeDependentVariables = true;
             }
         }
 
         // Remove state entry last added, and enter converged final state
-        if( timeStep > 0 )
-        {
-            solutionHistory.erase( std::prev( solutionHistory.end() ) );
-            solutionHistory[ endTime ] = endState;
-        }
-        else
-        {
-            solutionHistory.erase( solutionHistory.begin( ) );
-            solutionHistory[ endTime ] = endState;
-        }
+        solutionHistory.popBack( );
+        solutionHistory.pushBack( endTime, endState );
 
         // Recompute final dependent variables, if required
         if( recomputeDependentVariables )
         {
             integrator->getStateDerivativeFunction( )( endTime, endState );
-            dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+            dependentVariableHistory.pushBack( endTime, dependentVariableFunction( ) );
 
             // Check stopping conditions to be able to save details
             propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
@@ -446,6 +577,119 @@ void propagateToExactTerminationCondition(
     integrator->setStepSizeControl( true );
 }
 
+//! Function to add a single entry of a propagation history to an output sink
+template< typename TimeType, typename ScalarType >
+void addHistoryEntryToOutputSink(
+        const utilities::ColumnarTimeHistory< TimeType, ScalarType >& history,
+        const int entryIndex,
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        const bool isStateHistory )
+{
+    if( isStateHistory )
+    {
+        outputSink->addStateEntry( static_cast< double >( history.getTime( entryIndex ) ),
+                                   history.getValue( entryIndex ).template cast< double >( ) );
+    }
+    else
+    {
+        outputSink->addDependentVariableEntry( static_cast< double >( history.getTime( entryIndex ) ),
+                                               history.getValue( entryIndex ).col( 0 ).template cast< double >( ) );
+    }
+}
+
+//! Function to write the entries of a propagation history that are final to an output sink, during the propagation
+/*!
+ *  Function to write the entries of a propagation history that are final to an output sink, during the propagation. All
+ *  entries that have not yet been written are passed to the sink, except the last one, since it may still be replaced
+ *  when propagating to an exact termination condition.
+ *  \param history History of which the entries are to be written (entries removed from memory if requested)
+ *  \param numberOfWrittenEntries Number of entries at the start of the history that have already been written (updated by
+ *  reference)
+ *  \param outputSink Sink to which the entries are to be written
+ *  \param isStateHistory Boolean denoting whether the history is a state history (if false: dependent variable history)
+ *  \param retainResultsInMemory Boolean denoting whether the written entries are to be kept in the history
+ */
+template< typename TimeType, typename ScalarType >
+void writeFinalizedHistoryEntriesToOutputSink(
+        utilities::ColumnarTimeHistory< TimeType, ScalarType >& history,
+        int& numberOfWrittenEntries,
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        const bool isStateHistory,
+        const bool retainResultsInMemory )
+{
+    for( int i = numberOfWrittenEntries; i < history.size( ) - 1; i++ )
+    {
+        addHistoryEntryToOutputSink( history, i, outputSink, isStateHistory );
+    }
+    numberOfWrittenEntries = std::max( numberOfWrittenEntries, history.size( ) - 1 );
+
+    if( !retainResultsInMemory )
+    {
+        history.eraseFront( numberOfWrittenEntries );
+        numberOfWrittenEntries = 0;
+    }
+}
+
+//! Function to write the remaining entries of a propagation history to an output sink, at the end of the propagation
+/*!
+ *  Function to write the remaining entries of a propagation history to an output sink, at the end of the propagation.
+ *  The entries are written in order of propagation, retaining only the last-added entry for duplicate times.
+ *  \param history History of which the entries are to be written
+ *  \param numberOfWrittenEntries Number of entries at the start of the history that have already been written
+ *  \param outputSink Sink to which the entries are to be written
+ *  \param isStateHistory Boolean denoting whether the history is a state history (if false: dependent variable history)
+ *  \param propagationDirection Direction of propagation (1 for forward, -1 for backward)
+ */
+template< typename TimeType, typename ScalarType >
+void writeRemainingHistoryEntriesToOutputSink(
+        const utilities::ColumnarTimeHistory< TimeType, ScalarType >& history,
+        const int numberOfWrittenEntries,
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        const bool isStateHistory,
+        const double propagationDirection )
+{
+    // Sort remaining entries in order of propagation, retaining order of addition for duplicates
+    std::vector< int > remainingIndices;
+    for( int i = numberOfWrittenEntries; i < history.size( ); i++ )
+    {
+        remainingIndices.push_back( i );
+    }
+    std::stable_sort( remainingIndices.begin( ), remainingIndices.end( ), [ & ]( const int index1, const int index2 )
+    {
+        return static_cast< double >( history.getTime( index2 ) - history.getTime( index1 ) ) * propagationDirection > 0.0;
+    } );
+
+    for( unsigned int i = 0; i < remainingIndices.size( ); i++ )
+    {
+        if( i < remainingIndices.size( ) - 1 && !( static_cast< double >(
+                    history.getTime( remainingIndices.at( i + 1 ) ) - history.getTime( remainingIndices.at( i ) ) ) *
+                                                  propagationDirection > 0.0 ) )
+        {
+            continue;
+        }
+        addHistoryEntryToOutputSink( history, remainingIndices.at( i ), outputSink, isStateHistory );
+    }
+}
+
+//! Function to remove all but the final entry (in the direction of propagation) from a time-sorted propagation history
+template< typename TimeType, typename ScalarType >
+void retainOnlyFinalHistoryEntry(
+        utilities::ColumnarTimeHistory< TimeType, ScalarType >& history,
+        const double propagationDirection )
+{
+    if( propagationDirection > 0.0 )
+    {
+        history.eraseFront( std::max( history.size( ) - 1, 0 ) );
+    }
+    else
+    {
+        while( history.size( ) > 1 )
+        {
+            history.popBack( );
+        }
+    }
+}
+
 //! Function to numerically integrate a given first order differential equation
 /*!
  *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
@@ -467,12 +711,28 @@ void integrateEquationsFromIntegrator(
 {
     int saveFrequency = 1;
 
-    // Define structures that will contain with numerical results
-    std::map< TimeType, StateType > solutionHistory;
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
-    std::map< TimeType, double > cumulativeComputationTimeHistory;
+    // Define structures that will contain with numerical results (in order of propagation, sorted by time at the end)
+    utilities::ColumnarTimeHistory< TimeType, typename StateType::Scalar > solutionHistory;
+    utilities::ColumnarTimeHistory< TimeType, double > dependentVariableHistory;
+    utilities::ColumnarTimeHistory< TimeType, double > cumulativeComputationTimeHistory;
     std::shared_ptr< PropagationTerminationDetails > terminationDetails;
 
+    // Retrieve object to which results are written during propagation (if any)
+    const std::shared_ptr< PropagationOutputSink > outputSink = processingSettings->getOutputSink( );
+    const bool retainResultsInMemory = ( outputSink == nullptr ) || processingSettings->getRetainResultsInMemory( );
+    if( !retainResultsInMemory && ( processingSettings->getSetIntegratedResult( ) ||
+                                    processingSettings->getCreateDependentVariablesInterface( ) ) )
+    {
+        throw std::runtime_error( "Error, propagation results are not retained in memory, but are required to set the "
+                                  "integrated result or create the dependent variables interface" );
+    }
+    int numberOfWrittenStateEntries = 0;
+    int numberOfWrittenDependentVariableEntries = 0;
+    if( outputSink != nullptr )
+    {
+        outputSink->startPropagation( );
+    }
+
     // Initialize timer.
     std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( );
 
@@ -485,26 +745,54 @@ void integrateEquationsFromIntegrator(
     StateType newState = integrator->getCurrentState( );
 
     // Add results at initial state
-    solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
-    dependentVariableHistory.clear( );
+    solutionHistory.pushBack( currentTime, newState );
     if( !( dependentVariableFunction == nullptr ) )
     {
         // If dependent variables are to be used, updated state derivative model and compute
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        dependentVariableHistory.pushBack( currentTime, dependentVariableFunction( ) );
     }
 
     // Add CPU time after first saving step
-    cumulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-    cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+    cumulativeComputationTimeHistory.pushBack( currentTime, currentCPUTime );
 
     // Set initial time step
     TimeStepType timeStep = integrator->getNextStepSize( );
     TimeType previousTime = currentTime;
 
+    // Retrieve epochs at which results are to be saved using dense output (if any), sorted in direction of propagation,
+    // and skipping those that are not after the initial epoch
+    const double propagationDirection = ( static_cast< double >( timeStep ) > 0.0 ) ? 1.0 : -1.0;
+    std::vector< TimeType > outputEpochs;
+    for( const double outputEpoch : processingSettings->getResultsOutputEpochs( ) )
+    {
+        if( static_cast< double >( static_cast< TimeType >( outputEpoch ) - initialTime ) * propagationDirection > 0.0 )
+        {
+            outputEpochs.push_back( static_cast< TimeType >( outputEpoch ) );
+        }
+    }
+    std::sort( outputEpochs.begin( ), outputEpochs.end( ), [ = ]( const TimeType& epoch1, const TimeType& epoch2 )
+    {
+        return static_cast< double >( epoch2 - epoch1 ) * propagationDirection > 0.0;
+    } );
+    const bool useDenseOutput = ( outputEpochs.size( ) > 0 );
+    unsigned int nextOutputEpochIndex = 0;
+    std::vector< TimeType > pendingOutputEpochs;
+    std::vector< StateType > pendingOutputStates;
+
+    // Function to save state and (if required) dependent variables at given epoch
+    auto saveStateAndDependentVariables = [ & ]( const TimeType saveEpoch, const StateType& stateToSave )
+    {
+        solutionHistory.pushBack( saveEpoch, stateToSave );
+        if( !( dependentVariableFunction == nullptr ) )
+        {
+            integrator->getStateDerivativeFunction( )( saveEpoch, stateToSave );
+            dependentVariableHistory.pushBack( saveEpoch, dependentVariableFunction( ) );
+        }
+    };
+
     // Initialize steps since last save (to output maps) and print (to terminal)
     int stepsSinceLastSave = 1;
     double timeOfLastSave = currentTime;
@@ -585,17 +873,32 @@ void integrateEquationsFromIntegrator(
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
 
-                // Save integration result in map
-                if( processingSettings->saveCurrentStep( stepsSinceLastSave, std::fabs(
-                        static_cast< double >( currentTime ) - timeOfLastSave ) ) )
+                // Compute states at output epochs in current step using dense output (saved after checking termination)
+                if( useDenseOutput )
                 {
-                    solutionHistory[ currentTime ] = newState;
+                    if( !integrator->isDenseOutputAvailable( ) )
+                    {
+                        throw std::runtime_error( "Error, results output epochs are provided, but the integrator does "
+                                                  "not provide dense output" );
+                    }
 
-                    if( !( dependentVariableFunction == nullptr ) )
+                    pendingOutputEpochs.clear( );
+                    pendingOutputStates.clear( );
+                    while( nextOutputEpochIndex < outputEpochs.size( ) &&
+                           static_cast< double >( outputEpochs.at( nextOutputEpochIndex ) - currentTime ) *
+                           propagationDirection <= 0.0 )
                     {
-                        integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        pendingOutputEpochs.push_back( outputEpochs.at( nextOutputEpochIndex ) );
+                        pendingOutputStates.push_back(
+                                    integrator->getDenseOutputState( outputEpochs.at( nextOutputEpochIndex ) ) );
+                        nextOutputEpochIndex++;
                     }
+                }
+                // Save integration result in map
+                else if( processingSettings->saveCurrentStep( stepsSinceLastSave, std::fabs(
+                        static_cast< double >( currentTime ) - timeOfLastSave ) ) )
+                {
+                    saveStateAndDependentVariables( currentTime, newState );
                     timeOfLastSave = currentTime;
                     stepsSinceLastSave = 0;
                 }
@@ -616,10 +919,16 @@ void integrateEquationsFromIntegrator(
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-            cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            cumulativeComputationTimeHistory.pushBack( currentTime, currentCPUTime );
 
             if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
             {
+                // When using dense output, always save final step, so that it can be replaced by exact final state
+                if( useDenseOutput && !breakPropagation )
+                {
+                    saveStateAndDependentVariables( currentTime, newState );
+                }
+
                 // Propagate to the exact termination conditions
                 if( propagationTerminationCondition->iterateToExactTermination( ) )
                 {
@@ -629,6 +938,20 @@ void integrateEquationsFromIntegrator(
                                 solutionHistory, dependentVariableHistory, currentCPUTime );
                 }
 
+                // Save dense output results of last step, up to final epoch
+                if( useDenseOutput )
+                {
+                    TimeType finalTime = solutionHistory.backTime( );
+                    for( unsigned int i = 0; i < pendingOutputEpochs.size( ); i++ )
+                    {
+                        if( static_cast< double >( pendingOutputEpochs.at( i ) - finalTime ) * propagationDirection < 0.0 )
+                        {
+                            saveStateAndDependentVariables( pendingOutputEpochs.at( i ), pendingOutputStates.at( i ) );
+                        }
+                    }
+                    pendingOutputEpochs.clear( );
+                }
+
                 // Set termination details
                 if( propagationTerminationCondition->getTerminationType( ) != hybrid_stopping_condition )
                 {
@@ -651,6 +974,29 @@ void integrateEquationsFromIntegrator(
 
                 breakPropagation = true;
             }
+            else if( useDenseOutput )
+            {
+                // Save dense output results of current step
+                for( unsigned int i = 0; i < pendingOutputEpochs.size( ); i++ )
+                {
+                    saveStateAndDependentVariables( pendingOutputEpochs.at( i ), pendingOutputStates.at( i ) );
+                }
+                pendingOutputEpochs.clear( );
+            }
+
+            // Write results that are final to output sink, removing them from memory if requested
+            if( outputSink != nullptr && !breakPropagation )
+            {
+                writeFinalizedHistoryEntriesToOutputSink(
+                            solutionHistory, numberOfWrittenStateEntries, outputSink, true, retainResultsInMemory );
+                writeFinalizedHistoryEntriesToOutputSink(
+                            dependentVariableHistory, numberOfWrittenDependentVariableEntries, outputSink, false,
+                            retainResultsInMemory );
+                if( !retainResultsInMemory )
+                {
+                    cumulativeComputationTimeHistory.eraseFront( cumulativeComputationTimeHistory.size( ) - 1 );
+                }
+            }
         }
         catch( const std::exception& caughtException )
         {
@@ -682,7 +1028,29 @@ void integrateEquationsFromIntegrator(
     }
 
 
-    simulationResults->reset( solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+    // Write remaining results to output sink
+    if( outputSink != nullptr )
+    {
+        writeRemainingHistoryEntriesToOutputSink(
+                    solutionHistory, numberOfWrittenStateEntries, outputSink, true, propagationDirection );
+        writeRemainingHistoryEntriesToOutputSink(
+                    dependentVariableHistory, numberOfWrittenDependentVariableEntries, outputSink, false,
+                    propagationDirection );
+        outputSink->finalizePropagation( );
+    }
+
+    // Sort results by time (reversing order for backward propagation), and set in results object
+    solutionHistory.sortByTime( );
+    dependentVariableHistory.sortByTime( );
+    cumulativeComputationTimeHistory.sortByTime( );
+    if( !retainResultsInMemory )
+    {
+        retainOnlyFinalHistoryEntry( solutionHistory, propagationDirection );
+        retainOnlyFinalHistoryEntry( dependentVariableHistory, propagationDirection );
+        retainOnlyFinalHistoryEntry( cumulativeComputationTimeHistory, propagationDirection );
+    }
+    simulationResults->reset( std::move( solutionHistory ), std::move( dependentVariableHistory ),
+                              std::move( cumulativeComputationTimeHistory ),
                               std::map<TimeType, unsigned int>( ), propagationTerminationReason );
 }
 
@@ -706,6 +1074,9 @@ void integrateEquationsFromIntegrator(
      *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param inPlaceStateDerivativeFunction Function writing the state derivative from current time and state into its
+     *  last argument. If provided, it is used by variable step-size Runge-Kutta integrators to evaluate the state
+     *  derivatives directly in their stage buffers (empty by default).
      *  \return Event that triggered the termination of the propagation
      */
     template< typename SimulationResults, typename StateType, typename TimeType = double >
@@ -718,7 +1089,9 @@ void integrateEquationsFromIntegrator(
             std::shared_ptr< SimulationResults > simulationResults,
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
-            const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings = std::make_shared< SingleArcPropagatorProcessingSettings >( ) )
+            const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings = std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+            const std::function< void( const TimeType, const StateType&, StateType& ) > inPlaceStateDerivativeFunction =
+            std::function< void( const TimeType, const StateType&, StateType& ) >( ) )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -728,6 +1101,19 @@ void integrateEquationsFromIntegrator(
                 numerical_integrators::createIntegrator< TimeType, StateType, typename scalar_type< TimeType >::value_type >(
                     stateDerivativeFunction, initialState, initialTime, integratorSettings );
 
+        // Let Runge-Kutta integrator evaluate state derivatives in its own buffers, if possible
+        if( inPlaceStateDerivativeFunction )
+        {
+            std::shared_ptr< numerical_integrators::RungeKuttaVariableStepSizeIntegrator<
+                    TimeType, StateType, StateType, typename scalar_type< TimeType >::value_type > > rungeKuttaIntegrator =
+                    std::dynamic_pointer_cast< numerical_integrators::RungeKuttaVariableStepSizeIntegrator<
+                    TimeType, StateType, StateType, typename scalar_type< TimeType >::value_type > >( integrator );
+            if( rungeKuttaIntegrator != nullptr )
+            {
+                rungeKuttaIntegrator->setInPlaceStateDerivativeFunction( inPlaceStateDerivativeFunction );
+            }
+        }
+
         if( integratorSettings->assessTerminationOnMinorSteps_ )
         {
             integrator->setPropagationTerminationFunction( stopPropagationFunction );
@@ -13,6 +13,7 @@
 
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
 #include "tudat/astro/basic_astro/keplerPropagator.h"
+#include "tudat/astro/basic_astro/batchKeplerPropagator.h"
 
 #include "tudat/math/root_finders/rootFinder.h"
 #include "tudat/astro/gravitation/centralGravityModel.h"
@@ -86,7 +87,7 @@ public:
                     centralBodyData->getCentralBodies( ), this->bodiesToBeIntegratedNumerically_,
                     this->accelerationModelsPerBody_, this->removedCentralAccelerations_ );
 
-        // Create root-finder for Kepler orbit propagation
+        // Create root-finder for Kepler orbit propagation (used if fixed-iteration solution does not converge)
         rootFinder_ = root_finders::createRootFinder< StateScalarType >(
                     root_finders::newtonRaphsonRootFinderSettings(
                         TUDAT_NAN, 5.0 * std::numeric_limits< StateScalarType >::epsilon( ),
@@ -236,10 +237,10 @@ private:
         // Propagate Kepler orbit to current time and set.
         currentKeplerianOrbitCartesianState_[ bodyIndex ] =
                 orbital_element_conversions::convertKeplerianToCartesianElements< StateScalarType >(
-                    orbital_element_conversions::propagateKeplerOrbit< StateScalarType >(
+                    orbital_element_conversions::propagateKeplerOrbitWithFixedIterations< StateScalarType >(
                         initialKeplerElements_.at( bodyIndex ), static_cast< StateScalarType >( time - initialTime_ ),
                         static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( bodyIndex )( ) ),
-                        rootFinder_ ),
+                        4, 10.0 * std::numeric_limits< StateScalarType >::epsilon( ), rootFinder_ ),
                     static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( bodyIndex )( ) ) );
     }
 
@@ -276,7 +277,7 @@ private:
     std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
     centralAccelerations_;
 
-    //! Root finder used to propagate Kepler orbit.
+    //! Root finder used to propagate Kepler orbit, if fixed-iteration solution of Kepler's equation does not converge.
     std::shared_ptr< root_finders::RootFinder< StateScalarType > > rootFinder_;
 
     //! Current Cartesian states of reference Kepler orbits, valid at currentKeplerOrbitTime_, computed by
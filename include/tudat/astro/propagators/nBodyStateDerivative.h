@@ -211,20 +211,55 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
-        for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+        if( modelEvaluationProfiler_ == nullptr )
         {
-            accelerationModelList_.at( i )->updateMembers( currentTime );
-        }
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+            {
+                accelerationModelList_.at( i )->updateMembers( currentTime );
+            }
 
-        for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
+            for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
+            {
+                if( removedCentralAccelerations_.count( updateRemovedAccelerations_.at( i  ) ) > 0 )
+                {
+                    removedCentralAccelerations_[ updateRemovedAccelerations_.at( i ) ]->updateMembers( currentTime );
+                }
+            }
+        }
+        else
         {
-            if( removedCentralAccelerations_.count( updateRemovedAccelerations_.at( i  ) ) > 0 )
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
             {
-                removedCentralAccelerations_[ updateRemovedAccelerations_.at( i ) ]->updateMembers( currentTime );
+                utilities::ScopedModelEvaluationTimer timer(
+                            modelEvaluationProfiler_.get( ), accelerationModelProfileIndices_.at( i ) );
+                accelerationModelList_.at( i )->updateMembers( currentTime );
+            }
+
+            for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
+            {
+                if( removedCentralAccelerations_.count( updateRemovedAccelerations_.at( i  ) ) > 0 )
+                {
+                    utilities::ScopedModelEvaluationTimer timer(
+                                modelEvaluationProfiler_.get( ), removedAccelerationProfileIndices_.at( i ) );
+                    removedCentralAccelerations_[ updateRemovedAccelerations_.at( i ) ]->updateMembers( currentTime );
+                }
             }
         }
     }
 
+    // Function to set the object recording the number of calls and clock time of the acceleration model updates.
+    /*
+     * Function to set the object recording the number of calls and clock time of the acceleration model updates
+     * (nullptr to disable profiling). Each acceleration model is registered in the category "acceleration".
+     * \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        registerProfiledAccelerationModels( );
+    }
+
     // Function to convert the propagator-specific form of the state to the conventional form in the global frame.
     /*
      * Function to convert the propagator-specific form of the state to the conventional form in the
@@ -370,6 +405,7 @@ public:
         if( removedCentralAccelerations_.count( bodyName ) > 0 )
         {
             updateRemovedAccelerations_.push_back( bodyName );
+            registerProfiledAccelerationModels( );
         }
     }
 
@@ -409,6 +445,7 @@ protected:
     {
         // Iterate over all accelerations and update their internal state.
         accelerationModelList_.clear( );
+        accelerationModelBodies_.clear( );
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
              outerAccelerationIterator != accelerationModelsPerBody_.end( ); outerAccelerationIterator++ )
         {
@@ -421,7 +458,47 @@ protected:
                 for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                 {
                     accelerationModelList_.push_back( innerAccelerationIterator->second.at( j ) );
+                    accelerationModelBodies_.push_back(
+                                std::make_pair( outerAccelerationIterator->first, innerAccelerationIterator->first ) );
+                }
+            }
+        }
+        registerProfiledAccelerationModels( );
+    }
+
+    // Function to register all acceleration models with the model evaluation profiler (if any).
+    void registerProfiledAccelerationModels( )
+    {
+        accelerationModelProfileIndices_.clear( );
+        removedAccelerationProfileIndices_.clear( );
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+            {
+                std::string accelerationName;
+                try
+                {
+                    accelerationName = basic_astrodynamics::getAccelerationModelName(
+                                basic_astrodynamics::getAccelerationModelType( accelerationModelList_.at( i ) ) );
                 }
+                catch( const std::runtime_error& )
+                {
+                    accelerationName = "unidentified acceleration ";
+                }
+                if( accelerationName.back( ) != ' ' )
+                {
+                    accelerationName += " ";
+                }
+                accelerationModelProfileIndices_.push_back(
+                            modelEvaluationProfiler_->registerModel(
+                                "acceleration", accelerationName + "of " + accelerationModelBodies_.at( i ).second +
+                                " on " + accelerationModelBodies_.at( i ).first ) );
+            }
+            for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
+            {
+                removedAccelerationProfileIndices_.push_back(
+                            modelEvaluationProfiler_->registerModel(
+                                "acceleration", "removed central gravity of " + updateRemovedAccelerations_.at( i ) ) );
             }
         }
     }
@@ -520,6 +597,18 @@ protected:
     // Vector of acceleration models, containing all entries of accelerationModelsPerBody_.
     std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > accelerationModelList_;
 
+    // Names of bodies undergoing and exerting each acceleration, in the same order as accelerationModelList_.
+    std::vector< std::pair< std::string, std::string > > accelerationModelBodies_;
+
+    // Object recording the number of calls and clock time of acceleration model updates (nullptr if not profiled).
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    // Indices of entries of accelerationModelList_ in modelEvaluationProfiler_.
+    std::vector< int > accelerationModelProfileIndices_;
+
+    // Indices of entries of updateRemovedAccelerations_ in modelEvaluationProfiler_.
+    std::vector< int > removedAccelerationProfileIndices_;
+
     // Object responsible for providing the current integration origins from the global origins.
     std::shared_ptr< CentralBodyData< StateScalarType, TimeType > > centralBodyData_;
 
@@ -12,9 +12,11 @@
 #define TUDAT_STATEDERIVATIVE_H
 
 #include <map>
+#include <memory>
 
 #include <Eigen/Core>
 
+#include "tudat/basics/modelEvaluationProfiler.h"
 #include "tudat/basics/timeType.h"
 #include <tudat/basics/utilityMacros.h>
 
@@ -38,6 +40,22 @@ enum IntegratedStateType
 
 std::string getIntegratedStateTypString( const IntegratedStateType stateType );
 
+// Enum listing levels of diagnostics that are recorded when computing the state derivative
+/*
+ *  Enum listing levels of diagnostics that are recorded when computing the state derivative (by the
+ *  DynamicsStateDerivativeModel::computeStateDerivative function):
+ *  - no_state_derivative_diagnostics: no diagnostics are recorded
+ *  - state_derivative_evaluation_counters: only the number of evaluations (and time of last evaluation) is recorded
+ *  - full_state_derivative_diagnostics: the number of evaluations is recorded for each evaluation time (requiring an
+ *    insertion in a map per evaluation), and the input state is checked for NaN/Inf entries upon each evaluation.
+ */
+enum StateDerivativeDiagnosticsLevel
+{
+    no_state_derivative_diagnostics = 0,
+    state_derivative_evaluation_counters = 1,
+    full_state_derivative_diagnostics = 2
+};
+
 // Get size of state for single propagated state of given type.
 /*
  * Get size of state for single propagated state of given type (i.e. 6 for translational state).
@@ -233,6 +251,18 @@ public:
         return false;
     }
 
+    // Function to set the object recording the number of calls and clock time of the models evaluated by this object.
+    /*
+     * Function to set the object recording the number of calls and clock time of the models evaluated by this object
+     * (nullptr to disable profiling). Default implementation is empty, i.e. the models are not profiled.
+     * \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    virtual void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        TUDAT_UNUSED_PARAMETER( modelEvaluationProfiler );
+    }
+
 protected:
 
     // Type of dynamics for which the state derivative is calculated.
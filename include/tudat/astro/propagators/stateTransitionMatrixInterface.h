@@ -142,10 +142,7 @@ public:
         stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
         sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator ),
         statePartialAdditionIndices_( statePartialAdditionIndices )
-    {
-        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
-                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
-    }
+    { }
 
     //! Destructor.
     ~SingleArcCombinedStateTransitionAndSensitivityMatrixInterface( ){ }
@@ -188,7 +185,8 @@ public:
 
     //! Function to get the concatenated state transition and sensitivity matrix at a given time.
     /*!
-     *  Function to get the concatenated state transition and sensitivity matrix at a given time.
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time. The matrix is
+     *  constructed without modifying this object, so that the function may be called concurrently.
      *  \param evaluationTime Time at which to evaluate matrix interpolators
      *  \return Concatenated state transition and sensitivity matrices.
      */
@@ -221,9 +219,6 @@ public:
 
 private:
 
-    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
-    Eigen::MatrixXd combinedStateTransitionMatrix_;
-
     //! Interpolator returning the state transition matrix as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     stateTransitionMatrixInterpolator_;
@@ -274,10 +274,13 @@ public:
 
         // Update all acceleration partials to current state and time. Information is passed indirectly from here, through
         // (function) pointers set in acceleration partial classes
+        int typeIndex = 0;
         for( stateDerivativeTypeIterator_ = stateDerivativePartialList_.begin( );
              stateDerivativeTypeIterator_ != stateDerivativePartialList_.end( );
-             stateDerivativeTypeIterator_++ )
+             stateDerivativeTypeIterator_++, typeIndex++ )
         {
+            utilities::ScopedModelEvaluationTimer timer(
+                        modelEvaluationProfiler_.get( ), getPartialsProfileIndex( typeIndex, false ) );
             for( unsigned int i = 0; i < stateDerivativeTypeIterator_->second.size( ); i++ )
             {
                 for( unsigned int j = 0; j < stateDerivativeTypeIterator_->second.at( i ).size( ); j++ )
@@ -288,10 +291,13 @@ public:
             }
         }
 
+        typeIndex = 0;
         for( stateDerivativeTypeIterator_ = stateDerivativePartialList_.begin( );
              stateDerivativeTypeIterator_ != stateDerivativePartialList_.end( );
-             stateDerivativeTypeIterator_++ )
+             stateDerivativeTypeIterator_++, typeIndex++ )
         {
+            utilities::ScopedModelEvaluationTimer timer(
+                        modelEvaluationProfiler_.get( ), getPartialsProfileIndex( typeIndex, true ) );
             for( unsigned int i = 0; i < stateDerivativeTypeIterator_->second.size( ); i++ )
             {
                 for( unsigned int j = 0; j < stateDerivativeTypeIterator_->second.at( i ).size( ); j++ )
@@ -323,6 +329,34 @@ public:
         couplingEntriesToSuppress_ = couplingEntriesToSuppress;
     }
 
+    //! Function to set the object recording the number of calls and clock time of the partial derivative updates
+    /*!
+     *  Function to set the object recording the number of calls and clock time of the partial derivative updates
+     *  (nullptr to disable profiling). The update of the state and parameter partials of each type of dynamics are
+     *  registered in the category "variational equations".
+     *  \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    void setModelEvaluationProfiler( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        partialsProfileIndices_.clear( );
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            for( auto partialsIterator : stateDerivativePartialList_ )
+            {
+                partialsProfileIndices_.push_back(
+                            modelEvaluationProfiler_->registerModel(
+                                "variational equations", getIntegratedStateTypString( partialsIterator.first ) + " state partials" ) );
+            }
+            for( auto partialsIterator : stateDerivativePartialList_ )
+            {
+                partialsProfileIndices_.push_back(
+                            modelEvaluationProfiler_->registerModel(
+                                "variational equations", getIntegratedStateTypString( partialsIterator.first ) + " parameter partials" ) );
+            }
+        }
+    }
+
 protected:
     
 private:
@@ -564,6 +598,23 @@ private:
     }
 
     
+    //! Function to retrieve the index in modelEvaluationProfiler_ of the (state or parameter) partials of a type of dynamics
+    /*!
+     *  Function to retrieve the index in modelEvaluationProfiler_ of the (state or parameter) partials of a type of
+     *  dynamics.
+     *  \param typeIndex Index of the type of dynamics in stateDerivativePartialList_
+     *  \param isParameterPartial Boolean denoting whether the index of the parameter (or state) partials is retrieved
+     *  \return Index in modelEvaluationProfiler_ (-1 if no profiler is set)
+     */
+    int getPartialsProfileIndex( const int typeIndex, const bool isParameterPartial )
+    {
+        if( modelEvaluationProfiler_ == nullptr )
+        {
+            return -1;
+        }
+        return partialsProfileIndices_.at( typeIndex + ( isParameterPartial ? stateDerivativePartialList_.size( ) : 0 ) );
+    }
+
     //! Map with list of StateDerivativePartialsMaps, with state type as key.
     /*!
      *  List partials of state derivative models from which the variational equations
@@ -643,6 +694,13 @@ private:
 
     //! Current states, in conventional representation (e.g. transformed from specific propagator) sorted per state type.
     std::unordered_map< IntegratedStateType, Eigen::VectorXd > currentStatesPerTypeInConventionalRepresentation_;
+
+    //! Object recording the number of calls and clock time of the partial derivative updates (nullptr if not profiled).
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    //! Indices in modelEvaluationProfiler_ of the state partial updates, followed by the parameter partial updates,
+    //! for each entry of stateDerivativePartialList_.
+    std::vector< int > partialsProfileIndices_;
 };
 
 
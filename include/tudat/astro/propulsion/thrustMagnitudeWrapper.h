@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <functional>
+#include <stdexcept>
 #include <boost/lambda/lambda.hpp>
 #include <iostream>
 
@@ -39,6 +40,18 @@ public:
     //! Destructor.
     virtual ~ThrustMagnitudeWrapper( ){ }
 
+    //! Function to create a copy of this object that can be updated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be updated concurrently with the original (e.g. in a propagation
+     *  in a different thread), with its own current thrust magnitude and specific impulse. Must be implemented in derived
+     *  classes that support this.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< ThrustMagnitudeWrapper > clone( ) const
+    {
+        throw std::runtime_error( "Error, cloning not supported for this type of thrust magnitude model" );
+    }
+
     //! Pure virtual function to update the thrust magnitude to the current time.
     /*!
      * Pure virtual function to update the thrust magnitude to the current time. Method of computation is to be
@@ -116,6 +129,12 @@ public:
     //! Destructor.
     ~ConstantThrustMagnitudeWrapper( ){ }
 
+    //! Function to create a copy of this object that can be updated concurrently with the original
+    std::shared_ptr< ThrustMagnitudeWrapper > clone( ) const
+    {
+        return std::make_shared< ConstantThrustMagnitudeWrapper >( *this );
+    }
+
     //! Function to update the thrust magnitude to the current time.
     /*!
      *  Function to update the thrust magnitude to the current time.
@@ -238,6 +257,13 @@ public:
     //! Destructor.
     ~CustomThrustMagnitudeWrapper( ){ }
 
+    //! Function to create a copy of this object that can be updated concurrently with the original (the custom thrust
+    //! magnitude and specific impulse functions are shared, and must be safe to call from multiple threads).
+    std::shared_ptr< ThrustMagnitudeWrapper > clone( ) const
+    {
+        return std::make_shared< CustomThrustMagnitudeWrapper >( *this );
+    }
+
     //! Function to update the thrust magnitude to the current time.
     /*!
      *  Function to update the thrust magnitude to the current time.
@@ -357,6 +383,13 @@ public:
 
     ~CustomThrustAccelerationMagnitudeWrapper( ){ }
 
+    //! Function to create a copy of this object that can be updated concurrently with the original (the custom thrust
+    //! acceleration and specific impulse functions are shared, and must be safe to call from multiple threads).
+    std::shared_ptr< ThrustMagnitudeWrapper > clone( ) const
+    {
+        return std::make_shared< CustomThrustAccelerationMagnitudeWrapper >( *this );
+    }
+
     void update( const double time );
 
     double getCurrentThrustForceMagnitude( const double currentMass )
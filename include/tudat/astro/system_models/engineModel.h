@@ -54,6 +54,20 @@ public:
     //! Destructor.
     virtual ~EngineModel( ){ }
 
+    //! Function to create a copy of this object that can be updated concurrently with the original
+    /*!
+     *  Function to create a copy of this object that can be updated concurrently with the original (e.g. in a propagation
+     *  in a different thread), using a copy of the thrust magnitude model. The body-fixed thrust direction function is
+     *  shared with the original, and must be safe to call from multiple threads.
+     *  \return Copy of this object
+     */
+    virtual std::shared_ptr< EngineModel > clone( ) const
+    {
+        std::shared_ptr< EngineModel > clonedEngineModel = std::make_shared< EngineModel >( *this );
+        clonedEngineModel->thrustMagnitudeWrapper_ = thrustMagnitudeWrapper_->clone( );
+        return clonedEngineModel;
+    }
+
 
     //! Pure virtual function to update the engine model to the current time
     /*!
@@ -44,6 +44,22 @@ public:
     //! Destructor
     ~VehicleSystems( ){ }
 
+    //! Function to create a copy of this object that can be updated concurrently with the original
+    /*!
+     * Function to create a copy of this object that can be updated concurrently with the original (e.g. in a propagation
+     * in a different thread), with its own control surface deflections and copies of all engine models.
+     * \return Copy of this object
+     */
+    std::shared_ptr< VehicleSystems > clone( ) const
+    {
+        std::shared_ptr< VehicleSystems > clonedSystems = std::make_shared< VehicleSystems >( *this );
+        for( const auto& engineIterator : engineModels_ )
+        {
+            clonedSystems->engineModels_[ engineIterator.first ] = engineIterator.second->clone( );
+        }
+        return clonedSystems;
+    }
+
     //! Function to retrieve the engine models
     /*!
      * Function to retrieve the engine models
@@ -0,0 +1,454 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COLUMNARTIMEHISTORY_H
+#define TUDAT_COLUMNARTIMEHISTORY_H
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Class to store a time history of equally sized matrices (or scalars) in contiguous memory.
+/*!
+ *  Class to store a time history of equally sized matrices (or scalars) in contiguous memory, as an alternative to a
+ *  std::map< TimeType, Eigen::Matrix<...> >, in which each entry is a separately allocated tree node that owns a
+ *  separately allocated matrix. Here, the times are stored in a single vector, and the entries are stored as the
+ *  columns of a single matrix (each entry flattened in column-major order), which grows geometrically as entries are
+ *  added. Entries are typically appended in order of propagation (which may be forward or backward in time), and
+ *  sorted in order of increasing time (removing duplicate times) by a single call to sortByTime once all entries are
+ *  added. Conversion to/from maps is provided for interfacing with existing code.
+ */
+template< typename TimeType, typename ScalarType >
+class ColumnarTimeHistory
+{
+public:
+
+    //! Typedef for a single (unflattened) entry of the history
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > EntryType;
+
+    //! Constructor
+    ColumnarTimeHistory( ):
+        entryRows_( 0 ), entryColumns_( 0 ), size_( 0 ){ }
+
+    //! Constructor from map
+    /*!
+     *  Constructor from map
+     *  \param history Map from which the history is to be created (time as key).
+     */
+    template< typename ValueType >
+    explicit ColumnarTimeHistory( const std::map< TimeType, ValueType >& history ):
+        entryRows_( 0 ), entryColumns_( 0 ), size_( 0 )
+    {
+        fromMap( history );
+    }
+
+    //! Function to reserve memory for a given number of entries
+    /*!
+     *  Function to reserve memory for a given number of entries. If the size of the entries is not yet known (no entries
+     *  added), only the memory for the times is reserved.
+     *  \param numberOfEntries Number of entries for which memory is to be reserved
+     */
+    void reserve( const int numberOfEntries )
+    {
+        times_.reserve( numberOfEntries );
+        if( entryRows_ * entryColumns_ > 0 && numberOfEntries > values_.cols( ) )
+        {
+            values_.conservativeResize( Eigen::NoChange, numberOfEntries );
+        }
+        requestedCapacity_ = std::max( requestedCapacity_, numberOfEntries );
+    }
+
+    //! Function to remove all entries (retaining allocated memory)
+    void clear( )
+    {
+        times_.clear( );
+        size_ = 0;
+    }
+
+    //! Function to retrieve the number of entries
+    int size( ) const
+    {
+        return size_;
+    }
+
+    //! Function to check whether there are no entries
+    bool empty( ) const
+    {
+        return size_ == 0;
+    }
+
+    //! Function to append an entry to the end of the history
+    /*!
+     *  Function to append an entry to the end of the history. All entries must be of equal size.
+     *  \param time Time of the entry
+     *  \param value Value of the entry
+     */
+    template< typename Derived >
+    void pushBack( const TimeType& time, const Eigen::MatrixBase< Derived >& value )
+    {
+        if( size_ == 0 && ( entryRows_ != value.rows( ) || entryColumns_ != value.cols( ) ) )
+        {
+            entryRows_ = static_cast< int >( value.rows( ) );
+            entryColumns_ = static_cast< int >( value.cols( ) );
+            values_.resize( entryRows_ * entryColumns_, std::max( requestedCapacity_, 1 ) );
+        }
+        else if( entryRows_ != value.rows( ) || entryColumns_ != value.cols( ) )
+        {
+            throw std::runtime_error( "Error when adding entry to columnar time history, entry size is inconsistent." );
+        }
+
+        growIfRequired( );
+        times_.push_back( time );
+        Eigen::Map< EntryType >( values_.col( size_ ).data( ), entryRows_, entryColumns_ ) = value.template cast< ScalarType >( );
+        size_++;
+    }
+
+    //! Function to append a scalar entry to the end of the history
+    /*!
+     *  Function to append a scalar entry to the end of the history.
+     *  \param time Time of the entry
+     *  \param value Value of the entry
+     */
+    void pushBack( const TimeType& time, const ScalarType value )
+    {
+        pushBack( time, Eigen::Matrix< ScalarType, 1, 1 >::Constant( value ) );
+    }
+
+    //! Function to remove the last entry from the history
+    void popBack( )
+    {
+        if( size_ == 0 )
+        {
+            throw std::runtime_error( "Error when removing entry from columnar time history, history is empty." );
+        }
+        times_.pop_back( );
+        size_--;
+    }
+
+    //! Function to remove a number of entries from the start of the history
+    /*!
+     *  Function to remove a number of entries from the start of the history (retaining allocated memory). The remaining
+     *  entries are moved to the start of the storage, so the cost scales with the number of remaining entries.
+     *  \param numberOfEntries Number of entries that are to be removed
+     */
+    void eraseFront( const int numberOfEntries )
+    {
+        if( numberOfEntries > size_ || numberOfEntries < 0 )
+        {
+            throw std::runtime_error( "Error when removing entries from columnar time history, history is too small." );
+        }
+        else if( numberOfEntries > 0 )
+        {
+            int numberOfRemainingEntries = size_ - numberOfEntries;
+            times_.erase( times_.begin( ), times_.begin( ) + numberOfEntries );
+            for( int i = 0; i < numberOfRemainingEntries; i++ )
+            {
+                values_.col( i ) = values_.col( i + numberOfEntries );
+            }
+            size_ = numberOfRemainingEntries;
+        }
+    }
+
+    //! Function to retrieve the time of a given entry
+    const TimeType& getTime( const int index ) const
+    {
+        return times_.at( index );
+    }
+
+    //! Function to retrieve the time of the first entry
+    const TimeType& frontTime( ) const
+    {
+        return times_.front( );
+    }
+
+    //! Function to retrieve the time of the last entry
+    const TimeType& backTime( ) const
+    {
+        return times_.back( );
+    }
+
+    //! Function to retrieve the value of a given entry (without copying)
+    Eigen::Map< const EntryType > getValue( const int index ) const
+    {
+        return Eigen::Map< const EntryType >( values_.col( index ).data( ), entryRows_, entryColumns_ );
+    }
+
+    //! Function to retrieve the value of the last entry (without copying)
+    Eigen::Map< const EntryType > backValue( ) const
+    {
+        return getValue( size_ - 1 );
+    }
+
+    //! Function to retrieve the times of all entries
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve all values, as a matrix with one (flattened) entry per column (without copying)
+    typename Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >::ConstColsBlockXpr getValues( ) const
+    {
+        return values_.leftCols( size_ );
+    }
+
+    //! Function to retrieve the number of rows of each entry
+    int getEntryRows( ) const
+    {
+        return entryRows_;
+    }
+
+    //! Function to retrieve the number of columns of each entry
+    int getEntryColumns( ) const
+    {
+        return entryColumns_;
+    }
+
+    //! Function to sort the entries in order of increasing time, retaining only the last-added entry for duplicate times
+    /*!
+     *  Function to sort the entries in order of increasing time. For duplicate times, only the entry that was added last
+     *  is retained (consistent with assigning values to a map). No data is moved if the entries are already strictly
+     *  increasing, and the entries are reversed in place if they are strictly decreasing (as for backward propagation).
+     */
+    void sortByTime( )
+    {
+        bool isIncreasing = true, isDecreasing = true;
+        for( int i = 1; i < size_; i++ )
+        {
+            if( !( times_[ i - 1 ] < times_[ i ] ) )
+            {
+                isIncreasing = false;
+            }
+            if( !( times_[ i ] < times_[ i - 1 ] ) )
+            {
+                isDecreasing = false;
+            }
+        }
+
+        if( isIncreasing )
+        {
+            return;
+        }
+        else if( isDecreasing )
+        {
+            std::reverse( times_.begin( ), times_.end( ) );
+            values_.leftCols( size_ ).rowwise( ).reverseInPlace( );
+        }
+        else
+        {
+            // Sort entry indices by time, retaining order of addition for duplicates
+            std::vector< int > sortedIndices( size_ );
+            std::iota( sortedIndices.begin( ), sortedIndices.end( ), 0 );
+            std::stable_sort( sortedIndices.begin( ), sortedIndices.end( ), [ & ]( const int index1, const int index2 )
+            {
+                return times_[ index1 ] < times_[ index2 ];
+            } );
+
+            // Copy entries in sorted order, skipping all but last of duplicate times
+            std::vector< TimeType > sortedTimes;
+            sortedTimes.reserve( size_ );
+            Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > sortedValues( values_.rows( ), values_.cols( ) );
+            for( int i = 0; i < size_; i++ )
+            {
+                if( i < size_ - 1 && !( times_[ sortedIndices[ i ] ] < times_[ sortedIndices[ i + 1 ] ] ) )
+                {
+                    continue;
+                }
+                sortedValues.col( sortedTimes.size( ) ) = values_.col( sortedIndices[ i ] );
+                sortedTimes.push_back( times_[ sortedIndices[ i ] ] );
+            }
+            times_.swap( sortedTimes );
+            values_.swap( sortedValues );
+            size_ = static_cast< int >( times_.size( ) );
+        }
+    }
+
+    //! Function to create a map from the history
+    /*!
+     *  Function to create a map from the history (time as key). If multiple entries have the same time, the last-added
+     *  entry is used.
+     *  \return Map created from the history.
+     */
+    template< typename ValueType >
+    std::map< TimeType, ValueType > toMap( ) const
+    {
+        std::map< TimeType, ValueType > history;
+        for( int i = 0; i < size_; i++ )
+        {
+            history[ times_[ i ] ] = convertEntry< ValueType >( i, std::is_arithmetic< ValueType >( ) );
+        }
+        return history;
+    }
+
+    //! Function to create a vector of all values
+    template< typename ValueType >
+    std::vector< ValueType > getValueVector( ) const
+    {
+        std::vector< ValueType > values;
+        values.reserve( size_ );
+        for( int i = 0; i < size_; i++ )
+        {
+            values.push_back( convertEntry< ValueType >( i, std::is_arithmetic< ValueType >( ) ) );
+        }
+        return values;
+    }
+
+    //! Function to (re)set the history from a map
+    /*!
+     *  Function to (re)set the history from a map, removing any existing entries.
+     *  \param history Map from which the history is to be created (time as key).
+     */
+    template< typename ValueType >
+    void fromMap( const std::map< TimeType, ValueType >& history )
+    {
+        clear( );
+        reserve( static_cast< int >( history.size( ) ) );
+        for( const auto& it : history )
+        {
+            pushBackEntry( it.first, it.second, std::is_arithmetic< ValueType >( ) );
+        }
+    }
+
+private:
+
+    //! Function to increase the capacity of the value matrix (geometrically) if it is full
+    void growIfRequired( )
+    {
+        if( size_ == values_.cols( ) )
+        {
+            values_.conservativeResize( Eigen::NoChange, std::max< Eigen::Index >( 2 * values_.cols( ), 1 ) );
+        }
+    }
+
+    //! Function to convert an entry to a scalar value
+    template< typename ValueType >
+    ValueType convertEntry( const int index, std::true_type ) const
+    {
+        return static_cast< ValueType >( values_( 0, index ) );
+    }
+
+    //! Function to convert an entry to an Eigen matrix value
+    template< typename ValueType >
+    ValueType convertEntry( const int index, std::false_type ) const
+    {
+        return ValueType( getValue( index ).template cast< typename ValueType::Scalar >( ) );
+    }
+
+    //! Function to add a scalar entry
+    template< typename ValueType >
+    void pushBackEntry( const TimeType& time, const ValueType& value, std::true_type )
+    {
+        pushBack( time, static_cast< ScalarType >( value ) );
+    }
+
+    //! Function to add an Eigen matrix entry
+    template< typename ValueType >
+    void pushBackEntry( const TimeType& time, const ValueType& value, std::false_type )
+    {
+        pushBack( time, value );
+    }
+
+    //! Times of the entries
+    std::vector< TimeType > times_;
+
+    //! Values of the entries, one (flattened) entry per column; number of columns is the allocated capacity
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > values_;
+
+    //! Number of rows of each entry
+    int entryRows_;
+
+    //! Number of columns of each entry
+    int entryColumns_;
+
+    //! Number of entries
+    int size_;
+
+    //! Number of entries for which memory is requested to be reserved
+    int requestedCapacity_ = 0;
+};
+
+//! Class that stores a columnar time history, and provides a map representation of it when requested
+/*!
+ *  Class that stores a columnar time history, and provides a map representation of it when requested, for interfacing
+ *  with code that requires a std::map. The map is created from the columnar history on each request (and not stored),
+ *  so that callers that retrieve it repeatedly should keep their own copy, or use the columnar history directly.
+ */
+template< typename TimeType, typename ScalarType, typename ValueType >
+class MapAdaptedColumnarTimeHistory
+{
+public:
+
+    //! Constructor
+    MapAdaptedColumnarTimeHistory( ){ }
+
+    //! Function to retrieve the columnar history
+    const ColumnarTimeHistory< TimeType, ScalarType >& getHistory( ) const
+    {
+        return history_;
+    }
+
+    //! Function to create the map representation of the history
+    std::map< TimeType, ValueType > getMap( ) const
+    {
+        return history_.template toMap< ValueType >( );
+    }
+
+    //! Function to reset the history
+    void setHistory( const ColumnarTimeHistory< TimeType, ScalarType >& history )
+    {
+        history_ = history;
+    }
+
+    //! Function to reset the history, moving the contents of the input
+    void setHistory( ColumnarTimeHistory< TimeType, ScalarType >&& history )
+    {
+        history_ = std::move( history );
+    }
+
+    //! Function to reset the history from a map
+    void setHistory( const std::map< TimeType, ValueType >& history )
+    {
+        history_.fromMap( history );
+    }
+
+    //! Function to remove all entries, and free the associated memory
+    void clear( )
+    {
+        history_ = ColumnarTimeHistory< TimeType, ScalarType >( );
+    }
+
+    //! Function to retrieve the number of entries
+    int size( ) const
+    {
+        return history_.size( );
+    }
+
+private:
+
+    //! Columnar history
+    ColumnarTimeHistory< TimeType, ScalarType > history_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_COLUMNARTIMEHISTORY_H
@@ -0,0 +1,190 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MODELEVALUATIONPROFILER_H
+#define TUDAT_MODELEVALUATIONPROFILER_H
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Number of calls and cumulative clock time of a single profiled model
+struct ModelEvaluationProfile
+{
+    ModelEvaluationProfile( const std::string& category, const std::string& modelName ):
+        category_( category ), modelName_( modelName ), numberOfCalls_( 0 ), totalEvaluationTime_( 0.0 ){ }
+
+    //! Category of the model (e.g. acceleration, environment update)
+    std::string category_;
+
+    //! Name of the model
+    std::string modelName_;
+
+    //! Number of times the model was evaluated
+    unsigned long long numberOfCalls_;
+
+    //! Cumulative clock time (in seconds) spent in evaluating the model
+    double totalEvaluationTime_;
+};
+
+//! Class to record the number of evaluations and cumulative clock time of the models evaluated during a propagation
+/*!
+ *  Class to record the number of evaluations and cumulative clock time of the models evaluated during a propagation
+ *  (acceleration models, environment updates, variational equations, observation models). Each model is registered
+ *  once (by category and name), after which the index that is returned by registerModel is used to add evaluations.
+ *  Models that have no profiler set (the default) do not evaluate the clock, and are not affected by this class.
+ */
+class ModelEvaluationProfiler
+{
+public:
+
+    //! Constructor
+    ModelEvaluationProfiler( ){ }
+
+    //! Function to register a model, and retrieve the index by which its evaluations are to be added
+    /*!
+     *  Function to register a model, and retrieve the index by which its evaluations are to be added. If a model with
+     *  the same category and name is already registered, the index of the existing model is returned, so that the
+     *  evaluations of both are combined.
+     *  \param category Category of the model (e.g. acceleration, environment update)
+     *  \param modelName Name of the model
+     *  \return Index of the model in the list of profiles
+     */
+    int registerModel( const std::string& category, const std::string& modelName );
+
+    //! Function to add a single evaluation (or a batch of evaluations) of a model
+    /*!
+     *  Function to add a single evaluation (or a batch of evaluations) of a model
+     *  \param modelIndex Index of the model, as returned by registerModel
+     *  \param evaluationTime Clock time (in seconds) spent in the evaluation(s)
+     *  \param numberOfEvaluations Number of evaluations performed in the given clock time
+     */
+    void addEvaluation( const int modelIndex, const double evaluationTime, const int numberOfEvaluations = 1 )
+    {
+        profiles_[ modelIndex ].numberOfCalls_ += numberOfEvaluations;
+        profiles_[ modelIndex ].totalEvaluationTime_ += evaluationTime;
+    }
+
+    //! Function to retrieve the profiles of all registered models, in order of registration
+    const std::vector< ModelEvaluationProfile >& getProfiles( ) const
+    {
+        return profiles_;
+    }
+
+    //! Function to retrieve the profile of a single model
+    /*!
+     *  Function to retrieve the profile of a single model. An exception is thrown if the model is not registered.
+     *  \param category Category of the model
+     *  \param modelName Name of the model
+     *  \return Profile of the requested model
+     */
+    const ModelEvaluationProfile& getProfile( const std::string& category, const std::string& modelName ) const;
+
+    //! Function to retrieve the profiles of all registered models in a given category
+    std::vector< ModelEvaluationProfile > getProfilesOfCategory( const std::string& category ) const;
+
+    //! Function to retrieve the total clock time (in seconds) spent in all models of a given category
+    double getTotalEvaluationTimeOfCategory( const std::string& category ) const;
+
+    //! Function to reset the number of calls and cumulative time of all registered models to zero
+    void resetProfiles( );
+
+    //! Function to print the profiles as a table, sorted by decreasing cumulative evaluation time
+    /*!
+     *  Function to print the profiles as a table, sorted by decreasing cumulative evaluation time, with for each model
+     *  the category, name, number of calls, cumulative time, time per call and fraction of total profiled time.
+     *  \param outputStream Stream to which the table is written
+     */
+    void printProfileTable( std::ostream& outputStream = std::cout ) const;
+
+    //! Function to write the profiles as delimited text (with header line), in order of registration
+    /*!
+     *  Function to write the profiles as delimited text (with header line), in order of registration, with for each
+     *  model the category, name, number of calls and cumulative time (in seconds).
+     *  \param outputStream Stream to which the table is written
+     *  \param delimiter Delimiter between columns
+     */
+    void writeProfileTable( std::ostream& outputStream, const std::string& delimiter = "," ) const;
+
+private:
+
+    //! Profiles of all registered models, in order of registration
+    std::vector< ModelEvaluationProfile > profiles_;
+
+    //! Indices in profiles_ of all registered models, with category and name as key
+    std::map< std::pair< std::string, std::string >, int > profileIndices_;
+};
+
+//! Class that adds the clock time of its own lifetime as a model evaluation to a profiler (if the profiler is set)
+/*!
+ *  Class that adds the clock time of its own lifetime as a model evaluation to a profiler. If the profiler is a
+ *  nullptr, the clock is not evaluated, and the object has no effect.
+ */
+class ScopedModelEvaluationTimer
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param profiler Profiler to which the evaluation is added (may be nullptr)
+     *  \param modelIndex Index of the model in the profiler
+     *  \param numberOfEvaluations Number of evaluations performed during the lifetime of this object
+     */
+    ScopedModelEvaluationTimer( ModelEvaluationProfiler* profiler, const int modelIndex,
+                                const int numberOfEvaluations = 1 ):
+        profiler_( profiler ), modelIndex_( modelIndex ), numberOfEvaluations_( numberOfEvaluations )
+    {
+        if( profiler_ != nullptr )
+        {
+            startTime_ = std::chrono::steady_clock::now( );
+        }
+    }
+
+    //! Destructor, adds evaluation to profiler
+    ~ScopedModelEvaluationTimer( )
+    {
+        if( profiler_ != nullptr )
+        {
+            profiler_->addEvaluation(
+                        modelIndex_, std::chrono::duration_cast< std::chrono::nanoseconds >(
+                            std::chrono::steady_clock::now( ) - startTime_ ).count( ) * 1.0E-9, numberOfEvaluations_ );
+        }
+    }
+
+private:
+
+    //! Profiler to which the evaluation is added
+    ModelEvaluationProfiler* profiler_;
+
+    //! Index of the model in the profiler
+    int modelIndex_;
+
+    //! Number of evaluations performed during the lifetime of this object
+    int numberOfEvaluations_;
+
+    //! Clock time at creation of this object
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_MODELEVALUATIONPROFILER_H
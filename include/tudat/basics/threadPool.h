@@ -0,0 +1,119 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_THREADPOOL_H
+#define TUDAT_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Pool of persistent threads, used to repeatedly evaluate a set of independent tasks in parallel
+/*!
+ *  Pool of persistent threads, used to repeatedly evaluate a set of independent tasks in parallel (e.g. once per state
+ *  derivative evaluation), without the cost of starting new threads for each evaluation. The worker threads are started
+ *  on construction and wait for tasks until the pool is destroyed. The thread calling runTasks also evaluates tasks, so
+ *  that a pool with N threads starts N - 1 worker threads. Calls to runTasks from different threads are serialized.
+ */
+class ThreadPool
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, starts the worker threads.
+     *  \param numberOfThreads Total number of threads that evaluate tasks, including the thread calling runTasks
+     *  (values smaller than 2 denote serial evaluation, in which no worker threads are started)
+     */
+    explicit ThreadPool( const int numberOfThreads );
+
+    //! Destructor, stops and joins the worker threads.
+    ~ThreadPool( );
+
+    ThreadPool( const ThreadPool& ) = delete;
+
+    ThreadPool& operator=( const ThreadPool& ) = delete;
+
+    //! Function to retrieve the total number of threads that evaluate tasks (including the calling thread)
+    int getNumberOfThreads( ) const
+    {
+        return static_cast< int >( workerThreads_.size( ) ) + 1;
+    }
+
+    //! Function to evaluate a set of tasks, distributed over the threads of the pool
+    /*!
+     *  Function to evaluate taskFunction( taskIndex ) for each taskIndex in [0, numberOfTasks), distributed over the
+     *  threads of the pool. The function returns once all tasks are evaluated. An exception thrown by any of the tasks
+     *  is rethrown in the calling thread (after all tasks have finished).
+     *  \param numberOfTasks Number of tasks that are to be evaluated
+     *  \param taskFunction Function that is to be evaluated for each task index
+     */
+    void runTasks( const int numberOfTasks, const std::function< void( const int ) >& taskFunction );
+
+private:
+
+    //! Function run by each worker thread, waiting for and evaluating tasks until the pool is destroyed
+    void runWorker( );
+
+    //! Function to evaluate tasks of the current set until none are left, recording the first exception
+    void evaluateAvailableTasks( );
+
+    //! Worker threads
+    std::vector< std::thread > workerThreads_;
+
+    //! Mutex serializing calls to runTasks
+    std::mutex runMutex_;
+
+    //! Mutex protecting the task set, and the waiting of worker and calling threads
+    std::mutex taskMutex_;
+
+    //! Condition variable notifying worker threads of a new task set (or destruction of the pool)
+    std::condition_variable taskAvailableCondition_;
+
+    //! Condition variable notifying the calling thread that all worker threads have finished the current task set
+    std::condition_variable tasksFinishedCondition_;
+
+    //! Function evaluated for the current task set
+    const std::function< void( const int ) >* currentTaskFunction_ = nullptr;
+
+    //! Number of tasks in the current task set
+    int numberOfTasks_ = 0;
+
+    //! Index of next task of the current set that is to be evaluated
+    std::atomic< int > nextTaskIndex_;
+
+    //! Index of current task set, incremented for each call to runTasks
+    unsigned long long taskSetIndex_ = 0;
+
+    //! Number of worker threads that are still evaluating tasks of the current set
+    int numberOfActiveWorkers_ = 0;
+
+    //! First exception thrown by a task of the current set
+    std::exception_ptr taskException_;
+
+    //! Boolean denoting whether the worker threads are to be stopped
+    bool stopWorkers_ = false;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_THREADPOOL_H
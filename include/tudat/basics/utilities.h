@@ -11,7 +11,10 @@
 #ifndef TUDAT_UTILITIES_H
 #define TUDAT_UTILITIES_H
 
+#include <algorithm>
+#include <exception>
 #include <map>
+#include <thread>
 #include <vector>
 #include <iostream>
 #include <stdexcept>
@@ -22,6 +25,8 @@
 
 #include <Eigen/Core>
 
+#include "tudat/basics/threadPool.h"
+
 namespace tudat
 {
 
@@ -816,8 +821,89 @@ std::vector< A > getFirstTupleEntryVector( const std::vector< std::tuple< A, Arg
     return vectorOfFirstEntries;
 }
 
+//! Function to evaluate a function for contiguous blocks of an index range, distributing the blocks over threads.
+/*!
+ *  Function to evaluate a function for contiguous blocks of an index range, distributing the blocks over threads. The
+ *  range [0, numberOfIterations) is split into (at most) numberOfThreads blocks of (nearly) equal size, and the
+ *  rangeFunction is called as rangeFunction( startIndex, endIndex, blockIndex ) for each block, with endIndex exclusive.
+ *  The blocks are always split in the same manner for a given number of iterations and threads, so that results
+ *  that are combined per block (in order of blockIndex) are reproducible. If only a single block is used, the function is
+ *  evaluated in the calling thread. An exception thrown during the evaluation of any of the blocks is rethrown in the
+ *  calling thread, after all threads have finished. If a threadPool is provided, the blocks are evaluated by its
+ *  (persistent) threads. Otherwise, a new thread is started for each block, so that callers that evaluate this function
+ *  often (e.g. for each state derivative evaluation) should provide a thread pool. In either case, a
+ *  minimumIterationsPerBlock should be provided for which the work per block outweighs the cost of distributing it over
+ *  threads; smaller ranges are evaluated serially.
+ *  \param numberOfIterations Size of index range that is to be evaluated
+ *  \param numberOfThreads Maximum number of threads that are to be used (values smaller than 2 denote serial evaluation)
+ *  \param rangeFunction Function that is to be evaluated for each block of indices
+ *  \param minimumIterationsPerBlock Minimum number of iterations per block, used to limit the number of blocks (and
+ *  threads) for small index ranges
+ *  \param threadPool Pool of threads by which the blocks are evaluated (nullptr if a thread is to be started per block)
+ *  \return Number of blocks into which the index range was split
+ */
+template< typename RangeFunction >
+int parallelForEachBlock( const int numberOfIterations, const int numberOfThreads, const RangeFunction& rangeFunction,
+                          const int minimumIterationsPerBlock = 1, ThreadPool* threadPool = nullptr )
+{
+    int numberOfBlocks = std::max(
+                1, std::min( numberOfThreads, numberOfIterations / std::max( 1, minimumIterationsPerBlock ) ) );
+    if( numberOfBlocks == 1 )
+    {
+        rangeFunction( 0, numberOfIterations, 0 );
+    }
+    else if( threadPool != nullptr )
+    {
+        threadPool->runTasks( numberOfBlocks, [ & ]( const int i )
+        {
+            rangeFunction( static_cast< int >( ( static_cast< long long >( numberOfIterations ) * i ) / numberOfBlocks ),
+                           static_cast< int >( ( static_cast< long long >( numberOfIterations ) * ( i + 1 ) ) / numberOfBlocks ),
+                           i );
+        } );
+    }
+    else
+    {
+        std::vector< std::exception_ptr > blockExceptions( numberOfBlocks );
+        std::vector< std::thread > blockThreads;
+        blockThreads.reserve( numberOfBlocks );
+
+        for( int i = 0; i < numberOfBlocks; i++ )
+        {
+            int startIndex = static_cast< int >( ( static_cast< long long >( numberOfIterations ) * i ) / numberOfBlocks );
+            int endIndex = static_cast< int >( ( static_cast< long long >( numberOfIterations ) * ( i + 1 ) ) / numberOfBlocks );
+            blockThreads.push_back( std::thread(
+                                        [ &rangeFunction, &blockExceptions, startIndex, endIndex, i ]( )
+            {
+                try
+                {
+                    rangeFunction( startIndex, endIndex, i );
+                }
+                catch( ... )
+                {
+                    blockExceptions[ i ] = std::current_exception( );
+                }
+            } ) );
+        }
+
+        for( unsigned int i = 0; i < blockThreads.size( ); i++ )
+        {
+            blockThreads.at( i ).join( );
+        }
+
+        for( unsigned int i = 0; i < blockExceptions.size( ); i++ )
+        {
+            if( blockExceptions.at( i ) != nullptr )
+            {
+                std::rethrow_exception( blockExceptions.at( i ) );
+            }
+        }
+    }
+    return numberOfBlocks;
+}
+
 } // namespace utilities
 
+
 } // namespace tudat
 
 #endif // TUDAT_UTILITIES_H
@@ -44,6 +44,13 @@ public:
     //! @get_docstring(SpiceEphemeris.get_cartesian_state)
     Eigen::Vector6d getCartesianState(const double secondsSinceEpoch );
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original (calls into spice are
+    //! serialized)
+    std::shared_ptr< Ephemeris > clone( ) const
+    {
+        return std::make_shared< SpiceEphemeris >( *this );
+    }
+
 private:
 
     //! Name of body of which ephemeris is to be determined
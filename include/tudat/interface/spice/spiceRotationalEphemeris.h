@@ -55,6 +55,13 @@ public:
      */
     ~SpiceRotationalEphemeris( ){ }
 
+    //! Function to create a copy of this object that can be evaluated concurrently with the original (calls into spice are
+    //! serialized)
+    std::shared_ptr< RotationalEphemeris > clone( ) const
+    {
+        return std::make_shared< SpiceRotationalEphemeris >( *this );
+    }
+
     //! Function to calculate the rotation quaternion from target frame to original frame.
     /*!
      *  Function to calculate the rotation quaternion from target frame to original frame at
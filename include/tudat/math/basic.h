@@ -13,6 +13,7 @@
 
 #include "basic/basicFunction.h"
 #include "basic/basicMathematicsFunctions.h"
+#include "basic/blockArrowheadNormalEquations.h"
 #include "basic/convergenceException.h"
 #include "basic/coordinateConversions.h"
 #include "basic/function.h"
@@ -0,0 +1,244 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BLOCKARROWHEADNORMALEQUATIONS_H
+#define TUDAT_BLOCKARROWHEADNORMALEQUATIONS_H
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Cholesky>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Class to accumulate and solve normal equations with a block-arrowhead structure.
+/*!
+ *  Class to accumulate and solve normal equations with a block-arrowhead structure, as obtained in multi-arc estimation.
+ *  The parameter vector is split into a number of blocks of local parameters (e.g. the initial state and observation
+ *  biases of a single arc), and a set of global parameters (all parameters not in any local block). Each block of
+ *  observations may depend on the local parameters of at most one block, and on any of the global parameters, so that
+ *  the normal matrix has no entries coupling the local parameters of different blocks. Only the non-zero blocks of the
+ *  normal matrix are stored: for each local block, its own diagonal block and its coupling to the global parameters, and
+ *  the diagonal block of the global parameters. The storage is therefore linear in the number of local blocks.
+ *
+ *  The normal equations are solved by eliminating the local parameters of each block by a Schur complement, solving the
+ *  resulting (reduced) system for the global parameters, and back-substituting the global solution into each local
+ *  block, so that the computational cost is also linear in the number of local blocks.
+ */
+class BlockArrowheadNormalEquations
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfParameters Total number of parameters
+     *  \param localParameterIndices List of blocks of local parameters, with each entry containing the indices (in the
+     *  full parameter vector) of the parameters in that block. A parameter may be in at most one block.
+     */
+    BlockArrowheadNormalEquations( const int numberOfParameters,
+                                   const std::vector< std::vector< int > >& localParameterIndices );
+
+    //! Function to add the contribution of a block of observations to the normal equations
+    /*!
+     *  Function to add the contribution of a block of observations to the normal equations, in the same manner as
+     *  addObservationBlockToNormalEquations. The local block on which the observations depend is determined from the
+     *  non-zero columns of the design matrix block. An exception is thrown if the observations depend on the parameters of
+     *  more than one local block. Only the lower triangles of the diagonal blocks are updated, symmetrize must be called
+     *  once all observations have been added.
+     *  \param designMatrixBlock Partials of the observations in the block w.r.t. all parameters
+     *  \param observationResidualsBlock Residuals of the observations in the block
+     *  \param diagonalOfWeightMatrixBlock Diagonal of the weight matrix of the observations in the block
+     *  \param updateNormalMatrix Boolean denoting whether the normal matrix is to be updated (if false, only the
+     *  righthandside is updated, which may be used to apply a correction to the residuals)
+     */
+    void addObservationBlock( const Eigen::MatrixXd& designMatrixBlock,
+                              const Eigen::VectorXd& observationResidualsBlock,
+                              const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+                              const bool updateNormalMatrix = true );
+
+    //! Function to set the upper triangles of the diagonal blocks of the normal matrix from their lower triangles
+    void symmetrize( );
+
+    //! Function to scale the normal equations by a column normalization of the design matrix
+    /*!
+     *  Function to scale the normal equations by a column normalization of the design matrix, so that entry (i,j) of the
+     *  normal matrix is divided by normalizationTerms(i) * normalizationTerms(j) and entry i of the righthandside by
+     *  normalizationTerms(i).
+     *  \param normalizationTerms Values by which the columns of the design matrix are normalized
+     */
+    void normalize( const Eigen::VectorXd& normalizationTerms );
+
+    //! Function to add a priori information to the normal equations
+    /*!
+     *  Function to add a priori information to the normal equations. Only the entries of the inverse a priori covariance
+     *  that are in the stored blocks of the normal matrix are read, so that the cost is linear in the number of local
+     *  blocks. Entries coupling the local parameters of different blocks must be zero, and are ignored.
+     *  \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+     */
+    void addInverseAprioriCovariance( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix );
+
+    //! Function to solve the normal equations by Schur complement reduction of the local parameters
+    /*!
+     *  Function to solve the normal equations by Schur complement reduction of the local parameters. The diagonal block of
+     *  each set of local parameters is decomposed with an LDLT decomposition (an exception is thrown if it is not positive
+     *  definite), and the reduced system of the global parameters is solved with solveSystemOfEquationsWithCholesky.
+     *  \param checkConditionNumber Boolean to denote whether the condition number of the reduced system is checked
+     *  \param maximumAllowedConditionNumber Maximum value of the condition number of the reduced system that is allowed
+     *  \param useSvdForIllConditionedSystem Boolean to denote whether the reduced system is to be solved using an SVD if
+     *  it is not positive definite, or is ill-conditioned
+     *  \return Solution of the normal equations, for the full parameter vector
+     */
+    Eigen::VectorXd solve( const bool checkConditionNumber = 1,
+                           const double maximumAllowedConditionNumber = 1.0E8,
+                           const bool useSvdForIllConditionedSystem = 0 ) const;
+
+    //! Function to compute the blocks of the inverse of the normal matrix
+    /*!
+     *  Function to compute the blocks of the inverse of the normal matrix (i.e. the covariance matrix, if a priori
+     *  information has been added) that correspond to the stored blocks of the normal matrix: the diagonal block of the
+     *  local parameters of each block, their coupling to the global parameters, and the diagonal block of the global
+     *  parameters. The blocks coupling the local parameters of different blocks, which are in general non-zero, are not
+     *  computed, so that the cost and size of the output are linear in the number of local blocks.
+     *  \param localCovarianceMatrices Diagonal blocks of the inverse normal matrix of the local parameters of each block
+     *  (returned by reference)
+     *  \param localGlobalCovarianceMatrices Blocks of the inverse normal matrix coupling the local parameters of each block
+     *  (rows) to the global parameters (columns) (returned by reference)
+     *  \param globalCovarianceMatrix Diagonal block of the inverse normal matrix of the global parameters (returned by
+     *  reference)
+     */
+    void getCovarianceBlocks( std::vector< Eigen::MatrixXd >& localCovarianceMatrices,
+                              std::vector< Eigen::MatrixXd >& localGlobalCovarianceMatrices,
+                              Eigen::MatrixXd& globalCovarianceMatrix ) const;
+
+    //! Function to retrieve the diagonal of the inverse of the normal matrix
+    /*!
+     *  Function to retrieve the diagonal of the inverse of the normal matrix, computed from the blocks given by
+     *  getCovarianceBlocks.
+     *  \return Diagonal of the inverse of the normal matrix, for the full parameter vector
+     */
+    Eigen::VectorXd getCovarianceDiagonal( ) const;
+
+    //! Function to retrieve the full normal matrix
+    /*!
+     *  Function to retrieve the full normal matrix, including the (zero) entries coupling different local blocks. Note
+     *  that the size of this matrix is quadratic in the number of local blocks.
+     *  \return Full normal matrix
+     */
+    Eigen::MatrixXd getFullNormalMatrix( ) const;
+
+    //! Function to retrieve the full righthandside of the normal equations
+    /*!
+     *  Function to retrieve the full righthandside of the normal equations.
+     *  \return Full righthandside of the normal equations
+     */
+    Eigen::VectorXd getFullRightHandSide( ) const;
+
+    //! Function to retrieve the number of blocks of local parameters
+    int getNumberOfLocalBlocks( ) const
+    {
+        return static_cast< int >( localParameterIndices_.size( ) );
+    }
+
+    //! Function to retrieve the indices of the global parameters
+    std::vector< int > getGlobalParameterIndices( ) const
+    {
+        return globalParameterIndices_;
+    }
+
+    //! Function to retrieve the total number of parameters
+    int getNumberOfParameters( ) const
+    {
+        return numberOfParameters_;
+    }
+
+private:
+
+    //! Function to eliminate the local parameters from the normal matrix of the global parameters
+    /*!
+     *  Function to eliminate the local parameters from the normal matrix of the global parameters, by a Schur complement.
+     *  The diagonal block of each set of local parameters is decomposed with an LDLT decomposition (an exception is thrown
+     *  if it is not positive definite).
+     *  \param localDecompositions Decompositions of the diagonal blocks of the local parameters (returned by reference)
+     *  \param reducedLocalGlobalMatrices Product of the inverse of the diagonal block and the local-global block of each
+     *  set of local parameters (returned by reference)
+     *  \return Reduced (symmetrized) normal matrix of the global parameters
+     */
+    Eigen::MatrixXd reduceLocalParameters(
+            std::vector< Eigen::LDLT< Eigen::MatrixXd > >& localDecompositions,
+            std::vector< Eigen::MatrixXd >& reducedLocalGlobalMatrices ) const;
+
+    //! Total number of parameters
+    int numberOfParameters_;
+
+    //! Indices (in full parameter vector) of the parameters in each local block
+    std::vector< std::vector< int > > localParameterIndices_;
+
+    //! Indices (in full parameter vector) of the global parameters
+    std::vector< int > globalParameterIndices_;
+
+    //! Index of local block of each parameter (-1 for global parameters)
+    std::vector< int > parameterBlockIndices_;
+
+    //! Index of each parameter in its local block, or in the list of global parameters
+    std::vector< int > parameterIndicesInBlock_;
+
+    //! Diagonal blocks of the normal matrix of the local parameters of each block
+    std::vector< Eigen::MatrixXd > localNormalMatrices_;
+
+    //! Blocks of the normal matrix coupling the local parameters of each block (rows) to the global parameters (columns)
+    std::vector< Eigen::MatrixXd > localGlobalNormalMatrices_;
+
+    //! Righthandside of the normal equations of the local parameters of each block
+    std::vector< Eigen::VectorXd > localRightHandSides_;
+
+    //! Diagonal block of the normal matrix of the global parameters
+    Eigen::MatrixXd globalNormalMatrix_;
+
+    //! Righthandside of the normal equations of the global parameters
+    Eigen::VectorXd globalRightHandSide_;
+
+};
+
+//! Function to perform an iteration of least squares estimation from (accumulated) block-arrowhead normal equations
+/*!
+ *  Function to perform an iteration of least squares estimation from (accumulated) block-arrowhead normal equations, in
+ *  the same manner as performLeastSquaresAdjustmentFromNormalEquations, but solving the normal equations by Schur
+ *  complement reduction of the local parameters (see BlockArrowheadNormalEquations::solve). The inverse covariance is
+ *  returned in block form, from which the full matrix can be retrieved with BlockArrowheadNormalEquations::getFullNormalMatrix
+ *  if required.
+ *  \param normalEquations Normal equations H^T*W*H and H^T*W*y (with symmetrized normal matrix)
+ *  \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (see
+ *  BlockArrowheadNormalEquations::addInverseAprioriCovariance), or an empty matrix if no a priori information is used
+ *  \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ *  when value exceeds maximumAllowedConditionNumber)
+ *  \param maximumAllowedConditionNumber Maximum value of the condition number of the reduced system that is allowed
+ *  \param useSvdForIllConditionedSystem Boolean to denote whether the reduced system is to be solved using an SVD if it is
+ *  not positive definite, or is ill-conditioned
+ *  \return Pair containing: (first: parameter adjustment, second: inverse covariance, in block form)
+ */
+std::pair< Eigen::VectorXd, BlockArrowheadNormalEquations > performLeastSquaresAdjustmentFromBlockArrowheadNormalEquations(
+        BlockArrowheadNormalEquations normalEquations,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix = Eigen::MatrixXd::Zero( 0, 0 ),
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const bool useSvdForIllConditionedSystem = 0 );
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_BLOCKARROWHEADNORMALEQUATIONS_H
@@ -18,6 +18,7 @@
 #include <map>
 
 #include <Eigen/Core>
+#include <Eigen/Cholesky>
 #include <Eigen/SVD>
 
 #include <boost/function.hpp>
@@ -61,6 +62,79 @@ Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInv
                                                const bool checkConditionNumber = 1,
                                                const double maximumAllowedConditionNumber = 1.0E-8 );
 
+//! Solve symmetric system of equations with (pivoted) LDLT decomposition, checking condition number in the process
+/*!
+ * Solve symmetric system of equations with (pivoted) Cholesky LDLT decomposition, checking condition number in the process.
+ * This function solves A*x = b for the vector x, where A is symmetric positive (semi-)definite, such as the matrix of
+ * the normal equations of a least squares problem. The condition number is estimated from the decomposition, without a
+ * singular value decomposition. If the decomposition fails (matrix not positive definite), or its condition number
+ * exceeds the maximum allowed value, the system is solved with solveSystemOfEquationsWithSvd if
+ * useSvdForIllConditionedSystem is true (which also provides the exact condition number as a diagnostic).
+ * Otherwise, an exception is thrown if the decomposition failed, and a warning is printed if the matrix is
+ * ill-conditioned (and checkConditionNumber is true).
+ * \param matrixToInvert Symmetric matrix A that is to be inverted to solve the equation
+ * \param rightHandSideVector Vector on the righthandside of the matrix equation that is to be solved
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the matrix that is allowed
+ * \param useSvdForIllConditionedSystem Boolean to denote whether the system is to be solved using an SVD if the matrix is
+ * not positive definite, or is ill-conditioned
+ * \return Solution x of matrix equation A*x=b
+ */
+Eigen::VectorXd solveSystemOfEquationsWithCholesky( const Eigen::MatrixXd& matrixToInvert,
+                                                    const Eigen::VectorXd& rightHandSideVector,
+                                                    const bool checkConditionNumber = 1,
+                                                    const double maximumAllowedConditionNumber = 1.0E8,
+                                                    const bool useSvdForIllConditionedSystem = 0 );
+
+//! Function to add the contribution of a block of observations to the normal equations
+/*!
+ * Function to add the contribution of a block of observations to the normal equations, so that the normal equations of a
+ * least squares problem can be accumulated block by block, without ever storing the full design matrix. For a block with
+ * design matrix H, weights W (diagonal) and residuals y, H^T*W*H is added to the normal matrix, and H^T*W*y to the
+ * righthandside vector. For efficiency, only the lower triangle of the normal matrix is updated; the full normal matrix
+ * is obtained by calling symmetrizeNormalMatrix after all blocks have been added.
+ * \param designMatrixBlock Matrix containing partial derivatives of observations in block (rows) w.r.t. estimated
+ * parameters (columns)
+ * \param observationResidualsBlock Difference between measured and simulated observations in block
+ * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix of block (assumes all weights to be
+ * uncorrelated and non-negative)
+ * \param normalMatrix Normal matrix to which the contribution of the block is to be added (lower triangle only)
+ * \param normalRightHandSide Righthandside vector of normal equations to which contribution of the block is to be added
+ */
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide );
+
+//! Function to set the upper triangle of a normal matrix from its lower triangle
+/*!
+ * Function to set the upper triangle of a normal matrix from its lower triangle, to be called after the normal equations
+ * have been accumulated with addObservationBlockToNormalEquations
+ * \param normalMatrix Normal matrix of which the upper triangle is to be set (modified by this function)
+ */
+void symmetrizeNormalMatrix( Eigen::MatrixXd& normalMatrix );
+
+//! Function to add a priori information and linear constraints to the normal equations
+/*!
+ * Function to add a priori information and linear constraints to the normal equations. The inverse a priori covariance is
+ * added to the normal matrix. If constraints are provided, the normal equations are augmented with Lagrange multipliers,
+ * in the same manner as in calculateInverseOfUpdatedCovarianceMatrix.
+ * \param normalMatrix Normal matrix (modified by this function)
+ * \param normalRightHandSide Righthandside vector of normal equations (modified by this function)
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ */
+void addAprioriInformationAndConstraintsToNormalEquations(
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
 //! Function to multiply information matrix by diagonal weights matrix
 /*!
  * Function to multiply information matrix by diagonal weights matrix
@@ -174,6 +248,34 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
         const bool checkConditionNumber = 1,
         const double maximumAllowedConditionNumber = 1.0E8 );
 
+//! Function to perform an iteration of least squares estimation from (accumulated) normal equations
+/*!
+ * Function to perform an iteration of least squares estimation from normal equations, typically obtained by accumulation with
+ * addObservationBlockToNormalEquations. The a priori information and constraints are added to the normal equations, which are
+ * then solved with solveSystemOfEquationsWithCholesky. Since the normal equations augmented with constraints are not
+ * positive definite, constrained problems are solved with solveSystemOfEquationsWithSvd.
+ * \param normalMatrix Normal matrix H^T*W*H (full symmetric matrix)
+ * \param normalRightHandSide Righthandside vector of normal equations H^T*W*y
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \param useSvdForIllConditionedSystem Boolean to denote whether the system is to be solved using an SVD if the normal
+ * matrix is not positive definite, or is ill-conditioned
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& normalRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ),
+        const bool useSvdForIllConditionedSystem = 0 );
+
 //! Function to fit a univariate polynomial through a set of data
 /*!
  *  Function to fit a univariate polynomial through a set of data. User must provide independent variables and observations
@@ -38,8 +38,12 @@
 
 
 #include <boost/circular_buffer.hpp>
+#include <array>
+#include <cmath>
 #include <functional>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 
@@ -51,6 +55,23 @@ namespace tudat
 namespace basic_mathematics
 {
 
+//! Function to compute the start index of a given degree in the packed triangular layout of Legendre polynomials
+/*!
+ * Function to compute the start index of a given degree in the packed triangular layout of Legendre polynomials, in
+ * which the entries of each degree n are stored contiguously for orders 0 <= m <= min( n, maximumOrder ), and the
+ * degrees are stored in increasing order. Calling this function with degree = maximumDegree + 1 gives the total
+ * number of entries up to the maximum degree.
+ * \param degree Degree for which the start index is to be computed
+ * \param maximumOrder Maximum order that is stored
+ * \return Start index of degree in packed triangular layout
+ */
+constexpr int getPackedLegendreDegreeOffset( const int degree, const int maximumOrder )
+{
+    return ( degree <= maximumOrder + 1 ) ?
+                ( degree * ( degree + 1 ) / 2 ) :
+                ( ( maximumOrder + 1 ) * ( maximumOrder + 2 ) / 2 + ( degree - maximumOrder - 1 ) * ( maximumOrder + 1 ) );
+}
+
 //! Class for creating and accessing a back-end cache of Legendre polynomials.
 class LegendreCache
 {
@@ -184,6 +205,30 @@ public:
         currentPolynomialParameter_ = TUDAT_NAN;
     }
 
+    //! Function to get the start index of a given degree in the lists of current Legendre polynomials and derivatives
+    /*!
+     * Function to get the start index of a given degree in the lists of current Legendre polynomials and derivatives,
+     * which are stored in packed triangular layout (see getPackedLegendreDegreeOffset). No range check is performed.
+     * \param degree Degree for which the start index is to be retrieved
+     * \return Start index of degree
+     */
+    int getDegreeOffset( const int degree ) const
+    {
+        return degreeOffsets_[ degree ];
+    }
+
+    //! Function to retrieve all current Legendre polynomials, in packed triangular layout.
+    const std::vector< double >& getLegendreValues( ) const
+    {
+        return legendreValues_;
+    }
+
+    //! Function to retrieve all current first derivatives of Legendre polynomials, in packed triangular layout.
+    const std::vector< double >& getLegendreDerivatives( ) const
+    {
+        return legendreDerivatives_;
+    }
+
     double getVerticalLegendreValuesComputationMultipliersOne( const int degree, const int order );
 
     double getVerticalLegendreValuesComputationMultipliersTwo( const int degree, const int order );
@@ -204,10 +249,13 @@ private:
 
     double currentOneOverPolynomialParameterComplement_;
 
+    //! Start index of each degree (up to maximumDegree_ + 1) in the packed triangular layout of the lists below.
+    std::vector< int > degreeOffsets_;
+
     //! List of current values of Legendre polynomials at degree and order (n,m)
     /*!
      * List of current values of Legendre polynomials at degree and order (n,m). The corresponding polynomial is at entry
-     * n * ( maximumOrder_ + 1 ) + m.
+     * degreeOffsets_[ n ] + m.
      */
     std::vector< double > legendreValues_;
 
@@ -218,14 +266,14 @@ private:
     //! List of current values of first derivatives of Legendre polynomials at degree and order (n,m)
     /*!
      * List of current values of first derivatives of Legendre polynomials at degree and order (n,m).
-     * The corresponding polynomial is at entry n * ( maximumOrder_ + 1 ) + m.
+     * The corresponding polynomial is at entry degreeOffsets_[ n ] + m.
      */
     std::vector< double > legendreDerivatives_;
 
     //! List of current values of second derivatives of Legendre polynomials at degree and order (n,m)
     /*!
      * List of current values of second derivatives of Legendre polynomials at degree and order (n,m).
-     * The corresponding polynomial is at entry n * ( maximumOrder_ + 1 ) + m.
+     * The corresponding polynomial is at entry degreeOffsets_[ n ] + m.
      */
     std::vector< double > legendreSecondDerivatives_;
 
@@ -639,6 +687,51 @@ double computeGeodesyLegendrePolynomialVertical( const int degree,
                                                  const double twoDegreesPriorPolynomial );
 
 
+//! Compute geodesy-normalized Legendre polynomials, and their derivatives, at a single degree.
+/*!
+ * Compute geodesy-normalized Legendre polynomials, and their first (and optionally second) derivatives, at a single
+ * degree and all orders up to the maximum order, in a single fused pass. The polynomials are computed from the
+ * polynomials at the two previous degrees using the degree (vertical) and sectoral (diagonal) recursions of
+ * Holmes & Featherstone [2002], after which the derivatives are computed from the polynomials at the current degree.
+ * The results are identical to those computed by computeGeodesyLegendrePolynomialFromCache,
+ * computeGeodesyLegendrePolynomialDerivative and computeGeodesyLegendrePolynomialSecondDerivative. The function is
+ * used by both the LegendreCache and FixedDegreeLegendreCache classes, and takes pointers to the start of the
+ * current degree in each of the (degree-ordered) lists of values and multipliers. Note that the derivative at the
+ * maximum order is only computed if the maximum order is equal to the degree (as it requires the polynomial at one
+ * order higher).
+ * \param degree Degree at which polynomials are to be computed.
+ * \param maximumOrder Maximum order to which polynomials are to be computed.
+ * \param polynomialParameter Free variable of Legendre polynomials (sine of latitude)
+ * \param oneOverPolynomialParameterComplement One over complement of polynomialParameter (one over cosine of latitude)
+ * \param degreeOneOrderOnePolynomial Geodesy-normalized Legendre polynomial at degree and order one (only used if
+ * degree > 1).
+ * \param firstVerticalMultipliers Multipliers of P_{n-1,m} (without factor sqrt(2n-1)) in degree recursion, at
+ * current degree.
+ * \param secondVerticalMultipliers Multipliers of P_{n-2,m} in degree recursion, at current degree.
+ * \param derivativeNormalizations Normalization corrections for derivatives, at current degree.
+ * \param previousDegreeValues Legendre polynomials at previous degree (only used if degree > 1).
+ * \param secondPreviousDegreeValues Legendre polynomials at two degrees prior (only used if degree > 1).
+ * \param currentDegreeValues Legendre polynomials at current degree (returned by reference).
+ * \param currentDegreeDerivatives First derivatives of Legendre polynomials at current degree (returned by
+ * reference).
+ * \param currentDegreeSecondDerivatives Second derivatives of Legendre polynomials at current degree (returned by
+ * reference); not computed if nullptr.
+ */
+void computeGeodesyLegendrePolynomialsAtDegree(
+        const int degree,
+        const int maximumOrder,
+        const double polynomialParameter,
+        const double oneOverPolynomialParameterComplement,
+        const double degreeOneOrderOnePolynomial,
+        const double* firstVerticalMultipliers,
+        const double* secondVerticalMultipliers,
+        const double* derivativeNormalizations,
+        const double* previousDegreeValues,
+        const double* secondPreviousDegreeValues,
+        double* currentDegreeValues,
+        double* currentDegreeDerivatives,
+        double* currentDegreeSecondDerivatives );
+
 //! Predefine boost function for geodesy-normalized Legendre polynomial.
 static const LegendreCache::LegendrePolynomialFunction geodesyNormalizedLegendrePolynomialFunction =
         std::bind( &computeGeodesyLegendrePolynomialFromCache, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3 );
@@ -708,6 +801,242 @@ void geodesyNormalizeUnnormalizedCoefficients(
         Eigen::MatrixXd& cosineCoefficients,
         Eigen::MatrixXd& sineCoefficients );
 
+//! Class for computing and accessing geodesy-normalized Legendre polynomials up to a compile-time maximum degree and order
+/*!
+ * Class for computing and accessing geodesy-normalized Legendre polynomials (and their first and, optionally, second
+ * derivatives) up to a compile-time maximum degree and order. Compared to the LegendreCache class, the polynomials
+ * and derivatives are computed in a single fused pass over the degrees (see computeGeodesyLegendrePolynomialsAtDegree),
+ * using the same packed triangular layout (see getPackedLegendreDegreeOffset), with loop bounds and storage size known
+ * at compile time. Since the storage size is O(MaximumDegree^2), objects of this class should be allocated on the heap
+ * for high degrees.
+ * Note that, as for the LegendreCache, the derivatives at the maximum order (if lower than the degree) require the
+ * polynomial at one order higher, so that MaximumOrder should be one higher than the maximum order at which the
+ * derivatives are required (and two higher than the maximum order at which the second derivatives are required).
+ * \tparam MaximumDegree Maximum degree to which the polynomials are computed
+ * \tparam MaximumOrder Maximum order to which the polynomials are computed
+ */
+template< int MaximumDegree, int MaximumOrder = MaximumDegree >
+class FixedDegreeLegendreCache
+{
+public:
+
+    static_assert( MaximumDegree >= 0 && MaximumOrder >= 0 && MaximumOrder <= MaximumDegree,
+                   "Error, invalid maximum degree and order for FixedDegreeLegendreCache" );
+
+    //! Number of entries (degree and order combinations) in the packed triangular layout.
+    static constexpr int numberOfEntries = getPackedLegendreDegreeOffset( MaximumDegree + 1, MaximumOrder );
+
+    //! Constructor, pre-computes the recurrence multipliers
+    /*!
+     * Constructor, pre-computes the recurrence multipliers
+     * \param computeSecondDerivatives Boolean denoting whether the second derivatives of the Legendre polynomials are
+     * to be computed when calling update function.
+     */
+    FixedDegreeLegendreCache( const bool computeSecondDerivatives = false ):
+        legendreValues_( numberOfEntries, 0.0 ),
+        legendreDerivatives_( numberOfEntries, 0.0 ),
+        legendreSecondDerivatives_( numberOfEntries, 0.0 ),
+        firstVerticalMultipliers_( numberOfEntries, 0.0 ),
+        secondVerticalMultipliers_( numberOfEntries, 0.0 ),
+        derivativeNormalizations_( numberOfEntries, 0.0 ),
+        currentPolynomialParameter_( TUDAT_NAN ),
+        currentPolynomialParameterComplement_( TUDAT_NAN ),
+        computeSecondDerivatives_( computeSecondDerivatives )
+    {
+        for( int i = 0; i <= MaximumDegree; i++ )
+        {
+            degreeOffsets_[ i ] = getPackedLegendreDegreeOffset( i, MaximumOrder );
+            for( int j = 0; j <= std::min( i, MaximumOrder ); j++ )
+            {
+                int index = degreeOffsets_[ i ] + j;
+                firstVerticalMultipliers_[ index ] =
+                        std::sqrt( ( 2.0 * static_cast< double >( i ) + 1.0 )
+                                   / ( ( static_cast< double >( i + j ) ) *
+                                       ( static_cast< double >( i - j ) ) ) );
+                secondVerticalMultipliers_[ index ] =
+                        std::sqrt( ( static_cast< double >( i + j ) - 1.0 )
+                                   * ( static_cast< double >( i - j ) - 1.0 )
+                                   / ( 2.0 * static_cast< double >( i ) - 3.0 ) );
+                derivativeNormalizations_[ index ] = std::sqrt(
+                            ( static_cast< double >( i + j + 1 ) )
+                            * ( static_cast< double >( i - j ) ) );
+                if ( j == 0 )
+                {
+                    derivativeNormalizations_[ index ] *= std::sqrt( 0.5 );
+                }
+            }
+        }
+    }
+
+    //! Update cache with new polynomial parameter (sine of latitude)
+    /*!
+     * Update cache with new polynomial parameter (sine of latitude).
+     * \param polynomialParameter Parameter used as input argument for Legendre polynomials, in astro
+     * applications, this is typically the sine of the body-fixed latitude.
+     */
+    void update( const double polynomialParameter )
+    {
+        if( !( polynomialParameter == currentPolynomialParameter_ ) )
+        {
+            currentPolynomialParameter_ = polynomialParameter;
+            currentPolynomialParameterComplement_ = std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
+            const double oneOverPolynomialParameterComplement = 1.0 / currentPolynomialParameterComplement_;
+
+            for( int i = 0; i <= MaximumDegree; i++ )
+            {
+                computeGeodesyLegendrePolynomialsAtDegree(
+                            i, MaximumOrder, currentPolynomialParameter_, oneOverPolynomialParameterComplement,
+                            ( i > 1 ) ? legendreValues_[ 2 ] : 0.0,
+                            &firstVerticalMultipliers_[ degreeOffsets_[ i ] ],
+                            &secondVerticalMultipliers_[ degreeOffsets_[ i ] ],
+                            &derivativeNormalizations_[ degreeOffsets_[ i ] ],
+                            ( i > 1 ) ? &legendreValues_[ degreeOffsets_[ i - 1 ] ] : nullptr,
+                            ( i > 1 ) ? &legendreValues_[ degreeOffsets_[ i - 2 ] ] : nullptr,
+                            &legendreValues_[ degreeOffsets_[ i ] ],
+                            &legendreDerivatives_[ degreeOffsets_[ i ] ],
+                            computeSecondDerivatives_ ? &legendreSecondDerivatives_[ degreeOffsets_[ i ] ] : nullptr );
+            }
+        }
+    }
+
+    //! Get Legendre polynomial value from the cache.
+    /*!
+    * Get Legendre polynomial value from the cache, as computed by last call to update function.
+    * \param degree Degree of requested Legendre polynomial.
+    * \param order Order of requested Legendre polynomial.
+    * \return Legendre polynomial value.
+    */
+    double getLegendrePolynomial( const int degree, const int order )
+    {
+        return ( order > degree ) ? 0.0 : legendreValues_[ getIndex( degree, order ) ];
+    }
+
+    //! Get first derivative of Legendre polynomial value from the cache.
+    /*!
+    * Get first derivative of Legendre polynomial value from the cache, as computed by last call to update function.
+    * \param degree Degree of requested Legendre polynomial.
+    * \param order Order of requested Legendre polynomial.
+    * \return First derivative of Legendre polynomial value.
+    */
+    double getLegendrePolynomialDerivative( const int degree, const int order )
+    {
+        return ( order > degree ) ? 0.0 : legendreDerivatives_[ getIndex( degree, order ) ];
+    }
+
+    //! Get second derivative of Legendre polynomial value from the cache.
+    /*!
+    * Get second derivative of Legendre polynomial value from the cache, as computed by last call to update function.
+    * \param degree Degree of requested Legendre polynomial.
+    * \param order Order of requested Legendre polynomial.
+    * \return Second derivative of Legendre polynomial value.
+    */
+    double getLegendrePolynomialSecondDerivative( const int degree, const int order )
+    {
+        if( !computeSecondDerivatives_ )
+        {
+            throw std::runtime_error( "Error when requesting legendre cache second derivatives, no computations performed" );
+        }
+        return ( order > degree ) ? 0.0 : legendreSecondDerivatives_[ getIndex( degree, order ) ];
+    }
+
+    //! Function to get the maximum degree of cache.
+    int getMaximumDegree( ) const
+    {
+        return MaximumDegree;
+    }
+
+    //! Function to get the maximum order of cache.
+    int getMaximumOrder( ) const
+    {
+        return MaximumOrder;
+    }
+
+    //! Function to return the current polynomial parameter (typically sine of latitude)
+    double getCurrentPolynomialParameter( )
+    {
+        return currentPolynomialParameter_;
+    }
+
+    //! Function to return the complement to the current polynomial parameter (typically cosine of latitude)
+    double getCurrentPolynomialParameterComplement( )
+    {
+        return currentPolynomialParameterComplement_;
+    }
+
+    //! Function to reset whether the second derivatives are to be computed when calling update function
+    void setComputeSecondDerivatives( const bool computeSecondDerivatives )
+    {
+        computeSecondDerivatives_ = computeSecondDerivatives;
+        currentPolynomialParameter_ = TUDAT_NAN;
+    }
+
+    //! Function to get the packed index of given degree and order (order <= degree)
+    int getIndex( const int degree, const int order ) const
+    {
+        if( degree > MaximumDegree || order > MaximumOrder || degree < 0 || order < 0 )
+        {
+            throw std::runtime_error( "Error when requesting fixed-degree legendre cache, maximum degree or order exceeded " +
+                                      std::to_string( degree ) + " " + std::to_string( order ) );
+        }
+        return degreeOffsets_[ degree ] + order;
+    }
+
+    //! Function to get the start index of a given degree in the packed triangular layout (no range check).
+    int getDegreeOffset( const int degree ) const
+    {
+        return degreeOffsets_[ degree ];
+    }
+
+    //! Function to retrieve all current Legendre polynomials, in packed triangular layout.
+    const std::vector< double >& getLegendreValues( ) const
+    {
+        return legendreValues_;
+    }
+
+    //! Function to retrieve all current Legendre polynomial derivatives, in packed triangular layout.
+    const std::vector< double >& getLegendreDerivatives( ) const
+    {
+        return legendreDerivatives_;
+    }
+
+private:
+
+    //! Start index of each degree in the packed triangular layout.
+    std::array< int, MaximumDegree + 1 > degreeOffsets_;
+
+    //! Current values of Legendre polynomials, in packed triangular layout.
+    std::vector< double > legendreValues_;
+
+    //! Current values of first derivatives of Legendre polynomials, in packed triangular layout.
+    std::vector< double > legendreDerivatives_;
+
+    //! Current values of second derivatives of Legendre polynomials, in packed triangular layout.
+    std::vector< double > legendreSecondDerivatives_;
+
+    //! Multipliers of P_{n-1,m} (without factor sqrt(2n-1)) in degree recursion, in packed triangular layout.
+    std::vector< double > firstVerticalMultipliers_;
+
+    //! Multipliers of P_{n-2,m} in degree recursion, in packed triangular layout.
+    std::vector< double > secondVerticalMultipliers_;
+
+    //! Normalization corrections for derivative computation, in packed triangular layout.
+    std::vector< double > derivativeNormalizations_;
+
+    //! Current polynomial parameter (sine of latitude).
+    double currentPolynomialParameter_;
+
+    //! Current 'complement' to polynomial parameter (cosine of latitude).
+    double currentPolynomialParameterComplement_;
+
+    //! Boolean denoting whether the second derivatives of the Legendre polynomials are to be computed.
+    bool computeSecondDerivatives_;
+
+};
+
+//! Definition of number of entries in packed triangular layout (required for ODR-use before C++17).
+template< int MaximumDegree, int MaximumOrder >
+constexpr int FixedDegreeLegendreCache< MaximumDegree, MaximumOrder >::numberOfEntries;
+
 } // namespace basic_mathematics
 } // namespace tudat
 
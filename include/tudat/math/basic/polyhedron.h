@@ -22,11 +22,35 @@
 #include <Eigen/Geometry>
 #include <vector>
 
+#include "tudat/basics/threadPool.h"
+
 namespace tudat
 {
 namespace basic_mathematics
 {
 
+//! Typedef for a list of packed symmetric 3x3 dyads.
+/*!
+ * Typedef for a list of packed symmetric 3x3 dyads. Each row contains the (xx, xy, xz, yy, yz, zz) entries of a single
+ * dyad, so that (with Eigen's column-major storage) each of the six entries is stored contiguously for all dyads.
+ */
+typedef Eigen::Matrix< double, Eigen::Dynamic, 6 > PackedPolyhedronDyads;
+
+//! Number of facets (or edges) that are summed per block in the polyhedron potential and gradient.
+/*!
+ * Number of facets (or edges) that are summed per block in the polyhedron potential and gradient. The partial sums of
+ * the blocks are combined in order of block index, so that the result does not depend on the number of threads used.
+ */
+const int polyhedronSummationBlockSize = 256;
+
+//! Minimum number of facets (or edges) per thread for which polyhedron computations are distributed over threads.
+/*!
+ * Minimum number of facets (or edges) per thread for which polyhedron computations are distributed over threads. The
+ * polyhedron functions are called for each evaluation of the gravity field, so that (even when the blocks are evaluated
+ * on a persistent utilities::ThreadPool) distributing small polyhedra over threads is slower than serial evaluation.
+ */
+const int minimumPolyhedronIterationsPerThread = 4096;
+
 /*! Checks if the provided polyhedron settings are valid.
  *
  * Checks if the provided polyhedron settings are valid. It verifies that the provided matrices with the vertices coordinates
@@ -50,17 +74,55 @@ void calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint (
         const Eigen::Vector3d& bodyFixedPosition,
         const Eigen::MatrixXd& verticesCoordinates);
 
+/*! Packs a single symmetric 3x3 dyad into a structure-of-arrays representation.
+ *
+ * Packs a single symmetric 3x3 dyad into a given row of a structure-of-arrays representation (see
+ * PackedPolyhedronDyads), in which only the upper triangular entries of the dyad are stored.
+ * @param packedDyads Packed dyads, one row per dyad, of which the row with index dyadIndex is set (output).
+ * @param dyadIndex Index of the dyad in the packed dyads (input).
+ * @param dyad Dyad, given as a symmetric 3x3 matrix (input).
+ */
+void packPolyhedronDyad(
+        PackedPolyhedronDyads& packedDyads,
+        const int dyadIndex,
+        const Eigen::Matrix3d& dyad );
+
+/*! Packs a list of symmetric 3x3 dyads into a structure-of-arrays representation.
+ *
+ * Packs a list of symmetric 3x3 dyads into a structure-of-arrays representation (see PackedPolyhedronDyads), in which
+ * only the upper triangular entries of each dyad are stored. Throws an error if any of the dyads is not a 3x3 matrix.
+ * @param packedDyads Packed dyads, one row per dyad (output).
+ * @param dyads List of dyads, each given as a symmetric 3x3 matrix (input).
+ */
+void packPolyhedronDyads(
+        PackedPolyhedronDyads& packedDyads,
+        const std::vector< Eigen::MatrixXd >& dyads );
+
+/*! Unpacks a list of symmetric 3x3 dyads from a structure-of-arrays representation.
+ *
+ * Unpacks a list of symmetric 3x3 dyads from a structure-of-arrays representation (see PackedPolyhedronDyads), inverse
+ * of packPolyhedronDyads.
+ * @param packedDyads Packed dyads, one row per dyad.
+ * @return List of dyads, each given as a symmetric 3x3 matrix.
+ */
+std::vector< Eigen::MatrixXd > unpackPolyhedronDyads( const PackedPolyhedronDyads& packedDyads );
+
 /*! Calculates the per-facet factor of each polyhedron facet.
  *
  * Calculates the per-facet factor of each polyhedron facet, according to Eq. 27 of Werner and Scheeres (1997).
  * @param perFacetFactor Vector with the per-facet factor of each facet (output).
  * @param verticesCoordinatesRelativeToFieldPoint Matrix with coordinates of each vertex wrt field point (input).
  * @param verticesDefiningEachFacet Identification of the vertices defining each facet (0 indexed) (input)
+ * @param numberOfThreads Maximum number of threads over which the facets are distributed (input).
+ * @param threadPool Pool of threads over which the facets are distributed (nullptr if threads are started for each
+ * call) (input).
  */
 void calculatePolyhedronPerFacetFactor (
         Eigen::VectorXd& perFacetFactor,
         const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
-        const Eigen::MatrixXi& verticesDefiningEachFacet);
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int numberOfThreads = 1,
+        utilities::ThreadPool* threadPool = nullptr );
 
 /*! Calculates the per-edge factor of each polyhedron edge.
  *
@@ -68,11 +130,16 @@ void calculatePolyhedronPerFacetFactor (
  * @param perEdgeFactor Vector with the per-edge factor of each edge (output).
  * @param verticesCoordinatesRelativeToFieldPoint Matrix with coordinates of each vertex wrt field point (input).
  * @param verticesDefiningEachEdge Identification of the vertices defining each facet (0 indexed) (input)
+ * @param numberOfThreads Maximum number of threads over which the edges are distributed (input).
+ * @param threadPool Pool of threads over which the edges are distributed (nullptr if threads are started for each
+ * call) (input).
  */
 void calculatePolyhedronPerEdgeFactor (
         Eigen::VectorXd& perEdgeFactor,
         const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
-        const Eigen::MatrixXi& verticesDefiningEachEdge);
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const int numberOfThreads = 1,
+        utilities::ThreadPool* threadPool = nullptr );
 
 /*! Calculates the gravitational potential of a constant-density polyhedron.
  *
@@ -98,6 +165,37 @@ double calculatePolyhedronGravitationalPotential(
         const Eigen::VectorXd& perFacetFactor,
         const Eigen::VectorXd& perEdgeFactor );
 
+/*! Calculates the gravitational potential of a constant-density polyhedron, using packed dyads.
+ *
+ * Calculates the gravitational potential of a constant-density polyhedron, according to Eq. 10 of Werner and Scheeres
+ * (1997), using the structure-of-arrays representation of the facet and edge dyads. The summations over facets and
+ * edges are (optionally) distributed over multiple threads. The summation is performed in blocks of
+ * polyhedronSummationBlockSize terms, combined in fixed order, so that the result is identical for any number of threads.
+ * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+ * @param verticesCoordinatesRelativeToFieldPoint Matrix with coordinates of each vertex wrt field point.
+ * @param verticesDefiningEachFacet Identification of the vertices defining each facet (0 indexed).
+ * @param verticesDefiningEachEdge Identification of the vertices defining each edge (0 indexed).
+ * @param facetDyads Packed facet dyads.
+ * @param edgeDyads Packed edge dyads.
+ * @param perFacetFactor Vector containing per-facet factors.
+ * @param perEdgeFactor Vector containing per-edge factors.
+ * @param numberOfThreads Maximum number of threads over which the summations are distributed.
+ * @param threadPool Pool of threads over which the summations are distributed (nullptr if threads are started for
+ * each call).
+ * @return Gravitational potential.
+ */
+double calculatePolyhedronGravitationalPotential(
+        const double gravitationalConstantTimesDensity,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const PackedPolyhedronDyads& facetDyads,
+        const PackedPolyhedronDyads& edgeDyads,
+        const Eigen::VectorXd& perFacetFactor,
+        const Eigen::VectorXd& perEdgeFactor,
+        const int numberOfThreads = 1,
+        utilities::ThreadPool* threadPool = nullptr );
+
 /*! Calculates the gradient of the potential of a constant-density polyhedron.
  *
  * Calculates the gradient of the potential of a constant-density polyhedron, according to Eq. 15 of Werner and Scheeres
@@ -122,6 +220,37 @@ Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential(
         const Eigen::VectorXd& perFacetFactor,
         const Eigen::VectorXd& perEdgeFactor);
 
+/*! Calculates the gradient of the potential of a constant-density polyhedron, using packed dyads.
+ *
+ * Calculates the gradient of the potential of a constant-density polyhedron, according to Eq. 15 of Werner and Scheeres
+ * (1997), using the structure-of-arrays representation of the facet and edge dyads. The summations over facets and
+ * edges are (optionally) distributed over multiple threads. The summation is performed in blocks of
+ * polyhedronSummationBlockSize terms, combined in fixed order, so that the result is identical for any number of threads.
+ * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+ * @param verticesCoordinatesRelativeToFieldPoint Matrix with coordinates of each vertex wrt field point.
+ * @param verticesDefiningEachFacet Identification of the vertices defining each facet (0 indexed).
+ * @param verticesDefiningEachEdge Identification of the vertices defining each edge (0 indexed).
+ * @param facetDyads Packed facet dyads.
+ * @param edgeDyads Packed edge dyads.
+ * @param perFacetFactor Vector containing per-facet factors.
+ * @param perEdgeFactor Vector containing per-edge factors.
+ * @param numberOfThreads Maximum number of threads over which the summations are distributed.
+ * @param threadPool Pool of threads over which the summations are distributed (nullptr if threads are started for
+ * each call).
+ * @return Gradient of gravitational potential.
+ */
+Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential(
+        const double gravitationalConstantTimesDensity,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const PackedPolyhedronDyads& facetDyads,
+        const PackedPolyhedronDyads& edgeDyads,
+        const Eigen::VectorXd& perFacetFactor,
+        const Eigen::VectorXd& perEdgeFactor,
+        const int numberOfThreads = 1,
+        utilities::ThreadPool* threadPool = nullptr );
+
 /*! Calculates the Hessian matrix of the potential of a constant-density polyhedron.
  *
  * Calculates the Hessian matrix of the potential of a constant-density polyhedron, according to Eq. 16 of Werner and
@@ -140,6 +269,24 @@ Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential(
         const Eigen::VectorXd& perFacetFactor,
         const Eigen::VectorXd& perEdgeFactor);
 
+/*! Calculates the Hessian matrix of the potential of a constant-density polyhedron, using packed dyads.
+ *
+ * Calculates the Hessian matrix of the potential of a constant-density polyhedron, according to Eq. 16 of Werner and
+ * Scheeres (1997), using the structure-of-arrays representation of the facet and edge dyads.
+ * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+ * @param facetDyads Packed facet dyads.
+ * @param edgeDyads Packed edge dyads.
+ * @param perFacetFactor Vector containing per-facet factors.
+ * @param perEdgeFactor Vector containing per-edge factors.
+ * @return Hessian matrix of the potential.
+ */
+Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential(
+        const double gravitationalConstantTimesDensity,
+        const PackedPolyhedronDyads& facetDyads,
+        const PackedPolyhedronDyads& edgeDyads,
+        const Eigen::VectorXd& perFacetFactor,
+        const Eigen::VectorXd& perEdgeFactor);
+
 /*! Calculate the laplacian of the gravitational potential of a constant-density polyhedron.
  *
  * Calculate the laplacian of the gravitational potential of a constant-density polyhedron, according to Eq. 17 of
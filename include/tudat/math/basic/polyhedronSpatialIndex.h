@@ -0,0 +1,169 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *       C. Ericson (2005), "Real-Time Collision Detection", Morgan Kaufmann, section 5.1.5
+ *       J.A. Baerentzen and H. Aanaes (2005), "Signed distance computation using the angle weighted pseudonormal",
+ *          IEEE Transactions on Visualization and Computer Graphics, 11 (3), 243-253
+ */
+
+#ifndef TUDAT_POLYHEDRONSPATIALINDEX_H
+#define TUDAT_POLYHEDRONSPATIALINDEX_H
+
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+/*! Computes the point on a triangle that is closest to a given point.
+ *
+ * Computes the point on a triangle that is closest to a given point (Ericson, 2005), and identifies the feature of the
+ * triangle on which it lies.
+ * @param point Point for which the closest point on the triangle is to be computed.
+ * @param vertex0 First vertex of the triangle.
+ * @param vertex1 Second vertex of the triangle.
+ * @param vertex2 Third vertex of the triangle.
+ * @param closestFeature Feature on which the closest point lies (returned by reference): 0, 1, 2 for vertex 0, 1, 2;
+ * 3, 4, 5 for edge 0-1, 1-2, 2-0; 6 for the interior of the triangle.
+ * @return Closest point on the triangle.
+ */
+Eigen::Vector3d computeClosestPointOnTriangle( const Eigen::Vector3d& point,
+                                               const Eigen::Vector3d& vertex0,
+                                               const Eigen::Vector3d& vertex1,
+                                               const Eigen::Vector3d& vertex2,
+                                               int& closestFeature );
+
+//! Spatial index for closest-feature queries on a polyhedron.
+/*!
+ * Spatial index for closest-feature queries on a polyhedron, consisting of a bounding volume hierarchy (of
+ * axis-aligned boxes) over the vertices and one over the facets, which are built once at construction. Each query
+ * requires O(log n) operations for typical polyhedra (with n the number of vertices/facets), instead of the O(n)
+ * operations required for a linear search. The sign of the distance to the surface is determined from the angle
+ * weighted pseudo-normal of the closest feature (Baerentzen and Aanaes, 2005), which requires the polyhedron to be
+ * closed and consistently oriented. All query functions are const, so a single index may be queried from multiple
+ * threads concurrently.
+ */
+class PolyhedronSpatialIndex
+{
+public:
+
+    /*! Constructor.
+     *
+     * Constructor, builds the bounding volume hierarchies over the vertices and facets.
+     * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+     * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet,
+     * 3 columns), in counterclockwise order when seen from outside the polyhedron.
+     * @param maximumPrimitivesPerLeaf Maximum number of vertices/facets in a single leaf node of the hierarchies.
+     */
+    PolyhedronSpatialIndex( const Eigen::MatrixXd& verticesCoordinates,
+                            const Eigen::MatrixXi& verticesDefiningEachFacet,
+                            const int maximumPrimitivesPerLeaf = 4 );
+
+    /*! Computes the distance to the vertex closest to the given point.
+     *
+     * Computes the distance to the vertex closest to the given point.
+     * @param point Point for which the closest vertex is to be determined.
+     * @param closestVertex Index of the closest vertex (returned by reference).
+     * @return Distance to the closest vertex.
+     */
+    double computeDistanceToClosestVertex( const Eigen::Vector3d& point, int& closestVertex ) const;
+
+    /*! Computes the signed distance to the surface of the polyhedron.
+     *
+     * Computes the distance to the closest point on the surface of the polyhedron, which is positive if the point is
+     * outside the polyhedron and negative if it is inside.
+     * @param point Point for which the distance is to be computed.
+     * @param closestFacet Index of the facet on which the closest point lies (returned by reference).
+     * @return Signed distance to the surface.
+     */
+    double computeSignedDistanceToSurface( const Eigen::Vector3d& point, int& closestFacet ) const;
+
+    //! Function to return the number of nodes in the hierarchy over the vertices.
+    int getNumberOfVertexNodes( ) const
+    {
+        return static_cast< int >( vertexNodes_.size( ) );
+    }
+
+    //! Function to return the number of nodes in the hierarchy over the facets.
+    int getNumberOfFacetNodes( ) const
+    {
+        return static_cast< int >( facetNodes_.size( ) );
+    }
+
+private:
+
+    //! Node of a bounding volume hierarchy.
+    struct BoundingVolumeNode
+    {
+        //! Box bounding all primitives in the node.
+        Eigen::AlignedBox3d boundingBox;
+
+        //! Index of the first child node (second child follows directly); -1 for leaf nodes.
+        int firstChild;
+
+        //! Index of the first primitive of the node in the list of sorted primitive indices.
+        int firstPrimitive;
+
+        //! Number of primitives in the node.
+        int numberOfPrimitives;
+    };
+
+    /*! Builds a bounding volume hierarchy.
+     *
+     * Builds a bounding volume hierarchy by recursively splitting the primitives at the median of their centroids,
+     * along the longest axis of the bounding box of the centroids.
+     * @param primitiveBoxes Bounding box of each primitive.
+     * @param nodes Nodes of the hierarchy (returned by reference; root node is the first entry).
+     * @param sortedPrimitives Indices of the primitives, sorted such that each node contains a contiguous range
+     * (returned by reference).
+     */
+    void buildHierarchy( const std::vector< Eigen::AlignedBox3d >& primitiveBoxes,
+                         std::vector< BoundingVolumeNode >& nodes,
+                         std::vector< int >& sortedPrimitives );
+
+    //! Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+    Eigen::MatrixXd verticesCoordinates_;
+
+    //! Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+    Eigen::MatrixXi verticesDefiningEachFacet_;
+
+    //! Maximum number of vertices/facets in a single leaf node of the hierarchies.
+    int maximumPrimitivesPerLeaf_;
+
+    //! Nodes of the hierarchy over the vertices.
+    std::vector< BoundingVolumeNode > vertexNodes_;
+
+    //! Indices of the vertices, sorted per node.
+    std::vector< int > sortedVertices_;
+
+    //! Nodes of the hierarchy over the facets.
+    std::vector< BoundingVolumeNode > facetNodes_;
+
+    //! Indices of the facets, sorted per node.
+    std::vector< int > sortedFacets_;
+
+    //! Outward-pointing unit normal of each facet.
+    std::vector< Eigen::Vector3d > facetNormals_;
+
+    //! Pseudo-normals of the edges of each facet (edges 0-1, 1-2 and 2-0, per facet).
+    std::vector< Eigen::Vector3d > edgePseudoNormals_;
+
+    //! Angle weighted pseudo-normal of each vertex.
+    std::vector< Eigen::Vector3d > vertexPseudoNormals_;
+};
+
+} // namespace basic_mathematics
+} // namespace tudat
+
+#endif //TUDAT_POLYHEDRONSPATIALINDEX_H
@@ -12,9 +12,10 @@
 #ifndef TUDAT_SPHERICAL_HARMONICS_H
 #define TUDAT_SPHERICAL_HARMONICS_H
 
-#include <Eigen/Core>
-
+#include <vector>
 
+#include <Eigen/Core>
+#include <Eigen/StdVector>
 
 #include "tudat/math/basic/legendrePolynomials.h"
 
@@ -88,6 +89,19 @@ public:
                  const double longitude, const double referenceRadius )
     {
         legendreCache_->update( polynomialParameter );
+        updateLongitudeAndRadiusTerms( radius, longitude, referenceRadius );
+    }
+
+    //! Update cached sines and cosines of longitude, and powers of radius ratio, to current state.
+    /*!
+     * Update cached sines and cosines of longitude, and powers of radius ratio, to current state, without updating
+     * the Legendre polynomials (for use with a separate Legendre cache, such as a FixedDegreeLegendreCache).
+     * \param radius Distance from origin
+     * \param longitude Current longitude
+     * \param referenceRadius Reference (typically equatorial) radius of gravity field.
+     */
+    void updateLongitudeAndRadiusTerms( const double radius, const double longitude, const double referenceRadius )
+    {
         updateSines( longitude );
         updateRadiusPowers( referenceRadius / radius );
     }
@@ -242,6 +256,144 @@ private:
 
 };
 
+//! Cache object for the batched evaluation of geodesy-normalized spherical harmonic potential gradients.
+/*!
+ *  Cache object for the batched evaluation of geodesy-normalized spherical harmonic potential gradients, in which a
+ *  number of positions (numberOfLanes) is processed simultaneously. All per-position quantities are stored as
+ *  fixed-size Eigen arrays with one entry per position (lane), so that the Legendre recurrences and the summation
+ *  over degree and order are vectorized across positions by Eigen (SSE2/AVX/AVX-512, depending on the compiler flags,
+ *  with a scalar fallback). The object stores the degree/order-dependent recurrence multipliers, which are computed
+ *  once, as well as the work arrays (current and two previous degrees of Legendre polynomials, and the sines and
+ *  cosines of multiples of the longitude) so that no memory is allocated during the evaluation.
+ */
+class SphericalHarmonicsBatchCache
+{
+public:
+
+    //! Number of positions that is processed simultaneously
+    static const int numberOfLanes = 8;
+
+    //! Typedef for array containing a single quantity for each of the simultaneously processed positions.
+    typedef Eigen::Array< double, numberOfLanes, 1 > LaneArray;
+
+    //! Typedef for list of lane arrays, with allocator ensuring correct alignment.
+    typedef std::vector< LaneArray, Eigen::aligned_allocator< LaneArray > > LaneArrayList;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree to which to update cache
+     * \param maximumOrder Maximum order to which to update cache
+     */
+    SphericalHarmonicsBatchCache( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Update maximum degree and order of cache, and recompute the recurrence multipliers.
+    /*!
+     * Update maximum degree and order of cache, and recompute the recurrence multipliers. Note that the Legendre
+     * polynomials are computed up to one order higher than maximumOrder (if permitted by the degree), as these are
+     * required for the computation of the Legendre polynomial derivatives.
+     * \param maximumDegree Maximum degree to which to update cache
+     * \param maximumOrder Maximum order to which to update cache
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Function to get the maximum degree of cache.
+    /*!
+     * Function to get the maximum degree of cache
+     * \return Maximum degree of cache.
+     */
+    int getMaximumDegree( ) const
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order of cache.
+    /*!
+     * Function to get the maximum order of cache.
+     * \return Maximum order of cache.
+     */
+    int getMaximumOrder( ) const
+    {
+        return maximumOrder_;
+    }
+
+    //! Function to get the maximum order up to which the Legendre polynomials are computed (maximum order + 1).
+    /*!
+     * Function to get the maximum order up to which the Legendre polynomials are computed (maximum order + 1).
+     * \return Maximum order up to which the Legendre polynomials are computed.
+     */
+    int getMaximumPolynomialOrder( )
+    {
+        return maximumPolynomialOrder_;
+    }
+
+    //! Function to get the multiplier of P_{n-1,m} in the degree recursion of the geodesy-normalized polynomials
+    double getFirstVerticalMultiplier( const int degree, const int order )
+    {
+        return firstVerticalMultipliers_[ degree * ( maximumPolynomialOrder_ + 1 ) + order ];
+    }
+
+    //! Function to get the multiplier of P_{n-2,m} in the degree recursion of the geodesy-normalized polynomials
+    double getSecondVerticalMultiplier( const int degree, const int order )
+    {
+        return secondVerticalMultipliers_[ degree * ( maximumPolynomialOrder_ + 1 ) + order ];
+    }
+
+    //! Function to get the multiplier of P_{n-1,n-1} in the sectoral recursion of the geodesy-normalized polynomials
+    double getDiagonalMultiplier( const int degree )
+    {
+        return diagonalMultipliers_[ degree ];
+    }
+
+    //! Function to get the normalization factor used in the computation of the Legendre polynomial derivative
+    double getDerivativeNormalization( const int degree, const int order )
+    {
+        return derivativeNormalizations_[ degree * ( maximumPolynomialOrder_ + 1 ) + order ];
+    }
+
+    //! Work array for the Legendre polynomials at the current degree (entry m denotes order m)
+    LaneArrayList currentDegreeLegendreValues_;
+
+    //! Work array for the Legendre polynomials at the previous degree (entry m denotes order m)
+    LaneArrayList previousDegreeLegendreValues_;
+
+    //! Work array for the Legendre polynomials at two degrees prior (entry m denotes order m)
+    LaneArrayList secondPreviousDegreeLegendreValues_;
+
+    //! Work array for cosines of order times longitude (entry m denotes order m)
+    LaneArrayList cosinesOfLongitude_;
+
+    //! Work array for sines of order times longitude (entry m denotes order m)
+    LaneArrayList sinesOfLongitude_;
+
+private:
+
+    //! Maximum degree of cache.
+    int maximumDegree_;
+
+    //! Maximum order of cache.
+    int maximumOrder_;
+
+    //! Maximum order up to which the Legendre polynomials are computed.
+    int maximumPolynomialOrder_;
+
+    //! Multipliers of P_{n-1,m} in degree recursion (entry n * ( maximumPolynomialOrder_ + 1 ) + m).
+    std::vector< double > firstVerticalMultipliers_;
+
+    //! Multipliers of P_{n-2,m} in degree recursion (entry n * ( maximumPolynomialOrder_ + 1 ) + m).
+    std::vector< double > secondVerticalMultipliers_;
+
+    //! Multipliers of cosine of latitude times P_{n-1,n-1} in sectoral recursion (entry n).
+    std::vector< double > diagonalMultipliers_;
+
+    //! Normalization factors for derivative computation (entry n * ( maximumPolynomialOrder_ + 1 ) + m).
+    std::vector< double > derivativeNormalizations_;
+
+};
+
 //! Spherical coordinate indices.
 enum SphericalCoordinatesIndices{ radiusIndex, latitudeIndex, longitudeIndex };
 
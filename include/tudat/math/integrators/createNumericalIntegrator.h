@@ -239,11 +239,14 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
+        std::shared_ptr< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
                     areTolerancesDefinedAsScalar_, this->initialTimeDeprecated_, this->initialTimeStep_, coefficientSet_,
                     minimumStepSize_, maximumStepSize_, this->assessTerminationOnMinorSteps_,
                     safetyFactorForNextStepSize_, maximumFactorIncreaseForNextStepSize_, minimumFactorDecreaseForNextStepSize_,
                     exceptionIfMinimumStepExceeded_ );
+        clonedSettings->denseOutputType_ = denseOutputType_;
+        return clonedSettings;
     }
 
     // Virtual destructor.
@@ -278,6 +281,10 @@ public:
 
     bool exceptionIfMinimumStepExceeded_;
 
+    // Type of continuous extension used for dense output (e.g. for results output epochs and exact termination).
+    numerical_integrators::RungeKuttaDenseOutputTypes denseOutputType_ =
+            numerical_integrators::multi_step_hermite_dense_output;
+
 };
 
 // Class to define settings of variable step RK numerical integrator with scalar tolerances.
@@ -330,12 +337,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
+        std::shared_ptr< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     this->assessTerminationOnMinorSteps_,
                     this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
                     this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->denseOutputType_ = this->denseOutputType_;
+        return clonedSettings;
     }
     // Constructor.
     /*
@@ -463,12 +473,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
+        std::shared_ptr< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     this->assessTerminationOnMinorSteps_,
                     this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
                     this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->denseOutputType_ = this->denseOutputType_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -1084,6 +1097,11 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                       static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ),
                       nullptr, vectorTolerancesIntegratorSettings->exceptionIfMinimumStepExceeded_  );
         }
+
+        // Set type of continuous extension
+        std::dynamic_pointer_cast< RungeKuttaVariableStepSizeIntegrator
+                < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >(
+                    integrator )->setDenseOutputType( variableStepIntegratorSettings->denseOutputType_ );
         break;
     }
     case bulirschStoer:
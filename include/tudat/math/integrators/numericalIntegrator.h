@@ -129,6 +129,32 @@ public:
         throw std::runtime_error( "Function getPreviousState not implemented in this integrator" );
     }
 
+    //! Function to check whether a continuous extension (dense output) of the last step is available.
+    /*!
+     * Function to check whether a continuous extension (dense output) of the last step is available, i.e. whether
+     * getDenseOutputState can be called for independent variables between the previous and current independent
+     * variable. Derived classes that provide dense output should override this function.
+     * \return True if dense output is available for the last step.
+     */
+    virtual bool isDenseOutputAvailable( )
+    {
+        return false;
+    }
+
+    //! Function to compute the state at an independent variable in the last step, using dense output.
+    /*!
+     * Function to compute the state at an independent variable between the previous and current independent variable,
+     * using the continuous extension (dense output) of the last step. Derived classes
+     * should override this function. If not implemented, throws error.
+     * \param independentVariable Independent variable at which the state is to be computed.
+     * \return State at requested independent variable.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        throw std::runtime_error( "Function getDenseOutputState not implemented in this integrator" );
+    }
+
     //! Perform an integration to a specified independent variable value.
     /*!
      * Performs an integration to independentVariableEnd with initial state and initial independent
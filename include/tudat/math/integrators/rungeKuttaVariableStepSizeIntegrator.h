@@ -37,6 +37,32 @@ namespace tudat
 namespace numerical_integrators
 {
 
+//! Types of continuous extension (dense output) of a variable step size Runge-Kutta step.
+/*!
+ *  Types of continuous extension (dense output) of a variable step size Runge-Kutta step, used to compute the state at
+ *  any point within the last accepted step.
+ *  cubic_hermite_dense_output: cubic Hermite polynomial through the states and state derivatives at the start and end
+ *  of the step (local error O(h^4)). The state derivative at the end of the step is reused as the first stage of the
+ *  next step, so that no additional state derivative evaluations are required.
+ *  quintic_hermite_dense_output: quintic Hermite polynomial through the states and state derivatives at the start,
+ *  midpoint and end of the step (local error O(h^6)). The state at the midpoint is computed with an additional half
+ *  step of the same Runge-Kutta scheme, requiring (number of stages) additional state derivative evaluations for each
+ *  step in which dense output is requested.
+ *  multi_step_hermite_dense_output: Hermite polynomial through the states and state derivatives at the start and end
+ *  of the step, and at the start of the two preceding accepted steps (degree 7, local error O(h^8)). The state
+ *  derivatives at these points are the first stages of the steps, so that no additional state derivative evaluations
+ *  are required. In the first two steps after (re)initialization or a discontinuous change of the state, fewer
+ *  preceding steps are available, and the midpoint of the step is added as node (computed as for
+ *  quintic_hermite_dense_output). The preceding steps are stored from the first request for dense output onwards, so
+ *  that integrations in which no dense output is used are not affected.
+ */
+enum RungeKuttaDenseOutputTypes
+{
+    cubic_hermite_dense_output,
+    quintic_hermite_dense_output,
+    multi_step_hermite_dense_output
+};
+
 //! Class that implements the Runge-Kutta variable stepsize integrator.
 /*!
  * Class that implements the Runge-Kutta variable step size integrator.
@@ -81,6 +107,10 @@ public:
     typedef typename ReinitializableNumericalIntegratorBase::NumericalIntegratorBase::
     StateDerivativeFunction StateDerivativeFunction;
 
+    //! Typedef to a state derivative function that writes the state derivative into its last argument.
+    typedef std::function< void( const IndependentVariableType, const StateType&, StateDerivativeType& ) >
+    InPlaceStateDerivativeFunction;
+
     //! Exception that is thrown if the minimum step size is exceeded.
     /*!
      * Exception thrown by RungeKuttaVariableStepSizeIntegrator< >::
@@ -283,6 +313,44 @@ public:
      */
     virtual StateType performIntegrationStep( const TimeStepType stepSize );
 
+    //! Perform a single integration step, without returning the new state.
+    /*!
+     * Perform a single integration step and compute a new step size, identical to performIntegrationStep( ), but
+     * without returning a copy of the new state (which may be retrieved with getCurrentState( ) if required). The
+     * stage state derivatives, intermediate state and order estimates are stored in buffers that are sized on the
+     * first step and reused afterwards, so that no memory is allocated by the integrator itself (memory allocated in
+     * the state derivative function excepted) once the buffers are sized.
+     * \param stepSize The step size to take. If the time step is too large to satisfy the error
+     *          constraints, the step is redone until the error constraint is satisfied.
+     */
+    void performIntegrationStepInPlace( const TimeStepType stepSize );
+
+    //! Get number of times the stage buffers have been (re)sized.
+    /*!
+     * Returns the number of times the stage buffers (stage state derivatives, intermediate state and order
+     * estimates) have been (re)sized. This should be equal to one after the first step, unless the size of the state
+     * is modified during the integration.
+     * \return Number of times the stage buffers have been (re)sized.
+     */
+    int getNumberOfStageBufferAllocations( ) const
+    {
+        return numberOfStageBufferAllocations_;
+    }
+
+    //! Function to set a state derivative function that writes its result into a preallocated state derivative.
+    /*!
+     * Function to set a state derivative function f( t, x, dx ) that writes its result into dx, which is then used
+     * instead of the state derivative function passed to the constructor (which returns a new state derivative). The
+     * stage state derivatives are then computed directly in the stage buffers, so that no memory needs to be allocated
+     * for them once the buffers are sized. The output argument is sized consistently with the state before the function
+     * is called. Setting an empty function reverts to the state derivative function passed to the constructor.
+     * \param inPlaceStateDerivativeFunction State derivative function writing its result into its last argument.
+     */
+    void setInPlaceStateDerivativeFunction( const InPlaceStateDerivativeFunction& inPlaceStateDerivativeFunction )
+    {
+        inPlaceStateDerivativeFunction_ = inPlaceStateDerivativeFunction;
+    }
+
     //! Rollback internal state to the last state.
     /*!
      * Performs rollback of the internal state to the last state. This function can only be called
@@ -300,6 +368,7 @@ public:
 
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
+        resetDenseOutput( );
         return true;
     }
 
@@ -339,6 +408,16 @@ public:
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
+            resetDenseOutput( );
+        }
+        else
+        {
+            // State at end of step changed; dense output remains available, but must use the new state, and preceding
+            // steps can no longer be used
+            isEndOfStepStateDerivativeAvailable_ = false;
+            isMidpointStateAvailable_ = false;
+            numberOfPreviousDenseOutputNodes_ = 0;
+            isLastStepContinuousWithCurrentState_ = false;
         }
     }
 
@@ -358,6 +437,7 @@ public:
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
         }
+        resetDenseOutput( );
     }
 
     //! Function to toggle the use of step-size control
@@ -370,8 +450,112 @@ public:
         useStepSizeControl_ = useStepSizeControl;
     }
 
+    //! Function to check whether a continuous extension (dense output) of the last step is available.
+    /*!
+     * Function to check whether a continuous extension (dense output) of the last step is available. This is the case
+     * after a step has been accepted, until the state is rolled back or modified without allowing rollback.
+     * \return True if dense output is available for the last step.
+     */
+    bool isDenseOutputAvailable( )
+    {
+        return isDenseOutputDataAvailable_;
+    }
+
+    //! Function to compute the state at an independent variable in the last step, using dense output.
+    /*!
+     * Function to compute the state at an independent variable between the previous and current independent variable,
+     * using the continuous extension (dense output) of the last accepted step, as defined by the denseOutputType_.
+     * The additional state derivative evaluations required for the continuous extension are performed once per step,
+     * on the first call to this function for that step.
+     * \param independentVariable Independent variable at which the state is to be computed.
+     * \return State at requested independent variable.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable );
+
+    //! Function to set the type of continuous extension used for dense output.
+    /*!
+     * Function to set the type of continuous extension used for dense output.
+     * \param denseOutputType Type of continuous extension used for dense output.
+     */
+    void setDenseOutputType( const RungeKuttaDenseOutputTypes denseOutputType )
+    {
+        denseOutputType_ = denseOutputType;
+        isMidpointStateAvailable_ = false;
+        numberOfPreviousDenseOutputNodes_ = 0;
+    }
+
+    //! Function to retrieve the type of continuous extension used for dense output.
+    /*!
+     * Function to retrieve the type of continuous extension used for dense output.
+     * \return Type of continuous extension used for dense output.
+     */
+    RungeKuttaDenseOutputTypes getDenseOutputType( )
+    {
+        return denseOutputType_;
+    }
+
+    //! Function to retrieve the number of state derivative evaluations performed for dense output.
+    /*!
+     * Function to retrieve the number of state derivative evaluations performed for dense output, excluding those at
+     * the end of the step, which are reused as first stage of the next step.
+     * \return Number of state derivative evaluations performed for dense output.
+     */
+    int getNumberOfDenseOutputStateDerivativeEvaluations( )
+    {
+        return numberOfDenseOutputStateDerivativeEvaluations_;
+    }
+
 protected:
 
+    //! Function to reset the dense output data, after the state and/or independent variable have been modified.
+    void resetDenseOutput( )
+    {
+        isDenseOutputDataAvailable_ = false;
+        isEndOfStepStateDerivativeAvailable_ = false;
+        isMidpointStateAvailable_ = false;
+        numberOfPreviousDenseOutputNodes_ = 0;
+    }
+
+    //! Function to compute the state derivative, using the in-place state derivative function if it is set.
+    void computeStateDerivative( const IndependentVariableType independentVariable, const StateType& state,
+                                 StateDerivativeType& stateDerivative )
+    {
+        if( inPlaceStateDerivativeFunction_ )
+        {
+            if( stateDerivative.rows( ) != state.rows( ) || stateDerivative.cols( ) != state.cols( ) )
+            {
+                stateDerivative.resize( state.rows( ), state.cols( ) );
+            }
+            inPlaceStateDerivativeFunction_( independentVariable, state, stateDerivative );
+        }
+        else
+        {
+            stateDerivative = this->stateDerivativeFunction_( independentVariable, state );
+        }
+    }
+
+    //! Function to compute the state derivative at the end of the last step (if not yet computed).
+    void computeEndOfStepStateDerivative( );
+
+    //! Function to compute the state and state derivative at the midpoint of the last step (if not yet computed).
+    void computeMidpointState( );
+
+    //! Function to size the stage buffers, if not yet consistent with the current state.
+    void allocateStageBuffers( )
+    {
+        const int numberOfStages = this->coefficients_.cCoefficients.rows( );
+        if( static_cast< int >( currentStateDerivatives_.size( ) ) != numberOfStages ||
+                intermediateState_.rows( ) != currentState_.rows( ) ||
+                intermediateState_.cols( ) != currentState_.cols( ) )
+        {
+            currentStateDerivatives_.resize( numberOfStages );
+            intermediateState_ = currentState_;
+            lowerOrderEstimate_ = currentState_;
+            higherOrderEstimate_ = currentState_;
+            numberOfStageBufferAllocations_++;
+        }
+    }
+
     //! Computes the next step size and validates the result.
     /*!
      * Computes the next step size based on a higher and lower order estimate, determines if the
@@ -504,12 +688,78 @@ protected:
      */
     NewStepSizeFunction newStepSizeFunction_;
 
+    //! State derivative function writing its result into its last argument (used instead of stateDerivativeFunction_ if set).
+    InPlaceStateDerivativeFunction inPlaceStateDerivativeFunction_;
+
     //! Vector of state derivatives.
     /*!
      * Vector of state derivatives, i.e. values of k_{i} in Runge-Kutta scheme.
      */
     std::vector< StateDerivativeType > currentStateDerivatives_;
 
+    //! Intermediate state passed to the state derivative function for the current stage (reused between steps).
+    StateType intermediateState_;
+
+    //! Lower order estimate of the state at the end of the current step (reused between steps).
+    StateType lowerOrderEstimate_;
+
+    //! Higher order estimate of the state at the end of the current step (reused between steps).
+    StateType higherOrderEstimate_;
+
+    //! Number of times the stage buffers have been (re)sized.
+    int numberOfStageBufferAllocations_ = 0;
+
+    //! Type of continuous extension used for dense output.
+    RungeKuttaDenseOutputTypes denseOutputType_ = multi_step_hermite_dense_output;
+
+    //! Boolean denoting whether the data for the dense output of the last step is available.
+    bool isDenseOutputDataAvailable_ = false;
+
+    //! State derivative at the start of the last accepted step.
+    StateDerivativeType startOfStepStateDerivative_;
+
+    //! State derivative at the end of the last accepted step (reused as first stage of the next step).
+    StateDerivativeType endOfStepStateDerivative_;
+
+    //! Boolean denoting whether endOfStepStateDerivative_ has been computed for the current state.
+    bool isEndOfStepStateDerivativeAvailable_ = false;
+
+    //! State at the midpoint of the last accepted step.
+    StateType midpointState_;
+
+    //! State derivative at the midpoint of the last accepted step.
+    StateDerivativeType midpointStateDerivative_;
+
+    //! Boolean denoting whether midpointState_ and midpointStateDerivative_ have been computed for the last step.
+    bool isMidpointStateAvailable_ = false;
+
+    //! Stage state derivatives of the half step used to compute the midpoint state.
+    std::vector< StateDerivativeType > midpointStateDerivatives_;
+
+    //! Boolean denoting whether dense output has been requested (after which nodes of preceding steps are stored).
+    bool isDenseOutputRequested_ = false;
+
+    //! Boolean denoting whether the last accepted step ends at the current state (i.e. state not modified since).
+    bool isLastStepContinuousWithCurrentState_ = false;
+
+    //! Maximum number of preceding steps used by multi_step_hermite_dense_output.
+    static const int maximumNumberOfPreviousDenseOutputNodes_ = 2;
+
+    //! Number of preceding steps (oldest first) of which the start is stored for multi_step_hermite_dense_output.
+    int numberOfPreviousDenseOutputNodes_ = 0;
+
+    //! Independent variables at the start of the preceding steps (oldest first).
+    IndependentVariableType previousDenseOutputNodeIndependentVariables_[ maximumNumberOfPreviousDenseOutputNodes_ ];
+
+    //! States at the start of the preceding steps (oldest first).
+    StateType previousDenseOutputNodeStates_[ maximumNumberOfPreviousDenseOutputNodes_ ];
+
+    //! State derivatives at the start of the preceding steps (oldest first).
+    StateDerivativeType previousDenseOutputNodeStateDerivatives_[ maximumNumberOfPreviousDenseOutputNodes_ ];
+
+    //! Number of state derivative evaluations performed for dense output.
+    int numberOfDenseOutputStateDerivativeEvaluations_ = 0;
+
     bool exceptionIfMinimumStepExceeded_;
 
     //! Boolean denoting whether step size control is to be used
@@ -528,80 +778,293 @@ StateType
 RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
 ::performIntegrationStep( const TimeStepType stepSize )
 {
-    if( !( stepSize == stepSize ) )
+    performIntegrationStepInPlace( stepSize );
+    return this->currentState_;
+}
+
+//! Perform a single integration step, without returning the new state.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::performIntegrationStepInPlace( const TimeStepType stepSize )
+{
+    // Size buffers for the stages, if not yet done.
+    allocateStageBuffers( );
+
+    // Repeat step until the error is within bounds.
+    TimeStepType currentStepSize = stepSize;
+    while( true )
     {
-        throw std::invalid_argument( "Error in RKF integrator, step size is NaN" );
-    }
+        if( !( currentStepSize == currentStepSize ) )
+        {
+            throw std::invalid_argument( "Error in RKF integrator, step size is NaN" );
+        }
 
-    // Define and allocated vector for the number of stages.
-    currentStateDerivatives_.clear( );
-    currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
+        // Initialize lower and higher order estimates.
+        lowerOrderEstimate_ = this->currentState_;
+        higherOrderEstimate_ = this->currentState_;
 
-    // Define lower and higher order estimates.
-    StateType lowerOrderEstimate( this->currentState_ ), higherOrderEstimate( this->currentState_ );
+        // Compute the k_i state derivatives per stage.
+        for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
+        {
+            // Compute the intermediate state to pass to the state derivative for this stage.
+            intermediateState_ = this->currentState_;
+            for ( int column = 0; column < stage; column++ )
+            {
+                intermediateState_.noalias( ) += currentStepSize * this->coefficients_.aCoefficients( stage, column ) *
+                        currentStateDerivatives_[ column ];
+            }
 
-    // Compute the k_i state derivatives per stage.
-    for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
-    {
-        // Compute the intermediate state to pass to the state derivative for this stage.
-        StateType intermediateState( this->currentState_ );
+            // Compute the state derivative.
+            const IndependentVariableType time = this->currentIndependentVariable_ +
+                    this->coefficients_.cCoefficients( stage ) * currentStepSize;
+            if( stage == 0 && isEndOfStepStateDerivativeAvailable_ )
+            {
+                // Reuse state derivative computed for dense output of previous step
+                currentStateDerivatives_[ stage ] = endOfStepStateDerivative_;
+            }
+            else
+            {
+                computeStateDerivative( time, intermediateState_, currentStateDerivatives_[ stage ] );
+            }
 
-        // Compute the intermediate state.
-        for ( int column = 0; column < stage; column++ )
+            // Check if propagation should terminate because the propagation termination condition has been reached
+            // while computing the intermediate state.
+            // If so, return immediately, leaving the current state (not recomputed yet), which will be discarded.
+            if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+            {
+                this->propagationTerminationConditionReachedDuringStep_ = true;
+                return;
+            }
+
+            // Update the estimate.
+            lowerOrderEstimate_.noalias( ) += this->coefficients_.bCoefficients( 0, stage ) * currentStepSize *
+                    currentStateDerivatives_[ stage ];
+            higherOrderEstimate_.noalias( ) += this->coefficients_.bCoefficients( 1, stage ) * currentStepSize *
+                    currentStateDerivatives_[ stage ];
+        }
+
+        // Determine if the error was within bounds and compute a new step size.
+        if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate_, higherOrderEstimate_, currentStepSize ) )
         {
-            intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column ) *
-                    currentStateDerivatives_[ column ];
+            // Store start of previous step as node for multi-step dense output, if it is continuous with this step
+            if( denseOutputType_ == multi_step_hermite_dense_output && isDenseOutputRequested_ &&
+                    isDenseOutputDataAvailable_ && isLastStepContinuousWithCurrentState_ )
+            {
+                if( numberOfPreviousDenseOutputNodes_ == maximumNumberOfPreviousDenseOutputNodes_ )
+                {
+                    for( int i = 1; i < maximumNumberOfPreviousDenseOutputNodes_; i++ )
+                    {
+                        std::swap( previousDenseOutputNodeStates_[ i - 1 ], previousDenseOutputNodeStates_[ i ] );
+                        std::swap( previousDenseOutputNodeStateDerivatives_[ i - 1 ],
+                                   previousDenseOutputNodeStateDerivatives_[ i ] );
+                        previousDenseOutputNodeIndependentVariables_[ i - 1 ] =
+                                previousDenseOutputNodeIndependentVariables_[ i ];
+                    }
+                    numberOfPreviousDenseOutputNodes_--;
+                }
+                previousDenseOutputNodeIndependentVariables_[ numberOfPreviousDenseOutputNodes_ ] =
+                        this->lastIndependentVariable_;
+                previousDenseOutputNodeStates_[ numberOfPreviousDenseOutputNodes_ ] = this->lastState_;
+                previousDenseOutputNodeStateDerivatives_[ numberOfPreviousDenseOutputNodes_ ] =
+                        startOfStepStateDerivative_;
+                numberOfPreviousDenseOutputNodes_++;
+            }
+            else
+            {
+                numberOfPreviousDenseOutputNodes_ = 0;
+            }
+
+            // Accept the current step.
+            this->lastIndependentVariable_ = this->currentIndependentVariable_;
+            this->lastState_ = this->currentState_;
+            this->currentIndependentVariable_ += currentStepSize;
+
+            // Store data for dense output
+            isDenseOutputDataAvailable_ = ( currentStateDerivatives_.size( ) > 0 );
+            if( isDenseOutputDataAvailable_ )
+            {
+                startOfStepStateDerivative_ = currentStateDerivatives_[ 0 ];
+            }
+            isEndOfStepStateDerivativeAvailable_ = false;
+            isMidpointStateAvailable_ = false;
+            isLastStepContinuousWithCurrentState_ = true;
+
+            switch ( this->coefficients_.orderEstimateToIntegrate )
+            {
+            case RungeKuttaCoefficients::lower:
+                this->currentState_ = lowerOrderEstimate_;
+                return;
+
+            case RungeKuttaCoefficients::higher:
+                this->currentState_ = higherOrderEstimate_;
+                return;
+
+            default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
+                throw std::runtime_error( "Order estimate to integrate is invalid." );
+            }
         }
+        else
+        {
+            // Reject current step, and redo it with new step size.
+            currentStepSize = this->stepSize_;
+        }
+    }
+}
 
-        // Compute the state derivative.
-        const IndependentVariableType time = this->currentIndependentVariable_ +
-                this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+//! Function to compute the state derivative at the end of the last step (if not yet computed).
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::computeEndOfStepStateDerivative( )
+{
+    if( !isEndOfStepStateDerivativeAvailable_ )
+    {
+        computeStateDerivative( this->currentIndependentVariable_, this->currentState_, endOfStepStateDerivative_ );
+        isEndOfStepStateDerivativeAvailable_ = true;
+    }
+}
 
-        // Check if propagation should terminate because the propagation termination condition has been reached
-        // while computing the intermediate state.
-        // If so, return immediately the current state (not recomputed yet), which will be discarded.
-        if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+//! Function to compute the state and state derivative at the midpoint of the last step (if not yet computed).
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::computeMidpointState( )
+{
+    if( !isMidpointStateAvailable_ )
+    {
+        const TimeStepType halfStepSize = static_cast< TimeStepType >(
+                    this->currentIndependentVariable_ - this->lastIndependentVariable_ ) / 2.0;
+        const int estimateIndex =
+                ( this->coefficients_.orderEstimateToIntegrate == RungeKuttaCoefficients::lower ) ? 0 : 1;
+
+        // Perform half step from start of last step, with the same Runge-Kutta scheme
+        midpointStateDerivatives_.resize( this->coefficients_.cCoefficients.rows( ) );
+        midpointState_ = this->lastState_;
+        for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
         {
-            this->propagationTerminationConditionReachedDuringStep_ = true;
-            return this->currentState_;
+            if( stage == 0 )
+            {
+                midpointStateDerivatives_[ stage ] = startOfStepStateDerivative_;
+            }
+            else
+            {
+                intermediateState_ = this->lastState_;
+                for ( int column = 0; column < stage; column++ )
+                {
+                    intermediateState_.noalias( ) += halfStepSize * this->coefficients_.aCoefficients( stage, column ) *
+                            midpointStateDerivatives_[ column ];
+                }
+                computeStateDerivative(
+                            this->lastIndependentVariable_ + this->coefficients_.cCoefficients( stage ) * halfStepSize,
+                            intermediateState_, midpointStateDerivatives_[ stage ] );
+                numberOfDenseOutputStateDerivativeEvaluations_++;
+            }
+            midpointState_.noalias( ) += this->coefficients_.bCoefficients( estimateIndex, stage ) * halfStepSize *
+                    midpointStateDerivatives_[ stage ];
         }
 
-        // Update the estimate.
-        lowerOrderEstimate += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
-        higherOrderEstimate += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
+        computeStateDerivative( this->lastIndependentVariable_ + halfStepSize, midpointState_, midpointStateDerivative_ );
+        numberOfDenseOutputStateDerivativeEvaluations_++;
+        isMidpointStateAvailable_ = true;
     }
+}
 
-    // Determine if the error was within bounds and compute a new step size.
-    if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate,
-                                               higherOrderEstimate, stepSize ) )
+//! Function to compute the state at an independent variable in the last step, using dense output.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::getDenseOutputState( const IndependentVariableType independentVariable )
+{
+    if( !isDenseOutputDataAvailable_ )
     {
-        // Accept the current step.
-        this->lastIndependentVariable_ = this->currentIndependentVariable_;
-        this->lastState_ = this->currentState_;
-        this->currentIndependentVariable_ += stepSize;
+        throw std::runtime_error( "Error when computing dense output of RK integrator, no accepted step available." );
+    }
 
-        switch ( this->coefficients_.orderEstimateToIntegrate )
-        {
-        case RungeKuttaCoefficients::lower:
-            this->currentState_ = lowerOrderEstimate;
-            return this->currentState_;
+    // Compute normalized independent variable in last step
+    const TimeStepType stepSize = static_cast< TimeStepType >(
+                this->currentIndependentVariable_ - this->lastIndependentVariable_ );
+    const TimeStepType normalizedTime = static_cast< TimeStepType >(
+                independentVariable - this->lastIndependentVariable_ ) / stepSize;
+    if( normalizedTime < -1.0E-12 || normalizedTime > 1.0 + 1.0E-12 )
+    {
+        throw std::runtime_error( "Error when computing dense output of RK integrator, requested independent variable is "
+                                  "outside of last step." );
+    }
 
-        case RungeKuttaCoefficients::higher:
-            this->currentState_ = higherOrderEstimate;
-            return this->currentState_;
+    computeEndOfStepStateDerivative( );
+    isDenseOutputRequested_ = true;
 
-        default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
-            throw std::runtime_error( "Order estimate to integrate is invalid." );
+    // Collect nodes (normalized independent variable, state and state derivative) of the Hermite interpolant
+    const int maximumNumberOfNodes = maximumNumberOfPreviousDenseOutputNodes_ + 3;
+    TimeStepType normalizedNodes[ maximumNumberOfNodes ];
+    const StateType* nodeStates[ maximumNumberOfNodes ];
+    const StateDerivativeType* nodeStateDerivatives[ maximumNumberOfNodes ];
+    int numberOfNodes = 0;
+    if( denseOutputType_ == multi_step_hermite_dense_output )
+    {
+        for( int i = 0; i < numberOfPreviousDenseOutputNodes_; i++ )
+        {
+            normalizedNodes[ numberOfNodes ] = static_cast< TimeStepType >(
+                        previousDenseOutputNodeIndependentVariables_[ i ] - this->lastIndependentVariable_ ) / stepSize;
+            nodeStates[ numberOfNodes ] = &previousDenseOutputNodeStates_[ i ];
+            nodeStateDerivatives[ numberOfNodes ] = &previousDenseOutputNodeStateDerivatives_[ i ];
+            numberOfNodes++;
         }
     }
-    else
+
+    normalizedNodes[ numberOfNodes ] = 0.0;
+    nodeStates[ numberOfNodes ] = &this->lastState_;
+    nodeStateDerivatives[ numberOfNodes ] = &startOfStepStateDerivative_;
+    numberOfNodes++;
+
+    if( denseOutputType_ == quintic_hermite_dense_output ||
+            ( denseOutputType_ == multi_step_hermite_dense_output &&
+              numberOfPreviousDenseOutputNodes_ < maximumNumberOfPreviousDenseOutputNodes_ ) )
     {
-        // Reject current step.
-        return performIntegrationStep( this->stepSize_ );
+        computeMidpointState( );
+        normalizedNodes[ numberOfNodes ] = 0.5;
+        nodeStates[ numberOfNodes ] = &midpointState_;
+        nodeStateDerivatives[ numberOfNodes ] = &midpointStateDerivative_;
+        numberOfNodes++;
+    }
+
+    normalizedNodes[ numberOfNodes ] = 1.0;
+    nodeStates[ numberOfNodes ] = &this->currentState_;
+    nodeStateDerivatives[ numberOfNodes ] = &endOfStepStateDerivative_;
+    numberOfNodes++;
+
+    // Compute Hermite interpolant: sum over nodes i of (1 - 2 (s - s_i) l_i'(s_i)) l_i(s)^2 y_i + (s - s_i) l_i(s)^2 h f_i,
+    // with l_i the Lagrange polynomial of node i
+    StateType denseOutputState;
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        TimeStepType lagrangePolynomial = 1.0;
+        TimeStepType lagrangePolynomialDerivativeAtNode = 0.0;
+        for( int j = 0; j < numberOfNodes; j++ )
+        {
+            if( j != i )
+            {
+                lagrangePolynomial *= ( normalizedTime - normalizedNodes[ j ] ) /
+                        ( normalizedNodes[ i ] - normalizedNodes[ j ] );
+                lagrangePolynomialDerivativeAtNode += 1.0 / ( normalizedNodes[ i ] - normalizedNodes[ j ] );
+            }
+        }
+        const TimeStepType lagrangePolynomialSquared = lagrangePolynomial * lagrangePolynomial;
+        const TimeStepType stateWeight = ( 1.0 - 2.0 * ( normalizedTime - normalizedNodes[ i ] ) *
+                                           lagrangePolynomialDerivativeAtNode ) * lagrangePolynomialSquared;
+        const TimeStepType stateDerivativeWeight =
+                ( normalizedTime - normalizedNodes[ i ] ) * lagrangePolynomialSquared * stepSize;
+        if( i == 0 )
+        {
+            denseOutputState = stateWeight * ( *nodeStates[ i ] ) + stateDerivativeWeight * ( *nodeStateDerivatives[ i ] );
+        }
+        else
+        {
+            denseOutputState += stateWeight * ( *nodeStates[ i ] ) + stateDerivativeWeight * ( *nodeStateDerivatives[ i ] );
+        }
     }
+    return denseOutputState;
 }
 
 //! Compute the next step size and validate the result.
@@ -697,25 +1160,13 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
 {
     TUDAT_UNUSED_PARAMETER( minimumAndMaximumFactorsForNextStepSize );
 
-    // Compute the truncation error based on the higher and lower order estimates.
-    const StateType truncationError_ =
-            ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( );
-
-    // Compute error tolerance based on relative and absolute error tolerances.
-    const StateType errorTolerance_ =
-            ( higherOrderEstimate.array( ).abs( ) *
-              relativeErrorTolerance.array( ) ).matrix( )
-            + absoluteErrorTolerance;
-
-    // Compute relative truncation error. This will indicate if the current step satisfies the
-    // required tolerances.
-    const StateType relativeTruncationError_ = truncationError_.array( ) /
-            errorTolerance_.array( );
-
-    // Compute the maximum error based on the largest coefficient in the relative truncation error
-    // matrix.
-    const typename StateType::Scalar maximumErrorInState_
-            = relativeTruncationError_.array( ).abs( ).maxCoeff( );
+    // Compute the maximum relative truncation error, based on the higher and lower order estimates, and the error
+    // tolerance based on relative and absolute error tolerances. This will indicate if the current step satisfies the
+    // required tolerances. The expression is evaluated without temporary states.
+    const typename StateType::Scalar maximumErrorInState_ =
+            ( ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( ) /
+              ( higherOrderEstimate.array( ).abs( ) * relativeErrorTolerance.array( ) +
+                absoluteErrorTolerance.array( ) ) ).maxCoeff( );
 
     // Compute the new step size. This is based off of the equation given in
     // (Montenbruck and Gill, 2005).
@@ -137,9 +137,6 @@ public:
         // interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -218,8 +215,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -305,18 +300,16 @@ public:
             }
             else
             {
-                // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
+                // Set up repeated numerator from differences w.r.t. independent variable values from which
+                // interpolant is created. The differences are recomputed (identically) when evaluating the
+                // interpolating polynomial, rather than stored in a member, so that the interpolator can be
+                // evaluated from multiple threads concurrently.
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
+                    repeatedNumerator *= static_cast< ScalarType >(
                                 targetIndependentVariableValue - independentValues_[ j ] );
-
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
-
                 }
 
                 // Evaluate interpolating polynomial at requested data point.
@@ -325,7 +318,7 @@ public:
                     j = i + lowerEntry - offsetEntries_;
                     interpolatedValue += dependentValues_[ j ]  *
                             ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
+                              ( static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ j ] ) *
                                 denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
                 }
             }
@@ -483,8 +476,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     std::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
@@ -12,6 +12,7 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <atomic>
 #include <vector>
 #include <iostream>
 #include <memory>
@@ -94,7 +95,10 @@ protected:
 
 //! Look-up scheme class for nearest left neighbour search using hunting algorithm.
 /*!
- *  Look-up scheme class for nearest left neighbour search using hunting algorithm.
+ *  Look-up scheme class for nearest left neighbour search using hunting algorithm. The index found in the previous call
+ *  is stored atomically, so that a single object may be used concurrently from multiple threads (e.g. an interpolator
+ *  shared by cloned environments). In that case, each lookup starts from the index found in the most recent call by any
+ *  thread, which affects only the efficiency, and not the result, of the lookup.
  *  \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
  */
 template< typename IndependentVariableType >
@@ -106,15 +110,14 @@ public:
 
     //! Constructor, used to set data vector.
     /*!
-     *  Constructor, used to set data vector. Initializes guess from 'previous' request to 0.
+     *  Constructor, used to set data vector. Initializes index from 'previous' request to denote that no lookup is done.
      * \param independentVariableValues vector of independent variable values in which to perform
      * lookup procedure.
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
         : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+          previousNearestLowerIndex_( -1 )
     { }
 
     //! Default destructor
@@ -135,22 +138,22 @@ public:
     {
         // Initialize return value.
         int newNearestLowerIndex = 0;
+        int previousNearestLowerIndex = previousNearestLowerIndex_.load( std::memory_order_relaxed );
 
         // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+        if ( previousNearestLowerIndex < 0 )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                     < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
         }
 
         else
         {
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
+                 ( previousNearestLowerIndex, valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                newNearestLowerIndex = previousNearestLowerIndex;
 
             }
 
@@ -160,30 +163,24 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, previousNearestLowerIndex, independentVariableValues_ );
 
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
 
         return newNearestLowerIndex;
     }
 
 private:
 
-    //! Boolean to denote whether a lookup has been done.
+    //! Nearest left index during previous call (-1 if no lookup has been done yet).
     /*!
-     * Boolean to denote whether a lookup has been done.
+     * Nearest left index during previous call (-1 if no lookup has been done yet)
      */
-    bool isFirstLookupDone;
-
-    //! Nearest left index during previous call.
-    /*!
-     * Nearest left index during previous call
-     */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
@@ -11,6 +11,7 @@
 #ifndef TUDAT_RANDOM_SAMPLING_H
 #define TUDAT_RANDOM_SAMPLING_H
 
+#include <functional>
 #include <map>
 
 #include <Eigen/Core>
@@ -88,6 +89,44 @@ std::vector< Eigen::VectorXd > generateUniformRandomSample(
 
 
 
+//! Create generators of independent, but not identically, Gaussian distributed random variables.
+/*!
+ *  Create generators of independent, but not identically, Gaussian distributed random variables, using seed + i as the
+ *  seed for the generator of entry i.
+ *  \param seed Seed of random number generator for the first entry.
+ *  \param mean Vector of mean values for the distributions of the random variables.
+ *  \param standardDeviation Vector of standard deviations for the distributions of the random variables.
+ *  \return Random variable generators, one for each entry of mean and standardDeviation.
+ */
+std::vector< std::shared_ptr< RandomVariableGenerator< double > > > createGaussianRandomVariableGenerators(
+        const int seed, const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation );
+
+//! Create function that generates a single random vector per call, with entries of each vector independently, but not
+//! identically, distributed.
+/*!
+ *  Create function that generates a single random vector per call, with entries of each vector independently, but not
+ *  identically, distributed. Calling the function N times produces the same vectors (in the same order) as
+ *  generateRandomSampleFromGenerator with the same generators and N samples. The returned function modifies the state
+ *  of the generators, and may not be called concurrently.
+ *  \param randomVariableGenerators List of random variable generators, one for each entry of the random vectors.
+ *  \return Function generating a single random vector per call.
+ */
+std::function< Eigen::VectorXd( ) > createRandomSampleFunctionFromGenerator(
+        const std::vector< std::shared_ptr< RandomVariableGenerator< double > > > randomVariableGenerators );
+
+//! Create function that generates a single Gaussian distributed random vector per call.
+/*!
+ *  Create function that generates a single random vector per call, with entries of each vector independently, but not
+ *  identically, Gaussian distributed. Calling the function N times produces the same vectors as
+ *  generateGaussianRandomSample with the same seed and distribution settings, without storing the full sample.
+ *  \param seed Seed of random number generator.
+ *  \param mean Vector of mean values for the distributions for the entries of the random vectors.
+ *  \param standardDeviation Vector of standard deviations for the distributions for the entries of the random vectors.
+ *  \return Function generating a single random vector per call.
+ */
+std::function< Eigen::VectorXd( ) > createGaussianRandomSampleFunction(
+        const int seed, const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation );
+
 //! Generate sample of random vectors, with entries of each vector independently, but not identically, Gaussian distributed.
 /*!
  *  Function to generate sample of random vectors, with entries of each vector independently, but not identically,
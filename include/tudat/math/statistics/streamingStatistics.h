@@ -0,0 +1,289 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_STREAMING_STATISTICS_H
+#define TUDAT_STREAMING_STATISTICS_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Class to compute the mean and covariance of a sample of vectors, without storing the sample.
+/*!
+ *  Class to compute the mean and covariance of a sample of vectors, without storing the sample. Samples are added one at
+ *  a time, and the mean and (unbiased) sample covariance are updated using the numerically stable algorithm of
+ *  Welford (1962). Two objects may be combined using the pairwise update of Chan et al. (1979), so that statistics of
+ *  (sub)samples computed independently can be merged.
+ */
+class RunningMeanAndCovariance
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param vectorSize Size of the vectors that are to be added to the sample.
+     */
+    RunningMeanAndCovariance( const int vectorSize = 0 );
+
+    //! Function to add a single vector to the sample
+    /*!
+     *  Function to add a single vector to the sample, updating the mean and covariance.
+     *  \param sampleVector Vector that is to be added (must be of size vectorSize).
+     */
+    void addSample( const Eigen::VectorXd& sampleVector );
+
+    //! Function to merge the statistics of another sample into the current object
+    /*!
+     *  Function to merge the statistics of another sample into the current object, so that the current object provides
+     *  the statistics of the combined sample.
+     *  \param otherStatistics Statistics of the sample that is to be merged into the current object.
+     */
+    void merge( const RunningMeanAndCovariance& otherStatistics );
+
+    //! Function to retrieve the number of vectors in the sample
+    /*!
+     *  Function to retrieve the number of vectors in the sample
+     *  \return Number of vectors in the sample
+     */
+    unsigned int getNumberOfSamples( ) const
+    {
+        return numberOfSamples_;
+    }
+
+    //! Function to retrieve the sample mean
+    /*!
+     *  Function to retrieve the sample mean
+     *  \return Sample mean
+     */
+    Eigen::VectorXd getMean( ) const
+    {
+        return mean_;
+    }
+
+    //! Function to retrieve the unbiased sample covariance
+    /*!
+     *  Function to retrieve the unbiased sample covariance (zero if less than two vectors are in the sample).
+     *  \return Unbiased sample covariance
+     */
+    Eigen::MatrixXd getCovariance( ) const;
+
+    //! Function to retrieve the unbiased sample standard deviation of each of the entries of the vectors
+    /*!
+     *  Function to retrieve the unbiased sample standard deviation of each of the entries of the vectors
+     *  \return Unbiased sample standard deviation per entry
+     */
+    Eigen::VectorXd getStandardDeviation( ) const;
+
+private:
+
+    //! Number of vectors in the sample
+    unsigned int numberOfSamples_;
+
+    //! Current sample mean
+    Eigen::VectorXd mean_;
+
+    //! Current sum of outer products of deviations w.r.t. the mean
+    Eigen::MatrixXd sumOfSquaredDeviations_;
+};
+
+//! Class to estimate a single quantile of a sample of scalars, without storing the sample.
+/*!
+ *  Class to estimate a single quantile of a sample of scalars, without storing the sample, using the P-squared algorithm
+ *  of Jain and Chlamtac (1985). Five markers are maintained, and their heights are adjusted using piecewise-parabolic
+ *  interpolation as samples are added. The memory use is independent of the sample size. For samples of fewer than
+ *  five values, the exact quantile (with linear interpolation between order statistics) is returned. The estimate
+ *  depends on the order in which the samples are added.
+ */
+class P2QuantileEstimator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param probability Probability (in the range [0,1]) of the quantile that is to be estimated.
+     */
+    P2QuantileEstimator( const double probability );
+
+    //! Function to add a single value to the sample
+    /*!
+     *  Function to add a single value to the sample
+     *  \param value Value that is to be added
+     */
+    void addSample( const double value );
+
+    //! Function to retrieve the current estimate of the quantile
+    /*!
+     *  Function to retrieve the current estimate of the quantile (NaN if the sample is empty)
+     *  \return Current estimate of the quantile
+     */
+    double getQuantile( ) const;
+
+    //! Function to retrieve the probability of the quantile that is estimated
+    /*!
+     *  Function to retrieve the probability of the quantile that is estimated
+     *  \return Probability of the quantile that is estimated
+     */
+    double getProbability( ) const
+    {
+        return probability_;
+    }
+
+    //! Function to retrieve the number of values in the sample
+    /*!
+     *  Function to retrieve the number of values in the sample
+     *  \return Number of values in the sample
+     */
+    unsigned int getNumberOfSamples( ) const
+    {
+        return numberOfSamples_;
+    }
+
+private:
+
+    //! Function to compute the parabolic prediction of the height of marker i, when moving it by d (-1 or 1)
+    double computeParabolicHeight( const int i, const double d ) const;
+
+    //! Function to compute the linear prediction of the height of marker i, when moving it by d (-1 or 1)
+    double computeLinearHeight( const int i, const int d ) const;
+
+    //! Probability of the quantile that is estimated
+    double probability_;
+
+    //! Number of values in the sample
+    unsigned int numberOfSamples_;
+
+    //! Marker heights
+    double markerHeights_[ 5 ];
+
+    //! Actual marker positions
+    int markerPositions_[ 5 ];
+
+    //! Desired marker positions
+    double desiredMarkerPositions_[ 5 ];
+
+    //! Increments of the desired marker positions per added value
+    double desiredMarkerPositionIncrements_[ 5 ];
+};
+
+//! Class to compute summary statistics of a sample of vectors, without storing the sample.
+/*!
+ *  Class to compute summary statistics of a sample of vectors, without storing the sample. The mean and covariance are
+ *  computed with a RunningMeanAndCovariance object, and a list of quantiles (percentiles) of each entry of the vectors is
+ *  estimated with P2QuantileEstimator objects. Both the memory use and the cost per added vector are independent of the
+ *  sample size.
+ */
+class StreamingVectorStatistics
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param vectorSize Size of the vectors that are to be added to the sample.
+     *  \param quantileProbabilities Probabilities (in the range [0,1]) of the quantiles that are to be estimated for
+     *  each entry of the vectors.
+     */
+    StreamingVectorStatistics( const int vectorSize = 0,
+                               const std::vector< double >& quantileProbabilities = std::vector< double >( ) );
+
+    //! Function to add a single vector to the sample
+    /*!
+     *  Function to add a single vector to the sample
+     *  \param sampleVector Vector that is to be added (must be of size vectorSize).
+     */
+    void addSample( const Eigen::VectorXd& sampleVector );
+
+    //! Function to retrieve the number of vectors in the sample
+    /*!
+     *  Function to retrieve the number of vectors in the sample
+     *  \return Number of vectors in the sample
+     */
+    unsigned int getNumberOfSamples( ) const
+    {
+        return meanAndCovariance_.getNumberOfSamples( );
+    }
+
+    //! Function to retrieve the sample mean
+    /*!
+     *  Function to retrieve the sample mean
+     *  \return Sample mean
+     */
+    Eigen::VectorXd getMean( ) const
+    {
+        return meanAndCovariance_.getMean( );
+    }
+
+    //! Function to retrieve the unbiased sample covariance
+    /*!
+     *  Function to retrieve the unbiased sample covariance
+     *  \return Unbiased sample covariance
+     */
+    Eigen::MatrixXd getCovariance( ) const
+    {
+        return meanAndCovariance_.getCovariance( );
+    }
+
+    //! Function to retrieve the estimated quantiles
+    /*!
+     *  Function to retrieve the estimated quantiles
+     *  \return Matrix with estimated quantiles, with row i denoting vector entry i, and column j denoting the quantile
+     *  with probability quantileProbabilities[ j ].
+     */
+    Eigen::MatrixXd getQuantiles( ) const;
+
+    //! Function to retrieve the probabilities of the quantiles that are estimated
+    /*!
+     *  Function to retrieve the probabilities of the quantiles that are estimated
+     *  \return Probabilities of the quantiles that are estimated
+     */
+    std::vector< double > getQuantileProbabilities( ) const
+    {
+        return quantileProbabilities_;
+    }
+
+    //! Function to retrieve the object computing the mean and covariance
+    /*!
+     *  Function to retrieve the object computing the mean and covariance
+     *  \return Object computing the mean and covariance
+     */
+    const RunningMeanAndCovariance& getMeanAndCovariance( ) const
+    {
+        return meanAndCovariance_;
+    }
+
+private:
+
+    //! Size of the vectors in the sample
+    int vectorSize_;
+
+    //! Probabilities of the quantiles that are estimated
+    std::vector< double > quantileProbabilities_;
+
+    //! Object computing the mean and covariance
+    RunningMeanAndCovariance meanAndCovariance_;
+
+    //! Quantile estimators, ordered by vector entry first and quantile second
+    std::vector< P2QuantileEstimator > quantileEstimators_;
+};
+
+} // namespace statistics
+
+} // namespace tudat
+
+#endif // TUDAT_STREAMING_STATISTICS_H
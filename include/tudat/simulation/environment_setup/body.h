@@ -14,7 +14,9 @@
 #include <map>
 #include <vector>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include <Eigen/Core>
 
@@ -192,6 +194,8 @@ private:
     int stateMultiplier_;
 };
 
+class SystemOfBodies;
+
 //! Body class representing the properties of a celestial body (natural or artificial).
 /*!
  *  Body class representing the properties of a celestial body (natural or artificial). By storing
@@ -368,13 +372,18 @@ public:
     /*!
      * Templated function to get the current state of the body from its ephemeris and
      * global-to-ephemeris-frame function.  It calls the setStateFromEphemeris state, resetting the currentState_ /
-     * currentLongState_ variables, and returning the state with the requested precision
+     * currentLongState_ variables, and returning the state with the requested precision. While a concurrent ephemeris
+     * access section is active (see ScopedConcurrentEphemerisAccess), setting and retrieving the state is done under a
+     * lock, so that this function may be called concurrently (e.g. when computing observations in parallel), provided
+     * that the ephemeris models of the body and its ephemeris origin are safe for concurrent use. Otherwise, no lock is
+     * used.
      * \param time Time at which to evaluate states.
      * \return State at requested time
      */
     template<typename StateScalarType = double, typename TimeType = double>
     Eigen::Matrix<StateScalarType, 6, 1> getStateInBaseFrameFromEphemeris(const TimeType time)
     {
+        std::unique_lock< std::mutex > ephemerisStateLock = getEphemerisStateLock( );
         setStateFromEphemeris<StateScalarType, TimeType>(time);
         if (sizeof(StateScalarType) == 8) {
             return currentState_.template cast<StateScalarType>();
@@ -389,7 +398,8 @@ public:
      * Templated function to get the current berycentric state of the body from its ephemeris andcglobal-to-ephemeris-frame
      * function. It calls the setStateFromEphemeris state, resetting the currentBarycentricState_ /
      * currentBarycentricLongState_ variables, and returning the state with the requested precision. This function can ONLY be
-     * called if this body is the global frame origin, otherwise an exception is thrown
+     * called if this body is the global frame origin, otherwise an exception is thrown. As getStateInBaseFrameFromEphemeris,
+     * this function may be called concurrently.
      * \param time Time at which to evaluate states.
      * \return Barycentric State at requested time
      */
@@ -399,6 +409,7 @@ public:
             throw std::runtime_error("Error, calling global frame origin barycentric state on body that is not global frame origin");
         }
 
+        std::unique_lock< std::mutex > ephemerisStateLock = getEphemerisStateLock( );
         setStateFromEphemeris<StateScalarType, TimeType>(time);
 
         if (sizeof(StateScalarType) == 8) {
@@ -408,6 +419,24 @@ public:
         }
     }
 
+    //! Function to start a section in which the ephemeris states of bodies may be retrieved concurrently
+    /*!
+     *  Function to start a section in which the ephemeris states of bodies may be retrieved concurrently, in which
+     *  getStateInBaseFrameFromEphemeris and getGlobalFrameOriginBarycentricStateFromEphemeris lock the body's state. Sections
+     *  may be nested, and each call must be matched by a call to endConcurrentEphemerisAccess; typically,
+     *  ScopedConcurrentEphemerisAccess should be used instead of calling these functions directly.
+     */
+    static void beginConcurrentEphemerisAccess( )
+    {
+        numberOfConcurrentEphemerisAccessSections_++;
+    }
+
+    //! Function to end a section started by beginConcurrentEphemerisAccess
+    static void endConcurrentEphemerisAccess( )
+    {
+        numberOfConcurrentEphemerisAccessSections_--;
+    }
+
     //! Get current rotational state.
     /*!
      * Returns the internally stored current rotational state vector.
@@ -1453,6 +1482,27 @@ public:
      */
     void setIsBodyInPropagation(const bool isBodyInPropagation);
 
+    //! Function to create a copy of this body that can be used concurrently with the original
+    /*!
+     *  Function to create a copy of this body that can be used concurrently with the original (e.g. in a propagation in
+     *  a different thread). The current state, orientation, mass, etc. of the body are duplicated, and each environment
+     *  model (ephemeris, rotation model, gravity field, atmosphere, aerodynamic coefficient interface and vehicle systems,
+     *  including engine models) is copied using its clone function, so that the copy has its own evaluation state
+     *  (caches, current values, root finders). Only data that is not modified when evaluating the models is shared with the
+     *  original: tabulated data (including interpolators, whose lookup schemes keep only an atomic index), coefficients,
+     *  user-defined functions (which must be safe to call from multiple threads), the shape model and the ground station
+     *  states. Ground stations are recreated, with pointing angles computed from the copied rotation model. The flight
+     *  conditions are not copied, and are recreated when the aerodynamic acceleration or dependent variables are created
+     *  using the copy. An exception is thrown if the body contains a model that cannot be cloned, i.e. for which no clone
+     *  function is implemented (for instance composite or approximate planet ephemerides, rotation models that depend on
+     *  other bodies or on Earth orientation calculators, time-dependent gravity fields, gravity field variations,
+     *  deformation models, parameterized or costate-based thrust models). Radiation pressure interfaces depend on the
+     *  positions of other bodies, and can only be cloned with cloneSystemOfBodies, which also resets the frame definitions
+     *  of the copied bodies.
+     *  \return Copy of this body
+     */
+    std::shared_ptr< Body > clone( ) const;
+
 //    void setSuppressDependentOrientationCalculatorWarning(const bool suppressDependentOrientationCalculatorWarning) {
 //        suppressDependentOrientationCalculatorWarning_ = suppressDependentOrientationCalculatorWarning;
 //    }
@@ -1463,6 +1513,13 @@ public:
 
 protected:
 private:
+
+    //! Function to create a copy of this body that can be used concurrently with the original, without radiation pressure
+    //! interfaces (which are recreated by cloneSystemOfBodies); see clone.
+    std::shared_ptr< Body > cloneWithoutRadiationPressureInterfaces( ) const;
+
+    friend SystemOfBodies cloneSystemOfBodies( const SystemOfBodies& bodies );
+
     //! Variable denoting whether this body is the global frame origin (1 if true, 0 if false, -1 if not yet set)
     int bodyIsGlobalFrameOrigin_;
 
@@ -1481,6 +1538,25 @@ private:
     //! Time at which state was last set from ephemeris
     Time timeOfCurrentState_;
 
+    //! Function to retrieve the lock on the ephemeris state, which is only acquired in a concurrent ephemeris access section
+    std::unique_lock< std::mutex > getEphemerisStateLock( )
+    {
+        if( numberOfConcurrentEphemerisAccessSections_.load( std::memory_order_relaxed ) > 0 )
+        {
+            return std::unique_lock< std::mutex >( *ephemerisStateMutex_ );
+        }
+        else
+        {
+            return std::unique_lock< std::mutex >( );
+        }
+    }
+
+    //! Mutex used to set and retrieve the state from the ephemeris as a single operation, when called concurrently
+    std::shared_ptr< std::mutex > ephemerisStateMutex_ = std::make_shared< std::mutex >( );
+
+    //! Number of currently active concurrent ephemeris access sections (see beginConcurrentEphemerisAccess)
+    static std::atomic< int > numberOfConcurrentEphemerisAccessSections_;
+
     //! Class returning the state of this body's ephemeris origin w.r.t. the global origin (as typically created by
     //! setGlobalFrameBodyEphemerides function).
     std::shared_ptr<BaseStateInterface> ephemerisFrameToBaseFrame_;
@@ -1565,6 +1641,33 @@ private:
     bool isRotationSet_;
 };
 
+//! Class that marks a section in which the ephemeris states of bodies may be retrieved concurrently, for its lifetime
+/*!
+ *  Class that marks a section in which the ephemeris states of bodies may be retrieved concurrently, for its lifetime (see
+ *  Body::beginConcurrentEphemerisAccess). An object of this type should be created before starting the threads that
+ *  retrieve body states, and should be destroyed after these have finished.
+ */
+class ScopedConcurrentEphemerisAccess
+{
+public:
+
+    //! Constructor, starts the concurrent ephemeris access section
+    ScopedConcurrentEphemerisAccess( )
+    {
+        Body::beginConcurrentEphemerisAccess( );
+    }
+
+    //! Destructor, ends the concurrent ephemeris access section
+    ~ScopedConcurrentEphemerisAccess( )
+    {
+        Body::endConcurrentEphemerisAccess( );
+    }
+
+    ScopedConcurrentEphemerisAccess( const ScopedConcurrentEphemerisAccess& ) = delete;
+
+    ScopedConcurrentEphemerisAccess& operator=( const ScopedConcurrentEphemerisAccess& ) = delete;
+};
+
 
 //! Typdef for a list of body objects (as unordered_map for efficiency reasons)
 //typedef std::unordered_map< std::string, std::shared_ptr< Body > > SystemOfBodies;
@@ -1910,6 +2013,20 @@ private:
 
 };
 
+//! Function to create a copy of a system of bodies that can be used concurrently with the original
+/*!
+ *  Function to create a copy of a system of bodies that can be used concurrently with the original (e.g. to run
+ *  multiple propagations in parallel in a single process). Each body is copied as described for Body::clone, so that
+ *  every model that keeps evaluation state is duplicated, while the (possibly large) environment data, such as gravity
+ *  field coefficients, tabulated ephemerides and aerodynamic coefficient tables, is shared. Cannonball radiation pressure
+ *  interfaces are recreated, linked to the positions of the copied source, target and occulting bodies. An exception is
+ *  thrown if any model cannot be cloned. Models used in a propagation (acceleration models, etc.) must be created
+ *  separately for each copy.
+ *  \param bodies System of bodies that is to be copied
+ *  \return Copy of system of bodies
+ */
+SystemOfBodies cloneSystemOfBodies( const SystemOfBodies& bodies );
+
 double getBodyGravitationalParameter( const SystemOfBodies& bodies, const std::string bodyName );
 
 //! Function ot retrieve the common global translational state origin of the environment
@@ -163,6 +163,10 @@ public:
      * To further reduce the CPU time, this simplified computation of the altitude might be applied to a low-resolution
      * polyhedron. For further discussion see Avillez (2022), MSc thesis (TU Delft).
      *
+     * Setting the useSpatialIndex flag to true builds a bounding volume hierarchy over the vertices and facets when the
+     * shape model is created, reducing the cost of each altitude computation from O(n) to O(log n) (with n the number
+     * of vertices). With this index, the distance wrt all polyhedron features is the exact distance to the surface.
+     *
      * @param verticesCoordinates Matrix with coordinates of the polyhedron vertices. Each row represents the (x,y,z)
      * coordinates of one vertex.
      * @param verticesDefiningEachFacet Matrix with the indices (0 indexed) of the vertices defining each facet. Each
@@ -171,17 +175,20 @@ public:
      * above surface, <0 otherwise) or having always a positive value.
      * @param justComputeDistanceToVertices Flag indicating whether the distance should be computed wrt to all the
      * polyhedron features or wrt to just the vertices.
+     * @param useSpatialIndex Flag indicating whether a spatial index should be used for the closest-feature queries.
      */
     PolyhedronBodyShapeSettings(
             const Eigen::MatrixXd& verticesCoordinates,
             const Eigen::MatrixXi& verticesDefiningEachFacet,
             const bool computeAltitudeWithSign = true,
-            const bool justComputeDistanceToVertices = false):
+            const bool justComputeDistanceToVertices = false,
+            const bool useSpatialIndex = false ):
         BodyShapeSettings( polyhedron_shape ),
         verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         computeAltitudeWithSign_( computeAltitudeWithSign ),
-        justComputeDistanceToVertices_( justComputeDistanceToVertices )
+        justComputeDistanceToVertices_( justComputeDistanceToVertices ),
+        useSpatialIndex_( useSpatialIndex )
     { }
 
     //! Destructor
@@ -219,6 +226,14 @@ public:
     void resetJustComputeDistanceToVertices( bool justComputeDistanceToVertices )
     { justComputeDistanceToVertices_ = justComputeDistanceToVertices; }
 
+    // Function to return the useSpatialIndex flag.
+    bool getUseSpatialIndex( )
+    { return useSpatialIndex_; }
+
+    // Function to reset the useSpatialIndex flag.
+    void resetUseSpatialIndex( bool useSpatialIndex )
+    { useSpatialIndex_ = useSpatialIndex; }
+
 private:
 
     // Matrix with coordinates of the polyhedron vertices.
@@ -235,6 +250,9 @@ private:
     // vertices.
     bool justComputeDistanceToVertices_;
 
+    // Flag indicating whether a spatial index should be used for the closest-feature queries.
+    bool useSpatialIndex_;
+
 };
 
 //  BodyShapeSettings derived class for defining settings of a hybrid shape model.
@@ -337,10 +355,12 @@ inline std::shared_ptr< BodyShapeSettings > polyhedronBodyShapeSettings(
         const Eigen::MatrixXd& verticesCoordinates,
         const Eigen::MatrixXi& verticesDefiningEachFacet,
         const bool computeAltitudeWithSign = true,
-        const bool justComputeDistanceToVertices = false )
+        const bool justComputeDistanceToVertices = false,
+        const bool useSpatialIndex = false )
 {
     return std::make_shared< PolyhedronBodyShapeSettings >( verticesCoordinates, verticesDefiningEachFacet,
-                                                            computeAltitudeWithSign, justComputeDistanceToVertices);
+                                                            computeAltitudeWithSign, justComputeDistanceToVertices,
+                                                            useSpatialIndex );
 }
 
 inline std::shared_ptr< BodyShapeSettings > hybridBodyShapeSettings(
@@ -21,6 +21,7 @@
 #include "tudat/astro/ephemerides/ephemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/astro/ephemerides/tleEphemeris.h"
+#include "tudat/astro/ephemerides/tleCatalogPropagator.h"
 #include "tudat/astro/ephemerides/customEphemeris.h"
 #include "tudat/astro/ephemerides/keplerEphemeris.h"
 #include "tudat/astro/ephemerides/multiArcEphemeris.h"
@@ -937,6 +938,69 @@ std::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromTLE(
 			interpolator, observerName, referenceFrameName );
 }
 
+//! Function to create tabulated ephemerides for a full catalog of two-line element sets.
+/*!
+ *  Function to create tabulated ephemerides for a full catalog of two-line element sets. The states of all objects are
+ *  computed at once by a TleCatalogPropagator (in parallel, if requested), after which an interpolated ephemeris is
+ *  created for each object.
+ * \param tles List of two-line element sets, one per object.
+ * \param initialTime Initial time from which interpolated data should be created.
+ * \param endTime Final time until which interpolated data should be created.
+ * \param timeStep Time step with which interpolated data should be created.
+ * \param referenceFrameName Orientation of the ephemerides (TEME or J2000); the origin is the Earth.
+ * \param interpolatorSettings Settings to be used for the state interpolation.
+ * \param numberOfThreads Number of threads over which the propagation of the objects is distributed.
+ * \param allowDeepSpaceObjects Boolean denoting whether deep-space objects, for which the (unimplemented) SDP4 model is
+ * required, are allowed in the catalog (see TleCatalogPropagator). If true, no ephemeris is created for these objects.
+ * \return Tabulated ephemerides of all objects, in the order of the input TLEs (nullptr for deep-space objects).
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::vector< std::shared_ptr< ephemerides::Ephemeris > > createTabulatedEphemeridesFromTleCatalog(
+        const std::vector< std::shared_ptr< ephemerides::Tle > >& tles,
+        const TimeType initialTime,
+        const TimeType endTime,
+        const TimeType timeStep,
+        const std::string& referenceFrameName = "J2000",
+        std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+        std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ),
+        const int numberOfThreads = 1,
+        const bool allowDeepSpaceObjects = false )
+{
+    std::vector< double > epochs;
+    TimeType currentTime = initialTime;
+    while( currentTime < endTime )
+    {
+        epochs.push_back( static_cast< double >( currentTime ) );
+        currentTime += timeStep;
+    }
+
+    ephemerides::TleCatalogPropagator catalogPropagator( tles, allowDeepSpaceObjects );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > catalogStates = catalogPropagator.propagateToEpochs(
+                epochs, referenceFrameName, numberOfThreads );
+
+    std::vector< std::shared_ptr< ephemerides::Ephemeris > > ephemerides;
+    for( unsigned int i = 0; i < tles.size( ); i++ )
+    {
+        if( catalogPropagator.isDeepSpaceObject( i ) )
+        {
+            ephemerides.push_back( nullptr );
+            continue;
+        }
+
+        std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > timeHistoryOfState;
+        for( unsigned int j = 0; j < epochs.size( ); j++ )
+        {
+            timeHistoryOfState[ static_cast< TimeType >( epochs.at( j ) ) ] =
+                    catalogStates.col( i * epochs.size( ) + j ).template cast< StateScalarType >( );
+        }
+
+        ephemerides.push_back( std::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                                   interpolators::createOneDimensionalInterpolator( timeHistoryOfState, interpolatorSettings ),
+                                   "Earth", referenceFrameName ) );
+    }
+    return ephemerides;
+}
+
 //! @get_docstring(keplerEphemerisSettings)
 inline std::shared_ptr< EphemerisSettings > keplerEphemerisSettings(
         const Eigen::Vector6d& initialStateInKeplerianElements,
@@ -310,7 +310,10 @@ public:
         verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         associatedReferenceFrame_( associatedReferenceFrame ),
-        gravitationalConstant_( gravitationalConstant )
+        gravitationalConstant_( gravitationalConstant ),
+        farFieldMaximumDegree_( -1 ),
+        farFieldSwitchRadius_( TUDAT_NAN ),
+        farFieldTransitionWidth_( TUDAT_NAN )
     {
         volume_ = basic_astrodynamics::computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
         gravitationalParameter_ = gravitationalConstant_ * density_ * volume_;
@@ -336,7 +339,10 @@ public:
         verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         associatedReferenceFrame_( associatedReferenceFrame ),
-        gravitationalConstant_( gravitationalConstant )
+        gravitationalConstant_( gravitationalConstant ),
+        farFieldMaximumDegree_( -1 ),
+        farFieldSwitchRadius_( TUDAT_NAN ),
+        farFieldTransitionWidth_( TUDAT_NAN )
     {
         volume_ = basic_astrodynamics::computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
         density_ = gravitationalParameter_ / ( gravitationalConstant_ * volume_ );
@@ -391,6 +397,36 @@ public:
     void resetVerticesDefiningEachFacet ( const Eigen::MatrixXi& verticesDefiningEachFacet )
     { verticesDefiningEachFacet_ = verticesDefiningEachFacet; }
 
+    // Function to set the far-field spherical harmonic expansion, used by the acceleration model beyond the switch radius.
+    /*
+     *  Function to set the far-field spherical harmonic expansion that is computed from the polyhedron when creating
+     *  the gravity field, and which is used by the polyhedron acceleration model instead of the polyhedron beyond
+     *  the switch radius (see PolyhedronGravityField::setFarFieldSphericalHarmonicExpansion).
+     *  \param maximumDegree Maximum degree (and order) of the expansion (negative value denotes no expansion).
+     *  \param switchRadius Radius beyond which the expansion is (partially) used; may not be inside the Brillouin sphere.
+     *  \param transitionWidth Width of the radial interval over which the polyhedron and expansion are blended.
+     */
+    void resetFarFieldSphericalHarmonicExpansion( const int maximumDegree,
+                                                  const double switchRadius,
+                                                  const double transitionWidth = 0.0 )
+    {
+        farFieldMaximumDegree_ = maximumDegree;
+        farFieldSwitchRadius_ = switchRadius;
+        farFieldTransitionWidth_ = transitionWidth;
+    }
+
+    // Function to return the maximum degree of the far-field expansion (negative value denotes no expansion).
+    int getFarFieldMaximumDegree( )
+    { return farFieldMaximumDegree_; }
+
+    // Function to return the radius beyond which the far-field expansion is used.
+    double getFarFieldSwitchRadius( )
+    { return farFieldSwitchRadius_; }
+
+    // Function to return the width of the transition between the polyhedron and far-field expansion.
+    double getFarFieldTransitionWidth( )
+    { return farFieldTransitionWidth_; }
+
 protected:
 
     // Gravitational parameter
@@ -412,6 +448,15 @@ protected:
 
     double volume_;
 
+    // Maximum degree of the far-field spherical harmonic expansion (negative value denotes no expansion).
+    int farFieldMaximumDegree_;
+
+    // Radius beyond which the far-field expansion is used.
+    double farFieldSwitchRadius_;
+
+    // Width of the transition between the polyhedron and far-field expansion.
+    double farFieldTransitionWidth_;
+
 };
 
 
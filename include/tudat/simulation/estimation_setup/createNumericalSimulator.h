@@ -128,6 +128,41 @@ createVariationalEquationsSolver(
 }
 
 
+//! Function to create variational equations solver object, with a separate environment for each arc
+/*!
+*  Function to create variational equations solver object, with a separate environment for each arc (for multi-arc
+*  propagation only), so that arcs can be propagated concurrently.
+*  \param bodies Environment used for post-processing of the propagation results, and from which the parameters are
+*  created.
+*  \param arcWiseBodies List of environments, one per arc, used for the propagation of each arc
+*  \param propagatorSettings Settings for propagator (must be multi-arc).
+*  \param parametersToEstimate Object containing all parameters that are to be estimated and their current settings and values.
+*  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
+*  end of this contructor.
+*  \return Variational equations solver object
+*/
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< propagators::VariationalEquationsSolver< StateScalarType, TimeType > >
+createVariationalEquationsSolver(
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies,
+        const std::shared_ptr< propagators::PropagatorSettings< StateScalarType > > propagatorSettings,
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSet<  StateScalarType > > parametersToEstimate,
+        const bool integrateEquationsOnCreation = 1 )
+{
+    if( std::dynamic_pointer_cast< propagators::MultiArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) != nullptr )
+    {
+        return std::make_shared< propagators::MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
+                    bodies, arcWiseBodies, std::dynamic_pointer_cast< propagators::MultiArcPropagatorSettings< StateScalarType, TimeType > >(
+                        propagatorSettings ), parametersToEstimate, integrateEquationsOnCreation );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when creating variational equations solver, arc-wise environments are only supported for multi-arc propagation" );
+    }
+}
+
+
 //! Function to crate interface for state transition/sensitivity matrix results
 /*!
  *  Function to crate interface for state transition/sensitivity matrix results
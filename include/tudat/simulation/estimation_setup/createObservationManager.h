@@ -41,7 +41,8 @@ void performObservationParameterEstimationClosureForSingleModelSet(
         const std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter,
         const std::shared_ptr< ObservationBias< ObservationSize > > observationBias,
         const LinkEnds linkEnds,
-        const ObservableType observableType )
+        const ObservableType observableType,
+        const bool addToExistingBiasLinks = false )
 {
     ObservationBiasTypes biasType = getObservationBiasType( observationBias );
 
@@ -60,7 +61,8 @@ void performObservationParameterEstimationClosureForSingleModelSet(
         for( unsigned int i = 0; i < multiTypeBias->getBiasList( ).size( ); i++ )
         {
             performObservationParameterEstimationClosureForSingleModelSet(
-                        parameter, multiTypeBias->getBiasList( ).at( i ), linkEnds, observableType );
+                        parameter, multiTypeBias->getBiasList( ).at( i ), linkEnds, observableType,
+                        addToExistingBiasLinks );
         }
     }
     else
@@ -92,7 +94,8 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                                 std::bind( &ConstantObservationBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                            constantBiasObject ),
                                 std::bind( &ConstantObservationBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                           constantBiasObject, std::placeholders::_1 ) );
+                                           constantBiasObject, std::placeholders::_1 ),
+                                addToExistingBiasLinks );
                 }
             }
             break;
@@ -138,8 +141,12 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                                     std::bind( &ConstantArcWiseObservationBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                                constantBiasObject ),
                                     std::bind( &ConstantArcWiseObservationBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                               constantBiasObject, std::placeholders::_1 ) );
-                        biasParameter->setLookupScheme( constantBiasObject->getLookupScheme( ) );
+                                               constantBiasObject, std::placeholders::_1 ),
+                                    addToExistingBiasLinks );
+                        if( !addToExistingBiasLinks )
+                        {
+                            biasParameter->setLookupScheme( constantBiasObject->getLookupScheme( ) );
+                        }
                     }
                 }
             }
@@ -169,7 +176,8 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                                 std::bind( &ConstantRelativeObservationBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                            constantBiasObject ),
                                 std::bind( &ConstantRelativeObservationBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                           constantBiasObject, std::placeholders::_1 ) );
+                                           constantBiasObject, std::placeholders::_1 ),
+                                addToExistingBiasLinks );
                 }
             }
             break;
@@ -215,8 +223,12 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                                     std::bind( &ConstantRelativeArcWiseObservationBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                                constantBiasObject ),
                                     std::bind( &ConstantRelativeArcWiseObservationBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                               constantBiasObject, std::placeholders::_1 ) );
-                        biasParameter->setLookupScheme( constantBiasObject->getLookupScheme( ) );
+                                               constantBiasObject, std::placeholders::_1 ),
+                                    addToExistingBiasLinks );
+                        if( !addToExistingBiasLinks )
+                        {
+                            biasParameter->setLookupScheme( constantBiasObject->getLookupScheme( ) );
+                        }
                     }
                 }
             }
@@ -244,7 +256,8 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                             std::bind( &ConstantTimeDriftBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                        timeBiasObject ),
                             std::bind( &ConstantTimeDriftBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                       timeBiasObject, std::placeholders::_1 ) );
+                                       timeBiasObject, std::placeholders::_1 ),
+                            addToExistingBiasLinks );
                 }
             }
             break;
@@ -287,8 +300,12 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                                 std::bind( &ArcWiseTimeDriftBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                            timeBiasObject ),
                                 std::bind( &ArcWiseTimeDriftBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                           timeBiasObject, std::placeholders::_1 ) );
-                        timeBiasParameter->setLookupScheme( timeBiasObject->getLookupScheme( ) );
+                                           timeBiasObject, std::placeholders::_1 ),
+                                addToExistingBiasLinks );
+                        if( !addToExistingBiasLinks )
+                        {
+                            timeBiasParameter->setLookupScheme( timeBiasObject->getLookupScheme( ) );
+                        }
                     }
                 }
             }
@@ -316,7 +333,8 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                             std::bind( &ConstantTimeBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                        timeBiasObject ),
                             std::bind( &ConstantTimeBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                       timeBiasObject, std::placeholders::_1 ) );
+                                       timeBiasObject, std::placeholders::_1 ),
+                            addToExistingBiasLinks );
                 }
             }
             break;
@@ -359,8 +377,12 @@ void performObservationParameterEstimationClosureForSingleModelSet(
                                 std::bind( &ArcWiseTimeBias< ObservationSize >::getTemplateFreeConstantObservationBias,
                                            timeBiasObject ),
                                 std::bind( &ArcWiseTimeBias< ObservationSize >::resetConstantObservationBiasTemplateFree,
-                                           timeBiasObject, std::placeholders::_1 ) );
-                        timeBiasParameter->setLookupScheme( timeBiasObject->getLookupScheme( ) );
+                                           timeBiasObject, std::placeholders::_1 ),
+                                addToExistingBiasLinks );
+                        if( !addToExistingBiasLinks )
+                        {
+                            timeBiasParameter->setLookupScheme( timeBiasObject->getLookupScheme( ) );
+                        }
                     }
                 }
             }
@@ -379,13 +401,15 @@ void performObservationParameterEstimationClosureForSingleModelSet(
 /*!
  *  Function to perform the closure between observation models and estimated parameters. Estimated parameter objects are typically
  *  created prior to observation models. This function must be called for the estimated parameter object creation to be
- *  finalized, in the case link properties are estimated (e.g. observation biases).
+ *  finalized, in the case link properties are estimated (e.g. observation biases). If addToExistingBiasLinks is true, the bias
+ *  parameters that are already linked to bias objects are linked to the biases of the observationSimulator in addition to these.
  */
 template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
 void performObservationParameterEstimationClosure(
         std::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > observationSimulator ,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >
-        parametersToEstimate )
+        parametersToEstimate,
+        const bool addToExistingBiasLinks = false )
 {
     // Retrieve observation models and parameter
     std::map< LinkEnds, std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >
@@ -418,7 +442,7 @@ void performObservationParameterEstimationClosure(
             {
                 performObservationParameterEstimationClosureForSingleModelSet(
                             vectorBiasParameters.at( i ), biasIterator->second, biasIterator->first,
-                            observationSimulator->getObservableType( ) );
+                            observationSimulator->getObservableType( ), addToExistingBiasLinks );
             }
         }
     }
@@ -433,6 +457,10 @@ void performObservationParameterEstimationClosure(
  *  \param bodies Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param dependentVariablesInterface Object used to compute the dependent variables at a given time
+ *  \param addToExistingBiasLinks Boolean denoting whether the estimated bias parameters are to be linked to the biases of the
+ *  new observation models in addition to their existing bias objects (e.g. when creating a copy of an existing observation
+ *  manager for use by another thread), instead of replacing them.
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< int ObservationSize = 1, typename ObservationScalarType, typename TimeType >
@@ -445,7 +473,8 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
         const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
         stateTransitionMatrixInterface,
         const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) )
+                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+        const bool addToExistingBiasLinks = false )
 {
     using namespace observation_models;
     using namespace observation_partials;
@@ -456,7 +485,7 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
                 observableType, observationModelSettingsList, bodies );
 
     performObservationParameterEstimationClosure(
-                observationSimulator, parametersToEstimate );
+                observationSimulator, parametersToEstimate, addToExistingBiasLinks );
 
     // Create observation partials for all link ends/parameters
     std::map< LinkEnds, std::pair< std::map< std::pair< int, int >,
@@ -491,6 +520,10 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
  *  \param bodies Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param dependentVariablesInterface Object used to compute the dependent variables at a given time
+ *  \param addToExistingBiasLinks Boolean denoting whether the estimated bias parameters are to be linked to the biases of the
+ *  new observation models in addition to their existing bias objects (e.g. when creating a copy of an existing observation
+ *  manager for use by another thread), instead of replacing them.
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< typename ObservationScalarType, typename TimeType >
@@ -501,7 +534,8 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
         const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface,
         const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) )
+                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+        const bool addToExistingBiasLinks = false )
 {
     std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > observationManager;
     switch( observableType )
@@ -509,52 +543,52 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
     case one_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case n_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case one_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case two_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case one_way_differenced_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case angular_position:
         observationManager = createObservationManager< 2, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case position_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case euler_angle_313_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case velocity_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     case relative_angular_position:
         observationManager = createObservationManager< 2, ObservationScalarType, TimeType >(
                 observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                        stateTransitionMatrixInterface, dependentVariablesInterface );
+                        stateTransitionMatrixInterface, dependentVariablesInterface, addToExistingBiasLinks );
         break;
     default:
         throw std::runtime_error(
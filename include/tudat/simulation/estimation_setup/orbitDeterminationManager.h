@@ -12,14 +12,20 @@
 #define TUDAT_ORBITDETERMINATIONMANAGER_H
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <tuple>
 
 
 
+#include "tudat/basics/utilities.h"
 #include "tudat/io/basicInputOutput.h"
+#include "tudat/math/basic/blockArrowheadNormalEquations.h"
 #include "tudat/math/basic/leastSquaresEstimation.h"
 #include "tudat/astro/observation_models/observationManager.h"
 #include "tudat/astro/orbit_determination/podInputOutputTypes.h"
 #include "tudat/astro/orbit_determination/estimatable_parameters/initialTranslationalState.h"
+#include "tudat/astro/orbit_determination/estimatable_parameters/observationBiasParameter.h"
 #include "tudat/simulation/estimation_setup/variationalEquationsSolver.h"
 #include "tudat/simulation/estimation_setup/createObservationManager.h"
 #include "tudat/simulation/estimation_setup/createNumericalSimulator.h"
@@ -256,6 +262,37 @@ public:
                                              propagateOnCreation );
     }
 
+    //! Constructor, with a separate environment for each arc of a multi-arc propagation
+    /*!
+     *  Constructor, with a separate environment for each arc of a multi-arc propagation, so that the dynamics and
+     *  variational equations of the arcs can be propagated concurrently (see
+     *  MultiArcPropagatorProcessingSettings::setNumberOfArcPropagationThreads). The dynamical models in the propagator
+     *  settings of each arc must have been created from the environment of that arc (typically created using
+     *  simulation_setup::cloneSystemOfBodies). Only (arc-wise) initial states may be estimated.
+     *  \param bodies Environment used for observation models and post-processing of the propagation results, and from
+     *  which the parameters are created.
+     *  \param arcWiseBodies List of environments, one per arc, used for the propagation of each arc
+     *  \param parametersToEstimate Container object for all parameters that are to be estimated
+     *  \param observationSettingsList Settings for observation models
+     *  \param propagatorSettings Settings for propagator (must be multi-arc).
+     *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
+     *  true)
+     */
+    OrbitDeterminationManager(
+            const SystemOfBodies &bodies,
+            const std::vector< SystemOfBodies >& arcWiseBodies,
+            const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >
+            parametersToEstimate,
+            const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationSettingsList,
+            const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
+            const bool propagateOnCreation = true ):
+        parametersToEstimate_( parametersToEstimate ),
+        bodies_( bodies )
+    {
+        initializeOrbitDeterminationManager( bodies, observationSettingsList, propagatorSettings,
+                                             propagateOnCreation, arcWiseBodies );
+    }
+
     std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > getParametersToEstimate( )
     {
         return parametersToEstimate_;
@@ -364,23 +401,172 @@ public:
     //        return std::make_pair( numberOfObservations, totalNumberOfObservations );
     //    }
 
+    //! Function to calculate the residuals and partials of a single observation set
+    /*!
+     *  Function to calculate the residuals and partials of a single observation set, and set these in the (preallocated)
+     *  full vector of residuals and design matrix. The partials are calculated by the observationManagers_.
+     *  \param currentObservations Observation set for which residuals and partials are to be calculated
+     *  \param currentObservableType Observable type of observation set
+     *  \param currentLinkEnds Link ends of observation set
+     *  \param observationIndices Start index and size of observation set in vector of all observations
+     *  \param designMatrix Design matrix of all observations, of which the rows of current observation set are set by
+     *  this function
+     *  \param residuals Residuals of all observations, of which the entries of current observation set are set by this
+     *  function
+     *  \param calculateResiduals Boolean denoting whether the residuals are to be set.
+     */
+    void calculateObservationSetResidualsAndPartials(
+            const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations,
+            const observation_models::ObservableType currentObservableType,
+            const observation_models::LinkEnds& currentLinkEnds,
+            const std::pair< int, int >& observationIndices,
+            Eigen::MatrixXd& designMatrix,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals )
+    {
+        std::vector< TimeType > observationTimes = currentObservations->getObservationTimes( );
+        calculateObservationSetSegmentResidualsAndPartials(
+                    observationManagers_, currentObservations, observationTimes, currentObservableType, currentLinkEnds,
+                    observationIndices, 0, observationTimes.size( ), designMatrix, residuals, calculateResiduals );
+    }
+
+    //! Function to calculate the residuals and partials of a segment of a single observation set
+    /*!
+     *  Function to calculate the residuals and partials of a segment of a single observation set, and set these in the
+     *  (preallocated) full vector of residuals and design matrix. The segment is defined by a range of (time-ordered)
+     *  observation times of the set, so that the observations and partials computed for all segments of the set, in the
+     *  order of their times, are equal to those computed for the full set at once (up to the convergence tolerance of the
+     *  light-time solutions, which are warm-started from the previous observation in a segment).
+     *  \param observationManagers Observation managers by which the observations and partials are computed
+     *  \param currentObservations Observation set for which residuals and partials are to be calculated
+     *  \param sortedObservationTimes Observation times of the set, sorted in ascending order (not required if the segment
+     *  contains the full set)
+     *  \param currentObservableType Observable type of observation set
+     *  \param currentLinkEnds Link ends of observation set
+     *  \param observationIndices Start index and size of observation set in vector of all observations
+     *  \param firstTimeIndex Index in sortedObservationTimes of first observation time of the segment
+     *  \param numberOfTimes Number of observation times in the segment
+     *  \param designMatrix Design matrix of all observations, of which the rows of current segment are set by this function
+     *  \param residuals Residuals of all observations, of which the entries of current segment are set by this function
+     *  \param calculateResiduals Boolean denoting whether the residuals are to be set.
+     */
+    void calculateObservationSetSegmentResidualsAndPartials(
+            const std::map< observation_models::ObservableType,
+            std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >& observationManagers,
+            const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations,
+            const std::vector< TimeType >& sortedObservationTimes,
+            const observation_models::ObservableType currentObservableType,
+            const observation_models::LinkEnds& currentLinkEnds,
+            const std::pair< int, int >& observationIndices,
+            const int firstTimeIndex,
+            const int numberOfTimes,
+            Eigen::MatrixXd& designMatrix,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals )
+    {
+        if( numberOfTimes == 0 )
+        {
+            return;
+        }
+
+        // Compute estimated observations and partials from current parameter estimate.
+        std::vector< TimeType > segmentTimes;
+        if( numberOfTimes == static_cast< int >( sortedObservationTimes.size( ) ) )
+        {
+            segmentTimes = sortedObservationTimes;
+        }
+        else
+        {
+            segmentTimes = std::vector< TimeType >(
+                        sortedObservationTimes.begin( ) + firstTimeIndex,
+                        sortedObservationTimes.begin( ) + firstTimeIndex + numberOfTimes );
+        }
+        std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                observationManagers.at( currentObservableType )->computeObservationsWithPartials(
+                    segmentTimes, currentLinkEnds,
+                    currentObservations->getReferenceLinkEnd( ),
+                    currentObservations->getAncilliarySettings( ) );
+
+        // Determine rows of segment in full vector of observations
+        int singleObservationSize = observationIndices.second / static_cast< int >( sortedObservationTimes.size( ) );
+        int segmentStartIndex = observationIndices.first + firstTimeIndex * singleObservationSize;
+        int segmentSize = numberOfTimes * singleObservationSize;
+
+        // Compute residuals for current link ends and observabel type.
+        if( calculateResiduals )
+        {
+            residuals.segment( segmentStartIndex, segmentSize ) =
+                    ( currentObservations->getObservationsVector( ).segment(
+                          firstTimeIndex * singleObservationSize, segmentSize ) -
+                      observationsWithPartials.first ).template cast< double >( );
+        }
+
+        // Set current observation partials in matrix of all partials
+        designMatrix.block( segmentStartIndex, 0, segmentSize, designMatrix.cols( ) ) =
+                observationsWithPartials.second;
+    }
+
+    //! Function to create the observation managers used by additional threads when computing observations in parallel
+    /*!
+     *  Function to create the observation managers used by additional threads when computing observations in parallel, if
+     *  these do not yet exist. Each additional thread uses its own observation managers (with their own observation models,
+     *  light-time calculators and partials, which store intermediate results of the computation), created from the same
+     *  settings as the observationManagers_, which are used by the first thread. The estimated bias parameters are linked to
+     *  the biases of all observation managers, so that these are kept consistent when the parameters are reset. Note that
+     *  changes made to the objects in observationManagers_ after their creation are not applied to these copies.
+     *  \param numberOfThreads Total number of threads (including the first thread) for which observation managers are to
+     *  be available.
+     */
+    void createThreadObservationManagers( const int numberOfThreads )
+    {
+        while( static_cast< int >( threadObservationManagers_.size( ) ) < numberOfThreads - 1 )
+        {
+            std::map< observation_models::ObservableType,
+                    std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >
+                    currentObservationManagers;
+            for( auto it : observationSettingsPerType_ )
+            {
+                currentObservationManagers[ it.first ] =
+                        observation_models::createObservationManagerBase< ObservationScalarType, TimeType >(
+                            it.first, it.second, bodies_, parametersToEstimate_,
+                            stateTransitionAndSensitivityMatrixInterface_, dependentVariablesInterface_, true );
+            }
+            threadObservationManagers_.push_back( currentObservationManagers );
+        }
+    }
+
     //! Function to calculate the observation partials matrix and residuals
     /*!
      *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
      *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
      *  Partials and observations are calculated by the observationManagers_.
-     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *
+     *  If more than one thread is used, the (time-ordered) observations of each observation set are split into segments, and
+     *  the segments of all sets are distributed over the threads, so that the observations of a single link (e.g. one long
+     *  Doppler tracking arc) are also computed in parallel. Each thread uses its own observation managers (see
+     *  createThreadObservationManagers), since the observation models and partials store intermediate results of the
+     *  computation. The state transition and sensitivity matrix interface, the dependent variables interface (and the
+     *  interpolators these wrap) and the environment are shared by all threads; the bodies' ephemeris states are then
+     *  retrieved under a lock (see ScopedConcurrentEphemerisAccess). This requires the environment models used by the
+     *  observation models (e.g. ephemerides and rotation models) to be safe for concurrent evaluation. Each segment is
+     *  written to a separate block of the output. Since the light-time solution of the first observation of a segment is
+     *  not warm-started from the preceding observation, the results are equal to those of the serial computation up to the
+     *  light-time convergence tolerance, rather than identical.
+     *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
      *  \param parameterVectorSize Length of the vector of estimated parameters
      *  \param totalObservationSize Total number of observations in observationsAndTimes map.
-     *  \param residualsAndPartials Pair of residuals of computed w.r.t. input observable values and partials of
-     *  observables w.r.t. parameter vector (return by reference).
+     *  \param designMatrix Partials of observables w.r.t. parameter vector (return by reference).
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+     *  \param calculateResiduals Boolean denoting whether the residuals are to be calculated.
+     *  \param numberOfThreads Number of threads over which the observations are distributed.
      */
     void calculateDesignMatrixAndResiduals(
             const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
             const int parameterVectorSize, const int totalObservationSize,
             Eigen::MatrixXd& designMatrix,
             Eigen::VectorXd& residuals,
-            const bool calculateResiduals = true )
+            const bool calculateResiduals = true,
+            const int numberOfThreads = 1 )
     {
         // Initialize return data.
         designMatrix = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
@@ -388,8 +574,184 @@ public:
 
         typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
                 sortedObservations = observationsCollection->getObservations( );
+        std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, std::vector< std::pair< int, int > > > >
+                observationSetStartAndSize = observationsCollection->getObservationSetStartAndSize( );
 
-//        std::cout << "start calculateObservationMatrixAndResiduals" << "\n\n";
+        if( numberOfThreads < 2 )
+        {
+            // Iterate over all observable types in observationsAndTimes
+            for( auto observablesIterator : sortedObservations )
+            {
+                observation_models::ObservableType currentObservableType = observablesIterator.first;
+
+                // Iterate over all link ends for current observable type in observationsAndTimes
+                for( auto dataIterator : observablesIterator.second )
+                {
+                    observation_models::LinkEnds currentLinkEnds = dataIterator.first;
+                    for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+                    {
+                        calculateObservationSetResidualsAndPartials(
+                                    dataIterator.second.at( i ), currentObservableType, currentLinkEnds,
+                                    observationSetStartAndSize.at( currentObservableType ).at( currentLinkEnds ).at( i ),
+                                    designMatrix, residuals, calculateResiduals );
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Retrieve sorted observation times of all observation sets
+            std::vector< std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > >
+                    observationSets;
+            std::vector< std::pair< observation_models::ObservableType, observation_models::LinkEnds > > observationSetLinks;
+            std::vector< std::pair< int, int > > observationSetIndices;
+            std::vector< std::vector< TimeType > > sortedObservationTimes;
+            int totalNumberOfTimes = 0;
+            for( auto observablesIterator : sortedObservations )
+            {
+                for( auto dataIterator : observablesIterator.second )
+                {
+                    for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+                    {
+                        observationSets.push_back( dataIterator.second.at( i ) );
+                        observationSetLinks.push_back( std::make_pair( observablesIterator.first, dataIterator.first ) );
+                        observationSetIndices.push_back(
+                                    observationSetStartAndSize.at( observablesIterator.first ).at( dataIterator.first ).at( i ) );
+                        sortedObservationTimes.push_back( dataIterator.second.at( i )->getObservationTimes( ) );
+                        std::sort( sortedObservationTimes.back( ).begin( ), sortedObservationTimes.back( ).end( ) );
+                        totalNumberOfTimes += static_cast< int >( sortedObservationTimes.back( ).size( ) );
+                    }
+                }
+            }
+
+            // Split observation sets into segments (set index, first time index, number of times), such that there are
+            // several segments per thread to balance the load, but the warm start of the light-time solution is retained
+            // over a sufficiently large number of observations
+            const int minimumSegmentSize = 50;
+            int maximumSegmentSize = std::max( minimumSegmentSize, totalNumberOfTimes / ( 4 * numberOfThreads ) + 1 );
+            std::vector< std::tuple< int, int, int > > observationSegments;
+            for( unsigned int i = 0; i < sortedObservationTimes.size( ); i++ )
+            {
+                int numberOfSetTimes = static_cast< int >( sortedObservationTimes.at( i ).size( ) );
+                int numberOfSegments = std::max( 1, ( numberOfSetTimes + maximumSegmentSize - 1 ) / maximumSegmentSize );
+                for( int j = 0; j < numberOfSegments; j++ )
+                {
+                    int firstTimeIndex = ( numberOfSetTimes * j ) / numberOfSegments;
+                    observationSegments.push_back(
+                                std::make_tuple( i, firstTimeIndex, ( numberOfSetTimes * ( j + 1 ) ) / numberOfSegments - firstTimeIndex ) );
+                }
+            }
+
+            // Create observation managers for each thread, and allow concurrent retrieval of the body states
+            int numberOfSegments = static_cast< int >( observationSegments.size( ) );
+            createThreadObservationManagers( std::min( numberOfThreads, numberOfSegments ) );
+            simulation_setup::ScopedConcurrentEphemerisAccess concurrentEphemerisAccess;
+
+            // Distribute segments over threads, with each thread retrieving the next unprocessed segment when it is done
+            std::atomic< int > nextSegmentIndex( 0 );
+            utilities::parallelForEachBlock(
+                        numberOfSegments, numberOfThreads,
+                        [ & ]( const int, const int, const int threadIndex )
+            {
+                const std::map< observation_models::ObservableType,
+                        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >&
+                        currentObservationManagers = ( threadIndex == 0 ) ?
+                            observationManagers_ : threadObservationManagers_.at( threadIndex - 1 );
+
+                int segmentIndex = nextSegmentIndex++;
+                while( segmentIndex < numberOfSegments )
+                {
+                    int setIndex = std::get< 0 >( observationSegments.at( segmentIndex ) );
+                    calculateObservationSetSegmentResidualsAndPartials(
+                                currentObservationManagers, observationSets.at( setIndex ), sortedObservationTimes.at( setIndex ),
+                                observationSetLinks.at( setIndex ).first, observationSetLinks.at( setIndex ).second,
+                                observationSetIndices.at( setIndex ),
+                                std::get< 1 >( observationSegments.at( segmentIndex ) ),
+                                std::get< 2 >( observationSegments.at( segmentIndex ) ),
+                                designMatrix, residuals, calculateResiduals );
+                    segmentIndex = nextSegmentIndex++;
+                }
+            } );
+        }
+
+        if( calculateResiduals )
+        {
+            for( auto observablesIterator : sortedObservations )
+            {
+                observation_models::ObservableType currentObservableType = observablesIterator.first;
+                std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( currentObservableType );
+
+                observation_models::checkObservationResidualDiscontinuities(
+                            residuals.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 ),
+                            currentObservableType );
+            }
+        }
+    }
+
+    void calculateDesignMatrix(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const int parameterVectorSize, const int totalObservationSize,
+            Eigen::MatrixXd& designMatrix,
+            const int numberOfThreads = 1 )
+    {
+        Eigen::VectorXd dummyVector;
+        calculateDesignMatrixAndResiduals(
+                    observationsCollection, parameterVectorSize, totalObservationSize, designMatrix, dummyVector, false,
+                    numberOfThreads );
+
+    }
+
+    //! Function to calculate the (normalized) normal equations and residuals, without storing the full design matrix
+    /*!
+     *  This function calculates the normal equations and residuals, in the same manner as calculateDesignMatrixAndResiduals,
+     *  but without storing the full design matrix. Instead, the partials of each single observation set are added to the
+     *  normal equations directly after they are computed. The normal equations are normalized with the same normalization
+     *  terms as would be obtained from normalizeDesignMatrix, so that the normal matrix is equal to H^T*W*H (and the
+     *  righthandside to H^T*W*y), with H the normalized design matrix. Where the residuals of an observable type are
+     *  corrected for discontinuities (see checkObservationResidualDiscontinuities), the partials of the affected
+     *  observation sets are recomputed to correct the righthandside.
+     *
+     *  If blockNormalEquations is provided, the normal equations are accumulated in this object (which must be newly
+     *  created), instead of in normalMatrix and normalRightHandSide (which are then returned empty).
+     *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsCollection.
+     *  \param weightsMatrixDiagonals Diagonal of observation weights matrix
+     *  \param normalMatrix Normalized normal matrix H^T*W*H (returned by reference)
+     *  \param normalRightHandSide Normalized righthandside of normal equations H^T*W*y (returned by reference)
+     *  \param residuals Residuals of computed w.r.t. input observable values (returned by reference)
+     *  \param normalizationTerms Values by which the columns of the design matrix have been normalized (returned by reference)
+     *  \param blockNormalEquations Block-arrowhead normal equations in which the normal equations are to be accumulated
+     *  (modified by this function), or nullptr if normalMatrix and normalRightHandSide are to be used.
+     */
+    void calculateNormalEquationsAndResiduals(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const int parameterVectorSize, const int totalObservationSize,
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            Eigen::MatrixXd& normalMatrix,
+            Eigen::VectorXd& normalRightHandSide,
+            Eigen::VectorXd& residuals,
+            Eigen::VectorXd& normalizationTerms,
+            const std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > blockNormalEquations = nullptr )
+    {
+        // Initialize return data.
+        if( blockNormalEquations == nullptr )
+        {
+            normalMatrix = Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
+            normalRightHandSide = Eigen::VectorXd::Zero( parameterVectorSize );
+        }
+        else
+        {
+            normalMatrix = Eigen::MatrixXd::Zero( 0, 0 );
+            normalRightHandSide = Eigen::VectorXd::Zero( 0 );
+        }
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+
+        Eigen::VectorXd minimumPartials = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
+        Eigen::VectorXd maximumPartials = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
+
+        typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
+                sortedObservations = observationsCollection->getObservations( );
 
         // Iterate over all observable types in observationsAndTimes
         for( auto observablesIterator : sortedObservations )
@@ -407,51 +769,238 @@ public:
                     std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
                                 currentObservableType ).at( currentLinkEnds ).at( i );
 
-                    // Compute estimated ranges and range partials from current parameter estimate.
-                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                    observationsWithPartials = observationManagers_[ currentObservableType ]->
-                            computeObservationsWithPartials(
+                    // Compute estimated observations and partials from current parameter estimate.
+                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                            observationManagers_[ currentObservableType ]->computeObservationsWithPartials(
                                 currentObservations->getObservationTimes( ), currentLinkEnds,
                                 currentObservations->getReferenceLinkEnd( ),
                                 currentObservations->getAncilliarySettings( ) );
 
-                    // Compute residuals for current link ends and observabel type.
-                    if( calculateResiduals )
+                    residuals.segment( observationIndices.first, observationIndices.second ) =
+                            ( currentObservations->getObservationsVector( ) - observationsWithPartials.first ).template cast< double >( );
+
+                    // Update extreme values of partials, used for normalization
+                    if( observationIndices.second > 0 )
                     {
-                        residuals.segment( observationIndices.first, observationIndices.second ) =
-                                ( currentObservations->getObservationsVector( ) - observationsWithPartials.first ).template cast< double >( );
+                        Eigen::VectorXd currentMinimumPartials = observationsWithPartials.second.colwise( ).minCoeff( ).transpose( );
+                        Eigen::VectorXd currentMaximumPartials = observationsWithPartials.second.colwise( ).maxCoeff( ).transpose( );
+                        for( int j = 0; j < parameterVectorSize; j++ )
+                        {
+                            if( !( currentMinimumPartials( j ) >= minimumPartials( j ) ) )
+                            {
+                                minimumPartials( j ) = currentMinimumPartials( j );
+                            }
+                            if( !( currentMaximumPartials( j ) <= maximumPartials( j ) ) )
+                            {
+                                maximumPartials( j ) = currentMaximumPartials( j );
+                            }
+                        }
                     }
 
-                    // Set current observation partials in matrix of all partials
-                    designMatrix.block( observationIndices.first, 0, observationIndices.second, parameterVectorSize ) =
-                            observationsWithPartials.second;
+                    // Add (unnormalized) contribution of current observation set to normal equations
+                    if( blockNormalEquations == nullptr )
+                    {
+                        linear_algebra::addObservationBlockToNormalEquations(
+                                    observationsWithPartials.second,
+                                    residuals.segment( observationIndices.first, observationIndices.second ),
+                                    weightsMatrixDiagonals.segment( observationIndices.first, observationIndices.second ),
+                                    normalMatrix, normalRightHandSide );
+                    }
+                    else
+                    {
+                        blockNormalEquations->addObservationBlock(
+                                    observationsWithPartials.second,
+                                    residuals.segment( observationIndices.first, observationIndices.second ),
+                                    weightsMatrixDiagonals.segment( observationIndices.first, observationIndices.second ) );
+                    }
+                }
+            }
+
+            std::pair< int, int > observableStartAndSize =
+                    observationsCollection->getObservationTypeStartAndSize( ).at( currentObservableType );
+            Eigen::VectorXd uncorrectedResiduals = residuals.segment( observableStartAndSize.first, observableStartAndSize.second );
+            observation_models::checkObservationResidualDiscontinuities(
+                        residuals.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 ),
+                        currentObservableType );
 
+            // Correct righthandside for observation sets of which residuals have been corrected for discontinuities
+            if( uncorrectedResiduals != residuals.segment( observableStartAndSize.first, observableStartAndSize.second ) )
+            {
+                for( auto dataIterator : observablesIterator.second )
+                {
+                    observation_models::LinkEnds currentLinkEnds = dataIterator.first;
+                    for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+                    {
+                        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                                dataIterator.second.at( i );
+                        std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
+                                    currentObservableType ).at( currentLinkEnds ).at( i );
+
+                        Eigen::VectorXd residualCorrection =
+                                residuals.segment( observationIndices.first, observationIndices.second ) -
+                                uncorrectedResiduals.segment( observationIndices.first - observableStartAndSize.first,
+                                                              observationIndices.second );
+                        if( !residualCorrection.isZero( 0.0 ) )
+                        {
+                            Eigen::MatrixXd currentPartials = observationManagers_[ currentObservableType ]->
+                                    computeObservationsWithPartials(
+                                        currentObservations->getObservationTimes( ), currentLinkEnds,
+                                        currentObservations->getReferenceLinkEnd( ),
+                                        currentObservations->getAncilliarySettings( ) ).second;
+                            if( blockNormalEquations == nullptr )
+                            {
+                                normalRightHandSide.noalias( ) += currentPartials.transpose( ) * (
+                                            weightsMatrixDiagonals.segment( observationIndices.first, observationIndices.second ).
+                                            cwiseProduct( residualCorrection ) );
+                            }
+                            else
+                            {
+                                blockNormalEquations->addObservationBlock(
+                                            currentPartials, residualCorrection,
+                                            weightsMatrixDiagonals.segment( observationIndices.first, observationIndices.second ),
+                                            false );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        // Compute normalization terms in the same manner as normalizeDesignMatrix, and normalize normal equations
+        normalizationTerms = Eigen::VectorXd::Ones( parameterVectorSize );
+        for( int i = 0; i < parameterVectorSize; i++ )
+        {
+            if( minimumPartials( i ) == minimumPartials( i ) )
+            {
+                if( std::fabs( minimumPartials( i ) ) > maximumPartials( i ) )
+                {
+                    normalizationTerms( i ) = minimumPartials( i );
                 }
+                else
+                {
+                    normalizationTerms( i ) = maximumPartials( i );
+                }
+                if( normalizationTerms( i ) == 0.0 )
+                {
+                    normalizationTerms( i ) = 1.0;
+                }
+            }
+        }
 
+        if( blockNormalEquations == nullptr )
+        {
+            linear_algebra::symmetrizeNormalMatrix( normalMatrix );
+            for( int i = 0; i < parameterVectorSize; i++ )
+            {
+                for( int j = 0; j < parameterVectorSize; j++ )
+                {
+                    normalMatrix( i, j ) /= ( normalizationTerms( i ) * normalizationTerms( j ) );
+                }
+                normalRightHandSide( i ) /= normalizationTerms( i );
             }
+        }
+        else
+        {
+            blockNormalEquations->symmetrize( );
+            blockNormalEquations->normalize( normalizationTerms );
+        }
+    }
 
-            if( calculateResiduals )
+    //! Function to retrieve the indices of the parameters that are local to each arc of a multi-arc estimation
+    /*!
+     *  Function to retrieve the indices of the parameters that are local to each arc of a multi-arc estimation, for use
+     *  in BlockArrowheadNormalEquations. The arcs are defined by the start times of the estimated arc-wise initial
+     *  translational states. The initial states of all bodies in an arc, and the arc-wise constant (absolute and relative)
+     *  observation biases of which the arc lies within a single propagation arc, are local to that arc. All other
+     *  parameters are global.
+     *  \return Indices (in full parameter vector) of the local parameters of each arc, sorted by arc start time
+     */
+    std::vector< std::vector< int > > getArcWiseLocalParameterIndices( )
+    {
+        // Collect initial state parameter indices per arc start time
+        std::vector< std::pair< double, std::vector< int > > > arcParameterIndices;
+        for( auto parameterIterator : parametersToEstimate_->getInitialMultiArcStateParameters( ) )
+        {
+            std::shared_ptr< estimatable_parameters::ArcWiseInitialTranslationalStateParameter< ObservationScalarType > >
+                    arcWiseStateParameter = std::dynamic_pointer_cast<
+                    estimatable_parameters::ArcWiseInitialTranslationalStateParameter< ObservationScalarType > >(
+                        parameterIterator.second );
+            if( arcWiseStateParameter == nullptr )
             {
-                std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( currentObservableType );
+                continue;
+            }
 
-                observation_models::checkObservationResidualDiscontinuities(
-                            residuals.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 ),
-                            currentObservableType );
+            std::vector< double > currentArcStartTimes = arcWiseStateParameter->getArcStartTimes( );
+            for( unsigned int i = 0; i < currentArcStartTimes.size( ); i++ )
+            {
+                int arcIndex = -1;
+                for( unsigned int j = 0; j < arcParameterIndices.size( ); j++ )
+                {
+                    if( std::fabs( currentArcStartTimes.at( i ) - arcParameterIndices.at( j ).first ) <
+                            std::max( 4.0 * std::fabs( arcParameterIndices.at( j ).first ) *
+                                      std::numeric_limits< double >::epsilon( ), 1.0E-12 ) )
+                    {
+                        arcIndex = j;
+                    }
+                }
+                if( arcIndex < 0 )
+                {
+                    arcIndex = arcParameterIndices.size( );
+                    arcParameterIndices.push_back( std::make_pair( currentArcStartTimes.at( i ), std::vector< int >( ) ) );
+                }
+
+                for( int j = 0; j < 6; j++ )
+                {
+                    arcParameterIndices[ arcIndex ].second.push_back( parameterIterator.first + 6 * i + j );
+                }
             }
         }
-//        std::cout << "end calculateObservationMatrixAndResiduals" << "\n\n";
+        std::sort( arcParameterIndices.begin( ), arcParameterIndices.end( ),
+                   []( const std::pair< double, std::vector< int > >& arc1,
+                       const std::pair< double, std::vector< int > >& arc2 ){ return arc1.first < arc2.first; } );
 
-    }
+        // Add arc-wise biases that are active in a single arc only
+        for( auto parameterIterator : parametersToEstimate_->getVectorParameters( ) )
+        {
+            std::shared_ptr< estimatable_parameters::ArcWiseObservationBiasParameter > biasParameter =
+                    std::dynamic_pointer_cast< estimatable_parameters::ArcWiseObservationBiasParameter >(
+                        parameterIterator.second );
+            if( biasParameter == nullptr || arcParameterIndices.size( ) == 0 )
+            {
+                continue;
+            }
 
-    void calculateDesignMatrix(
-            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
-            const int parameterVectorSize, const int totalObservationSize,
-            Eigen::MatrixXd& designMatrix )
-    {
-        Eigen::VectorXd dummyVector;
-        calculateDesignMatrixAndResiduals(
-                    observationsCollection, parameterVectorSize, totalObservationSize, designMatrix, dummyVector, false );
+            // Bias of first arc is also used before its start time, bias of last arc until end of observations
+            std::vector< double > biasArcStartTimes = biasParameter->getArcStartTimes( );
+            int biasSize = biasParameter->getParameterSize( ) / static_cast< int >( biasArcStartTimes.size( ) );
+            for( unsigned int i = 0; i < biasArcStartTimes.size( ); i++ )
+            {
+                double biasArcStartTime = ( i == 0 ) ? -std::numeric_limits< double >::infinity( ) : biasArcStartTimes.at( i );
+                double biasArcEndTime = ( i == biasArcStartTimes.size( ) - 1 ) ?
+                            std::numeric_limits< double >::infinity( ) : biasArcStartTimes.at( i + 1 );
 
+                unsigned int arcIndex = 0;
+                while( arcIndex + 1 < arcParameterIndices.size( ) &&
+                       arcParameterIndices.at( arcIndex + 1 ).first <= biasArcStartTime )
+                {
+                    arcIndex++;
+                }
+                if( arcIndex + 1 == arcParameterIndices.size( ) ||
+                        biasArcEndTime <= arcParameterIndices.at( arcIndex + 1 ).first )
+                {
+                    for( int j = 0; j < biasSize; j++ )
+                    {
+                        arcParameterIndices[ arcIndex ].second.push_back( parameterIterator.first + i * biasSize + j );
+                    }
+                }
+            }
+        }
+
+        std::vector< std::vector< int > > localParameterIndices;
+        for( unsigned int i = 0; i < arcParameterIndices.size( ); i++ )
+        {
+            localParameterIndices.push_back( arcParameterIndices.at( i ).second );
+        }
+        return localParameterIndices;
     }
 
     Eigen::MatrixXd normalizeAprioriCovariance(
@@ -600,29 +1149,76 @@ public:
             std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
         }
 
-        // Calculate residuals and observation matrix for current parameter estimate.
-        Eigen::MatrixXd designMatrix;
-        calculateDesignMatrix(
-                    estimationInput->getObservationCollection( ),
-                    numberOfEstimatedParameters, totalNumberOfObservations, designMatrix );
-
-        Eigen::VectorXd normalizationTerms = normalizeDesignMatrix( designMatrix );
-        Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
-                estimationInput->getInverseOfAprioriCovariance( numberOfEstimatedParameters ), normalizationTerms );
-
         Eigen::MatrixXd constraintStateMultiplier;
         Eigen::VectorXd constraintRightHandSide;
         parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
 
-        Eigen::MatrixXd inverseNormalizedCovariance = linear_algebra::calculateInverseOfUpdatedCovarianceMatrix(
-                               designMatrix.block( 0, 0, designMatrix.rows( ), numberOfEstimatedParameters ),
-                               estimationInput->getWeightsMatrixDiagonals( ),
-                               normalizedInverseAprioriCovarianceMatrix, constraintStateMultiplier, constraintRightHandSide );
+        // Calculate observation matrix (or normal equations) for current parameter estimate.
+        Eigen::MatrixXd designMatrix;
+        Eigen::VectorXd normalizationTerms;
+        Eigen::MatrixXd inverseNormalizedCovariance;
+        std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > inverseNormalizedCovarianceBlocks;
+        if( estimationInput->getAccumulateNormalEquations( ) && estimationInput->getReduceArcWiseParameters( ) &&
+                constraintStateMultiplier.rows( ) == 0 )
+        {
+            // Store inverse covariance in block form
+            Eigen::VectorXd residuals, normalRightHandSide;
+            inverseNormalizedCovarianceBlocks = std::make_shared< linear_algebra::BlockArrowheadNormalEquations >(
+                        numberOfEstimatedParameters, getArcWiseLocalParameterIndices( ) );
+            calculateNormalEquationsAndResiduals(
+                        estimationInput->getObservationCollection( ),
+                        numberOfEstimatedParameters, totalNumberOfObservations, estimationInput->getWeightsMatrixDiagonals( ),
+                        inverseNormalizedCovariance, normalRightHandSide, residuals, normalizationTerms,
+                        inverseNormalizedCovarianceBlocks );
+            designMatrix = Eigen::MatrixXd::Zero( 0, numberOfEstimatedParameters );
+
+            if( estimationInput->getInverseOfAprioriCovariance( ).rows( ) > 0 )
+            {
+                inverseNormalizedCovarianceBlocks->addInverseAprioriCovariance(
+                            normalizeAprioriCovariance(
+                                estimationInput->getInverseOfAprioriCovariance( numberOfEstimatedParameters ), normalizationTerms ) );
+            }
+        }
+        else if( estimationInput->getAccumulateNormalEquations( ) )
+        {
+            Eigen::VectorXd residuals, normalRightHandSide;
+            calculateNormalEquationsAndResiduals(
+                        estimationInput->getObservationCollection( ),
+                        numberOfEstimatedParameters, totalNumberOfObservations, estimationInput->getWeightsMatrixDiagonals( ),
+                        inverseNormalizedCovariance, normalRightHandSide, residuals, normalizationTerms );
+            designMatrix = Eigen::MatrixXd::Zero( 0, numberOfEstimatedParameters );
+
+            linear_algebra::addAprioriInformationAndConstraintsToNormalEquations(
+                        inverseNormalizedCovariance, normalRightHandSide,
+                        normalizeAprioriCovariance(
+                            estimationInput->getInverseOfAprioriCovariance( numberOfEstimatedParameters ), normalizationTerms ),
+                        constraintStateMultiplier, constraintRightHandSide );
+        }
+        else
+        {
+            calculateDesignMatrix(
+                        estimationInput->getObservationCollection( ),
+                        numberOfEstimatedParameters, totalNumberOfObservations, designMatrix,
+                        estimationInput->getNumberOfObservationSetThreads( ) );
+
+            normalizationTerms = normalizeDesignMatrix( designMatrix );
+            Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
+                    estimationInput->getInverseOfAprioriCovariance( numberOfEstimatedParameters ), normalizationTerms );
+
+            inverseNormalizedCovariance = linear_algebra::calculateInverseOfUpdatedCovarianceMatrix(
+                                   designMatrix.block( 0, 0, designMatrix.rows( ), numberOfEstimatedParameters ),
+                                   estimationInput->getWeightsMatrixDiagonals( ),
+                                   normalizedInverseAprioriCovarianceMatrix, constraintStateMultiplier, constraintRightHandSide );
+        }
 
         std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > estimationOutput =
                 std::make_shared< CovarianceAnalysisOutput< ObservationScalarType, TimeType > >(
                      designMatrix, estimationInput->getWeightsMatrixDiagonals( ), normalizationTerms,
                     inverseNormalizedCovariance, exceptionDuringPropagation );
+        if( inverseNormalizedCovarianceBlocks != nullptr )
+        {
+            estimationOutput->setNormalizedInverseCovarianceBlocks( inverseNormalizedCovarianceBlocks );
+        }
 
         return estimationOutput;
     }
@@ -653,9 +1249,14 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestDesignMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        Eigen::MatrixXd bestDesignMatrix = Eigen::MatrixXd::Constant(
+                    estimationInput->getAccumulateNormalEquations( ) ? 0 : totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( parameterVectorSize, parameterVectorSize, TUDAT_NAN );
+        bool storeCovarianceBlocks =
+                estimationInput->getAccumulateNormalEquations( ) && estimationInput->getReduceArcWiseParameters( );
+        Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant(
+                    storeCovarianceBlocks ? 0 : parameterVectorSize, storeCovarianceBlocks ? 0 : parameterVectorSize, TUDAT_NAN );
+        std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > bestInverseNormalizedCovarianceBlocks;
 
         std::vector< Eigen::VectorXd > residualHistory;
         std::vector< ParameterVectorType > parameterHistory;
@@ -708,34 +1309,102 @@ public:
                 std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
             }
 
-            // Calculate residuals and observation matrix for current parameter estimate.
+            // Calculate residuals and observation matrix (or normal equations) for current parameter estimate.
             Eigen::VectorXd residuals;
             Eigen::MatrixXd designMatrix;
-            calculateDesignMatrixAndResiduals(
-                        estimationInput->getObservationCollection( ),
-                        parameterVectorSize,
-                        totalNumberOfObservations,
-                        designMatrix,
-                        residuals,
-                        true );
+            Eigen::VectorXd normalizationTerms;
+            Eigen::MatrixXd normalMatrix;
+            Eigen::VectorXd normalRightHandSide;
+            std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > blockNormalEquations;
+            if( estimationInput->getAccumulateNormalEquations( ) )
+            {
+                if( estimationInput->getReduceArcWiseParameters( ) )
+                {
+                    blockNormalEquations = std::make_shared< linear_algebra::BlockArrowheadNormalEquations >(
+                                parameterVectorSize, getArcWiseLocalParameterIndices( ) );
+                }
+                calculateNormalEquationsAndResiduals(
+                            estimationInput->getObservationCollection( ),
+                            parameterVectorSize,
+                            totalNumberOfObservations,
+                            estimationInput->getWeightsMatrixDiagonals( ),
+                            normalMatrix,
+                            normalRightHandSide,
+                            residuals,
+                            normalizationTerms,
+                            blockNormalEquations );
+                designMatrix = Eigen::MatrixXd::Zero( 0, parameterVectorSize );
+            }
+            else
+            {
+                calculateDesignMatrixAndResiduals(
+                            estimationInput->getObservationCollection( ),
+                            parameterVectorSize,
+                            totalNumberOfObservations,
+                            designMatrix,
+                            residuals,
+                            true,
+                            estimationInput->getNumberOfObservationSetThreads( ) );
+
+                normalizationTerms = normalizeDesignMatrix( designMatrix );
+            }
 
-            Eigen::VectorXd normalizationTerms = normalizeDesignMatrix( designMatrix );
-            Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
-                    estimationInput->getInverseOfAprioriCovariance( parameterVectorSize ), normalizationTerms );
+            // If the arc-wise parameters are reduced, the (full) a priori covariance is only normalized if it is provided
+            Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero( 0, 0 );
+            if( blockNormalEquations == nullptr || estimationInput->getInverseOfAprioriCovariance( ).rows( ) > 0 )
+            {
+                normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
+                        estimationInput->getInverseOfAprioriCovariance( parameterVectorSize ), normalizationTerms );
+            }
 
             // Perform least squares calculation for correction to parameter vector.
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > leastSquaresOutput;
+            std::shared_ptr< linear_algebra::BlockArrowheadNormalEquations > inverseNormalizedCovarianceBlocks;
             try
             {
                 Eigen::MatrixXd constraintStateMultiplier;
                 Eigen::VectorXd constraintRightHandSide;
                 parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
 //                std::cout << "before least-squares adjustment" << "\n\n";
-                leastSquaresOutput =
-                        std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
-                                       designMatrix.block( 0, 0, designMatrix.rows( ), numberOfEstimatedParameters ),
-                                       residuals, estimationInput->getWeightsMatrixDiagonals( ),
-                                       normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                if( blockNormalEquations != nullptr && constraintStateMultiplier.rows( ) == 0 )
+                {
+                    // Inverse covariance is retained in block form
+                    std::pair< Eigen::VectorXd, linear_algebra::BlockArrowheadNormalEquations > blockLeastSquaresOutput =
+                            linear_algebra::performLeastSquaresAdjustmentFromBlockArrowheadNormalEquations(
+                                *blockNormalEquations, normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8,
+                                estimationInput->getUseSvdForIllConditionedNormalEquations( ) );
+                    leastSquaresOutput.first = std::move( blockLeastSquaresOutput.first );
+                    inverseNormalizedCovarianceBlocks = std::make_shared< linear_algebra::BlockArrowheadNormalEquations >(
+                                std::move( blockLeastSquaresOutput.second ) );
+                }
+                else if( estimationInput->getAccumulateNormalEquations( ) )
+                {
+                    // Constrained problems are solved from the full normal equations
+                    if( blockNormalEquations != nullptr )
+                    {
+                        normalMatrix = blockNormalEquations->getFullNormalMatrix( );
+                        normalRightHandSide = blockNormalEquations->getFullRightHandSide( );
+                        if( normalizedInverseAprioriCovarianceMatrix.rows( ) == 0 )
+                        {
+                            normalizedInverseAprioriCovarianceMatrix =
+                                    Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
+                        }
+                    }
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                           normalMatrix, normalRightHandSide,
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8,
+                                           constraintStateMultiplier, constraintRightHandSide,
+                                           estimationInput->getUseSvdForIllConditionedNormalEquations( ) ) );
+                }
+                else
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
+                                           designMatrix.block( 0, 0, designMatrix.rows( ), numberOfEstimatedParameters ),
+                                           residuals, estimationInput->getWeightsMatrixDiagonals( ),
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
 //                std::cout << "after least-squares adjustment" << "\n\n";
 
                 if( constraintStateMultiplier.rows( ) > 0 )
@@ -808,6 +1477,7 @@ public:
                 bestWeightsMatrixDiagonal = std::move( estimationInput->getWeightsMatrixDiagonals( ) );
                 bestTransformationData = std::move( normalizationTerms );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
+                bestInverseNormalizedCovarianceBlocks = inverseNormalizedCovarianceBlocks;
                 bestIteration = numberOfIterations;
             }
 
@@ -830,6 +1500,10 @@ public:
                     bestInverseNormalizedCovarianceMatrix, bestResidual, bestIteration,
                     residualHistory, parameterHistory, exceptionDuringInversion,
                     exceptionDuringPropagation );
+        if( bestInverseNormalizedCovarianceBlocks != nullptr )
+        {
+            estimationOutput->setNormalizedInverseCovarianceBlocks( bestInverseNormalizedCovarianceBlocks );
+        }
 
         if( estimationInput->getSaveStateHistoryForEachIteration( ) )
         {
@@ -977,12 +1651,15 @@ protected:
      *  \param propagatorSettings Settings for propagator.
      *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
      *  true)
+     *  \param arcWiseBodies List of environments, one per arc, used for multi-arc propagation (if empty, bodies is used
+     *  for all arcs)
      */
     void initializeOrbitDeterminationManager(
             const SystemOfBodies &bodies,
             const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationSettingsList,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
-            const bool propagateOnCreation = true )
+            const bool propagateOnCreation = true,
+            const std::vector< SystemOfBodies >& arcWiseBodies = std::vector< SystemOfBodies >( ) )
     {
         propagators::toggleIntegratedResultSettings< ObservationScalarType, TimeType >( propagatorSettings );
         using namespace numerical_integrators;
@@ -1006,9 +1683,18 @@ protected:
         propagatorSettings->getOutputSettingsBase( )->setCreateDependentVariablesInterface( true );
         if( integrateAndEstimateOrbit_ )
         {
-            variationalEquationsSolver_ =
-                    simulation_setup::createVariationalEquationsSolver< ObservationScalarType, TimeType >(
-                        bodies, propagatorSettings, parametersToEstimate_, propagateOnCreation );
+            if( arcWiseBodies.size( ) > 0 )
+            {
+                variationalEquationsSolver_ =
+                        simulation_setup::createVariationalEquationsSolver< ObservationScalarType, TimeType >(
+                            bodies, arcWiseBodies, propagatorSettings, parametersToEstimate_, propagateOnCreation );
+            }
+            else
+            {
+                variationalEquationsSolver_ =
+                        simulation_setup::createVariationalEquationsSolver< ObservationScalarType, TimeType >(
+                            bodies, propagatorSettings, parametersToEstimate_, propagateOnCreation );
+            }
         }
 
         if( integrateAndEstimateOrbit_ )
@@ -1033,9 +1719,10 @@ protected:
 
 
         // Iterate over all observables and create observation managers.
-        std::map< ObservableType, std::vector< std::shared_ptr< ObservationModelSettings > > > sortedObservationSettingsList =
-                sortObservationModelSettingsByType( observationSettingsList );
-        for( auto it : sortedObservationSettingsList )
+        bodies_ = bodies;
+        observationSettingsPerType_ = sortObservationModelSettingsByType( observationSettingsList );
+        threadObservationManagers_.clear( );
+        for( auto it : observationSettingsPerType_ )
         {
             // Call createObservationSimulator of required observation size
             ObservableType observableType = it.first;
@@ -1092,6 +1779,15 @@ protected:
     std::map< observation_models::ObservableType,
     std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > observationManagers_;
 
+    //! Observation managers used by the additional threads when computing observations in parallel (see
+    //! createThreadObservationManagers), with entry i used by thread i + 1.
+    std::vector< std::map< observation_models::ObservableType,
+    std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > > threadObservationManagers_;
+
+    //! Settings of the observation models, per observable type, from which the observation managers are created
+    std::map< observation_models::ObservableType, std::vector< std::shared_ptr< observation_models::ObservationModelSettings > > >
+    observationSettingsPerType_;
+
     //! Container object for all parameters that are to be estimated
     std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate_;
 
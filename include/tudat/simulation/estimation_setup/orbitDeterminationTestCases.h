@@ -349,7 +349,9 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
         const TimeType startTime = TimeType( 1.0E7 ),
         const int numberOfDaysOfData = 3,
         const int numberOfIterations = 5,
-        const bool useFullParameterSet = true )
+        const bool useFullParameterSet = true,
+        const bool accumulateNormalEquations = false,
+        const int numberOfObservationSetThreads = 1 )
 {
 
     //Load spice kernels.
@@ -634,6 +636,8 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
 
     estimationInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
     estimationInput->defineEstimationSettings( true, true, true, true, false );
+    estimationInput->defineNormalEquationsSettings( accumulateNormalEquations );
+    estimationInput->setNumberOfObservationSetThreads( numberOfObservationSetThreads );
     estimationInput->setConvergenceChecker(
                 std::make_shared< EstimationConvergenceChecker >( numberOfIterations ) );
 
@@ -654,7 +658,9 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
 //        const double startTime,
 //        const int numberOfDaysOfData,
 //        const int numberOfIterations,
-//        const bool useFullParameterSet );
+//        const bool useFullParameterSet,
+//        const bool accumulateNormalEquations,
+//        const int numberOfObservationSetThreads );
 
 
 
@@ -668,7 +674,8 @@ std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
         const bool estimateAbsoluteBiases = true,
         const bool omitRangeData = false,
         const bool useMultiArcBiases = false,
-        const bool estimateTimeBiases = false )
+        const bool estimateTimeBiases = false,
+        const int numberOfObservationSetThreads = 1 )
 {
 
     const int numberOfDaysOfData = 1;
@@ -1232,6 +1239,7 @@ std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
 
     estimationInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
     estimationInput->defineEstimationSettings( true, false, false, true, false );
+    estimationInput->setNumberOfObservationSetThreads( numberOfObservationSetThreads );
     estimationInput->setConvergenceChecker(
                 std::make_shared< EstimationConvergenceChecker >( numberOfIterations ) );
 
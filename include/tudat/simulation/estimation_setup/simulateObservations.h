@@ -11,6 +11,7 @@
 #ifndef TUDAT_SIMULATEOBSERVATIONS_H
 #define TUDAT_SIMULATEOBSERVATIONS_H
 
+#include <atomic>
 #include <memory>
 
 #include <functional>
@@ -198,10 +199,157 @@ simulateObservationsWithCheckAndLinkEndIdOutput(
                 dependentVariableCalculator, ancilliarySettings );
 }
 
+//! Data of a single simulated (viable) observation, prior to the addition of noise and dependent variables
+template< typename ObservationScalarType = double, typename TimeType = double >
+struct SimulatedObservationData
+{
+    //! Time at reference link end at which observation is simulated
+    TimeType observationTime_;
+
+    //! Value of (noise-free) observation
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observation_;
+
+    //! States of link ends used to compute observation
+    std::vector< Eigen::Vector6d > linkEndStates_;
+
+    //! Times of link ends used to compute observation
+    std::vector< double > linkEndTimes_;
+};
+
+//! Function to create a single observation set from a list of (viable) simulated observations
+/*!
+ *  Function to create a single observation set from a list of (viable) simulated observations, adding the noise and
+ *  dependent variables defined by the observation simulation settings. The noise and dependent variables are computed
+ *  for the observations in the order in which they are provided, so that the noise function is evaluated in the same
+ *  order as when simulating the observations one by one.
+ *  \param observationData List of viable simulated observations
+ *  \param observationsToSimulate Settings from which the observations were simulated
+ *  \param sortObservationTimes Boolean denoting whether the observations are to be sorted by time (with only the last
+ *  observation retained for duplicate times), as done when simulating observations at tabulated times.
+ *  \return Simulated observation set
+ */
+template< typename ObservationScalarType = double, typename TimeType = double, int ObservationSize = 1 >
+std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+createSimulatedObservationSet(
+        const std::vector< SimulatedObservationData< ObservationScalarType, TimeType > >& observationData,
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const bool sortObservationTimes )
+{
+    observation_models::ObservableType observableType = observationsToSimulate->getObservableType( );
+    std::function< Eigen::VectorXd( const double ) > noiseFunction = observationsToSimulate->getObservationNoiseFunction( );
+    std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator =
+            observationsToSimulate->getDependentVariableCalculator( );
+
+    std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > sortedObservations;
+    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
+    std::vector< TimeType > observationTimes;
+    std::vector< Eigen::VectorXd > observationsDependentVariables;
+
+    Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
+    Eigen::VectorXd currentDependentVariable;
+    for( unsigned int i = 0; i < observationData.size( ); i++ )
+    {
+        currentObservation = observationData.at( i ).observation_;
+        currentDependentVariable = Eigen::VectorXd::Zero( 0 );
+        addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
+                    currentObservation, observationData.at( i ).observationTime_, currentDependentVariable,
+                    observationData.at( i ).linkEndStates_, observationData.at( i ).linkEndTimes_, observableType,
+                    noiseFunction, dependentVariableCalculator );
+
+        if( sortObservationTimes )
+        {
+            sortedObservations[ observationData.at( i ).observationTime_ ] = currentObservation;
+        }
+        else
+        {
+            observations.push_back( currentObservation );
+            observationTimes.push_back( observationData.at( i ).observationTime_ );
+        }
+        observationsDependentVariables.push_back( currentDependentVariable );
+    }
+
+    if( sortObservationTimes )
+    {
+        observations = utilities::createVectorFromMapValues( sortedObservations );
+        observationTimes = utilities::createVectorFromMapKeys( sortedObservations );
+    }
+
+    return std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
+                observableType, observationsToSimulate->getLinkEnds( ).linkEnds_,
+                observations, observationTimes, observationsToSimulate->getReferenceLinkEndType( ),
+                observationsDependentVariables, dependentVariableCalculator,
+                observationsToSimulate->getAncilliarySettings( ) );
+}
+
+//! Function to compute the viable observations at a range of tabulated times
+/*!
+ *  Function to compute the viable observations at a range of tabulated times, without noise and dependent variables
+ *  (which are added by createSimulatedObservationSet).
+ *  \param observationsToSimulate Settings defining the observation times, reference link end and viability settings
+ *  \param observationModel Observation model that is to be used to compute observations
+ *  \param bodies System of bodies used to create the viability calculators
+ *  \param firstTimeIndex Index of first observation time (in list of simulation times) that is to be computed
+ *  \param numberOfTimes Number of observation times that is to be computed
+ *  \return List of viable simulated observations, in order of the observation times
+ */
+template< typename ObservationScalarType = double, typename TimeType = double, int ObservationSize = 1 >
+std::vector< SimulatedObservationData< ObservationScalarType, TimeType > > simulateTabulatedViableObservationData(
+        const std::shared_ptr< TabulatedObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const SystemOfBodies& bodies,
+        const int firstTimeIndex,
+        const int numberOfTimes )
+{
+    std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > viabilityCalculators =
+            observation_models::createObservationViabilityCalculators(
+                bodies,
+                observationsToSimulate->getLinkEnds( ).linkEnds_,
+                observationsToSimulate->getObservableType( ),
+                observationsToSimulate->getViabilitySettingsList( ) );
+
+    observation_models::LinkEndType referenceLinkEnd = observationsToSimulate->getReferenceLinkEndType( );
+    std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings =
+            observationsToSimulate->getAncilliarySettings( );
+
+    // Compute observations at all times in a single call, so that the observation model can exploit the similarity
+    // of subsequent observations (e.g. in the light-time solution)
+    std::vector< TimeType > observationTimes(
+                observationsToSimulate->simulationTimes_.begin( ) + firstTimeIndex,
+                observationsToSimulate->simulationTimes_.begin( ) + firstTimeIndex + numberOfTimes );
+    std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations;
+    std::vector< std::vector< double > > linkEndTimes;
+    std::vector< std::vector< Eigen::Vector6d > > linkEndStates;
+    observationModel->computeObservationsWithLinkEndDataForTimes(
+                observationTimes, referenceLinkEnd, observations, linkEndTimes, linkEndStates, ancilliarySettings );
+
+    std::vector< SimulatedObservationData< ObservationScalarType, TimeType > > observationData;
+    SimulatedObservationData< ObservationScalarType, TimeType > currentObservationData;
+    for( int i = 0; i < numberOfTimes; i++ )
+    {
+        if( isObservationViable( linkEndStates.at( i ), linkEndTimes.at( i ), viabilityCalculators ) )
+        {
+            currentObservationData.observationTime_ = observationTimes.at( i );
+            currentObservationData.observation_ = observations.at( i );
+            currentObservationData.linkEndTimes_ = linkEndTimes.at( i );
+            currentObservationData.linkEndStates_ = linkEndStates.at( i );
+            observationData.push_back( currentObservationData );
+        }
+    }
+    return observationData;
+}
+
+//! Function to compute the viable observations for per-arc observation simulation settings
+/*!
+ *  Function to compute the viable observations for per-arc observation simulation settings, without noise and dependent
+ *  variables (which are added by createSimulatedObservationSet).
+ *  \param observationsToSimulate Settings defining the observation arcs, reference link end and viability settings
+ *  \param observationModel Observation model that is to be used to compute observations
+ *  \param bodies System of bodies used to create the viability calculators
+ *  \return List of viable simulated observations, in order of the observation times
+ */
 template< typename ObservationScalarType = double, typename TimeType = double,
           int ObservationSize = 1 >
-std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
-simulatePerArcSingleObservationSet(
+std::vector< SimulatedObservationData< ObservationScalarType, TimeType > > simulatePerArcViableObservationData(
         const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
         const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
         const SystemOfBodies& bodies )
@@ -297,40 +445,42 @@ simulatePerArcSingleObservationSet(
                 observationsToSimulate->getObservableType( ),
                 observationsToSimulate->additionalViabilitySettingsList_ );
 
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
-    std::vector< TimeType > observationTimes;
-    std::vector< Eigen::VectorXd > observationsDependentVariables;
-
-    Eigen::VectorXd currentDependentVariable;
+    std::vector< SimulatedObservationData< ObservationScalarType, TimeType > > observationData;
+    SimulatedObservationData< ObservationScalarType, TimeType > currentObservationData;
     for( unsigned int i = 0; i < simulatedObservations.size( ); i++ )
     {
         for( auto it : simulatedObservations.at( i ) )
         {
             SingleObservationData singleObservation = it.second;
-            currentObservation = std::get< 0 >( singleObservation );
             vectorOfStates = std::get< 1 >( singleObservation );
             vectorOfTimes = std::get< 2 >( singleObservation );
-            currentDependentVariable = Eigen::VectorXd::Zero( 0 );
 
             observationFeasible = isObservationViable( vectorOfStates, vectorOfTimes, additionalViabilityCalculators );
             if( observationFeasible )
             {
-                addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
-                            currentObservation, it.first, currentDependentVariable, vectorOfStates, vectorOfTimes,
-                            observationModel->getObservableType( ),
-                            observationsToSimulate->getObservationNoiseFunction( ),
-                            observationsToSimulate->getDependentVariableCalculator( ) );
-                observations.push_back( currentObservation );
-                observationTimes.push_back( it.first );
-                observationsDependentVariables.push_back( currentDependentVariable );
+                currentObservationData.observationTime_ = it.first;
+                currentObservationData.observation_ = std::get< 0 >( singleObservation );
+                currentObservationData.linkEndStates_ = vectorOfStates;
+                currentObservationData.linkEndTimes_ = vectorOfTimes;
+                observationData.push_back( currentObservationData );
             }
         }
     }
 
-    return std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
-                observationModel->getObservableType( ), observationModel->getLinkEnds( ),
-                observations, observationTimes, referenceLinkEnd, observationsDependentVariables,
-                observationsToSimulate->getDependentVariableCalculator( ), ancilliarySettings );
+    return observationData;
+}
+
+template< typename ObservationScalarType = double, typename TimeType = double,
+          int ObservationSize = 1 >
+std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+simulatePerArcSingleObservationSet(
+        const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const SystemOfBodies& bodies )
+{
+    return createSimulatedObservationSet< ObservationScalarType, TimeType, ObservationSize >(
+                simulatePerArcViableObservationData( observationsToSimulate, observationModel, bodies ),
+                observationsToSimulate, false );
 }
 
 //! Function to compute observations at times defined by settings object using a given observation model
@@ -511,6 +661,213 @@ std::shared_ptr< observation_models::ObservationCollection< ObservationScalarTyp
     return observationCollection;
 }
 
+//! Function to simulate observations from set of observables and link and sets, using multiple threads
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, using multiple
+ *  threads. The work is split into tasks, with each task computing the (noise-free) observations of either a chunk of
+ *  the observation times of a single TabulatedObservationSimulationSettings, or all observations of a single
+ *  PerArcObservationSimulationSettings (for which the arcs can only be determined sequentially). The tasks are
+ *  distributed dynamically over the threads, with each thread using its own set of observation models (created from the
+ *  observation model settings) and its own viability calculators.
+ *
+ *  The noise and observation dependent variables are added after all tasks are finished, in a single thread, in the
+ *  order of the observation settings and observation times. The resulting observation collection (including the
+ *  realization of the noise) is therefore identical to that obtained from simulateObservations, regardless of the number
+ *  of threads and the size of the chunks. Note that the environment models used by the observation models (e.g. the
+ *  ephemerides and rotation models of the bodies) must allow concurrent evaluation when using more than one thread.
+ *  \param observationsToSimulate List of observation simulation settings (tabulated or per-arc)
+ *  \param observationModelSettings List of settings for the observation models, from which one set of observation
+ *  simulators is created for each thread
+ *  \param bodies System of bodies in the simulation
+ *  \param numberOfThreads Number of threads that is to be used
+ *  \param numberOfObservationTimesPerChunk Number of observation times that is simulated in a single task, for
+ *  tabulated observation simulation settings
+ *  \return Simulated observation values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > simulateObservationsInParallel(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationModelSettings,
+        const SystemOfBodies& bodies,
+        const int numberOfThreads,
+        const int numberOfObservationTimesPerChunk = 1000 )
+{
+    if( numberOfObservationTimesPerChunk < 1 )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, number of observation times per chunk must be positive" );
+    }
+
+    // Define tasks: index of observation settings, index of first observation time and number of observation times
+    // (-1 for per-arc settings)
+    std::vector< std::tuple< int, int, int > > simulationTasks;
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        if( std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >(
+                    observationsToSimulate.at( i ) ) != nullptr )
+        {
+            int numberOfTimes = static_cast< int >(
+                        std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >(
+                            observationsToSimulate.at( i ) )->simulationTimes_.size( ) );
+            for( int j = 0; j < numberOfTimes; j += numberOfObservationTimesPerChunk )
+            {
+                simulationTasks.push_back(
+                            std::make_tuple( i, j, std::min( numberOfObservationTimesPerChunk, numberOfTimes - j ) ) );
+            }
+        }
+        else if( std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >(
+                     observationsToSimulate.at( i ) ) != nullptr )
+        {
+            simulationTasks.push_back( std::make_tuple( i, 0, -1 ) );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when simulating observations in parallel, observation simulation settings of type " +
+                                      observation_models::getObservableName(
+                                          observationsToSimulate.at( i )->getObservableType( ) ) +
+                                      " not recognized" );
+        }
+    }
+
+    // Create observation simulators for each thread
+    int numberOfWorkers = std::max( 1, std::min( numberOfThreads, static_cast< int >( simulationTasks.size( ) ) ) );
+    std::vector< std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > > >
+            workerObservationSimulators;
+    for( int i = 0; i < numberOfWorkers; i++ )
+    {
+        workerObservationSimulators.push_back(
+                    observation_models::createObservationSimulators< ObservationScalarType, TimeType >(
+                        observationModelSettings, bodies ) );
+    }
+
+    // Compute viable noise-free observations of all tasks, with each thread retrieving the next available task
+    std::vector< std::vector< SimulatedObservationData< ObservationScalarType, TimeType > > > taskObservationData(
+                simulationTasks.size( ) );
+    std::atomic< int > nextTaskIndex( 0 );
+    utilities::parallelForEachBlock(
+                numberOfWorkers, numberOfWorkers, [ & ]( const int, const int, const int workerIndex )
+    {
+        const std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > >&
+                observationSimulators = workerObservationSimulators.at( workerIndex );
+
+        int taskIndex = nextTaskIndex++;
+        while( taskIndex < static_cast< int >( simulationTasks.size( ) ) )
+        {
+            std::shared_ptr< ObservationSimulationSettings< TimeType > > currentObservationsToSimulate =
+                    observationsToSimulate.at( std::get< 0 >( simulationTasks.at( taskIndex ) ) );
+            observation_models::ObservableType observableType = currentObservationsToSimulate->getObservableType( );
+            observation_models::LinkEnds linkEnds = currentObservationsToSimulate->getLinkEnds( ).linkEnds_;
+            int firstTimeIndex = std::get< 1 >( simulationTasks.at( taskIndex ) );
+            int numberOfTimes = std::get< 2 >( simulationTasks.at( taskIndex ) );
+
+            int observationSize = observation_models::getObservableSize( observableType );
+            switch( observationSize )
+            {
+            case 1:
+            {
+                std::shared_ptr< observation_models::ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                        observation_models::getObservationSimulatorOfType< 1 >( observationSimulators, observableType );
+                if( derivedObservationSimulator == nullptr )
+                {
+                    throw std::runtime_error( "Error when simulating observation: dynamic cast to size 1 is nullptr" );
+                }
+
+                taskObservationData[ taskIndex ] = ( numberOfTimes < 0 ) ?
+                            simulatePerArcViableObservationData< ObservationScalarType, TimeType, 1 >(
+                                std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( currentObservationsToSimulate ),
+                                derivedObservationSimulator->getObservationModel( linkEnds ), bodies ) :
+                            simulateTabulatedViableObservationData< ObservationScalarType, TimeType, 1 >(
+                                std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( currentObservationsToSimulate ),
+                                derivedObservationSimulator->getObservationModel( linkEnds ), bodies, firstTimeIndex, numberOfTimes );
+                break;
+            }
+            case 2:
+            {
+                std::shared_ptr< observation_models::ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                        observation_models::getObservationSimulatorOfType< 2 >( observationSimulators, observableType );
+                if( derivedObservationSimulator == nullptr )
+                {
+                    throw std::runtime_error( "Error when simulating observation: dynamic cast to size 2 is nullptr" );
+                }
+
+                taskObservationData[ taskIndex ] = ( numberOfTimes < 0 ) ?
+                            simulatePerArcViableObservationData< ObservationScalarType, TimeType, 2 >(
+                                std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( currentObservationsToSimulate ),
+                                derivedObservationSimulator->getObservationModel( linkEnds ), bodies ) :
+                            simulateTabulatedViableObservationData< ObservationScalarType, TimeType, 2 >(
+                                std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( currentObservationsToSimulate ),
+                                derivedObservationSimulator->getObservationModel( linkEnds ), bodies, firstTimeIndex, numberOfTimes );
+                break;
+            }
+            case 3:
+            {
+                std::shared_ptr< observation_models::ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                        observation_models::getObservationSimulatorOfType< 3 >( observationSimulators, observableType );
+                if( derivedObservationSimulator == nullptr )
+                {
+                    throw std::runtime_error( "Error when simulating observation: dynamic cast to size 3 is nullptr" );
+                }
+
+                taskObservationData[ taskIndex ] = ( numberOfTimes < 0 ) ?
+                            simulatePerArcViableObservationData< ObservationScalarType, TimeType, 3 >(
+                                std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( currentObservationsToSimulate ),
+                                derivedObservationSimulator->getObservationModel( linkEnds ), bodies ) :
+                            simulateTabulatedViableObservationData< ObservationScalarType, TimeType, 3 >(
+                                std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( currentObservationsToSimulate ),
+                                derivedObservationSimulator->getObservationModel( linkEnds ), bodies, firstTimeIndex, numberOfTimes );
+                break;
+            }
+            default:
+                throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                          std::to_string( observationSize ) );
+            }
+            taskIndex = nextTaskIndex++;
+        }
+    } );
+
+    // Merge results of tasks (in order), and add noise and dependent variables
+    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets sortedObservations;
+    unsigned int taskIndex = 0;
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        std::vector< SimulatedObservationData< ObservationScalarType, TimeType > > observationData;
+        bool isTabulated = true;
+        while( taskIndex < simulationTasks.size( ) && std::get< 0 >( simulationTasks.at( taskIndex ) ) == static_cast< int >( i ) )
+        {
+            isTabulated = ( std::get< 2 >( simulationTasks.at( taskIndex ) ) >= 0 );
+            observationData.insert( observationData.end( ), taskObservationData.at( taskIndex ).begin( ),
+                                    taskObservationData.at( taskIndex ).end( ) );
+            taskObservationData[ taskIndex ].clear( );
+            taskIndex++;
+        }
+
+        observation_models::ObservableType observableType = observationsToSimulate.at( i )->getObservableType( );
+        observation_models::LinkEnds linkEnds = observationsToSimulate.at( i )->getLinkEnds( ).linkEnds_;
+        switch( observation_models::getObservableSize( observableType ) )
+        {
+        case 1:
+            sortedObservations[ observableType ][ linkEnds ].push_back(
+                        createSimulatedObservationSet< ObservationScalarType, TimeType, 1 >(
+                            observationData, observationsToSimulate.at( i ), isTabulated ) );
+            break;
+        case 2:
+            sortedObservations[ observableType ][ linkEnds ].push_back(
+                        createSimulatedObservationSet< ObservationScalarType, TimeType, 2 >(
+                            observationData, observationsToSimulate.at( i ), isTabulated ) );
+            break;
+        case 3:
+            sortedObservations[ observableType ][ linkEnds ].push_back(
+                        createSimulatedObservationSet< ObservationScalarType, TimeType, 3 >(
+                            observationData, observationsToSimulate.at( i ), isTabulated ) );
+            break;
+        default:
+            throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                      std::to_string( observation_models::getObservableSize( observableType ) ) );
+        }
+    }
+
+    return std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >( sortedObservations );
+}
+
 template< typename ObservationScalarType = double, typename TimeType = double >
 std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > setExistingObservations(
         const std::map< observation_models::ObservableType, std::pair< observation_models::LinkEnds,
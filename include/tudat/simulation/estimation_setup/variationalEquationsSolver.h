@@ -903,7 +903,7 @@ public:
         return variationalPropagationResults_->getSensitivitySolution( );
     }
 
-    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionSolution( )
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionSolution( )
     {
         return dynamicsSimulator_->getEquationsOfMotionNumericalSolution( );
     }
@@ -1160,6 +1160,66 @@ public:
         resetMultiArcDynamicsAfterPropagation_( propagatorSettings != nullptr ?
                 propagatorSettings->getOutputSettingsWithCheck( )->getSetIntegratedResult( ) : false )
     {
+        initializeMultiArcVariationalEquationsSolver(
+                    std::vector< simulation_setup::SystemOfBodies >( ), integrateEquationsOnCreation );
+    }
+
+    //! Constructor, with a separate environment for each arc
+    /*!
+     *  Constructor, with a separate environment for each arc, so that the dynamics and variational equations of
+     *  different arcs can be propagated concurrently (see
+     *  MultiArcPropagatorProcessingSettings::setNumberOfArcPropagationThreads). The dynamical models in the propagator
+     *  settings of each arc must have been created from the environment of that arc. Typically, the arc-wise
+     *  environments are created from a single environment using simulation_setup::cloneSystemOfBodies.
+     *
+     *  Estimated parameters other than initial states act on the environment models from which they were created, and
+     *  would not be applied to the arc-wise environments. Therefore, only (arc-wise) initial states may be estimated
+     *  with this constructor; an exception is thrown otherwise.
+     *  \param bodies Environment used for post-processing of the multi-arc propagation results (e.g. setting the
+     *  integrated ephemerides), and from which the parameters are created.
+     *  \param arcWiseBodies List of environments, one per arc, used for the propagation of each arc
+     *  \param propagatorSettings Settings for propagator.
+     *  \param parametersToEstimate Object containing all parameters that are to be estimated and their current settings and values.
+     *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
+     *  end of this contructor (default false).
+     */
+    MultiArcVariationalEquationsSolver(
+            const simulation_setup::SystemOfBodies& bodies,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies,
+            const std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
+            const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate,
+            const bool integrateEquationsOnCreation = false ):
+        VariationalEquationsSolver< StateScalarType, TimeType >(
+            bodies, parametersToEstimate, propagatorSettings != nullptr ?
+                propagatorSettings->getOutputSettingsWithCheck( )->getClearNumericalSolutions( ) : false  ),
+        propagatorSettings_( propagatorSettings ),
+        resetMultiArcDynamicsAfterPropagation_( propagatorSettings != nullptr ?
+                propagatorSettings->getOutputSettingsWithCheck( )->getSetIntegratedResult( ) : false )
+    {
+        if( parametersToEstimate->getEstimatedDoubleParameters( ).size( ) > 0 ||
+                parametersToEstimate->getEstimatedVectorParameters( ).size( ) > 0 )
+        {
+            throw std::runtime_error( "Error when making multi-arc variational equations solver with arc-wise environments, "
+                                      "only initial states can be estimated." );
+        }
+        initializeMultiArcVariationalEquationsSolver( arcWiseBodies, integrateEquationsOnCreation );
+    }
+
+private:
+
+    //! Function to create the dynamics simulator and variational equations, called by constructor
+    /*!
+     *  Function to create the dynamics simulator and variational equations, called by constructor
+     *  \param arcWiseBodies List of environments, one per arc (if empty, bodies_ is used for all arcs)
+     *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately
+     */
+    void initializeMultiArcVariationalEquationsSolver(
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies,
+            const bool integrateEquationsOnCreation )
+    {
+        std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings = propagatorSettings_;
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate =
+                parametersToEstimate_;
         if(  std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) == nullptr )
         {
             throw std::runtime_error( "Error when making multi-arc variational equations solver, input is single-arc" );
@@ -1189,8 +1249,16 @@ public:
             arcWiseParameterVectorSize_.push_back( estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate, arc ) );
         }
 
-        dynamicsSimulator_ =  std::make_shared< MultiArcDynamicsSimulator< StateScalarType, TimeType > >(
-                    bodies, propagatorSettings, false );
+        if( arcWiseBodies.size( ) > 0 )
+        {
+            dynamicsSimulator_ =  std::make_shared< MultiArcDynamicsSimulator< StateScalarType, TimeType > >(
+                        bodies_, arcWiseBodies, propagatorSettings, false );
+        }
+        else
+        {
+            dynamicsSimulator_ =  std::make_shared< MultiArcDynamicsSimulator< StateScalarType, TimeType > >(
+                        bodies_, propagatorSettings, false );
+        }
 
         std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
                 dynamicsSimulator_->getSingleArcDynamicsSimulators( );
@@ -1213,7 +1281,8 @@ public:
             // Create variational equations objects.
             std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
                     simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
-                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), bodies, arcWiseParametersToEstimate_[ i ] );
+                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ),
+                        arcWiseBodies.size( ) > 0 ? arcWiseBodies.at( i ) : bodies_, arcWiseParametersToEstimate_[ i ] );
 
             std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
                     std::make_shared< VariationalEquations >(
@@ -1232,6 +1301,8 @@ public:
 
     }
 
+public:
+
     MultiArcVariationalEquationsSolver(
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
@@ -175,10 +175,7 @@ public:
             const std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::VectorXd > > dependentVariablesInterpolator,
             const std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariablesSettings ):
             DependentVariablesInterface< TimeType >( dependentVariablesSettings ),
-            dependentVariablesInterpolator_( dependentVariablesInterpolator )
-    {
-        dependentVariables_ = Eigen::VectorXd::Zero( dependentVariablesSize_ );
-    }
+            dependentVariablesInterpolator_( dependentVariablesInterpolator ){ }
 
     //! Destructor.
     ~SingleArcDependentVariablesInterface( ){ }
@@ -212,19 +209,12 @@ public:
      */
     Eigen::VectorXd getDependentVariables( const TimeType evaluationTime )
     {
-        dependentVariables_.setZero( );
-
-        // Set dependent variable.
-        dependentVariables_ = dependentVariablesInterpolator_->interpolate( evaluationTime );
-        return dependentVariables_;
+        return dependentVariablesInterpolator_->interpolate( evaluationTime );
     }
 
 
 private:
 
-    //! Predefined vector to use as return value when calling getDependentVariables.
-    Eigen::VectorXd dependentVariables_;
-
     //! Interpolator returning the dependent variables as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::VectorXd > > dependentVariablesInterpolator_;
 
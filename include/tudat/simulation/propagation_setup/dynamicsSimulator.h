@@ -11,6 +11,7 @@
 #ifndef TUDAT_DYNAMICSSIMULATOR_H
 #define TUDAT_DYNAMICSSIMULATOR_H
 
+#include <map>
 #include <vector>
 #include <string>
 #include <chrono>
@@ -302,8 +303,16 @@ void printPropagatedDependentVariableContent (
                 std::cout << "PROPAGATION FINISHED."<<std::endl;
                 if( printSettings->getPrintNumberOfFunctionEvaluations( ) )
                 {
-                    std::cout << "Total Number of Function Evaluations: "
-                              << propagationResults->getTotalNumberOfFunctionEvaluations( ) << std::endl;
+                    if( propagationResults->isNumberOfFunctionEvaluationsRecorded( ) )
+                    {
+                        std::cout << "Total Number of Function Evaluations: "
+                                  << propagationResults->getTotalNumberOfFunctionEvaluations( ) << std::endl;
+                    }
+                    else
+                    {
+                        std::cout << "Total Number of Function Evaluations: not recorded (state derivative diagnostics disabled)"
+                                  << std::endl;
+                    }
                 }
                 if( printSettings->getPrintPropagationTime( ) )
                 {
@@ -770,7 +779,10 @@ public:
         }
         propagationResults_= std::make_shared< SingleArcSimulationResults< StateScalarType, TimeType > >(
                     dependentVariableIds_, integratedStateAndBodyList, propagatorSettings_->getOutputSettingsWithCheck( ),
-                    std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::convertNumericalStateSolutionsToOutputSolutions,
+                    std::bind( static_cast< void( DynamicsStateDerivativeModel< TimeType, StateScalarType >::* )(
+                                   utilities::ColumnarTimeHistory< TimeType, StateScalarType >&,
+                                   const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& ) >(
+                                   &DynamicsStateDerivativeModel< TimeType, StateScalarType >::convertNumericalStateSolutionsToOutputSolutions ),
                                dynamicsStateDerivative_,
                                std::placeholders::_1, std::placeholders::_2 ), dependentVariableInterface ) ;
 
@@ -1047,7 +1059,7 @@ public:
         {
             try {
                 // Create and set interpolators for ephemerides
-                resetIntegratedStates( propagationResults_->equationsOfMotionNumericalSolution_,
+                resetIntegratedStates( propagationResults_->equationsOfMotionNumericalSolution_.getHistory( ),
                                        integratedStateProcessors_ );
             }
             catch ( const std::exception &caughtException ) {
@@ -1057,7 +1069,7 @@ public:
                 std::cerr << caughtException.what( ) << std::endl << std::endl;
                 std::cerr <<
                           "The problem may be that there is an insufficient number of data points (epochs) at which propagation results are produced. Integrated results are given at" +
-                          std::to_string( propagationResults_->equationsOfMotionNumericalSolution_.size( )) + " epochs"
+                          std::to_string( propagationResults_->equationsOfMotionNumericalSolution_.size( ) ) + " epochs"
                           << std::endl;
             }
 
@@ -1114,9 +1126,9 @@ public:
      * Function to return the map of state history of numerically integrated bodies.
      * \return Map of state history of numerically integrated bodies.
      */
-    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolution( )
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolution( )
     {
-        return propagationResults_->equationsOfMotionNumericalSolution_;
+        return propagationResults_->equationsOfMotionNumericalSolution_.getMap( );
     }
 
     //! Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
@@ -1124,9 +1136,9 @@ public:
      * Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
      * \return Map of state history of numerically integrated bodies, in propagation coordinates.
      */
-    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolutionRaw( )
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolutionRaw( )
     {
-        return propagationResults_->equationsOfMotionNumericalSolutionRaw_;
+        return propagationResults_->equationsOfMotionNumericalSolutionRaw_.getMap( );
     }
 
     //! Function to return the map of dependent variable history that was saved during numerical propagation.
@@ -1134,9 +1146,9 @@ public:
      * Function to return the map of dependent variable history that was saved during numerical propagation.
      * \return Map of dependent variable history that was saved during numerical propagation.
      */
-    const std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
+    std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
     {
-        return propagationResults_->dependentVariableHistory_;
+        return propagationResults_->dependentVariableHistory_.getMap( );
     }
 
     //! Function to return the map of cumulative computation time history that was saved during numerical propagation.
@@ -1146,7 +1158,7 @@ public:
      */
     std::map< TimeType, double > getCumulativeComputationTimeHistory( )
     {
-        return propagationResults_->cumulativeComputationTimeHistory_;
+        return propagationResults_->cumulativeComputationTimeHistory_.getMap( );
     }
 
     //! Function to return the map of number of cumulative function evaluations that was saved during numerical propagation.
@@ -1156,7 +1168,7 @@ public:
      */
     std::map< TimeType, unsigned int > getCumulativeNumberOfFunctionEvaluations( )
     {
-        return propagationResults_->cumulativeNumberOfFunctionEvaluations_;
+        return propagationResults_->cumulativeNumberOfFunctionEvaluations_.getMap( );
     }
 
 
@@ -1217,6 +1229,9 @@ protected:
     //! Interface object that updates current environment and returns state derivative from single function call.
     std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative_;
 
+    //! Object recording number of calls and clock time of models evaluated in the current/last propagation (if requested)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
     //! Function that performs a single state derivative function evaluation.
     /*!
      *  Function that performs a single state derivative function evaluation, will typically be set to
@@ -1275,6 +1290,18 @@ private:
         simulation_setup::setAreBodiesInPropagation( bodies_, true );
         dynamicsStateDerivative_->updateStateDerivativeModelSettings( processedInitialState.block(
                 0, processedInitialState.cols( ) - 1, processedInitialState.rows(), 1  ) );
+
+        // Create function that writes the state derivative into the buffers of the integrator
+        typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns > PropagatedStateType;
+        std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative =
+                dynamicsStateDerivative_;
+        std::function< void( const TimeType, const PropagatedStateType&, PropagatedStateType& ) >
+                inPlaceStateDerivativeFunction = [ dynamicsStateDerivative ](
+                const TimeType time, const PropagatedStateType& state, PropagatedStateType& stateDerivative )
+        {
+            dynamicsStateDerivative->computeStateDerivativeInPlace( time, state, stateDerivative );
+        };
+
         integrateEquations< SimulationResults, Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >, TimeType >(
                 stateDerivativeFunction_,
                 processedInitialState ,
@@ -1284,7 +1311,8 @@ private:
                 propagationResults,
                 dependentVariablesFunctions_,
                 statePostProcessingFunction,
-                propagatorSettings_->getOutputSettings( ) );
+                propagatorSettings_->getOutputSettings( ),
+                inPlaceStateDerivativeFunction );
         simulation_setup::setAreBodiesInPropagation( bodies_, false );
     }
 
@@ -1303,6 +1331,21 @@ private:
     {
         // Reset functions
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), true, SimulationResults::is_variational );
+        dynamicsStateDerivative_->setDiagnosticsLevel( outputSettings_->getStateDerivativeDiagnosticsLevel( ) );
+        if( environmentUpdater_ != nullptr )
+        {
+            environmentUpdater_->resetIncrementalUpdates( );
+        }
+
+        // Create new profiler for model evaluations, if requested
+        modelEvaluationProfiler_ = outputSettings_->getProfileModelEvaluations( ) ?
+                    std::make_shared< utilities::ModelEvaluationProfiler >( ) : nullptr;
+        dynamicsStateDerivative_->setModelEvaluationProfiler( modelEvaluationProfiler_ );
+        if( environmentUpdater_ != nullptr )
+        {
+            environmentUpdater_->setModelEvaluationProfiler( modelEvaluationProfiler_ );
+        }
+
         dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
         dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
         resetPropagationTerminationConditions( );
@@ -1330,6 +1373,7 @@ private:
     {
         // Retrieve number of cumulative function evaluations
         propagationResults->finalizePropagation( dynamicsStateDerivative_->getCumulativeNumberOfFunctionEvaluations( ) );
+        propagationResults->setModelEvaluationProfiler( modelEvaluationProfiler_ );
         PropagationPrintingInterface< SimulationResults, StateScalarType, TimeType >::printSingleArcPostPropagationMessages(
                 outputSettings_->getPrintSettings( ),
                                                outputSettings_->getPropagationEndHeader( ),
@@ -1647,6 +1691,71 @@ public:
             DynamicsSimulator<StateScalarType, TimeType>(
                     bodies, propagatorSettings ),
             multiArcPropagatorSettings_( propagatorSettings )
+    {
+        initializeMultiArcSimulator( std::vector< simulation_setup::SystemOfBodies >( ), areEquationsOfMotionToBeIntegrated );
+    }
+
+    //! Constructor of multi-arc simulator, with a separate environment for each arc.
+    /*!
+     *  Constructor of multi-arc simulator, with a separate environment for each arc. The dynamical models in the
+     *  propagator settings of each arc must have been created from the environment of that arc. Arcs that do not
+     *  share any body objects, environment models or dynamical models can be propagated concurrently (see
+     *  MultiArcPropagatorProcessingSettings::setNumberOfArcPropagationThreads). Typically, the arc-wise environments are
+     *  created from a single environment using simulation_setup::cloneSystemOfBodies.
+     *  \param bodies Environment used for post-processing of the multi-arc propagation results (e.g. setting the
+     *  integrated ephemerides)
+     *  \param arcWiseBodies List of environments, one per arc, used for the propagation of each arc
+     *  \param propagatorSettings Propagator settings for dynamics (must be of multi arc type)
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated at
+     *  the end of the contructor or not.
+     */
+    MultiArcDynamicsSimulator(
+            const simulation_setup::SystemOfBodies &bodies,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies,
+            const std::shared_ptr<MultiArcPropagatorSettings<StateScalarType, TimeType> > propagatorSettings,
+            const bool areEquationsOfMotionToBeIntegrated = true ) :
+            DynamicsSimulator<StateScalarType, TimeType>(
+                    bodies, propagatorSettings ),
+            multiArcPropagatorSettings_( propagatorSettings )
+    {
+        if( multiArcPropagatorSettings_ != nullptr &&
+                arcWiseBodies.size( ) != multiArcPropagatorSettings_->getSingleArcSettings( ).size( ) )
+        {
+            throw std::runtime_error( "Error when creating multi-arc dynamics simulator, number of environments (" +
+                                      std::to_string( arcWiseBodies.size( ) ) + ") is not equal to number of arcs (" +
+                                      std::to_string( multiArcPropagatorSettings_->getSingleArcSettings( ).size( ) ) + ")" );
+        }
+        initializeMultiArcSimulator( arcWiseBodies, areEquationsOfMotionToBeIntegrated );
+    }
+
+    //! Constructor of multi-arc simulator, with a separate environment for each arc.
+    /*!
+     *  Constructor of multi-arc simulator, with a separate environment for each arc, see constructor above. The
+     *  environment of the first arc is used for post-processing of the multi-arc propagation results.
+     *  \param arcWiseBodies List of environments, one per arc
+     *  \param propagatorSettings Propagator settings for dynamics (must be of multi arc type)
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated at
+     *  the end of the contructor or not.
+     */
+    MultiArcDynamicsSimulator(
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies,
+            const std::shared_ptr<MultiArcPropagatorSettings<StateScalarType, TimeType> > propagatorSettings,
+            const bool areEquationsOfMotionToBeIntegrated = true ) :
+            MultiArcDynamicsSimulator(
+                    arcWiseBodies.size( ) > 0 ? arcWiseBodies.at( 0 ) : simulation_setup::SystemOfBodies( ),
+                    arcWiseBodies, propagatorSettings, areEquationsOfMotionToBeIntegrated ){ }
+
+private:
+
+    //! Function to create the single-arc simulators and results objects, called by constructor
+    /*!
+     *  Function to create the single-arc simulators and results objects, called by constructor
+     *  \param arcWiseBodies List of environments, one per arc (if empty, bodies_ is used for all arcs)
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated
+     */
+    void initializeMultiArcSimulator(
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies,
+            const bool areEquationsOfMotionToBeIntegrated )
     {
         if ( multiArcPropagatorSettings_ == nullptr )
         {
@@ -1663,7 +1772,7 @@ public:
             for ( unsigned int i = 0; i < singleArcSettings.size( ); i++ ) {
                 singleArcDynamicsSimulators_.push_back(
                         std::make_shared<SingleArcDynamicsSimulator<StateScalarType, TimeType> >(
-                                bodies, singleArcSettings.at( i ), false ));
+                                arcWiseBodies.size( ) > 0 ? arcWiseBodies.at( i ) : bodies_, singleArcSettings.at( i ), false ));
                 singleArcResults.push_back( singleArcDynamicsSimulators_.at( i )->getSingleArcPropagationResults( ));
                 singleArcDynamicsSimulators_.at( i )->createAndSetIntegratedStateProcessors( );
             }
@@ -1691,6 +1800,8 @@ public:
         }
     }
 
+public:
+
 
     //! Constructor of multi-arc simulator for same integration settings per arc.
     /*!
@@ -1757,15 +1868,164 @@ public:
         Eigen::Matrix<StateScalarType, Eigen::Dynamic, Eigen::Dynamic> currentArcInitialState =
                 stateProvider->getArcInitialState( arcIndex, initialStateFromPreviousArc );
         if ( initialStateFromPreviousArc ) {
-            currentArcInitialState.block( 0, currentArcInitialState.cols( ) - 1, currentArcInitialState.rows( ),
-                                          1 ) = getArcInitialStateFromPreviousArcResult(
-                    propagationResults_->getSingleArcResults( ).at(
-                            arcIndex - 1 )->getEquationsOfMotionNumericalSolution( ),
-                    singleArcDynamicsSimulators_.at( arcIndex )->getInitialPropagationTime( ));
+            setArcInitialStateFromPreviousArc( arcIndex, currentArcInitialState );
         }
         return currentArcInitialState;
     }
 
+    //! Function to set the initial state of an arc from the propagation results of the previous arc
+    /*!
+     *  Function to set the initial state of an arc from the propagation results of the previous arc (which must have
+     *  been propagated already).
+     *  \param arcIndex Index of arc for which the initial state is to be set
+     *  \param currentArcInitialState Initial state of arc, of which the last column is set by this function (returned
+     *  by reference)
+     */
+    void setArcInitialStateFromPreviousArc(
+            const int arcIndex,
+            Eigen::Matrix<StateScalarType, Eigen::Dynamic, Eigen::Dynamic>& currentArcInitialState )
+    {
+        currentArcInitialState.block( 0, currentArcInitialState.cols( ) - 1, currentArcInitialState.rows( ),
+                                      1 ) = getArcInitialStateFromPreviousArcResult(
+                propagationResults_->getSingleArcResults( ).at(
+                        arcIndex - 1 )->getEquationsOfMotionNumericalSolution( ),
+                singleArcDynamicsSimulators_.at( arcIndex )->getInitialPropagationTime( ));
+    }
+
+    //! Function to determine groups of arcs that have to be propagated sequentially
+    /*!
+     *  Function to determine groups of arcs that have to be propagated sequentially, because they share body objects,
+     *  environment models or state derivative/acceleration models (which store time-dependent state during
+     *  propagation), or because the initial state of an arc is taken from the results of the previous arc. Different
+     *  groups can be propagated concurrently.
+     *  \param arcInitialStateFromPreviousArc List of booleans denoting, per arc, whether its initial state is taken from
+     *  the previous arc.
+     *  \return List of arc groups, each of which contains arc indices in increasing order. Groups are sorted by their
+     *  first arc index.
+     */
+    std::vector< std::vector< int > > getSequentialArcGroups( const std::vector< bool >& arcInitialStateFromPreviousArc )
+    {
+        int numberOfArcs = static_cast< int >( singleArcDynamicsSimulators_.size( ) );
+
+        // Union-find over arc indices
+        std::vector< int > parentArc( numberOfArcs );
+        for( int i = 0; i < numberOfArcs; i++ )
+        {
+            parentArc.at( i ) = i;
+        }
+        auto findRootArc = [ & ]( int arcIndex )
+        {
+            while( parentArc.at( arcIndex ) != arcIndex )
+            {
+                parentArc.at( arcIndex ) = parentArc.at( parentArc.at( arcIndex ) );
+                arcIndex = parentArc.at( arcIndex );
+            }
+            return arcIndex;
+        };
+        auto mergeArcs = [ & ]( const int firstArc, const int secondArc )
+        {
+            int firstRoot = findRootArc( firstArc );
+            int secondRoot = findRootArc( secondArc );
+            if( firstRoot != secondRoot )
+            {
+                parentArc.at( std::max( firstRoot, secondRoot ) ) = std::min( firstRoot, secondRoot );
+            }
+        };
+
+        // Merge arcs that use the same objects that hold mutable state during propagation
+        std::map< const void*, int > firstArcUsingObject;
+        auto registerObject = [ & ]( const void* object, const int arcIndex )
+        {
+            if( object != nullptr )
+            {
+                auto objectIterator = firstArcUsingObject.find( object );
+                if( objectIterator == firstArcUsingObject.end( ) )
+                {
+                    firstArcUsingObject[ object ] = arcIndex;
+                }
+                else
+                {
+                    mergeArcs( objectIterator->second, arcIndex );
+                }
+            }
+        };
+
+        for( int i = 0; i < numberOfArcs; i++ )
+        {
+            for( auto bodyIterator: singleArcDynamicsSimulators_.at( i )->getSystemOfBodies( ).getMap( ) )
+            {
+                std::shared_ptr< simulation_setup::Body > currentBody = bodyIterator.second;
+                registerObject( currentBody.get( ), i );
+
+                // Environment models of different bodies may be shared (e.g. after manually copying a body)
+                registerObject( currentBody->getEphemeris( ).get( ), i );
+                registerObject( currentBody->getRotationalEphemeris( ).get( ), i );
+                registerObject( currentBody->getGravityFieldModel( ).get( ), i );
+                registerObject( currentBody->getAtmosphereModel( ).get( ), i );
+                registerObject( currentBody->getAerodynamicCoefficientInterface( ).get( ), i );
+                registerObject( currentBody->getFlightConditions( ).get( ), i );
+                for( auto radiationPressureIterator: currentBody->getRadiationPressureInterfaces( ) )
+                {
+                    registerObject( radiationPressureIterator.second.get( ), i );
+                }
+                if( currentBody->getVehicleSystems( ) != nullptr )
+                {
+                    registerObject( currentBody->getVehicleSystems( ).get( ), i );
+                    for( auto engineIterator: currentBody->getVehicleSystems( )->getEngineModels( ) )
+                    {
+                        registerObject( engineIterator.second.get( ), i );
+                        registerObject( engineIterator.second->getThrustMagnitudeWrapper( ).get( ), i );
+                    }
+                }
+            }
+
+            for( auto stateTypeIterator: singleArcDynamicsSimulators_.at( i )->getDynamicsStateDerivative( )->getStateDerivativeModels( ) )
+            {
+                for( unsigned int j = 0; j < stateTypeIterator.second.size( ); j++ )
+                {
+                    registerObject( stateTypeIterator.second.at( j ).get( ), i );
+
+                    std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > translationalStateDerivative =
+                            std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >(
+                                stateTypeIterator.second.at( j ) );
+                    if( translationalStateDerivative != nullptr )
+                    {
+                        for( auto bodyUndergoingIterator: translationalStateDerivative->getAccelerationsMap( ) )
+                        {
+                            for( auto bodyExertingIterator: bodyUndergoingIterator.second )
+                            {
+                                for( unsigned int k = 0; k < bodyExertingIterator.second.size( ); k++ )
+                                {
+                                    registerObject( bodyExertingIterator.second.at( k ).get( ), i );
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            if( i > 0 && arcInitialStateFromPreviousArc.at( i ) )
+            {
+                mergeArcs( i - 1, i );
+            }
+        }
+
+        // Collect arcs per group; since roots are the lowest arc index in a group, groups are created in order
+        std::vector< std::vector< int > > arcGroups;
+        std::map< int, int > groupIndexPerRoot;
+        for( int i = 0; i < numberOfArcs; i++ )
+        {
+            int rootArc = findRootArc( i );
+            if( groupIndexPerRoot.count( rootArc ) == 0 )
+            {
+                groupIndexPerRoot[ rootArc ] = static_cast< int >( arcGroups.size( ) );
+                arcGroups.push_back( std::vector< int >( ) );
+            }
+            arcGroups.at( groupIndexPerRoot.at( rootArc ) ).push_back( i );
+        }
+        return arcGroups;
+    }
+
     //! This function numerically (re-)integrates the equations of motion, using concatenated states for all arcs
     /*!
      *  This function numerically (re-)integrates the equations of motion, using the settings set through the constructor
@@ -1831,14 +2091,56 @@ public:
         printPrePropagationMessages( );
 
 
-        // Propagate dynamics for each arc
-        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        unsigned int numberOfThreads = multiArcPropagatorSettings_->getOutputSettings( )->getNumberOfArcPropagationThreads( );
+        if( numberOfThreads < 2 || singleArcDynamicsSimulators_.size( ) < 2 )
         {
-            currentArcInitialState = getArcInitialState( i, initialStateProvider );
-            arcInitialStateList.push_back( currentArcInitialState );
+            // Propagate dynamics for each arc
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+            {
+                currentArcInitialState = getArcInitialState( i, initialStateProvider );
+                arcInitialStateList.push_back( currentArcInitialState );
 
-            singleArcDynamicsSimulators_.at( i )->template integrateEquationsOfMotion<
-                    typename MultiArcSimulationResults::single_arc_type >( currentArcInitialState, propagationResults->getSingleArcResults( ).at( i ) );
+                singleArcDynamicsSimulators_.at( i )->template integrateEquationsOfMotion<
+                        typename MultiArcSimulationResults::single_arc_type >( currentArcInitialState, propagationResults->getSingleArcResults( ).at( i ) );
+            }
+        }
+        else
+        {
+            // Retrieve initial states from provider before propagation; states taken from previous arc are set when
+            // the previous arc has been propagated
+            std::vector< bool > arcInitialStateFromPreviousArc( singleArcDynamicsSimulators_.size( ) );
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+            {
+                bool initialStateFromPreviousArc = false;
+                arcInitialStateList.push_back( initialStateProvider->getArcInitialState( i, initialStateFromPreviousArc ) );
+                arcInitialStateFromPreviousArc.at( i ) = initialStateFromPreviousArc;
+            }
+
+            // Propagate independent groups of arcs concurrently, and arcs within a group sequentially
+            std::vector< std::vector< int > > arcGroups = getSequentialArcGroups( arcInitialStateFromPreviousArc );
+            utilities::parallelForEachBlock(
+                        static_cast< int >( arcGroups.size( ) ), static_cast< int >( numberOfThreads ),
+                        [ & ]( const int startGroup, const int endGroup, const int )
+            {
+                for( int i = startGroup; i < endGroup; i++ )
+                {
+                    for( unsigned int j = 0; j < arcGroups.at( i ).size( ); j++ )
+                    {
+                        int arcIndex = arcGroups.at( i ).at( j );
+                        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > arcInitialState =
+                                arcInitialStateList.at( arcIndex );
+                        if( arcInitialStateFromPreviousArc.at( arcIndex ) )
+                        {
+                            setArcInitialStateFromPreviousArc( arcIndex, arcInitialState );
+                            arcInitialStateList.at( arcIndex ) = arcInitialState;
+                        }
+
+                        singleArcDynamicsSimulators_.at( arcIndex )->template integrateEquationsOfMotion<
+                                typename MultiArcSimulationResults::single_arc_type >(
+                                    arcInitialStateList.at( arcIndex ), propagationResults->getSingleArcResults( ).at( arcIndex ) );
+                    }
+                }
+            } );
         }
 
         printPostPropagationMessages( );
@@ -11,6 +11,7 @@
 #ifndef TUDAT_ENVIRONMENTUPDATER_H
 #define TUDAT_ENVIRONMENTUPDATER_H
 
+#include <chrono>
 #include <vector>
 #include <string>
 #include <map>
@@ -23,6 +24,7 @@
 #include <boost/tuple/tuple_comparison.hpp>
 #include <boost/tuple/tuple_io.hpp>
 
+#include "tudat/basics/modelEvaluationProfiler.h"
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/astro/gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
@@ -34,6 +36,146 @@ namespace tudat
 namespace propagators
 {
 
+template< typename StateScalarType, typename TimeType >
+class EnvironmentUpdater;
+
+//! Class describing a single node in the graph of environment model updates
+/*!
+ *  Class describing a single node in the graph of environment model updates, i.e. the update of a single environment model
+ *  of a single body. The node stores the inputs on which the update depends: the current time, the current propagated
+ *  state, and/or the updates of other nodes. The EnvironmentUpdater uses this information to only recompute the node when
+ *  one of its inputs has changed since its last update. The node also keeps track of the number of (skipped) updates, and
+ *  (if requested) the clock time spent in its updates.
+ */
+class EnvironmentUpdateNode
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param updateType Type of environment model that is updated
+     *  \param bodyName Name of body for which the environment model is updated
+     *  \param updateFunction Function updating the environment model to the given time
+     *  \param resetFunctions Functions that force the environment model to be recomputed upon the next update
+     *  \param dependsOnTime Boolean denoting whether the update depends on the current time
+     *  \param dependsOnPropagatedState Boolean denoting whether the update depends on the current propagated state
+     *  \param dependencies Indices (in update graph) of the nodes on which this node depends
+     */
+    EnvironmentUpdateNode( const EnvironmentModelsToUpdate updateType,
+                           const std::string& bodyName,
+                           const std::function< void( const double ) > updateFunction,
+                           const std::vector< std::function< void( ) > >& resetFunctions,
+                           const bool dependsOnTime,
+                           const bool dependsOnPropagatedState,
+                           const std::vector< int >& dependencies ):
+        updateType_( updateType ), bodyName_( bodyName ), updateFunction_( updateFunction ),
+        resetFunctions_( resetFunctions ), dependsOnTime_( dependsOnTime ),
+        dependsOnPropagatedState_( dependsOnPropagatedState ), dependencies_( dependencies ),
+        numberOfUpdates_( 0 ), numberOfSkippedUpdates_( 0 ), totalUpdateTime_( 0.0 ){ }
+
+    //! Function to retrieve the type of environment model that is updated
+    EnvironmentModelsToUpdate getUpdateType( ) const
+    {
+        return updateType_;
+    }
+
+    //! Function to retrieve the name of body for which the environment model is updated
+    std::string getBodyName( ) const
+    {
+        return bodyName_;
+    }
+
+    //! Function to retrieve whether the update depends on the current time
+    bool getDependsOnTime( ) const
+    {
+        return dependsOnTime_;
+    }
+
+    //! Function to retrieve whether the update depends on the current propagated state
+    bool getDependsOnPropagatedState( ) const
+    {
+        return dependsOnPropagatedState_;
+    }
+
+    //! Function to retrieve the indices (in update graph) of the nodes on which this node depends
+    const std::vector< int >& getDependencies( ) const
+    {
+        return dependencies_;
+    }
+
+    //! Function to retrieve the number of times the environment model was updated
+    unsigned int getNumberOfUpdates( ) const
+    {
+        return numberOfUpdates_;
+    }
+
+    //! Function to retrieve the number of times the update was skipped, since none of its inputs changed
+    unsigned int getNumberOfSkippedUpdates( ) const
+    {
+        return numberOfSkippedUpdates_;
+    }
+
+    //! Function to retrieve the total clock time (in seconds) spent in updates (only measured if requested)
+    double getTotalUpdateTime( ) const
+    {
+        return totalUpdateTime_;
+    }
+
+    //! Function to reset the number of (skipped) updates and total update time to zero
+    void resetUpdateStatistics( )
+    {
+        numberOfUpdates_ = 0;
+        numberOfSkippedUpdates_ = 0;
+        totalUpdateTime_ = 0.0;
+    }
+
+protected:
+
+    //! Type of environment model that is updated
+    EnvironmentModelsToUpdate updateType_;
+
+    //! Name of body for which the environment model is updated
+    std::string bodyName_;
+
+    //! Function updating the environment model to the given time
+    std::function< void( const double ) > updateFunction_;
+
+    //! Functions that force the environment model to be recomputed upon the next update
+    std::vector< std::function< void( ) > > resetFunctions_;
+
+    //! Boolean denoting whether the update depends on the current time
+    bool dependsOnTime_;
+
+    //! Boolean denoting whether the update depends on the current propagated state
+    bool dependsOnPropagatedState_;
+
+    //! Indices (in update graph) of the nodes on which this node depends
+    std::vector< int > dependencies_;
+
+    //! Number of times the environment model was updated
+    unsigned int numberOfUpdates_;
+
+    //! Number of times the update was skipped
+    unsigned int numberOfSkippedUpdates_;
+
+    //! Total clock time (in seconds) spent in updates
+    double totalUpdateTime_;
+
+    template< typename StateScalarType, typename TimeType >
+    friend class EnvironmentUpdater;
+};
+
+//! Function to determine whether the orientation given by a rotation model depends on the (propagated) state of bodies
+/*!
+ *  Function to determine whether the orientation given by a rotation model depends on the (propagated) state of bodies
+ *  (e.g. aerodynamic angle-based, synchronous, thrust direction-based and custom rotation models), as opposed to only on
+ *  time.
+ *  \param rotationalEphemeris Rotation model that is to be checked
+ *  \return True if the orientation may depend on the state of bodies
+ */
+bool doesRotationModelDependOnState( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris );
+
 //! Class used to update the environment during numerical integration.
 /*!
  *  Class used to update the environment during numerical integration. The class ensures that the
@@ -67,7 +209,8 @@ public:
             std::vector< std::tuple< std::string, std::string, PropagatorType > > >& integratedStates =
             ( std::map< IntegratedStateType,
             std::vector< std::tuple< std::string, std::string, PropagatorType > > >( ) ) ):
-        bodyList_( bodyList ), integratedStates_( integratedStates )
+        bodyList_( bodyList ), integratedStates_( integratedStates ),
+        useIncrementalUpdates_( true ), measureUpdateCost_( false ), isEnvironmentUpToDate_( false )
     {
         // Set update function to be evaluated as dependent variables of state and time during each
         // integration time step.
@@ -105,9 +248,27 @@ public:
                                       std::to_string( integratedStates_.size( ) ) );
         }
 
-        for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
+        // Determine which nodes of the update graph need to be recomputed, and force recomputation of their models
+        bool hasTimeChanged = !isEnvironmentUpToDate_ || !( currentTime == lastUpdateTime_ );
+        for( unsigned int i = 0; i < updateGraph_.size( ); i++ )
         {
-            resetFunctionVector_.at( i ).template get< 2 >( )( );
+            bool updateNode = !useIncrementalUpdates_ || updateGraph_[ i ].dependsOnPropagatedState_ ||
+                    ( updateGraph_[ i ].dependsOnTime_ && hasTimeChanged );
+            for( unsigned int j = 0; ( j < updateGraph_[ i ].dependencies_.size( ) ) && !updateNode; j++ )
+            {
+                // Dependencies updated after this node are conservatively assumed to change
+                updateNode = ( updateGraph_[ i ].dependencies_[ j ] >= static_cast< int >( i ) ) ||
+                        isNodeUpdated_[ updateGraph_[ i ].dependencies_[ j ] ];
+            }
+            isNodeUpdated_[ i ] = updateNode;
+
+            if( updateNode )
+            {
+                for( unsigned int j = 0; j < updateGraph_[ i ].resetFunctions_.size( ); j++ )
+                {
+                    updateGraph_[ i ].resetFunctions_[ j ]( );
+                }
+            }
         }
 
         // Set integrated state variables in environment.
@@ -116,11 +277,119 @@ public:
         // Set current state from environment for override settings setIntegratedStatesFromEnvironment
         setStatesFromEnvironment( setIntegratedStatesFromEnvironment, currentTime );
 
-        // Evaluate time-dependent update functions (dependent variables of state and time)
-        // determined by setUpdateFunctions
-        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        // Evaluate time-dependent update functions (dependent variables of state and time) for which the input changed
+        for( unsigned int i = 0; i < updateGraph_.size( ); i++ )
+        {
+            if( isNodeUpdated_[ i ] )
+            {
+                if( measureUpdateCost_ || ( modelEvaluationProfiler_ != nullptr ) )
+                {
+                    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+                    updateGraph_[ i ].updateFunction_( currentTime );
+                    double updateTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                std::chrono::steady_clock::now( ) - startTime ).count( ) * 1.0E-9;
+                    updateGraph_[ i ].totalUpdateTime_ += updateTime;
+                    if( modelEvaluationProfiler_ != nullptr )
+                    {
+                        modelEvaluationProfiler_->addEvaluation( nodeProfileIndices_[ i ], updateTime );
+                    }
+                }
+                else
+                {
+                    updateGraph_[ i ].updateFunction_( currentTime );
+                }
+                updateGraph_[ i ].numberOfUpdates_++;
+            }
+            else
+            {
+                updateGraph_[ i ].numberOfSkippedUpdates_++;
+            }
+        }
+
+        lastUpdateTime_ = currentTime;
+        isEnvironmentUpToDate_ = true;
+    }
+
+    //! Function to force all environment models to be recomputed upon the next update
+    /*!
+     * Function to force all environment models to be recomputed upon the next update, regardless of whether their
+     * inputs changed. Called at the start of each propagation, and to be called whenever environment models are
+     * modified outside of this class.
+     */
+    void resetIncrementalUpdates( )
+    {
+        isEnvironmentUpToDate_ = false;
+    }
+
+    //! Function to set whether environment models are only recomputed when their inputs change (true by default)
+    void setUseIncrementalUpdates( const bool useIncrementalUpdates )
+    {
+        useIncrementalUpdates_ = useIncrementalUpdates;
+    }
+
+    //! Function to retrieve whether environment models are only recomputed when their inputs change
+    bool getUseIncrementalUpdates( )
+    {
+        return useIncrementalUpdates_;
+    }
+
+    //! Function to set whether the clock time spent in the update of each node is measured (false by default)
+    void setMeasureUpdateCost( const bool measureUpdateCost )
+    {
+        measureUpdateCost_ = measureUpdateCost;
+    }
+
+    //! Function to set the object recording the number of calls and clock time of the environment model updates
+    /*!
+     * Function to set the object recording the number of calls and clock time of the environment model updates
+     * (nullptr to disable profiling). Each node of the update graph is registered in the category "environment update".
+     * \param modelEvaluationProfiler Object recording the number of calls and clock time of evaluated models
+     */
+    void setModelEvaluationProfiler( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        registerProfiledUpdates( );
+    }
+
+    //! Function to retrieve the graph of environment model updates, in order of evaluation
+    const std::vector< EnvironmentUpdateNode >& getUpdateGraph( ) const
+    {
+        return updateGraph_;
+    }
+
+    //! Function to reset the number of (skipped) updates and total update time of all nodes to zero
+    void resetUpdateStatistics( )
+    {
+        for( unsigned int i = 0; i < updateGraph_.size( ); i++ )
+        {
+            updateGraph_[ i ].resetUpdateStatistics( );
+        }
+    }
+
+    //! Function to print the graph of environment model updates, with the number of (skipped) updates and cost per node
+    void printUpdateGraph( std::ostream& outputStream = std::cout ) const
+    {
+        for( unsigned int i = 0; i < updateGraph_.size( ); i++ )
         {
-            updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            const EnvironmentUpdateNode& node = updateGraph_[ i ];
+            outputStream << i << ": update type " << node.getUpdateType( ) << " of " << node.getBodyName( )
+                         << ( node.getDependsOnTime( ) ? ", depends on time" : "" )
+                         << ( node.getDependsOnPropagatedState( ) ? ", depends on propagated state" : "" );
+            if( node.getDependencies( ).size( ) > 0 )
+            {
+                outputStream << ", depends on nodes";
+                for( unsigned int j = 0; j < node.getDependencies( ).size( ); j++ )
+                {
+                    outputStream << " " << node.getDependencies( ).at( j );
+                }
+            }
+            outputStream << "; updates: " << node.getNumberOfUpdates( )
+                         << ", skipped: " << node.getNumberOfSkippedUpdates( );
+            if( measureUpdateCost_ )
+            {
+                outputStream << ", total update time: " << node.getTotalUpdateTime( ) << " s";
+            }
+            outputStream << std::endl;
         }
     }
     
@@ -771,6 +1040,136 @@ private:
         
         // Set update order of functions.
         setUpdateFunctionOrder( );
+
+        // Create graph of update functions
+        createUpdateGraph( );
+    }
+
+    //! Function to retrieve the index in updateFunctionVector_ of the given update, -1 if it is not updated
+    int getUpdateFunctionIndex( const EnvironmentModelsToUpdate updateType, const std::string& bodyName )
+    {
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            if( updateFunctionVector_.at( i ).template get< 0 >( ) == updateType &&
+                    updateFunctionVector_.at( i ).template get< 1 >( ) == bodyName )
+            {
+                return static_cast< int >( i );
+            }
+        }
+        return -1;
+    }
+
+    //! Function to add the index in updateFunctionVector_ of the given update to a list, if it is updated
+    void addUpdateDependency( std::vector< int >& dependencies,
+                              const EnvironmentModelsToUpdate updateType, const std::string& bodyName )
+    {
+        int updateIndex = getUpdateFunctionIndex( updateType, bodyName );
+        if( updateIndex >= 0 && std::find( dependencies.begin( ), dependencies.end( ), updateIndex ) == dependencies.end( ) )
+        {
+            dependencies.push_back( updateIndex );
+        }
+    }
+
+    //! Function to create the graph of environment model updates from the ordered list of update functions
+    /*!
+     * Function to create the graph of environment model updates from the ordered list of update functions (one node per
+     * update function, in the same order). Ephemeris-based translational states, and rotational states from rotation
+     * models that do not depend on the state of bodies, only depend on time. All other updates are conservatively
+     * assumed to depend on the propagated state. Dependencies between nodes are set for flight conditions (on states
+     * and orientations of the vehicle and its central body), aerodynamic angle-based rotation models (on the flight
+     * conditions, and the states and orientations these depend on) and radiation pressure interfaces (on states of the
+     * source and target).
+     */
+    void createUpdateGraph( )
+    {
+        updateGraph_.clear( );
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            EnvironmentModelsToUpdate updateType = updateFunctionVector_.at( i ).template get< 0 >( );
+            std::string bodyName = updateFunctionVector_.at( i ).template get< 1 >( );
+
+            // Retrieve functions that force recomputation of the model
+            std::vector< std::function< void( ) > > resetFunctions;
+            for( unsigned int j = 0; j < resetFunctionVector_.size( ); j++ )
+            {
+                if( resetFunctionVector_.at( j ).template get< 0 >( ) == updateType &&
+                        resetFunctionVector_.at( j ).template get< 1 >( ) == bodyName )
+                {
+                    resetFunctions.push_back( resetFunctionVector_.at( j ).template get< 2 >( ) );
+                }
+            }
+
+            // Determine inputs of update
+            bool dependsOnPropagatedState = true;
+            std::vector< int > dependencies;
+            switch( updateType )
+            {
+            case body_translational_state_update:
+                dependsOnPropagatedState = false;
+                break;
+            case body_rotational_state_update:
+            {
+                dependsOnPropagatedState = doesRotationModelDependOnState(
+                            bodyList_.at( bodyName )->getRotationalEphemeris( ) );
+                std::shared_ptr< ephemerides::AerodynamicAngleRotationalEphemeris > angleBasedRotationModel =
+                        std::dynamic_pointer_cast< ephemerides::AerodynamicAngleRotationalEphemeris >(
+                            bodyList_.at( bodyName )->getRotationalEphemeris( ) );
+                if( angleBasedRotationModel != nullptr )
+                {
+                    std::string centralBody = angleBasedRotationModel->getAerodynamicAngleCalculator( )->getCentralBodyName( );
+                    addUpdateDependency( dependencies, body_translational_state_update, centralBody );
+                    addUpdateDependency( dependencies, body_rotational_state_update, centralBody );
+                    addUpdateDependency( dependencies, body_translational_state_update, bodyName );
+                    addUpdateDependency( dependencies, vehicle_flight_conditions_update, bodyName );
+                }
+                break;
+            }
+            case vehicle_flight_conditions_update:
+            {
+                std::string centralBody = bodyList_.at( bodyName )->getFlightConditions( )->getCentralBody( );
+                addUpdateDependency( dependencies, body_translational_state_update, centralBody );
+                addUpdateDependency( dependencies, body_rotational_state_update, centralBody );
+                addUpdateDependency( dependencies, body_translational_state_update, bodyName );
+                break;
+            }
+            case radiation_pressure_interface_update:
+            {
+                addUpdateDependency( dependencies, body_translational_state_update, bodyName );
+                std::map< std::string, std::shared_ptr< electromagnetism::RadiationPressureInterface > >
+                        radiationPressureInterfaces = bodyList_.at( bodyName )->getRadiationPressureInterfaces( );
+                for( auto interfaceIterator : radiationPressureInterfaces )
+                {
+                    addUpdateDependency( dependencies, body_translational_state_update, interfaceIterator.first );
+                }
+                break;
+            }
+            default:
+                break;
+            }
+
+            updateGraph_.push_back(
+                        EnvironmentUpdateNode( updateType, bodyName, updateFunctionVector_.at( i ).template get< 2 >( ),
+                                               resetFunctions, true, dependsOnPropagatedState, dependencies ) );
+        }
+        isNodeUpdated_.assign( updateGraph_.size( ), true );
+        isEnvironmentUpToDate_ = false;
+        registerProfiledUpdates( );
+    }
+
+    //! Function to register all nodes of the update graph with the model evaluation profiler (if any).
+    void registerProfiledUpdates( )
+    {
+        nodeProfileIndices_.clear( );
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            for( unsigned int i = 0; i < updateGraph_.size( ); i++ )
+            {
+                nodeProfileIndices_.push_back(
+                            modelEvaluationProfiler_->registerModel(
+                                "environment update", getEnvironmentModelUpdateName( updateGraph_.at( i ).getUpdateType( ) ) +
+                                " of " + updateGraph_.at( i ).getBodyName( ) ) );
+            }
+        }
     }
     
     //! List of body objects, this list encompasses all environment object in the simulation.
@@ -795,6 +1194,30 @@ private:
     //! List of time-dependent functions to call to reset the time of the environment (to NaN signal recomputation for next
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( ) > > > resetFunctionVector_;
+
+    //! Graph of environment model updates, in order of evaluation (one node per entry of updateFunctionVector_)
+    std::vector< EnvironmentUpdateNode > updateGraph_;
+
+    //! List of booleans denoting whether each node of updateGraph_ was updated during the current/last update
+    std::vector< bool > isNodeUpdated_;
+
+    //! Boolean denoting whether environment models are only recomputed when their inputs change
+    bool useIncrementalUpdates_;
+
+    //! Boolean denoting whether the clock time spent in the update of each node is measured
+    bool measureUpdateCost_;
+
+    //! Object recording the number of calls and clock time of the environment model updates (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    //! Indices of the nodes of updateGraph_ in modelEvaluationProfiler_
+    std::vector< int > nodeProfileIndices_;
+
+    //! Boolean denoting whether the environment is up to date with lastUpdateTime_ (false if models must be recomputed)
+    bool isEnvironmentUpToDate_;
+
+    //! Time of last environment update
+    TimeType lastUpdateTime_ = TimeType( );
     
     
     
@@ -0,0 +1,606 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MONTECARLOPROPAGATION_H
+#define TUDAT_MONTECARLOPROPAGATION_H
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/utilities.h"
+#include "tudat/math/statistics/streamingStatistics.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to create single-arc propagator settings for a different (typically cloned) set of bodies
+/*!
+ *  Function to create single-arc propagator settings for a different (typically cloned, see cloneSystemOfBodies) set of
+ *  bodies, from existing settings. The settings are cloned, and the models that are linked to the bodies (e.g.
+ *  acceleration models) are recreated for the new bodies. Presently, only TranslationalStatePropagatorSettings created
+ *  from acceleration settings (see resetAccelerationModelsMap) are supported; for other types of propagation, the settings
+ *  must be created by a user-defined function (see MonteCarloPropagationSettings::setPropagatorSettingsFunction).
+ *  \param baseSettings Propagator settings that are to be recreated for the new bodies.
+ *  \param bodies Bodies for which the propagator settings are to be created
+ *  \return Propagator settings, with the same settings as baseSettings, but models linked to the new bodies.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > createPropagatorSettingsForBodies(
+        const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > baseSettings,
+        const simulation_setup::SystemOfBodies& bodies )
+{
+    std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType, TimeType > > translationalSettings =
+            std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType, TimeType > >( baseSettings );
+    if( translationalSettings == nullptr )
+    {
+        throw std::runtime_error( "Error when recreating propagator settings for new bodies, only translational propagator "
+                                  "settings are supported; provide a function to create the settings instead." );
+    }
+    else if( translationalSettings->getAccelerationSettingsMap( ).size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when recreating propagator settings for new bodies, no acceleration settings "
+                                  "found in translational propagator settings; provide a function to create the settings instead." );
+    }
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType, TimeType > > newSettings =
+            std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType, TimeType > >(
+                translationalSettings->clone( ) );
+    newSettings->resetAccelerationModelsMap( translationalSettings->getAccelerationSettingsMap( ), bodies );
+    return newSettings;
+}
+
+//! Summary of the results of a single sample of a Monte Carlo propagation
+template< typename StateScalarType = double, typename TimeType = double >
+struct MonteCarloSampleResult
+{
+    //! Index of the sample
+    unsigned int sampleIndex;
+
+    //! Random vector that defined the sample
+    Eigen::VectorXd sample;
+
+    //! Reason for termination of the propagation
+    PropagationTerminationReason terminationReason;
+
+    //! Time at which the propagation was terminated
+    TimeType finalTime;
+
+    //! Processed state at the time at which the propagation was terminated
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > finalState;
+
+    //! Processed states at the output epochs of the Monte Carlo propagation
+    std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > epochStates;
+
+    //! Boolean denoting, per output epoch, whether the propagation covers the epoch (if false, the epoch state is empty)
+    std::vector< bool > isEpochStateAvailable;
+};
+
+//! Class defining the settings for a Monte Carlo propagation
+/*!
+ *  Class defining the settings for a Monte Carlo propagation, in which a single-arc propagation is performed for a
+ *  large number of randomly perturbed settings. Each sample is defined by a random vector, drawn from the sample
+ *  function, which is applied to the bodies and propagator settings by the sample application function. The sample
+ *  application function must set *all* perturbed quantities (e.g. reset the initial state to the nominal state plus the
+ *  perturbation), since the bodies and propagator settings are reused for subsequent samples.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class MonteCarloPropagationSettings
+{
+public:
+
+    //! Typedef for function applying a single sample to the bodies and propagator settings.
+    typedef std::function< void( const Eigen::VectorXd&,
+                                 const simulation_setup::SystemOfBodies&,
+                                 const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > ) >
+    SampleApplicationFunction;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfSamples Number of samples that are to be propagated
+     *  \param sampleFunction Function returning the random vector for the next sample (e.g. created by
+     *  createGaussianRandomSampleFunction). It is called once per sample, in order of the sample index, and never
+     *  concurrently.
+     *  \param sampleApplicationFunction Function applying the random vector of a sample to the bodies and propagator
+     *  settings that are used for its propagation.
+     *  \param outputEpochs Epochs at which the statistics of the propagated state are to be computed. The states at these
+     *  epochs are obtained from the dense output of the integrator (see
+     *  SingleArcPropagatorProcessingSettings::setResultsOutputEpochs), which must therefore provide dense output.
+     *  \param quantileProbabilities Probabilities of the quantiles that are to be estimated for each entry of the
+     *  state at each output epoch, and for the final time and state.
+     *  \param numberOfThreads Number of threads over which the samples are distributed
+     */
+    MonteCarloPropagationSettings(
+            const unsigned int numberOfSamples,
+            const std::function< Eigen::VectorXd( ) > sampleFunction,
+            const SampleApplicationFunction sampleApplicationFunction,
+            const std::vector< TimeType >& outputEpochs = std::vector< TimeType >( ),
+            const std::vector< double >& quantileProbabilities = { 0.05, 0.5, 0.95 },
+            const unsigned int numberOfThreads = 1 ):
+        numberOfSamples_( numberOfSamples ),
+        sampleFunction_( sampleFunction ),
+        sampleApplicationFunction_( sampleApplicationFunction ),
+        outputEpochs_( outputEpochs ),
+        quantileProbabilities_( quantileProbabilities ),
+        numberOfThreads_( std::max( numberOfThreads, 1u ) ){ }
+
+    // Function to retrieve the number of samples that are to be propagated
+    unsigned int getNumberOfSamples( ) const
+    {
+        return numberOfSamples_;
+    }
+
+    // Function to retrieve the function returning the random vector for the next sample
+    std::function< Eigen::VectorXd( ) > getSampleFunction( ) const
+    {
+        return sampleFunction_;
+    }
+
+    // Function to retrieve the function applying the random vector of a sample to the bodies and propagator settings
+    SampleApplicationFunction getSampleApplicationFunction( ) const
+    {
+        return sampleApplicationFunction_;
+    }
+
+    // Function to retrieve the epochs at which the statistics of the propagated state are to be computed.
+    std::vector< TimeType > getOutputEpochs( ) const
+    {
+        return outputEpochs_;
+    }
+
+    // Function to retrieve the probabilities of the quantiles that are to be estimated
+    std::vector< double > getQuantileProbabilities( ) const
+    {
+        return quantileProbabilities_;
+    }
+
+    // Function to set the number of threads over which the samples are distributed
+    void setNumberOfThreads( const unsigned int numberOfThreads )
+    {
+        numberOfThreads_ = std::max( numberOfThreads, 1u );
+    }
+
+    // Function to retrieve the number of threads over which the samples are distributed
+    unsigned int getNumberOfThreads( ) const
+    {
+        return numberOfThreads_;
+    }
+
+    // Function to set the function that creates the propagator settings for a set of (cloned) bodies. If not set,
+    // the createPropagatorSettingsForBodies function is used.
+    void setPropagatorSettingsFunction(
+            const std::function< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > >(
+                const simulation_setup::SystemOfBodies& ) > propagatorSettingsFunction )
+    {
+        propagatorSettingsFunction_ = propagatorSettingsFunction;
+    }
+
+    // Function to retrieve the function that creates the propagator settings for a set of (cloned) bodies
+    std::function< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > >(
+            const simulation_setup::SystemOfBodies& ) > getPropagatorSettingsFunction( ) const
+    {
+        return propagatorSettingsFunction_;
+    }
+
+    // Function to set a function that is called with the summary of each sample, in order of the sample index (and
+    // never concurrently), as soon as the sample has been reduced into the statistics.
+    void setSampleResultFunction(
+            const std::function< void( const MonteCarloSampleResult< StateScalarType, TimeType >& ) > sampleResultFunction )
+    {
+        sampleResultFunction_ = sampleResultFunction;
+    }
+
+    // Function to retrieve the function that is called with the summary of each sample
+    std::function< void( const MonteCarloSampleResult< StateScalarType, TimeType >& ) > getSampleResultFunction( ) const
+    {
+        return sampleResultFunction_;
+    }
+
+protected:
+
+    // Number of samples that are to be propagated
+    unsigned int numberOfSamples_;
+
+    // Function returning the random vector for the next sample
+    std::function< Eigen::VectorXd( ) > sampleFunction_;
+
+    // Function applying the random vector of a sample to the bodies and propagator settings
+    SampleApplicationFunction sampleApplicationFunction_;
+
+    // Epochs at which the statistics of the propagated state are to be computed.
+    std::vector< TimeType > outputEpochs_;
+
+    // Probabilities of the quantiles that are to be estimated
+    std::vector< double > quantileProbabilities_;
+
+    // Number of threads over which the samples are distributed
+    unsigned int numberOfThreads_;
+
+    // Function that creates the propagator settings for a set of (cloned) bodies
+    std::function< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > >(
+            const simulation_setup::SystemOfBodies& ) > propagatorSettingsFunction_;
+
+    // Function that is called with the summary of each sample
+    std::function< void( const MonteCarloSampleResult< StateScalarType, TimeType >& ) > sampleResultFunction_;
+};
+
+//! Function to create a function that applies a sample as a perturbation of the initial state
+/*!
+ *  Function to create a function that applies a sample as a perturbation of the initial state, to be used as sample
+ *  application function of a Monte Carlo propagation. The first entries of the sample (equal in number to the size of the
+ *  nominal initial state) are added to the nominal initial state.
+ *  \param nominalInitialState Nominal initial state of the propagation
+ *  \return Function that applies a sample as a perturbation of the initial state
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+typename MonteCarloPropagationSettings< StateScalarType, TimeType >::SampleApplicationFunction
+createInitialStatePerturbationFunction( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& nominalInitialState )
+{
+    return [ = ]( const Eigen::VectorXd& sample,
+            const simulation_setup::SystemOfBodies&,
+            const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings )
+    {
+        if( sample.rows( ) < nominalInitialState.rows( ) )
+        {
+            throw std::runtime_error( "Error when applying initial state perturbation, sample is too small" );
+        }
+        propagatorSettings->resetInitialStates(
+                    nominalInitialState + sample.segment( 0, nominalInitialState.rows( ) ).template cast< StateScalarType >( ) );
+    };
+}
+
+//! Class holding the statistics of a Monte Carlo propagation
+/*!
+ *  Class holding the statistics of a Monte Carlo propagation, which are accumulated as the samples are processed, so
+ *  that its size is independent of the number of samples. The samples are reduced into the statistics in order of
+ *  their index, so that the results are independent of the number of threads used.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class MonteCarloPropagationResults
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param outputEpochs Epochs at which the statistics of the propagated state are computed.
+     *  \param stateSize Size of the processed state
+     *  \param quantileProbabilities Probabilities of the quantiles that are estimated
+     */
+    MonteCarloPropagationResults( const std::vector< TimeType >& outputEpochs,
+                                  const int stateSize,
+                                  const std::vector< double >& quantileProbabilities ):
+        outputEpochs_( outputEpochs ),
+        numberOfSamples_( 0 ),
+        finalTimeStatistics_( 1, quantileProbabilities ),
+        finalStateStatistics_( stateSize, quantileProbabilities ),
+        epochStateStatistics_( outputEpochs.size( ),
+                               statistics::StreamingVectorStatistics( stateSize, quantileProbabilities ) ){ }
+
+    //! Function to add the results of a single sample to the statistics
+    /*!
+     *  Function to add the results of a single sample to the statistics
+     *  \param sampleResult Summary of the results of a single sample
+     */
+    void addSampleResult( const MonteCarloSampleResult< StateScalarType, TimeType >& sampleResult )
+    {
+        numberOfSamples_++;
+        terminationReasonCounts_[ sampleResult.terminationReason ]++;
+
+        finalTimeStatistics_.addSample(
+                    Eigen::VectorXd::Constant( 1, static_cast< double >( sampleResult.finalTime ) ) );
+        finalStateStatistics_.addSample( sampleResult.finalState.template cast< double >( ) );
+        for( unsigned int i = 0; i < epochStateStatistics_.size( ); i++ )
+        {
+            if( sampleResult.isEpochStateAvailable.at( i ) )
+            {
+                epochStateStatistics_[ i ].addSample( sampleResult.epochStates.at( i ).template cast< double >( ) );
+            }
+        }
+    }
+
+    //! Function to retrieve the number of samples that have been processed
+    unsigned int getNumberOfSamples( ) const
+    {
+        return numberOfSamples_;
+    }
+
+    //! Function to retrieve the number of samples that terminated for each of the termination reasons
+    std::map< PropagationTerminationReason, unsigned int > getTerminationReasonCounts( ) const
+    {
+        return terminationReasonCounts_;
+    }
+
+    //! Function to retrieve the statistics of the time at which the propagations were terminated
+    const statistics::StreamingVectorStatistics& getFinalTimeStatistics( ) const
+    {
+        return finalTimeStatistics_;
+    }
+
+    //! Function to retrieve the statistics of the processed state at which the propagations were terminated
+    const statistics::StreamingVectorStatistics& getFinalStateStatistics( ) const
+    {
+        return finalStateStatistics_;
+    }
+
+    //! Function to retrieve the epochs at which the statistics of the propagated state are computed.
+    std::vector< TimeType > getOutputEpochs( ) const
+    {
+        return outputEpochs_;
+    }
+
+    //! Function to retrieve the statistics of the processed state at a given output epoch
+    /*!
+     *  Function to retrieve the statistics of the processed state at a given output epoch. Only the samples for which
+     *  the propagation covered the epoch are included.
+     *  \param epochIndex Index of the epoch in the list of output epochs
+     *  \return Statistics of the processed state at the requested output epoch
+     */
+    const statistics::StreamingVectorStatistics& getEpochStateStatistics( const unsigned int epochIndex ) const
+    {
+        return epochStateStatistics_.at( epochIndex );
+    }
+
+private:
+
+    //! Epochs at which the statistics of the propagated state are computed.
+    std::vector< TimeType > outputEpochs_;
+
+    //! Number of samples that have been processed
+    unsigned int numberOfSamples_;
+
+    //! Number of samples that terminated for each of the termination reasons
+    std::map< PropagationTerminationReason, unsigned int > terminationReasonCounts_;
+
+    //! Statistics of the time at which the propagations were terminated
+    statistics::StreamingVectorStatistics finalTimeStatistics_;
+
+    //! Statistics of the processed state at which the propagations were terminated
+    statistics::StreamingVectorStatistics finalStateStatistics_;
+
+    //! Statistics of the processed state at the output epochs
+    std::vector< statistics::StreamingVectorStatistics > epochStateStatistics_;
+};
+
+//! Function to create the summary of the results of a single sample of a Monte Carlo propagation
+/*!
+ *  Function to create the summary of the results of a single sample of a Monte Carlo propagation
+ *  \param sampleIndex Index of the sample
+ *  \param sample Random vector that defined the sample
+ *  \param propagationResults Results of the propagation of the sample
+ *  \param initialTime Initial time of the propagation of the sample
+ *  \param outputEpochs Epochs at which the propagated state is to be retrieved. The propagation must have been performed
+ *  with these epochs as results output epochs (see SingleArcPropagatorProcessingSettings::setResultsOutputEpochs), so
+ *  that the state history contains the dense output of the integrator at each epoch covered by the propagation.
+ *  \return Summary of the results of the sample
+ */
+template< typename StateScalarType, typename TimeType >
+MonteCarloSampleResult< StateScalarType, TimeType > createMonteCarloSampleResult(
+        const unsigned int sampleIndex,
+        const Eigen::VectorXd& sample,
+        const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > propagationResults,
+        const TimeType initialTime,
+        const std::vector< TimeType >& outputEpochs )
+{
+    const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& stateHistory =
+            propagationResults->getEquationsOfMotionNumericalSolutionColumnar( );
+    if( stateHistory.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error in Monte Carlo propagation, no state history found for sample " +
+                                  std::to_string( sampleIndex ) );
+    }
+
+    MonteCarloSampleResult< StateScalarType, TimeType > sampleResult;
+    sampleResult.sampleIndex = sampleIndex;
+    sampleResult.sample = sample;
+    sampleResult.terminationReason =
+            propagationResults->getPropagationTerminationReason( )->getPropagationTerminationReason( );
+
+    // Retrieve final state, for either forward or backward propagation
+    bool isPropagationForward = !( stateHistory.frontTime( ) < initialTime );
+    int finalIndex = isPropagationForward ? stateHistory.size( ) - 1 : 0;
+    sampleResult.finalTime = stateHistory.getTime( finalIndex );
+    sampleResult.finalState = stateHistory.getValue( finalIndex );
+
+    // Retrieve dense output states at output epochs (epochs are saved as double, see setResultsOutputEpochs)
+    const std::vector< TimeType >& times = stateHistory.getTimes( );
+    sampleResult.epochStates.resize( outputEpochs.size( ) );
+    sampleResult.isEpochStateAvailable.resize( outputEpochs.size( ) );
+    for( unsigned int i = 0; i < outputEpochs.size( ); i++ )
+    {
+        TimeType savedEpoch = static_cast< TimeType >( static_cast< double >( outputEpochs.at( i ) ) );
+        typename std::vector< TimeType >::const_iterator timeIterator =
+                std::lower_bound( times.begin( ), times.end( ), savedEpoch );
+        sampleResult.isEpochStateAvailable[ i ] = ( timeIterator != times.end( ) && *timeIterator == savedEpoch );
+        if( sampleResult.isEpochStateAvailable[ i ] )
+        {
+            sampleResult.epochStates[ i ] = stateHistory.getValue( static_cast< int >( timeIterator - times.begin( ) ) );
+        }
+    }
+    return sampleResult;
+}
+
+//! Function to perform a Monte Carlo propagation
+/*!
+ *  Function to perform a Monte Carlo propagation, propagating a single-arc dynamical model for a large number of
+ *  randomly perturbed settings, and reducing the results into statistics on the fly (see MonteCarloPropagationResults).
+ *  The samples are distributed over a number of worker threads. Each worker propagates on its own clone of the bodies
+ *  (see cloneSystemOfBodies), with its own propagator settings. The clones contain copies of all environment models
+ *  (including aerodynamic coefficients, engines and radiation pressure interfaces, so that these may be perturbed per
+ *  sample by the sample application function), and share only data that is not modified during propagation (e.g.
+ *  tabulated data and shape models). Bodies containing models that cannot be copied are rejected by cloneSystemOfBodies.
+ *  User-defined functions in the environment and propagator settings (e.g. custom ephemerides or thrust functions) are
+ *  shared between the workers, and must be safe to call concurrently.
+ *
+ *  Each worker fetches the next sample as soon as the previous one is finished, so that the load is balanced when
+ *  propagation times differ per sample. The states at the output epochs are obtained from the dense output of the
+ *  integrator, so that only the output epochs (and final state) of the samples that are being processed are kept in
+ *  memory. Samples are drawn, and reduced into the statistics, in order of their index, so that the results do not depend
+ *  on the number of threads. A sample that finishes before all samples with a lower index is kept until these are
+ *  reduced; to limit the memory use, a worker waits before drawing a new sample when the number of samples that have
+ *  been drawn but not reduced would exceed twice the number of workers. The memory use therefore scales with the number
+ *  of threads rather than the number of samples.
+ *  \param bodies Nominal bodies, which are cloned for each worker (and not modified)
+ *  \param propagatorSettings Nominal propagator settings, from which the settings for each worker are created (see
+ *  createPropagatorSettingsForBodies) if no dedicated function is defined in the Monte Carlo settings.
+ *  \param monteCarloSettings Settings for the Monte Carlo propagation
+ *  \return Statistics of the Monte Carlo propagation
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< MonteCarloPropagationResults< StateScalarType, TimeType > > performMonteCarloPropagation(
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
+        const std::shared_ptr< MonteCarloPropagationSettings< StateScalarType, TimeType > > monteCarloSettings )
+{
+    std::function< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > >(
+                const simulation_setup::SystemOfBodies& ) > propagatorSettingsFunction =
+            monteCarloSettings->getPropagatorSettingsFunction( );
+    if( propagatorSettingsFunction == nullptr )
+    {
+        propagatorSettingsFunction = [ = ]( const simulation_setup::SystemOfBodies& workerBodies )
+        {
+            return createPropagatorSettingsForBodies( propagatorSettings, workerBodies );
+        };
+    }
+
+    const unsigned int numberOfSamples = monteCarloSettings->getNumberOfSamples( );
+    const std::vector< TimeType > outputEpochs = monteCarloSettings->getOutputEpochs( );
+    const std::function< Eigen::VectorXd( ) > sampleFunction = monteCarloSettings->getSampleFunction( );
+    const typename MonteCarloPropagationSettings< StateScalarType, TimeType >::SampleApplicationFunction
+            sampleApplicationFunction = monteCarloSettings->getSampleApplicationFunction( );
+    const std::function< void( const MonteCarloSampleResult< StateScalarType, TimeType >& ) > sampleResultFunction =
+            monteCarloSettings->getSampleResultFunction( );
+
+    std::shared_ptr< MonteCarloPropagationResults< StateScalarType, TimeType > > monteCarloResults;
+
+    std::vector< double > resultsOutputEpochs;
+    for( unsigned int i = 0; i < outputEpochs.size( ); i++ )
+    {
+        resultsOutputEpochs.push_back( static_cast< double >( outputEpochs.at( i ) ) );
+    }
+
+    // Samples that have been propagated, but not yet reduced into the statistics (waiting for lower sample indices)
+    std::map< unsigned int, MonteCarloSampleResult< StateScalarType, TimeType > > pendingSampleResults;
+    unsigned int nextSampleToDraw = 0;
+    unsigned int nextSampleToReduce = 0;
+    bool isMonteCarloAborted = false;
+    std::mutex sampleMutex;
+    std::condition_variable sampleReducedCondition;
+
+    int numberOfWorkers = std::min( monteCarloSettings->getNumberOfThreads( ), std::max( numberOfSamples, 1u ) );
+    const unsigned int maximumNumberOfUnreducedSamples = 2 * static_cast< unsigned int >( numberOfWorkers );
+    utilities::parallelForEachBlock(
+                numberOfWorkers, numberOfWorkers, [ & ]( const int, const int, const int )
+    {
+        try
+        {
+            // Create environment and settings owned by this worker
+            simulation_setup::SystemOfBodies workerBodies = simulation_setup::cloneSystemOfBodies( bodies );
+            std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > workerPropagatorSettings =
+                    propagatorSettingsFunction( workerBodies );
+            if( outputEpochs.size( ) > 0 )
+            {
+                workerPropagatorSettings->getOutputSettings( )->setResultsOutputEpochs( resultsOutputEpochs );
+            }
+
+            while( true )
+            {
+                // Draw next sample, once the number of samples that have not yet been reduced is sufficiently small
+                unsigned int sampleIndex;
+                Eigen::VectorXd sample;
+                {
+                    std::unique_lock< std::mutex > sampleLock( sampleMutex );
+                    sampleReducedCondition.wait( sampleLock, [ & ]( )
+                    {
+                        return isMonteCarloAborted ||
+                                nextSampleToDraw < nextSampleToReduce + maximumNumberOfUnreducedSamples;
+                    } );
+                    if( isMonteCarloAborted || nextSampleToDraw >= numberOfSamples )
+                    {
+                        break;
+                    }
+                    sampleIndex = nextSampleToDraw;
+                    sample = sampleFunction( );
+                    nextSampleToDraw++;
+                }
+
+                // Propagate sample, and summarize results
+                sampleApplicationFunction( sample, workerBodies, workerPropagatorSettings );
+                MonteCarloSampleResult< StateScalarType, TimeType > sampleResult;
+                {
+                    SingleArcDynamicsSimulator< StateScalarType, TimeType > dynamicsSimulator(
+                                workerBodies, workerPropagatorSettings );
+                    sampleResult = createMonteCarloSampleResult(
+                                sampleIndex, sample, dynamicsSimulator.getSingleArcPropagationResults( ),
+                                workerPropagatorSettings->getInitialTime( ), outputEpochs );
+                }
+
+                // Reduce all samples that are ready, in order of sample index
+                std::lock_guard< std::mutex > sampleLock( sampleMutex );
+                if( monteCarloResults == nullptr )
+                {
+                    monteCarloResults = std::make_shared< MonteCarloPropagationResults< StateScalarType, TimeType > >(
+                                outputEpochs, sampleResult.finalState.rows( ),
+                                monteCarloSettings->getQuantileProbabilities( ) );
+                }
+                pendingSampleResults[ sampleIndex ] = std::move( sampleResult );
+
+                typename std::map< unsigned int, MonteCarloSampleResult< StateScalarType, TimeType > >::iterator
+                        pendingIterator = pendingSampleResults.begin( );
+                while( pendingIterator != pendingSampleResults.end( ) && pendingIterator->first == nextSampleToReduce )
+                {
+                    monteCarloResults->addSampleResult( pendingIterator->second );
+                    if( sampleResultFunction != nullptr )
+                    {
+                        sampleResultFunction( pendingIterator->second );
+                    }
+                    pendingIterator = pendingSampleResults.erase( pendingIterator );
+                    nextSampleToReduce++;
+                }
+                sampleReducedCondition.notify_all( );
+            }
+        }
+        catch( ... )
+        {
+            {
+                std::lock_guard< std::mutex > sampleLock( sampleMutex );
+                isMonteCarloAborted = true;
+            }
+            sampleReducedCondition.notify_all( );
+            throw;
+        }
+    } );
+
+    if( monteCarloResults == nullptr )
+    {
+        monteCarloResults = std::make_shared< MonteCarloPropagationResults< StateScalarType, TimeType > >(
+                    outputEpochs, 0, monteCarloSettings->getQuantileProbabilities( ) );
+    }
+    return monteCarloResults;
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_MONTECARLOPROPAGATION_H
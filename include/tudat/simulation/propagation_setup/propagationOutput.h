@@ -24,6 +24,8 @@
 #include "tudat/simulation/propagation_setup/propagationOutputSettings.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
 #include "tudat/simulation/environment_setup/createFlightConditions.h"
+#include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/math/basic/rotationRepresentations.h"
 
 namespace tudat
@@ -388,6 +390,69 @@ Eigen::VectorXd getConstellationMinimumVisibleDistance(
     const double limitAngle,
     const double time );
 
+//! Function to retrieve the acceleration model for which a single acceleration dependent variable is to be saved
+/*!
+ *  Function to retrieve the acceleration model for which a single acceleration (or acceleration norm) dependent variable
+ *  is to be saved. If no direct acceleration of the requested type is found for a gravitational acceleration, the third-body
+ *  counterpart is used. If the acceleration is the central acceleration that is removed from the dynamics (e.g. for an
+ *  Encke propagator), the state derivative model is set to update it.
+ *  \param accelerationDependentVariableSettings Settings for dependent variable
+ *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key).
+ *  \return Acceleration model for which the dependent variable is to be saved
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::shared_ptr< basic_astrodynamics::AccelerationModel3d > getAccelerationModelForDependentVariable(
+        const std::shared_ptr< SingleAccelerationDependentVariableSaveSettings > accelerationDependentVariableSettings,
+        const std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels )
+{
+    // Retrieve list of suitable acceleration models (size should be one to avoid ambiguities)
+    std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
+            listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
+                accelerationDependentVariableSettings->associatedBody_,
+                accelerationDependentVariableSettings->secondaryBody_,
+                stateDerivativeModels, accelerationDependentVariableSettings->accelerationModelType_ );
+
+    // Check if third-body counterpart of acceleration is found
+    if( listOfSuitableAccelerationModels.size( ) == 0 && basic_astrodynamics::isAccelerationDirectGravitational(
+                accelerationDependentVariableSettings->accelerationModelType_ ) )
+    {
+        listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
+                    accelerationDependentVariableSettings->associatedBody_,
+                    accelerationDependentVariableSettings->secondaryBody_,
+                    stateDerivativeModels, basic_astrodynamics::getAssociatedThirdBodyAcceleration(
+                        accelerationDependentVariableSettings->accelerationModelType_  ) );
+    }
+
+    if( listOfSuitableAccelerationModels.size( ) != 1 )
+    {
+        std::string errorMessage = "Error when getting acceleration between bodies " +
+                accelerationDependentVariableSettings->associatedBody_ + " and " +
+                accelerationDependentVariableSettings->secondaryBody_ + " of type " +
+                getAccelerationModelName(
+                    accelerationDependentVariableSettings->accelerationModelType_ ) +
+                ", no such acceleration found";
+        throw std::runtime_error( errorMessage );
+    }
+
+    // Set removed central acceleration to be updated, if it is the requested acceleration
+    std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
+            getTranslationalStateDerivativeModelForBody(
+                accelerationDependentVariableSettings->associatedBody_, stateDerivativeModels );
+    std::map< std::string, std::shared_ptr< gravitation::CentralGravitationalAccelerationModel3d > > removedAcceleration =
+            nBodyModel->getRemovedCentralAcceleration( );
+    if( removedAcceleration.count( accelerationDependentVariableSettings->associatedBody_ ) > 0 )
+    {
+        if( listOfSuitableAccelerationModels.at( 0 ) ==
+                removedAcceleration.at( accelerationDependentVariableSettings->associatedBody_ ) )
+        {
+            nBodyModel->setUpdateRemovedAcceleration( accelerationDependentVariableSettings->associatedBody_ );
+        }
+    }
+
+    return listOfSuitableAccelerationModels.at( 0 );
+}
+
 //! Function to create a function returning a requested dependent variable value (of type VectorXd).
 /*!
  *  Function to create a function returning a requested dependent variable value (of type VectorXd), retrieved from
@@ -504,53 +569,10 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         }
         else
         {
-            // Retrieve list of suitable acceleration models (size should be one to avoid ambiguities)
-            std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
-                    listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
-                        accelerationDependentVariableSettings->associatedBody_,
-                        accelerationDependentVariableSettings->secondaryBody_,
-                        stateDerivativeModels, accelerationDependentVariableSettings->accelerationModelType_ );
-
-            // Check if third-body counterpart of acceleration is found
-            if( listOfSuitableAccelerationModels.size( ) == 0 && basic_astrodynamics::isAccelerationDirectGravitational(
-                        accelerationDependentVariableSettings->accelerationModelType_ ) )
-            {
-                listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
-                            accelerationDependentVariableSettings->associatedBody_,
-                            accelerationDependentVariableSettings->secondaryBody_,
-                            stateDerivativeModels, basic_astrodynamics::getAssociatedThirdBodyAcceleration(
-                                accelerationDependentVariableSettings->accelerationModelType_  ) );
-            }
-
-            if( listOfSuitableAccelerationModels.size( ) != 1 )
-            {
-                std::string errorMessage = "Error when getting acceleration between bodies " +
-                        accelerationDependentVariableSettings->associatedBody_ + " and " +
-                        accelerationDependentVariableSettings->secondaryBody_ + " of type " +
-                        getAccelerationModelName(
-                            accelerationDependentVariableSettings->accelerationModelType_ ) +
-                        ", no such acceleration found";
-                throw std::runtime_error( errorMessage );
-            }
-            else
-            {
-                std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
-                        getTranslationalStateDerivativeModelForBody( bodyWithProperty, stateDerivativeModels );
-                std::map< std::string, std::shared_ptr< gravitation::CentralGravitationalAccelerationModel3d > > removedAcceleration =
-                        nBodyModel->getRemovedCentralAcceleration( );
-                if( removedAcceleration.count( accelerationDependentVariableSettings->associatedBody_ ) > 0 )
-                {
-                    if( listOfSuitableAccelerationModels.at( 0 ) ==
-                            removedAcceleration.at( accelerationDependentVariableSettings->associatedBody_ ) )
-                    {
-                        nBodyModel->setUpdateRemovedAcceleration( accelerationDependentVariableSettings->associatedBody_ );
-                    }
-                }
-
-                variableFunction = std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
-                                              listOfSuitableAccelerationModels.at( 0 ) );
-                parameterSize = 3;
-            }
+            variableFunction = std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
+                                          getAccelerationModelForDependentVariable(
+                                              accelerationDependentVariableSettings, stateDerivativeModels ) );
+            parameterSize = 3;
         }
         break;
     }
@@ -1779,54 +1801,11 @@ std::function< double( ) > getDoubleDependentVariableFunction(
             }
             else
             {
-                // Retrieve list of suitable acceleration models (size should be one to avoid ambiguities)
-                std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
-                        listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
-                            accelerationDependentVariableSettings->associatedBody_,
-                            accelerationDependentVariableSettings->secondaryBody_,
-                            stateDerivativeModels, accelerationDependentVariableSettings->accelerationModelType_ );
-
-                // Check if third-body counterpart of acceleration is found
-                if( listOfSuitableAccelerationModels.size( ) == 0 && basic_astrodynamics::isAccelerationDirectGravitational(
-                            accelerationDependentVariableSettings->accelerationModelType_ ) )
-                {
-                    listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
-                                accelerationDependentVariableSettings->associatedBody_,
-                                accelerationDependentVariableSettings->secondaryBody_,
-                                stateDerivativeModels, basic_astrodynamics::getAssociatedThirdBodyAcceleration(
-                                    accelerationDependentVariableSettings->accelerationModelType_  ) );
-                }
-
-                if( listOfSuitableAccelerationModels.size( ) != 1 )
-                {
-                    std::string errorMessage = "Error when getting acceleration between bodies " +
-                            accelerationDependentVariableSettings->associatedBody_ + " and " +
-                            accelerationDependentVariableSettings->secondaryBody_ + " of type " +
-                            std::to_string(
-                                accelerationDependentVariableSettings->accelerationModelType_ ) +
-                            ", no such acceleration found";
-                    throw std::runtime_error( errorMessage );
-                }
-                else
-                {
-                    std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
-                            getTranslationalStateDerivativeModelForBody( bodyWithProperty, stateDerivativeModels );
-                    std::map< std::string, std::shared_ptr< gravitation::CentralGravitationalAccelerationModel3d > > removedAcceleration =
-                            nBodyModel->getRemovedCentralAcceleration( );
-                    if( removedAcceleration.count( accelerationDependentVariableSettings->associatedBody_ ) > 0 )
-                    {
-                        if( listOfSuitableAccelerationModels.at( 0 ) ==
-                                removedAcceleration.at( accelerationDependentVariableSettings->associatedBody_ ) )
-                        {
-                            nBodyModel->setUpdateRemovedAcceleration( accelerationDependentVariableSettings->associatedBody_ );
-                        }
-                    }
-
-                    std::function< Eigen::Vector3d( ) > vectorFunction =
-                            std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
-                                       listOfSuitableAccelerationModels.at( 0 ) );
-                    variableFunction = std::bind( &linear_algebra::getVectorNormFromFunction, vectorFunction );
-                }
+                std::function< Eigen::Vector3d( ) > vectorFunction =
+                        std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
+                                   getAccelerationModelForDependentVariable(
+                                       accelerationDependentVariableSettings, stateDerivativeModels ) );
+                variableFunction = std::bind( &linear_algebra::getVectorNormFromFunction, vectorFunction );
             }
             break;
         }
@@ -2378,6 +2357,324 @@ Eigen::VectorXd evaluateListOfVectorFunctions(
         const std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList,
         const int totalSize );
 
+//! Class to evaluate a list of dependent variables into a single, preallocated, vector
+/*!
+ *  Class to evaluate a list of dependent variables into a single, preallocated, vector. Each dependent variable is
+ *  represented by a function that writes its value directly into its own segment of the output vector, so that no
+ *  temporary vectors are created for scalar and fixed-size dependent variables. Intermediate quantities that are used by
+ *  more than one dependent variable are computed at most once per evaluation, by resetting them (see
+ *  addIntermediateResetFunction) at the start of each evaluation.
+ */
+class DependentVariableListEvaluator
+{
+public:
+
+    //! Typedef for function writing a dependent variable into the output vector, at the given start index
+    typedef std::function< void( Eigen::VectorXd&, const int ) > DependentVariableWriteFunction;
+
+    //! Constructor
+    DependentVariableListEvaluator( ):
+        totalSize_( 0 ){ }
+
+    //! Function to add a dependent variable, written directly into the output vector
+    /*!
+     *  Function to add a dependent variable, written directly into the output vector
+     *  \param writeFunction Function writing the dependent variable into the output vector, at the given start index
+     *  \param variableSize Size of the dependent variable
+     */
+    void addWriteFunction( const DependentVariableWriteFunction& writeFunction, const int variableSize );
+
+    //! Function to add a scalar dependent variable
+    /*!
+     *  Function to add a scalar dependent variable
+     *  \param doubleFunction Function returning the dependent variable
+     */
+    void addScalarVariable( const std::function< double( ) >& doubleFunction );
+
+    //! Function to add a vector dependent variable of arbitrary size
+    /*!
+     *  Function to add a vector dependent variable of arbitrary size
+     *  \param vectorFunction Function returning the dependent variable
+     *  \param variableSize Size of the dependent variable
+     */
+    void addVectorVariable( const std::function< Eigen::VectorXd( ) >& vectorFunction, const int variableSize );
+
+    //! Function to add a function that resets an intermediate quantity at the start of each evaluation
+    void addIntermediateResetFunction( const std::function< void( ) >& resetFunction )
+    {
+        resetFunctions_.push_back( resetFunction );
+    }
+
+    //! Function to evaluate all dependent variables
+    /*!
+     *  Function to evaluate all dependent variables. NOTE: The environment and state derivative models need to be updated
+     *  to current state and independent variable before this function is called.
+     *  \return Concatenated dependent variables (reference to internal buffer, overwritten by next evaluation)
+     */
+    const Eigen::VectorXd& evaluate( );
+
+    //! Function to evaluate all dependent variables, and return a copy of the result
+    Eigen::VectorXd getDependentVariables( )
+    {
+        return evaluate( );
+    }
+
+    //! Function to retrieve the total size of all dependent variables
+    int getTotalSize( ) const
+    {
+        return totalSize_;
+    }
+
+private:
+
+    //! Functions writing the dependent variables into the output vector
+    std::vector< DependentVariableWriteFunction > writeFunctions_;
+
+    //! Start indices of the dependent variables in the output vector
+    std::vector< int > startIndices_;
+
+    //! Functions resetting the intermediate quantities at the start of each evaluation
+    std::vector< std::function< void( ) > > resetFunctions_;
+
+    //! Total size of all dependent variables
+    int totalSize_;
+
+    //! Output vector to which the dependent variables are written
+    Eigen::VectorXd outputBuffer_;
+};
+
+//! Class to compute an intermediate quantity that is used by several dependent variables at most once per evaluation
+template< typename IntermediateType >
+class DependentVariableIntermediate
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param computationFunction Function computing the intermediate quantity
+     */
+    DependentVariableIntermediate( const std::function< IntermediateType( ) >& computationFunction ):
+        computationFunction_( computationFunction ), isComputed_( false ){ }
+
+    //! Function to retrieve the intermediate quantity, computing it if it has not yet been computed since the last reset
+    const IntermediateType& getValue( )
+    {
+        if( !isComputed_ )
+        {
+            currentValue_ = computationFunction_( );
+            isComputed_ = true;
+        }
+        return currentValue_;
+    }
+
+    //! Function to reset the intermediate quantity, so that it is recomputed upon the next call to getValue
+    void reset( )
+    {
+        isComputed_ = false;
+    }
+
+private:
+
+    //! Function computing the intermediate quantity
+    std::function< IntermediateType( ) > computationFunction_;
+
+    //! Boolean denoting whether the intermediate quantity has been computed since the last reset
+    bool isComputed_;
+
+    //! Current value of the intermediate quantity
+    IntermediateType currentValue_;
+};
+
+//! Function to retrieve a 3-dimensional intermediate quantity shared by dependent variables, creating it if needed.
+/*!
+ *  Function to retrieve a 3-dimensional intermediate quantity shared by dependent variables, creating it (and adding its
+ *  reset function to the evaluator) if no intermediate with the given key exists yet.
+ *  \param evaluator Evaluator of the dependent variables that use the intermediate quantity
+ *  \param intermediates List of existing intermediates (key is identifier of quantity), modified by this function
+ *  \param intermediateKey Identifier of requested intermediate quantity
+ *  \param computationFunction Function computing the intermediate quantity (only used if it does not exist yet)
+ *  \return Requested intermediate quantity
+ */
+std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > getSharedDependentVariableIntermediate(
+        DependentVariableListEvaluator& evaluator,
+        std::map< std::string, std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > >& intermediates,
+        const std::string& intermediateKey,
+        const std::function< Eigen::Vector3d( ) >& computationFunction );
+
+//! Function to add a dependent variable to an evaluator as a function writing directly into its output vector
+/*!
+ *  Function to add a dependent variable to an evaluator as a function writing directly into its output vector, without
+ *  creating temporary vectors, and using intermediate quantities shared with other dependent variables where possible.
+ *  This is only done for the most commonly used dependent variables (total and single accelerations, and their norms,
+ *  relative and body-fixed positions and relative velocities), for all other dependent variables false is returned.
+ *  \param evaluator Evaluator to which the dependent variable is to be added
+ *  \param intermediates List of existing intermediates (key is identifier of quantity), modified by this function
+ *  \param dependentVariableSettings Settings for dependent variable
+ *  \param bodies List of bodies to use in simulations (containing full environment).
+ *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key).
+ *  \return True if the dependent variable is added to the evaluator, false if it is not supported by this function
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+bool addDirectDependentVariableWriteFunction(
+        DependentVariableListEvaluator& evaluator,
+        std::map< std::string, std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > >& intermediates,
+        const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels )
+{
+    const std::string& bodyWithProperty = dependentVariableSettings->associatedBody_;
+    const std::string& secondaryBody = dependentVariableSettings->secondaryBody_;
+
+    bool isVariableAdded = true;
+    switch( dependentVariableSettings->dependentVariableType_ )
+    {
+    case relative_position_dependent_variable:
+    case relative_velocity_dependent_variable:
+    {
+        // Relative state w.r.t. SSB is handled by generic function
+        if( secondaryBody == "SSB" )
+        {
+            isVariableAdded = false;
+        }
+        else
+        {
+            std::shared_ptr< simulation_setup::Body > body = bodies.at( bodyWithProperty );
+            std::shared_ptr< simulation_setup::Body > relativeBody = bodies.at( secondaryBody );
+            if( dependentVariableSettings->dependentVariableType_ == relative_position_dependent_variable )
+            {
+                evaluator.addWriteFunction(
+                            [ = ]( Eigen::VectorXd& output, const int startIndex )
+                {
+                    output.segment< 3 >( startIndex ) = body->getPosition( ) - relativeBody->getPosition( );
+                }, 3 );
+            }
+            else
+            {
+                evaluator.addWriteFunction(
+                            [ = ]( Eigen::VectorXd& output, const int startIndex )
+                {
+                    output.segment< 3 >( startIndex ) = body->getVelocity( ) - relativeBody->getVelocity( );
+                }, 3 );
+            }
+        }
+        break;
+    }
+    case total_acceleration_dependent_variable:
+    case total_acceleration_norm_dependent_variable:
+    {
+        // Retrieve total acceleration, shared between total acceleration and its norm
+        std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > totalAcceleration;
+        if( intermediates.count( "total_acceleration:" + bodyWithProperty ) == 0 )
+        {
+            std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
+                    getTranslationalStateDerivativeModelForBody( bodyWithProperty, stateDerivativeModels );
+            nBodyModel->setUpdateRemovedAcceleration( bodyWithProperty );
+            totalAcceleration = getSharedDependentVariableIntermediate(
+                        evaluator, intermediates, "total_acceleration:" + bodyWithProperty,
+                        std::bind( &NBodyStateDerivative< StateScalarType, TimeType >::getTotalAccelerationForBody,
+                                   nBodyModel, bodyWithProperty ) );
+        }
+        else
+        {
+            totalAcceleration = intermediates.at( "total_acceleration:" + bodyWithProperty );
+        }
+
+        if( dependentVariableSettings->dependentVariableType_ == total_acceleration_dependent_variable )
+        {
+            evaluator.addWriteFunction(
+                        [ = ]( Eigen::VectorXd& output, const int startIndex )
+            {
+                output.segment< 3 >( startIndex ) = totalAcceleration->getValue( );
+            }, 3 );
+        }
+        else
+        {
+            evaluator.addWriteFunction(
+                        [ = ]( Eigen::VectorXd& output, const int startIndex )
+            {
+                output( startIndex ) = totalAcceleration->getValue( ).norm( );
+            }, 1 );
+        }
+        break;
+    }
+    case single_acceleration_dependent_variable:
+    case single_acceleration_norm_dependent_variable:
+    {
+        std::shared_ptr< SingleAccelerationDependentVariableSaveSettings > accelerationDependentVariableSettings =
+                std::dynamic_pointer_cast< SingleAccelerationDependentVariableSaveSettings >( dependentVariableSettings );
+
+        // Inconsistent input is handled (and reported) by generic function
+        if( accelerationDependentVariableSettings == nullptr )
+        {
+            isVariableAdded = false;
+        }
+        else
+        {
+            std::shared_ptr< basic_astrodynamics::AccelerationModel3d > accelerationModel =
+                    getAccelerationModelForDependentVariable( accelerationDependentVariableSettings, stateDerivativeModels );
+            if( dependentVariableSettings->dependentVariableType_ == single_acceleration_dependent_variable )
+            {
+                evaluator.addWriteFunction(
+                            [ = ]( Eigen::VectorXd& output, const int startIndex )
+                {
+                    output.segment< 3 >( startIndex ) = accelerationModel->getAcceleration( );
+                }, 3 );
+            }
+            else
+            {
+                evaluator.addWriteFunction(
+                            [ = ]( Eigen::VectorXd& output, const int startIndex )
+                {
+                    output( startIndex ) = accelerationModel->getAcceleration( ).norm( );
+                }, 1 );
+            }
+        }
+        break;
+    }
+    case body_fixed_relative_cartesian_position:
+    case body_fixed_relative_spherical_position:
+    {
+        // Retrieve body-fixed position, shared between Cartesian and spherical representation
+        std::shared_ptr< simulation_setup::Body > body = bodies.at( bodyWithProperty );
+        std::shared_ptr< simulation_setup::Body > centralBody = bodies.at( secondaryBody );
+        std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > bodyFixedPosition =
+                getSharedDependentVariableIntermediate(
+                    evaluator, intermediates, "body_fixed_position:" + bodyWithProperty + ":" + secondaryBody,
+                    [ = ]( )
+        {
+            return Eigen::Vector3d( centralBody->getCurrentRotationToLocalFrame( ) *
+                                    ( body->getPosition( ) - centralBody->getPosition( ) ) );
+        } );
+
+        if( dependentVariableSettings->dependentVariableType_ == body_fixed_relative_cartesian_position )
+        {
+            evaluator.addWriteFunction(
+                        [ = ]( Eigen::VectorXd& output, const int startIndex )
+            {
+                output.segment< 3 >( startIndex ) = bodyFixedPosition->getValue( );
+            }, 3 );
+        }
+        else
+        {
+            evaluator.addWriteFunction(
+                        [ = ]( Eigen::VectorXd& output, const int startIndex )
+            {
+                output.segment< 3 >( startIndex ) =
+                        coordinate_conversions::convertCartesianToSpherical( bodyFixedPosition->getValue( ) );
+                output( startIndex + 1 ) = mathematical_constants::PI / 2.0 - output( startIndex + 1 );
+            }, 3 );
+        }
+        break;
+    }
+    default:
+        isVariableAdded = false;
+        break;
+    }
+    return isVariableAdded;
+}
+
 //! Function to create a function that evaluates a list of dependent variables and concatenates the results.
 /*!
  *  Function to create a function that evaluates a list of dependent variables and concatenates the results.
@@ -2401,51 +2698,52 @@ std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >,
         const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
         std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
 {
-    // create list of vector parameters
-    std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList;
-    std::vector< std::pair< std::string, int > > vectorVariableList;
+    // Create evaluator writing all dependent variables into a single vector
+    std::shared_ptr< DependentVariableListEvaluator > evaluator = std::make_shared< DependentVariableListEvaluator >( );
+    std::map< std::string, std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > > intermediates;
+    std::map< std::pair< int, int >, std::string > dependentVariableIds;
 
     for( std::shared_ptr< SingleDependentVariableSaveSettings > variable: dependentVariables )
     {
-        std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction;
-        // Create double parameter
-        if( isScalarDependentVariable( variable ) )
+        int startIndex = evaluator->getTotalSize( );
+
+        // Add variable without creating temporary vectors, if possible; use generic function otherwise
+        if( !addDirectDependentVariableWriteFunction(
+                    *evaluator, intermediates, variable, bodies, stateDerivativeModels ) )
         {
+            // Create double parameter
+            if( isScalarDependentVariable( variable ) )
+            {
 #if(TUDAT_BUILD_WITH_ESTIMATION_TOOLS )
-            std::function< double( ) > doubleFunction =
-                    getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels, stateDerivativePartials );
+                evaluator->addScalarVariable(
+                            getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels, stateDerivativePartials ) );
 #else
-            std::function< double( ) > doubleFunction =
-                    getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels );
+                evaluator->addScalarVariable(
+                            getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels ) );
 #endif
-            vectorFunction = std::make_pair( std::bind( &getVectorFromDoubleFunction, doubleFunction ), 1 );
-        }
-        // Create vector parameter
-        else
-        {
+            }
+            // Create vector parameter
+            else
+            {
+                std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction;
 #if(TUDAT_BUILD_WITH_ESTIMATION_TOOLS )
-            vectorFunction = getVectorDependentVariableFunction(
-                        variable, bodies, stateDerivativeModels, stateDerivativePartials );
+                vectorFunction = getVectorDependentVariableFunction(
+                            variable, bodies, stateDerivativeModels, stateDerivativePartials );
 #else
-            vectorFunction =
-                    getVectorDependentVariableFunction( variable, bodies, stateDerivativeModels );
+                vectorFunction =
+                        getVectorDependentVariableFunction( variable, bodies, stateDerivativeModels );
 #endif
+                evaluator->addVectorVariable( vectorFunction.first, vectorFunction.second );
+            }
         }
-        vectorFunctionList.push_back( vectorFunction );
-        vectorVariableList.push_back( std::make_pair( getDependentVariableId( variable ), vectorFunction.second ) );
-    }
 
-    // Set list of variable ids/indices in correc otder.
-    int totalVariableSize = 0;
-    std::map< std::pair< int, int >, std::string > dependentVariableIds;
-    for( std::pair< std::string, int > vectorVariable: vectorVariableList )
-    {
-        dependentVariableIds[ { totalVariableSize, vectorVariable.second } ] = vectorVariable.first;
-        totalVariableSize += vectorVariable.second;
+        // Set variable id/indices
+        dependentVariableIds[ { startIndex, evaluator->getTotalSize( ) - startIndex } ] =
+                getDependentVariableId( variable );
     }
 
-    // Create function conatenating function results.
-    return std::make_pair( std::bind( &evaluateListOfVectorFunctions, vectorFunctionList, totalVariableSize ),
+    // Create function evaluating all dependent variables.
+    return std::make_pair( std::bind( &DependentVariableListEvaluator::getDependentVariables, evaluator ),
                            dependentVariableIds );
 }
 
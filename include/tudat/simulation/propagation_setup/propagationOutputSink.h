@@ -0,0 +1,243 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONOUTPUTSINK_H
+#define TUDAT_PROPAGATIONOUTPUTSINK_H
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Base class for objects to which the results of a single-arc propagation are written while it is running
+/*!
+ *  Base class for objects to which the results of a single-arc propagation are written while it is running. Each saved
+ *  state (in propagation coordinates, i.e. the raw numerical solution) and dependent variable vector is passed to the
+ *  sink as soon as it is final, in order of propagation (so in order of decreasing time for backward propagation). The
+ *  last saved entry is only passed to the sink at the end of the propagation, since it may be replaced when propagating
+ *  to an exact termination condition. Times and values are converted to double precision. A sink is set by
+ *  SingleArcPropagatorProcessingSettings::setOutputSink, and must not be shared by propagations running concurrently.
+ */
+class PropagationOutputSink
+{
+public:
+
+    //! Constructor
+    PropagationOutputSink( ){ }
+
+    //! Destructor
+    virtual ~PropagationOutputSink( ){ }
+
+    //! Function called at the start of each propagation, before any entry is added.
+    virtual void startPropagation( ){ }
+
+    //! Function to add a single state entry
+    /*!
+     *  Function to add a single state entry
+     *  \param time Time of the entry
+     *  \param state State at the given time (in propagation coordinates)
+     */
+    virtual void addStateEntry( const double time, const Eigen::Ref< const Eigen::MatrixXd >& state ) = 0;
+
+    //! Function to add a single dependent variable entry
+    /*!
+     *  Function to add a single dependent variable entry
+     *  \param time Time of the entry
+     *  \param dependentVariables Dependent variables at the given time
+     */
+    virtual void addDependentVariableEntry( const double time,
+                                            const Eigen::Ref< const Eigen::VectorXd >& dependentVariables ) = 0;
+
+    //! Function called at the end of each propagation, after the last entry is added.
+    virtual void finalizePropagation( ){ }
+};
+
+//! Class to write the results of a propagation to a binary file, as they are produced.
+/*!
+ *  Class to write the results of a propagation to a binary file, as they are produced. Entries are collected in an
+ *  in-memory buffer, which is written to the file (and flushed, so that other processes can read it during the
+ *  propagation) when it is full, and at the end of the propagation. The file is overwritten at the start of each
+ *  propagation. It starts with the 8-byte identifier "TUDATPO1", followed by one record per entry, containing: the entry
+ *  type (int32; 0 for state, 1 for dependent variables), the time (double), the number of rows and columns of the
+ *  value (int32 each), and the values in column-major order (double). All data is written in native byte order. The
+ *  file can be read with readBinaryPropagationOutputFile.
+ */
+class BinaryFilePropagationOutputSink: public PropagationOutputSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param fileName Name of the file to which the results are to be written.
+     *  \param bufferSize Size (in bytes) of the buffer in which entries are collected before writing them to file.
+     */
+    BinaryFilePropagationOutputSink( const std::string& fileName,
+                                     const unsigned int bufferSize = 1048576 ):
+        fileName_( fileName ), bufferSize_( bufferSize )
+    {
+        buffer_.reserve( bufferSize_ );
+    }
+
+    //! Destructor, writes any remaining buffered entries (a write error is reported, but not thrown)
+    ~BinaryFilePropagationOutputSink( );
+
+    //! Function to (re)open the output file, discarding its current contents
+    void startPropagation( );
+
+    //! Function to add a single state entry
+    void addStateEntry( const double time, const Eigen::Ref< const Eigen::MatrixXd >& state );
+
+    //! Function to add a single dependent variable entry
+    void addDependentVariableEntry( const double time, const Eigen::Ref< const Eigen::VectorXd >& dependentVariables );
+
+    //! Function to write all buffered entries to the file, and close it
+    void finalizePropagation( );
+
+    //! Function to write all buffered entries to the file (throws an exception if writing fails)
+    void flush( );
+
+    //! Function to retrieve the name of the file to which the results are written
+    std::string getFileName( ) const
+    {
+        return fileName_;
+    }
+
+private:
+
+    //! Function to add a single entry to the buffer, writing the buffer to file if it is full
+    void addEntry( const int32_t entryType, const double time, const Eigen::Ref< const Eigen::MatrixXd >& value );
+
+    //! Name of the file to which the results are written
+    std::string fileName_;
+
+    //! Size (in bytes) of the buffer in which entries are collected before writing them to file
+    unsigned int bufferSize_;
+
+    //! Buffer in which entries are collected before writing them to file
+    std::vector< char > buffer_;
+
+    //! Stream of the file to which the results are written
+    std::ofstream outputStream_;
+};
+
+//! Function to read a file written by a BinaryFilePropagationOutputSink
+/*!
+ *  Function to read a file written by a BinaryFilePropagationOutputSink. The file may be read while the propagation is
+ *  still running, in which case an incomplete last record is ignored.
+ *  \param fileName Name of the file that is to be read
+ *  \param stateHistory State history read from the file (returned by reference)
+ *  \param dependentVariableHistory Dependent variable history read from the file (returned by reference)
+ */
+void readBinaryPropagationOutputFile(
+        const std::string& fileName,
+        std::map< double, Eigen::MatrixXd >& stateHistory,
+        std::map< double, Eigen::VectorXd >& dependentVariableHistory );
+
+//! Class to store the most recent results of a propagation in memory, in a fixed-size ring buffer.
+/*!
+ *  Class to store the most recent results of a propagation in memory, in a fixed-size ring buffer, so that the memory
+ *  use is independent of the length of the propagation. Once the buffer is full, each new entry overwrites the oldest
+ *  one. The contents may be retrieved from another thread while the propagation is running. The buffer is emptied at the
+ *  start of each propagation.
+ */
+class RingBufferPropagationOutputSink: public PropagationOutputSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param capacity Maximum number of state (and, separately, dependent variable) entries that are stored.
+     */
+    RingBufferPropagationOutputSink( const int capacity );
+
+    //! Function to empty the buffer
+    void startPropagation( );
+
+    //! Function to add a single state entry
+    void addStateEntry( const double time, const Eigen::Ref< const Eigen::MatrixXd >& state );
+
+    //! Function to add a single dependent variable entry
+    void addDependentVariableEntry( const double time, const Eigen::Ref< const Eigen::VectorXd >& dependentVariables );
+
+    //! Function to retrieve the stored (most recent) state entries
+    std::map< double, Eigen::MatrixXd > getStateHistory( );
+
+    //! Function to retrieve the stored (most recent) dependent variable entries
+    std::map< double, Eigen::VectorXd > getDependentVariableHistory( );
+
+    //! Function to retrieve the total number of state entries added since the start of the propagation
+    unsigned int getNumberOfAddedStateEntries( );
+
+    //! Function to retrieve the total number of dependent variable entries added since the start of the propagation
+    unsigned int getNumberOfAddedDependentVariableEntries( );
+
+    //! Function to retrieve the maximum number of stored entries
+    int getCapacity( ) const
+    {
+        return capacity_;
+    }
+
+private:
+
+    //! Ring buffer of entries of a single type
+    struct EntryRingBuffer
+    {
+        //! Times of the entries
+        std::vector< double > times;
+
+        //! Values of the entries (one flattened entry per column)
+        Eigen::MatrixXd values;
+
+        //! Number of rows of each entry
+        int entryRows = 0;
+
+        //! Number of columns of each entry
+        int entryColumns = 0;
+
+        //! Total number of entries added since the start of the propagation
+        unsigned int numberOfAddedEntries = 0;
+    };
+
+    //! Function to add an entry to a ring buffer
+    void addEntry( EntryRingBuffer& ringBuffer, const double time, const Eigen::Ref< const Eigen::MatrixXd >& value );
+
+    //! Function to retrieve the entries stored in a ring buffer
+    std::map< double, Eigen::MatrixXd > getEntries( const EntryRingBuffer& ringBuffer );
+
+    //! Maximum number of stored entries
+    int capacity_;
+
+    //! Ring buffer of state entries
+    EntryRingBuffer stateBuffer_;
+
+    //! Ring buffer of dependent variable entries
+    EntryRingBuffer dependentVariableBuffer_;
+
+    //! Mutex used to allow retrieving the entries while the propagation is running
+    std::mutex bufferMutex_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONOUTPUTSINK_H
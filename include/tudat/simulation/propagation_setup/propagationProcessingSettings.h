@@ -11,6 +11,7 @@
 #ifndef TUDAT_PROPAGATIONPROCESSINGSETTINGS_H
 #define TUDAT_PROPAGATIONPROCESSINGSETTINGS_H
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
@@ -19,6 +20,8 @@
 
 #include <Eigen/Core>
 
+#include "tudat/astro/propagators/singleStateTypeDerivative.h"
+#include "tudat/simulation/propagation_setup/propagationOutputSink.h"
 #include "tudat/simulation/propagation_setup/propagationPrintSettings.h"
 
 namespace tudat
@@ -108,6 +111,9 @@ public:
             resultsSaveFrequencyInSteps_( resultsSaveFrequencyInSteps ),
             resultsSaveFrequencyInSeconds_( resultsSaveFrequencyInSeconds ),
             printSettings_( printSettings ),
+            retainResultsInMemory_( true ),
+            stateDerivativeDiagnosticsLevel_( state_derivative_evaluation_counters ),
+            profileModelEvaluations_( false ),
         isPartOfMultiArc_( false ), arcIndex_( -1 ){ }
     virtual ~SingleArcPropagatorProcessingSettings( ){ }
 
@@ -151,6 +157,65 @@ public:
         return saveCurrentStep;
     }
 
+    // Set epochs at which results are to be saved, obtained from dense output of integrator (overrides save frequency)
+    void setResultsOutputEpochs( const std::vector< double >& resultsOutputEpochs )
+    {
+        resultsOutputEpochs_ = resultsOutputEpochs;
+    }
+
+    std::vector< double > getResultsOutputEpochs( )
+    {
+        return resultsOutputEpochs_;
+    }
+
+    // Set object to which saved states and dependent variables are written during the propagation (nullptr for none)
+    void setOutputSink( const std::shared_ptr< PropagationOutputSink > outputSink )
+    {
+        outputSink_ = outputSink;
+    }
+
+    std::shared_ptr< PropagationOutputSink > getOutputSink( )
+    {
+        return outputSink_;
+    }
+
+    // Set whether results written to the output sink are also retained in the propagation results. If false, only the
+    // final entry is retained, so that the memory use is independent of the propagation length.
+    void setRetainResultsInMemory( const bool retainResultsInMemory )
+    {
+        retainResultsInMemory_ = retainResultsInMemory;
+    }
+
+    bool getRetainResultsInMemory( )
+    {
+        return retainResultsInMemory_;
+    }
+
+    // Set level of diagnostics recorded for each state derivative evaluation. By default, only the number of evaluations
+    // is counted; full diagnostics store the number of evaluations per evaluation time, and check the state for NaN/Inf.
+    void setStateDerivativeDiagnosticsLevel( const StateDerivativeDiagnosticsLevel stateDerivativeDiagnosticsLevel )
+    {
+        stateDerivativeDiagnosticsLevel_ = stateDerivativeDiagnosticsLevel;
+    }
+
+    StateDerivativeDiagnosticsLevel getStateDerivativeDiagnosticsLevel( )
+    {
+        return stateDerivativeDiagnosticsLevel_;
+    }
+
+    // Set whether the number of calls and clock time of each acceleration model, environment update and variational
+    // equations update are recorded during propagation (false by default). If true, the profile is available from the
+    // propagation results. If false, the models are evaluated without any timing overhead.
+    void setProfileModelEvaluations( const bool profileModelEvaluations )
+    {
+        profileModelEvaluations_ = profileModelEvaluations;
+    }
+
+    bool getProfileModelEvaluations( )
+    {
+        return profileModelEvaluations_;
+    }
+
 
 
     bool printAnyOutput( )
@@ -190,8 +255,18 @@ private:
 
     double resultsSaveFrequencyInSeconds_;
 
+    std::vector< double > resultsOutputEpochs_;
+
     const std::shared_ptr< PropagationPrintSettings > printSettings_;
 
+    std::shared_ptr< PropagationOutputSink > outputSink_;
+
+    bool retainResultsInMemory_;
+
+    StateDerivativeDiagnosticsLevel stateDerivativeDiagnosticsLevel_;
+
+    bool profileModelEvaluations_;
+
     void setAsMultiArc( const unsigned int arcIndex, const bool printArcIndex )
     {
         isPartOfMultiArc_ = true;
@@ -224,7 +299,8 @@ public:
         printFirstArcOnly_( printFirstArcOnly ),
         printCurrentArcIndex_( printCurrentArcIndex ),
         areSingleArcSettingsSet_( false ),
-        isPartOfHybridArc_( false )
+        isPartOfHybridArc_( false ),
+        numberOfArcPropagationThreads_( 1 )
     {
     }
 
@@ -240,7 +316,8 @@ public:
         printFirstArcOnly_( printFirstArcOnly ),
         printCurrentArcIndex_( printCurrentArcIndex ),
         areSingleArcSettingsSet_( false ),
-        isPartOfHybridArc_( false )
+        isPartOfHybridArc_( false ),
+        numberOfArcPropagationThreads_( 1 )
     {
     }
 
@@ -369,6 +446,19 @@ public:
         return singleArcSettings_;
     }
 
+    // Set maximum number of threads over which the arcs are propagated. Arcs that share (parts of) their environment or
+    // dynamical models, or that take their initial state from the previous arc, are always propagated sequentially
+    // in the same thread, so that the results are identical to those of a single-threaded propagation.
+    void setNumberOfArcPropagationThreads( const unsigned int numberOfArcPropagationThreads )
+    {
+        numberOfArcPropagationThreads_ = std::max( numberOfArcPropagationThreads, 1u );
+    }
+
+    unsigned int getNumberOfArcPropagationThreads( )
+    {
+        return numberOfArcPropagationThreads_;
+    }
+
 
 protected:
 
@@ -386,6 +476,8 @@ protected:
 
     bool isPartOfHybridArc_;
 
+    unsigned int numberOfArcPropagationThreads_;
+
 private:
 
 
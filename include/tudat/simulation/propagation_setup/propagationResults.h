@@ -8,6 +8,8 @@
 #include <map>
 #include <string>
 
+#include "tudat/basics/columnarTimeHistory.h"
+#include "tudat/basics/modelEvaluationProfiler.h"
 #include "tudat/simulation/propagation_setup/propagationProcessingSettings.h"
 #include "tudat/simulation/propagation_setup/propagationTermination.h"
 #include "tudat/simulation/propagation_setup/dependentVariablesInterface.h"
@@ -74,8 +76,8 @@ namespace tudat
             SingleArcSimulationResults(const std::map <std::pair<int, int>, std::string> &dependentVariableIds,
                                        const std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > > integratedStateAndBodyList,
                                        const std::shared_ptr <SingleArcPropagatorProcessingSettings> &outputSettings,
-                                       const std::function< void ( std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-                                                                   const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& ) > rawSolutionConversionFunction,
+                                       const std::function< void ( utilities::ColumnarTimeHistory< TimeType, StateScalarType >&,
+                                                                   const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& ) > rawSolutionConversionFunction,
                                        const std::shared_ptr< SingleArcDependentVariablesInterface< TimeType > > dependentVariableInterface = nullptr ) :
                     SimulationResults<StateScalarType, TimeType>(),
                     dependentVariableIds_(dependentVariableIds),
@@ -109,6 +111,27 @@ namespace tudat
                 solutionIsCleared_ = false;
                 onlyProcessedSolutionSet_ = false;
                 propagationTerminationReason_ = std::make_shared<PropagationTerminationDetails>(propagation_never_run);
+                modelEvaluationProfiler_ = nullptr;
+            }
+
+            //! Function that sets new numerical results of a propagation, after the propagation of the dynamics (histories
+            //! must be sorted by time)
+            void reset(
+                    utilities::ColumnarTimeHistory< TimeType, StateScalarType >&& equationsOfMotionNumericalSolutionRaw,
+                    utilities::ColumnarTimeHistory< TimeType, double >&& dependentVariableHistory,
+                    utilities::ColumnarTimeHistory< TimeType, double >&& cumulativeComputationTimeHistory,
+                    const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
+                    std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
+            {
+                reset( );
+                utilities::ColumnarTimeHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolution;
+                rawSolutionConversionFunction_( equationsOfMotionNumericalSolution, equationsOfMotionNumericalSolutionRaw );
+                equationsOfMotionNumericalSolution_.setHistory( std::move( equationsOfMotionNumericalSolution ) );
+                equationsOfMotionNumericalSolutionRaw_.setHistory( std::move( equationsOfMotionNumericalSolutionRaw ) );
+                dependentVariableHistory_.setHistory( std::move( dependentVariableHistory ) );
+                cumulativeComputationTimeHistory_.setHistory( std::move( cumulativeComputationTimeHistory ) );
+                cumulativeNumberOfFunctionEvaluations_.setHistory( cumulativeNumberOfFunctionEvaluations );
+                propagationTerminationReason_ = propagationTerminationReason;
             }
 
             //! Function that sets new numerical results of a propagation, after the propagation of the dynamics
@@ -119,13 +142,10 @@ namespace tudat
                     const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
                     std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
             {
-                reset( );
-                equationsOfMotionNumericalSolutionRaw_ = equationsOfMotionNumericalSolutionRaw;
-                rawSolutionConversionFunction_( equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
-                dependentVariableHistory_ = dependentVariableHistory;
-                cumulativeComputationTimeHistory_ = cumulativeComputationTimeHistory;
-                cumulativeNumberOfFunctionEvaluations_ = cumulativeNumberOfFunctionEvaluations;
-                propagationTerminationReason_ = propagationTerminationReason;
+                reset( utilities::ColumnarTimeHistory< TimeType, StateScalarType >( equationsOfMotionNumericalSolutionRaw ),
+                       utilities::ColumnarTimeHistory< TimeType, double >( dependentVariableHistory ),
+                       utilities::ColumnarTimeHistory< TimeType, double >( cumulativeComputationTimeHistory ),
+                       cumulativeNumberOfFunctionEvaluations, propagationTerminationReason );
             }
 
             //! Function to clear all maps with numerical results, but *not* signal that a new propagation will start,
@@ -148,13 +168,14 @@ namespace tudat
                 {
                     throw std::runtime_error( "Error when getting single-arc dynamics initial and final times; no results set" );
                 }
-                return std::make_pair( equationsOfMotionNumericalSolutionRaw_.begin( )->first, equationsOfMotionNumericalSolutionRaw_.rbegin( )->first );
+                return std::make_pair( equationsOfMotionNumericalSolutionRaw_.getHistory( ).frontTime( ),
+                                       equationsOfMotionNumericalSolutionRaw_.getHistory( ).backTime( ) );
             }
 
             //! Function to signal that propagation is finished, and add number of function evaluations
             void finalizePropagation( const std::map<TimeType, unsigned int> cumulativeNumberOfFunctionEvaluations )
             {
-                cumulativeNumberOfFunctionEvaluations_ = cumulativeNumberOfFunctionEvaluations;
+                cumulativeNumberOfFunctionEvaluations_.setHistory( cumulativeNumberOfFunctionEvaluations );
                 propagationIsPerformed_ = true;
             }
 
@@ -164,7 +185,7 @@ namespace tudat
                     const std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>> & equationsOfMotionNumericalSolution )
             {
                 onlyProcessedSolutionSet_ = true;
-                equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
+                equationsOfMotionNumericalSolution_.setHistory( equationsOfMotionNumericalSolution );
             }
 
             //! Function to check if output map that is requested is available
@@ -184,53 +205,121 @@ namespace tudat
                 }
             }
 
-            std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>> &
+            std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>>
             getEquationsOfMotionNumericalSolution( )
             {
                 if( !onlyProcessedSolutionSet_ )
                 {
                     checkAvailabilityOfSolution( "equations of motion numerical solution", false );
                 }
-                return equationsOfMotionNumericalSolution_;
+                return equationsOfMotionNumericalSolution_.getMap( );
             }
 
-            std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>> &
+            std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>>
             getEquationsOfMotionNumericalSolutionRaw( )
             {
                 checkAvailabilityOfSolution( "equations of motion unprocessed numerical solution" );
-                return equationsOfMotionNumericalSolutionRaw_;
+                return equationsOfMotionNumericalSolutionRaw_.getMap( );
+            }
+
+            std::map <TimeType, Eigen::VectorXd> getDependentVariableHistory( )
+            {
+                checkAvailabilityOfSolution( "dependent variable history" );
+                return dependentVariableHistory_.getMap( );
+            }
+
+            std::map<TimeType, double> getCumulativeComputationTimeHistory( )
+            {
+                checkAvailabilityOfSolution( "cumulative computation time history" );
+                return cumulativeComputationTimeHistory_.getMap( );
+            }
+
+            const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionColumnar( )
+            {
+                if( !onlyProcessedSolutionSet_ )
+                {
+                    checkAvailabilityOfSolution( "equations of motion numerical solution", false );
+                }
+                return equationsOfMotionNumericalSolution_.getHistory( );
+            }
+
+            const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionRawColumnar( )
+            {
+                checkAvailabilityOfSolution( "equations of motion unprocessed numerical solution" );
+                return equationsOfMotionNumericalSolutionRaw_.getHistory( );
             }
 
-            std::map <TimeType, Eigen::VectorXd> &getDependentVariableHistory( ) 
+            const utilities::ColumnarTimeHistory< TimeType, double >& getDependentVariableHistoryColumnar( )
             {
                 checkAvailabilityOfSolution( "dependent variable history" );
-                return dependentVariableHistory_;
+                return dependentVariableHistory_.getHistory( );
             }
 
-            std::map<TimeType, double> &getCumulativeComputationTimeHistory( ) 
+            const utilities::ColumnarTimeHistory< TimeType, double >& getCumulativeComputationTimeHistoryColumnar( )
             {
                 checkAvailabilityOfSolution( "cumulative computation time history" );
-                return cumulativeComputationTimeHistory_;
+                return cumulativeComputationTimeHistory_.getHistory( );
             }
 
             double getTotalComputationRuntime( )
             {
                 checkAvailabilityOfSolution( "cumulative computation time history" );
-                return std::max( cumulativeComputationTimeHistory_.begin( )->second,
-                                 cumulativeComputationTimeHistory_.rbegin( )->second );
+                const utilities::ColumnarTimeHistory< TimeType, double >& computationTimeHistory =
+                        cumulativeComputationTimeHistory_.getHistory( );
+                return std::max( computationTimeHistory.getValue( 0 )( 0, 0 ),
+                                 computationTimeHistory.backValue( )( 0, 0 ) );
             }
 
-            std::map<TimeType, unsigned int> &getCumulativeNumberOfFunctionEvaluations( ) 
+            std::map<TimeType, unsigned int> getCumulativeNumberOfFunctionEvaluations( )
             {
                 checkAvailabilityOfSolution( "cumulative number of function evaluations" );
-                return cumulativeNumberOfFunctionEvaluations_;
+                return cumulativeNumberOfFunctionEvaluations_.getMap( );
+            }
+
+            bool isNumberOfFunctionEvaluationsRecorded( )
+            {
+                return cumulativeNumberOfFunctionEvaluations_.getHistory( ).size( ) > 0;
             }
 
             double getTotalNumberOfFunctionEvaluations( )
             {
                 checkAvailabilityOfSolution( "cumulative number of function evaluations" );
-                return std::max( cumulativeNumberOfFunctionEvaluations_.begin( )->second,
-                                 cumulativeNumberOfFunctionEvaluations_.rbegin( )->second );
+                if( !isNumberOfFunctionEvaluationsRecorded( ) )
+                {
+                    throw std::runtime_error( "Error when retrieving number of function evaluations, no evaluations were "
+                                              "recorded (state derivative diagnostics disabled)" );
+                }
+                const utilities::ColumnarTimeHistory< TimeType, double >& functionEvaluationHistory =
+                        cumulativeNumberOfFunctionEvaluations_.getHistory( );
+                return std::max( functionEvaluationHistory.getValue( 0 )( 0, 0 ),
+                                 functionEvaluationHistory.backValue( )( 0, 0 ) );
+            }
+
+            //! Function to set the object with the number of calls and clock time of the models evaluated in the propagation
+            void setModelEvaluationProfiler( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+            {
+                modelEvaluationProfiler_ = modelEvaluationProfiler;
+            }
+
+            bool isModelEvaluationProfileRecorded( )
+            {
+                return modelEvaluationProfiler_ != nullptr;
+            }
+
+            //! Function to retrieve the object with the number of calls and clock time of the models evaluated in the
+            //! propagation (only available if requested with SingleArcPropagatorProcessingSettings::setProfileModelEvaluations)
+            std::shared_ptr< utilities::ModelEvaluationProfiler > getModelEvaluationProfiler( )
+            {
+                if( !propagationIsPerformed_ )
+                {
+                    throw std::runtime_error( "Error when retrieving model evaluation profile, propagation is not yet performed." );
+                }
+                else if( !isModelEvaluationProfileRecorded( ) )
+                {
+                    throw std::runtime_error( "Error when retrieving model evaluation profile, profiling was not requested "
+                                              "in propagator processing settings" );
+                }
+                return modelEvaluationProfiler_;
             }
 
             std::shared_ptr <PropagationTerminationDetails> getPropagationTerminationReason( ) 
@@ -306,8 +395,8 @@ namespace tudat
                 {
                     std::shared_ptr< interpolators::LagrangeInterpolator< TimeType, Eigen::VectorXd > > dependentVariablesInterpolator =
                             std::make_shared< interpolators::LagrangeInterpolator< TimeType, Eigen::VectorXd > >(
-                                    utilities::createVectorFromMapKeys< Eigen::VectorXd, TimeType >( dependentVariableHistory_ ),
-                                    utilities::createVectorFromMapValues< Eigen::VectorXd, TimeType >( dependentVariableHistory_ ), 8 );
+                                    dependentVariableHistory_.getHistory( ).getTimes( ),
+                                    dependentVariableHistory_.getHistory( ).template getValueVector< Eigen::VectorXd >( ), 8 );
                     dependentVariableInterface_->updateDependentVariablesInterpolator( dependentVariablesInterpolator );
                 }
             }
@@ -325,32 +414,35 @@ namespace tudat
 
         private:
 
-            //! Map of state history of numerically integrated bodies.
+            //! State history of numerically integrated bodies.
             /*!
-             *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
-             *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Key of map denotes time,
-             *  values are concatenated vectors of integrated body states (order defined by propagatorSettings_).
-             *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+             *  State history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
+             *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution), stored contiguously.
+             *  Entries are concatenated vectors of integrated body states (order defined by propagatorSettings_). A map
+             *  representation is created when it is first requested.
+             *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
              */
-            std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution_;
+            utilities::MapAdaptedColumnarTimeHistory< TimeType, StateScalarType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
+            equationsOfMotionNumericalSolution_;
 
-            //! Map of state history of numerically integrated bodies.
+            //! State history of numerically integrated bodies.
             /*!
-            *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, in the
-            *  original propagation coordinates. Key of map denotes time, values are concatenated vectors of integrated body
-            * states (order defined by propagatorSettings_).
-            *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+            *  State history of numerically integrated bodies, i.e. the result of the numerical integration, in the
+            *  original propagation coordinates, stored contiguously. Entries are concatenated vectors of integrated body
+            * states (order defined by propagatorSettings_).  A map representation is created when it is first requested.
+            *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
             */
-            std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>> equationsOfMotionNumericalSolutionRaw_;
+            utilities::MapAdaptedColumnarTimeHistory< TimeType, StateScalarType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
+            equationsOfMotionNumericalSolutionRaw_;
 
-            //! Map of dependent variable history that was saved during numerical propagation.
-            std::map <TimeType, Eigen::VectorXd> dependentVariableHistory_;
+            //! Dependent variable history that was saved during numerical propagation.
+            utilities::MapAdaptedColumnarTimeHistory< TimeType, double, Eigen::VectorXd > dependentVariableHistory_;
 
-            //! Map of cumulative computation time history that was saved during numerical propagation.
-            std::map<TimeType, double> cumulativeComputationTimeHistory_;
+            //! Cumulative computation time history that was saved during numerical propagation.
+            utilities::MapAdaptedColumnarTimeHistory< TimeType, double, double > cumulativeComputationTimeHistory_;
 
-            //! Map of cumulative number of function evaluations that was saved during numerical propagation.
-            std::map<TimeType, unsigned int> cumulativeNumberOfFunctionEvaluations_;
+            //! Cumulative number of function evaluations that was saved during numerical propagation.
+            utilities::MapAdaptedColumnarTimeHistory< TimeType, double, unsigned int > cumulativeNumberOfFunctionEvaluations_;
 
             //! Map listing starting entry of dependent variables in output vector, along with associated ID.
             std::map <std::pair<int, int>, std::string> dependentVariableIds_;
@@ -366,8 +458,8 @@ namespace tudat
             std::shared_ptr< SingleArcDependentVariablesInterface< TimeType > > dependentVariableInterface_;
 
             //! Function to convert the propagated solution to conventional solution (see DynamicsStateDerivativeModel::convertToOutputSolution)
-            const std::function< void ( std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-                                        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& ) > rawSolutionConversionFunction_;
+            const std::function< void ( utilities::ColumnarTimeHistory< TimeType, StateScalarType >&,
+                                        const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& ) > rawSolutionConversionFunction_;
 
             bool propagationIsPerformed_;
 
@@ -378,6 +470,9 @@ namespace tudat
             //! Event that triggered the termination of the propagation
             std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason_;
 
+            //! Number of calls and clock time of the models evaluated in the propagation (nullptr if not profiled)
+            std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
             friend class SingleArcDynamicsSimulator<StateScalarType, TimeType>;
 
 //            friend class MultiArcSimulationResults<StateScalarType, TimeType, NumberOfStateColumns >;
@@ -407,23 +502,55 @@ namespace tudat
                 singleArcDynamicsResults_->reset( );
             }
 
+            //! Function that sets new numerical results of a propagation (histories must be sorted by time)
             void reset(
-                    std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >>& fullSolution,
-                    const std::map <TimeType, Eigen::VectorXd>& dependentVariableHistory,
-                    const std::map<TimeType, double>& cumulativeComputationTimeHistory,
+                    utilities::ColumnarTimeHistory< TimeType, StateScalarType >&& fullSolution,
+                    utilities::ColumnarTimeHistory< TimeType, double >&& dependentVariableHistory,
+                    utilities::ColumnarTimeHistory< TimeType, double >&& cumulativeComputationTimeHistory,
                     const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
                     std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
             {
-                std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >> equationsOfMotionNumericalSolutionRaw;
+                utilities::ColumnarTimeHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw;
                 splitSolution( fullSolution, equationsOfMotionNumericalSolutionRaw );
+                fullSolution = utilities::ColumnarTimeHistory< TimeType, StateScalarType >( );
                 singleArcDynamicsResults_->reset(
-                        equationsOfMotionNumericalSolutionRaw,
-                        dependentVariableHistory,
-                        cumulativeComputationTimeHistory,
+                        std::move( equationsOfMotionNumericalSolutionRaw ),
+                        std::move( dependentVariableHistory ),
+                        std::move( cumulativeComputationTimeHistory ),
                         cumulativeNumberOfFunctionEvaluations,
                         propagationTerminationReason );
             }
 
+            void reset(
+                    std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >>& fullSolution,
+                    const std::map <TimeType, Eigen::VectorXd>& dependentVariableHistory,
+                    const std::map<TimeType, double>& cumulativeComputationTimeHistory,
+                    const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
+                    std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
+            {
+                reset( utilities::ColumnarTimeHistory< TimeType, StateScalarType >( fullSolution ),
+                       utilities::ColumnarTimeHistory< TimeType, double >( dependentVariableHistory ),
+                       utilities::ColumnarTimeHistory< TimeType, double >( cumulativeComputationTimeHistory ),
+                       cumulativeNumberOfFunctionEvaluations, propagationTerminationReason );
+            }
+
+            //! Function to split the full numerical solution into the solution for state transition matrix, sensitivity matrix, and unprocessed dynamics solution
+            void splitSolution(
+                    const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& fullSolution,
+                    utilities::ColumnarTimeHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolutionRaw )
+            {
+                equationsOfMotionNumericalSolutionRaw.reserve( fullSolution.size( ) );
+                for( int i = 0; i < fullSolution.size( ); i++ )
+                {
+                    const double currentTime = static_cast< double >( fullSolution.getTime( i ) );
+                    auto currentSolution = fullSolution.getValue( i );
+                    stateTransitionSolution_[ currentTime ] = currentSolution.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).template cast< double >( );
+                    sensitivitySolution_[ currentTime ] = currentSolution.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ).template cast< double >( );
+                    equationsOfMotionNumericalSolutionRaw.pushBack(
+                                fullSolution.getTime( i ), currentSolution.block( 0, stateTransitionMatrixSize_ + sensitivityMatrixSize_, stateTransitionMatrixSize_, 1 ) );
+                }
+            }
+
             //! Function to split the full numerical solution into the solution for state transition matrix, sensitivity matrix, and unprocessed dynamics solution
             void splitSolution(
                     const std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >>& fullSolution,
@@ -449,6 +576,11 @@ namespace tudat
                 singleArcDynamicsResults_->finalizePropagation( cumulativeNumberOfFunctionEvaluations );
             }
 
+            void setModelEvaluationProfiler( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+            {
+                singleArcDynamicsResults_->setModelEvaluationProfiler( modelEvaluationProfiler );
+            }
+
             std::map < double, Eigen::MatrixXd >& getStateTransitionSolution( )
             {
                 return stateTransitionSolution_;
@@ -610,8 +742,8 @@ namespace tudat
                 arcEndTimes_.clear( );
                 for( unsigned int i = 0; i < singleArcResults_.size( ); i++ )
                 {
-                    arcStartTimes_.push_back( singleArcResults_.at( i )->getEquationsOfMotionNumericalSolution( ).begin( )->first );
-                    arcEndTimes_.push_back( singleArcResults_.at( i )->getEquationsOfMotionNumericalSolution( ).rbegin( )->first );
+                    arcStartTimes_.push_back( singleArcResults_.at( i )->getEquationsOfMotionNumericalSolutionColumnar( ).frontTime( ) );
+                    arcEndTimes_.push_back( singleArcResults_.at( i )->getEquationsOfMotionNumericalSolutionColumnar( ).backTime( ) );
                 }
             }
 
@@ -676,7 +808,7 @@ namespace tudat
                     {
                         if( clearResults )
                         {
-                            concatenatedResults.push_back( std::move( singleArcResults_.at( i )->getEquationsOfMotionNumericalSolution( ) ) );
+                            concatenatedResults.push_back( singleArcResults_.at( i )->getEquationsOfMotionNumericalSolution( ) );
                             singleArcResults_.at( i )->clearSolutionMaps( );
                         }
                         else
@@ -752,10 +884,7 @@ namespace tudat
                         {
                             std::shared_ptr<interpolators::LagrangeInterpolator<TimeType, Eigen::VectorXd> > dependentVariablesInterpolator =
                                     std::make_shared<interpolators::LagrangeInterpolator<TimeType, Eigen::VectorXd> >(
-                                            utilities::createVectorFromMapKeys<Eigen::VectorXd, TimeType>(
-                                                    singleArcResults_.at( i )->getDependentVariableHistory( )),
-                                            utilities::createVectorFromMapValues<Eigen::VectorXd, TimeType>(
-                                                    singleArcResults_.at( i )->getDependentVariableHistory( )), 8 );
+                                            singleArcResults_.at( i )->getDependentVariableHistory( ), 8 );
                             dependentVariablesInterpolators.push_back( dependentVariablesInterpolator );
                         }
                         else
@@ -238,6 +238,11 @@ public:
      * \param checkTerminationToExactCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param useDenseOutputForExactTermination Boolean denoting whether the exact final condition is to be located on the
+     * dense output of the last integrator step (with fallback to repeated integrator steps), instead of by repeated
+     * integrator steps only.
+     * \param denseOutputTerminationTolerance Maximum absolute error in dependent variable at final condition located on
+     * dense output, for which the solution is accepted (no check if NaN).
      */
     SingleVariableLimitPropagationTerminationCondition(
             const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
@@ -245,12 +250,17 @@ public:
             const double limitingValue,
             const bool useAsLowerBound,
             const bool checkTerminationToExactCondition = false,
-            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr ):
+            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+            const bool useDenseOutputForExactTermination = false,
+            const double denseOutputTerminationTolerance = TUDAT_NAN ):
         PropagationTerminationCondition(
             dependent_variable_stopping_condition, checkTerminationToExactCondition ),
         dependentVariableSettings_( dependentVariableSettings ), variableRetrievalFunction_( variableRetrievalFuntion ),
         limitingValue_( limitingValue ), useAsLowerBound_( useAsLowerBound ),
-        terminationRootFinderSettings_( terminationRootFinderSettings )
+        terminationRootFinderSettings_( terminationRootFinderSettings ),
+        useDenseOutputForExactTermination_( useDenseOutputForExactTermination ),
+        denseOutputTerminationTolerance_( denseOutputTerminationTolerance ),
+        numberOfDenseOutputTerminationFallbacks_( 0 )
     {
         if( ( checkTerminationToExactCondition == false ) && ( terminationRootFinderSettings != nullptr ) )
         {
@@ -297,6 +307,43 @@ public:
         return terminationRootFinderSettings_;
     }
 
+    //! Function to retrieve whether the exact final condition is to be located on the dense output of the last step
+    /*!
+     *  Function to retrieve whether the exact final condition is to be located on the dense output of the last step
+     *  \return Boolean denoting whether the exact final condition is to be located on the dense output of the last step
+     */
+    bool getUseDenseOutputForExactTermination( )
+    {
+        return useDenseOutputForExactTermination_;
+    }
+
+    //! Function to retrieve maximum absolute error in dependent variable at final condition located on dense output
+    /*!
+     *  Function to retrieve maximum absolute error in dependent variable at final condition located on dense output
+     *  \return Maximum absolute error in dependent variable at final condition located on dense output (no check if NaN)
+     */
+    double getDenseOutputTerminationTolerance( )
+    {
+        return denseOutputTerminationTolerance_;
+    }
+
+    //! Function to retrieve number of times the dense output could not be used to locate the exact final condition
+    /*!
+     *  Function to retrieve number of times the dense output could not be used to locate the exact final condition, so
+     *  that the final condition was located by repeated integrator steps instead.
+     *  \return Number of times the dense output could not be used to locate the exact final condition
+     */
+    unsigned int getNumberOfDenseOutputTerminationFallbacks( )
+    {
+        return numberOfDenseOutputTerminationFallbacks_;
+    }
+
+    //! Function to register that the dense output could not be used to locate the exact final condition
+    void registerDenseOutputTerminationFallback( )
+    {
+        numberOfDenseOutputTerminationFallbacks_++;
+    }
+
 private:
 
     //! Settings for dependent variable that is to be checked
@@ -314,6 +361,15 @@ private:
 
     //! Settings to create root finder used to converge on exact final condition.
     std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings_;
+
+    //! Boolean denoting whether the exact final condition is to be located on the dense output of the last step
+    bool useDenseOutputForExactTermination_;
+
+    //! Maximum absolute error in dependent variable at final condition located on dense output (no check if NaN)
+    double denseOutputTerminationTolerance_;
+
+    //! Number of times the dense output could not be used to locate the exact final condition
+    unsigned int numberOfDenseOutputTerminationFallbacks_;
 };
 
 //! Class for stopping the propagation with custom stopping function.
@@ -502,7 +558,9 @@ std::shared_ptr< PropagationTerminationCondition > createPropagationTerminationC
                     dependentVariableFunction, dependentVariableTerminationSettings->limitValue_,
                     dependentVariableTerminationSettings->useAsLowerLimit_,
                     dependentVariableTerminationSettings->checkTerminationToExactCondition_,
-                    dependentVariableTerminationSettings->terminationRootFinderSettings_ );
+                    dependentVariableTerminationSettings->terminationRootFinderSettings_,
+                    dependentVariableTerminationSettings->useDenseOutputForExactTermination_,
+                    dependentVariableTerminationSettings->denseOutputTerminationTolerance_ );
         break;
     }
     case custom_stopping_condition:
@@ -146,18 +146,28 @@ public:
      * \param checkTerminationToExactCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param useDenseOutputForExactTermination Boolean denoting whether the exact final condition is to be located on the
+     * continuous extension (dense output) of the last integrator step, instead of by repeated integrator steps. Only used
+     * if checkTerminationToExactCondition is true. If the integrator provides no dense output, or the located final
+     * condition is not within denseOutputTerminationTolerance, the repeated integrator steps are used instead.
+     * \param denseOutputTerminationTolerance Maximum absolute difference between the dependent variable and limitValue
+     * after the final integrator step to the final condition located on the dense output. If NaN, no check is performed.
      */
     PropagationDependentVariableTerminationSettings(
             const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
             const double limitValue,
             const bool useAsLowerLimit,
             const bool checkTerminationToExactCondition = false,
-            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr ):
+            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+            const bool useDenseOutputForExactTermination = false,
+            const double denseOutputTerminationTolerance = TUDAT_NAN ):
         PropagationTerminationSettings(
             dependent_variable_stopping_condition, checkTerminationToExactCondition ),
         dependentVariableSettings_( dependentVariableSettings ),
         limitValue_( limitValue ), useAsLowerLimit_( useAsLowerLimit ),
-        terminationRootFinderSettings_( terminationRootFinderSettings )
+        terminationRootFinderSettings_( terminationRootFinderSettings ),
+        useDenseOutputForExactTermination_( useDenseOutputForExactTermination ),
+        denseOutputTerminationTolerance_( denseOutputTerminationTolerance )
     {
         if( checkTerminationToExactCondition_ && ( terminationRootFinderSettings_ == nullptr ) )
         {
@@ -180,6 +190,12 @@ public:
 
     //! Settings to create root finder used to converge on exact final condition.
     std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings_;
+
+    //! Boolean denoting whether the exact final condition is to be located on the dense output of the last integrator step
+    bool useDenseOutputForExactTermination_;
+
+    //! Maximum absolute error in dependent variable at final condition located on dense output (no check if NaN)
+    double denseOutputTerminationTolerance_;
 };
 
 //! Class for propagation stopping conditions settings: stopping the propagation based on custom requirements
@@ -260,11 +276,13 @@ inline std::shared_ptr< PropagationTerminationSettings > propagationDependentVar
         const double limitValue,
         const bool useAsLowerLimit,
         const bool checkTerminationToExactCondition = false,
-        const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr )
+        const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+        const bool useDenseOutputForExactTermination = false,
+        const double denseOutputTerminationTolerance = TUDAT_NAN )
 {
     return std::make_shared< PropagationDependentVariableTerminationSettings >(
                 dependentVariableSettings, limitValue, useAsLowerLimit, checkTerminationToExactCondition,
-                terminationRootFinderSettings );
+                terminationRootFinderSettings, useDenseOutputForExactTermination, denseOutputTerminationTolerance );
 }
 
 inline std::shared_ptr< PropagationTerminationSettings > propagationTimeTerminationSettings(
@@ -12,6 +12,7 @@
 #define TUDAT_SETNUMERICALLYINTEGRATEDSTATES_H
 
 #include "tudat/basics/utilities.h"
+#include "tudat/basics/columnarTimeHistory.h"
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/astro/ephemerides/frameManager.h"
 #include "tudat/astro/ephemerides/multiArcEphemeris.h"
@@ -191,6 +192,61 @@ void convertNumericalSolutionToEphemerisInput(
     }
 }
 
+//! Function to convert output of translational motion to input for the ephemeris, from a columnar history.
+/*!
+ * Function to convert output of translational motion to input for the ephemeris, from a columnar history, reading the
+ * states directly from the columns (see overload for map input for details).
+ * \param bodyIndex Index of integrated body for which the state is to be retrieved
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
+ * \param equationsOfMotionNumericalSolution Full numerical solution of numerical integrator,
+ * already converted to Cartesian states (w.r.t. the integration origin of the body of bodyIndex)
+ * \param ephemerisTable State history of body bodyIndex w.r.t. the origin with which its ephemeris is defined
+ * (returned by reference).
+ * \param integrationToEphemerisFrameFunction Function to provide the state of the ephemeris origin
+ * of the current body w.r.t. its integration origin.
+*/
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToEphemerisInput(
+        const int bodyIndex,
+        const int startIndex,
+        const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisTable,
+        const std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) >
+        integrationToEphemerisFrameFunction = nullptr )
+{
+    const auto values = equationsOfMotionNumericalSolution.getValues( );
+    for( int i = 0; i < equationsOfMotionNumericalSolution.size( ); i++ )
+    {
+        const TimeType& currentTime = equationsOfMotionNumericalSolution.getTime( i );
+        if( integrationToEphemerisFrameFunction == nullptr )
+        {
+            ephemerisTable[ currentTime ] = values.col( i ).template segment< 6 >( startIndex + 6 * bodyIndex );
+        }
+        else
+        {
+            ephemerisTable[ currentTime ] = values.col( i ).template segment< 6 >( startIndex + 6 * bodyIndex ) -
+                    integrationToEphemerisFrameFunction( currentTime );
+        }
+    }
+}
+
+//! Function to retrieve the size of the entries of a numerical solution stored as a map.
+template< typename TimeType, typename StateScalarType >
+unsigned int getNumericalSolutionEntrySize(
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution )
+{
+    return equationsOfMotionNumericalSolution.size( ) == 0 ? 0 :
+                static_cast< unsigned int >( equationsOfMotionNumericalSolution.begin( )->second.rows( ) );
+}
+
+//! Function to retrieve the size of the entries of a numerical solution stored as a columnar history.
+template< typename TimeType, typename StateScalarType >
+unsigned int getNumericalSolutionEntrySize(
+        const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution )
+{
+    return static_cast< unsigned int >( equationsOfMotionNumericalSolution.getEntryRows( ) );
+}
+
 //! Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
 /*!
  * Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
@@ -206,12 +262,12 @@ void convertNumericalSolutionToEphemerisInput(
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void getSingleBodyStateHistoryFromPropagationOutpiut(
         const std::vector< std::string >& bodiesToIntegrate,
         const int translationalStateStartIndex,
         const std::string& bodyForWhichToRetrieveState,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
         int& bodyIndex,
         const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
@@ -255,13 +311,14 @@ void getSingleBodyStateHistoryFromPropagationOutpiut(
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType,
+          typename NumericalSolutionType = std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
 void createAndSetInterpolatorsForEphemerides(
         const simulation_setup::SystemOfBodies& bodies,
         const std::vector< std::string >& bodiesToIntegrate,
         const int startIndex,
         const std::vector< std::string >& ephemerisUpdateOrder,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
         integrationToEphemerisFrameFunctions =
         std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
@@ -298,10 +355,11 @@ void createAndSetInterpolatorsForEphemerides(
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType,
+          typename NumericalSolutionType = std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
 void resetIntegratedEphemerides(
         const simulation_setup::SystemOfBodies& bodies,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::vector< std::string >& bodiesToIntegrate,
         const std::pair< unsigned int, unsigned int > startIndexAndSize,
         std::vector< std::string > ephemerisUpdateOrder = std::vector< std::string >( ),
@@ -320,7 +378,7 @@ void resetIntegratedEphemerides(
         throw std::runtime_error( "Error when resetting ephemerides, input vectors have inconsistent size" );
     }
     
-    if( static_cast< unsigned int >( equationsOfMotionNumericalSolution.begin( )->second.rows( ) )
+    if( getNumericalSolutionEntrySize( equationsOfMotionNumericalSolution )
             < startIndexAndSize.first + startIndexAndSize.second )
     {
         throw std::runtime_error( "Error when resetting ephemerides, input solution inconsistent with start index and size." );
@@ -333,7 +391,7 @@ void resetIntegratedEphemerides(
     }
     
     // Create interpolators from numerical integration results (states) at discrete times.
-    createAndSetInterpolatorsForEphemerides(
+    createAndSetInterpolatorsForEphemerides< TimeType, StateScalarType >(
                 bodies, bodiesToIntegrate, startIndexAndSize.first, ephemerisUpdateOrder,
                 equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions );
 }
@@ -546,6 +604,30 @@ void convertNumericalSolutionToRotationalEphemerisInput(
     }
 }
 
+//! Function to convert output of rotational motion to input for the rotational ephemeris, from a columnar history.
+/*!
+ * Function to convert output of rotational motion to input for the rotational ephemeris, from a columnar history,
+ * reading the states directly from the columns (see overload for map input for details).
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the rotational states start.
+ * \param bodyIndex Index of integrated body for which the state is to be retrieved
+ * \param ephemerisTable Rotational state history of body bodyIndex (returned by reference).
+ * \param equationsOfMotionNumericalSolution Full numerical solution of numerical integrator
+*/
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToRotationalEphemerisInput(
+        const int startIndex,
+        const int bodyIndex,
+        std::map< TimeType, Eigen::Matrix< StateScalarType, 7, 1 > >& ephemerisTable,
+        const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution )
+{
+    const auto values = equationsOfMotionNumericalSolution.getValues( );
+    for( int i = 0; i < equationsOfMotionNumericalSolution.size( ); i++ )
+    {
+        ephemerisTable[ equationsOfMotionNumericalSolution.getTime( i ) ] =
+                values.col( i ).template segment< 7 >( startIndex + 7 * bodyIndex );
+    }
+}
+
 //! Function to create an interpolator for the new translational state of a body.
 /*!
  * Function to create an interpolator for the new translational state of a body.
@@ -576,12 +658,13 @@ createRotationalStateInterpolator(
  * \param startIndex Index in the state vector where the rotational state starts.
  * \param equationsOfMotionNumericalSolution New rotational state history that is to be set
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType,
+          typename NumericalSolutionType = std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
 void createAndSetInterpolatorsForRotationalEphemerides(
         const simulation_setup::SystemOfBodies& bodies,
         const std::vector< std::string >& bodiesToIntegrate,
         const int startIndex,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution )
+        const NumericalSolutionType& equationsOfMotionNumericalSolution )
 {
     using namespace tudat::interpolators;
     
@@ -611,15 +694,16 @@ void createAndSetInterpolatorsForRotationalEphemerides(
  * \param startIndexAndSize Pair with start index and total (contiguous) size of integrated states in entries of
  * equationsOfMotionNumericalSolution
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType,
+          typename NumericalSolutionType = std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
 void resetIntegratedRotationalEphemerides(
         const simulation_setup::SystemOfBodies& bodies,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::vector< std::string >& bodiesToIntegrate,
         const std::pair< unsigned int, unsigned int > startIndexAndSize )
 {
     // Create interpolators from numerical integration results (states) at discrete times.
-    createAndSetInterpolatorsForRotationalEphemerides(
+    createAndSetInterpolatorsForRotationalEphemerides< TimeType, StateScalarType >(
                 bodies, bodiesToIntegrate, startIndexAndSize.first, equationsOfMotionNumericalSolution );
     
     // Having set new ephemerides, update body properties depending on ephemerides.
@@ -630,6 +714,52 @@ void resetIntegratedRotationalEphemerides(
     }
 }
 
+//! Function to extract the history of a single entry of a numerical solution stored as a map.
+/*!
+ * Function to extract the history of a single entry of a numerical solution stored as a map, converted to doubles.
+ * \param equationsOfMotionNumericalSolution Numerical solution from which the entry is to be extracted
+ * \param entryIndex Index in entries of equationsOfMotionNumericalSolution of the entry that is to be extracted
+ * \return History of the requested entry
+ */
+template< typename TimeType, typename StateScalarType >
+std::map< double, double > getSingleEntryHistoryFromNumericalSolution(
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const int entryIndex )
+{
+    std::map< double, double > entryHistory;
+    for( auto stateIterator = equationsOfMotionNumericalSolution.begin( );
+         stateIterator != equationsOfMotionNumericalSolution.end( ); stateIterator++ )
+    {
+        entryHistory[ static_cast< double >( stateIterator->first ) ] =
+                static_cast< double >( stateIterator->second( entryIndex ) );
+    }
+    return entryHistory;
+}
+
+//! Function to extract the history of a single entry of a numerical solution stored as a columnar history.
+/*!
+ * Function to extract the history of a single entry of a numerical solution stored as a columnar history, converted
+ * to doubles.
+ * \param equationsOfMotionNumericalSolution Numerical solution from which the entry is to be extracted
+ * \param entryIndex Index in entries of equationsOfMotionNumericalSolution of the entry that is to be extracted
+ * \return History of the requested entry
+ */
+template< typename TimeType, typename StateScalarType >
+std::map< double, double > getSingleEntryHistoryFromNumericalSolution(
+        const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        const int entryIndex )
+{
+    std::map< double, double > entryHistory;
+    const auto values = equationsOfMotionNumericalSolution.getValues( );
+    for( int i = 0; i < equationsOfMotionNumericalSolution.size( ); i++ )
+    {
+        entryHistory.emplace_hint( entryHistory.end( ),
+                                   static_cast< double >( equationsOfMotionNumericalSolution.getTime( i ) ),
+                                   static_cast< double >( values( entryIndex, i ) ) );
+    }
+    return entryHistory;
+}
+
 //! Resets the mass models of the integrated bodies from the numerical integration results.
 /*!
  * Resets the mass models of the integrated bodies from the numerical integration results.
@@ -640,10 +770,11 @@ void resetIntegratedRotationalEphemerides(
  * \param startIndexAndSize Pair with start index and total (contiguous) size of integrated states in entries of
  * equationsOfMotionNumericalSolution
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType,
+          typename NumericalSolutionType = std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
 void resetIntegratedBodyMass(
         const simulation_setup::SystemOfBodies& bodies,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::vector< std::string >& bodiesToIntegrate ,
         const std::pair< unsigned int, unsigned int > startIndexAndSize )
 {
@@ -655,16 +786,9 @@ void resetIntegratedBodyMass(
     // Iterate over all bodies for which mass is propagated.
     for( unsigned int i = 0; i < bodiesToIntegrate.size( ); i++ )
     {
-        std::map< double, double > currentBodyMassMap;
-        
         // Create mass map with double entries.
-        for( typename std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
-             stateIterator = equationsOfMotionNumericalSolution.begin( );
-             stateIterator != equationsOfMotionNumericalSolution.end( ); stateIterator++ )
-        {
-            currentBodyMassMap[ static_cast< double >( stateIterator->first ) ] =
-                    static_cast< double >( stateIterator->second( startIndexAndSize.first + i ) );
-        }
+        std::map< double, double > currentBodyMassMap = getSingleEntryHistoryFromNumericalSolution(
+                    equationsOfMotionNumericalSolution, startIndexAndSize.first + i );
         
         typedef interpolators::OneDimensionalInterpolator< double, double > LocalInterpolator;
         
@@ -752,6 +876,16 @@ public:
             const std::map< TimeType, Eigen::Matrix< StateScalarType,
             Eigen::Dynamic, 1 > >& numericalSolution ) = 0;
 
+    //! Function that processes the entries of the stateType_ in the full numericalSolution, stored as columnar history
+    /*!
+     * Function that processes the entries of the stateType_ in the full numericalSolution, stored as columnar history,
+     * without converting it to a map.
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in associated SingleStateTypeDerivative derived class.
+     */
+    virtual void processIntegratedStates(
+            const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& numericalSolution ) = 0;
+
     //! List of bodies used in simulations.
     simulation_setup::SystemOfBodies bodies_;
 
@@ -871,6 +1005,15 @@ public:
                     integrationToEphemerisFrameFunctions_ );
     }
 
+    //! Function processing single-arc translational state, stored as columnar history (see overload for map input)
+    void processIntegratedStates(
+            const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedEphemerides< TimeType, StateScalarType >(
+                    this->bodies_, numericalSolution, this->bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
+                    integrationToEphemerisFrameFunctions_ );
+    }
+
     std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > > getIntegrationToEphemerisFrameFunctions( )
     {
         return integrationToEphemerisFrameFunctions_;
@@ -1060,6 +1203,14 @@ public:
                     this->bodies_, numericalSolution, this->bodiesToIntegrate_, this->startIndexAndSize_ );
     }
 
+    //! Function processing rotational state, stored as columnar history (see overload for map input)
+    void processIntegratedStates(
+            const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedRotationalEphemerides< TimeType, StateScalarType >(
+                    this->bodies_, numericalSolution, this->bodiesToIntegrate_, this->startIndexAndSize_ );
+    }
+
 private:
 
 };
@@ -1098,7 +1249,16 @@ public:
     void processIntegratedStates(
             const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& numericalSolution )
     {
-        resetIntegratedBodyMass( this->bodies_, numericalSolution, this->bodiesToIntegrate_, this->startIndexAndSize_ );
+        resetIntegratedBodyMass< TimeType, StateScalarType >(
+                    this->bodies_, numericalSolution, this->bodiesToIntegrate_, this->startIndexAndSize_ );
+    }
+
+    //! Function processing mass state, stored as columnar history (see overload for map input)
+    void processIntegratedStates(
+            const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedBodyMass< TimeType, StateScalarType >(
+                    this->bodies_, numericalSolution, this->bodiesToIntegrate_, this->startIndexAndSize_ );
     }
 
 private:
@@ -1467,6 +1627,29 @@ void resetIntegratedStates(
     }
 }
 
+//! Function resetting dynamical properties of environment from numerical dynamics solution, stored as columnar history
+/*!
+ * Function to reset the dynamical properties of the environment from the numerically integrated
+ * dynamics solution, stored as columnar history (which is processed without converting it to a map).
+ * \param equationsOfMotionNumericalSolution Solution produced by the numerical integration, in the
+ * 'conventional form'
+ * \sa SingleStateTypeDerivative::convertToOutputSolution
+ * \param integratedStateProcessors List of objects (per dynamics type) used to process integrated
+ * results into environment
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedStates(
+        const utilities::ColumnarTimeHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        const std::map< IntegratedStateType, std::shared_ptr<
+        SingleArcIntegratedStateProcessor< TimeType, StateScalarType > > >& integratedStateProcessors )
+{
+    for( auto updateIterator = integratedStateProcessors.begin( );
+         updateIterator != integratedStateProcessors.end( ); updateIterator++ )
+    {
+        updateIterator->second->processIntegratedStates( equationsOfMotionNumericalSolution );
+    }
+}
+
 } // namespace propagators
 
 } // namespace tudat
@@ -10,6 +10,7 @@
 
 #include "tudat/astro/basic_astro/polyhedronBodyShapeModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/basics/utilities.h"
 
 namespace tudat
 {
@@ -18,6 +19,28 @@ namespace basic_astrodynamics
 
 double PolyhedronBodyShapeModel::getAltitude( const Eigen::Vector3d& bodyFixedPosition )
 {
+    if ( spatialIndex_ != nullptr )
+    {
+        int closestFeature;
+        if ( justComputeDistanceToVertices_ )
+        {
+            double altitude = spatialIndex_->computeDistanceToClosestVertex( bodyFixedPosition, closestFeature );
+
+            // If point inside the polyhedron, altitude should be negative
+            if ( computeAltitudeWithSign_ &&
+                 spatialIndex_->computeSignedDistanceToSurface( bodyFixedPosition, closestFeature ) < 0.0 )
+            {
+                altitude = - altitude;
+            }
+            return altitude;
+        }
+        else
+        {
+            double altitude = spatialIndex_->computeSignedDistanceToSurface( bodyFixedPosition, closestFeature );
+            return computeAltitudeWithSign_ ? altitude : std::abs( altitude );
+        }
+    }
+
     // Initialize the variable that will hold the altitude
     double altitude;
 
@@ -145,6 +168,25 @@ double PolyhedronBodyShapeModel::getAltitude( const Eigen::Vector3d& bodyFixedPo
     return altitude;
 }
 
+Eigen::VectorXd PolyhedronBodyShapeModel::getAltitudes( const Eigen::Matrix3Xd& bodyFixedPositions,
+                                                        const int numberOfThreads )
+{
+    Eigen::VectorXd altitudes = Eigen::VectorXd::Zero( bodyFixedPositions.cols( ) );
+
+    // Altitude computation does not modify the shape model, so positions can be distributed over threads
+    utilities::parallelForEachBlock(
+                bodyFixedPositions.cols( ), numberOfThreads,
+                [ & ]( const int startIndex, const int endIndex, const int )
+    {
+        for ( int i = startIndex; i < endIndex; ++i )
+        {
+            altitudes( i ) = getAltitude( bodyFixedPositions.col( i ) );
+        }
+    } );
+
+    return altitudes;
+}
+
 double PolyhedronBodyShapeModel::computeDistanceToClosestVertex(
         const Eigen::Vector3d& bodyFixedPosition,
         unsigned int& closestVertexId )
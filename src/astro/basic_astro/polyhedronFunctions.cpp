@@ -9,7 +9,11 @@
  *
  */
 
+#include <cmath>
+
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
+#include "tudat/basics/utilities.h"
+#include "tudat/math/basic/legendrePolynomials.h"
 #include "tudat/math/basic/polyhedron.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
@@ -191,5 +195,196 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
     return computePolyhedronInertiaTensor( verticesCoordinates, verticesDefiningEachFacet, density );
 }
 
+void computeTetrahedronQuadratureRule( const int polynomialDegree,
+                                       Eigen::MatrixXd& barycentricCoordinates,
+                                       Eigen::VectorXd& weights )
+{
+    if( polynomialDegree < 0 )
+    {
+        throw std::runtime_error( "Error when computing tetrahedron quadrature rule, polynomial degree must be non-negative." );
+    }
+
+    // Rule with index s is exact up to degree 2s+1
+    const int ruleIndex = std::max( 0, polynomialDegree / 2 );
+    const int exactDegree = 2 * ruleIndex + 1;
+
+    // Count number of nodes: sum over i of the number of 4-tuples of non-negative integers that sum to (s - i)
+    int numberOfNodes = 0;
+    for( int i = 0; i <= ruleIndex; i++ )
+    {
+        int tupleSum = ruleIndex - i;
+        numberOfNodes += ( tupleSum + 1 ) * ( tupleSum + 2 ) * ( tupleSum + 3 ) / 6;
+    }
+    barycentricCoordinates.resize( numberOfNodes, 4 );
+    weights.resize( numberOfNodes );
+
+    int currentNode = 0;
+    for( int i = 0; i <= ruleIndex; i++ )
+    {
+        // Compute (unnormalized) weight of all nodes for current i
+        const double denominator = static_cast< double >( exactDegree + 3 - 2 * i );
+        double currentWeight = std::pow( denominator, exactDegree ) / std::pow( 2.0, 2 * ruleIndex );
+        for( int j = 2; j <= i; j++ )
+        {
+            currentWeight /= static_cast< double >( j );
+        }
+        for( int j = 2; j <= exactDegree + 3 - i; j++ )
+        {
+            currentWeight /= static_cast< double >( j );
+        }
+        if( i % 2 == 1 )
+        {
+            currentWeight = -currentWeight;
+        }
+
+        // Set nodes for all 4-tuples beta that sum to (s - i)
+        const int tupleSum = ruleIndex - i;
+        for( int beta0 = 0; beta0 <= tupleSum; beta0++ )
+        {
+            for( int beta1 = 0; beta1 <= tupleSum - beta0; beta1++ )
+            {
+                for( int beta2 = 0; beta2 <= tupleSum - beta0 - beta1; beta2++ )
+                {
+                    const int beta3 = tupleSum - beta0 - beta1 - beta2;
+                    barycentricCoordinates( currentNode, 0 ) = static_cast< double >( 2 * beta0 + 1 ) / denominator;
+                    barycentricCoordinates( currentNode, 1 ) = static_cast< double >( 2 * beta1 + 1 ) / denominator;
+                    barycentricCoordinates( currentNode, 2 ) = static_cast< double >( 2 * beta2 + 1 ) / denominator;
+                    barycentricCoordinates( currentNode, 3 ) = static_cast< double >( 2 * beta3 + 1 ) / denominator;
+                    weights( currentNode ) = currentWeight;
+                    currentNode++;
+                }
+            }
+        }
+    }
+
+    // Normalize weights, so that constant function is integrated to volume of tetrahedron
+    weights /= weights.sum( );
+}
+
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > computePolyhedronSphericalHarmonicCoefficients(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int maximumDegree,
+        const double referenceRadius,
+        const int numberOfThreads )
+{
+    // Check if inputs are valid
+    basic_mathematics::checkValidityOfPolyhedronSettings ( verticesCoordinates, verticesDefiningEachFacet );
+    if( maximumDegree < 0 )
+    {
+        throw std::runtime_error( "Error when computing polyhedron spherical harmonic coefficients, maximum degree must be non-negative." );
+    }
+    if( !( referenceRadius > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when computing polyhedron spherical harmonic coefficients, reference radius must be positive." );
+    }
+
+    const int numberOfFacets = verticesDefiningEachFacet.rows( );
+
+    // Retrieve quadrature rule; integrands r^n * P_nm( sin( latitude ) ) * cos/sin( m * longitude ) are polynomials
+    // of degree n in Cartesian coordinates
+    Eigen::MatrixXd barycentricCoordinates;
+    Eigen::VectorXd quadratureWeights;
+    computeTetrahedronQuadratureRule( maximumDegree, barycentricCoordinates, quadratureWeights );
+    const int numberOfNodes = quadratureWeights.rows( );
+
+    // Integrate solid spherical harmonics over the tetrahedra formed by each facet and the origin, with one set of
+    // partial sums per block of facets
+    std::vector< Eigen::MatrixXd > blockCosineIntegrals( std::max( 1, numberOfThreads ) );
+    std::vector< Eigen::MatrixXd > blockSineIntegrals( std::max( 1, numberOfThreads ) );
+    int numberOfBlocks = utilities::parallelForEachBlock(
+                numberOfFacets, numberOfThreads,
+                [ & ]( const int startFacet, const int endFacet, const int blockIndex )
+    {
+        Eigen::MatrixXd& cosineIntegrals = blockCosineIntegrals.at( blockIndex );
+        Eigen::MatrixXd& sineIntegrals = blockSineIntegrals.at( blockIndex );
+        cosineIntegrals.setZero( maximumDegree + 1, maximumDegree + 1 );
+        sineIntegrals.setZero( maximumDegree + 1, maximumDegree + 1 );
+
+        basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+        std::vector< double > radiusPowers( maximumDegree + 1 );
+        std::vector< double > cosinesOfLongitude( maximumDegree + 1 );
+        std::vector< double > sinesOfLongitude( maximumDegree + 1 );
+
+        for( int facet = startFacet; facet < endFacet; facet++ )
+        {
+            Eigen::Vector3d vertex0 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 0 ), 0 );
+            Eigen::Vector3d vertex1 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 1 ), 0 );
+            Eigen::Vector3d vertex2 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 2 ), 0 );
+
+            // Signed volume of tetrahedron
+            double volumeOfTetrahedron = 1.0 / 6.0 * vertex0.dot( vertex1.cross( vertex2 ) );
+            if( volumeOfTetrahedron == 0.0 )
+            {
+                continue;
+            }
+
+            for( int node = 0; node < numberOfNodes; node++ )
+            {
+                // First barycentric coordinate corresponds to the origin
+                Eigen::Vector3d nodePosition =
+                        barycentricCoordinates( node, 1 ) * vertex0 + barycentricCoordinates( node, 2 ) * vertex1 +
+                        barycentricCoordinates( node, 3 ) * vertex2;
+                double nodeWeight = volumeOfTetrahedron * quadratureWeights( node );
+
+                double distance = nodePosition.norm( );
+                double horizontalDistance = std::sqrt( nodePosition( 0 ) * nodePosition( 0 ) +
+                                                       nodePosition( 1 ) * nodePosition( 1 ) );
+                if( distance == 0.0 )
+                {
+                    cosineIntegrals( 0, 0 ) += nodeWeight;
+                    continue;
+                }
+                legendreCache.update( nodePosition( 2 ) / distance );
+
+                // Compute powers of distance, and multiples of longitude through recursion
+                radiusPowers[ 0 ] = 1.0;
+                cosinesOfLongitude[ 0 ] = 1.0;
+                sinesOfLongitude[ 0 ] = 0.0;
+                double cosineOfLongitude = ( horizontalDistance > 0.0 ) ? nodePosition( 0 ) / horizontalDistance : 1.0;
+                double sineOfLongitude = ( horizontalDistance > 0.0 ) ? nodePosition( 1 ) / horizontalDistance : 0.0;
+                for( int i = 1; i <= maximumDegree; i++ )
+                {
+                    radiusPowers[ i ] = radiusPowers[ i - 1 ] * distance / referenceRadius;
+                    cosinesOfLongitude[ i ] = cosinesOfLongitude[ i - 1 ] * cosineOfLongitude -
+                            sinesOfLongitude[ i - 1 ] * sineOfLongitude;
+                    sinesOfLongitude[ i ] = sinesOfLongitude[ i - 1 ] * cosineOfLongitude +
+                            cosinesOfLongitude[ i - 1 ] * sineOfLongitude;
+                }
+
+                for( int degree = 0; degree <= maximumDegree; degree++ )
+                {
+                    for( int order = 0; order <= degree; order++ )
+                    {
+                        double currentTerm = nodeWeight * radiusPowers[ degree ] *
+                                legendreCache.getLegendrePolynomial( degree, order );
+                        cosineIntegrals( degree, order ) += currentTerm * cosinesOfLongitude[ order ];
+                        sineIntegrals( degree, order ) += currentTerm * sinesOfLongitude[ order ];
+                    }
+                }
+            }
+        }
+    } );
+
+    // Sum partial integrals, and normalize by volume and degree
+    Eigen::MatrixXd cosineCoefficients = blockCosineIntegrals.at( 0 );
+    Eigen::MatrixXd sineCoefficients = blockSineIntegrals.at( 0 );
+    for( int i = 1; i < numberOfBlocks; i++ )
+    {
+        cosineCoefficients += blockCosineIntegrals.at( i );
+        sineCoefficients += blockSineIntegrals.at( i );
+    }
+
+    double volume = computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        cosineCoefficients.row( degree ) /= ( 2.0 * static_cast< double >( degree ) + 1.0 ) * volume;
+        sineCoefficients.row( degree ) /= ( 2.0 * static_cast< double >( degree ) + 1.0 ) * volume;
+        sineCoefficients( degree, 0 ) = 0.0;
+    }
+
+    return std::make_pair( cosineCoefficients, sineCoefficients );
+}
+
 } // namespace basic_astrodynamics
 } // namespace tudat
\ No newline at end of file
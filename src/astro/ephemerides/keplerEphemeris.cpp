@@ -11,6 +11,7 @@
 
 #include "tudat/astro/ephemerides/keplerEphemeris.h"
 #include "tudat/astro/basic_astro/astrodynamicsFunctions.h"
+#include "tudat/astro/basic_astro/batchKeplerPropagator.h"
 #include "tudat/astro/basic_astro/convertMeanToEccentricAnomalies.h"
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
 
@@ -31,6 +32,8 @@ KeplerEphemeris::KeplerEphemeris(
         const double rootFinderMaximumNumberOfIterations ):
     Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
     initialStateInKeplerianElements_( initialStateInKeplerianElements ),
+    rootFinderAbsoluteTolerance_( rootFinderAbsoluteTolerance ),
+    rootFinderMaximumNumberOfIterations_( rootFinderMaximumNumberOfIterations ),
     epochOfInitialState_( epochOfInitialState ),
     centralBodyGravitationalParameter_( centralBodyGravitationalParameter )
 {
@@ -123,11 +126,11 @@ Eigen::Vector6d KeplerEphemeris::getCartesianState(
                 convertElapsedTimeToEllipticalMeanAnomalyChange(
                     propagationTime, centralBodyGravitationalParameter_, semiMajorAxis_ );
 
-        // Compute eccentric anomaly for mean anomaly.
+        // Compute eccentric anomaly for mean anomaly (using root finder only if fixed iterations do not converge).
         eccentricAnomaly =
-                convertMeanAnomalyToEccentricAnomaly(
+                convertMeanAnomalyToEccentricAnomalyWithFixedIterations(
                     eccentricity_,
-                    initialMeanAnomaly_ + meanAnomalyChange );
+                    initialMeanAnomaly_ + meanAnomalyChange, 4, rootFinderAbsoluteTolerance_, rootFinder_ );
     }
     else
     {
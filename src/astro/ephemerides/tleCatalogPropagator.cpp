@@ -0,0 +1,518 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "tudat/astro/ephemerides/tleCatalogPropagator.h"
+#include "tudat/basics/utilities.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+namespace
+{
+
+// Physical constants of the SGP4 model (identical to those used in the Spice interface), in Earth radii and minutes.
+const double SGP4_J2 = 1.082616E-3;
+const double SGP4_J3 = -2.53881E-6;
+const double SGP4_J4 = -1.65597E-6;
+const double SGP4_KE = 7.43669161E-2;
+const double SGP4_Q0 = 120.0;
+const double SGP4_S0 = 78.0;
+const double SGP4_EARTH_RADIUS = 6378.135;
+
+const double SGP4_K2 = 0.5 * SGP4_J2;
+const double SGP4_K4 = -0.375 * SGP4_J4;
+const double SGP4_A3OVK2 = -SGP4_J3 / SGP4_K2;
+
+// Number of (step-limited) Newton iterations on Kepler's equation; sufficient for convergence to machine precision of
+// all near-Earth element sets.
+const int SGP4_NUMBER_OF_KEPLER_ITERATIONS = 10;
+
+// Indices of the epoch-independent SGP4 elements and coefficients in the TleCatalogPropagator.
+enum Sgp4CoefficientIndices
+{
+    tle_epoch_index,
+    b_star_index,
+    inclination_index,
+    right_ascension_index,
+    eccentricity_index,
+    argument_of_perigee_index,
+    mean_anomaly_index,
+    recovered_mean_motion_index,
+    recovered_semi_major_axis_index,
+    cos_inclination_index,
+    sin_inclination_index,
+    x3thm1_index,
+    x1mth2_index,
+    x7thm1_index,
+    eta_index,
+    c1_index,
+    c4_index,
+    c5_index,
+    mean_anomaly_rate_index,
+    argument_of_perigee_rate_index,
+    right_ascension_rate_index,
+    right_ascension_drag_coefficient_index,
+    argument_of_perigee_drag_coefficient_index,
+    mean_anomaly_drag_coefficient_index,
+    t2cof_index,
+    t3cof_index,
+    t4cof_index,
+    t5cof_index,
+    d2_index,
+    d3_index,
+    d4_index,
+    delmo_index,
+    sin_mean_anomaly_index,
+    xlcof_index,
+    aycof_index,
+    number_of_sgp4_coefficients
+};
+
+}
+
+//! Constructor
+TleCatalogPropagator::TleCatalogPropagator( const std::vector< std::shared_ptr< Tle > >& tles,
+                                            const bool allowDeepSpaceObjects ):
+    numberOfObjects_( static_cast< int >( tles.size( ) ) ),
+    coefficients_( static_cast< long long >( number_of_sgp4_coefficients ) * tles.size( ), 0.0 ),
+    isDeepSpaceObject_( tles.size( ), false )
+{
+    const double qoms2t = std::pow( ( SGP4_Q0 - SGP4_S0 ) / SGP4_EARTH_RADIUS, 4 );
+    const double s = 1.0 + SGP4_S0 / SGP4_EARTH_RADIUS;
+
+    for( int i = 0; i < numberOfObjects_; i++ )
+    {
+        if( tles.at( i ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating TLE catalog propagator, TLE " + std::to_string( i ) +
+                                      " is not defined." );
+        }
+
+        const double eccentricity = tles.at( i )->getEccentricity( );
+        const double inclination = tles.at( i )->getInclination( );
+        const double meanMotion = tles.at( i )->getMeanMotion( );
+        const double bStar = tles.at( i )->getBStar( );
+        const double argumentOfPerigee = tles.at( i )->getArgOfPerigee( );
+        const double meanAnomaly = tles.at( i )->getMeanAnomaly( );
+
+        if( !( eccentricity >= 0.0 && eccentricity < 1.0 ) || !( meanMotion > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating TLE catalog propagator, TLE " + std::to_string( i ) +
+                                      " has invalid eccentricity or mean motion." );
+        }
+
+        // Recover original mean motion and semi-major axis from input elements.
+        const double cosio = std::cos( inclination );
+        const double theta2 = cosio * cosio;
+        const double x3thm1 = 3.0 * theta2 - 1.0;
+        const double betao2 = 1.0 - eccentricity * eccentricity;
+        const double betao = std::sqrt( betao2 );
+        const double a1 = std::pow( SGP4_KE / meanMotion, 2.0 / 3.0 );
+        const double del1 = 1.5 * SGP4_K2 * x3thm1 / ( a1 * a1 * betao * betao2 );
+        const double ao = a1 * ( 1.0 - del1 * ( 1.0 / 3.0 + del1 * ( 1.0 + 134.0 / 81.0 * del1 ) ) );
+        const double delo = 1.5 * SGP4_K2 * x3thm1 / ( ao * ao * betao * betao2 );
+        const double xnodp = meanMotion / ( 1.0 + delo );
+        const double aodp = ao / ( 1.0 - delo );
+
+        isDeepSpaceObject_[ i ] = ( 2.0 * mathematical_constants::PI / xnodp >= 225.0 );
+        if( isDeepSpaceObject_[ i ] && !allowDeepSpaceObjects )
+        {
+            throw std::runtime_error( "Error when creating TLE catalog propagator, TLE " + std::to_string( i ) +
+                                      " requires the deep-space (SDP4) model, which is not yet implemented." );
+        }
+
+        // For perigee below 220 km, the drag equations are truncated to linear variation in sqrt( a ) and quadratic
+        // variation in mean anomaly.
+        const bool isSimplified = ( aodp * ( 1.0 - eccentricity ) < ( 220.0 / SGP4_EARTH_RADIUS + 1.0 ) );
+
+        // For perigee below 156 km, the values of s and qoms2t are altered.
+        double s4 = s;
+        double qoms24 = qoms2t;
+        const double perigeeHeight = ( aodp * ( 1.0 - eccentricity ) - 1.0 ) * SGP4_EARTH_RADIUS;
+        if( perigeeHeight < 156.0 )
+        {
+            s4 = ( perigeeHeight <= 98.0 ) ? 20.0 : perigeeHeight - SGP4_S0;
+            qoms24 = std::pow( ( SGP4_Q0 - s4 ) / SGP4_EARTH_RADIUS, 4 );
+            s4 = s4 / SGP4_EARTH_RADIUS + 1.0;
+        }
+
+        const double pinvsq = 1.0 / ( aodp * aodp * betao2 * betao2 );
+        const double tsi = 1.0 / ( aodp - s4 );
+        const double eta = aodp * eccentricity * tsi;
+        const double etasq = eta * eta;
+        const double eeta = eccentricity * eta;
+        const double psisq = std::fabs( 1.0 - etasq );
+        const double coef = qoms24 * std::pow( tsi, 4 );
+        const double coef1 = coef / std::pow( psisq, 3.5 );
+        const double c2 = coef1 * xnodp * ( aodp * ( 1.0 + 1.5 * etasq + eeta * ( 4.0 + etasq ) ) +
+                                            0.75 * SGP4_K2 * tsi / psisq * x3thm1 *
+                                            ( 8.0 + 3.0 * etasq * ( 8.0 + etasq ) ) );
+        const double c1 = bStar * c2;
+        const double sinio = std::sin( inclination );
+
+        // Terms that are singular for circular orbits are omitted for (near-)circular orbits (Vallado et al., 2006).
+        const bool isNearCircular = ( eccentricity <= 1.0E-4 );
+        const double c3 = isNearCircular ? 0.0 : coef * tsi * SGP4_A3OVK2 * xnodp * sinio / eccentricity;
+        const double x1mth2 = 1.0 - theta2;
+        const double c4 = 2.0 * xnodp * coef1 * aodp * betao2 *
+                ( eta * ( 2.0 + 0.5 * etasq ) + eccentricity * ( 0.5 + 2.0 * etasq ) -
+                  2.0 * SGP4_K2 * tsi / ( aodp * psisq ) *
+                  ( -3.0 * x3thm1 * ( 1.0 - 2.0 * eeta + etasq * ( 1.5 - 0.5 * eeta ) ) +
+                    0.75 * x1mth2 * ( 2.0 * etasq - eeta * ( 1.0 + etasq ) ) * std::cos( 2.0 * argumentOfPerigee ) ) );
+        const double c5 = 2.0 * coef1 * aodp * betao2 * ( 1.0 + 2.75 * ( etasq + eeta ) + eeta * etasq );
+
+        // Compute secular rates
+        const double theta4 = theta2 * theta2;
+        const double temp1 = 3.0 * SGP4_K2 * pinvsq * xnodp;
+        const double temp2 = temp1 * SGP4_K2 * pinvsq;
+        const double temp3 = 1.25 * SGP4_K4 * pinvsq * pinvsq * xnodp;
+        const double xmdot = xnodp + 0.5 * temp1 * betao * x3thm1 +
+                0.0625 * temp2 * betao * ( 13.0 - 78.0 * theta2 + 137.0 * theta4 );
+        const double omgdot = -0.5 * temp1 * ( 1.0 - 5.0 * theta2 ) +
+                0.0625 * temp2 * ( 7.0 - 114.0 * theta2 + 395.0 * theta4 ) +
+                temp3 * ( 3.0 - 36.0 * theta2 + 49.0 * theta4 );
+        const double xhdot1 = -temp1 * cosio;
+        const double xnodot = xhdot1 + ( 0.5 * temp2 * ( 4.0 - 19.0 * theta2 ) +
+                                         2.0 * temp3 * ( 3.0 - 7.0 * theta2 ) ) * cosio;
+
+        // Compute drag coefficients; higher-order terms are set to zero for the simplified model, so that both
+        // models are evaluated by the same (branch-free) equations.
+        const double omgcof = isSimplified ? 0.0 : bStar * c3 * std::cos( argumentOfPerigee );
+        const double xmcof = ( isSimplified || isNearCircular ) ? 0.0 : -2.0 / 3.0 * coef * bStar / eeta;
+        const double xnodcf = 3.5 * betao2 * xhdot1 * c1;
+        const double t2cof = 1.5 * c1;
+        const double xlcof = 0.125 * SGP4_A3OVK2 * sinio * ( 3.0 + 5.0 * cosio ) /
+                ( std::fabs( 1.0 + cosio ) > 1.5E-12 ? ( 1.0 + cosio ) : 1.5E-12 );
+        const double aycof = 0.25 * SGP4_A3OVK2 * sinio;
+        const double delmo = std::pow( 1.0 + eta * std::cos( meanAnomaly ), 3 );
+
+        double d2 = 0.0, d3 = 0.0, d4 = 0.0, t3cof = 0.0, t4cof = 0.0, t5cof = 0.0;
+        if( !isSimplified )
+        {
+            const double c1sq = c1 * c1;
+            d2 = 4.0 * aodp * tsi * c1sq;
+            const double temp = d2 * tsi * c1 / 3.0;
+            d3 = ( 17.0 * aodp + s4 ) * temp;
+            d4 = 0.5 * temp * aodp * tsi * ( 221.0 * aodp + 31.0 * s4 ) * c1;
+            t3cof = d2 + 2.0 * c1sq;
+            t4cof = 0.25 * ( 3.0 * d3 + c1 * ( 12.0 * d2 + 10.0 * c1sq ) );
+            t5cof = 0.2 * ( 3.0 * d4 + 12.0 * c1 * d3 + 6.0 * d2 * d2 + 15.0 * c1sq * ( 2.0 * d2 + c1sq ) );
+        }
+
+        auto setCoefficient = [ & ]( const int coefficientIndex, const double value )
+        {
+            coefficients_[ static_cast< long long >( coefficientIndex ) * numberOfObjects_ + i ] = value;
+        };
+        setCoefficient( tle_epoch_index, tles.at( i )->getEpoch( ) );
+        setCoefficient( b_star_index, bStar );
+        setCoefficient( inclination_index, inclination );
+        setCoefficient( right_ascension_index, tles.at( i )->getRightAscension( ) );
+        setCoefficient( eccentricity_index, eccentricity );
+        setCoefficient( argument_of_perigee_index, argumentOfPerigee );
+        setCoefficient( mean_anomaly_index, meanAnomaly );
+        setCoefficient( recovered_mean_motion_index, xnodp );
+        setCoefficient( recovered_semi_major_axis_index, aodp );
+        setCoefficient( cos_inclination_index, cosio );
+        setCoefficient( sin_inclination_index, sinio );
+        setCoefficient( x3thm1_index, x3thm1 );
+        setCoefficient( x1mth2_index, x1mth2 );
+        setCoefficient( x7thm1_index, 7.0 * theta2 - 1.0 );
+        setCoefficient( eta_index, eta );
+        setCoefficient( c1_index, c1 );
+        setCoefficient( c4_index, c4 );
+        setCoefficient( c5_index, isSimplified ? 0.0 : c5 );
+        setCoefficient( mean_anomaly_rate_index, xmdot );
+        setCoefficient( argument_of_perigee_rate_index, omgdot );
+        setCoefficient( right_ascension_rate_index, xnodot );
+        setCoefficient( right_ascension_drag_coefficient_index, xnodcf );
+        setCoefficient( argument_of_perigee_drag_coefficient_index, omgcof );
+        setCoefficient( mean_anomaly_drag_coefficient_index, xmcof );
+        setCoefficient( t2cof_index, t2cof );
+        setCoefficient( t3cof_index, t3cof );
+        setCoefficient( t4cof_index, t4cof );
+        setCoefficient( t5cof_index, t5cof );
+        setCoefficient( d2_index, d2 );
+        setCoefficient( d3_index, d3 );
+        setCoefficient( d4_index, d4 );
+        setCoefficient( delmo_index, delmo );
+        setCoefficient( sin_mean_anomaly_index, std::sin( meanAnomaly ) );
+        setCoefficient( xlcof_index, xlcof );
+        setCoefficient( aycof_index, aycof );
+    }
+}
+
+//! Function to propagate all objects to a list of epochs.
+void TleCatalogPropagator::propagateToEpochs( const std::vector< double >& epochs,
+                                              Eigen::Matrix< double, 6, Eigen::Dynamic >& states,
+                                              const std::string& frameOrientation,
+                                              const int numberOfThreads ) const
+{
+    if( frameOrientation != "TEME" && frameOrientation != "J2000" )
+    {
+        throw std::runtime_error( "Error, TLE catalog propagation to frame " + frameOrientation +
+                                  " is not supported (use TEME or J2000)." );
+    }
+    const bool rotateToJ2000 = ( frameOrientation == "J2000" );
+
+    // Compute frame rotation, which is identical for all objects, once per epoch.
+    const int numberOfEpochs = static_cast< int >( epochs.size( ) );
+    std::vector< Eigen::Matrix3d > temeToJ2000Rotations;
+    if( rotateToJ2000 )
+    {
+        temeToJ2000Rotations.resize( numberOfEpochs );
+        for( int j = 0; j < numberOfEpochs; j++ )
+        {
+            temeToJ2000Rotations[ j ] = getTemeToJ2000RotationMatrix( epochs[ j ] );
+        }
+    }
+
+    const long long numberOfColumns = static_cast< long long >( numberOfObjects_ ) * numberOfEpochs;
+    if( states.cols( ) != numberOfColumns )
+    {
+        states.resize( 6, numberOfColumns );
+    }
+
+    utilities::parallelForEachBlock(
+                numberOfObjects_, numberOfThreads,
+                [ & ]( const int startIndex, const int endIndex, const int )
+    {
+        double chunkStates[ 6 * TLE_CATALOG_CHUNK_SIZE ];
+        for( int chunkStart = startIndex; chunkStart < endIndex; chunkStart += TLE_CATALOG_CHUNK_SIZE )
+        {
+            const int chunkSize = std::min( TLE_CATALOG_CHUNK_SIZE, endIndex - chunkStart );
+            for( int j = 0; j < numberOfEpochs; j++ )
+            {
+                propagateChunkInTemeFrame( epochs[ j ], chunkStart, chunkSize, chunkStates );
+
+                // Convert to m and m/s, rotate to output frame, and store.
+                for( int k = 0; k < chunkSize; k++ )
+                {
+                    Eigen::Vector3d position, velocity;
+                    for( int l = 0; l < 3; l++ )
+                    {
+                        position( l ) = 1000.0 * chunkStates[ l * TLE_CATALOG_CHUNK_SIZE + k ];
+                        velocity( l ) = 1000.0 * chunkStates[ ( l + 3 ) * TLE_CATALOG_CHUNK_SIZE + k ];
+                    }
+
+                    const long long columnIndex = static_cast< long long >( chunkStart + k ) * numberOfEpochs + j;
+                    if( isDeepSpaceObject_[ chunkStart + k ] )
+                    {
+                        states.col( columnIndex ).setConstant( TUDAT_NAN );
+                    }
+                    else if( rotateToJ2000 )
+                    {
+                        states.block( 0, columnIndex, 3, 1 ) = temeToJ2000Rotations[ j ] * position;
+                        states.block( 3, columnIndex, 3, 1 ) = temeToJ2000Rotations[ j ] * velocity;
+                    }
+                    else
+                    {
+                        states.block( 0, columnIndex, 3, 1 ) = position;
+                        states.block( 3, columnIndex, 3, 1 ) = velocity;
+                    }
+                }
+            }
+        }
+    } );
+}
+
+//! Function to retrieve the state history of a single object from the output of propagateToEpochs.
+std::map< double, Eigen::Vector6d > TleCatalogPropagator::getObjectStateHistory(
+        const std::vector< double >& epochs,
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& states,
+        const int objectIndex ) const
+{
+    if( objectIndex < 0 || objectIndex >= numberOfObjects_ )
+    {
+        throw std::runtime_error( "Error when retrieving TLE catalog state history, object index " +
+                                  std::to_string( objectIndex ) + " is out of range." );
+    }
+    if( states.cols( ) != static_cast< long long >( numberOfObjects_ ) * static_cast< long long >( epochs.size( ) ) )
+    {
+        throw std::runtime_error( "Error when retrieving TLE catalog state history, size of states is inconsistent." );
+    }
+
+    std::map< double, Eigen::Vector6d > stateHistory;
+    for( unsigned int j = 0; j < epochs.size( ); j++ )
+    {
+        stateHistory[ epochs.at( j ) ] = states.col( static_cast< long long >( objectIndex ) * epochs.size( ) + j );
+    }
+    return stateHistory;
+}
+
+//! Function to propagate a chunk of objects to a single epoch, in the TEME frame.
+void TleCatalogPropagator::propagateChunkInTemeFrame( const double epoch, const int startIndex, const int chunkSize,
+                                                      double* chunkStates ) const
+{
+    const double* tleEpoch = getCoefficients( tle_epoch_index ) + startIndex;
+    const double* bStar = getCoefficients( b_star_index ) + startIndex;
+    const double* inclination = getCoefficients( inclination_index ) + startIndex;
+    const double* rightAscension = getCoefficients( right_ascension_index ) + startIndex;
+    const double* eccentricity = getCoefficients( eccentricity_index ) + startIndex;
+    const double* argumentOfPerigee = getCoefficients( argument_of_perigee_index ) + startIndex;
+    const double* meanAnomaly = getCoefficients( mean_anomaly_index ) + startIndex;
+    const double* xnodp = getCoefficients( recovered_mean_motion_index ) + startIndex;
+    const double* aodp = getCoefficients( recovered_semi_major_axis_index ) + startIndex;
+    const double* cosio = getCoefficients( cos_inclination_index ) + startIndex;
+    const double* sinio = getCoefficients( sin_inclination_index ) + startIndex;
+    const double* x3thm1 = getCoefficients( x3thm1_index ) + startIndex;
+    const double* x1mth2 = getCoefficients( x1mth2_index ) + startIndex;
+    const double* x7thm1 = getCoefficients( x7thm1_index ) + startIndex;
+    const double* eta = getCoefficients( eta_index ) + startIndex;
+    const double* c1 = getCoefficients( c1_index ) + startIndex;
+    const double* c4 = getCoefficients( c4_index ) + startIndex;
+    const double* c5 = getCoefficients( c5_index ) + startIndex;
+    const double* xmdot = getCoefficients( mean_anomaly_rate_index ) + startIndex;
+    const double* omgdot = getCoefficients( argument_of_perigee_rate_index ) + startIndex;
+    const double* xnodot = getCoefficients( right_ascension_rate_index ) + startIndex;
+    const double* xnodcf = getCoefficients( right_ascension_drag_coefficient_index ) + startIndex;
+    const double* omgcof = getCoefficients( argument_of_perigee_drag_coefficient_index ) + startIndex;
+    const double* xmcof = getCoefficients( mean_anomaly_drag_coefficient_index ) + startIndex;
+    const double* t2cof = getCoefficients( t2cof_index ) + startIndex;
+    const double* t3cof = getCoefficients( t3cof_index ) + startIndex;
+    const double* t4cof = getCoefficients( t4cof_index ) + startIndex;
+    const double* t5cof = getCoefficients( t5cof_index ) + startIndex;
+    const double* d2 = getCoefficients( d2_index ) + startIndex;
+    const double* d3 = getCoefficients( d3_index ) + startIndex;
+    const double* d4 = getCoefficients( d4_index ) + startIndex;
+    const double* delmo = getCoefficients( delmo_index ) + startIndex;
+    const double* sinmo = getCoefficients( sin_mean_anomaly_index ) + startIndex;
+    const double* xlcof = getCoefficients( xlcof_index ) + startIndex;
+    const double* aycof = getCoefficients( aycof_index ) + startIndex;
+
+    // Intermediate quantities of the chunk, passed between the (separately vectorizable) evaluation passes.
+    double semiMajorAxes[ TLE_CATALOG_CHUNK_SIZE ];
+    double rightAscensions[ TLE_CATALOG_CHUNK_SIZE ];
+    double axn[ TLE_CATALOG_CHUNK_SIZE ];
+    double ayn[ TLE_CATALOG_CHUNK_SIZE ];
+    double capu[ TLE_CATALOG_CHUNK_SIZE ];
+    double eccentricAnomalies[ TLE_CATALOG_CHUNK_SIZE ];
+
+    // Update for secular gravity, atmospheric drag and long-period periodics
+    for( int j = 0; j < chunkSize; j++ )
+    {
+        const double tsince = ( epoch - tleEpoch[ j ] ) / 60.0;
+
+        const double xmdf = meanAnomaly[ j ] + xmdot[ j ] * tsince;
+        const double omgadf = argumentOfPerigee[ j ] + omgdot[ j ] * tsince;
+        const double xnoddf = rightAscension[ j ] + xnodot[ j ] * tsince;
+        const double tsq = tsince * tsince;
+        const double xnode = xnoddf + xnodcf[ j ] * tsq;
+
+        const double delomg = omgcof[ j ] * tsince;
+        const double delmBase = 1.0 + eta[ j ] * std::cos( xmdf );
+        const double delm = xmcof[ j ] * ( delmBase * delmBase * delmBase - delmo[ j ] );
+        const double xmp = xmdf + delomg + delm;
+        const double omega = omgadf - delomg - delm;
+        const double tcube = tsq * tsince;
+        const double tfour = tsince * tcube;
+        const double tempa = 1.0 - c1[ j ] * tsince - d2[ j ] * tsq - d3[ j ] * tcube - d4[ j ] * tfour;
+        const double tempe = bStar[ j ] * ( c4[ j ] * tsince + c5[ j ] * ( std::sin( xmp ) - sinmo[ j ] ) );
+        const double templ = t2cof[ j ] * tsq + t3cof[ j ] * tcube + tfour * ( t4cof[ j ] + tsince * t5cof[ j ] );
+
+        const double a = aodp[ j ] * tempa * tempa;
+        const double e = eccentricity[ j ] - tempe;
+        const double xl = xmp + omega + xnode + xnodp[ j ] * templ;
+        const double betaSquared = 1.0 - e * e;
+
+        const double temp = 1.0 / ( a * betaSquared );
+        axn[ j ] = e * std::cos( omega );
+        ayn[ j ] = e * std::sin( omega ) + temp * aycof[ j ];
+        capu[ j ] = std::fmod( xl + temp * xlcof[ j ] * axn[ j ] - xnode, 2.0 * mathematical_constants::PI );
+        semiMajorAxes[ j ] = a;
+        rightAscensions[ j ] = xnode;
+    }
+
+    // Solve Kepler's equation, with a fixed number of step-limited Newton iterations (Vallado et al., 2006)
+    for( int j = 0; j < chunkSize; j++ )
+    {
+        double epw = capu[ j ];
+        for( int k = 0; k < SGP4_NUMBER_OF_KEPLER_ITERATIONS; k++ )
+        {
+            const double sinepw = std::sin( epw );
+            const double cosepw = std::cos( epw );
+            double step = ( capu[ j ] - ayn[ j ] * cosepw + axn[ j ] * sinepw - epw ) /
+                    ( 1.0 - axn[ j ] * cosepw - ayn[ j ] * sinepw );
+            step = std::max( -0.95, std::min( 0.95, step ) );
+            epw += step;
+        }
+        eccentricAnomalies[ j ] = epw;
+    }
+
+    // Compute short-period periodics and Cartesian state
+    for( int j = 0; j < chunkSize; j++ )
+    {
+        const double a = semiMajorAxes[ j ];
+        const double sinepw = std::sin( eccentricAnomalies[ j ] );
+        const double cosepw = std::cos( eccentricAnomalies[ j ] );
+        const double ecose = axn[ j ] * cosepw + ayn[ j ] * sinepw;
+        const double esine = axn[ j ] * sinepw - ayn[ j ] * cosepw;
+        const double elsq = axn[ j ] * axn[ j ] + ayn[ j ] * ayn[ j ];
+        const double pl = a * ( 1.0 - elsq );
+        const double r = a * ( 1.0 - ecose );
+        const double rdot = SGP4_KE * std::sqrt( a ) * esine / r;
+        const double rfdot = SGP4_KE * std::sqrt( pl ) / r;
+        const double betal = std::sqrt( 1.0 - elsq );
+        const double esineFactor = esine / ( 1.0 + betal );
+        const double cosu = a / r * ( cosepw - axn[ j ] + ayn[ j ] * esineFactor );
+        const double sinu = a / r * ( sinepw - ayn[ j ] - axn[ j ] * esineFactor );
+        const double u = std::atan2( sinu, cosu );
+        const double sin2u = 2.0 * sinu * cosu;
+        const double cos2u = 2.0 * cosu * cosu - 1.0;
+        const double temp1 = SGP4_K2 / pl;
+        const double temp2 = temp1 / pl;
+        const double xn = SGP4_KE / std::pow( a, 1.5 );
+
+        const double rk = r * ( 1.0 - 1.5 * temp2 * betal * x3thm1[ j ] ) + 0.5 * temp1 * x1mth2[ j ] * cos2u;
+        const double uk = u - 0.25 * temp2 * x7thm1[ j ] * sin2u;
+        const double xnodek = rightAscensions[ j ] + 1.5 * temp2 * cosio[ j ] * sin2u;
+        const double xinck = inclination[ j ] + 1.5 * temp2 * cosio[ j ] * sinio[ j ] * cos2u;
+        const double rdotk = rdot - xn * temp1 * x1mth2[ j ] * sin2u;
+        const double rfdotk = rfdot + xn * temp1 * ( x1mth2[ j ] * cos2u + 1.5 * x3thm1[ j ] );
+
+        // Compute orientation vectors
+        const double sinuk = std::sin( uk );
+        const double cosuk = std::cos( uk );
+        const double sinik = std::sin( xinck );
+        const double cosik = std::cos( xinck );
+        const double sinnok = std::sin( xnodek );
+        const double cosnok = std::cos( xnodek );
+        const double xmx = -sinnok * cosik;
+        const double xmy = cosnok * cosik;
+        const double ux = xmx * sinuk + cosnok * cosuk;
+        const double uy = xmy * sinuk + sinnok * cosuk;
+        const double uz = sinik * sinuk;
+        const double vx = xmx * cosuk - cosnok * sinuk;
+        const double vy = xmy * cosuk - sinnok * sinuk;
+        const double vz = sinik * cosuk;
+
+        // Convert from Earth radii (per minute) to km (per second)
+        const double positionScaling = rk * SGP4_EARTH_RADIUS;
+        const double velocityScaling = SGP4_EARTH_RADIUS / 60.0;
+        chunkStates[ j ] = positionScaling * ux;
+        chunkStates[ TLE_CATALOG_CHUNK_SIZE + j ] = positionScaling * uy;
+        chunkStates[ 2 * TLE_CATALOG_CHUNK_SIZE + j ] = positionScaling * uz;
+        chunkStates[ 3 * TLE_CATALOG_CHUNK_SIZE + j ] = velocityScaling * ( rdotk * ux + rfdotk * vx );
+        chunkStates[ 4 * TLE_CATALOG_CHUNK_SIZE + j ] = velocityScaling * ( rdotk * uy + rfdotk * vy );
+        chunkStates[ 5 * TLE_CATALOG_CHUNK_SIZE + j ] = velocityScaling * ( rdotk * uz + rfdotk * vz );
+    }
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -22,6 +22,19 @@ namespace tudat
 namespace ephemerides
 {
 
+	Eigen::Matrix3d getTemeToJ2000RotationMatrix( const double secondsSinceEpoch )
+	{
+		// First, rotate to the True Of Date (TOD) frame, by rotating around pole (z-axis) over the equation of the equinoxes.
+		double equationOfEquinoxes = sofa_interface::calculateEquationOfEquinoxes( secondsSinceEpoch );
+		Eigen::Matrix3d temeToTodRotation =
+				Eigen::AngleAxisd( equationOfEquinoxes, Eigen::Vector3d::UnitZ( ) ).toRotationMatrix( );
+
+		// Then, multiply by the inverse of the combined precession + nutation matrix from Sofa (according to the 1976/1980
+		// model) to get to J2000.
+		Eigen::Matrix3d precessionNutationMatrix = sofa_interface::getPrecessionNutationMatrix( secondsSinceEpoch );
+		return precessionNutationMatrix.transpose( ) * temeToTodRotation;
+	}
+
 	TleEphemeris::TleEphemeris( const std::string &referenceFrameOrigin, const std::string &referenceFrameOrientation,
 							   const std::shared_ptr< Tle > tle_ptr, const bool useSDP ) :
 							   Ephemeris( referenceFrameOrigin, referenceFrameOrientation )
@@ -52,28 +65,10 @@ namespace ephemerides
 		Eigen::Vector3d positionTEME = cartesianStateAtEpochTEME.head( 3 );
 		Eigen::Vector3d velocityTEME = cartesianStateAtEpochTEME.tail( 3 );
 
-		// First, rotate to the True Of Date (TOD) frame.
-		double equationOfEquinoxes = sofa_interface::calculateEquationOfEquinoxes( secondsSinceEpoch );
-
-		// Rotate around pole (z-axis)
-		Eigen::AngleAxisd rotationObject = Eigen::AngleAxisd( equationOfEquinoxes, Eigen::Vector3d::UnitZ( ) );
-		Eigen::Vector3d positionTOD = rotationObject.toRotationMatrix( ) * positionTEME;
-		Eigen::Vector3d velocityTOD = rotationObject.toRotationMatrix( ) * velocityTEME;
-
-		// These angles (zeta, z, and theta) do not really have descriptive names. For a description of the precession geometry and these angles,
-		// see pages 226-228 and figure 3-31 in Vallado (2013).
-		double precessionAngleModToGcrfZeta;
-		double precessionAngleModToGcrfZ;
-		double precessionAngleModToGcrfTheta;
-		sofa_interface::getPrecessionAngles(precessionAngleModToGcrfZeta, precessionAngleModToGcrfZ, precessionAngleModToGcrfTheta,
-				secondsSinceEpoch );
-
-		// Now that we have our state vector in the TOD frame, we need to obtain the combined precession + nutation matrix from Sofa
-		// (according to the 1976/1980 model)
-		Eigen::Matrix3d precessionNutationMatrix = sofa_interface::getPrecessionNutationMatrix( secondsSinceEpoch );
-		// Multiply by inverted matrix to get to J2000
-		Eigen::Vector3d  positionJ2000 = precessionNutationMatrix.transpose( ) * positionTOD;
-		Eigen::Vector3d  velocityJ2000 = precessionNutationMatrix.transpose( ) * velocityTOD;
+		// Rotate to the J2000 frame, through the True Of Date (TOD) frame.
+		Eigen::Matrix3d temeToJ2000Rotation = getTemeToJ2000RotationMatrix( secondsSinceEpoch );
+		Eigen::Vector3d  positionJ2000 = temeToJ2000Rotation * positionTEME;
+		Eigen::Vector3d  velocityJ2000 = temeToJ2000Rotation * velocityTEME;
 
 		if( referenceFrameOrientation_ == "J2000" )
 		{
@@ -29,14 +29,44 @@ void PolyhedronGravityCache::update (const Eigen::Vector3d& currentBodyFixedPosi
 
         // Compute per-facet factor
         basic_mathematics::calculatePolyhedronPerFacetFactor(
-                currentPerFacetFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachFacet_);
+                currentPerFacetFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachFacet_,
+                numberOfThreads_, threadPool_.get( ) );
 
         // Compute per-edge factor
         basic_mathematics::calculatePolyhedronPerEdgeFactor(
-                currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachEdge_);
+                currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachEdge_,
+                numberOfThreads_, threadPool_.get( ) );
     }
 }
 
+void PolyhedronGravityField::setFarFieldSphericalHarmonicExpansion( const int maximumDegree,
+                                                                    const double switchRadius,
+                                                                    const double transitionWidth )
+{
+    // Reference radius of expansion is radius of Brillouin sphere
+    double brillouinSphereRadius = verticesCoordinates_.rowwise( ).norm( ).maxCoeff( );
+    if( switchRadius < brillouinSphereRadius )
+    {
+        throw std::runtime_error( "Error when setting far-field spherical harmonic expansion of polyhedron, switch radius (" +
+                                  std::to_string( switchRadius ) + ") is inside Brillouin sphere (radius " +
+                                  std::to_string( brillouinSphereRadius ) + ")." );
+    }
+    if( transitionWidth < 0.0 )
+    {
+        throw std::runtime_error( "Error when setting far-field spherical harmonic expansion of polyhedron, transition width is negative." );
+    }
+
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients =
+            basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                verticesCoordinates_, verticesDefiningEachFacet_, maximumDegree, brillouinSphereRadius, numberOfThreads_ );
+
+    farFieldCosineCoefficients_ = coefficients.first;
+    farFieldSineCoefficients_ = coefficients.second;
+    farFieldReferenceRadius_ = brillouinSphereRadius;
+    farFieldSwitchRadius_ = switchRadius;
+    farFieldTransitionWidth_ = transitionWidth;
+}
+
 void PolyhedronGravityField::computeVerticesAndFacetsDefiningEachEdge ( )
 {
     const unsigned int numberOfVertices = verticesCoordinates_.rows();
@@ -110,7 +140,8 @@ void PolyhedronGravityField::computeFacetNormalsAndDyads ( )
     const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows();
 
     facetNormalVectors_.resize(numberOfFacets);
-    facetDyads_.resize(numberOfFacets);
+    std::shared_ptr< basic_mathematics::PackedPolyhedronDyads > packedFacetDyads =
+            std::make_shared< basic_mathematics::PackedPolyhedronDyads >( numberOfFacets, 6 );
 
     // Loop over facets, and for each facet compute the facet normal and the facet dyad
     for (unsigned int facet = 0; facet < numberOfFacets; ++facet)
@@ -123,9 +154,11 @@ void PolyhedronGravityField::computeFacetNormalsAndDyads ( )
         facetNormalVectors_.at(facet) = (vertex1 - vertex0).cross(vertex2 - vertex1);
         facetNormalVectors_.at(facet).normalize();
 
-        // Compute facet dyad (outer product)
-        facetDyads_.at(facet) = facetNormalVectors_.at(facet) * facetNormalVectors_.at(facet).transpose();
+        // Compute facet dyad (outer product), and store its upper triangular part
+        Eigen::Matrix3d facetDyad = facetNormalVectors_.at(facet) * facetNormalVectors_.at(facet).transpose();
+        basic_mathematics::packPolyhedronDyad( *packedFacetDyads, facet, facetDyad );
     }
+    packedFacetDyads_ = packedFacetDyads;
 
 }
 
@@ -133,7 +166,8 @@ void PolyhedronGravityField::computeEdgeDyads ( )
 {
     const unsigned int numberOfEdges = verticesDefiningEachEdge_.rows();
 
-    edgeDyads_.resize(numberOfEdges);
+    std::shared_ptr< basic_mathematics::PackedPolyhedronDyads > packedEdgeDyads =
+            std::make_shared< basic_mathematics::PackedPolyhedronDyads >( numberOfEdges, 6 );
 
     // Loop over edges, and for each edge compute the edge dyad
     for (unsigned int edge = 0; edge < numberOfEdges; ++edge)
@@ -178,10 +212,12 @@ void PolyhedronGravityField::computeEdgeDyads ( )
             edgeNormalFacetA = - edgeNormalFacetA;
         }
 
-        // Compute edge dyads: outer product
-        edgeDyads_.at(edge) = facetNormalFacetA * edgeNormalFacetA.transpose() + facetNormalFacetB * edgeNormalFacetB.transpose();
+        // Compute edge dyads: outer product (symmetric, so only upper triangular part is stored)
+        Eigen::Matrix3d edgeDyad = facetNormalFacetA * edgeNormalFacetA.transpose() + facetNormalFacetB * edgeNormalFacetB.transpose();
+        basic_mathematics::packPolyhedronDyad( *packedEdgeDyads, edge, edgeDyad );
 
     }
+    packedEdgeDyads_ = packedEdgeDyads;
 }
 
 } // namespace gravitation
@@ -10,6 +10,7 @@
  */
 
 #include "tudat/astro/gravitation/polyhedronGravityModel.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
 
 
 namespace tudat
@@ -17,6 +18,48 @@ namespace tudat
 namespace gravitation
 {
 
+void PolyhedronGravitationalAccelerationModel::initializePolyhedronData( )
+{
+    // Polyhedron shape is constant (as assumed by polyhedron cache), so retrieve it only once
+    verticesDefiningEachFacet_ = getVerticesDefiningEachFacet_( );
+    verticesDefiningEachEdge_ = getVerticesDefiningEachEdge_( );
+    if( packedFacetDyads_ == nullptr || packedEdgeDyads_ == nullptr )
+    {
+        throw std::runtime_error( "Error when creating polyhedron acceleration model, no facet or edge dyads provided." );
+    }
+}
+
+void PolyhedronGravitationalAccelerationModel::setFarFieldSphericalHarmonicExpansion(
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const double referenceRadius,
+        const double switchRadius,
+        const double transitionWidth )
+{
+    if( cosineCoefficients.rows( ) != sineCoefficients.rows( ) || cosineCoefficients.cols( ) != sineCoefficients.cols( ) )
+    {
+        throw std::runtime_error( "Error when setting far-field spherical harmonic expansion of polyhedron acceleration, "
+                                  "cosine and sine coefficients have inconsistent sizes." );
+    }
+    if( transitionWidth < 0.0 )
+    {
+        throw std::runtime_error( "Error when setting far-field spherical harmonic expansion of polyhedron acceleration, "
+                                  "transition width is negative." );
+    }
+
+    farFieldCosineCoefficients_ = cosineCoefficients;
+    farFieldSineCoefficients_ = sineCoefficients;
+    farFieldReferenceRadius_ = referenceRadius;
+    farFieldSwitchRadius_ = switchRadius;
+    farFieldTransitionWidth_ = transitionWidth;
+
+    farFieldSphericalHarmonicsCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+    farFieldSphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
+                cosineCoefficients.rows( ), cosineCoefficients.cols( ) + 1 );
+
+    this->currentTime_ = TUDAT_NAN;
+}
+
 void PolyhedronGravitationalAccelerationModel::updateMembers( const double currentTime )
 {
     if( !( this->currentTime_ == currentTime ) )
@@ -31,46 +74,124 @@ void PolyhedronGravitationalAccelerationModel::updateMembers( const double curre
 
         currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * currentInertialRelativePosition_;
 
-        polyhedronCache_->update( currentRelativePosition_ );
+        // Compute weight of far-field expansion (smoothstep in distance over transition region)
+        currentFarFieldWeight_ = 0.0;
+        currentFarFieldWeightGradient_.setZero( );
+        if( farFieldSphericalHarmonicsCache_ != nullptr )
+        {
+            double distance = currentRelativePosition_.norm( );
+            if( farFieldTransitionWidth_ == 0.0 )
+            {
+                currentFarFieldWeight_ = ( distance >= farFieldSwitchRadius_ ) ? 1.0 : 0.0;
+            }
+            else
+            {
+                double transitionFraction = ( distance - farFieldSwitchRadius_ ) / farFieldTransitionWidth_;
+                if( transitionFraction >= 1.0 )
+                {
+                    currentFarFieldWeight_ = 1.0;
+                }
+                else if( transitionFraction > 0.0 )
+                {
+                    currentFarFieldWeight_ = transitionFraction * transitionFraction * ( 3.0 - 2.0 * transitionFraction );
+                    currentFarFieldWeightGradient_ = 6.0 * transitionFraction * ( 1.0 - transitionFraction ) /
+                            farFieldTransitionWidth_ * currentRelativePosition_ / distance;
+                }
+            }
+        }
+
+        const double gravitationalParameter = gravitationalParameterFunction_( );
+
+        // Compute the current polyhedron acceleration, if required
+        if( currentFarFieldWeight_ < 1.0 )
+        {
+            polyhedronCache_->update( currentRelativePosition_ );
+
+            currentPolyhedronAccelerationInBodyFixedFrame_ =
+                    basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                        gravitationalParameter / volumeFunction_(),
+                        polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint(),
+                        verticesDefiningEachFacet_,
+                        verticesDefiningEachEdge_,
+                        *packedFacetDyads_,
+                        *packedEdgeDyads_,
+                        polyhedronCache_->getPerFacetFactor(),
+                        polyhedronCache_->getPerEdgeFactor(),
+                        numberOfThreads_,
+                        threadPool_.get( ) );
+        }
+
+        // Compute the current far-field acceleration, if required
+        if( currentFarFieldWeight_ > 0.0 )
+        {
+            std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+            currentFarFieldAccelerationInBodyFixedFrame_ = computeGeodesyNormalizedGravitationalAccelerationSum(
+                        currentRelativePosition_, gravitationalParameter, farFieldReferenceRadius_,
+                        farFieldCosineCoefficients_, farFieldSineCoefficients_, farFieldSphericalHarmonicsCache_,
+                        dummyMap );
+        }
 
-        // Compute the current acceleration
-        currentAccelerationInBodyFixedFrame_ = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
-                gravitationalParameterFunction_() / volumeFunction_(),
-                polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                getVerticesDefiningEachFacet_(),
-                getVerticesDefiningEachEdge_(),
-                getFacetDyads_(),
-                getEdgeDyads_(),
-                polyhedronCache_->getPerFacetFactor(),
-                polyhedronCache_->getPerEdgeFactor() );
+        if( currentFarFieldWeight_ == 0.0 )
+        {
+            currentAccelerationInBodyFixedFrame_ = currentPolyhedronAccelerationInBodyFixedFrame_;
+        }
+        else if( currentFarFieldWeight_ == 1.0 )
+        {
+            currentAccelerationInBodyFixedFrame_ = currentFarFieldAccelerationInBodyFixedFrame_;
+        }
+        else
+        {
+            currentAccelerationInBodyFixedFrame_ =
+                    ( 1.0 - currentFarFieldWeight_ ) * currentPolyhedronAccelerationInBodyFixedFrame_ +
+                    currentFarFieldWeight_ * currentFarFieldAccelerationInBodyFixedFrame_;
+        }
 
         currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
 
         // Compute the current gravitational potential
         if ( updatePotential_ )
         {
-            currentPotential_ = basic_mathematics::calculatePolyhedronGravitationalPotential(
-                    gravitationalParameterFunction_( ) / volumeFunction_( ),
-                    polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                    getVerticesDefiningEachFacet_( ),
-                    getVerticesDefiningEachEdge_( ),
-                    getFacetDyads_( ),
-                    getEdgeDyads_( ),
-                    polyhedronCache_->getPerFacetFactor( ),
-                    polyhedronCache_->getPerEdgeFactor( ) );
+            double polyhedronPotential = 0.0;
+            double farFieldPotential = 0.0;
+            if( currentFarFieldWeight_ < 1.0 )
+            {
+                polyhedronPotential = basic_mathematics::calculatePolyhedronGravitationalPotential(
+                        gravitationalParameter / volumeFunction_( ),
+                        polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
+                        verticesDefiningEachFacet_,
+                        verticesDefiningEachEdge_,
+                        *packedFacetDyads_,
+                        *packedEdgeDyads_,
+                        polyhedronCache_->getPerFacetFactor( ),
+                        polyhedronCache_->getPerEdgeFactor( ),
+                        numberOfThreads_,
+                        threadPool_.get( ) );
+            }
+            if( currentFarFieldWeight_ > 0.0 )
+            {
+                farFieldPotential = calculateSphericalHarmonicGravitationalPotential(
+                            currentRelativePosition_, gravitationalParameter, farFieldReferenceRadius_,
+                            farFieldCosineCoefficients_, farFieldSineCoefficients_, farFieldSphericalHarmonicsCache_ );
+            }
+            currentPotential_ = ( 1.0 - currentFarFieldWeight_ ) * polyhedronPotential +
+                    currentFarFieldWeight_ * farFieldPotential;
         }
 
-        // Compute the current laplacian
+        // Compute the current laplacian (zero for the far-field expansion)
         if ( updateLaplacianOfPotential_ )
         {
-            currentLaplacianOfPotential_ = basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
-                    gravitationalParameterFunction_( ) / volumeFunction_( ),
-                    polyhedronCache_->getPerFacetFactor( ) );
+            currentLaplacianOfPotential_ = 0.0;
+            if( currentFarFieldWeight_ < 1.0 )
+            {
+                currentLaplacianOfPotential_ = ( 1.0 - currentFarFieldWeight_ ) *
+                        basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
+                            gravitationalParameter / volumeFunction_( ),
+                            polyhedronCache_->getPerFacetFactor( ) );
+            }
         }
     }
 }
 
-
 } // namespace gravitation
 
 } // namespace tudat
@@ -14,6 +14,7 @@
  *
  */
 
+#include <algorithm>
 #include <iomanip>
 
 #include "tudat/astro/basic_astro/physicalConstants.h"
@@ -68,22 +69,30 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
     Eigen::Matrix3d transformationToCartesianCoordinates = coordinate_conversions::getSphericalToCartesianGradientMatrix(
                 positionOfBodySubjectToAcceleration );
 
-    // Loop through all degrees.
-    for ( int degree = 0; degree < highestDegree; degree++ )
+    if( !saveSeparateTerms )
     {
-        // Loop through all orders.
-        for ( int order = 0; ( order <= degree ) && ( order < highestOrder ); order++ )
+        // Sum all terms, reading the Legendre polynomials directly from the packed cache
+        sphericalGradient = computeGeodesyNormalizedPotentialGradientSum(
+                    sphericalpositionOfBodySubjectToAcceleration, preMultiplier,
+                    cosineHarmonicCoefficients, sineHarmonicCoefficients,
+                    *legendreCacheReference, *sphericalHarmonicsCache );
+    }
+    else
+    {
+        // Loop through all degrees.
+        for ( int degree = 0; degree < highestDegree; degree++ )
         {
-            // Compute geodesy-normalized Legendre polynomials.
-            const double legendrePolynomial = legendreCacheReference->getLegendrePolynomial( degree, order );
+            // Loop through all orders.
+            for ( int order = 0; ( order <= degree ) && ( order < highestOrder ); order++ )
+            {
+                // Compute geodesy-normalized Legendre polynomials.
+                const double legendrePolynomial = legendreCacheReference->getLegendrePolynomial( degree, order );
 
-            // Compute geodesy-normalized Legendre polynomial derivative.
-            const double legendrePolynomialDerivative = legendreCacheReference->getLegendrePolynomialDerivative(
-                        degree, order );
+                // Compute geodesy-normalized Legendre polynomial derivative.
+                const double legendrePolynomialDerivative = legendreCacheReference->getLegendrePolynomialDerivative(
+                            degree, order );
 
-            // Compute the potential gradient of a single spherical harmonic term.
-            if( saveSeparateTerms )
-            {
+                // Compute the potential gradient of a single spherical harmonic term.
                 accelerationPerTerm[ std::make_pair( degree, order ) ] =
                         basic_mathematics::computePotentialGradient(
                             sphericalpositionOfBodySubjectToAcceleration,
@@ -99,28 +108,190 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
                         accelerationRotation * (
                             transformationToCartesianCoordinates * accelerationPerTerm[ std::make_pair( degree, order ) ] );
             }
-            else
-            {
-                // Compute the potential gradient of a single spherical harmonic term.
-                sphericalGradient += basic_mathematics::computePotentialGradient(
-                            sphericalpositionOfBodySubjectToAcceleration,
-                            preMultiplier,
-                            degree,
-                            order,
-                            cosineHarmonicCoefficients( degree, order ),
-                            sineHarmonicCoefficients( degree, order ),
-                            legendrePolynomial,
-                            legendrePolynomialDerivative, sphericalHarmonicsCache );
-            }
         }
     }
 
-
     // Convert from spherical gradient to Cartesian gradient (which equals acceleration vector) and
     // return the resulting acceleration vector.
     return accelerationRotation * ( transformationToCartesianCoordinates * sphericalGradient );
 }
 
+//! Compute gravitational accelerations due to multiple spherical harmonics terms, defined using geodesy-normalization,
+//! for a batch of positions.
+void computeGeodesyNormalizedGravitationalAccelerationSumBatch(
+        const Eigen::Matrix3Xd& positionsOfBodiesSubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsBatchCache > batchCache,
+        Eigen::Matrix3Xd& accelerations,
+        const Eigen::Matrix3d& accelerationRotation )
+{
+    typedef basic_mathematics::SphericalHarmonicsBatchCache::LaneArray LaneArray;
+    const int numberOfLanes = basic_mathematics::SphericalHarmonicsBatchCache::numberOfLanes;
+
+    // Set highest degree and order, and reset cache if needed
+    const int highestDegree = static_cast< int >( cosineHarmonicCoefficients.rows( ) ) - 1;
+    const int highestOrder = std::min( static_cast< int >( cosineHarmonicCoefficients.cols( ) ) - 1, highestDegree );
+    if( batchCache->getMaximumDegree( ) != highestDegree || batchCache->getMaximumOrder( ) != highestOrder )
+    {
+        batchCache->resetMaximumDegreeAndOrder( highestDegree, highestOrder );
+    }
+    const int highestPolynomialOrder = batchCache->getMaximumPolynomialOrder( );
+
+    const int numberOfPositions = static_cast< int >( positionsOfBodiesSubjectToAcceleration.cols( ) );
+    accelerations.resize( 3, numberOfPositions );
+
+    // Compute gradient premultiplier.
+    const double preMultiplier = gravitationalParameter / equatorialRadius;
+
+    basic_mathematics::SphericalHarmonicsBatchCache::LaneArrayList& currentLegendreValues =
+            batchCache->currentDegreeLegendreValues_;
+    basic_mathematics::SphericalHarmonicsBatchCache::LaneArrayList& previousLegendreValues =
+            batchCache->previousDegreeLegendreValues_;
+    basic_mathematics::SphericalHarmonicsBatchCache::LaneArrayList& secondPreviousLegendreValues =
+            batchCache->secondPreviousDegreeLegendreValues_;
+    basic_mathematics::SphericalHarmonicsBatchCache::LaneArrayList& cosinesOfLongitude = batchCache->cosinesOfLongitude_;
+    basic_mathematics::SphericalHarmonicsBatchCache::LaneArrayList& sinesOfLongitude = batchCache->sinesOfLongitude_;
+
+    LaneArray x, y, z;
+    for( int blockStart = 0; blockStart < numberOfPositions; blockStart += numberOfLanes )
+    {
+        // Retrieve positions of current block; unused lanes are filled with the last position, and discarded.
+        const int numberOfActiveLanes = std::min( numberOfLanes, numberOfPositions - blockStart );
+        for( int lane = 0; lane < numberOfLanes; lane++ )
+        {
+            const int column = blockStart + std::min( lane, numberOfActiveLanes - 1 );
+            x( lane ) = positionsOfBodiesSubjectToAcceleration( 0, column );
+            y( lane ) = positionsOfBodiesSubjectToAcceleration( 1, column );
+            z( lane ) = positionsOfBodiesSubjectToAcceleration( 2, column );
+        }
+
+        // Compute spherical position and trigonometric functions of latitude.
+        const LaneArray xyDistanceSquared = x * x + y * y;
+        const LaneArray xyDistance = xyDistanceSquared.sqrt( );
+        const LaneArray radius = ( xyDistanceSquared + z * z ).sqrt( );
+        const LaneArray sineOfLatitude = z / radius;
+        const LaneArray cosineOfLatitude = ( 1.0 - sineOfLatitude * sineOfLatitude ).sqrt( );
+        const LaneArray oneOverCosineOfLatitude = cosineOfLatitude.inverse( );
+        const LaneArray radiusRatio = equatorialRadius / radius;
+
+        // Compute sines and cosines of multiples of the longitude through angle-addition recurrence.
+        cosinesOfLongitude[ 0 ].setOnes( );
+        sinesOfLongitude[ 0 ].setZero( );
+        if( highestOrder > 0 )
+        {
+            cosinesOfLongitude[ 1 ] = x / xyDistance;
+            sinesOfLongitude[ 1 ] = y / xyDistance;
+            for( int order = 2; order <= highestOrder; order++ )
+            {
+                cosinesOfLongitude[ order ] = cosinesOfLongitude[ order - 1 ] * cosinesOfLongitude[ 1 ] -
+                        sinesOfLongitude[ order - 1 ] * sinesOfLongitude[ 1 ];
+                sinesOfLongitude[ order ] = sinesOfLongitude[ order - 1 ] * cosinesOfLongitude[ 1 ] +
+                        cosinesOfLongitude[ order - 1 ] * sinesOfLongitude[ 1 ];
+            }
+        }
+
+        for( int order = 0; order <= highestPolynomialOrder; order++ )
+        {
+            previousLegendreValues[ order ].setZero( );
+            secondPreviousLegendreValues[ order ].setZero( );
+        }
+
+        // Initialize gradient components and (reference radius / radius)^(degree+1)
+        LaneArray radialGradient = LaneArray::Zero( );
+        LaneArray latitudeGradient = LaneArray::Zero( );
+        LaneArray longitudeGradient = LaneArray::Zero( );
+        LaneArray radiusRatioPower = radiusRatio;
+
+        LaneArray radialSum, latitudeSum, longitudeSum;
+        LaneArray cosineTerm, sineTerm, legendreDerivative;
+
+        // Loop through all degrees.
+        for( int degree = 0; degree <= highestDegree; degree++ )
+        {
+            const int maximumPolynomialOrderAtDegree = std::min( degree, highestPolynomialOrder );
+
+            // Compute Legendre polynomials at current degree, using degree (vertical) and sectoral (diagonal) recursion.
+            for( int order = 0; order <= maximumPolynomialOrderAtDegree; order++ )
+            {
+                if( order < degree )
+                {
+                    currentLegendreValues[ order ] =
+                            batchCache->getFirstVerticalMultiplier( degree, order ) * sineOfLatitude *
+                            previousLegendreValues[ order ] -
+                            batchCache->getSecondVerticalMultiplier( degree, order ) * secondPreviousLegendreValues[ order ];
+                }
+                else if( degree == 0 )
+                {
+                    currentLegendreValues[ order ].setOnes( );
+                }
+                else
+                {
+                    currentLegendreValues[ order ] =
+                            batchCache->getDiagonalMultiplier( degree ) * cosineOfLatitude *
+                            previousLegendreValues[ order - 1 ];
+                }
+            }
+
+            // Sum contributions of all orders at current degree.
+            radialSum.setZero( );
+            latitudeSum.setZero( );
+            longitudeSum.setZero( );
+            for( int order = 0; order <= std::min( degree, highestOrder ); order++ )
+            {
+                const double cosineCoefficient = cosineHarmonicCoefficients( degree, order );
+                const double sineCoefficient = sineHarmonicCoefficients( degree, order );
+
+                cosineTerm = cosineCoefficient * cosinesOfLongitude[ order ] + sineCoefficient * sinesOfLongitude[ order ];
+                sineTerm = sineCoefficient * cosinesOfLongitude[ order ] - cosineCoefficient * sinesOfLongitude[ order ];
+
+                // Compute derivative of Legendre polynomial w.r.t. sine of latitude.
+                legendreDerivative = -static_cast< double >( order ) * sineOfLatitude *
+                        oneOverCosineOfLatitude * oneOverCosineOfLatitude * currentLegendreValues[ order ];
+                if( order < maximumPolynomialOrderAtDegree )
+                {
+                    legendreDerivative += batchCache->getDerivativeNormalization( degree, order ) *
+                            currentLegendreValues[ order + 1 ] * oneOverCosineOfLatitude;
+                }
+
+                radialSum += currentLegendreValues[ order ] * cosineTerm;
+                latitudeSum += legendreDerivative * cosineTerm;
+                longitudeSum += static_cast< double >( order ) * currentLegendreValues[ order ] * sineTerm;
+            }
+
+            radialGradient -= static_cast< double >( degree + 1 ) * radiusRatioPower * radialSum;
+            latitudeGradient += radiusRatioPower * latitudeSum;
+            longitudeGradient += radiusRatioPower * longitudeSum;
+            radiusRatioPower *= radiusRatio;
+
+            // Shift Legendre polynomials to next degree.
+            std::swap( secondPreviousLegendreValues, previousLegendreValues );
+            std::swap( previousLegendreValues, currentLegendreValues );
+        }
+
+        // Compute derivatives of potential w.r.t. radius, latitude and longitude.
+        radialGradient *= preMultiplier / radius;
+        latitudeGradient *= preMultiplier * cosineOfLatitude;
+        longitudeGradient *= preMultiplier;
+
+        // Convert from spherical gradient to Cartesian gradient (which equals acceleration vector).
+        const LaneArray latitudeFactor = latitudeGradient * z / ( radius * radius * xyDistance );
+        const LaneArray longitudeFactor = longitudeGradient / xyDistanceSquared;
+        const LaneArray radialFactor = radialGradient / radius;
+        const LaneArray xAcceleration = radialFactor * x - latitudeFactor * x - longitudeFactor * y;
+        const LaneArray yAcceleration = radialFactor * y - latitudeFactor * y + longitudeFactor * x;
+        const LaneArray zAcceleration = radialFactor * z + latitudeGradient * xyDistance / ( radius * radius );
+
+        for( int lane = 0; lane < numberOfActiveLanes; lane++ )
+        {
+            accelerations.col( blockStart + lane ) = accelerationRotation * Eigen::Vector3d(
+                        xAcceleration( lane ), yAcceleration( lane ), zAcceleration( lane ) );
+        }
+    }
+}
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 Eigen::Vector3d computeSingleGeodesyNormalizedGravitationalAcceleration(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
@@ -34,6 +34,143 @@ namespace tudat
 namespace gravitation
 {
 
+//! Function to reset the current time of the acceleration model, so that it is recomputed at the next update
+void SphericalHarmonicsGravitationalAccelerationModel::resetCurrentTime( )
+{
+    currentTime_ = TUDAT_NAN;
+    if( accelerationBatch_ != nullptr )
+    {
+        accelerationBatch_->resetCurrentTime( );
+    }
+}
+
+//! Function to retrieve the current acceleration from the batch object of which this model is a part.
+void SphericalHarmonicsGravitationalAccelerationModel::updateAccelerationFromBatch( const double currentTime )
+{
+    accelerationBatch_->updateAccelerations( currentTime );
+
+    // Batch computes acceleration per unit gravitational parameter, in body-fixed frame
+    currentAccelerationInBodyFixedFrame_ =
+            gravitationalParameter * accelerationBatch_->getAccelerationInBodyFixedFrame( batchIndex_ );
+    currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
+}
+
+//! Constructor
+SphericalHarmonicsAccelerationBatch::SphericalHarmonicsAccelerationBatch(
+        const std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > >& accelerationModels ):
+    currentTime_( TUDAT_NAN )
+{
+    if( accelerationModels.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating spherical harmonic acceleration batch, no acceleration models provided" );
+    }
+
+    referenceRadius_ = accelerationModels.at( 0 )->getReferenceRadius( );
+    for( unsigned int i = 0; i < accelerationModels.size( ); i++ )
+    {
+        if( accelerationModels.at( i )->getReferenceRadius( ) != referenceRadius_ ||
+                accelerationModels.at( i )->getMaximumDegree( ) != accelerationModels.at( 0 )->getMaximumDegree( ) ||
+                accelerationModels.at( i )->getMaximumOrder( ) != accelerationModels.at( 0 )->getMaximumOrder( ) )
+        {
+            throw std::runtime_error( "Error when creating spherical harmonic acceleration batch, reference radius or "
+                                      "degree/order of acceleration models is not consistent" );
+        }
+        accelerationModels_.push_back( accelerationModels.at( i ) );
+    }
+
+    currentRelativePositions_.setZero( 3, accelerationModels_.size( ) );
+    currentAccelerations_.setZero( 3, accelerationModels_.size( ) );
+    batchCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsBatchCache >(
+                accelerationModels.at( 0 )->getMaximumDegree( ) - 1,
+                accelerationModels.at( 0 )->getMaximumOrder( ) - 1 );
+}
+
+//! Function to update the accelerations of all models to the current time
+void SphericalHarmonicsAccelerationBatch::updateAccelerations( const double currentTime )
+{
+    if( !( currentTime_ == currentTime ) )
+    {
+        // Update relative positions of all bodies
+        std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > currentModel;
+        for( unsigned int i = 0; i < accelerationModels_.size( ); i++ )
+        {
+            currentModel = accelerationModels_.at( i ).lock( );
+            if( currentModel == nullptr )
+            {
+                throw std::runtime_error( "Error when updating spherical harmonic acceleration batch, acceleration model no longer exists" );
+            }
+            currentModel->updateRelativePosition( );
+            currentRelativePositions_.col( i ) = currentModel->getCurrentRelativePosition( );
+        }
+
+        // Compute accelerations per unit gravitational parameter (coefficients are identical for all models)
+        computeGeodesyNormalizedGravitationalAccelerationSumBatch(
+                    currentRelativePositions_, 1.0, referenceRadius_,
+                    currentModel->getCurrentCosineHarmonicCoefficients( ),
+                    currentModel->getCurrentSineHarmonicCoefficients( ),
+                    batchCache_, currentAccelerations_ );
+
+        currentTime_ = currentTime;
+    }
+}
+
+//! Function to create a batch object for a list of spherical harmonic acceleration models, and assign it to the models
+std::shared_ptr< SphericalHarmonicsAccelerationBatch > createSphericalHarmonicsAccelerationBatch(
+        const std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > >& accelerationModels )
+{
+    std::shared_ptr< SphericalHarmonicsAccelerationBatch > accelerationBatch =
+            std::make_shared< SphericalHarmonicsAccelerationBatch >( accelerationModels );
+    for( unsigned int i = 0; i < accelerationModels.size( ); i++ )
+    {
+        accelerationModels.at( i )->setAccelerationBatch( accelerationBatch, i );
+    }
+    return accelerationBatch;
+}
+
+//! Function to create batch objects for all spherical harmonic accelerations in an acceleration map
+std::map< std::string, std::shared_ptr< SphericalHarmonicsAccelerationBatch > > createSphericalHarmonicsAccelerationBatches(
+        const basic_astrodynamics::AccelerationMap& accelerationModelMap,
+        const int minimumBatchSize )
+{
+    // Retrieve spherical harmonic accelerations, sorted by body exerting acceleration
+    std::map< std::string, std::map< std::string, std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > > >
+            sphericalHarmonicAccelerations;
+    for( auto accelerationIterator : accelerationModelMap )
+    {
+        for( auto singleBodyIterator : accelerationIterator.second )
+        {
+            for( unsigned int i = 0; i < singleBodyIterator.second.size( ); i++ )
+            {
+                std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > sphericalHarmonicAcceleration =
+                        std::dynamic_pointer_cast< SphericalHarmonicsGravitationalAccelerationModel >(
+                            singleBodyIterator.second.at( i ) );
+                if( sphericalHarmonicAcceleration != nullptr )
+                {
+                    sphericalHarmonicAccelerations[ singleBodyIterator.first ][ accelerationIterator.first ] =
+                            sphericalHarmonicAcceleration;
+                }
+            }
+        }
+    }
+
+    // Create batch per body exerting acceleration, with models sorted by name of body undergoing acceleration
+    std::map< std::string, std::shared_ptr< SphericalHarmonicsAccelerationBatch > > accelerationBatches;
+    for( auto bodyExertingIterator : sphericalHarmonicAccelerations )
+    {
+        if( static_cast< int >( bodyExertingIterator.second.size( ) ) >= minimumBatchSize )
+        {
+            std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > > accelerationModels;
+            for( auto bodyUndergoingIterator : bodyExertingIterator.second )
+            {
+                accelerationModels.push_back( bodyUndergoingIterator.second );
+            }
+            accelerationBatches[ bodyExertingIterator.first ] =
+                    createSphericalHarmonicsAccelerationBatch( accelerationModels );
+        }
+    }
+    return accelerationBatches;
+}
+
 } // namespace gravitation
 
 } // namespace tudat
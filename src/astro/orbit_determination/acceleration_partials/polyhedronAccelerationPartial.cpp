@@ -11,6 +11,7 @@
 #include "tudat/astro/orbit_determination/acceleration_partials/polyhedronAccelerationPartial.h"
 #include "tudat/math/basic/polyhedron.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/centralGravityAccelerationPartial.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/sphericalHarmonicPartialFunctions.h"
 
 namespace tudat
 {
@@ -27,8 +28,8 @@ PolyhedronGravityPartial::PolyhedronGravityPartial (
     gravitationalParameterFunction_( accelerationModel->getGravitationalParameterFunction( ) ),
     volumeFunction_( accelerationModel->getVolumeFunction( ) ),
     polyhedronCache_( accelerationModel->getPolyhedronCache() ),
-    facetDyads_( accelerationModel->getFacetDyadsFunction( )( ) ),
-    edgeDyads_( accelerationModel->getEdgeDyadsFunction( )( ) ),
+    facetDyads_( accelerationModel->getPackedFacetDyads( ) ),
+    edgeDyads_( accelerationModel->getPackedEdgeDyads( ) ),
     positionFunctionOfAcceleratedBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
                                                    getCurrentPositionOfBodySubjectToAcceleration, accelerationModel ) ),
     positionFunctionOfAcceleratingBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
@@ -39,9 +40,18 @@ PolyhedronGravityPartial::PolyhedronGravityPartial (
                                       accelerationModel ) ),
     updateFunction_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::updateMembers,
                                 accelerationModel, std::placeholders::_1 ) ),
-    rotationMatrixPartials_( rotationMatrixPartials )
+    rotationMatrixPartials_( rotationMatrixPartials ),
+    accelerationModel_( accelerationModel )
 {
-
+    // Create separate cache for far-field expansion, including second derivatives of Legendre polynomials
+    if( accelerationModel->hasFarFieldSphericalHarmonicExpansion( ) )
+    {
+        farFieldSphericalHarmonicsCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+        farFieldSphericalHarmonicsCache_->getLegendreCache( )->setComputeSecondDerivatives( 1 );
+        farFieldSphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
+                    accelerationModel->getFarFieldCosineCoefficients( ).rows( ),
+                    accelerationModel->getFarFieldCosineCoefficients( ).cols( ) + 1 );
+    }
 }
 
 void PolyhedronGravityPartial::update( const double currentTime )
@@ -63,11 +73,46 @@ void PolyhedronGravityPartial::update( const double currentTime )
         bodyFixedSphericalPosition_( 1 ) = mathematical_constants::PI / 2.0 - bodyFixedSphericalPosition_( 1 );
 
         // Calculate partial of acceleration wrt position of body undergoing acceleration.
-        currentBodyFixedPartialWrtPosition_ = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
-                gravitationalParameterFunction_() / volumeFunction_(),
-                facetDyads_, edgeDyads_,
-                polyhedronCache_->getPerFacetFactor(),
-                polyhedronCache_->getPerEdgeFactor() );
+        if( farFieldSphericalHarmonicsCache_ == nullptr )
+        {
+            currentBodyFixedPartialWrtPosition_ = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
+                    gravitationalParameterFunction_() / volumeFunction_(),
+                    *facetDyads_, *edgeDyads_,
+                    polyhedronCache_->getPerFacetFactor(),
+                    polyhedronCache_->getPerEdgeFactor() );
+        }
+        else
+        {
+            // Blend partials consistently with acceleration a = ( 1 - w ) a_poly + w a_sh, including the partial of w
+            double farFieldWeight = accelerationModel_->getCurrentFarFieldWeight( );
+            currentBodyFixedPartialWrtPosition_.setZero( );
+            if( farFieldWeight < 1.0 )
+            {
+                currentBodyFixedPartialWrtPosition_ += ( 1.0 - farFieldWeight ) *
+                        basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
+                            gravitationalParameterFunction_() / volumeFunction_(),
+                            *facetDyads_, *edgeDyads_,
+                            polyhedronCache_->getPerFacetFactor(),
+                            polyhedronCache_->getPerEdgeFactor() );
+            }
+            if( farFieldWeight > 0.0 )
+            {
+                currentBodyFixedPartialWrtPosition_ += farFieldWeight *
+                        computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                            bodyFixedPosition_, accelerationModel_->getFarFieldReferenceRadius( ),
+                            gravitationalParameterFunction_( ),
+                            accelerationModel_->getFarFieldCosineCoefficients( ),
+                            accelerationModel_->getFarFieldSineCoefficients( ),
+                            farFieldSphericalHarmonicsCache_ );
+            }
+            if( farFieldWeight > 0.0 && farFieldWeight < 1.0 )
+            {
+                currentBodyFixedPartialWrtPosition_ +=
+                        ( accelerationModel_->getCurrentFarFieldAccelerationInBodyFixedFrame( ) -
+                          accelerationModel_->getCurrentPolyhedronAccelerationInBodyFixedFrame( ) ) *
+                        accelerationModel_->getCurrentFarFieldWeightGradient( ).transpose( );
+            }
+        }
 
         currentPartialWrtVelocity_.setZero( );
         currentPartialWrtPosition_.setZero( );
@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <stdexcept>
 #include "tudat/astro/propagators/environmentUpdateTypes.h"
 
 namespace tudat
@@ -60,6 +61,37 @@ void addEnvironmentUpdates( std::map< propagators::EnvironmentModelsToUpdate,
     }
 }
 
+//! Function to get a string representing an environment model update type
+std::string getEnvironmentModelUpdateName( const EnvironmentModelsToUpdate environmentModelUpdate )
+{
+    std::string updateName;
+    switch( environmentModelUpdate )
+    {
+    case body_translational_state_update:
+        updateName = "translational state";
+        break;
+    case body_rotational_state_update:
+        updateName = "rotational state";
+        break;
+    case body_mass_update:
+        updateName = "mass";
+        break;
+    case spherical_harmonic_gravity_field_update:
+        updateName = "spherical harmonic gravity field";
+        break;
+    case vehicle_flight_conditions_update:
+        updateName = "flight conditions";
+        break;
+    case radiation_pressure_interface_update:
+        updateName = "radiation pressure interface";
+        break;
+    default:
+        throw std::runtime_error( "Error, did not recognize environment model update type " +
+                                  std::to_string( environmentModelUpdate ) );
+    }
+    return updateName;
+}
+
 
 }
 
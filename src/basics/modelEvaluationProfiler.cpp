@@ -0,0 +1,151 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+
+#include "tudat/basics/modelEvaluationProfiler.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to register a model, and retrieve the index by which its evaluations are to be added
+int ModelEvaluationProfiler::registerModel( const std::string& category, const std::string& modelName )
+{
+    std::pair< std::string, std::string > modelKey = std::make_pair( category, modelName );
+    if( profileIndices_.count( modelKey ) == 0 )
+    {
+        profileIndices_[ modelKey ] = static_cast< int >( profiles_.size( ) );
+        profiles_.push_back( ModelEvaluationProfile( category, modelName ) );
+    }
+    return profileIndices_.at( modelKey );
+}
+
+//! Function to retrieve the profile of a single model
+const ModelEvaluationProfile& ModelEvaluationProfiler::getProfile(
+        const std::string& category, const std::string& modelName ) const
+{
+    std::pair< std::string, std::string > modelKey = std::make_pair( category, modelName );
+    if( profileIndices_.count( modelKey ) == 0 )
+    {
+        throw std::runtime_error( "Error when retrieving model evaluation profile, no model " + modelName +
+                                  " of category " + category + " is registered" );
+    }
+    return profiles_.at( profileIndices_.at( modelKey ) );
+}
+
+//! Function to retrieve the profiles of all registered models in a given category
+std::vector< ModelEvaluationProfile > ModelEvaluationProfiler::getProfilesOfCategory( const std::string& category ) const
+{
+    std::vector< ModelEvaluationProfile > profilesOfCategory;
+    for( unsigned int i = 0; i < profiles_.size( ); i++ )
+    {
+        if( profiles_.at( i ).category_ == category )
+        {
+            profilesOfCategory.push_back( profiles_.at( i ) );
+        }
+    }
+    return profilesOfCategory;
+}
+
+//! Function to retrieve the total clock time (in seconds) spent in all models of a given category
+double ModelEvaluationProfiler::getTotalEvaluationTimeOfCategory( const std::string& category ) const
+{
+    double totalEvaluationTime = 0.0;
+    for( unsigned int i = 0; i < profiles_.size( ); i++ )
+    {
+        if( profiles_.at( i ).category_ == category )
+        {
+            totalEvaluationTime += profiles_.at( i ).totalEvaluationTime_;
+        }
+    }
+    return totalEvaluationTime;
+}
+
+//! Function to reset the number of calls and cumulative time of all registered models to zero
+void ModelEvaluationProfiler::resetProfiles( )
+{
+    for( unsigned int i = 0; i < profiles_.size( ); i++ )
+    {
+        profiles_[ i ].numberOfCalls_ = 0;
+        profiles_[ i ].totalEvaluationTime_ = 0.0;
+    }
+}
+
+//! Function to print the profiles as a table, sorted by decreasing cumulative evaluation time
+void ModelEvaluationProfiler::printProfileTable( std::ostream& outputStream ) const
+{
+    // Sort profiles by decreasing evaluation time
+    std::vector< ModelEvaluationProfile > sortedProfiles = profiles_;
+    std::stable_sort( sortedProfiles.begin( ), sortedProfiles.end( ),
+                      [ ]( const ModelEvaluationProfile& first, const ModelEvaluationProfile& second )
+    {
+        return first.totalEvaluationTime_ > second.totalEvaluationTime_;
+    } );
+
+    double totalEvaluationTime = 0.0;
+    std::size_t categoryWidth = 8, nameWidth = 5;
+    for( unsigned int i = 0; i < sortedProfiles.size( ); i++ )
+    {
+        totalEvaluationTime += sortedProfiles.at( i ).totalEvaluationTime_;
+        categoryWidth = std::max( categoryWidth, sortedProfiles.at( i ).category_.size( ) );
+        nameWidth = std::max( nameWidth, sortedProfiles.at( i ).modelName_.size( ) );
+    }
+
+    std::ios_base::fmtflags originalFlags = outputStream.flags( );
+    std::streamsize originalPrecision = outputStream.precision( );
+
+    outputStream << std::left << std::setw( categoryWidth + 2 ) << "Category"
+                 << std::setw( nameWidth + 2 ) << "Model"
+                 << std::right << std::setw( 12 ) << "Calls"
+                 << std::setw( 16 ) << "Total time [s]"
+                 << std::setw( 16 ) << "Per call [s]"
+                 << std::setw( 10 ) << "Share" << std::endl;
+    for( unsigned int i = 0; i < sortedProfiles.size( ); i++ )
+    {
+        const ModelEvaluationProfile& profile = sortedProfiles.at( i );
+        outputStream << std::left << std::setw( categoryWidth + 2 ) << profile.category_
+                     << std::setw( nameWidth + 2 ) << profile.modelName_
+                     << std::right << std::setw( 12 ) << profile.numberOfCalls_
+                     << std::scientific << std::setprecision( 4 )
+                     << std::setw( 16 ) << profile.totalEvaluationTime_
+                     << std::setw( 16 ) << ( profile.numberOfCalls_ > 0 ?
+                                                 profile.totalEvaluationTime_ / static_cast< double >( profile.numberOfCalls_ ) : 0.0 )
+                     << std::fixed << std::setprecision( 1 )
+                     << std::setw( 9 ) << ( totalEvaluationTime > 0.0 ?
+                                                100.0 * profile.totalEvaluationTime_ / totalEvaluationTime : 0.0 ) << "%"
+                     << std::endl;
+    }
+
+    outputStream.flags( originalFlags );
+    outputStream.precision( originalPrecision );
+}
+
+//! Function to write the profiles as delimited text (with header line), in order of registration
+void ModelEvaluationProfiler::writeProfileTable( std::ostream& outputStream, const std::string& delimiter ) const
+{
+    std::streamsize originalPrecision = outputStream.precision( );
+    outputStream << std::setprecision( 17 );
+    outputStream << "category" << delimiter << "model" << delimiter << "calls" << delimiter << "total_time" << std::endl;
+    for( unsigned int i = 0; i < profiles_.size( ); i++ )
+    {
+        outputStream << profiles_.at( i ).category_ << delimiter << profiles_.at( i ).modelName_ << delimiter
+                     << profiles_.at( i ).numberOfCalls_ << delimiter << profiles_.at( i ).totalEvaluationTime_ << std::endl;
+    }
+    outputStream.precision( originalPrecision );
+}
+
+} // namespace utilities
+
+} // namespace tudat
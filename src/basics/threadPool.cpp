@@ -0,0 +1,145 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/basics/threadPool.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Constructor
+ThreadPool::ThreadPool( const int numberOfThreads ):
+    nextTaskIndex_( 0 )
+{
+    for( int i = 1; i < numberOfThreads; i++ )
+    {
+        workerThreads_.push_back( std::thread( &ThreadPool::runWorker, this ) );
+    }
+}
+
+//! Destructor, stops and joins the worker threads.
+ThreadPool::~ThreadPool( )
+{
+    {
+        std::lock_guard< std::mutex > taskLock( taskMutex_ );
+        stopWorkers_ = true;
+    }
+    taskAvailableCondition_.notify_all( );
+
+    for( unsigned int i = 0; i < workerThreads_.size( ); i++ )
+    {
+        workerThreads_.at( i ).join( );
+    }
+}
+
+//! Function to evaluate a set of tasks, distributed over the threads of the pool
+void ThreadPool::runTasks( const int numberOfTasks, const std::function< void( const int ) >& taskFunction )
+{
+    std::lock_guard< std::mutex > runLock( runMutex_ );
+
+    // Evaluate in calling thread if no worker threads are needed
+    if( workerThreads_.size( ) == 0 || numberOfTasks < 2 )
+    {
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            taskFunction( i );
+        }
+        return;
+    }
+
+    // Set new task set, and notify workers
+    {
+        std::lock_guard< std::mutex > taskLock( taskMutex_ );
+        currentTaskFunction_ = &taskFunction;
+        numberOfTasks_ = numberOfTasks;
+        nextTaskIndex_.store( 0 );
+        taskException_ = nullptr;
+        numberOfActiveWorkers_ = static_cast< int >( workerThreads_.size( ) );
+        taskSetIndex_++;
+    }
+    taskAvailableCondition_.notify_all( );
+
+    // Evaluate tasks in calling thread, and wait for workers to finish
+    evaluateAvailableTasks( );
+    std::exception_ptr taskException;
+    {
+        std::unique_lock< std::mutex > taskLock( taskMutex_ );
+        tasksFinishedCondition_.wait( taskLock, [ this ]( ){ return numberOfActiveWorkers_ == 0; } );
+        currentTaskFunction_ = nullptr;
+        taskException = taskException_;
+        taskException_ = nullptr;
+    }
+
+    if( taskException != nullptr )
+    {
+        std::rethrow_exception( taskException );
+    }
+}
+
+//! Function run by each worker thread, waiting for and evaluating tasks until the pool is destroyed
+void ThreadPool::runWorker( )
+{
+    unsigned long long lastTaskSetIndex = 0;
+    while( true )
+    {
+        {
+            std::unique_lock< std::mutex > taskLock( taskMutex_ );
+            taskAvailableCondition_.wait( taskLock, [ this, lastTaskSetIndex ]( )
+            {
+                return stopWorkers_ || taskSetIndex_ != lastTaskSetIndex;
+            } );
+            if( stopWorkers_ )
+            {
+                return;
+            }
+            lastTaskSetIndex = taskSetIndex_;
+        }
+
+        evaluateAvailableTasks( );
+
+        {
+            std::lock_guard< std::mutex > taskLock( taskMutex_ );
+            numberOfActiveWorkers_--;
+        }
+        tasksFinishedCondition_.notify_one( );
+    }
+}
+
+//! Function to evaluate tasks of the current set until none are left, recording the first exception
+void ThreadPool::evaluateAvailableTasks( )
+{
+    while( true )
+    {
+        const int taskIndex = nextTaskIndex_.fetch_add( 1 );
+        if( taskIndex >= numberOfTasks_ )
+        {
+            break;
+        }
+
+        try
+        {
+            ( *currentTaskFunction_ )( taskIndex );
+        }
+        catch( ... )
+        {
+            std::lock_guard< std::mutex > taskLock( taskMutex_ );
+            if( taskException_ == nullptr )
+            {
+                taskException_ = std::current_exception( );
+            }
+        }
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
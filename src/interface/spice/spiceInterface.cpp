@@ -15,11 +15,17 @@
 #include "tudat/paths.hpp"
 
 #include <math.h>
+#include <mutex>
 
 namespace tudat {
 namespace spice_interface {
 using Eigen::Vector6d;
 
+//! Mutex used to serialize all calls into the (non-thread-safe) cspice library, which keeps global state (kernel pool,
+//! error status, and internal caches of routines such as ev2lin), so that spice-based models may be evaluated from
+//! multiple threads.
+static std::mutex spiceCallMutex;
+
 std::string getCorrectedTargetBodyName(
         const std::string &targetBodyName )
 {
@@ -55,6 +61,7 @@ double convertEphemerisTimeToJulianDate(const double ephemerisTime) {
 //! Converts a date string to ephemeris time.
 double convertDateStringToEphemerisTime(const std::string &dateString) {
     double ephemerisTime = 0.0;
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     str2et_c(dateString.c_str(), &ephemerisTime);
     return ephemerisTime;
 }
@@ -75,6 +82,7 @@ Vector6d getBodyCartesianStateAtEpoch(
     double lightTime;
 
     // Call Spice function to calculate state and light-time.
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     spkezr_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
              aberrationCorrections.c_str(),
              getCorrectedTargetBodyName( observerBodyName ).c_str(), stateAtEpoch,
@@ -107,6 +115,7 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch(const std::string &targetBodyNam
     double lightTime;
 
     // Call Spice function to calculate position and light-time.
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     spkpos_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
              aberrationCorrections.c_str(),
              getCorrectedTargetBodyName( observerBodyName ).c_str(), positionAtEpoch,
@@ -150,7 +159,10 @@ Vector6d getCartesianStateFromTleAtEpoch(double epoch, std::shared_ptr<ephemerid
     elements[9] = tle->getEpoch();// TLE ephemeris epoch in seconds since J2000
 
     // Call Spice function. Return value is always 0, so no need to save it.
-    ev2lin_(&epoch, physicalConstants, elements, stateAtEpoch);
+    {
+        std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
+        ev2lin_(&epoch, physicalConstants, elements, stateAtEpoch);
+    }
 
     // Put result in Eigen Vector.
     Vector6d cartesianStateVector;
@@ -175,6 +187,7 @@ Eigen::Quaterniond computeRotationQuaternionBetweenFrames(const std::string &ori
     double rotationArray[3][3];
 
     // Calculate rotation matrix.
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     pxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, rotationArray);
 
     // Put rotation matrix in Eigen Matrix3d.
@@ -210,6 +223,7 @@ Eigen::Matrix3d computeRotationMatrixDerivativeBetweenFrames(const std::string &
     double stateTransition[6][6];
 
     // Calculate state transition matrix.
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
 
     // Put rotation matrix derivative in Eigen Matrix3d
@@ -236,6 +250,7 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame(const std::string
     double stateTransition[6][6];
 
     // Calculate state transition matrix.
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
 
     double rotation[3][3];
@@ -256,6 +271,7 @@ std::pair<Eigen::Quaterniond, Eigen::Matrix3d> computeRotationQuaternionAndRotat
         throw std::invalid_argument( "Error when retrieving rotational state from Spice, input time is " + std::to_string(ephemerisTime) );
     }
 
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
 
     Eigen::Matrix3d matrixDerivative;
@@ -278,6 +294,7 @@ std::vector<double> getBodyProperties(const std::string &body, const std::string
 
     // Call Spice function to retrieve property.
     SpiceInt numberOfReturnedParameters;
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     bodvrd_c(body.c_str(), property.c_str(), maximumNumberOfValues, &numberOfReturnedParameters,
              propertyArray);
 
@@ -298,7 +315,10 @@ double getBodyGravitationalParameter(const std::string &body) {
 
     // Call Spice function to retrieve gravitational parameter.
     SpiceInt numberOfReturnedParameters;
-    bodvrd_c(body.c_str(), "GM", 1, &numberOfReturnedParameters, gravitationalParameter);
+    {
+        std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
+        bodvrd_c(body.c_str(), "GM", 1, &numberOfReturnedParameters, gravitationalParameter);
+    }
 
     // Convert from km^3/s^2 to m^3/s^2
     return unit_conversions::convertKilometersToMeters<double>(
@@ -314,7 +334,10 @@ double getAverageRadius(const std::string &body) {
 
     // Call Spice function to retrieve gravitational parameter.
     SpiceInt numberOfReturnedParameters;
-    bodvrd_c(body.c_str(), "RADII", 3, &numberOfReturnedParameters, radii);
+    {
+        std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
+        bodvrd_c(body.c_str(), "RADII", 3, &numberOfReturnedParameters, radii);
+    }
 
     // Compute average and convert from km to m.
     return unit_conversions::convertKilometersToMeters<double>(
@@ -327,7 +350,10 @@ int convertBodyNameToNaifId(const std::string &bodyName) {
     // Convert body name to NAIF ID number.
     SpiceInt bodyNaifId;
     SpiceBoolean isIdFound;
-    bods2c_c(bodyName.c_str(), &bodyNaifId, &isIdFound);
+    {
+        std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
+        bods2c_c(bodyName.c_str(), &bodyNaifId, &isIdFound);
+    }
 
     // Convert SpiceInt (typedef for long) to int and return.
     return static_cast<int>(bodyNaifId);
@@ -339,24 +365,30 @@ bool checkBodyPropertyInKernelPool(const std::string &bodyName, const std::strin
     const int naifId = convertBodyNameToNaifId(bodyName);
 
     // Determine if property is in pool.
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     SpiceBoolean isPropertyInPool = bodfnd_c(naifId, bodyProperty.c_str());
     return static_cast<bool>(isPropertyInPool);
 }
 
 //! Load a Spice kernel.
 void loadSpiceKernelInTudat(const std::string &fileName) {
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     furnsh_c(fileName.c_str());
 }
 
 //! Get the amount of loaded Spice kernels.
 int getTotalCountOfKernelsLoaded() {
     SpiceInt count;
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
     ktotal_c("ALL", &count);
     return count;
 }
 
 //! Clear all Spice kernels.
-void clearSpiceKernels() { kclear_c(); }
+void clearSpiceKernels() {
+    std::lock_guard< std::mutex > spiceLock( spiceCallMutex );
+    kclear_c();
+}
 
 //! Get all standard Spice kernels used in tudat.
 std::vector<std::string> getStandardSpiceKernels(const std::vector<std::string> alternativeEphemerisKernels) {
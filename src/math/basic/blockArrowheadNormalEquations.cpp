@@ -0,0 +1,471 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include "tudat/math/basic/blockArrowheadNormalEquations.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Constructor
+BlockArrowheadNormalEquations::BlockArrowheadNormalEquations(
+        const int numberOfParameters,
+        const std::vector< std::vector< int > >& localParameterIndices ):
+    numberOfParameters_( numberOfParameters ), localParameterIndices_( localParameterIndices ),
+    parameterBlockIndices_( numberOfParameters, -1 ), parameterIndicesInBlock_( numberOfParameters, -1 )
+{
+    // Assign local parameters to blocks
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            int parameterIndex = localParameterIndices_.at( i ).at( j );
+            if( parameterIndex < 0 || parameterIndex >= numberOfParameters_ )
+            {
+                throw std::runtime_error( "Error when creating block-arrowhead normal equations, parameter index " +
+                                          std::to_string( parameterIndex ) + " is out of range" );
+            }
+            else if( parameterBlockIndices_.at( parameterIndex ) >= 0 )
+            {
+                throw std::runtime_error( "Error when creating block-arrowhead normal equations, parameter " +
+                                          std::to_string( parameterIndex ) + " is in more than one local block" );
+            }
+            parameterBlockIndices_[ parameterIndex ] = i;
+            parameterIndicesInBlock_[ parameterIndex ] = j;
+        }
+    }
+
+    // All remaining parameters are global
+    for( int i = 0; i < numberOfParameters_; i++ )
+    {
+        if( parameterBlockIndices_.at( i ) < 0 )
+        {
+            parameterIndicesInBlock_[ i ] = globalParameterIndices_.size( );
+            globalParameterIndices_.push_back( i );
+        }
+    }
+
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        int numberOfLocalParameters = localParameterIndices_.at( i ).size( );
+        localNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfLocalParameters ) );
+        localGlobalNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfGlobalParameters ) );
+        localRightHandSides_.push_back( Eigen::VectorXd::Zero( numberOfLocalParameters ) );
+    }
+    globalNormalMatrix_ = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+    globalRightHandSide_ = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+}
+
+//! Function to add the contribution of a block of observations to the normal equations
+void BlockArrowheadNormalEquations::addObservationBlock(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        const bool updateNormalMatrix )
+{
+    if( designMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ||
+            designMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to block-arrowhead normal equations, sizes of partials, residuals and weights are incompatible" );
+    }
+
+    if( designMatrixBlock.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding observations to block-arrowhead normal equations, sizes of partials and normal equations are incompatible" );
+    }
+
+    // Determine local block on which the observations depend
+    int blockIndex = -1;
+    for( int i = 0; i < numberOfParameters_; i++ )
+    {
+        if( parameterBlockIndices_.at( i ) >= 0 && parameterBlockIndices_.at( i ) != blockIndex &&
+                !designMatrixBlock.col( i ).isZero( 0.0 ) )
+        {
+            if( blockIndex >= 0 )
+            {
+                throw std::runtime_error( "Error when adding observations to block-arrowhead normal equations, observations depend on local parameters of blocks " +
+                                          std::to_string( blockIndex ) + " and " +
+                                          std::to_string( parameterBlockIndices_.at( i ) ) );
+            }
+            blockIndex = parameterBlockIndices_.at( i );
+        }
+    }
+
+    // Extract partials w.r.t. global parameters, and local parameters of current block
+    Eigen::VectorXd weightedResiduals = diagonalOfWeightMatrixBlock.cwiseProduct( observationResidualsBlock );
+    Eigen::MatrixXd globalDesignMatrixBlock( designMatrixBlock.rows( ), globalParameterIndices_.size( ) );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        globalDesignMatrixBlock.col( i ) = designMatrixBlock.col( globalParameterIndices_.at( i ) );
+    }
+
+    globalRightHandSide_.noalias( ) += globalDesignMatrixBlock.transpose( ) * weightedResiduals;
+    Eigen::MatrixXd weightedGlobalDesignMatrixBlock;
+    if( updateNormalMatrix )
+    {
+        weightedGlobalDesignMatrixBlock = multiplyDesignMatrixByDiagonalWeightMatrix(
+                    globalDesignMatrixBlock, diagonalOfWeightMatrixBlock.cwiseSqrt( ) );
+        globalNormalMatrix_.selfadjointView< Eigen::Lower >( ).rankUpdate( weightedGlobalDesignMatrixBlock.transpose( ) );
+    }
+
+    if( blockIndex >= 0 )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( blockIndex );
+        Eigen::MatrixXd localDesignMatrixBlock( designMatrixBlock.rows( ), currentLocalIndices.size( ) );
+        for( unsigned int i = 0; i < currentLocalIndices.size( ); i++ )
+        {
+            localDesignMatrixBlock.col( i ) = designMatrixBlock.col( currentLocalIndices.at( i ) );
+        }
+
+        localRightHandSides_[ blockIndex ].noalias( ) += localDesignMatrixBlock.transpose( ) * weightedResiduals;
+        if( updateNormalMatrix )
+        {
+            Eigen::MatrixXd weightedLocalDesignMatrixBlock = multiplyDesignMatrixByDiagonalWeightMatrix(
+                        localDesignMatrixBlock, diagonalOfWeightMatrixBlock.cwiseSqrt( ) );
+            localNormalMatrices_[ blockIndex ].selfadjointView< Eigen::Lower >( ).rankUpdate(
+                        weightedLocalDesignMatrixBlock.transpose( ) );
+            localGlobalNormalMatrices_[ blockIndex ].noalias( ) +=
+                    weightedLocalDesignMatrixBlock.transpose( ) * weightedGlobalDesignMatrixBlock;
+        }
+    }
+}
+
+//! Function to set the upper triangles of the diagonal blocks of the normal matrix from their lower triangles
+void BlockArrowheadNormalEquations::symmetrize( )
+{
+    for( unsigned int i = 0; i < localNormalMatrices_.size( ); i++ )
+    {
+        symmetrizeNormalMatrix( localNormalMatrices_[ i ] );
+    }
+    symmetrizeNormalMatrix( globalNormalMatrix_ );
+}
+
+//! Function to scale the normal equations by a column normalization of the design matrix
+void BlockArrowheadNormalEquations::normalize( const Eigen::VectorXd& normalizationTerms )
+{
+    if( normalizationTerms.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when normalizing block-arrowhead normal equations, size of normalization terms is incompatible" );
+    }
+
+    Eigen::VectorXd globalNormalizationTerms( globalParameterIndices_.size( ) );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        globalNormalizationTerms( i ) = normalizationTerms( globalParameterIndices_.at( i ) );
+    }
+
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        Eigen::VectorXd localNormalizationTerms( localParameterIndices_.at( i ).size( ) );
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            localNormalizationTerms( j ) = normalizationTerms( localParameterIndices_.at( i ).at( j ) );
+        }
+
+        for( int j = 0; j < localNormalizationTerms.rows( ); j++ )
+        {
+            for( int k = 0; k < localNormalizationTerms.rows( ); k++ )
+            {
+                localNormalMatrices_[ i ]( j, k ) /= ( localNormalizationTerms( j ) * localNormalizationTerms( k ) );
+            }
+            for( int k = 0; k < globalNormalizationTerms.rows( ); k++ )
+            {
+                localGlobalNormalMatrices_[ i ]( j, k ) /= ( localNormalizationTerms( j ) * globalNormalizationTerms( k ) );
+            }
+            localRightHandSides_[ i ]( j ) /= localNormalizationTerms( j );
+        }
+    }
+
+    for( int j = 0; j < globalNormalizationTerms.rows( ); j++ )
+    {
+        for( int k = 0; k < globalNormalizationTerms.rows( ); k++ )
+        {
+            globalNormalMatrix_( j, k ) /= ( globalNormalizationTerms( j ) * globalNormalizationTerms( k ) );
+        }
+        globalRightHandSide_( j ) /= globalNormalizationTerms( j );
+    }
+}
+
+//! Function to add a priori information to the normal equations
+void BlockArrowheadNormalEquations::addInverseAprioriCovariance( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix )
+{
+    if( inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters_ ||
+            inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding a priori covariance to block-arrowhead normal equations, sizes are incompatible" );
+    }
+
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < globalParameterIndices_.size( ); j++ )
+        {
+            globalNormalMatrix_( i, j ) += inverseOfAPrioriCovarianceMatrix(
+                        globalParameterIndices_.at( i ), globalParameterIndices_.at( j ) );
+        }
+    }
+
+    for( unsigned int k = 0; k < localParameterIndices_.size( ); k++ )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( k );
+        for( unsigned int i = 0; i < currentLocalIndices.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < currentLocalIndices.size( ); j++ )
+            {
+                localNormalMatrices_[ k ]( i, j ) += inverseOfAPrioriCovarianceMatrix(
+                            currentLocalIndices.at( i ), currentLocalIndices.at( j ) );
+            }
+            for( unsigned int j = 0; j < globalParameterIndices_.size( ); j++ )
+            {
+                localGlobalNormalMatrices_[ k ]( i, j ) += inverseOfAPrioriCovarianceMatrix(
+                            currentLocalIndices.at( i ), globalParameterIndices_.at( j ) );
+            }
+        }
+    }
+}
+
+//! Function to eliminate the local parameters from the normal matrix of the global parameters
+Eigen::MatrixXd BlockArrowheadNormalEquations::reduceLocalParameters(
+        std::vector< Eigen::LDLT< Eigen::MatrixXd > >& localDecompositions,
+        std::vector< Eigen::MatrixXd >& reducedLocalGlobalMatrices ) const
+{
+    localDecompositions.clear( );
+    localDecompositions.resize( localParameterIndices_.size( ) );
+    reducedLocalGlobalMatrices.clear( );
+    reducedLocalGlobalMatrices.resize( localParameterIndices_.size( ) );
+
+    Eigen::MatrixXd reducedGlobalNormalMatrix = globalNormalMatrix_;
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        if( localNormalMatrices_.at( i ).rows( ) == 0 )
+        {
+            reducedLocalGlobalMatrices[ i ] = Eigen::MatrixXd::Zero( 0, globalParameterIndices_.size( ) );
+            continue;
+        }
+
+        localDecompositions[ i ].compute( localNormalMatrices_.at( i ) );
+        if( localDecompositions[ i ].info( ) != Eigen::Success || !( localDecompositions[ i ].vectorD( ).minCoeff( ) > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when solving block-arrowhead normal equations, normal matrix of local block " +
+                                      std::to_string( i ) + " is not positive definite" );
+        }
+
+        reducedLocalGlobalMatrices[ i ] = localDecompositions[ i ].solve( localGlobalNormalMatrices_.at( i ) );
+        reducedGlobalNormalMatrix.noalias( ) -= localGlobalNormalMatrices_.at( i ).transpose( ) * reducedLocalGlobalMatrices[ i ];
+    }
+    symmetrizeNormalMatrix( reducedGlobalNormalMatrix );
+
+    return reducedGlobalNormalMatrix;
+}
+
+//! Function to solve the normal equations by Schur complement reduction of the local parameters
+Eigen::VectorXd BlockArrowheadNormalEquations::solve(
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const bool useSvdForIllConditionedSystem ) const
+{
+    // Eliminate local parameters from the normal equations of the global parameters
+    std::vector< Eigen::LDLT< Eigen::MatrixXd > > localDecompositions;
+    std::vector< Eigen::MatrixXd > reducedLocalGlobalMatrices;
+    Eigen::MatrixXd reducedGlobalNormalMatrix = reduceLocalParameters( localDecompositions, reducedLocalGlobalMatrices );
+
+    std::vector< Eigen::VectorXd > reducedLocalRightHandSides( localParameterIndices_.size( ) );
+    Eigen::VectorXd reducedGlobalRightHandSide = globalRightHandSide_;
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        if( localNormalMatrices_.at( i ).rows( ) > 0 )
+        {
+            reducedLocalRightHandSides[ i ] = localDecompositions.at( i ).solve( localRightHandSides_.at( i ) );
+            reducedGlobalRightHandSide.noalias( ) -= localGlobalNormalMatrices_.at( i ).transpose( ) * reducedLocalRightHandSides[ i ];
+        }
+    }
+
+    // Solve reduced system for global parameters
+    Eigen::VectorXd globalSolution = Eigen::VectorXd::Zero( globalParameterIndices_.size( ) );
+    if( globalParameterIndices_.size( ) > 0 )
+    {
+        globalSolution = solveSystemOfEquationsWithCholesky(
+                    reducedGlobalNormalMatrix, reducedGlobalRightHandSide, checkConditionNumber,
+                    maximumAllowedConditionNumber, useSvdForIllConditionedSystem );
+    }
+
+    // Back-substitute global solution into local blocks
+    Eigen::VectorXd solution = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        solution( globalParameterIndices_.at( i ) ) = globalSolution( i );
+    }
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        if( localNormalMatrices_.at( i ).rows( ) == 0 )
+        {
+            continue;
+        }
+
+        Eigen::VectorXd localSolution = reducedLocalRightHandSides.at( i ) - reducedLocalGlobalMatrices.at( i ) * globalSolution;
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            solution( localParameterIndices_.at( i ).at( j ) ) = localSolution( j );
+        }
+    }
+
+    return solution;
+}
+
+//! Function to compute the blocks of the inverse of the normal matrix
+void BlockArrowheadNormalEquations::getCovarianceBlocks(
+        std::vector< Eigen::MatrixXd >& localCovarianceMatrices,
+        std::vector< Eigen::MatrixXd >& localGlobalCovarianceMatrices,
+        Eigen::MatrixXd& globalCovarianceMatrix ) const
+{
+    std::vector< Eigen::LDLT< Eigen::MatrixXd > > localDecompositions;
+    std::vector< Eigen::MatrixXd > reducedLocalGlobalMatrices;
+    Eigen::MatrixXd reducedGlobalNormalMatrix = reduceLocalParameters( localDecompositions, reducedLocalGlobalMatrices );
+
+    // Global block is the inverse of the reduced normal matrix
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+    globalCovarianceMatrix = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+    if( numberOfGlobalParameters > 0 )
+    {
+        Eigen::LDLT< Eigen::MatrixXd > globalDecomposition( reducedGlobalNormalMatrix );
+        if( globalDecomposition.info( ) != Eigen::Success || !( globalDecomposition.vectorD( ).minCoeff( ) > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when computing covariance from block-arrowhead normal equations, reduced normal matrix is not positive definite" );
+        }
+        globalCovarianceMatrix = globalDecomposition.solve(
+                    Eigen::MatrixXd::Identity( numberOfGlobalParameters, numberOfGlobalParameters ) );
+        symmetrizeNormalMatrix( globalCovarianceMatrix );
+    }
+
+    // Local blocks follow from the global block, and the inverse of the local diagonal blocks
+    localCovarianceMatrices.clear( );
+    localCovarianceMatrices.resize( localParameterIndices_.size( ) );
+    localGlobalCovarianceMatrices.clear( );
+    localGlobalCovarianceMatrices.resize( localParameterIndices_.size( ) );
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        int numberOfLocalParameters = localNormalMatrices_.at( i ).rows( );
+        if( numberOfLocalParameters == 0 )
+        {
+            localCovarianceMatrices[ i ] = Eigen::MatrixXd::Zero( 0, 0 );
+            localGlobalCovarianceMatrices[ i ] = Eigen::MatrixXd::Zero( 0, numberOfGlobalParameters );
+            continue;
+        }
+
+        localGlobalCovarianceMatrices[ i ] = -reducedLocalGlobalMatrices.at( i ) * globalCovarianceMatrix;
+        localCovarianceMatrices[ i ] = localDecompositions.at( i ).solve(
+                    Eigen::MatrixXd::Identity( numberOfLocalParameters, numberOfLocalParameters ) );
+        localCovarianceMatrices[ i ].noalias( ) -=
+                localGlobalCovarianceMatrices.at( i ) * reducedLocalGlobalMatrices.at( i ).transpose( );
+        symmetrizeNormalMatrix( localCovarianceMatrices[ i ] );
+    }
+}
+
+//! Function to retrieve the diagonal of the inverse of the normal matrix
+Eigen::VectorXd BlockArrowheadNormalEquations::getCovarianceDiagonal( ) const
+{
+    std::vector< Eigen::MatrixXd > localCovarianceMatrices;
+    std::vector< Eigen::MatrixXd > localGlobalCovarianceMatrices;
+    Eigen::MatrixXd globalCovarianceMatrix;
+    getCovarianceBlocks( localCovarianceMatrices, localGlobalCovarianceMatrices, globalCovarianceMatrix );
+
+    Eigen::VectorXd covarianceDiagonal = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        covarianceDiagonal( globalParameterIndices_.at( i ) ) = globalCovarianceMatrix( i, i );
+    }
+    for( unsigned int k = 0; k < localParameterIndices_.size( ); k++ )
+    {
+        for( unsigned int i = 0; i < localParameterIndices_.at( k ).size( ); i++ )
+        {
+            covarianceDiagonal( localParameterIndices_.at( k ).at( i ) ) = localCovarianceMatrices.at( k )( i, i );
+        }
+    }
+    return covarianceDiagonal;
+}
+
+//! Function to retrieve the full normal matrix
+Eigen::MatrixXd BlockArrowheadNormalEquations::getFullNormalMatrix( ) const
+{
+    Eigen::MatrixXd fullNormalMatrix = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < globalParameterIndices_.size( ); j++ )
+        {
+            fullNormalMatrix( globalParameterIndices_.at( i ), globalParameterIndices_.at( j ) ) = globalNormalMatrix_( i, j );
+        }
+    }
+
+    for( unsigned int k = 0; k < localParameterIndices_.size( ); k++ )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( k );
+        for( unsigned int i = 0; i < currentLocalIndices.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < currentLocalIndices.size( ); j++ )
+            {
+                fullNormalMatrix( currentLocalIndices.at( i ), currentLocalIndices.at( j ) ) = localNormalMatrices_.at( k )( i, j );
+            }
+            for( unsigned int j = 0; j < globalParameterIndices_.size( ); j++ )
+            {
+                fullNormalMatrix( currentLocalIndices.at( i ), globalParameterIndices_.at( j ) ) =
+                        localGlobalNormalMatrices_.at( k )( i, j );
+                fullNormalMatrix( globalParameterIndices_.at( j ), currentLocalIndices.at( i ) ) =
+                        localGlobalNormalMatrices_.at( k )( i, j );
+            }
+        }
+    }
+    return fullNormalMatrix;
+}
+
+//! Function to retrieve the full righthandside of the normal equations
+Eigen::VectorXd BlockArrowheadNormalEquations::getFullRightHandSide( ) const
+{
+    Eigen::VectorXd fullRightHandSide = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        fullRightHandSide( globalParameterIndices_.at( i ) ) = globalRightHandSide_( i );
+    }
+    for( unsigned int k = 0; k < localParameterIndices_.size( ); k++ )
+    {
+        for( unsigned int i = 0; i < localParameterIndices_.at( k ).size( ); i++ )
+        {
+            fullRightHandSide( localParameterIndices_.at( k ).at( i ) ) = localRightHandSides_.at( k )( i );
+        }
+    }
+    return fullRightHandSide;
+}
+
+//! Function to perform an iteration of least squares estimation from (accumulated) block-arrowhead normal equations
+std::pair< Eigen::VectorXd, BlockArrowheadNormalEquations > performLeastSquaresAdjustmentFromBlockArrowheadNormalEquations(
+        BlockArrowheadNormalEquations normalEquations,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const bool useSvdForIllConditionedSystem )
+{
+    if( inverseOfAPrioriCovarianceMatrix.size( ) > 0 )
+    {
+        normalEquations.addInverseAprioriCovariance( inverseOfAPrioriCovarianceMatrix );
+    }
+    Eigen::VectorXd parameterAdjustment = normalEquations.solve(
+                checkConditionNumber, maximumAllowedConditionNumber, useSvdForIllConditionedSystem );
+    return std::make_pair( parameterAdjustment, normalEquations );
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
@@ -57,6 +57,134 @@ Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInv
     return svdDecomposition.solve( rightHandSideVector );
 }
 
+//! Solve symmetric system of equations with (pivoted) LDLT decomposition, checking condition number in the process
+Eigen::VectorXd solveSystemOfEquationsWithCholesky( const Eigen::MatrixXd& matrixToInvert,
+                                                    const Eigen::VectorXd& rightHandSideVector,
+                                                    const bool checkConditionNumber,
+                                                    const double maximumAllowedConditionNumber,
+                                                    const bool useSvdForIllConditionedSystem )
+{
+    Eigen::LDLT< Eigen::MatrixXd > ldltDecomposition( matrixToInvert );
+
+    // Check if decomposition succeeded, and matrix is positive definite
+    bool isDecompositionValid = ( ldltDecomposition.info( ) == Eigen::Success );
+    if( isDecompositionValid && matrixToInvert.rows( ) > 0 )
+    {
+        isDecompositionValid = ( ldltDecomposition.vectorD( ).minCoeff( ) > 0.0 );
+    }
+
+    if( !isDecompositionValid )
+    {
+        if( useSvdForIllConditionedSystem )
+        {
+            return solveSystemOfEquationsWithSvd(
+                        matrixToInvert, rightHandSideVector, checkConditionNumber, maximumAllowedConditionNumber );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when solving system of equations with Cholesky decomposition, "
+                                      "matrix is not positive definite" );
+        }
+    }
+
+    // Check condition number, using estimate of reciprocal condition number from decomposition
+    if( checkConditionNumber || useSvdForIllConditionedSystem )
+    {
+        double conditionNumberEstimate = 1.0 / ldltDecomposition.rcond( );
+        if( conditionNumberEstimate > maximumAllowedConditionNumber )
+        {
+            if( useSvdForIllConditionedSystem )
+            {
+                return solveSystemOfEquationsWithSvd(
+                            matrixToInvert, rightHandSideVector, checkConditionNumber, maximumAllowedConditionNumber );
+            }
+            else if( checkConditionNumber )
+            {
+                std::cerr << "Warning when performing least squares, estimated condition number is "
+                          << conditionNumberEstimate << std::endl;
+            }
+        }
+    }
+
+    return ldltDecomposition.solve( rightHandSideVector );
+}
+
+//! Function to add the contribution of a block of observations to the normal equations
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide )
+{
+    if( designMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ||
+            designMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, sizes of partials, residuals and weights are incompatible" );
+    }
+
+    if( designMatrixBlock.cols( ) != normalMatrix.rows( ) || designMatrixBlock.cols( ) != normalMatrix.cols( ) ||
+            designMatrixBlock.cols( ) != normalRightHandSide.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, sizes of partials and normal equations are incompatible" );
+    }
+
+    // Add contribution (H^T*W*H) to lower triangle of normal matrix, using sqrt(W)*H
+    Eigen::MatrixXd weightedDesignMatrixBlock = multiplyDesignMatrixByDiagonalWeightMatrix(
+                designMatrixBlock, diagonalOfWeightMatrixBlock.cwiseSqrt( ) );
+    normalMatrix.selfadjointView< Eigen::Lower >( ).rankUpdate( weightedDesignMatrixBlock.transpose( ) );
+
+    // Add contribution (H^T*W*y) to righthandside
+    normalRightHandSide.noalias( ) += designMatrixBlock.transpose( ) *
+            ( diagonalOfWeightMatrixBlock.cwiseProduct( observationResidualsBlock ) );
+}
+
+//! Function to set the upper triangle of a normal matrix from its lower triangle
+void symmetrizeNormalMatrix( Eigen::MatrixXd& normalMatrix )
+{
+    normalMatrix.triangularView< Eigen::StrictlyUpper >( ) = normalMatrix.transpose( );
+}
+
+//! Function to add a priori information and linear constraints to the normal equations
+void addAprioriInformationAndConstraintsToNormalEquations(
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    normalMatrix += inverseOfAPrioriCovarianceMatrix;
+
+    // Add constraints to normal equations if required
+    if( constraintMultiplier.rows( ) != 0 )
+    {
+        if( constraintMultiplier.rows( ) != constraintRightHandside.rows( ) )
+        {
+            throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
+        }
+
+        if( constraintMultiplier.cols( ) != normalMatrix.cols( ) )
+        {
+            throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
+        }
+
+        int numberOfConstraints = constraintMultiplier.rows( );
+        int numberOfParameters = constraintMultiplier.cols( );
+
+        normalMatrix.conservativeResize(
+                    numberOfParameters + numberOfConstraints, numberOfParameters + numberOfConstraints );
+        normalMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
+               constraintMultiplier;
+        normalMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
+               constraintMultiplier.transpose( );
+        normalMatrix.block(
+                    numberOfParameters, numberOfParameters, numberOfConstraints, numberOfConstraints ).setZero( );
+
+        normalRightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
+        normalRightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+    }
+}
+
 //! Function to multiply information matrix by diagonal weights matrix
 Eigen::MatrixXd multiplyDesignMatrixByDiagonalWeightMatrix(
         const Eigen::MatrixXd& designMatrix,
@@ -184,6 +312,47 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
                 checkConditionNumber, maximumAllowedConditionNumber );
 }
 
+//! Function to perform an iteration of least squares estimation from (accumulated) normal equations
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& normalRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside,
+        const bool useSvdForIllConditionedSystem )
+{
+    if( normalMatrix.rows( ) != normalRightHandSide.rows( ) || normalMatrix.cols( ) != normalMatrix.rows( ) ||
+            inverseOfAPrioriCovarianceMatrix.rows( ) != normalMatrix.rows( ) ||
+            inverseOfAPrioriCovarianceMatrix.cols( ) != normalMatrix.cols( ) )
+    {
+        throw std::runtime_error( "Error when performing least-squares from normal equations, sizes are incompatible" );
+    }
+
+    Eigen::MatrixXd inverseOfCovarianceMatrix = normalMatrix;
+    Eigen::VectorXd rightHandSide = normalRightHandSide;
+    addAprioriInformationAndConstraintsToNormalEquations(
+                inverseOfCovarianceMatrix, rightHandSide, inverseOfAPrioriCovarianceMatrix,
+                constraintMultiplier, constraintRightHandside );
+
+    // Normal equations augmented with constraints are indefinite, and cannot be solved with Cholesky decomposition
+    Eigen::VectorXd parameterAdjustment;
+    if( constraintMultiplier.rows( ) != 0 )
+    {
+        parameterAdjustment = solveSystemOfEquationsWithSvd(
+                    inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber );
+    }
+    else
+    {
+        parameterAdjustment = solveSystemOfEquationsWithCholesky(
+                    inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber,
+                    useSvdForIllConditionedSystem );
+    }
+
+    return std::make_pair( parameterAdjustment, inverseOfCovarianceMatrix );
+}
+
 //! Function to fit a univariate polynomial through a set of data
 Eigen::VectorXd getLeastSquaresPolynomialFit(
         const Eigen::VectorXd& independentValues,
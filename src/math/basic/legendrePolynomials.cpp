@@ -9,6 +9,7 @@
  *
  */
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -74,6 +75,27 @@ void LegendreCache::update( const double polynomialParameter  )
         currentPolynomialParameterComplement_ = std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
         currentOneOverPolynomialParameterComplement_ = 1.0 / currentPolynomialParameterComplement_;
 
+        // Compute geodesy-normalized polynomials and derivatives in a single pass over all degrees
+        if( useGeodesyNormalization_ )
+        {
+            for( int i = 0; i <= maximumDegree_; i++ )
+            {
+                computeGeodesyLegendrePolynomialsAtDegree(
+                            i, maximumOrder_, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
+                            ( i > 1 ) ? legendreValues_[ degreeOffsets_[ 1 ] + 1 ] : 0.0,
+                            &verticalLegendreValuesComputationMultipliersOne_[ degreeOffsets_[ i ] ],
+                            &verticalLegendreValuesComputationMultipliersTwo_[ degreeOffsets_[ i ] ],
+                            &derivativeNormalizations_[ degreeOffsets_[ i ] ],
+                            ( i > 1 ) ? &legendreValues_[ degreeOffsets_[ i - 1 ] ] : nullptr,
+                            ( i > 1 ) ? &legendreValues_[ degreeOffsets_[ i - 2 ] ] : nullptr,
+                            &legendreValues_[ degreeOffsets_[ i ] ],
+                            &legendreDerivatives_[ degreeOffsets_[ i ] ],
+                            computeSecondDerivatives_ ? &legendreSecondDerivatives_[ degreeOffsets_[ i ] ] : nullptr );
+            }
+            return;
+        }
+
+        // Compute regular (unnormalized) polynomials and derivatives
         LegendreCache& thisReference = *this;
 
         int jMax = -1;
@@ -83,50 +105,26 @@ void LegendreCache::update( const double polynomialParameter  )
             for( int j = 0; j <= jMax ; j++ )
             {
                 // Compute legendre polynomial
-                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] = legendrePolynomialFunction_( i, j, thisReference );
+                legendreValues_[ degreeOffsets_[ i ] + j ] = legendrePolynomialFunction_( i, j, thisReference );
 
                 if( j != 0 )
                 {
                     // Compute legendre polynomial derivative
-                    if( useGeodesyNormalization_ )
-                    {
-                        legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                computeGeodesyLegendrePolynomialDerivative(
-                                    j - 1, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] );
-                    }
-                    else
-                    {
-                        legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                computeLegendrePolynomialDerivative(
-                                    j - 1, currentPolynomialParameter_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] );
-                    }
-
+                    legendreDerivatives_[ degreeOffsets_[ i ] + ( j - 1 ) ] =
+                            computeLegendrePolynomialDerivative(
+                                j - 1, currentPolynomialParameter_,
+                                legendreValues_[ degreeOffsets_[ i ] + ( j - 1 ) ],
+                            legendreValues_[ degreeOffsets_[ i ] + j ] );
                 }
             }
 
             // Compute legendre polynomial derivative for i = j  (if needed)
             if( jMax == i )
             {
-                if( useGeodesyNormalization_ )
-                {
-                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                            computeGeodesyLegendrePolynomialDerivative(
-                                jMax, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                            derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + jMax ] );
-                }
-                else
-                {
-                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ] =
-                            computeLegendrePolynomialDerivative(
-                                jMax, currentPolynomialParameter_,
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0 );
-                }
+                legendreDerivatives_[ degreeOffsets_[ i ] + jMax ] =
+                        computeLegendrePolynomialDerivative(
+                            jMax, currentPolynomialParameter_,
+                            legendreValues_[ degreeOffsets_[ i ] + jMax ], 0.0 );
             }
         }
 
@@ -141,51 +139,24 @@ void LegendreCache::update( const double polynomialParameter  )
                     if( j != 0 )
                     {
                         // Compute legendre polynomial second derivatives
-                        if( useGeodesyNormalization_ )
-                        {
-                            legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeGeodesyLegendrePolynomialSecondDerivative(
-                                        j - 1, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] );
-                        }
-                        else
-                        {
-                            legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeGeodesyLegendrePolynomialSecondDerivative(
-                                        j - 1, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + j ], 1.0 );
-                        }
-
+                        legendreSecondDerivatives_[ degreeOffsets_[ i ] + ( j - 1 ) ] =
+                                computeGeodesyLegendrePolynomialSecondDerivative(
+                                    j - 1, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
+                                    legendreValues_[ degreeOffsets_[ i ] + ( j - 1 ) ],
+                                legendreValues_[ degreeOffsets_[ i ] + j ],
+                                legendreDerivatives_[ degreeOffsets_[ i ] + ( j - 1 ) ],
+                                legendreDerivatives_[ degreeOffsets_[ i ] + j ], 1.0 );
                     }
                 }
                 // Compute legendre polynomial second derivative for i = j  (if needed)
                 if( jMax == i )
                 {
-                    if( useGeodesyNormalization_ )
-                    {
-                        legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                                computeGeodesyLegendrePolynomialSecondDerivative(
-                                    jMax, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + jMax ] );
-                    }
-                    else
-                    {
-                        legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                                computeGeodesyLegendrePolynomialSecondDerivative(
-                                    jMax, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                1.0 );
-                    }
+                    legendreSecondDerivatives_[ degreeOffsets_[ i ] +  jMax ] =
+                            computeGeodesyLegendrePolynomialSecondDerivative(
+                                jMax, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
+                                legendreValues_[ degreeOffsets_[ i ] + jMax ], 0.0,
+                            legendreDerivatives_[ degreeOffsets_[ i ] + jMax ], 0.0,
+                            1.0 );
                 }
 
             }
@@ -204,33 +175,41 @@ void LegendreCache::resetMaximumDegreeAndOrder( const int maximumDegree, const i
         maximumOrder_ = maximumDegree_;
     }
 
-    legendreValues_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-    legendreDerivatives_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-    legendreSecondDerivatives_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    // Set start of each degree in packed triangular layout
+    degreeOffsets_.resize( maximumDegree_ + 2 );
+    for( int i = 0; i <= maximumDegree_ + 1; i++ )
+    {
+        degreeOffsets_[ i ] = getPackedLegendreDegreeOffset( i, maximumOrder_ );
+    }
+    const int numberOfEntries = degreeOffsets_[ maximumDegree_ + 1 ];
 
-    derivativeNormalizations_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    legendreValues_.resize( numberOfEntries );
+    legendreDerivatives_.resize( numberOfEntries );
+    legendreSecondDerivatives_.resize( numberOfEntries );
 
-    verticalLegendreValuesComputationMultipliersOne_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-    verticalLegendreValuesComputationMultipliersTwo_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    derivativeNormalizations_.resize( numberOfEntries );
+
+    verticalLegendreValuesComputationMultipliersOne_.resize( numberOfEntries );
+    verticalLegendreValuesComputationMultipliersTwo_.resize( numberOfEntries );
     for( int i = 0; i <= maximumDegree_; i++ )
     {
         for( int j = 0; ( ( j <= i ) && ( j <= maximumOrder_ ) ) ; j++ )
         {
             // Compute normalization correction factor.
-            derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + j ] = std::sqrt(
+            derivativeNormalizations_[ degreeOffsets_[ i ] + j ] = std::sqrt(
                         ( static_cast< double >( i + j + 1 ) )
                         * ( static_cast< double >( i - j ) ) );
 
             // If order is zero apply multiplication factor.
             if ( j == 0 )
             {
-                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + j ] *= std::sqrt( 0.5 );
+                derivativeNormalizations_[ degreeOffsets_[ i ] + j ] *= std::sqrt( 0.5 );
             }
-            verticalLegendreValuesComputationMultipliersOne_[ i * ( maximumOrder_ + 1 ) + j ] =
+            verticalLegendreValuesComputationMultipliersOne_[ degreeOffsets_[ i ] + j ] =
                     std::sqrt( ( 2.0 * static_cast< double >( i ) + 1.0 )
                                / ( ( static_cast< double >( i + j ) ) *
                                    ( static_cast< double >( i - j ) ) ) );
-            verticalLegendreValuesComputationMultipliersTwo_[ i * ( maximumOrder_ + 1 ) + j ] =
+            verticalLegendreValuesComputationMultipliersTwo_[ degreeOffsets_[ i ] + j ] =
                     std::sqrt( ( static_cast< double >( i + j ) - 1.0 )
                                * ( static_cast< double >( i - j ) - 1.0 )
                                / ( 2.0 * static_cast< double >( i ) - 3.0 ) );
@@ -262,7 +241,7 @@ double LegendreCache::getLegendrePolynomial(
     }
     else
     {
-        return legendreValues_[ degree * ( maximumOrder_ + 1  ) + order ];
+        return legendreValues_[ degreeOffsets_[ degree ] + order ];
     };
 }
 
@@ -286,7 +265,7 @@ double LegendreCache::getLegendrePolynomialDerivative(
     }
     else
     {
-        return legendreDerivatives_[ degree * ( maximumOrder_ + 1  ) + order ];
+        return legendreDerivatives_[ degreeOffsets_[ degree ] + order ];
     };
 }
 
@@ -314,18 +293,18 @@ double LegendreCache::getLegendrePolynomialSecondDerivative(
     }
     else
     {
-        return legendreSecondDerivatives_[ degree * ( maximumOrder_ + 1  ) + order ];
+        return legendreSecondDerivatives_[ degreeOffsets_[ degree ] + order ];
     };
 }
 
 double LegendreCache::getVerticalLegendreValuesComputationMultipliersOne( const int degree, const int order )
 {
-    return verticalLegendreValuesComputationMultipliersOne_[ degree * ( maximumOrder_ + 1 ) + order ];
+    return verticalLegendreValuesComputationMultipliersOne_[ degreeOffsets_[ degree ] + order ];
 }
 
 double LegendreCache::getVerticalLegendreValuesComputationMultipliersTwo( const int degree, const int order )
 {
-    return verticalLegendreValuesComputationMultipliersTwo_[ degree * ( maximumOrder_ + 1 ) + order ];
+    return verticalLegendreValuesComputationMultipliersTwo_[ degreeOffsets_[ degree ] + order ];
 }
 
 //! Compute unnormalized associated Legendre polynomial.
@@ -807,6 +786,78 @@ double computeGeodesyLegendrePolynomialVertical( const int degree,
                 oneDegreePriorPolynomial, twoDegreesPriorPolynomial );
 }
 
+//! Compute geodesy-normalized Legendre polynomials, and their derivatives, at a single degree.
+void computeGeodesyLegendrePolynomialsAtDegree(
+        const int degree,
+        const int maximumOrder,
+        const double polynomialParameter,
+        const double oneOverPolynomialParameterComplement,
+        const double degreeOneOrderOnePolynomial,
+        const double* firstVerticalMultipliers,
+        const double* secondVerticalMultipliers,
+        const double* derivativeNormalizations,
+        const double* previousDegreeValues,
+        const double* secondPreviousDegreeValues,
+        double* currentDegreeValues,
+        double* currentDegreeDerivatives,
+        double* currentDegreeSecondDerivatives )
+{
+    const int maximumOrderAtDegree = std::min( degree, maximumOrder );
+
+    // Compute Legendre polynomials
+    if( degree <= 1 )
+    {
+        for( int order = 0; order <= maximumOrderAtDegree; order++ )
+        {
+            currentDegreeValues[ order ] = computeGeodesyLegendrePolynomialExplicit( degree, order, polynomialParameter );
+        }
+    }
+    else
+    {
+        const double degreeMultiplier = std::sqrt( 2.0 * static_cast< double >( degree ) - 1.0 );
+        for( int order = 0; order <= maximumOrderAtDegree; order++ )
+        {
+            if( order == degree )
+            {
+                currentDegreeValues[ order ] = std::sqrt( ( 2.0 * static_cast< double >( degree ) + 1.0 )
+                                                          / ( 6.0 * static_cast< double >( degree ) ) )
+                        * degreeOneOrderOnePolynomial * previousDegreeValues[ order - 1 ];
+            }
+            else
+            {
+                // Polynomial at two degrees prior is zero if order exceeds its degree
+                currentDegreeValues[ order ] = firstVerticalMultipliers[ order ] *
+                        ( degreeMultiplier * polynomialParameter * previousDegreeValues[ order ]
+                          - secondVerticalMultipliers[ order ] *
+                          ( ( order <= degree - 2 ) ? secondPreviousDegreeValues[ order ] : 0.0 ) );
+            }
+        }
+    }
+
+    // Compute Legendre polynomial derivatives (at maximum order only if it is equal to degree)
+    const int maximumDerivativeOrder = ( maximumOrderAtDegree == degree ) ? degree : maximumOrderAtDegree - 1;
+    for( int order = 0; order <= maximumDerivativeOrder; order++ )
+    {
+        currentDegreeDerivatives[ order ] = computeGeodesyLegendrePolynomialDerivative(
+                    order, polynomialParameter, oneOverPolynomialParameterComplement,
+                    currentDegreeValues[ order ], ( order < degree ) ? currentDegreeValues[ order + 1 ] : 0.0,
+                    derivativeNormalizations[ order ] );
+    }
+
+    // Compute Legendre polynomial second derivatives, if required
+    if( currentDegreeSecondDerivatives != nullptr )
+    {
+        for( int order = 0; order <= maximumDerivativeOrder; order++ )
+        {
+            currentDegreeSecondDerivatives[ order ] = computeGeodesyLegendrePolynomialSecondDerivative(
+                        order, polynomialParameter, oneOverPolynomialParameterComplement,
+                        currentDegreeValues[ order ], ( order < degree ) ? currentDegreeValues[ order + 1 ] : 0.0,
+                        currentDegreeDerivatives[ order ], ( order < degree ) ? currentDegreeDerivatives[ order + 1 ] : 0.0,
+                        derivativeNormalizations[ order ] );
+        }
+    }
+}
+
 //! Function to calculate the normalization factor for Legendre polynomials to geodesy-normalized.
 double calculateLegendreGeodesyNormalizationFactor( const int degree, const int order )
 {
@@ -9,6 +9,9 @@
  *
  */
 
+#include <algorithm>
+
+#include "tudat/basics/utilities.h"
 #include "tudat/math/basic/polyhedron.h"
 
 namespace tudat
@@ -16,6 +19,40 @@ namespace tudat
 namespace basic_mathematics
 {
 
+//! Function to get the number of blocks of polyhedronSummationBlockSize terms into which a polyhedron summation is split.
+int getNumberOfPolyhedronSummationBlocks( const int numberOfTerms )
+{
+    return ( numberOfTerms + polyhedronSummationBlockSize - 1 ) / polyhedronSummationBlockSize;
+}
+
+//! Function to evaluate a polyhedron summation in blocks of polyhedronSummationBlockSize terms, distributed over threads.
+/*!
+ * Function to evaluate a polyhedron summation in blocks of polyhedronSummationBlockSize terms, distributed over threads.
+ * The blockFunction is called as blockFunction( startIndex, endIndex, blockIndex ) for each block of terms, with
+ * endIndex exclusive. Since the blocks do not depend on the number of threads, partial sums that are stored per block
+ * and combined in order of blockIndex give results that are identical for any number of threads.
+ * \param numberOfTerms Number of terms in summation
+ * \param numberOfThreads Maximum number of threads that are to be used
+ * \param threadPool Pool of threads that is to be used (nullptr if threads are to be started)
+ * \param blockFunction Function that is to be evaluated for each block of terms
+ */
+template< typename BlockFunction >
+void parallelForEachPolyhedronSummationBlock(
+        const int numberOfTerms, const int numberOfThreads, utilities::ThreadPool* threadPool,
+        const BlockFunction& blockFunction )
+{
+    utilities::parallelForEachBlock(
+                getNumberOfPolyhedronSummationBlocks( numberOfTerms ), numberOfThreads,
+                [ & ]( const int startBlock, const int endBlock, const int )
+    {
+        for( int block = startBlock; block < endBlock; block++ )
+        {
+            blockFunction( block * polyhedronSummationBlockSize,
+                           std::min( ( block + 1 ) * polyhedronSummationBlockSize, numberOfTerms ), block );
+        }
+    }, minimumPolyhedronIterationsPerThread / polyhedronSummationBlockSize, threadPool );
+}
+
 void checkValidityOfPolyhedronSettings( const Eigen::MatrixXd& verticesCoordinates,
                                         const Eigen::MatrixXi& verticesDefiningEachFacet )
 {
@@ -78,68 +115,129 @@ void calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint (
     }
 }
 
+void packPolyhedronDyad(
+        PackedPolyhedronDyads& packedDyads,
+        const int dyadIndex,
+        const Eigen::Matrix3d& dyad )
+{
+    packedDyads( dyadIndex, 0 ) = dyad( 0, 0 );
+    packedDyads( dyadIndex, 1 ) = dyad( 0, 1 );
+    packedDyads( dyadIndex, 2 ) = dyad( 0, 2 );
+    packedDyads( dyadIndex, 3 ) = dyad( 1, 1 );
+    packedDyads( dyadIndex, 4 ) = dyad( 1, 2 );
+    packedDyads( dyadIndex, 5 ) = dyad( 2, 2 );
+}
+
+void packPolyhedronDyads(
+        PackedPolyhedronDyads& packedDyads,
+        const std::vector< Eigen::MatrixXd >& dyads )
+{
+    packedDyads.resize( dyads.size( ), 6 );
+    for ( unsigned int i = 0; i < dyads.size( ); ++i )
+    {
+        if ( dyads.at( i ).rows( ) != 3 || dyads.at( i ).cols( ) != 3 )
+        {
+            throw std::runtime_error( "Error when packing polyhedron dyads: dyad " + std::to_string( i ) +
+                                      " is not a 3x3 matrix." );
+        }
+        packPolyhedronDyad( packedDyads, i, dyads.at( i ) );
+    }
+}
+
+std::vector< Eigen::MatrixXd > unpackPolyhedronDyads( const PackedPolyhedronDyads& packedDyads )
+{
+    std::vector< Eigen::MatrixXd > dyads( packedDyads.rows( ) );
+    for ( unsigned int i = 0; i < dyads.size( ); ++i )
+    {
+        dyads.at( i ) = ( Eigen::Matrix3d( ) <<
+                          packedDyads( i, 0 ), packedDyads( i, 1 ), packedDyads( i, 2 ),
+                          packedDyads( i, 1 ), packedDyads( i, 3 ), packedDyads( i, 4 ),
+                          packedDyads( i, 2 ), packedDyads( i, 4 ), packedDyads( i, 5 ) ).finished( );
+    }
+    return dyads;
+}
+
 void calculatePolyhedronPerFacetFactor (
         Eigen::VectorXd& perFacetFactor,
         const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
-        const Eigen::MatrixXi& verticesDefiningEachFacet)
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int numberOfThreads,
+        utilities::ThreadPool* threadPool )
 {
     const unsigned int numberOfFacets = verticesDefiningEachFacet.rows();
     perFacetFactor.resize(numberOfFacets);
 
-    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    // Facets are independent, so that the result does not depend on the number of threads
+    utilities::parallelForEachBlock(
+                numberOfFacets, numberOfThreads, [ & ]( const int startFacet, const int endFacet, const int )
     {
-        // Rename position vectors of each facet's vertices relative to field point
-        const Eigen::Vector3d relPosI = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,0),0);
-        const Eigen::Vector3d relPosJ = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,1),0);
-        const Eigen::Vector3d relPosK = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,2),0);
-
-        const double numerator = relPosI.dot( relPosJ.cross(relPosK) );
-        if ( numerator == 0 )
-        {
-            perFacetFactor(facet) = 0;
-        }
-        else
+        for ( int facet = startFacet; facet < endFacet; ++facet )
         {
-            perFacetFactor(facet) = 2.0 * atan2( numerator,
-                ( relPosI.norm() * relPosJ.norm() * relPosK.norm() + relPosI.norm() * relPosJ.dot(relPosK) +
-                  relPosJ.norm() * relPosK.dot(relPosI) + relPosK.norm() * relPosI.dot(relPosJ) ) );
-        }
+            // Rename position vectors of each facet's vertices relative to field point
+            const Eigen::Vector3d relPosI = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,0),0);
+            const Eigen::Vector3d relPosJ = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,1),0);
+            const Eigen::Vector3d relPosK = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,2),0);
 
-    }
+            const double numerator = relPosI.dot( relPosJ.cross(relPosK) );
+            if ( numerator == 0 )
+            {
+                perFacetFactor(facet) = 0;
+            }
+            else
+            {
+                const double normI = relPosI.norm();
+                const double normJ = relPosJ.norm();
+                const double normK = relPosK.norm();
+                perFacetFactor(facet) = 2.0 * atan2( numerator,
+                    ( normI * normJ * normK + normI * relPosJ.dot(relPosK) +
+                      normJ * relPosK.dot(relPosI) + normK * relPosI.dot(relPosJ) ) );
+            }
+        }
+    }, minimumPolyhedronIterationsPerThread, threadPool );
 
 }
 
 void calculatePolyhedronPerEdgeFactor (
         Eigen::VectorXd& perEdgeFactor,
         const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
-        const Eigen::MatrixXi& verticesDefiningEachEdge)
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const int numberOfThreads,
+        utilities::ThreadPool* threadPool )
 {
     const unsigned int numberOfEdges = verticesDefiningEachEdge.rows();
     perEdgeFactor.resize(numberOfEdges);
 
-    for ( unsigned int edge = 0; edge < numberOfEdges; ++edge )
+    // Edges are independent, so that the result does not depend on the number of threads
+    utilities::parallelForEachBlock(
+                numberOfEdges, numberOfThreads, [ & ]( const int startEdge, const int endEdge, const int )
     {
-        // Rename position vectors of each edge's vertices relative to field point
-        const Eigen::Vector3d relPosI = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,0),0);
-        const Eigen::Vector3d relPosJ = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,1),0);
-
-        // Compute edge vector
-        const Eigen::Vector3d eIJ = relPosI - relPosJ;
-
-        // Selection of the edgeFactor to be 0 is only valid when computing the potential and the derivative of the
-        // potential, not when computing the 2nd derivative! See "The solid angle hidden in polyhedron gravitation
-        // formulations", Werner (2017), appendix C1
-        const double denominator = relPosI.norm() + relPosJ.norm() - eIJ.norm();
-        if ( std::abs(denominator) <  1e-18 )
+        for ( int edge = startEdge; edge < endEdge; ++edge )
         {
-            perEdgeFactor(edge) = 0;
-        }
-        else
-        {
-            perEdgeFactor(edge) = log( (relPosI.norm() + relPosJ.norm() + eIJ.norm()) / denominator );
+            // Rename position vectors of each edge's vertices relative to field point
+            const Eigen::Vector3d relPosI = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,0),0);
+            const Eigen::Vector3d relPosJ = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,1),0);
+
+            // Compute edge vector
+            const Eigen::Vector3d eIJ = relPosI - relPosJ;
+
+            const double normI = relPosI.norm();
+            const double normJ = relPosJ.norm();
+            const double normIJ = eIJ.norm();
+
+            // Selection of the edgeFactor to be 0 is only valid when computing the potential and the derivative of the
+            // potential, not when computing the 2nd derivative! See "The solid angle hidden in polyhedron gravitation
+            // formulations", Werner (2017), appendix C1
+            const double denominator = normI + normJ - normIJ;
+            if ( std::abs(denominator) <  1e-18 )
+            {
+                perEdgeFactor(edge) = 0;
+            }
+            else
+            {
+                perEdgeFactor(edge) = log( (normI + normJ + normIJ) / denominator );
+            }
         }
-
-    }
+    }, minimumPolyhedronIterationsPerThread, threadPool );
 }
 
 double calculatePolyhedronGravitationalPotential(
@@ -218,6 +316,192 @@ Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential(
     return - gravitationalConstantTimesDensity * (perEdgeSum - perFacetSum);
 }
 
+double calculatePolyhedronGravitationalPotential(
+        const double gravitationalConstantTimesDensity,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const PackedPolyhedronDyads& facetDyads,
+        const PackedPolyhedronDyads& edgeDyads,
+        const Eigen::VectorXd& perFacetFactor,
+        const Eigen::VectorXd& perEdgeFactor,
+        const int numberOfThreads,
+        utilities::ThreadPool* threadPool )
+{
+    const int numberOfFacets = verticesDefiningEachFacet.rows();
+    const int numberOfEdges = verticesDefiningEachEdge.rows();
+
+    // Columns with x, y and z components of vertices relative to field point
+    const double* relativeX = verticesCoordinatesRelativeToFieldPoint.col( 0 ).data( );
+    const double* relativeY = verticesCoordinatesRelativeToFieldPoint.col( 1 ).data( );
+    const double* relativeZ = verticesCoordinatesRelativeToFieldPoint.col( 2 ).data( );
+
+    // Partial sums per block of polyhedronSummationBlockSize terms, combined in fixed order below
+    const int numberOfEdgeBlocks = getNumberOfPolyhedronSummationBlocks( numberOfEdges );
+    const int numberOfFacetBlocks = getNumberOfPolyhedronSummationBlocks( numberOfFacets );
+    std::vector< double > perEdgeSums( numberOfEdgeBlocks, 0.0 );
+    std::vector< double > perFacetSums( numberOfFacetBlocks, 0.0 );
+
+    // Loop over edges
+    parallelForEachPolyhedronSummationBlock(
+                numberOfEdges, numberOfThreads, threadPool, [ & ]( const int startEdge, const int endEdge, const int block )
+    {
+        const double* dyadXX = edgeDyads.col( 0 ).data( );
+        const double* dyadXY = edgeDyads.col( 1 ).data( );
+        const double* dyadXZ = edgeDyads.col( 2 ).data( );
+        const double* dyadYY = edgeDyads.col( 3 ).data( );
+        const double* dyadYZ = edgeDyads.col( 4 ).data( );
+        const double* dyadZZ = edgeDyads.col( 5 ).data( );
+        const int* edgeVertices = verticesDefiningEachEdge.col( 0 ).data( );
+
+        double blockSum = 0.0;
+        for ( int edge = startEdge; edge < endEdge; ++edge )
+        {
+            const int vertex = edgeVertices[ edge ];
+            const double x = relativeX[ vertex ], y = relativeY[ vertex ], z = relativeZ[ vertex ];
+            blockSum += ( x * ( dyadXX[ edge ] * x + dyadXY[ edge ] * y + dyadXZ[ edge ] * z ) +
+                          y * ( dyadXY[ edge ] * x + dyadYY[ edge ] * y + dyadYZ[ edge ] * z ) +
+                          z * ( dyadXZ[ edge ] * x + dyadYZ[ edge ] * y + dyadZZ[ edge ] * z ) ) * perEdgeFactor( edge );
+        }
+        perEdgeSums[ block ] = blockSum;
+    } );
+
+    // Loop over facets
+    parallelForEachPolyhedronSummationBlock(
+                numberOfFacets, numberOfThreads, threadPool, [ & ]( const int startFacet, const int endFacet, const int block )
+    {
+        const double* dyadXX = facetDyads.col( 0 ).data( );
+        const double* dyadXY = facetDyads.col( 1 ).data( );
+        const double* dyadXZ = facetDyads.col( 2 ).data( );
+        const double* dyadYY = facetDyads.col( 3 ).data( );
+        const double* dyadYZ = facetDyads.col( 4 ).data( );
+        const double* dyadZZ = facetDyads.col( 5 ).data( );
+        const int* facetVertices = verticesDefiningEachFacet.col( 0 ).data( );
+
+        double blockSum = 0.0;
+        for ( int facet = startFacet; facet < endFacet; ++facet )
+        {
+            const int vertex = facetVertices[ facet ];
+            const double x = relativeX[ vertex ], y = relativeY[ vertex ], z = relativeZ[ vertex ];
+            blockSum += ( x * ( dyadXX[ facet ] * x + dyadXY[ facet ] * y + dyadXZ[ facet ] * z ) +
+                          y * ( dyadXY[ facet ] * x + dyadYY[ facet ] * y + dyadYZ[ facet ] * z ) +
+                          z * ( dyadXZ[ facet ] * x + dyadYZ[ facet ] * y + dyadZZ[ facet ] * z ) ) * perFacetFactor( facet );
+        }
+        perFacetSums[ block ] = blockSum;
+    } );
+
+    double perEdgeSum = 0.0, perFacetSum = 0.0;
+    for ( int block = 0; block < numberOfEdgeBlocks; ++block )
+    {
+        perEdgeSum += perEdgeSums[ block ];
+    }
+    for ( int block = 0; block < numberOfFacetBlocks; ++block )
+    {
+        perFacetSum += perFacetSums[ block ];
+    }
+
+    return 0.5 * gravitationalConstantTimesDensity * ( perEdgeSum - perFacetSum);
+}
+
+Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential(
+        const double gravitationalConstantTimesDensity,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const PackedPolyhedronDyads& facetDyads,
+        const PackedPolyhedronDyads& edgeDyads,
+        const Eigen::VectorXd& perFacetFactor,
+        const Eigen::VectorXd& perEdgeFactor,
+        const int numberOfThreads,
+        utilities::ThreadPool* threadPool )
+{
+    const int numberOfFacets = verticesDefiningEachFacet.rows();
+    const int numberOfEdges = verticesDefiningEachEdge.rows();
+
+    // Columns with x, y and z components of vertices relative to field point
+    const double* relativeX = verticesCoordinatesRelativeToFieldPoint.col( 0 ).data( );
+    const double* relativeY = verticesCoordinatesRelativeToFieldPoint.col( 1 ).data( );
+    const double* relativeZ = verticesCoordinatesRelativeToFieldPoint.col( 2 ).data( );
+
+    // Partial sums per block of polyhedronSummationBlockSize terms, combined in fixed order below
+    const int numberOfEdgeBlocks = getNumberOfPolyhedronSummationBlocks( numberOfEdges );
+    const int numberOfFacetBlocks = getNumberOfPolyhedronSummationBlocks( numberOfFacets );
+    std::vector< Eigen::Vector3d > perEdgeSums( numberOfEdgeBlocks, Eigen::Vector3d::Zero( ) );
+    std::vector< Eigen::Vector3d > perFacetSums( numberOfFacetBlocks, Eigen::Vector3d::Zero( ) );
+
+    // Loop over edges
+    parallelForEachPolyhedronSummationBlock(
+                numberOfEdges, numberOfThreads, threadPool, [ & ]( const int startEdge, const int endEdge, const int block )
+    {
+        const double* dyadXX = edgeDyads.col( 0 ).data( );
+        const double* dyadXY = edgeDyads.col( 1 ).data( );
+        const double* dyadXZ = edgeDyads.col( 2 ).data( );
+        const double* dyadYY = edgeDyads.col( 3 ).data( );
+        const double* dyadYZ = edgeDyads.col( 4 ).data( );
+        const double* dyadZZ = edgeDyads.col( 5 ).data( );
+        const int* firstEdgeVertices = verticesDefiningEachEdge.col( 0 ).data( );
+        const int* secondEdgeVertices = verticesDefiningEachEdge.col( 1 ).data( );
+
+        double sumX = 0.0, sumY = 0.0, sumZ = 0.0;
+        for ( int edge = startEdge; edge < endEdge; ++edge )
+        {
+            const int vertex0 = firstEdgeVertices[ edge ];
+            const int vertex1 = secondEdgeVertices[ edge ];
+            const double x = ( relativeX[ vertex0 ] + relativeX[ vertex1 ] ) / 2;
+            const double y = ( relativeY[ vertex0 ] + relativeY[ vertex1 ] ) / 2;
+            const double z = ( relativeZ[ vertex0 ] + relativeZ[ vertex1 ] ) / 2;
+
+            sumX += ( dyadXX[ edge ] * x + dyadXY[ edge ] * y + dyadXZ[ edge ] * z ) * perEdgeFactor( edge );
+            sumY += ( dyadXY[ edge ] * x + dyadYY[ edge ] * y + dyadYZ[ edge ] * z ) * perEdgeFactor( edge );
+            sumZ += ( dyadXZ[ edge ] * x + dyadYZ[ edge ] * y + dyadZZ[ edge ] * z ) * perEdgeFactor( edge );
+        }
+        perEdgeSums[ block ] << sumX, sumY, sumZ;
+    } );
+
+    // Loop over facets
+    parallelForEachPolyhedronSummationBlock(
+                numberOfFacets, numberOfThreads, threadPool, [ & ]( const int startFacet, const int endFacet, const int block )
+    {
+        const double* dyadXX = facetDyads.col( 0 ).data( );
+        const double* dyadXY = facetDyads.col( 1 ).data( );
+        const double* dyadXZ = facetDyads.col( 2 ).data( );
+        const double* dyadYY = facetDyads.col( 3 ).data( );
+        const double* dyadYZ = facetDyads.col( 4 ).data( );
+        const double* dyadZZ = facetDyads.col( 5 ).data( );
+        const int* firstFacetVertices = verticesDefiningEachFacet.col( 0 ).data( );
+        const int* secondFacetVertices = verticesDefiningEachFacet.col( 1 ).data( );
+        const int* thirdFacetVertices = verticesDefiningEachFacet.col( 2 ).data( );
+
+        double sumX = 0.0, sumY = 0.0, sumZ = 0.0;
+        for ( int facet = startFacet; facet < endFacet; ++facet )
+        {
+            const int vertex0 = firstFacetVertices[ facet ];
+            const int vertex1 = secondFacetVertices[ facet ];
+            const int vertex2 = thirdFacetVertices[ facet ];
+            const double x = ( relativeX[ vertex0 ] + relativeX[ vertex1 ] + relativeX[ vertex2 ] ) / 3.0;
+            const double y = ( relativeY[ vertex0 ] + relativeY[ vertex1 ] + relativeY[ vertex2 ] ) / 3.0;
+            const double z = ( relativeZ[ vertex0 ] + relativeZ[ vertex1 ] + relativeZ[ vertex2 ] ) / 3.0;
+
+            sumX += ( dyadXX[ facet ] * x + dyadXY[ facet ] * y + dyadXZ[ facet ] * z ) * perFacetFactor( facet );
+            sumY += ( dyadXY[ facet ] * x + dyadYY[ facet ] * y + dyadYZ[ facet ] * z ) * perFacetFactor( facet );
+            sumZ += ( dyadXZ[ facet ] * x + dyadYZ[ facet ] * y + dyadZZ[ facet ] * z ) * perFacetFactor( facet );
+        }
+        perFacetSums[ block ] << sumX, sumY, sumZ;
+    } );
+
+    Eigen::Vector3d perEdgeSum = Eigen::Vector3d::Zero( ), perFacetSum = Eigen::Vector3d::Zero( );
+    for ( int block = 0; block < numberOfEdgeBlocks; ++block )
+    {
+        perEdgeSum += perEdgeSums[ block ];
+    }
+    for ( int block = 0; block < numberOfFacetBlocks; ++block )
+    {
+        perFacetSum += perFacetSums[ block ];
+    }
+
+    return - gravitationalConstantTimesDensity * (perEdgeSum - perFacetSum);
+}
+
 Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential(
         const double gravitationalConstantTimesDensity,
         const std::vector< Eigen::MatrixXd >& facetDyads,
@@ -252,6 +536,48 @@ Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential(
     return gravitationalConstantTimesDensity * (perEdgeSum - perFacetSum);
 }
 
+Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential(
+        const double gravitationalConstantTimesDensity,
+        const PackedPolyhedronDyads& facetDyads,
+        const PackedPolyhedronDyads& edgeDyads,
+        const Eigen::VectorXd& perFacetFactor,
+        const Eigen::VectorXd& perEdgeFactor)
+{
+    // When computing the per edge factor, it is taken to be 0 at edges singularities (see function
+    // calculatePolyhedronPerEdgeFactor, and reference within). This is not valid when computing the hessian matrix!
+    if ( ( perEdgeFactor.array( ) == 0.0 ).any( ) )
+    {
+        throw std::runtime_error( "Computation of hessian matrix has a singularity for points at edges." );
+    }
+
+    const int numberOfFacets = facetDyads.rows( );
+    const int numberOfEdges = edgeDyads.rows( );
+    Eigen::Matrix< double, 1, 6 > perEdgeSum, perFacetSum;
+    perEdgeSum.setZero( );
+    perFacetSum.setZero( );
+
+    // Loop over edges
+    for ( int edge = 0; edge < numberOfEdges; ++edge )
+    {
+        perEdgeSum += edgeDyads.row( edge ) * perEdgeFactor( edge );
+    }
+
+    // Loop over facets
+    for ( int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        perFacetSum += facetDyads.row( facet ) * perFacetFactor( facet );
+    }
+
+    // Unpack weighted sums of upper triangular dyad entries
+    const Eigen::Matrix< double, 1, 6 > packedSum = perEdgeSum - perFacetSum;
+    Eigen::Matrix3d hessian;
+    hessian << packedSum( 0 ), packedSum( 1 ), packedSum( 2 ),
+            packedSum( 1 ), packedSum( 3 ), packedSum( 4 ),
+            packedSum( 2 ), packedSum( 4 ), packedSum( 5 );
+
+    return gravitationalConstantTimesDensity * hessian;
+}
+
 double calculatePolyhedronLaplacianOfGravitationalPotential(
         const double gravitationalConstantTimesDensity,
         const Eigen::VectorXd& perFacetFactor)
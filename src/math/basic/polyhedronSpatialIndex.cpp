@@ -0,0 +1,380 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+#include "tudat/math/basic/polyhedron.h"
+#include "tudat/math/basic/polyhedronSpatialIndex.h"
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+Eigen::Vector3d computeClosestPointOnTriangle( const Eigen::Vector3d& point,
+                                               const Eigen::Vector3d& vertex0,
+                                               const Eigen::Vector3d& vertex1,
+                                               const Eigen::Vector3d& vertex2,
+                                               int& closestFeature )
+{
+    // Check if point is in vertex region outside vertex 0
+    Eigen::Vector3d edge01 = vertex1 - vertex0;
+    Eigen::Vector3d edge02 = vertex2 - vertex0;
+    Eigen::Vector3d vertex0ToPoint = point - vertex0;
+    double d1 = edge01.dot( vertex0ToPoint );
+    double d2 = edge02.dot( vertex0ToPoint );
+    if( d1 <= 0.0 && d2 <= 0.0 )
+    {
+        closestFeature = 0;
+        return vertex0;
+    }
+
+    // Check if point is in vertex region outside vertex 1
+    Eigen::Vector3d vertex1ToPoint = point - vertex1;
+    double d3 = edge01.dot( vertex1ToPoint );
+    double d4 = edge02.dot( vertex1ToPoint );
+    if( d3 >= 0.0 && d4 <= d3 )
+    {
+        closestFeature = 1;
+        return vertex1;
+    }
+
+    // Check if point is in edge region of edge 0-1
+    double vc = d1 * d4 - d3 * d2;
+    if( vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0 )
+    {
+        closestFeature = 3;
+        return vertex0 + d1 / ( d1 - d3 ) * edge01;
+    }
+
+    // Check if point is in vertex region outside vertex 2
+    Eigen::Vector3d vertex2ToPoint = point - vertex2;
+    double d5 = edge01.dot( vertex2ToPoint );
+    double d6 = edge02.dot( vertex2ToPoint );
+    if( d6 >= 0.0 && d5 <= d6 )
+    {
+        closestFeature = 2;
+        return vertex2;
+    }
+
+    // Check if point is in edge region of edge 2-0
+    double vb = d5 * d2 - d1 * d6;
+    if( vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0 )
+    {
+        closestFeature = 5;
+        return vertex0 + d2 / ( d2 - d6 ) * edge02;
+    }
+
+    // Check if point is in edge region of edge 1-2
+    double va = d3 * d6 - d5 * d4;
+    if( va <= 0.0 && ( d4 - d3 ) >= 0.0 && ( d5 - d6 ) >= 0.0 )
+    {
+        closestFeature = 4;
+        return vertex1 + ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) ) * ( vertex2 - vertex1 );
+    }
+
+    // Point is inside face region
+    closestFeature = 6;
+    double denominator = 1.0 / ( va + vb + vc );
+    return vertex0 + edge01 * ( vb * denominator ) + edge02 * ( vc * denominator );
+}
+
+//! Constructor
+PolyhedronSpatialIndex::PolyhedronSpatialIndex( const Eigen::MatrixXd& verticesCoordinates,
+                                                const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                const int maximumPrimitivesPerLeaf ):
+    verticesCoordinates_( verticesCoordinates ),
+    verticesDefiningEachFacet_( verticesDefiningEachFacet ),
+    maximumPrimitivesPerLeaf_( std::max( 1, maximumPrimitivesPerLeaf ) )
+{
+    checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
+
+    const int numberOfVertices = verticesCoordinates_.rows( );
+    const int numberOfFacets = verticesDefiningEachFacet_.rows( );
+
+    // Build hierarchy over vertices
+    std::vector< Eigen::AlignedBox3d > primitiveBoxes( numberOfVertices );
+    for( int vertex = 0; vertex < numberOfVertices; vertex++ )
+    {
+        Eigen::Vector3d vertexCoordinates = verticesCoordinates_.block< 1, 3 >( vertex, 0 ).transpose( );
+        primitiveBoxes.at( vertex ) = Eigen::AlignedBox3d( vertexCoordinates, vertexCoordinates );
+    }
+    buildHierarchy( primitiveBoxes, vertexNodes_, sortedVertices_ );
+
+    // Build hierarchy over facets, and compute facet normals
+    primitiveBoxes.resize( numberOfFacets );
+    facetNormals_.resize( numberOfFacets );
+    for( int facet = 0; facet < numberOfFacets; facet++ )
+    {
+        primitiveBoxes.at( facet ).setEmpty( );
+        for( int i = 0; i < 3; i++ )
+        {
+            primitiveBoxes.at( facet ).extend(
+                        verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, i ), 0 ).transpose( ) );
+        }
+
+        Eigen::Vector3d vertex0 = verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 0 ), 0 );
+        Eigen::Vector3d vertex1 = verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 1 ), 0 );
+        Eigen::Vector3d vertex2 = verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 2 ), 0 );
+        facetNormals_.at( facet ) = ( vertex1 - vertex0 ).cross( vertex2 - vertex1 );
+        if( facetNormals_.at( facet ).norm( ) > 0.0 )
+        {
+            facetNormals_.at( facet ).normalize( );
+        }
+    }
+    buildHierarchy( primitiveBoxes, facetNodes_, sortedFacets_ );
+
+    // Compute angle weighted vertex pseudo-normals, and sum of facet normals adjacent to each edge
+    vertexPseudoNormals_.assign( numberOfVertices, Eigen::Vector3d::Zero( ) );
+    std::map< std::pair< int, int >, Eigen::Vector3d > edgeNormalSums;
+    for( int facet = 0; facet < numberOfFacets; facet++ )
+    {
+        for( int i = 0; i < 3; i++ )
+        {
+            int currentVertex = verticesDefiningEachFacet_( facet, i );
+            int nextVertex = verticesDefiningEachFacet_( facet, ( i + 1 ) % 3 );
+            int previousVertex = verticesDefiningEachFacet_( facet, ( i + 2 ) % 3 );
+
+            Eigen::Vector3d toNextVertex = ( verticesCoordinates_.row( nextVertex ) -
+                                             verticesCoordinates_.row( currentVertex ) ).transpose( );
+            Eigen::Vector3d toPreviousVertex = ( verticesCoordinates_.row( previousVertex ) -
+                                                 verticesCoordinates_.row( currentVertex ) ).transpose( );
+            double vertexAngle = std::atan2( toNextVertex.cross( toPreviousVertex ).norm( ),
+                                             toNextVertex.dot( toPreviousVertex ) );
+            vertexPseudoNormals_.at( currentVertex ) += vertexAngle * facetNormals_.at( facet );
+
+            std::pair< int, int > edgeKey = std::make_pair( std::min( currentVertex, nextVertex ),
+                                                            std::max( currentVertex, nextVertex ) );
+            if( edgeNormalSums.count( edgeKey ) == 0 )
+            {
+                edgeNormalSums[ edgeKey ] = Eigen::Vector3d::Zero( );
+            }
+            edgeNormalSums[ edgeKey ] += facetNormals_.at( facet );
+        }
+    }
+
+    // Store edge pseudo-normals per facet
+    edgePseudoNormals_.resize( 3 * numberOfFacets );
+    for( int facet = 0; facet < numberOfFacets; facet++ )
+    {
+        for( int i = 0; i < 3; i++ )
+        {
+            int currentVertex = verticesDefiningEachFacet_( facet, i );
+            int nextVertex = verticesDefiningEachFacet_( facet, ( i + 1 ) % 3 );
+            edgePseudoNormals_.at( 3 * facet + i ) = edgeNormalSums.at(
+                        std::make_pair( std::min( currentVertex, nextVertex ), std::max( currentVertex, nextVertex ) ) );
+        }
+    }
+}
+
+//! Computes the distance to the vertex closest to the given point.
+double PolyhedronSpatialIndex::computeDistanceToClosestVertex( const Eigen::Vector3d& point, int& closestVertex ) const
+{
+    double minimumSquaredDistance = std::numeric_limits< double >::infinity( );
+    closestVertex = -1;
+
+    std::vector< int > nodesToVisit;
+    nodesToVisit.push_back( 0 );
+    while( !nodesToVisit.empty( ) )
+    {
+        const BoundingVolumeNode& currentNode = vertexNodes_[ nodesToVisit.back( ) ];
+        nodesToVisit.pop_back( );
+
+        if( currentNode.boundingBox.squaredExteriorDistance( point ) >= minimumSquaredDistance )
+        {
+            continue;
+        }
+
+        if( currentNode.firstChild < 0 )
+        {
+            for( int i = currentNode.firstPrimitive; i < currentNode.firstPrimitive + currentNode.numberOfPrimitives; i++ )
+            {
+                int vertex = sortedVertices_[ i ];
+                double squaredDistance = ( verticesCoordinates_.block< 1, 3 >( vertex, 0 ).transpose( ) - point ).squaredNorm( );
+                if( squaredDistance < minimumSquaredDistance ||
+                        ( squaredDistance == minimumSquaredDistance && vertex < closestVertex ) )
+                {
+                    minimumSquaredDistance = squaredDistance;
+                    closestVertex = vertex;
+                }
+            }
+        }
+        else
+        {
+            // Visit closest child first
+            int nearChild = currentNode.firstChild;
+            int farChild = currentNode.firstChild + 1;
+            if( vertexNodes_[ farChild ].boundingBox.squaredExteriorDistance( point ) <
+                    vertexNodes_[ nearChild ].boundingBox.squaredExteriorDistance( point ) )
+            {
+                std::swap( nearChild, farChild );
+            }
+            nodesToVisit.push_back( farChild );
+            nodesToVisit.push_back( nearChild );
+        }
+    }
+
+    return std::sqrt( minimumSquaredDistance );
+}
+
+//! Computes the signed distance to the surface of the polyhedron.
+double PolyhedronSpatialIndex::computeSignedDistanceToSurface( const Eigen::Vector3d& point, int& closestFacet ) const
+{
+    double minimumSquaredDistance = std::numeric_limits< double >::infinity( );
+    Eigen::Vector3d closestPoint = Eigen::Vector3d::Zero( );
+    int closestFeature = -1;
+    closestFacet = -1;
+
+    std::vector< int > nodesToVisit;
+    nodesToVisit.push_back( 0 );
+    while( !nodesToVisit.empty( ) )
+    {
+        const BoundingVolumeNode& currentNode = facetNodes_[ nodesToVisit.back( ) ];
+        nodesToVisit.pop_back( );
+
+        if( currentNode.boundingBox.squaredExteriorDistance( point ) >= minimumSquaredDistance )
+        {
+            continue;
+        }
+
+        if( currentNode.firstChild < 0 )
+        {
+            for( int i = currentNode.firstPrimitive; i < currentNode.firstPrimitive + currentNode.numberOfPrimitives; i++ )
+            {
+                int facet = sortedFacets_[ i ];
+                int currentFeature;
+                Eigen::Vector3d currentClosestPoint = computeClosestPointOnTriangle(
+                            point,
+                            verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 0 ), 0 ).transpose( ),
+                            verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 1 ), 0 ).transpose( ),
+                            verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 2 ), 0 ).transpose( ),
+                            currentFeature );
+                double squaredDistance = ( currentClosestPoint - point ).squaredNorm( );
+                if( squaredDistance < minimumSquaredDistance ||
+                        ( squaredDistance == minimumSquaredDistance && facet < closestFacet ) )
+                {
+                    minimumSquaredDistance = squaredDistance;
+                    closestPoint = currentClosestPoint;
+                    closestFeature = currentFeature;
+                    closestFacet = facet;
+                }
+            }
+        }
+        else
+        {
+            // Visit closest child first
+            int nearChild = currentNode.firstChild;
+            int farChild = currentNode.firstChild + 1;
+            if( facetNodes_[ farChild ].boundingBox.squaredExteriorDistance( point ) <
+                    facetNodes_[ nearChild ].boundingBox.squaredExteriorDistance( point ) )
+            {
+                std::swap( nearChild, farChild );
+            }
+            nodesToVisit.push_back( farChild );
+            nodesToVisit.push_back( nearChild );
+        }
+    }
+
+    // Determine sign from pseudo-normal of closest feature
+    Eigen::Vector3d pseudoNormal;
+    if( closestFeature < 3 )
+    {
+        pseudoNormal = vertexPseudoNormals_.at( verticesDefiningEachFacet_( closestFacet, closestFeature ) );
+    }
+    else if( closestFeature < 6 )
+    {
+        pseudoNormal = edgePseudoNormals_.at( 3 * closestFacet + closestFeature - 3 );
+    }
+    else
+    {
+        pseudoNormal = facetNormals_.at( closestFacet );
+    }
+
+    double distance = std::sqrt( minimumSquaredDistance );
+    return ( ( point - closestPoint ).dot( pseudoNormal ) < 0.0 ) ? -distance : distance;
+}
+
+//! Builds a bounding volume hierarchy.
+void PolyhedronSpatialIndex::buildHierarchy( const std::vector< Eigen::AlignedBox3d >& primitiveBoxes,
+                                             std::vector< BoundingVolumeNode >& nodes,
+                                             std::vector< int >& sortedPrimitives )
+{
+    const int numberOfPrimitives = primitiveBoxes.size( );
+    if( numberOfPrimitives == 0 )
+    {
+        throw std::runtime_error( "Error when building polyhedron spatial index, no primitives provided." );
+    }
+
+    std::vector< Eigen::Vector3d > primitiveCentroids( numberOfPrimitives );
+    sortedPrimitives.resize( numberOfPrimitives );
+    for( int i = 0; i < numberOfPrimitives; i++ )
+    {
+        primitiveCentroids.at( i ) = primitiveBoxes.at( i ).center( );
+        sortedPrimitives.at( i ) = i;
+    }
+
+    nodes.clear( );
+    nodes.reserve( 2 * numberOfPrimitives );
+    nodes.push_back( BoundingVolumeNode{ Eigen::AlignedBox3d( ), -1, 0, numberOfPrimitives } );
+
+    std::vector< int > nodesToSplit;
+    nodesToSplit.push_back( 0 );
+    while( !nodesToSplit.empty( ) )
+    {
+        int currentNodeIndex = nodesToSplit.back( );
+        nodesToSplit.pop_back( );
+        int firstPrimitive = nodes.at( currentNodeIndex ).firstPrimitive;
+        int currentNumberOfPrimitives = nodes.at( currentNodeIndex ).numberOfPrimitives;
+
+        // Compute bounding box of node, and of centroids of its primitives
+        Eigen::AlignedBox3d boundingBox;
+        Eigen::AlignedBox3d centroidBox;
+        boundingBox.setEmpty( );
+        centroidBox.setEmpty( );
+        for( int i = firstPrimitive; i < firstPrimitive + currentNumberOfPrimitives; i++ )
+        {
+            boundingBox.extend( primitiveBoxes.at( sortedPrimitives.at( i ) ) );
+            centroidBox.extend( primitiveCentroids.at( sortedPrimitives.at( i ) ) );
+        }
+        nodes.at( currentNodeIndex ).boundingBox = boundingBox;
+
+        if( currentNumberOfPrimitives <= maximumPrimitivesPerLeaf_ )
+        {
+            continue;
+        }
+
+        // Split primitives at median of centroids along longest axis
+        int splitAxis;
+        centroidBox.sizes( ).maxCoeff( &splitAxis );
+        int numberOfPrimitivesInFirstChild = currentNumberOfPrimitives / 2;
+        std::nth_element( sortedPrimitives.begin( ) + firstPrimitive,
+                          sortedPrimitives.begin( ) + firstPrimitive + numberOfPrimitivesInFirstChild,
+                          sortedPrimitives.begin( ) + firstPrimitive + currentNumberOfPrimitives,
+                          [ & ]( const int primitive1, const int primitive2 )
+        {
+            return primitiveCentroids.at( primitive1 )( splitAxis ) < primitiveCentroids.at( primitive2 )( splitAxis );
+        } );
+
+        int firstChild = nodes.size( );
+        nodes.at( currentNodeIndex ).firstChild = firstChild;
+        nodes.push_back( BoundingVolumeNode{ Eigen::AlignedBox3d( ), -1, firstPrimitive, numberOfPrimitivesInFirstChild } );
+        nodes.push_back( BoundingVolumeNode{ Eigen::AlignedBox3d( ), -1, firstPrimitive + numberOfPrimitivesInFirstChild,
+                                             currentNumberOfPrimitives - numberOfPrimitivesInFirstChild } );
+        nodesToSplit.push_back( firstChild );
+        nodesToSplit.push_back( firstChild + 1 );
+    }
+}
+
+} // namespace basic_mathematics
+} // namespace tudat
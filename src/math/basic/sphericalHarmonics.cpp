@@ -9,6 +9,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include <Eigen/Core>
@@ -39,6 +40,66 @@ void SphericalHarmonicsCache::resetMaximumDegreeAndOrder( const int maximumDegre
 }
 
 
+//! Update maximum degree and order of cache, and recompute the recurrence multipliers.
+void SphericalHarmonicsBatchCache::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    maximumDegree_ = maximumDegree;
+    maximumOrder_ = std::min( maximumOrder, maximumDegree );
+    maximumPolynomialOrder_ = std::min( maximumOrder_ + 1, maximumDegree_ );
+
+    const int numberOfEntries = ( maximumDegree_ + 1 ) * ( maximumPolynomialOrder_ + 1 );
+    firstVerticalMultipliers_.assign( numberOfEntries, 0.0 );
+    secondVerticalMultipliers_.assign( numberOfEntries, 0.0 );
+    derivativeNormalizations_.assign( numberOfEntries, 0.0 );
+    diagonalMultipliers_.assign( maximumDegree_ + 1, 0.0 );
+
+    for( int i = 0; i <= maximumDegree_; i++ )
+    {
+        double degree = static_cast< double >( i );
+
+        // Set multiplier for sectoral recursion P_{n,n} = f_{n} * cos( latitude ) * P_{n-1,n-1}
+        if( i == 1 )
+        {
+            diagonalMultipliers_[ i ] = std::sqrt( 3.0 );
+        }
+        else if( i > 1 )
+        {
+            diagonalMultipliers_[ i ] = std::sqrt( ( 2.0 * degree + 1.0 ) / ( 2.0 * degree ) );
+        }
+
+        for( int j = 0; ( j <= i ) && ( j <= maximumPolynomialOrder_ ); j++ )
+        {
+            double order = static_cast< double >( j );
+            int index = i * ( maximumPolynomialOrder_ + 1 ) + j;
+
+            // Set multipliers for degree recursion P_{n,m} = a_{n,m} * sin( latitude ) * P_{n-1,m} - b_{n,m} * P_{n-2,m}
+            if( j < i )
+            {
+                double multiplierOne = std::sqrt( ( 2.0 * degree + 1.0 ) / ( ( degree + order ) * ( degree - order ) ) );
+                firstVerticalMultipliers_[ index ] = multiplierOne * std::sqrt( 2.0 * degree - 1.0 );
+                if( i - j >= 2 )
+                {
+                    secondVerticalMultipliers_[ index ] = multiplierOne * std::sqrt(
+                                ( degree + order - 1.0 ) * ( degree - order - 1.0 ) / ( 2.0 * degree - 3.0 ) );
+                }
+            }
+
+            // Compute normalization correction factor for derivative.
+            derivativeNormalizations_[ index ] = std::sqrt( ( degree + order + 1.0 ) * ( degree - order ) );
+            if( j == 0 )
+            {
+                derivativeNormalizations_[ index ] *= std::sqrt( 0.5 );
+            }
+        }
+    }
+
+    currentDegreeLegendreValues_.assign( maximumPolynomialOrder_ + 1, LaneArray::Zero( ) );
+    previousDegreeLegendreValues_.assign( maximumPolynomialOrder_ + 1, LaneArray::Zero( ) );
+    secondPreviousDegreeLegendreValues_.assign( maximumPolynomialOrder_ + 1, LaneArray::Zero( ) );
+    cosinesOfLongitude_.assign( maximumOrder_ + 1, LaneArray::Zero( ) );
+    sinesOfLongitude_.assign( maximumOrder_ + 1, LaneArray::Zero( ) );
+}
+
 //! Compute the gradient of a single term of a spherical harmonics potential field.
 Eigen::Vector3d computePotentialGradient(
         const double distance,
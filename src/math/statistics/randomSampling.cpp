@@ -99,10 +99,9 @@ std::vector< Eigen::VectorXd > generateUniformRandomSample(
 
 
 
-//! Generator random vector using pseudo random generator with gaussian distribution (without correlation)
-std::vector< Eigen::VectorXd > generateGaussianRandomSample(
-        const int seed, const int numberOfSamples,
-        const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation )
+//! Create generators of independent, but not identically, Gaussian distributed random variables.
+std::vector< std::shared_ptr< RandomVariableGenerator< double > > > createGaussianRandomVariableGenerators(
+        const int seed, const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation )
 {
     if( mean.rows( ) != standardDeviation.rows( ) )
     {
@@ -119,9 +118,41 @@ std::vector< Eigen::VectorXd > generateGaussianRandomSample(
                     createBoostContinuousRandomVariableGenerator(
                         normal_boost_distribution, currentParameters, seed + i ) );
     }
+    return randomVariableGenerators;
+}
 
+//! Create function that generates a single random vector per call, with entries of each vector independently, but not
+//! identically, distributed.
+std::function< Eigen::VectorXd( ) > createRandomSampleFunctionFromGenerator(
+        const std::vector< std::shared_ptr< RandomVariableGenerator< double > > > randomVariableGenerators )
+{
+    return [ = ]( )
+    {
+        Eigen::VectorXd randomSample( randomVariableGenerators.size( ) );
+        for( unsigned int j = 0; j < randomVariableGenerators.size( ); j++ )
+        {
+            randomSample( j ) = randomVariableGenerators.at( j )->getRandomVariableValue( );
+        }
+        return randomSample;
+    };
+}
+
+//! Create function that generates a single Gaussian distributed random vector per call.
+std::function< Eigen::VectorXd( ) > createGaussianRandomSampleFunction(
+        const int seed, const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation )
+{
+    return createRandomSampleFunctionFromGenerator(
+                createGaussianRandomVariableGenerators( seed, mean, standardDeviation ) );
+}
+
+//! Generator random vector using pseudo random generator with gaussian distribution (without correlation)
+std::vector< Eigen::VectorXd > generateGaussianRandomSample(
+        const int seed, const int numberOfSamples,
+        const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation )
+{
     // Generate samples
-    return generateRandomSampleFromGenerator( numberOfSamples, randomVariableGenerators );
+    return generateRandomSampleFromGenerator(
+                numberOfSamples, createGaussianRandomVariableGenerators( seed, mean, standardDeviation ) );
 }
 
 
@@ -0,0 +1,282 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/math/statistics/streamingStatistics.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Constructor
+RunningMeanAndCovariance::RunningMeanAndCovariance( const int vectorSize ):
+    numberOfSamples_( 0 ),
+    mean_( Eigen::VectorXd::Zero( vectorSize ) ),
+    sumOfSquaredDeviations_( Eigen::MatrixXd::Zero( vectorSize, vectorSize ) ){ }
+
+//! Function to add a single vector to the sample
+void RunningMeanAndCovariance::addSample( const Eigen::VectorXd& sampleVector )
+{
+    if( sampleVector.rows( ) != mean_.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding vector to running mean and covariance, size is " +
+                                  std::to_string( sampleVector.rows( ) ) + ", but expected " +
+                                  std::to_string( mean_.rows( ) ) );
+    }
+
+    numberOfSamples_++;
+    Eigen::VectorXd deviationFromPreviousMean = sampleVector - mean_;
+    mean_ += deviationFromPreviousMean / static_cast< double >( numberOfSamples_ );
+    sumOfSquaredDeviations_.noalias( ) += deviationFromPreviousMean * ( sampleVector - mean_ ).transpose( );
+}
+
+//! Function to merge the statistics of another sample into the current object
+void RunningMeanAndCovariance::merge( const RunningMeanAndCovariance& otherStatistics )
+{
+    if( otherStatistics.numberOfSamples_ == 0 )
+    {
+        return;
+    }
+    else if( numberOfSamples_ == 0 )
+    {
+        *this = otherStatistics;
+        return;
+    }
+    else if( otherStatistics.mean_.rows( ) != mean_.rows( ) )
+    {
+        throw std::runtime_error( "Error when merging running means and covariances, sizes are incompatible" );
+    }
+
+    double currentNumberOfSamples = static_cast< double >( numberOfSamples_ );
+    double otherNumberOfSamples = static_cast< double >( otherStatistics.numberOfSamples_ );
+    double totalNumberOfSamples = currentNumberOfSamples + otherNumberOfSamples;
+
+    Eigen::VectorXd meanDifference = otherStatistics.mean_ - mean_;
+    mean_ += meanDifference * otherNumberOfSamples / totalNumberOfSamples;
+    sumOfSquaredDeviations_ += otherStatistics.sumOfSquaredDeviations_ +
+            meanDifference * meanDifference.transpose( ) * currentNumberOfSamples * otherNumberOfSamples /
+            totalNumberOfSamples;
+    numberOfSamples_ += otherStatistics.numberOfSamples_;
+}
+
+//! Function to retrieve the unbiased sample covariance
+Eigen::MatrixXd RunningMeanAndCovariance::getCovariance( ) const
+{
+    if( numberOfSamples_ < 2 )
+    {
+        return Eigen::MatrixXd::Zero( mean_.rows( ), mean_.rows( ) );
+    }
+    return sumOfSquaredDeviations_ / static_cast< double >( numberOfSamples_ - 1 );
+}
+
+//! Function to retrieve the unbiased sample standard deviation of each of the entries of the vectors
+Eigen::VectorXd RunningMeanAndCovariance::getStandardDeviation( ) const
+{
+    return getCovariance( ).diagonal( ).cwiseSqrt( );
+}
+
+//! Constructor
+P2QuantileEstimator::P2QuantileEstimator( const double probability ):
+    probability_( probability ), numberOfSamples_( 0 )
+{
+    if( !( probability >= 0.0 && probability <= 1.0 ) )
+    {
+        throw std::runtime_error( "Error when creating quantile estimator, probability " +
+                                  std::to_string( probability ) + " is not in range [0,1]" );
+    }
+
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        markerHeights_[ i ] = 0.0;
+        markerPositions_[ i ] = i + 1;
+    }
+
+    desiredMarkerPositions_[ 0 ] = 1.0;
+    desiredMarkerPositions_[ 1 ] = 1.0 + 2.0 * probability;
+    desiredMarkerPositions_[ 2 ] = 1.0 + 4.0 * probability;
+    desiredMarkerPositions_[ 3 ] = 3.0 + 2.0 * probability;
+    desiredMarkerPositions_[ 4 ] = 5.0;
+
+    desiredMarkerPositionIncrements_[ 0 ] = 0.0;
+    desiredMarkerPositionIncrements_[ 1 ] = probability / 2.0;
+    desiredMarkerPositionIncrements_[ 2 ] = probability;
+    desiredMarkerPositionIncrements_[ 3 ] = ( 1.0 + probability ) / 2.0;
+    desiredMarkerPositionIncrements_[ 4 ] = 1.0;
+}
+
+//! Function to add a single value to the sample
+void P2QuantileEstimator::addSample( const double value )
+{
+    // Store the first five values directly
+    if( numberOfSamples_ < 5 )
+    {
+        markerHeights_[ numberOfSamples_ ] = value;
+        numberOfSamples_++;
+        if( numberOfSamples_ == 5 )
+        {
+            std::sort( markerHeights_, markerHeights_ + 5 );
+        }
+        return;
+    }
+    numberOfSamples_++;
+
+    // Find cell in which new value falls, and update extreme markers if required
+    int cellIndex;
+    if( value < markerHeights_[ 0 ] )
+    {
+        markerHeights_[ 0 ] = value;
+        cellIndex = 0;
+    }
+    else if( value >= markerHeights_[ 4 ] )
+    {
+        markerHeights_[ 4 ] = value;
+        cellIndex = 3;
+    }
+    else
+    {
+        cellIndex = 0;
+        while( value >= markerHeights_[ cellIndex + 1 ] )
+        {
+            cellIndex++;
+        }
+    }
+
+    // Update marker positions
+    for( int i = cellIndex + 1; i < 5; i++ )
+    {
+        markerPositions_[ i ]++;
+    }
+    for( int i = 0; i < 5; i++ )
+    {
+        desiredMarkerPositions_[ i ] += desiredMarkerPositionIncrements_[ i ];
+    }
+
+    // Adjust heights of central markers if they are too far from their desired positions
+    for( int i = 1; i < 4; i++ )
+    {
+        double positionOffset = desiredMarkerPositions_[ i ] - static_cast< double >( markerPositions_[ i ] );
+        if( ( positionOffset >= 1.0 && markerPositions_[ i + 1 ] - markerPositions_[ i ] > 1 ) ||
+                ( positionOffset <= -1.0 && markerPositions_[ i - 1 ] - markerPositions_[ i ] < -1 ) )
+        {
+            int positionStep = ( positionOffset >= 0.0 ) ? 1 : -1;
+            double newHeight = computeParabolicHeight( i, static_cast< double >( positionStep ) );
+            if( !( markerHeights_[ i - 1 ] < newHeight && newHeight < markerHeights_[ i + 1 ] ) )
+            {
+                newHeight = computeLinearHeight( i, positionStep );
+            }
+            markerHeights_[ i ] = newHeight;
+            markerPositions_[ i ] += positionStep;
+        }
+    }
+}
+
+//! Function to retrieve the current estimate of the quantile
+double P2QuantileEstimator::getQuantile( ) const
+{
+    if( numberOfSamples_ == 0 )
+    {
+        return std::numeric_limits< double >::quiet_NaN( );
+    }
+    else if( numberOfSamples_ < 5 )
+    {
+        // Use exact quantile of small sample
+        std::vector< double > sortedValues( markerHeights_, markerHeights_ + numberOfSamples_ );
+        std::sort( sortedValues.begin( ), sortedValues.end( ) );
+        double fractionalIndex = probability_ * static_cast< double >( numberOfSamples_ - 1 );
+        int lowerIndex = static_cast< int >( std::floor( fractionalIndex ) );
+        int upperIndex = std::min( lowerIndex + 1, static_cast< int >( numberOfSamples_ ) - 1 );
+        double upperWeight = fractionalIndex - static_cast< double >( lowerIndex );
+        return ( 1.0 - upperWeight ) * sortedValues.at( lowerIndex ) + upperWeight * sortedValues.at( upperIndex );
+    }
+    else
+    {
+        return markerHeights_[ 2 ];
+    }
+}
+
+//! Function to compute the parabolic prediction of the height of marker i, when moving it by d (-1 or 1)
+double P2QuantileEstimator::computeParabolicHeight( const int i, const double d ) const
+{
+    double positionBelow = static_cast< double >( markerPositions_[ i - 1 ] );
+    double position = static_cast< double >( markerPositions_[ i ] );
+    double positionAbove = static_cast< double >( markerPositions_[ i + 1 ] );
+
+    return markerHeights_[ i ] + d / ( positionAbove - positionBelow ) * (
+                ( position - positionBelow + d ) * ( markerHeights_[ i + 1 ] - markerHeights_[ i ] ) /
+                ( positionAbove - position ) +
+                ( positionAbove - position - d ) * ( markerHeights_[ i ] - markerHeights_[ i - 1 ] ) /
+                ( position - positionBelow ) );
+}
+
+//! Function to compute the linear prediction of the height of marker i, when moving it by d (-1 or 1)
+double P2QuantileEstimator::computeLinearHeight( const int i, const int d ) const
+{
+    return markerHeights_[ i ] + static_cast< double >( d ) * ( markerHeights_[ i + d ] - markerHeights_[ i ] ) /
+            static_cast< double >( markerPositions_[ i + d ] - markerPositions_[ i ] );
+}
+
+//! Constructor
+StreamingVectorStatistics::StreamingVectorStatistics( const int vectorSize,
+                                                      const std::vector< double >& quantileProbabilities ):
+    vectorSize_( vectorSize ),
+    quantileProbabilities_( quantileProbabilities ),
+    meanAndCovariance_( vectorSize )
+{
+    quantileEstimators_.reserve( vectorSize * quantileProbabilities.size( ) );
+    for( int i = 0; i < vectorSize; i++ )
+    {
+        for( unsigned int j = 0; j < quantileProbabilities.size( ); j++ )
+        {
+            quantileEstimators_.push_back( P2QuantileEstimator( quantileProbabilities.at( j ) ) );
+        }
+    }
+}
+
+//! Function to add a single vector to the sample
+void StreamingVectorStatistics::addSample( const Eigen::VectorXd& sampleVector )
+{
+    meanAndCovariance_.addSample( sampleVector );
+
+    unsigned int numberOfQuantiles = quantileProbabilities_.size( );
+    for( int i = 0; i < vectorSize_; i++ )
+    {
+        for( unsigned int j = 0; j < numberOfQuantiles; j++ )
+        {
+            quantileEstimators_[ i * numberOfQuantiles + j ].addSample( sampleVector( i ) );
+        }
+    }
+}
+
+//! Function to retrieve the estimated quantiles
+Eigen::MatrixXd StreamingVectorStatistics::getQuantiles( ) const
+{
+    unsigned int numberOfQuantiles = quantileProbabilities_.size( );
+    Eigen::MatrixXd quantiles = Eigen::MatrixXd::Zero( vectorSize_, numberOfQuantiles );
+    for( int i = 0; i < vectorSize_; i++ )
+    {
+        for( unsigned int j = 0; j < numberOfQuantiles; j++ )
+        {
+            quantiles( i, j ) = quantileEstimators_[ i * numberOfQuantiles + j ].getQuantile( );
+        }
+    }
+    return quantiles;
+}
+
+} // namespace statistics
+
+} // namespace tudat
@@ -18,6 +18,8 @@ namespace tudat
 namespace simulation_setup
 {
 
+std::atomic< int > Body::numberOfConcurrentEphemerisAccessSections_( 0 );
+
 void Body::getPositionByReference( Eigen::Vector3d& position ) { position = currentState_.segment( 0, 3 ); }
 
 
@@ -101,6 +103,178 @@ void Body::setIsBodyInPropagation( const bool isBodyInPropagation )
     }
 }
 
+//! Function to create a function returning the current position of a body, which does not keep the body alive (so that
+//! models of the body itself may use it without creating a reference cycle).
+static std::function< Eigen::Vector3d( ) > getBodyPositionFunction( const std::shared_ptr< Body > body )
+{
+    std::weak_ptr< Body > weakBody = body;
+    return [ = ]( ){ return weakBody.lock( )->getPosition( ); };
+}
+
+//! Function to create a copy of this body that can be used concurrently with the original
+std::shared_ptr< Body > Body::clone( ) const
+{
+    if( radiationPressureInterfaces_.size( ) > 0 )
+    {
+        throw std::runtime_error( "Error when cloning body " + bodyName_ + ", radiation pressure interfaces depend on other "
+                                  "bodies, and can only be cloned as part of a system of bodies (using cloneSystemOfBodies)" );
+    }
+    return cloneWithoutRadiationPressureInterfaces( );
+}
+
+//! Function to create a copy of this body that can be used concurrently with the original, without radiation pressure
+//! interfaces
+std::shared_ptr< Body > Body::cloneWithoutRadiationPressureInterfaces( ) const
+{
+    std::string errorPrefix = "Error when cloning body " + bodyName_ + ", ";
+    if( gravityFieldVariationSet_ != nullptr )
+    {
+        throw std::runtime_error( errorPrefix + "gravity field variations depend on other bodies, and cannot be cloned" );
+    }
+    if( bodyDeformationModels_.size( ) > 0 )
+    {
+        throw std::runtime_error( errorPrefix + "body deformation models depend on other bodies, and cannot be cloned" );
+    }
+
+    // Copy current state
+    std::shared_ptr< Body > clonedBody = std::make_shared< Body >( *this );
+    clonedBody->ephemerisStateMutex_ = std::make_shared< std::mutex >( );
+    clonedBody->radiationPressureInterfaces_.clear( );
+    clonedBody->radiationPressureIterator_ = clonedBody->radiationPressureInterfaces_.begin( );
+
+    // Flight conditions are linked to the body objects of the original system, and must be recreated
+    clonedBody->aerodynamicFlightConditions_ = nullptr;
+
+    // Copy all models that store data during their evaluation, or that may be reset independently of the original
+    try
+    {
+        if( bodyEphemeris_ != nullptr )
+        {
+            clonedBody->bodyEphemeris_ = bodyEphemeris_->clone( );
+        }
+        if( rotationalEphemeris_ != nullptr )
+        {
+            clonedBody->rotationalEphemeris_ = rotationalEphemeris_->clone( );
+        }
+        if( atmosphereModel_ != nullptr )
+        {
+            clonedBody->atmosphereModel_ = atmosphereModel_->clone( );
+        }
+        if( aerodynamicCoefficientInterface_ != nullptr )
+        {
+            clonedBody->aerodynamicCoefficientInterface_ = aerodynamicCoefficientInterface_->clone( );
+        }
+        if( vehicleSystems_ != nullptr )
+        {
+            clonedBody->vehicleSystems_ = vehicleSystems_->clone( );
+        }
+        if( gravityFieldModel_ != nullptr )
+        {
+            clonedBody->gravityFieldModel_ = gravityFieldModel_->clone( );
+        }
+    }
+    catch( const std::runtime_error& error )
+    {
+        throw std::runtime_error( errorPrefix + error.what( ) );
+    }
+
+    // Link inertia tensor update of gravity field to the copied body (without creating a reference cycle)
+    if( gravityFieldModel_ != nullptr && gravityFieldModel_->getUpdateInertiaTensorFunction( ) != nullptr )
+    {
+        std::weak_ptr< Body > weakClonedBody = clonedBody;
+        if( std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >( gravityFieldModel_ ) != nullptr )
+        {
+            clonedBody->gravityFieldModel_->resetUpdateInertiaTensorFunction( [ = ]( )
+            {
+                weakClonedBody.lock( )->setBodyInertiaTensorFromGravityFieldAndExistingMeanMoment( true );
+            } );
+        }
+        else if( std::dynamic_pointer_cast< gravitation::PolyhedronGravityField >( gravityFieldModel_ ) != nullptr )
+        {
+            clonedBody->gravityFieldModel_->resetUpdateInertiaTensorFunction( [ = ]( )
+            {
+                weakClonedBody.lock( )->setBodyInertiaTensorFromGravityFieldAndExistingDensity( );
+            } );
+        }
+        else
+        {
+            throw std::runtime_error( errorPrefix + "inertia tensor update of gravity field cannot be cloned" );
+        }
+    }
+
+    // Link pointing angle calculators of ground stations to the copied rotation model
+    for( const auto& groundStationIterator : groundStationMap )
+    {
+        std::shared_ptr< ground_stations::GroundStationState > stationState =
+                groundStationIterator.second->getNominalStationState( );
+        std::shared_ptr< ground_stations::PointingAnglesCalculator > pointingAnglesCalculator =
+                std::make_shared< ground_stations::PointingAnglesCalculator >(
+                    std::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrame,
+                               clonedBody->rotationalEphemeris_, std::placeholders::_1 ),
+                    std::bind( &ground_stations::GroundStationState::getRotationFromBodyFixedToTopocentricFrame,
+                               stationState, std::placeholders::_1 ) );
+        clonedBody->groundStationMap[ groundStationIterator.first ] = std::make_shared< ground_stations::GroundStation >(
+                    stationState, pointingAnglesCalculator, groundStationIterator.second->getStationId( ) );
+    }
+
+    return clonedBody;
+}
+
+//! Function to create a copy of a system of bodies that can be used concurrently with the original
+SystemOfBodies cloneSystemOfBodies( const SystemOfBodies& bodies )
+{
+    SystemOfBodies clonedBodies( bodies.getFrameOrigin( ), bodies.getFrameOrientation( ) );
+    for( const auto& bodyIterator : bodies.getMap( ) )
+    {
+        clonedBodies.addBody( bodyIterator.second->cloneWithoutRadiationPressureInterfaces( ), bodyIterator.first, false );
+    }
+
+    // Recreate radiation pressure interfaces, linked to the positions of the cloned bodies
+    for( const auto& bodyIterator : bodies.getMap( ) )
+    {
+        std::shared_ptr< Body > clonedBody = clonedBodies.at( bodyIterator.first );
+        for( const auto& interfaceIterator : bodyIterator.second->getRadiationPressureInterfaces( ) )
+        {
+            std::shared_ptr< electromagnetism::RadiationPressureInterface > radiationPressureInterface =
+                    interfaceIterator.second;
+            std::vector< std::string > occultingBodies = radiationPressureInterface->getOccultingBodies( );
+            if( clonedBodies.count( interfaceIterator.first ) == 0 ||
+                    occultingBodies.size( ) != radiationPressureInterface->getOccultingBodyPositions( ).size( ) )
+            {
+                throw std::runtime_error( "Error when cloning radiation pressure interface of body " + bodyIterator.first +
+                                          " due to " + interfaceIterator.first + ", source or occulting bodies not found" );
+            }
+
+            std::vector< std::function< Eigen::Vector3d( ) > > occultingBodyPositions;
+            for( unsigned int i = 0; i < occultingBodies.size( ); i++ )
+            {
+                if( clonedBodies.count( occultingBodies.at( i ) ) == 0 )
+                {
+                    throw std::runtime_error( "Error when cloning radiation pressure interface of body " + bodyIterator.first +
+                                              ", occulting body " + occultingBodies.at( i ) + " not found" );
+                }
+                occultingBodyPositions.push_back( getBodyPositionFunction( clonedBodies.at( occultingBodies.at( i ) ) ) );
+            }
+
+            try
+            {
+                clonedBody->setRadiationPressureInterface(
+                            interfaceIterator.first, radiationPressureInterface->clone(
+                                getBodyPositionFunction( clonedBodies.at( interfaceIterator.first ) ),
+                                getBodyPositionFunction( clonedBody ), occultingBodyPositions ) );
+            }
+            catch( const std::runtime_error& error )
+            {
+                throw std::runtime_error( "Error when cloning body " + bodyIterator.first + ", " + error.what( ) );
+            }
+        }
+    }
+
+    // Link frame origins to the cloned bodies
+    clonedBodies.processBodyFrameDefinitions( );
+    return clonedBodies;
+}
+
 double getBodyGravitationalParameter( const SystemOfBodies& bodies, const std::string bodyName )
 {
     if( bodies.count( bodyName ) == 0 )
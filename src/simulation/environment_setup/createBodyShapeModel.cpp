@@ -91,7 +91,8 @@ std::shared_ptr< basic_astrodynamics::BodyShapeModel > createBodyShapeModel(
                         polyhedronShapeSettings->getVerticesCoordinates(),
                         polyhedronShapeSettings->getVerticesDefiningEachFacet(),
                         polyhedronShapeSettings->getComputeAltitudeWithSign(),
-                        polyhedronShapeSettings->getJustComputeDistanceToVertices() );
+                        polyhedronShapeSettings->getJustComputeDistanceToVertices(),
+                        polyhedronShapeSettings->getUseSpatialIndex() );
         }
         break;
     }
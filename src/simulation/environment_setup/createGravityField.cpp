@@ -481,6 +481,16 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
                     polyhedronFieldSettings->getVerticesDefiningEachFacet(),
                     associatedReferenceFrame,
                     inertiaTensorUpdateFunction );
+
+            // Compute far-field spherical harmonic expansion, if requested
+            if( polyhedronFieldSettings->getFarFieldMaximumDegree( ) >= 0 )
+            {
+                std::dynamic_pointer_cast< PolyhedronGravityField >( gravityFieldModel )->
+                        setFarFieldSphericalHarmonicExpansion(
+                            polyhedronFieldSettings->getFarFieldMaximumDegree( ),
+                            polyhedronFieldSettings->getFarFieldSwitchRadius( ),
+                            polyhedronFieldSettings->getFarFieldTransitionWidth( ) );
+            }
         }
         break;
     }
@@ -624,10 +624,6 @@ createPolyhedronGravityAcceleration(
                 std::bind( &PolyhedronGravityField::getVerticesDefiningEachFacet, polyhedronGravityField );
         std::function< Eigen::MatrixXi( ) > verticesDefiningEachEdgeFunction =
                 std::bind( &PolyhedronGravityField::getVerticesDefiningEachEdge, polyhedronGravityField );
-        std::function< std::vector< Eigen::MatrixXd >( ) > facetDyadsFunction =
-                std::bind( &PolyhedronGravityField::getFacetDyads, polyhedronGravityField );
-        std::function< std::vector< Eigen::MatrixXd >( ) > edgeDyadsFunction =
-                std::bind( &PolyhedronGravityField::getEdgeDyads, polyhedronGravityField );
 
         // Create acceleration object.
         accelerationModel =
@@ -638,11 +634,23 @@ createPolyhedronGravityAcceleration(
                         verticesCoordinatesFunction,
                         verticesDefiningEachFacetFunction,
                         verticesDefiningEachEdgeFunction,
-                        facetDyadsFunction,
-                        edgeDyadsFunction,
+                        polyhedronGravityField->getPackedFacetDyads( ),
+                        polyhedronGravityField->getPackedEdgeDyads( ),
                         std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
                         std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
                         useCentralBodyFixedFrame );
+        accelerationModel->setNumberOfThreads( polyhedronGravityField->getNumberOfThreads( ) );
+
+        // Use far-field spherical harmonic expansion of polyhedron, if it has been computed
+        if( polyhedronGravityField->hasFarFieldSphericalHarmonicExpansion( ) )
+        {
+            accelerationModel->setFarFieldSphericalHarmonicExpansion(
+                        polyhedronGravityField->getFarFieldCosineCoefficients( ),
+                        polyhedronGravityField->getFarFieldSineCoefficients( ),
+                        polyhedronGravityField->getFarFieldReferenceRadius( ),
+                        polyhedronGravityField->getFarFieldSwitchRadius( ),
+                        polyhedronGravityField->getFarFieldTransitionWidth( ) );
+        }
 
     }
     return accelerationModel;
@@ -1,3 +1,6 @@
+#include "tudat/astro/ephemerides/customRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/directionBasedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
 #include "tudat/simulation/propagation_setup/environmentUpdater.h"
 
 namespace tudat
@@ -6,10 +9,18 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to determine whether the orientation given by a rotation model depends on the (propagated) state of bodies
+bool doesRotationModelDependOnState( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris )
+{
+    return ( std::dynamic_pointer_cast< ephemerides::AerodynamicAngleRotationalEphemeris >( rotationalEphemeris ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ephemerides::CustomRotationalEphemeris >( rotationalEphemeris ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ephemerides::SynchronousRotationalEphemeris >( rotationalEphemeris ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ephemerides::DirectionBasedRotationalEphemeris >( rotationalEphemeris ) != nullptr );
+}
+
 template class EnvironmentUpdater< double, double >;
 
 
 } // namespace propagators
 
 } // namespace tudat
-
@@ -162,6 +162,68 @@ Eigen::VectorXd evaluateListOfVectorFunctions(
     return variableList;
 }
 
+//! Function to add a dependent variable, written directly into the output vector
+void DependentVariableListEvaluator::addWriteFunction(
+        const DependentVariableWriteFunction& writeFunction, const int variableSize )
+{
+    writeFunctions_.push_back( writeFunction );
+    startIndices_.push_back( totalSize_ );
+    totalSize_ += variableSize;
+    outputBuffer_ = Eigen::VectorXd::Zero( totalSize_ );
+}
+
+//! Function to add a scalar dependent variable
+void DependentVariableListEvaluator::addScalarVariable( const std::function< double( ) >& doubleFunction )
+{
+    addWriteFunction( [ = ]( Eigen::VectorXd& output, const int startIndex )
+    {
+        output( startIndex ) = doubleFunction( );
+    }, 1 );
+}
+
+//! Function to add a vector dependent variable of arbitrary size
+void DependentVariableListEvaluator::addVectorVariable(
+        const std::function< Eigen::VectorXd( ) >& vectorFunction, const int variableSize )
+{
+    addWriteFunction( [ = ]( Eigen::VectorXd& output, const int startIndex )
+    {
+        output.segment( startIndex, variableSize ) = vectorFunction( );
+    }, variableSize );
+}
+
+//! Function to evaluate all dependent variables
+const Eigen::VectorXd& DependentVariableListEvaluator::evaluate( )
+{
+    for( unsigned int i = 0; i < resetFunctions_.size( ); i++ )
+    {
+        resetFunctions_[ i ]( );
+    }
+
+    for( unsigned int i = 0; i < writeFunctions_.size( ); i++ )
+    {
+        writeFunctions_[ i ]( outputBuffer_, startIndices_[ i ] );
+    }
+    return outputBuffer_;
+}
+
+//! Function to retrieve a 3-dimensional intermediate quantity shared by dependent variables, creating it if needed.
+std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > getSharedDependentVariableIntermediate(
+        DependentVariableListEvaluator& evaluator,
+        std::map< std::string, std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > >& intermediates,
+        const std::string& intermediateKey,
+        const std::function< Eigen::Vector3d( ) >& computationFunction )
+{
+    if( intermediates.count( intermediateKey ) == 0 )
+    {
+        std::shared_ptr< DependentVariableIntermediate< Eigen::Vector3d > > intermediate =
+                std::make_shared< DependentVariableIntermediate< Eigen::Vector3d > >( computationFunction );
+        evaluator.addIntermediateResetFunction(
+                    std::bind( &DependentVariableIntermediate< Eigen::Vector3d >::reset, intermediate ) );
+        intermediates[ intermediateKey ] = intermediate;
+    }
+    return intermediates.at( intermediateKey );
+}
+
 Eigen::VectorXd getNormsOfAccelerationDifferencesFromLists(
                        const std::function< Eigen::VectorXd( ) > firstAccelerationFunction,
                        const std::function< Eigen::VectorXd( ) > secondAccelerationFunction )
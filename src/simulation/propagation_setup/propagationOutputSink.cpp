@@ -0,0 +1,293 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include "tudat/simulation/propagation_setup/propagationOutputSink.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Identifier at the start of files written by BinaryFilePropagationOutputSink
+static const char binaryPropagationOutputFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'P', 'O', '1' };
+
+//! Function to append raw data to a buffer
+static void appendToBuffer( std::vector< char >& buffer, const void* data, const size_t numberOfBytes )
+{
+    const char* dataBytes = static_cast< const char* >( data );
+    buffer.insert( buffer.end( ), dataBytes, dataBytes + numberOfBytes );
+}
+
+//! Destructor
+BinaryFilePropagationOutputSink::~BinaryFilePropagationOutputSink( )
+{
+    if( outputStream_.is_open( ) )
+    {
+        // Exceptions may not leave the destructor, so a failure to write the remaining entries is only reported
+        try
+        {
+            flush( );
+        }
+        catch( const std::exception& caughtException )
+        {
+            std::cerr << "Warning, remaining entries may not have been written when closing propagation output file: "
+                      << caughtException.what( ) << std::endl;
+        }
+        outputStream_.close( );
+    }
+}
+
+//! Function to (re)open the output file, discarding its current contents
+void BinaryFilePropagationOutputSink::startPropagation( )
+{
+    if( outputStream_.is_open( ) )
+    {
+        outputStream_.close( );
+    }
+    buffer_.clear( );
+
+    outputStream_.open( fileName_, std::ios::out | std::ios::binary | std::ios::trunc );
+    if( !outputStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when opening propagation output file " + fileName_ );
+    }
+    outputStream_.write( binaryPropagationOutputFileIdentifier, sizeof( binaryPropagationOutputFileIdentifier ) );
+    outputStream_.flush( );
+}
+
+//! Function to add a single state entry
+void BinaryFilePropagationOutputSink::addStateEntry(
+        const double time, const Eigen::Ref< const Eigen::MatrixXd >& state )
+{
+    addEntry( 0, time, state );
+}
+
+//! Function to add a single dependent variable entry
+void BinaryFilePropagationOutputSink::addDependentVariableEntry(
+        const double time, const Eigen::Ref< const Eigen::VectorXd >& dependentVariables )
+{
+    addEntry( 1, time, dependentVariables );
+}
+
+//! Function to write all buffered entries to the file, and close it
+void BinaryFilePropagationOutputSink::finalizePropagation( )
+{
+    flush( );
+    outputStream_.close( );
+}
+
+//! Function to write all buffered entries to the file
+void BinaryFilePropagationOutputSink::flush( )
+{
+    if( buffer_.size( ) > 0 )
+    {
+        outputStream_.write( buffer_.data( ), buffer_.size( ) );
+        buffer_.clear( );
+    }
+    outputStream_.flush( );
+    if( !outputStream_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing to propagation output file " + fileName_ );
+    }
+}
+
+//! Function to add a single entry to the buffer, writing the buffer to file if it is full
+void BinaryFilePropagationOutputSink::addEntry(
+        const int32_t entryType, const double time, const Eigen::Ref< const Eigen::MatrixXd >& value )
+{
+    if( !outputStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when adding entry to propagation output file " + fileName_ +
+                                  ", file is not open" );
+    }
+
+    int32_t numberOfRows = static_cast< int32_t >( value.rows( ) );
+    int32_t numberOfColumns = static_cast< int32_t >( value.cols( ) );
+    appendToBuffer( buffer_, &entryType, sizeof( entryType ) );
+    appendToBuffer( buffer_, &time, sizeof( time ) );
+    appendToBuffer( buffer_, &numberOfRows, sizeof( numberOfRows ) );
+    appendToBuffer( buffer_, &numberOfColumns, sizeof( numberOfColumns ) );
+    for( int j = 0; j < value.cols( ); j++ )
+    {
+        appendToBuffer( buffer_, value.col( j ).data( ), value.rows( ) * sizeof( double ) );
+    }
+
+    if( buffer_.size( ) >= bufferSize_ )
+    {
+        flush( );
+    }
+}
+
+//! Function to read a file written by a BinaryFilePropagationOutputSink
+void readBinaryPropagationOutputFile(
+        const std::string& fileName,
+        std::map< double, Eigen::MatrixXd >& stateHistory,
+        std::map< double, Eigen::VectorXd >& dependentVariableHistory )
+{
+    stateHistory.clear( );
+    dependentVariableHistory.clear( );
+
+    std::ifstream inputStream( fileName, std::ios::in | std::ios::binary );
+    if( !inputStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when opening propagation output file " + fileName );
+    }
+
+    char fileIdentifier[ sizeof( binaryPropagationOutputFileIdentifier ) ];
+    if( !inputStream.read( fileIdentifier, sizeof( fileIdentifier ) ) ||
+            std::memcmp( fileIdentifier, binaryPropagationOutputFileIdentifier, sizeof( fileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading propagation output file " + fileName + ", file type not recognized" );
+    }
+
+    int32_t entryType, numberOfRows, numberOfColumns;
+    double time;
+    while( inputStream.read( reinterpret_cast< char* >( &entryType ), sizeof( entryType ) ) &&
+           inputStream.read( reinterpret_cast< char* >( &time ), sizeof( time ) ) &&
+           inputStream.read( reinterpret_cast< char* >( &numberOfRows ), sizeof( numberOfRows ) ) &&
+           inputStream.read( reinterpret_cast< char* >( &numberOfColumns ), sizeof( numberOfColumns ) ) )
+    {
+        if( numberOfRows < 0 || numberOfColumns < 0 || entryType < 0 || entryType > 1 )
+        {
+            throw std::runtime_error( "Error when reading propagation output file " + fileName + ", file is corrupted" );
+        }
+
+        Eigen::MatrixXd value( numberOfRows, numberOfColumns );
+        if( !inputStream.read( reinterpret_cast< char* >( value.data( ) ),
+                               static_cast< std::streamsize >( value.size( ) * sizeof( double ) ) ) )
+        {
+            // Incomplete last record (file still being written)
+            break;
+        }
+
+        if( entryType == 0 )
+        {
+            stateHistory[ time ] = value;
+        }
+        else
+        {
+            dependentVariableHistory[ time ] = value.col( 0 );
+        }
+    }
+}
+
+//! Constructor
+RingBufferPropagationOutputSink::RingBufferPropagationOutputSink( const int capacity ):
+    capacity_( capacity )
+{
+    if( capacity_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating ring buffer propagation output, capacity must be positive" );
+    }
+}
+
+//! Function to empty the buffer
+void RingBufferPropagationOutputSink::startPropagation( )
+{
+    std::lock_guard< std::mutex > bufferLock( bufferMutex_ );
+    stateBuffer_ = EntryRingBuffer( );
+    dependentVariableBuffer_ = EntryRingBuffer( );
+}
+
+//! Function to add a single state entry
+void RingBufferPropagationOutputSink::addStateEntry(
+        const double time, const Eigen::Ref< const Eigen::MatrixXd >& state )
+{
+    addEntry( stateBuffer_, time, state );
+}
+
+//! Function to add a single dependent variable entry
+void RingBufferPropagationOutputSink::addDependentVariableEntry(
+        const double time, const Eigen::Ref< const Eigen::VectorXd >& dependentVariables )
+{
+    addEntry( dependentVariableBuffer_, time, dependentVariables );
+}
+
+//! Function to retrieve the stored (most recent) state entries
+std::map< double, Eigen::MatrixXd > RingBufferPropagationOutputSink::getStateHistory( )
+{
+    return getEntries( stateBuffer_ );
+}
+
+//! Function to retrieve the stored (most recent) dependent variable entries
+std::map< double, Eigen::VectorXd > RingBufferPropagationOutputSink::getDependentVariableHistory( )
+{
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+    for( auto entry : getEntries( dependentVariableBuffer_ ) )
+    {
+        dependentVariableHistory[ entry.first ] = entry.second.col( 0 );
+    }
+    return dependentVariableHistory;
+}
+
+//! Function to retrieve the total number of state entries added since the start of the propagation
+unsigned int RingBufferPropagationOutputSink::getNumberOfAddedStateEntries( )
+{
+    std::lock_guard< std::mutex > bufferLock( bufferMutex_ );
+    return stateBuffer_.numberOfAddedEntries;
+}
+
+//! Function to retrieve the total number of dependent variable entries added since the start of the propagation
+unsigned int RingBufferPropagationOutputSink::getNumberOfAddedDependentVariableEntries( )
+{
+    std::lock_guard< std::mutex > bufferLock( bufferMutex_ );
+    return dependentVariableBuffer_.numberOfAddedEntries;
+}
+
+//! Function to add an entry to a ring buffer
+void RingBufferPropagationOutputSink::addEntry(
+        EntryRingBuffer& ringBuffer, const double time, const Eigen::Ref< const Eigen::MatrixXd >& value )
+{
+    std::lock_guard< std::mutex > bufferLock( bufferMutex_ );
+
+    // Allocate buffer upon first entry
+    if( ringBuffer.numberOfAddedEntries == 0 )
+    {
+        ringBuffer.entryRows = static_cast< int >( value.rows( ) );
+        ringBuffer.entryColumns = static_cast< int >( value.cols( ) );
+        ringBuffer.times.assign( capacity_, 0.0 );
+        ringBuffer.values.resize( ringBuffer.entryRows * ringBuffer.entryColumns, capacity_ );
+    }
+    else if( value.rows( ) != ringBuffer.entryRows || value.cols( ) != ringBuffer.entryColumns )
+    {
+        throw std::runtime_error( "Error when adding entry to ring buffer propagation output, entry size is inconsistent" );
+    }
+
+    int bufferIndex = static_cast< int >( ringBuffer.numberOfAddedEntries % static_cast< unsigned int >( capacity_ ) );
+    ringBuffer.times[ bufferIndex ] = time;
+    Eigen::Map< Eigen::MatrixXd >( ringBuffer.values.col( bufferIndex ).data( ),
+                                   ringBuffer.entryRows, ringBuffer.entryColumns ) = value;
+    ringBuffer.numberOfAddedEntries++;
+}
+
+//! Function to retrieve the entries stored in a ring buffer
+std::map< double, Eigen::MatrixXd > RingBufferPropagationOutputSink::getEntries( const EntryRingBuffer& ringBuffer )
+{
+    std::lock_guard< std::mutex > bufferLock( bufferMutex_ );
+
+    std::map< double, Eigen::MatrixXd > entries;
+    unsigned int numberOfStoredEntries = std::min( ringBuffer.numberOfAddedEntries, static_cast< unsigned int >( capacity_ ) );
+    for( unsigned int i = 0; i < numberOfStoredEntries; i++ )
+    {
+        entries[ ringBuffer.times[ i ] ] = Eigen::Map< const Eigen::MatrixXd >(
+                    ringBuffer.values.col( i ).data( ), ringBuffer.entryRows, ringBuffer.entryColumns );
+    }
+    return entries;
+}
+
+} // namespace propagators
+
+} // namespace tudat
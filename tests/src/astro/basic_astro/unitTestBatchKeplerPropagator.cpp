@@ -0,0 +1,193 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <map>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/batchKeplerPropagator.h"
+#include "tudat/astro/basic_astro/keplerPropagator.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace orbital_element_conversions;
+
+BOOST_AUTO_TEST_SUITE( test_batch_kepler_propagator )
+
+//! Test fixed-iteration solution of Kepler's equation against root-finder based solution, including near-parabolic
+//! orbits (for which the root-finder based fallback is used).
+BOOST_AUTO_TEST_CASE( testFixedIterationMeanToEccentricAnomaly )
+{
+    const double pi = mathematical_constants::PI;
+
+    std::vector< double > eccentricities = { 0.0, 0.01, 0.1, 0.5, 0.9, 0.99, 0.999, 0.99999, 1.0 - 1.0E-10 };
+    int numberOfMeanAnomalies = 101;
+
+    Eigen::VectorXd eccentricityList( eccentricities.size( ) * numberOfMeanAnomalies );
+    Eigen::VectorXd meanAnomalyList( eccentricities.size( ) * numberOfMeanAnomalies );
+    for( unsigned int i = 0; i < eccentricities.size( ); i++ )
+    {
+        for( int j = 0; j < numberOfMeanAnomalies; j++ )
+        {
+            // Include mean anomalies outside of [-PI, PI]
+            double meanAnomaly = -3.0 * pi + 6.0 * pi * static_cast< double >( j ) / ( numberOfMeanAnomalies - 1 ) + 0.01;
+
+            eccentricityList( i * numberOfMeanAnomalies + j ) = eccentricities.at( i );
+            meanAnomalyList( i * numberOfMeanAnomalies + j ) = meanAnomaly;
+
+            // Check scalar conversion against Kepler's equation, and against root-finder based conversion
+            double eccentricAnomaly = convertMeanAnomalyToEccentricAnomalyWithFixedIterations(
+                        eccentricities.at( i ), meanAnomaly );
+            BOOST_CHECK( eccentricAnomaly >= -pi && eccentricAnomaly <= pi );
+
+            double tolerance = ( eccentricities.at( i ) < 0.9999 ) ? 1.0E-14 : 1.0E-9;
+            BOOST_CHECK_SMALL( std::fabs( reduceMeanAnomaly(
+                                              eccentricAnomaly - eccentricities.at( i ) * std::sin( eccentricAnomaly ) -
+                                              meanAnomaly ) ), tolerance );
+
+            double rootFinderEccentricAnomaly = convertMeanAnomalyToEccentricAnomaly(
+                        eccentricities.at( i ), meanAnomaly );
+            BOOST_CHECK_SMALL( std::fabs( reduceMeanAnomaly( eccentricAnomaly - rootFinderEccentricAnomaly ) ),
+                               ( eccentricities.at( i ) < 0.9999 ) ? 1.0E-13 : 1.0E-6 );
+        }
+    }
+
+    // Check batch conversion against scalar conversion, for serial and parallel evaluation
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        Eigen::VectorXd eccentricAnomalyList = convertMeanAnomaliesToEccentricAnomalies(
+                    eccentricityList, meanAnomalyList, numberOfThreads );
+        for( int i = 0; i < eccentricityList.rows( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( eccentricAnomalyList( i ), convertMeanAnomalyToEccentricAnomalyWithFixedIterations(
+                                   eccentricityList( i ), meanAnomalyList( i ) ) );
+        }
+    }
+
+    // Check that inconsistent and non-elliptical input is rejected
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies( eccentricityList, Eigen::VectorXd( meanAnomalyList.segment( 0, 2 ) ) ),
+                       std::runtime_error );
+    eccentricityList( 3 ) = 1.5;
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies( eccentricityList, meanAnomalyList ), std::runtime_error );
+}
+
+//! Test batch propagation of list of Kepler orbits against propagateKeplerOrbit.
+BOOST_AUTO_TEST_CASE( testBatchKeplerOrbitPropagation )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+
+    // Create list of orbits, including high-eccentricity and hyperbolic orbits
+    int numberOfOrbits = 50;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > initialKeplerianStates( 6, numberOfOrbits );
+    for( int i = 0; i < numberOfOrbits; i++ )
+    {
+        double eccentricity = ( i % 10 == 9 ) ? 1.5 : 0.995 * static_cast< double >( i % 10 ) / 9.0;
+        double semiMajorAxis = ( eccentricity < 1.0 ) ? ( 7000.0E3 + 1000.0E3 * i ) : -20000.0E3;
+        initialKeplerianStates.col( i ) << semiMajorAxis, eccentricity, 0.1 * i, 0.2 * i, 0.3 * i,
+                ( eccentricity < 1.0 ) ? 0.4 * i : 0.5;
+    }
+
+    std::vector< double > propagationTimes;
+    for( int i = 0; i < 25; i++ )
+    {
+        propagationTimes.push_back( -86400.0 + 7200.0 * i );
+    }
+
+    for( int numberOfThreads = 1; numberOfThreads <= 3; numberOfThreads += 2 )
+    {
+        std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > keplerianStates =
+                propagateKeplerOrbitsToPropagationTimes(
+                    initialKeplerianStates, propagationTimes, earthGravitationalParameter, false, numberOfThreads );
+        std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > cartesianStates =
+                propagateKeplerOrbitsToPropagationTimes(
+                    initialKeplerianStates, propagationTimes, earthGravitationalParameter, true, numberOfThreads );
+
+        BOOST_CHECK_EQUAL( keplerianStates.size( ), propagationTimes.size( ) );
+        for( unsigned int j = 0; j < propagationTimes.size( ); j++ )
+        {
+            for( int i = 0; i < numberOfOrbits; i++ )
+            {
+                Eigen::Vector6d expectedKeplerianState = propagateKeplerOrbit(
+                            Eigen::Vector6d( initialKeplerianStates.col( i ) ), propagationTimes.at( j ),
+                            earthGravitationalParameter );
+                Eigen::Vector6d expectedCartesianState = convertKeplerianToCartesianElements(
+                            expectedKeplerianState, earthGravitationalParameter );
+
+                for( int k = 0; k < 5; k++ )
+                {
+                    BOOST_CHECK_EQUAL( keplerianStates.at( j )( k, i ), expectedKeplerianState( k ) );
+                }
+                BOOST_CHECK_SMALL( std::fabs( reduceMeanAnomaly(
+                                                  keplerianStates.at( j )( trueAnomalyIndex, i ) -
+                                                  expectedKeplerianState( trueAnomalyIndex ) ) ), 1.0E-11 );
+
+                for( int k = 0; k < 3; k++ )
+                {
+                    BOOST_CHECK_SMALL( std::fabs( cartesianStates.at( j )( k, i ) - expectedCartesianState( k ) ),
+                                       1.0E-10 * expectedCartesianState.segment( 0, 3 ).norm( ) );
+                    BOOST_CHECK_SMALL( std::fabs( cartesianStates.at( j )( k + 3, i ) - expectedCartesianState( k + 3 ) ),
+                                       1.0E-10 * expectedCartesianState.segment( 3, 3 ).norm( ) );
+                }
+
+                // Check consistency with scalar fixed-iteration propagation
+                Eigen::Vector6d fixedIterationKeplerianState = propagateKeplerOrbitWithFixedIterations(
+                            Eigen::Vector6d( initialKeplerianStates.col( i ) ), propagationTimes.at( j ),
+                            earthGravitationalParameter );
+                BOOST_CHECK_EQUAL( keplerianStates.at( j )( trueAnomalyIndex, i ),
+                                   fixedIterationKeplerianState( trueAnomalyIndex ) );
+            }
+        }
+    }
+
+    // Check single-epoch and state history interfaces
+    Eigen::Matrix< double, 6, Eigen::Dynamic > singleTimeStates = propagateKeplerOrbits(
+                initialKeplerianStates, propagationTimes.at( 3 ), earthGravitationalParameter );
+    std::vector< double > outputTimes = { 1000.0 + propagationTimes.at( 3 ), 1000.0 + propagationTimes.at( 5 ) };
+    std::map< double, Eigen::Matrix< double, 6, Eigen::Dynamic > > cartesianStateHistory =
+            getKeplerOrbitsCartesianStateHistory(
+                initialKeplerianStates, 1000.0, outputTimes, earthGravitationalParameter, 2 );
+    BOOST_CHECK_EQUAL( cartesianStateHistory.size( ), 2 );
+    for( int i = 0; i < numberOfOrbits; i++ )
+    {
+        Eigen::Vector6d expectedKeplerianState = propagateKeplerOrbitWithFixedIterations(
+                    Eigen::Vector6d( initialKeplerianStates.col( i ) ), propagationTimes.at( 3 ),
+                    earthGravitationalParameter );
+        BOOST_CHECK_EQUAL( singleTimeStates( trueAnomalyIndex, i ), expectedKeplerianState( trueAnomalyIndex ) );
+
+        Eigen::Vector6d expectedCartesianState = convertKeplerianToCartesianElements(
+                    expectedKeplerianState, earthGravitationalParameter );
+        for( int k = 0; k < 6; k++ )
+        {
+            BOOST_CHECK_EQUAL( cartesianStateHistory.at( outputTimes.at( 0 ) )( k, i ), expectedCartesianState( k ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
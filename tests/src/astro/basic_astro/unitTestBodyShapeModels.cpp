@@ -16,6 +16,9 @@
 #define BOOST_TEST_MAIN
 
 
+#include <cstdlib>
+#include <limits>
+
 #include <boost/lambda/lambda.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -289,6 +292,92 @@ BOOST_AUTO_TEST_CASE( testPolyhedronShapeModel )
 
 }
 
+BOOST_AUTO_TEST_CASE( testPolyhedronShapeModelWithSpatialIndex )
+{
+    using namespace tudat::basic_astrodynamics;
+
+    // Define cuboid polyhedron
+    const double w = 10.0; // width
+    const double h = 10.0; // height
+    const double l = 20.0; // length
+
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    // Create shape models with and without spatial index
+    PolyhedronBodyShapeModel vertexShapeModel = PolyhedronBodyShapeModel (
+        verticesCoordinates, verticesDefiningEachFacet, true, true, false );
+    PolyhedronBodyShapeModel vertexShapeModelWithIndex = PolyhedronBodyShapeModel (
+        verticesCoordinates, verticesDefiningEachFacet, true, true, true );
+    PolyhedronBodyShapeModel shapeModelWithIndex = PolyhedronBodyShapeModel (
+        verticesCoordinates, verticesDefiningEachFacet, true, false, true );
+    PolyhedronBodyShapeModel unsignedShapeModelWithIndex = PolyhedronBodyShapeModel (
+        verticesCoordinates, verticesDefiningEachFacet, false, false, true );
+    BOOST_CHECK_EQUAL( shapeModelWithIndex.getUseSpatialIndex( ), true );
+    BOOST_CHECK_EQUAL( vertexShapeModel.getUseSpatialIndex( ), false );
+
+    // Generate random positions in and around the cuboid
+    const int numberOfPositions = 500;
+    std::srand( 42 );
+    Eigen::Matrix3Xd testPositions = Eigen::Matrix3Xd::Random( 3, numberOfPositions );
+    testPositions.row( 0 ) = testPositions.row( 0 ) * 30.0 + Eigen::RowVectorXd::Constant( numberOfPositions, l / 2.0 );
+    testPositions.row( 1 ) = testPositions.row( 1 ) * 15.0 + Eigen::RowVectorXd::Constant( numberOfPositions, w / 2.0 );
+    testPositions.row( 2 ) = testPositions.row( 2 ) * 15.0 + Eigen::RowVectorXd::Constant( numberOfPositions, h / 2.0 );
+
+    Eigen::Vector3d halfSizes = ( Eigen::Vector3d( ) << l / 2.0, w / 2.0, h / 2.0 ).finished( );
+    for( int i = 0; i < numberOfPositions; i++ )
+    {
+        Eigen::Vector3d testCartesianPosition = testPositions.col( i );
+
+        // Distance to vertices should be identical to linear search
+        BOOST_CHECK_CLOSE_FRACTION( vertexShapeModelWithIndex.getAltitude( testCartesianPosition ),
+                                    vertexShapeModel.getAltitude( testCartesianPosition ),
+                                    std::numeric_limits< double >::epsilon( ) );
+
+        // Compute exact signed distance to the cuboid surface
+        Eigen::Vector3d offsetFromFaces = ( testCartesianPosition - halfSizes ).cwiseAbs( ) - halfSizes;
+        double expectedAltitude = offsetFromFaces.cwiseMax( 0.0 ).norm( ) + std::min( offsetFromFaces.maxCoeff( ), 0.0 );
+
+        BOOST_CHECK_SMALL( shapeModelWithIndex.getAltitude( testCartesianPosition ) - expectedAltitude, 1.0E-12 );
+        BOOST_CHECK_SMALL( unsignedShapeModelWithIndex.getAltitude( testCartesianPosition ) - std::abs( expectedAltitude ),
+                           1.0E-12 );
+    }
+
+    // Check batch computation of altitudes, with single and multiple threads
+    for( int numberOfThreads : { 1, 4 } )
+    {
+        Eigen::VectorXd altitudes = shapeModelWithIndex.getAltitudes( testPositions, numberOfThreads );
+        Eigen::VectorXd vertexAltitudes = vertexShapeModel.getAltitudes( testPositions, numberOfThreads );
+        for( int i = 0; i < numberOfPositions; i++ )
+        {
+            BOOST_CHECK_EQUAL( altitudes( i ), shapeModelWithIndex.getAltitude( testPositions.col( i ) ) );
+            BOOST_CHECK_EQUAL( vertexAltitudes( i ), vertexShapeModel.getAltitude( testPositions.col( i ) ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( testHybridShapeModel )
 {
     using namespace tudat::basic_astrodynamics;
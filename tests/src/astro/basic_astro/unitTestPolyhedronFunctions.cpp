@@ -12,6 +12,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cmath>
 #include <limits>
 
 #include <boost/test/tools/floating_point_comparison.hpp>
@@ -124,6 +125,118 @@ BOOST_AUTO_TEST_CASE( testPolyhedronUtilities )
 
 }
 
+//! Test computation of spherical harmonic coefficients of polyhedron.
+BOOST_AUTO_TEST_CASE( testPolyhedronSphericalHarmonicCoefficients )
+{
+    // Check quadrature rule for tetrahedron on monomials: int x^a y^b z^c over unit tetrahedron = a! b! c! / ( a+b+c+3 )!
+    for( int degree = 0; degree <= 6; degree++ )
+    {
+        Eigen::MatrixXd barycentricCoordinates;
+        Eigen::VectorXd weights;
+        basic_astrodynamics::computeTetrahedronQuadratureRule( degree, barycentricCoordinates, weights );
+
+        for( int a = 0; a <= degree; a++ )
+        {
+            for( int b = 0; b <= degree - a; b++ )
+            {
+                int c = degree - a - b;
+                double expectedIntegral = std::tgamma( a + 1 ) * std::tgamma( b + 1 ) * std::tgamma( c + 1 ) /
+                        std::tgamma( degree + 4 );
+
+                // Unit tetrahedron has volume 1/6; first barycentric coordinate corresponds to the origin
+                double computedIntegral = 0.0;
+                for( int i = 0; i < weights.rows( ); i++ )
+                {
+                    computedIntegral += weights( i ) / 6.0 *
+                            std::pow( barycentricCoordinates( i, 1 ), a ) *
+                            std::pow( barycentricCoordinates( i, 2 ), b ) *
+                            std::pow( barycentricCoordinates( i, 3 ), c );
+                }
+                BOOST_CHECK_CLOSE_FRACTION( expectedIntegral, computedIntegral, 1.0E-13 );
+            }
+        }
+    }
+
+    // Define cuboid polyhedron
+    const double w = 10.0; // width
+    const double h = 10.0; // height
+    const double l = 20.0; // length
+
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    const double tolerance = 1.0E-14;
+    const double referenceRadius = 15.0;
+    const int maximumDegree = 6;
+
+    // Check degree 0 and 1 coefficients of cuboid w.r.t. corner (determined by centroid)
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients =
+            basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                verticesCoordinates, verticesDefiningEachFacet, maximumDegree, referenceRadius );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 0, 0 ), 1.0, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 1, 0 ), h / 2.0 / referenceRadius / std::sqrt( 3.0 ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 1, 1 ), l / 2.0 / referenceRadius / std::sqrt( 3.0 ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.second( 1, 1 ), w / 2.0 / referenceRadius / std::sqrt( 3.0 ), tolerance );
+
+    // Check degree 2 coefficients of cuboid w.r.t. centroid (from inertia tensor), and vanishing odd degree coefficients
+    Eigen::MatrixXd centeredVerticesCoordinates = basic_astrodynamics::modifyPolyhedronCentroidPosition(
+            verticesCoordinates, verticesDefiningEachFacet, Eigen::Vector3d::Zero( ) );
+    coefficients = basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                centeredVerticesCoordinates, verticesDefiningEachFacet, maximumDegree, referenceRadius );
+
+    double expectedC20 = ( 2.0 * h * h - l * l - w * w ) / ( 24.0 * referenceRadius * referenceRadius ) / std::sqrt( 5.0 );
+    double expectedC22 = ( l * l - w * w ) / ( 48.0 * referenceRadius * referenceRadius ) / std::sqrt( 5.0 / 12.0 );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 0, 0 ), 1.0, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 2, 0 ), expectedC20, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 2, 2 ), expectedC22, tolerance );
+    BOOST_CHECK_SMALL( coefficients.first( 2, 1 ), tolerance );
+    BOOST_CHECK_SMALL( coefficients.second( 2, 1 ), tolerance );
+    BOOST_CHECK_SMALL( coefficients.second( 2, 2 ), tolerance );
+    for( int degree = 1; degree <= maximumDegree; degree += 2 )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            BOOST_CHECK_SMALL( coefficients.first( degree, order ), tolerance );
+            BOOST_CHECK_SMALL( coefficients.second( degree, order ), tolerance );
+        }
+    }
+
+    // Check that multi-threaded computation gives same result
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > multiThreadedCoefficients =
+            basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                centeredVerticesCoordinates, verticesDefiningEachFacet, maximumDegree, referenceRadius, 3 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            BOOST_CHECK_SMALL( coefficients.first( degree, order ) - multiThreadedCoefficients.first( degree, order ), tolerance );
+            BOOST_CHECK_SMALL( coefficients.second( degree, order ) - multiThreadedCoefficients.second( degree, order ), tolerance );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,157 @@
+/*    Copyright (c) 2010-2020, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/ephemerides/tleCatalogPropagator.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_tle_catalog_propagator )
+
+//! Test TLE catalog propagation against reference values from Vallado et al. (2006), and against TleEphemeris
+BOOST_AUTO_TEST_CASE( testTleCatalogPropagator )
+{
+    using namespace tudat::ephemerides;
+
+    // Dummy two line element set from Vallado (2013), page 234 (case 00005 of Vallado et al., 2006)
+    std::string elements =  "1 00005U 58002B   00179.78495062  .00000023  00000-0  28098-4 0  4753\n"
+                            "2 00005  34.2682 348.7242 1859667 331.7664  19.3264 10.82419157413667";
+    std::shared_ptr< Tle > valladoTle = std::make_shared< Tle >( elements );
+
+    // Create catalog, with objects of different (near-Earth) orbits, including a low-perigee orbit
+    std::vector< std::shared_ptr< Tle > > tles = { valladoTle };
+    const double pi = mathematical_constants::PI;
+    for( int i = 0; i < 40; i++ )
+    {
+        double meanMotion = ( 12.0 + 0.1 * i ) * 2.0 * pi / ( 24.0 * 60.0 );
+        double eccentricity = 0.0002 + 0.005 * ( i % 8 );
+        tles.push_back( std::make_shared< Tle >(
+                            valladoTle->getEpoch( ) + 3600.0 * i, 1.0E-5 * ( i % 5 ), 0.1 + 0.07 * i, 0.3 * i,
+                            eccentricity, 0.2 * i, 0.4 * i, meanMotion ) );
+    }
+    tles.push_back( std::make_shared< Tle >( valladoTle->getEpoch( ), 1.0E-4, 1.0, 2.0, 0.001, 3.0, 4.0,
+                                             16.2 * 2.0 * pi / ( 24.0 * 60.0 ) ) );
+    TleCatalogPropagator catalogPropagator( tles );
+    BOOST_CHECK_EQUAL( catalogPropagator.getNumberOfObjects( ), tles.size( ) );
+
+    std::vector< double > epochs;
+    for( int i = 0; i < 10; i++ )
+    {
+        epochs.push_back( valladoTle->getEpoch( ) + 0.5 * physical_constants::JULIAN_DAY * i );
+    }
+    epochs.push_back( valladoTle->getEpoch( ) + 360.0 * 60.0 );
+
+    // Propagate catalog in TEME and J2000 frames, serially and in parallel
+    Eigen::Matrix< double, 6, Eigen::Dynamic > temeStates = catalogPropagator.propagateToEpochs( epochs, "TEME" );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > j2000States = catalogPropagator.propagateToEpochs( epochs, "J2000" );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > parallelJ2000States;
+    catalogPropagator.propagateToEpochs( epochs, parallelJ2000States, "J2000", 3 );
+    BOOST_CHECK_EQUAL( j2000States.cols( ), tles.size( ) * epochs.size( ) );
+    BOOST_CHECK( ( parallelJ2000States - j2000States ).cwiseAbs( ).maxCoeff( ) == 0.0 );
+
+    // Check TEME states against SGP4 verification values of Vallado et al. (2006), which use a slightly different
+    // recovery of the original semi-major axis from the TLE than the Spacetrack Report No. 3 model used here.
+    Eigen::Vector3d verificationPosition, verificationVelocity;
+    verificationPosition << 7022465.29266, -1400082.96755, 39.95155;
+    verificationVelocity << 1893.841015, 6405.893759, 4534.807250;
+    BOOST_CHECK_SMALL( ( temeStates.block( 0, 0, 3, 1 ) - verificationPosition ).norm( ), 1.0 );
+    BOOST_CHECK_SMALL( ( temeStates.block( 3, 0, 3, 1 ) - verificationVelocity ).norm( ), 0.05 );
+
+    verificationPosition << -7154031.20202, -3783176.82504, -3536194.12294;
+    verificationVelocity << 4741.887409, -4151.817765, -2093.935425;
+    BOOST_CHECK_SMALL( ( temeStates.block( 0, 10, 3, 1 ) - verificationPosition ).norm( ), 50.0 );
+    BOOST_CHECK_SMALL( ( temeStates.block( 3, 10, 3, 1 ) - verificationVelocity ).norm( ), 0.05 );
+
+    // Check J2000 state after 3 days against values in Vallado (2013), as in TwoLineElementsEphemeris test
+    std::vector< double > verificationEpochs = { 3.0 * physical_constants::JULIAN_DAY + valladoTle->getEpoch( ) };
+    Eigen::Matrix< double, 6, Eigen::Dynamic > verificationStates =
+            catalogPropagator.propagateToEpochs( verificationEpochs, "J2000" );
+    verificationPosition << -9059941.3786, 4659697.2000, 813958.8875;
+    verificationVelocity << -2233.348094, -4110.136162, -3157.394074;
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( verificationStates.block( 0, 0, 3, 1 ), verificationPosition, 5.0E-5 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( verificationStates.block( 3, 0, 3, 1 ), verificationVelocity, 5.0E-6 );
+
+    // Check consistency of frames, and compare all states with those of TleEphemeris
+    for( unsigned int j = 0; j < epochs.size( ); j++ )
+    {
+        Eigen::Matrix3d temeToJ2000Rotation = getTemeToJ2000RotationMatrix( epochs.at( j ) );
+        for( unsigned int i = 0; i < tles.size( ); i++ )
+        {
+            BOOST_CHECK( !catalogPropagator.isDeepSpaceObject( i ) );
+
+            const int columnIndex = i * epochs.size( ) + j;
+            Eigen::Vector6d rotatedState;
+            rotatedState << temeToJ2000Rotation * temeStates.block( 0, columnIndex, 3, 1 ),
+                    temeToJ2000Rotation * temeStates.block( 3, columnIndex, 3, 1 );
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( rotatedState( k ), j2000States( k, columnIndex ) );
+            }
+
+            Eigen::Vector6d ephemerisState = TleEphemeris( "Earth", "J2000", tles.at( i ) ).getCartesianState(
+                        epochs.at( j ) );
+            BOOST_CHECK_SMALL( ( j2000States.block( 0, columnIndex, 3, 1 ) - ephemerisState.segment( 0, 3 ) ).norm( ),
+                               1.0E-7 * ephemerisState.segment( 0, 3 ).norm( ) );
+            BOOST_CHECK_SMALL( ( j2000States.block( 3, columnIndex, 3, 1 ) - ephemerisState.segment( 3, 3 ) ).norm( ),
+                               1.0E-7 * ephemerisState.segment( 3, 3 ).norm( ) );
+        }
+    }
+
+    // Check retrieval of state history of single object
+    std::map< double, Eigen::Vector6d > stateHistory = catalogPropagator.getObjectStateHistory(
+                epochs, j2000States, 5 );
+    BOOST_CHECK_EQUAL( stateHistory.size( ), epochs.size( ) );
+    for( unsigned int j = 0; j < epochs.size( ); j++ )
+    {
+        for( int k = 0; k < 6; k++ )
+        {
+            BOOST_CHECK_EQUAL( stateHistory.at( epochs.at( j ) )( k ), j2000States( k, 5 * epochs.size( ) + j ) );
+        }
+    }
+
+    // Check that circular orbits, for which singular terms are omitted, are propagated, and that deep-space objects
+    // are rejected, or (if allowed) detected and given NaN states
+    std::vector< std::shared_ptr< Tle > > circularTles =
+    { std::make_shared< Tle >( valladoTle->getEpoch( ), 1.0E-4, 0.1, 0.0, 0.0, 0.0, 0.0, 15.0 * 2.0 * pi / ( 24.0 * 60.0 ) ),
+      std::make_shared< Tle >( valladoTle->getEpoch( ), 0.0, 0.1, 0.0, 0.0001, 0.0, 0.0, 2.0 * pi / ( 24.0 * 60.0 ) ) };
+    BOOST_CHECK_THROW( TleCatalogPropagator{ circularTles }, std::runtime_error );
+
+    TleCatalogPropagator circularCatalogPropagator( circularTles, true );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > circularStates = circularCatalogPropagator.propagateToEpochs( epochs, "TEME" );
+    BOOST_CHECK( !circularCatalogPropagator.isDeepSpaceObject( 0 ) );
+    BOOST_CHECK( circularCatalogPropagator.isDeepSpaceObject( 1 ) );
+    for( unsigned int j = 0; j < epochs.size( ); j++ )
+    {
+        BOOST_CHECK( circularStates.col( j ).allFinite( ) );
+        BOOST_CHECK( circularStates.col( epochs.size( ) + j ).hasNaN( ) );
+    }
+
+    // Check error handling
+    BOOST_CHECK_THROW( catalogPropagator.propagateToEpochs( epochs, "ECLIPJ2000" ), std::runtime_error );
+    BOOST_CHECK_THROW( catalogPropagator.getObjectStateHistory( epochs, j2000States, tles.size( ) ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -15,13 +15,16 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cstdlib>
 #include <limits>
+#include <vector>
 
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/basics/testMacros.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/math/basic/polyhedron.h"
 
 namespace tudat
 {
@@ -238,6 +241,189 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
     }
 }
 
+//! Test computation of potential, gradient and hessian with packed dyads and multiple threads, against computation
+//! with unpacked dyads
+BOOST_AUTO_TEST_CASE( testPackedAndMultiThreadedGravityComputation )
+{
+    const double tolerance = 1.0E-14;
+
+    // Define cuboid polyhedron dimensions
+    const double w = 10.0; // width
+    const double h = 10.0; // height
+    const double l = 20.0; // length
+
+    // Define cuboid
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    const double gravitationalParameter = 6.67259e-11 * 2670 * w * h * l;
+
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+            gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet);
+    gravitation::PolyhedronGravityField multiThreadedGravityField = gravitation::PolyhedronGravityField(
+            gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet);
+    multiThreadedGravityField.setNumberOfThreads( 4 );
+
+    // Check that packed dyads are shared (not copied) by copies of the field, and recovered when unpacked
+    gravitation::PolyhedronGravityField copiedGravityField = gravityField;
+    BOOST_CHECK_EQUAL( copiedGravityField.getPackedEdgeDyads( ), gravityField.getPackedEdgeDyads( ) );
+    const basic_mathematics::PackedPolyhedronDyads& packedEdgeDyads = *gravityField.getPackedEdgeDyads( );
+    const std::vector< Eigen::MatrixXd > edgeDyads = gravityField.getEdgeDyads( );
+    BOOST_CHECK_EQUAL( edgeDyads.size( ), packedEdgeDyads.rows( ) );
+    for( unsigned int i = 0; i < edgeDyads.size( ); i++ )
+    {
+        Eigen::Matrix3d edgeDyad = edgeDyads.at( i );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( edgeDyad, edgeDyad.transpose( ), tolerance );
+
+        BOOST_CHECK_EQUAL( packedEdgeDyads( i, 0 ), edgeDyad( 0, 0 ) );
+        BOOST_CHECK_EQUAL( packedEdgeDyads( i, 1 ), edgeDyad( 0, 1 ) );
+        BOOST_CHECK_EQUAL( packedEdgeDyads( i, 2 ), edgeDyad( 0, 2 ) );
+        BOOST_CHECK_EQUAL( packedEdgeDyads( i, 3 ), edgeDyad( 1, 1 ) );
+        BOOST_CHECK_EQUAL( packedEdgeDyads( i, 4 ), edgeDyad( 1, 2 ) );
+        BOOST_CHECK_EQUAL( packedEdgeDyads( i, 5 ), edgeDyad( 2, 2 ) );
+    }
+
+    std::vector< Eigen::Vector3d > bodyFixedPositions =
+    { ( Eigen::Vector3d( ) << 0.0, 3.0, 2.0 ).finished( ),
+      ( Eigen::Vector3d( ) << 32.0, -7.0, 12.0 ).finished( ),
+      ( Eigen::Vector3d( ) << -1.0E3, 2.0E3, 0.5E3 ).finished( ) };
+
+    for( unsigned int i = 0; i < bodyFixedPositions.size( ); i++ )
+    {
+        // Compute reference values using unpacked dyads
+        gravitation::PolyhedronGravityCache gravityCache(
+                    verticesCoordinates, verticesDefiningEachFacet, gravityField.getVerticesDefiningEachEdge( ) );
+        gravityCache.update( bodyFixedPositions.at( i ) );
+
+        const double gravitationalConstantTimesDensity = gravitationalParameter / gravityField.getVolume( );
+        double expectedPotential = basic_mathematics::calculatePolyhedronGravitationalPotential(
+                    gravitationalConstantTimesDensity, gravityCache.getVerticesCoordinatesRelativeToFieldPoint( ),
+                    verticesDefiningEachFacet, gravityField.getVerticesDefiningEachEdge( ),
+                    gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ),
+                    gravityCache.getPerFacetFactor( ), gravityCache.getPerEdgeFactor( ) );
+        Eigen::Vector3d expectedGradient = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                    gravitationalConstantTimesDensity, gravityCache.getVerticesCoordinatesRelativeToFieldPoint( ),
+                    verticesDefiningEachFacet, gravityField.getVerticesDefiningEachEdge( ),
+                    gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ),
+                    gravityCache.getPerFacetFactor( ), gravityCache.getPerEdgeFactor( ) );
+        Eigen::Matrix3d expectedHessian = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
+                    gravitationalConstantTimesDensity, gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ),
+                    gravityCache.getPerFacetFactor( ), gravityCache.getPerEdgeFactor( ) );
+
+        // Compare with values using packed dyads, using single and multiple threads (which must give identical results)
+        BOOST_CHECK_CLOSE_FRACTION(
+                    expectedPotential, gravityField.getGravitationalPotential( bodyFixedPositions.at( i ) ), tolerance );
+        BOOST_CHECK_EQUAL( gravityField.getGravitationalPotential( bodyFixedPositions.at( i ) ),
+                           multiThreadedGravityField.getGravitationalPotential( bodyFixedPositions.at( i ) ) );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( expectedGradient( j ) - gravityField.getGradientOfPotential( bodyFixedPositions.at( i ) )( j ),
+                               tolerance * expectedGradient.norm( ) );
+            BOOST_CHECK_EQUAL( gravityField.getGradientOfPotential( bodyFixedPositions.at( i ) )( j ),
+                               multiThreadedGravityField.getGradientOfPotential( bodyFixedPositions.at( i ) )( j ) );
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( expectedHessian( j, k ) - gravityField.getHessianOfPotential( bodyFixedPositions.at( i ) )( j, k ),
+                                   tolerance * expectedHessian.norm( ) );
+            }
+        }
+    }
+}
+
+//! Test that multi-threaded summation of polyhedron potential and gradient is independent of number of threads, for a
+//! number of facets and edges for which the summation is distributed over threads
+BOOST_AUTO_TEST_CASE( testMultiThreadedSummationReproducibility )
+{
+    // Define (non-physical) list of facets and edges, which is sufficient to test the summations
+    const int numberOfVertices = 1000;
+    const int numberOfTerms = 4 * basic_mathematics::minimumPolyhedronIterationsPerThread + 123;
+
+    std::srand( 3 );
+    Eigen::MatrixXd verticesCoordinatesRelativeToFieldPoint = 100.0 * Eigen::MatrixXd::Random( numberOfVertices, 3 );
+    Eigen::MatrixXi verticesDefiningEachFacet( numberOfTerms, 3 );
+    Eigen::MatrixXi verticesDefiningEachEdge( numberOfTerms, 2 );
+    for( int i = 0; i < numberOfTerms; i++ )
+    {
+        for( int j = 0; j < 3; j++ )
+        {
+            verticesDefiningEachFacet( i, j ) = std::rand( ) % numberOfVertices;
+        }
+        for( int j = 0; j < 2; j++ )
+        {
+            verticesDefiningEachEdge( i, j ) = std::rand( ) % numberOfVertices;
+        }
+    }
+    basic_mathematics::PackedPolyhedronDyads facetDyads = basic_mathematics::PackedPolyhedronDyads::Random( numberOfTerms, 6 );
+    basic_mathematics::PackedPolyhedronDyads edgeDyads = basic_mathematics::PackedPolyhedronDyads::Random( numberOfTerms, 6 );
+    Eigen::VectorXd perFacetFactor = Eigen::VectorXd::Random( numberOfTerms );
+    Eigen::VectorXd perEdgeFactor = Eigen::VectorXd::Random( numberOfTerms );
+
+    // Compute potential and gradient using a single thread
+    double singleThreadedPotential = basic_mathematics::calculatePolyhedronGravitationalPotential(
+                1.0, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet, verticesDefiningEachEdge,
+                facetDyads, edgeDyads, perFacetFactor, perEdgeFactor, 1 );
+    Eigen::Vector3d singleThreadedGradient = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                1.0, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet, verticesDefiningEachEdge,
+                facetDyads, edgeDyads, perFacetFactor, perEdgeFactor, 1 );
+
+    // Check that results are identical (not only close) for different numbers of threads
+    for( int numberOfThreads = 2; numberOfThreads <= 5; numberOfThreads++ )
+    {
+        BOOST_CHECK_EQUAL(
+                    singleThreadedPotential, basic_mathematics::calculatePolyhedronGravitationalPotential(
+                        1.0, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet, verticesDefiningEachEdge,
+                        facetDyads, edgeDyads, perFacetFactor, perEdgeFactor, numberOfThreads ) );
+
+        Eigen::Vector3d multiThreadedGradient = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                    1.0, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet, verticesDefiningEachEdge,
+                    facetDyads, edgeDyads, perFacetFactor, perEdgeFactor, numberOfThreads );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( singleThreadedGradient( j ), multiThreadedGradient( j ) );
+        }
+
+        // Check that results are identical when evaluating on a (repeatedly used) persistent thread pool
+        utilities::ThreadPool threadPool( numberOfThreads );
+        for( unsigned int k = 0; k < 2; k++ )
+        {
+            BOOST_CHECK_EQUAL(
+                        singleThreadedPotential, basic_mathematics::calculatePolyhedronGravitationalPotential(
+                            1.0, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet, verticesDefiningEachEdge,
+                            facetDyads, edgeDyads, perFacetFactor, perEdgeFactor, numberOfThreads, &threadPool ) );
+
+            Eigen::Vector3d threadPoolGradient = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                        1.0, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet, verticesDefiningEachEdge,
+                        facetDyads, edgeDyads, perFacetFactor, perEdgeFactor, numberOfThreads, &threadPool );
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_EQUAL( singleThreadedGradient( j ), threadPoolGradient( j ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace tudat
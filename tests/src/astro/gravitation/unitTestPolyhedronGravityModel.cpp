@@ -177,6 +177,132 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
 //! Test the functionality of the polyhedron gravity field class.
 BOOST_AUTO_TEST_SUITE( test_polyhedron_gravity_model )
 
+//! Test switch between polyhedron and far-field spherical harmonic expansion
+BOOST_AUTO_TEST_CASE( testFarFieldSphericalHarmonicExpansion )
+{
+    // Define cuboid polyhedron dimensions
+    const double w = 10.0; // width
+    const double h = 10.0; // height
+    const double l = 20.0; // length
+
+    const double gravitationalConstant = 6.67259e-11;
+    const double density = 2670;
+    const double volume = w * h * l;
+    const double gravitationalParameter = gravitationalConstant * density * volume;
+
+    // Define cuboid, centered at origin
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    verticesCoordinates.rowwise( ) -= ( Eigen::RowVector3d( ) << l / 2.0, w / 2.0, h / 2.0 ).finished( );
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+        gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet);
+
+    // Switch radius inside the Brillouin sphere is not allowed
+    const double brillouinRadius = std::sqrt( l * l + w * w + h * h ) / 2.0;
+    BOOST_CHECK_THROW( gravityField.setFarFieldSphericalHarmonicExpansion( 8, 0.9 * brillouinRadius ), std::runtime_error );
+    BOOST_CHECK_EQUAL( gravityField.hasFarFieldSphericalHarmonicExpansion( ), false );
+
+    const double switchRadius = 2.0 * brillouinRadius;
+    const double transitionWidth = brillouinRadius;
+    gravityField.setFarFieldSphericalHarmonicExpansion( 10, switchRadius, transitionWidth );
+    BOOST_CHECK_EQUAL( gravityField.hasFarFieldSphericalHarmonicExpansion( ), true );
+    BOOST_CHECK_CLOSE_FRACTION( gravityField.getFarFieldReferenceRadius( ), brillouinRadius, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( gravityField.getFarFieldCosineCoefficients( )( 0, 0 ), 1.0, 1.0E-14 );
+
+    // Create acceleration models with and without far-field expansion
+    Eigen::Vector3d bodyFixedPosition;
+    std::function< void( Eigen::Vector3d& ) > bodyFixedPositionFunction =
+            [ & ]( Eigen::Vector3d& positionOfBodySubjectToAcceleration ){
+        positionOfBodySubjectToAcceleration = bodyFixedPosition; };
+
+    gravitation::PolyhedronGravitationalAccelerationModel polyhedronModel(
+                bodyFixedPositionFunction, gravitationalParameter, volume, verticesCoordinates,
+                verticesDefiningEachFacet, gravityField.getVerticesDefiningEachEdge( ),
+                gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ) );
+    gravitation::PolyhedronGravitationalAccelerationModel hybridModel(
+                bodyFixedPositionFunction, gravitationalParameter, volume, verticesCoordinates,
+                verticesDefiningEachFacet, gravityField.getVerticesDefiningEachEdge( ),
+                gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ) );
+    hybridModel.setFarFieldSphericalHarmonicExpansion(
+                gravityField.getFarFieldCosineCoefficients( ), gravityField.getFarFieldSineCoefficients( ),
+                gravityField.getFarFieldReferenceRadius( ), switchRadius, transitionWidth );
+    polyhedronModel.resetUpdatePotential( true );
+    hybridModel.resetUpdatePotential( true );
+
+    const Eigen::Vector3d positionDirection = ( Eigen::Vector3d( ) << 0.6, -0.3, 0.5 ).finished( ).normalized( );
+    for( double scaledDistance : { 1.5, 2.25, 2.5, 2.75, 3.5, 6.0 } )
+    {
+        bodyFixedPosition = scaledDistance * brillouinRadius * positionDirection;
+        polyhedronModel.updateMembers( );
+        hybridModel.updateMembers( );
+
+        Eigen::Vector3d polyhedronAcceleration = polyhedronModel.getAcceleration( );
+        Eigen::Vector3d hybridAcceleration = hybridModel.getAcceleration( );
+
+        // Compute expected weight of far-field expansion
+        double transitionFraction = std::min( std::max( ( bodyFixedPosition.norm( ) - switchRadius ) / transitionWidth, 0.0 ), 1.0 );
+        double expectedWeight = transitionFraction * transitionFraction * ( 3.0 - 2.0 * transitionFraction );
+        BOOST_CHECK_CLOSE_FRACTION( hybridModel.getCurrentFarFieldWeight( ) + 1.0, expectedWeight + 1.0, 1.0E-15 );
+
+        if( expectedWeight == 0.0 )
+        {
+            // Inside switch radius, polyhedron is used
+            for( unsigned int i = 0; i < 3; i++ )
+            {
+                BOOST_CHECK_EQUAL( polyhedronAcceleration( i ), hybridAcceleration( i ) );
+            }
+            BOOST_CHECK_EQUAL( polyhedronModel.getCurrentPotential( ), hybridModel.getCurrentPotential( ) );
+        }
+        else
+        {
+            // Outside switch radius, expansion should be close to polyhedron, and blended consistently
+            if( expectedWeight < 1.0 )
+            {
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                            polyhedronAcceleration, hybridModel.getCurrentPolyhedronAccelerationInBodyFixedFrame( ), 1.0E-15 );
+            }
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        polyhedronAcceleration, hybridModel.getCurrentFarFieldAccelerationInBodyFixedFrame( ), 1.0E-6 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( polyhedronAcceleration, hybridAcceleration, 1.0E-6 );
+            BOOST_CHECK_CLOSE_FRACTION( polyhedronModel.getCurrentPotential( ), hybridModel.getCurrentPotential( ), 1.0E-6 );
+
+            Eigen::Vector3d expectedHybridAcceleration =
+                    ( 1.0 - expectedWeight ) * hybridModel.getCurrentPolyhedronAccelerationInBodyFixedFrame( ) +
+                    expectedWeight * hybridModel.getCurrentFarFieldAccelerationInBodyFixedFrame( );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedHybridAcceleration, hybridAcceleration, 1.0E-15 );
+
+            // Check gradient of weight
+            double expectedWeightDerivative = 6.0 * transitionFraction * ( 1.0 - transitionFraction ) / transitionWidth;
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        ( expectedWeightDerivative * positionDirection + Eigen::Vector3d::Ones( ) ).eval( ),
+                        ( hybridModel.getCurrentFarFieldWeightGradient( ) + Eigen::Vector3d::Ones( ) ).eval( ), 1.0E-15 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace tudat
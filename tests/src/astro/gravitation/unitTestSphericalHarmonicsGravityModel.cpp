@@ -26,7 +26,9 @@
 #define BOOST_TEST_MAIN
 
 #include <cmath>
+#include <cstdlib>
 #include <limits>
+#include <vector>
 
 #include <boost/lambda/lambda.hpp>
 
@@ -240,6 +242,62 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAcceleration_Demo4 )
 }
 
 // Check the sum of all harmonics terms up to degree = 5 and order = 5 using the wrapper class.
+//! Test whether acceleration computed with fixed-degree Legendre cache is identical to that computed with the run-time
+//! sized cache, and whether the summation is consistent with the term-by-term computation.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationFixedDegreeLegendreCache )
+{
+    const int maximumDegree = 20;
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Set arbitrary, decaying, coefficients
+    std::srand( 42 );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int i = 2; i <= maximumDegree; i++ )
+    {
+        for( int j = 0; j <= i; j++ )
+        {
+            cosineCoefficients( i, j ) = 1.0E-5 / ( i * i ) * ( std::rand( ) / static_cast< double >( RAND_MAX ) - 0.5 );
+            if( j > 0 )
+            {
+                sineCoefficients( i, j ) = 1.0E-5 / ( i * i ) * ( std::rand( ) / static_cast< double >( RAND_MAX ) - 0.5 );
+            }
+        }
+    }
+
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree, maximumDegree );
+    basic_mathematics::SphericalHarmonicsCache fixedDegreeSphericalHarmonicsCache( maximumDegree, maximumDegree );
+    basic_mathematics::FixedDegreeLegendreCache< maximumDegree, maximumDegree > fixedDegreeLegendreCache;
+
+    std::vector< Eigen::Vector3d > positions =
+    { Eigen::Vector3d( 7.0e6, 8.0e6, 9.0e6 ), Eigen::Vector3d( -6.9e6, 1.0e5, -2.0e5 ),
+      Eigen::Vector3d( 1.0e6, -2.0e6, 7.2e6 ), Eigen::Vector3d( 4.2e7, 1.0e3, 0.0 ) };
+
+    std::map< std::pair< int, int >, Eigen::Vector3d > accelerationPerTerm;
+    for( unsigned int i = 0; i < positions.size( ); i++ )
+    {
+        Eigen::Vector3d acceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions.at( i ), gravitationalParameter, planetaryRadius,
+                    cosineCoefficients, sineCoefficients, sphericalHarmonicsCache, accelerationPerTerm );
+        Eigen::Vector3d fixedDegreeAcceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions.at( i ), gravitationalParameter, planetaryRadius,
+                    cosineCoefficients, sineCoefficients, fixedDegreeLegendreCache, fixedDegreeSphericalHarmonicsCache );
+        Eigen::Vector3d termByTermAcceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions.at( i ), gravitationalParameter, planetaryRadius,
+                    cosineCoefficients, sineCoefficients, sphericalHarmonicsCache, accelerationPerTerm, true );
+
+        for( int j = 0; j < 3; j++ )
+        {
+            // Same recurrences and summation order are used, so results should be identical
+            BOOST_CHECK_EQUAL( acceleration( j ), fixedDegreeAcceleration( j ) );
+            BOOST_CHECK_CLOSE_FRACTION( acceleration( j ), termByTermAcceleration( j ), 1.0E-15 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationWrapperClass )
 {
     // Short-cuts.
@@ -342,6 +400,159 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalPotentialWrapperClass
     BOOST_CHECK_EQUAL( expectedPotential, potential );
 }
 
+// Check batched computation of spherical harmonic acceleration against single-position computation.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationBatch )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define (arbitrary) geodesy-normalized coefficients, for full and truncated order
+    for( int testCase = 0; testCase < 2; testCase++ )
+    {
+        const int numberOfDegrees = 31;
+        const int numberOfOrders = ( testCase == 0 ) ? 31 : 13;
+        std::srand( 42 );
+        Eigen::MatrixXd cosineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( numberOfDegrees, numberOfOrders );
+        Eigen::MatrixXd sineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( numberOfDegrees, numberOfOrders );
+        cosineCoefficients( 0, 0 ) = 1.0;
+        for( int i = 0; i < numberOfDegrees; i++ )
+        {
+            sineCoefficients( i, 0 ) = 0.0;
+            for( int j = i + 1; j < numberOfOrders; j++ )
+            {
+                cosineCoefficients( i, j ) = 0.0;
+                sineCoefficients( i, j ) = 0.0;
+            }
+        }
+
+        // Define positions (number not divisible by number of lanes) and rotation to inertial frame
+        const int numberOfPositions = 13;
+        Eigen::Matrix3Xd positions = 3.0E6 * Eigen::Matrix3Xd::Random( 3, numberOfPositions );
+        for( int i = 0; i < numberOfPositions; i++ )
+        {
+            positions.col( i ) += ( planetaryRadius + 5.0E5 ) * positions.col( i ).normalized( );
+        }
+        const Eigen::Matrix3d rotation =
+                Eigen::AngleAxisd( 0.3, Eigen::Vector3d( 0.1, 0.5, -0.2 ).normalized( ) ).toRotationMatrix( );
+
+        // Compute accelerations in batch
+        Eigen::Matrix3Xd batchAccelerations;
+        computeGeodesyNormalizedGravitationalAccelerationSumBatch(
+                    positions, gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                    std::make_shared< basic_mathematics::SphericalHarmonicsBatchCache >( ), batchAccelerations,
+                    rotation );
+
+        // Compare against accelerations computed one at a time
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( numberOfDegrees, numberOfOrders + 1 );
+        std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+        for( int i = 0; i < numberOfPositions; i++ )
+        {
+            Eigen::Vector3d expectedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                        positions.col( i ), gravitationalParameter, planetaryRadius,
+                        cosineCoefficients, sineCoefficients, sphericalHarmonicsCache, dummyMap, false, rotation );
+            Eigen::Vector3d batchAcceleration = batchAccelerations.col( i );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, batchAcceleration, 1.0e-13 );
+        }
+    }
+}
+
+// Check spherical harmonic acceleration models that are computed in batch.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationModelBatch )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    std::srand( 42 );
+    Eigen::MatrixXd cosineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( 11, 11 );
+    Eigen::MatrixXd sineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( 11, 11 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int i = 0; i < 11; i++ )
+    {
+        sineCoefficients( i, 0 ) = 0.0;
+        for( int j = i + 1; j < 11; j++ )
+        {
+            cosineCoefficients( i, j ) = 0.0;
+            sineCoefficients( i, j ) = 0.0;
+        }
+    }
+
+    // Create acceleration models for a number of bodies, with and without batch
+    const int numberOfBodies = 10;
+    Eigen::Matrix3Xd positions = Eigen::Matrix3Xd::Zero( 3, numberOfBodies );
+    const Eigen::Quaterniond rotation = Eigen::Quaterniond(
+                Eigen::AngleAxisd( -0.7, Eigen::Vector3d( 0.3, -0.5, 0.8 ).normalized( ) ) );
+
+    std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > > batchModels;
+    std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > > singleModels;
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        for( int j = 0; j < 2; j++ )
+        {
+            std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > accelerationModel =
+                    std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                        [ =, &positions ]( Eigen::Vector3d& input ){ input = positions.col( i ); },
+                    gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                    [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                    [ = ]( ){ return rotation; } );
+            ( j == 0 ? batchModels : singleModels ).push_back( accelerationModel );
+        }
+    }
+    std::shared_ptr< SphericalHarmonicsAccelerationBatch > accelerationBatch =
+            createSphericalHarmonicsAccelerationBatch( batchModels );
+    BOOST_CHECK_EQUAL( accelerationBatch->getNumberOfAccelerationModels( ), numberOfBodies );
+
+    // Update models at a number of times, with varying positions
+    for( int timeIndex = 0; timeIndex < 3; timeIndex++ )
+    {
+        positions = 2.0E6 * Eigen::Matrix3Xd::Random( 3, numberOfBodies );
+        for( int i = 0; i < numberOfBodies; i++ )
+        {
+            positions.col( i ) += ( planetaryRadius + 7.0E5 ) * positions.col( i ).normalized( );
+        }
+
+        for( int i = 0; i < numberOfBodies; i++ )
+        {
+            batchModels.at( i )->updateMembers( static_cast< double >( timeIndex ) );
+            singleModels.at( i )->updateMembers( static_cast< double >( timeIndex ) );
+
+            Eigen::Vector3d batchAcceleration = batchModels.at( i )->getAcceleration( );
+            Eigen::Vector3d singleAcceleration = singleModels.at( i )->getAcceleration( );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( singleAcceleration, batchAcceleration, 1.0e-13 );
+        }
+    }
+
+    // Change positions without changing time, and reset models (as done by state derivative model before each
+    // evaluation): batch must be recomputed for the new positions.
+    positions = 2.0E6 * Eigen::Matrix3Xd::Random( 3, numberOfBodies );
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        positions.col( i ) += ( planetaryRadius + 7.0E5 ) * positions.col( i ).normalized( );
+    }
+
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        batchModels.at( i )->resetCurrentTime( );
+        singleModels.at( i )->resetCurrentTime( );
+    }
+
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        batchModels.at( i )->updateMembers( 2.0 );
+        singleModels.at( i )->updateMembers( 2.0 );
+
+        Eigen::Vector3d batchAcceleration = batchModels.at( i )->getAcceleration( );
+        Eigen::Vector3d singleAcceleration = singleModels.at( i )->getAcceleration( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( singleAcceleration, batchAcceleration, 1.0e-13 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
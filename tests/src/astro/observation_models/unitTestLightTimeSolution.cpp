@@ -233,6 +233,94 @@ BOOST_AUTO_TEST_CASE( testLightWithSpice )
                                 1E-14 );
 }
 
+//! Test light-time calculation for a list of times, with iterations started from the preceding solutions.
+BOOST_AUTO_TEST_CASE( testLightTimeForListOfTimes )
+{
+    // Define (analytical) states of spacecraft in circular orbit, and of station on surface of rotating body.
+    int numberOfStateEvaluations = 0;
+    std::function< Eigen::Vector6d( const double ) > spacecraftStateFunction =
+            [ & ]( const double time )
+    {
+        numberOfStateEvaluations++;
+        double radius = 7.0E6;
+        double meanMotion = std::sqrt( 3.986004418E14 / ( radius * radius * radius ) );
+        double angle = meanMotion * time;
+        double inclination = 1.2;
+        Eigen::Vector6d state;
+        state << radius * std::cos( angle ), radius * std::sin( angle ) * std::cos( inclination ),
+                radius * std::sin( angle ) * std::sin( inclination ),
+                -radius * meanMotion * std::sin( angle ), radius * meanMotion * std::cos( angle ) * std::cos( inclination ),
+                radius * meanMotion * std::cos( angle ) * std::sin( inclination );
+        return state;
+    };
+    std::function< Eigen::Vector6d( const double ) > stationStateFunction =
+            [ & ]( const double time )
+    {
+        numberOfStateEvaluations++;
+        double radius = 6.378E6;
+        double rotationRate = 7.292115E-5;
+        double angle = rotationRate * time;
+        double latitude = 0.6;
+        Eigen::Vector6d state;
+        state << radius * std::cos( latitude ) * std::cos( angle ), radius * std::cos( latitude ) * std::sin( angle ),
+                radius * std::sin( latitude ),
+                -radius * rotationRate * std::cos( latitude ) * std::sin( angle ),
+                radius * rotationRate * std::cos( latitude ) * std::cos( angle ), 0.0;
+        return state;
+    };
+
+    // Define observation times: two passes at 1 Hz, separated by a gap.
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 3600; i++ )
+    {
+        observationTimes.push_back( 1.0E4 + static_cast< double >( i ) );
+    }
+    for( int i = 0; i < 3600; i++ )
+    {
+        observationTimes.push_back( 3.0E4 + static_cast< double >( i ) );
+    }
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        // Create light-time calculator, spacecraft transmitter, station receiver (with correction for second case)
+        std::vector< LightTimeCorrectionFunction > lightTimeCorrections;
+        if( testCase == 1 )
+        {
+            lightTimeCorrections.push_back( &getPositionDifferenceLightTimeCorrection );
+        }
+        LightTimeCalculator< > lightTimeCalculator(
+                    spacecraftStateFunction, stationStateFunction, lightTimeCorrections );
+
+        for( unsigned int isTimeAtReception = 0; isTimeAtReception < 2; isTimeAtReception++ )
+        {
+            // Compute light times for list of times
+            std::vector< Eigen::Vector6d > receiverStates, transmitterStates;
+            numberOfStateEvaluations = 0;
+            std::vector< double > lightTimes = lightTimeCalculator.calculateLightTimesWithLinkEndsStates(
+                        receiverStates, transmitterStates, observationTimes, isTimeAtReception );
+            int numberOfListStateEvaluations = numberOfStateEvaluations;
+
+            // Compare with light times computed one by one
+            BOOST_CHECK_EQUAL( lightTimes.size( ), observationTimes.size( ) );
+            BOOST_CHECK_EQUAL( receiverStates.size( ), observationTimes.size( ) );
+            BOOST_CHECK_EQUAL( transmitterStates.size( ), observationTimes.size( ) );
+            numberOfStateEvaluations = 0;
+            Eigen::Vector6d receiverState, transmitterState;
+            for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+            {
+                double lightTime = lightTimeCalculator.calculateLightTimeWithLinkEndsStates(
+                            receiverState, transmitterState, observationTimes.at( i ), isTimeAtReception );
+                BOOST_CHECK_SMALL( std::fabs( lightTimes.at( i ) - lightTime ), 1.0E-15 );
+                BOOST_CHECK_SMALL( ( receiverStates.at( i ) - receiverState ).segment( 0, 3 ).norm( ), 1.0E-6 );
+                BOOST_CHECK_SMALL( ( transmitterStates.at( i ) - transmitterState ).segment( 0, 3 ).norm( ), 1.0E-6 );
+            }
+
+            // Check that the number of (spacecraft and station) state function evaluations is reduced
+            BOOST_CHECK( numberOfListStateEvaluations < 0.85 * numberOfStateEvaluations );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
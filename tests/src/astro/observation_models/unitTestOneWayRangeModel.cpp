@@ -250,6 +250,43 @@ BOOST_AUTO_TEST_CASE( testOneWayRangeModel )
         BOOST_CHECK_SMALL( observationDifferences.at( 5 ) - observationBiases.at( 3 )( 0 ), 1.0E-4 );
     }
 
+    // Check that observations computed for a list of times (with warm-started light-time solution) are consistent with
+    // those computed one at a time, for a 1 Hz pass followed by a separate pass
+    std::vector< double > passTimes;
+    for( unsigned int i = 0; i < 600; i++ )
+    {
+        passTimes.push_back( receiverObservationTime + static_cast< double >( i ) );
+    }
+    passTimes.push_back( receiverObservationTime + 86400.0 );
+    for( unsigned int linkEndTest = 0; linkEndTest < 2; linkEndTest++ )
+    {
+        LinkEndType linkEndForTime = ( linkEndTest == 0 ) ? receiver : transmitter;
+
+        std::vector< Eigen::Matrix< double, 1, 1 > > passObservations;
+        std::vector< std::vector< double > > passLinkEndTimes;
+        std::vector< std::vector< Eigen::Vector6d > > passLinkEndStates;
+        observationModel->computeObservationsWithLinkEndDataForTimes(
+                    passTimes, linkEndForTime, passObservations, passLinkEndTimes, passLinkEndStates );
+        BOOST_CHECK_EQUAL( passObservations.size( ), passTimes.size( ) );
+
+        for( unsigned int i = 0; i < passTimes.size( ); i++ )
+        {
+            double singleObservation = observationModel->computeObservationsWithLinkEndData(
+                        passTimes.at( i ), linkEndForTime, linkEndTimes, linkEndStates )( 0 );
+
+            // Light times converge to 1.0E-12 s
+            BOOST_CHECK_SMALL( passObservations.at( i )( 0 ) - singleObservation,
+                               1.0E-12 * physical_constants::SPEED_OF_LIGHT );
+            BOOST_CHECK_EQUAL( passLinkEndTimes.at( i ).size( ), 2 );
+            BOOST_CHECK_EQUAL( passLinkEndStates.at( i ).size( ), 2 );
+            for( unsigned int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_SMALL( passLinkEndTimes.at( i ).at( j ) - linkEndTimes.at( j ), 1.0E-11 );
+            }
+            BOOST_CHECK_EQUAL( passLinkEndTimes.at( i ).at( linkEndTest == 0 ? 1 : 0 ), passTimes.at( i ) );
+        }
+    }
+
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
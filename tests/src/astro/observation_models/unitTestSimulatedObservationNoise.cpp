@@ -396,6 +396,54 @@ BOOST_AUTO_TEST_CASE( testObservationNoiseModels )
                 }
             }
         }
+
+    // Test parallel simulation of noisy observations, which should be identical to serial simulation
+    {
+        addViabilityToObservationSimulationSettings(
+                    measurementSimulationInput, std::vector< std::shared_ptr< ObservationViabilitySettings > >(
+                        { elevationAngleViabilitySettings( std::make_pair< std::string, std::string >( "Earth", "" ),
+                                                           15.0 * mathematical_constants::PI / 180.0 ) } ) );
+
+        // Define function to (re)set identically seeded noise for all observables
+        std::function< void( ) > resetNoiseFunctions = [ & ]( )
+        {
+            clearNoiseFunctionFromObservationSimulationSettings( measurementSimulationInput );
+            std::function< double( const double ) > noiseFunction =
+                    std::bind( &utilities::evaluateFunctionWithoutInputArgumentDependency< double, const double >,
+                               createBoostContinuousRandomVariableGeneratorFunction(
+                                   normal_boost_distribution, { 0.0, 1.0E-3 }, 1.0 ), std::placeholders::_1 );
+            addNoiseFunctionToObservationSimulationSettings( measurementSimulationInput, noiseFunction );
+        };
+
+        resetNoiseFunctions( );
+        std::shared_ptr< ObservationCollection< > > serialObservationsAndTimes = simulateObservations< double, double >(
+                    measurementSimulationInput, observationSimulators, bodies );
+
+        for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+        {
+            resetNoiseFunctions( );
+            std::shared_ptr< ObservationCollection< > > parallelObservationsAndTimes =
+                    simulateObservationsInParallel< double, double >(
+                        measurementSimulationInput, observationSettingsList, bodies, numberOfThreads, 1500 );
+
+            // Check that viability settings have been applied, and that all observations and times are identical
+            Eigen::VectorXd serialObservations = serialObservationsAndTimes->getObservationVector( );
+            Eigen::VectorXd parallelObservations = parallelObservationsAndTimes->getObservationVector( );
+            BOOST_CHECK( serialObservations.rows( ) > 0 );
+            BOOST_CHECK( serialObservations.rows( ) < idealObservationsAndTimes->getObservationVector( ).rows( ) );
+            BOOST_CHECK_EQUAL( parallelObservations.rows( ), serialObservations.rows( ) );
+            if( parallelObservations.rows( ) == serialObservations.rows( ) )
+            {
+                BOOST_CHECK( ( parallelObservations - serialObservations ).cwiseAbs( ).maxCoeff( ) == 0.0 );
+            }
+
+            std::vector< double > serialTimes = serialObservationsAndTimes->getConcatenatedTimeVector( );
+            std::vector< double > parallelTimes = parallelObservationsAndTimes->getConcatenatedTimeVector( );
+            BOOST_CHECK( serialTimes == parallelTimes );
+            BOOST_CHECK( serialObservationsAndTimes->getConcatenatedLinkEndIds( ) ==
+                         parallelObservationsAndTimes->getConcatenatedLinkEndIds( ) );
+        }
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
@@ -345,6 +345,107 @@ BOOST_AUTO_TEST_CASE( testPolyhedronAccelerationPartialWithSynchronousRotation )
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtEarthVelocity, partialWrtEarthVelocity, 1.0E-4 );
 }
 
+//! Unit test to check partials of polyhedron acceleration with far-field spherical harmonic expansion
+BOOST_AUTO_TEST_CASE( testPolyhedronAccelerationPartialWithFarFieldExpansion )
+{
+    const double gravitationalParameter = 3.986004418e14;
+
+    // Define cuboid polyhedron dimensions
+    const double w = 6378137.0 / 2; // width
+    const double h = 6378137.0 / 3; // height
+    const double l = 6378137.0 / 4; // length
+
+    // Define cuboid
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    // Create bodies, with constant rotation of central body
+    std::shared_ptr< simulation_setup::Body > earth = std::make_shared< simulation_setup::Body >( );
+    std::shared_ptr< simulation_setup::Body > vehicle = std::make_shared< simulation_setup::Body >( );
+    simulation_setup::SystemOfBodies bodies;
+    bodies.addBody( earth, "Earth" );
+    bodies.addBody( vehicle, "Vehicle" );
+
+    earth->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                       Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) ),
+                                       0.0, 0.0, "ECLIPJ2000" , "IAU_Earth" ) );
+
+    // Create polyhedron gravity field, with expansion blended in between 5000 and 10000 km
+    std::shared_ptr< simulation_setup::PolyhedronGravityFieldSettings > earthGravityFieldSettings =
+            std::make_shared< simulation_setup::PolyhedronGravityFieldSettings >
+            ( gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, "IAU_Earth" );
+    earthGravityFieldSettings->resetFarFieldSphericalHarmonicExpansion( 10, 5000.0E3, 5000.0E3 );
+    earth->setGravityFieldModel( simulation_setup::createGravityFieldModel( earthGravityFieldSettings, "Earth", bodies ) );
+
+    double testTime = 1.0E6;
+    earth->setState( Eigen::Vector6d::Zero( ) );
+    earth->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+
+    std::function< void( Eigen::Vector6d ) > vehicleStateSetFunction =
+            std::bind( &simulation_setup::Body::setState, vehicle, std::placeholders::_1  );
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parameterSet =
+            createParametersToEstimate(
+                std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSettings > >( ), bodies );
+
+    // Test partials inside switch radius, in transition region and outside transition region
+    for( double distance : { 4500.0E3, 7500.0E3, 12000.0E3 } )
+    {
+        vehicle->setState( ( Eigen::Vector6d( ) << distance * Eigen::Vector3d( 0.6, -0.3, 0.5 ).normalized( ),
+                             1.0E3, 2.0E3, -3.0E3 ).finished( ) );
+
+        // Create acceleration model
+        std::shared_ptr< simulation_setup::AccelerationSettings > accelerationSettings =
+                std::make_shared< simulation_setup::AccelerationSettings >( basic_astrodynamics::polyhedron_gravity );
+        std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel > gravitationalAcceleration =
+                std::dynamic_pointer_cast< gravitation::PolyhedronGravitationalAccelerationModel >(
+                    createAccelerationModel( vehicle, earth, accelerationSettings, "Vehicle", "Earth" ) );
+        BOOST_CHECK_EQUAL( gravitationalAcceleration->hasFarFieldSphericalHarmonicExpansion( ), true );
+
+        // Create acceleration partial object and compute partial
+        std::shared_ptr< acceleration_partials::PolyhedronGravityPartial > accelerationPartial =
+                std::dynamic_pointer_cast< acceleration_partials::PolyhedronGravityPartial > (
+                    createAnalyticalAccelerationPartial(
+                        gravitationalAcceleration,
+                        std::make_pair( "Vehicle", vehicle ),
+                        std::make_pair( "Earth", earth ),
+                        bodies, parameterSet ) );
+        accelerationPartial->update( testTime );
+
+        Eigen::MatrixXd partialWrtVehiclePosition = Eigen::Matrix3d::Zero( );
+        accelerationPartial->wrtPositionOfAcceleratedBody( partialWrtVehiclePosition.block( 0, 0, 3, 3 ) );
+
+        // Calculate numerical partial
+        Eigen::Vector3d positionPerturbation;
+        positionPerturbation << 10.0, 10.0, 10.0;
+        Eigen::Matrix3d testPartialWrtVehiclePosition = acceleration_partials::calculateAccelerationWrtStatePartials(
+                    vehicleStateSetFunction, gravitationalAcceleration, vehicle->getState( ), positionPerturbation, 0 );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehiclePosition, partialWrtVehiclePosition, 1.0E-6 );
+    }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -104,6 +104,28 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
     BOOST_CHECK_EQUAL( executeEarthOrbiterBiasEstimation( true, false, true, true, true, false ).second, true );
 }
 
+//! Test whether estimated biases are correctly linked to the observation models of all threads when computing observations in
+//! parallel
+BOOST_AUTO_TEST_CASE( test_BiasEstimationWithParallelObservationSets )
+{
+    for( int estimateMultiArcBiases = 0; estimateMultiArcBiases < 2; estimateMultiArcBiases++ )
+    {
+        Eigen::VectorXd totalError = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, false, true, true, false, estimateMultiArcBiases, false, 4 ).first;
+
+        for ( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( totalError( j ) ), 1.0E-5 );
+            BOOST_CHECK_SMALL( std::fabs(totalError( j + 3 ) ), 1.0E-8 );
+        }
+
+        for ( unsigned int j = 6; j < totalError.rows( ); j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( totalError( j ) ), 2.0E-7 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
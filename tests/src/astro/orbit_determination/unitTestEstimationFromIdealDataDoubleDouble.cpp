@@ -16,6 +16,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "tudat/basics/testMacros.h"
 #include "tudat/simulation/estimation_setup/orbitDeterminationTestCases.h"
 
 
@@ -86,6 +87,64 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
 
 }
 
+//! Test estimation with normal equations accumulated per observation set, against estimation from full design matrix
+BOOST_AUTO_TEST_CASE( test_EstimationWithAccumulatedNormalEquations )
+{
+    std::pair< std::shared_ptr< simulation_setup::EstimationOutput< double > >,
+    std::shared_ptr< simulation_setup::EstimationInput< double, double > > > designMatrixPodData;
+    Eigen::VectorXd designMatrixEstimationError = tudat::unit_tests::executeEarthOrbiterParameterEstimation< double, double >(
+                designMatrixPodData );
+
+    std::pair< std::shared_ptr< simulation_setup::EstimationOutput< double > >,
+    std::shared_ptr< simulation_setup::EstimationInput< double, double > > > normalEquationsPodData;
+    Eigen::VectorXd normalEquationsEstimationError = tudat::unit_tests::executeEarthOrbiterParameterEstimation< double, double >(
+                normalEquationsPodData, 1.0E7, 3, 5, true, true );
+
+    // Check that design matrix is not stored, and that estimation results are consistent
+    BOOST_CHECK_EQUAL( normalEquationsPodData.first->getNormalizedDesignMatrix( ).rows( ), 0 );
+    BOOST_CHECK_EQUAL( normalEquationsPodData.first->residuals_.rows( ), designMatrixPodData.first->residuals_.rows( ) );
+
+    Eigen::VectorXd formalErrors = designMatrixPodData.first->getFormalErrorVector( );
+    for( int i = 0; i < formalErrors.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( normalEquationsEstimationError( i ) - designMatrixEstimationError( i ) ),
+                           1.0E-3 * formalErrors( i ) );
+    }
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalEquationsPodData.first->getNormalizedInverseCovarianceMatrix( ),
+                                       designMatrixPodData.first->getNormalizedInverseCovarianceMatrix( ), 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalEquationsPodData.first->getNormalizationTerms( ),
+                                       designMatrixPodData.first->getNormalizationTerms( ), 1.0E-6 );
+}
+
+BOOST_AUTO_TEST_CASE( test_EstimationWithParallelObservationSets )
+{
+    std::pair< std::shared_ptr< simulation_setup::EstimationOutput< double > >,
+    std::shared_ptr< simulation_setup::EstimationInput< double, double > > > serialPodData;
+    Eigen::VectorXd serialEstimationError = tudat::unit_tests::executeEarthOrbiterParameterEstimation< double, double >(
+                serialPodData );
+
+    std::pair< std::shared_ptr< simulation_setup::EstimationOutput< double > >,
+    std::shared_ptr< simulation_setup::EstimationInput< double, double > > > parallelPodData;
+    Eigen::VectorXd parallelEstimationError = tudat::unit_tests::executeEarthOrbiterParameterEstimation< double, double >(
+                parallelPodData, 1.0E7, 3, 5, true, false, 4 );
+
+    // Check that results of parallel computation are consistent with those of serial computation (differences are due to the
+    // light-time solution of the first observation of each segment not being warm-started)
+    BOOST_CHECK_EQUAL( parallelPodData.second->getNumberOfObservationSetThreads( ), 4 );
+    BOOST_CHECK_EQUAL( parallelPodData.first->getNormalizedDesignMatrix( ).rows( ),
+                       serialPodData.first->getNormalizedDesignMatrix( ).rows( ) );
+    BOOST_CHECK_SMALL( ( parallelPodData.first->getNormalizedDesignMatrix( ) -
+                         serialPodData.first->getNormalizedDesignMatrix( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-8 );
+    BOOST_CHECK_SMALL( ( parallelPodData.first->residuals_ - serialPodData.first->residuals_ ).cwiseAbs( ).maxCoeff( ), 1.0E-6 );
+
+    Eigen::VectorXd formalErrors = serialPodData.first->getFormalErrorVector( );
+    for( int i = 0; i < serialEstimationError.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( parallelEstimationError( i ) - serialEstimationError( i ) ), 1.0E-3 * formalErrors( i ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
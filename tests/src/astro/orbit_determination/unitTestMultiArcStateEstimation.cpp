@@ -52,7 +52,10 @@ using namespace tudat::basic_astrodynamics;
 
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeParameterEstimation(
-        const int linkArcs )
+        const int linkArcs,
+        const bool reduceArcWiseParameters = false,
+        const bool accumulateNormalEquations = false,
+        const unsigned int maximumNumberOfIterations = 5 )
 {
     //Load spice kernels.f
     std::string kernelsPath = paths::getSpiceKernelPath( );
@@ -263,9 +266,14 @@ Eigen::VectorXd  executeParameterEstimation(
     std::shared_ptr< EstimationInput< ObservationScalarType, TimeType > > estimationInput =
             std::make_shared< EstimationInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes );
+    estimationInput->defineNormalEquationsSettings(
+                accumulateNormalEquations || reduceArcWiseParameters, false, reduceArcWiseParameters );
+    estimationInput->setConvergenceChecker( estimationConvergenceChecker( maximumNumberOfIterations ) );
     std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > covarianceInput =
             std::make_shared< CovarianceAnalysisInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes );
+    covarianceInput->defineNormalEquationsSettings(
+                accumulateNormalEquations || reduceArcWiseParameters, false, reduceArcWiseParameters );
 
     std::shared_ptr< EstimationOutput< StateScalarType, TimeType > > estimationOutput = orbitDeterminationManager.estimateParameters(
                 estimationInput );
@@ -326,6 +334,34 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
 
 }
 
+BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimationWithReducedArcWiseParameters )
+{
+    // Execute test for separate arcs, with and without Schur complement reduction of arc-wise parameters, both from
+    // accumulated normal equations. A single iteration is performed, so that both solutions are computed from identical
+    // residuals and partials, and differ only by the numerical error in the solution of the normal equations (in further
+    // iterations, this difference would be amplified by the numerical error of the double precision propagation).
+    Eigen::VectorXd parameterError = executeParameterEstimation< double, double, double >( 0, false, true, 1 );
+    Eigen::VectorXd reducedParameterError = executeParameterEstimation< double, double, double >( 0, true, true, 1 );
+    int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
+
+    BOOST_CHECK_EQUAL( reducedParameterError.rows( ), parameterError.rows( ) );
+    for( int i = 0; i < numberOfEstimatedArcs; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( reducedParameterError( i * 6 + j ) - parameterError( i * 6 + j ) ), 1E-4 );
+            BOOST_CHECK_SMALL( std::fabs( reducedParameterError( i * 6 + j + 3 ) - parameterError( i * 6 + j + 3 ) ), 1.0E-10 );
+        }
+    }
+
+    BOOST_CHECK_SMALL( std::fabs( reducedParameterError( parameterError.rows( ) - 3 ) -
+                                  parameterError( parameterError.rows( ) - 3 ) ), 1.0E-20 );
+    BOOST_CHECK_SMALL( std::fabs( reducedParameterError( parameterError.rows( ) - 2 ) -
+                                  parameterError( parameterError.rows( ) - 2 ) ), 1.0E-12 );
+    BOOST_CHECK_SMALL( std::fabs( reducedParameterError( parameterError.rows( ) - 1 ) -
+                                  parameterError( parameterError.rows( ) - 1 ) ), 1.0E-12 );
+}
+
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeMultiBodyMultiArcParameterEstimation( )
 {
@@ -35,6 +35,8 @@
 #include <limits>
 #include <string>
 #include "tudat/astro/basic_astro/celestialBodyConstants.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 
 #include <Eigen/Core>
 
@@ -1865,6 +1867,101 @@ std::pair< int, double > getClosestSatelliteDistance(
 
 //}
 
+//! Test if dependent variables evaluated by the compiled list evaluator (writing directly into a single vector, with
+//! shared intermediates) are equal to those computed by the generic per-variable functions.
+BOOST_AUTO_TEST_CASE( testDependentVariableListEvaluator )
+{
+    // Create environment with rotating point-mass Earth and vehicle
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                      0.2, 1.1, 0.4, 7.2921150E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.processBodyFrameDefinitions( );
+
+    // Create propagator settings
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettingsMap, bodiesToPropagate, centralBodies );
+
+    Eigen::Vector6d keplerianState;
+    keplerianState << 7.0E6, 0.05, 0.8, 0.3, 1.2, 0.4;
+    Eigen::VectorXd initialState = convertKeplerianToCartesianElements(
+                keplerianState, bodies.at( "Earth" )->getGravitationalParameter( ) );
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables =
+    {
+        relativePositionDependentVariable( "Vehicle", "Earth" ),
+        totalAccelerationNormDependentVariable( "Vehicle" ),
+        relativeVelocityDependentVariable( "Vehicle", "Earth" ),
+        totalAccelerationDependentVariable( "Vehicle" ),
+        singleAccelerationDependentVariable( point_mass_gravity, "Vehicle", "Earth" ),
+        singleAccelerationNormDependentVariable( point_mass_gravity, "Vehicle", "Earth" ),
+        centralBodyFixedCartesianPositionVariable( "Vehicle", "Earth" ),
+        relativeDistanceDependentVariable( "Vehicle", "Earth" ),
+        centralBodyFixedSphericalPositionVariable( "Vehicle", "Earth" ),
+        keplerianStateDependentVariable( "Vehicle", "Earth" ),
+        relativePositionDependentVariable( "Vehicle", "SSB" )
+    };
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, 0.0,
+                std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 ),
+                propagationTimeTerminationSettings( 1000.0 ), cowell, dependentVariables );
+    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+
+    std::unordered_map< IntegratedStateType, std::vector< std::shared_ptr< SingleStateTypeDerivative< double, double > > > >
+            stateDerivativeModels = dynamicsSimulator.getDynamicsStateDerivative( )->getStateDerivativeModels( );
+    std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > dependentVariableList =
+            createDependentVariableListFunction< double, double >( dependentVariables, bodies, stateDerivativeModels );
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Update environment to new state, to check that shared intermediates are recomputed
+        double currentTime = 100.0 * static_cast< double >( test );
+        dynamicsSimulator.getDynamicsStateDerivative( )->computeStateDerivative(
+                    currentTime, initialState * ( 1.0 + 0.1 * static_cast< double >( test ) ) );
+        bodies.at( "Earth" )->setCurrentRotationToLocalFrameFromEphemeris( currentTime );
+
+        // Compare compiled evaluation against generic functions for each dependent variable
+        Eigen::VectorXd dependentVariableValues = dependentVariableList.first( );
+        BOOST_CHECK_EQUAL( dependentVariableValues.rows( ), 30 );
+        BOOST_CHECK_EQUAL( dependentVariableList.second.size( ), dependentVariables.size( ) );
+
+        int currentIndex = 0;
+        for( unsigned int i = 0; i < dependentVariables.size( ); i++ )
+        {
+            Eigen::VectorXd expectedValue;
+            if( isScalarDependentVariable( dependentVariables.at( i ) ) )
+            {
+                expectedValue = ( Eigen::VectorXd( 1 ) << getDoubleDependentVariableFunction(
+                                      dependentVariables.at( i ), bodies, stateDerivativeModels )( ) ).finished( );
+            }
+            else
+            {
+                expectedValue = getVectorDependentVariableFunction(
+                            dependentVariables.at( i ), bodies, stateDerivativeModels ).first( );
+            }
+
+            BOOST_CHECK_EQUAL( dependentVariableList.second.count( { currentIndex, static_cast< int >( expectedValue.rows( ) ) } ), 1 );
+            for( int j = 0; j < expectedValue.rows( ); j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( dependentVariableValues( currentIndex + j ) - expectedValue( j ) ),
+                                   10.0 * std::fabs( expectedValue( j ) ) * std::numeric_limits< double >::epsilon( ) );
+            }
+            currentIndex += expectedValue.rows( );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -21,6 +21,9 @@
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
 #include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
@@ -622,6 +625,88 @@ BOOST_AUTO_TEST_CASE( test_NonConservativeForceEnvironmentUpdate )
     }
 }
 
+//! Test if environment models are only recomputed by the update graph when their inputs change.
+BOOST_AUTO_TEST_CASE( test_IncrementalEnvironmentUpdate )
+{
+    // Create bodies with time-dependent translational and rotational state, and a propagated vehicle.
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                      0.2, 1.1, 0.4, 7.2921150E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+    bodies.createEmptyBody( "Moon", false );
+    Eigen::Vector6d moonKeplerElements;
+    moonKeplerElements << 3.844E8, 0.05, 0.1, 0.2, 0.3, 0.4;
+    bodies.at( "Moon" )->setEphemeris( std::make_shared< ephemerides::KeplerEphemeris >(
+                                           moonKeplerElements, 0.0, 3.986004418E14, "SSB", "ECLIPJ2000" ) );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.processBodyFrameDefinitions( );
+
+    std::map< EnvironmentModelsToUpdate, std::vector< std::string > > updateSettings;
+    updateSettings[ body_translational_state_update ] = { "Moon", "Vehicle" };
+    updateSettings[ body_rotational_state_update ] = { "Earth" };
+    std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > > integratedStates;
+    integratedStates[ translational_state ].push_back( std::make_tuple( "Vehicle", "", cowell ) );
+    std::shared_ptr< EnvironmentUpdater< double, double > > updater =
+            std::make_shared< EnvironmentUpdater< double, double > >( bodies, updateSettings, integratedStates );
+
+    // Check graph (propagated vehicle is not updated from ephemeris)
+    const std::vector< EnvironmentUpdateNode >& updateGraph = updater->getUpdateGraph( );
+    BOOST_CHECK_EQUAL( updateGraph.size( ), 2 );
+    for( unsigned int i = 0; i < updateGraph.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( updateGraph.at( i ).getDependsOnTime( ), true );
+        BOOST_CHECK_EQUAL( updateGraph.at( i ).getDependsOnPropagatedState( ), false );
+        BOOST_CHECK_EQUAL( updateGraph.at( i ).getDependencies( ).size( ), 0 );
+    }
+
+    std::unordered_map< IntegratedStateType, Eigen::VectorXd > integratedStateToSet;
+    integratedStateToSet[ translational_state ] = ( Eigen::VectorXd( 6 ) << 7.0E6, 0.0, 0.0, 0.0, 7.5E3, 0.0 ).finished( );
+
+    double testTime = 3600.0;
+    for( unsigned int test = 0; test < 5; test++ )
+    {
+        // Update environment: repeated time and state (test 1), new time (test 2), repeated time after reset (test 3)
+        // and repeated time without incremental updates (test 4)
+        if( test == 1 )
+        {
+            integratedStateToSet[ translational_state ] *= 1.1;
+        }
+        else if( test == 2 )
+        {
+            testTime *= 2.0;
+        }
+        else if( test == 3 )
+        {
+            updater->resetIncrementalUpdates( );
+        }
+        else if( test == 4 )
+        {
+            updater->setUseIncrementalUpdates( false );
+        }
+        updater->updateEnvironment( testTime, integratedStateToSet );
+
+        // Check number of (skipped) updates
+        for( unsigned int i = 0; i < updateGraph.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( updateGraph.at( i ).getNumberOfUpdates( ), ( test == 0 ) ? 1 : test );
+            BOOST_CHECK_EQUAL( updateGraph.at( i ).getNumberOfSkippedUpdates( ), ( test == 0 ) ? 0 : 1 );
+        }
+
+        // Check that environment is consistent with current time and state
+        BOOST_CHECK( bodies.at( "Vehicle" )->getState( ) == integratedStateToSet.at( translational_state ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    bodies.at( "Moon" )->getState( ),
+                    bodies.at( "Moon" )->getEphemeris( )->getCartesianState( testTime ),
+                    std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    bodies.at( "Earth" )->getCurrentRotationToLocalFrame( ).toRotationMatrix( ),
+                    bodies.at( "Earth" )->getRotationalEphemeris( )->getRotationToTargetFrame( testTime ).toRotationMatrix( ),
+                    std::numeric_limits< double >::epsilon( ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -339,6 +339,144 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
     }
 }
 
+//! Test exact termination on a dependent variable, with the final condition located on the dense output of the integrator.
+//! The termination time/state is compared to that obtained by the default root finding using repeated integrator steps,
+//! and the number of state derivative evaluations is checked to be lower. For an RK4 integrator (no dense output
+//! available), the propagation must fall back to the repeated integrator steps.
+BOOST_AUTO_TEST_CASE( testExactTerminationOnDenseOutput )
+{
+    using namespace tudat;
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace orbital_element_conversions;
+
+    // Load Spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    for( unsigned int integratorCase = 0; integratorCase < 2; integratorCase++ )
+    {
+        for( unsigned int direction = 0; direction < 2; direction++ )
+        {
+            double simulationStartEpoch = ( direction == 0 ) ? 0.0 : 0.2 * physical_constants::JULIAN_DAY;
+            double directionMultiplier = ( direction == 0 ) ? 1.0 : -1.0;
+
+            std::map< unsigned int, Eigen::VectorXd > finalStates;
+            std::map< unsigned int, double > finalDistances;
+            std::vector< double > finalTimes;
+            std::vector< unsigned int > numberOfFunctionEvaluations;
+            for( unsigned int useDenseOutput = 0; useDenseOutput < 2; useDenseOutput++ )
+            {
+                // Create bodies
+                std::vector< std::string > bodiesToCreate = { "Sun", "Earth", "Moon" };
+                BodyListSettings bodySettings = getDefaultBodySettings(
+                            bodiesToCreate, -300.0, 0.2 * physical_constants::JULIAN_DAY + 300.0 );
+                SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+                bodies.createEmptyBody( "Vehicle" );
+                bodies.at( "Vehicle" )->setConstantBodyMass( 400.0 );
+
+                // Create acceleration models
+                SelectedAccelerationMap accelerationMap;
+                accelerationMap[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+                accelerationMap[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+                accelerationMap[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+                std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+                std::vector< std::string > centralBodies = { "Earth" };
+                basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                            bodies, accelerationMap, bodiesToPropagate, centralBodies );
+
+                // Set initial state
+                Eigen::Vector6d vehicleInitialStateInKeplerianElements;
+                vehicleInitialStateInKeplerianElements( semiMajorAxisIndex ) = 8000.0E3;
+                vehicleInitialStateInKeplerianElements( eccentricityIndex ) = 0.1;
+                vehicleInitialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 85.3 );
+                vehicleInitialStateInKeplerianElements( argumentOfPeriapsisIndex )
+                        = unit_conversions::convertDegreesToRadians( 235.7 );
+                vehicleInitialStateInKeplerianElements( longitudeOfAscendingNodeIndex )
+                        = unit_conversions::convertDegreesToRadians( 23.4 );
+                vehicleInitialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 139.87 );
+                const Eigen::Vector6d vehicleInitialState = convertKeplerianToCartesianElements(
+                            vehicleInitialStateInKeplerianElements,
+                            bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+                // Terminate exactly on distance to Earth
+                std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+                dependentVariables.push_back( relativeDistanceDependentVariable( "Vehicle", "Earth" ) );
+                std::shared_ptr< PropagationTerminationSettings > terminationSettings =
+                        propagationDependentVariableTerminationSettings(
+                            dependentVariables.at( 0 ), 8.7E6, false, true,
+                            root_finders::bisectionRootFinderSettings( 1.0E-8, TUDAT_NAN, TUDAT_NAN, 100 ),
+                            useDenseOutput == 1, 0.01 );
+
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                        std::make_shared< TranslationalStatePropagatorSettings< double > >
+                        ( centralBodies, accelerationModelMap, bodiesToPropagate, vehicleInitialState, terminationSettings,
+                          cowell, dependentVariables );
+
+                std::shared_ptr< IntegratorSettings< > > integratorSettings;
+                if( integratorCase == 0 )
+                {
+                    integratorSettings = std::make_shared< RungeKuttaVariableStepSizeSettings< double > >
+                            ( simulationStartEpoch, directionMultiplier * 60.0,
+                              CoefficientSets::rungeKuttaFehlberg78,
+                              1.0E-3, 1.0E3, 1.0E-12, 1.0E-12 );
+                }
+                else
+                {
+                    integratorSettings = std::make_shared< IntegratorSettings< > >
+                            ( rungeKutta4, simulationStartEpoch, directionMultiplier * 10.0 );
+                }
+
+                // Propagate, and retrieve final time/state
+                SingleArcDynamicsSimulator< double > dynamicsSimulator(
+                            bodies, integratorSettings, propagatorSettings, true, false, false );
+                std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+                std::map< double, Eigen::VectorXd > dependentVariableHistory = dynamicsSimulator.getDependentVariableHistory( );
+
+                double finalTime = ( direction == 0 ) ? stateHistory.rbegin( )->first : stateHistory.begin( )->first;
+                finalTimes.push_back( finalTime );
+                finalStates[ useDenseOutput ] = stateHistory.at( finalTime );
+                finalDistances[ useDenseOutput ] = dependentVariableHistory.at( finalTime )( 0 );
+                numberOfFunctionEvaluations.push_back(
+                            dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( ) );
+
+                // Check whether dense output was used when requested, and only for integrator with dense output
+                std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > terminationCondition =
+                        std::dynamic_pointer_cast< SingleVariableLimitPropagationTerminationCondition >(
+                            dynamicsSimulator.getPropagationTerminationCondition( ) );
+                BOOST_CHECK_EQUAL( terminationCondition->getUseDenseOutputForExactTermination( ), ( useDenseOutput == 1 ) );
+                if( useDenseOutput == 1 )
+                {
+                    BOOST_CHECK_EQUAL( terminationCondition->getNumberOfDenseOutputTerminationFallbacks( ),
+                                       ( integratorCase == 0 ) ? 0 : 1 );
+                }
+                else
+                {
+                    BOOST_CHECK_EQUAL( terminationCondition->getNumberOfDenseOutputTerminationFallbacks( ), 0 );
+                }
+            }
+
+            // Check if propagation terminated exactly on final distance for both methods
+            BOOST_CHECK_SMALL( std::fabs( finalDistances.at( 0 ) - 8.7E6 ), 0.01 );
+            BOOST_CHECK_SMALL( std::fabs( finalDistances.at( 1 ) - 8.7E6 ), 0.01 );
+
+            // Check consistency of final time and state between methods
+            BOOST_CHECK_SMALL( std::fabs( finalTimes.at( 0 ) - finalTimes.at( 1 ) ), 1.0E-4 );
+            BOOST_CHECK_SMALL( ( finalStates.at( 0 ) - finalStates.at( 1 ) ).segment( 0, 3 ).norm( ), 1.0 );
+
+            // Check that dense output reduces number of function evaluations (or is identical if fallback is used)
+            if( integratorCase == 0 )
+            {
+                BOOST_CHECK_EQUAL( numberOfFunctionEvaluations.at( 1 ) < numberOfFunctionEvaluations.at( 0 ), true );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( numberOfFunctionEvaluations.at( 1 ), numberOfFunctionEvaluations.at( 0 ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
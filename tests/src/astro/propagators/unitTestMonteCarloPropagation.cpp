@@ -0,0 +1,458 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/keplerPropagator.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
+#include "tudat/interface/spice/spiceInterface.h"
+#include "tudat/math/statistics/randomSampling.h"
+#include "tudat/simulation/environment_setup/createSystemModel.h"
+#include "tudat/simulation/environment_setup/defaultBodies.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/monteCarloPropagation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_monte_carlo_propagation )
+
+//! Test if Monte Carlo propagation results are independent of the number of threads, and match individual propagations
+BOOST_AUTO_TEST_CASE( testMonteCarloPropagation )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+
+    // Create environment with point-mass Earth and vehicle
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+    bodies.processBodyFrameDefinitions( );
+
+    // Define nominal propagation settings
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    Eigen::Vector6d nominalKeplerianState;
+    nominalKeplerianState << 7.0E6, 0.05, 0.8, 0.3, 1.2, 0.4;
+    Eigen::VectorXd nominalInitialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                nominalKeplerianState, earthGravitationalParameter );
+
+    const double initialTime = 0.0;
+    const double finalTime = 8000.0;
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, basic_astrodynamics::AccelerationMap( ), bodiesToPropagate, nominalInitialState,
+                initialTime, rungeKuttaVariableStepSettingsScalarTolerances( 10.0, rungeKuttaFehlberg78, 1.0E-4,
+                                                                             1.0E4, 1.0E-12, 1.0E-12 ),
+                propagationTimeTerminationSettings( finalTime ) );
+    propagatorSettings->resetAccelerationModelsMap( accelerationSettingsMap, bodies );
+
+    // Define samples as initial state perturbations
+    const unsigned int numberOfSamples = 24;
+    const int seed = 3;
+    Eigen::VectorXd sampleMean = Eigen::VectorXd::Zero( 6 );
+    Eigen::VectorXd sampleStandardDeviation = ( Eigen::VectorXd( 6 ) << 100.0, 100.0, 100.0, 0.1, 0.1, 0.1 ).finished( );
+    std::vector< double > outputEpochs = { 1234.5, 4000.0, 7777.7, 9000.0 };
+    std::vector< double > quantileProbabilities = { 0.1, 0.5, 0.9 };
+
+    // Perform Monte Carlo propagation with different numbers of threads
+    std::vector< std::shared_ptr< MonteCarloPropagationResults< double > > > monteCarloResults;
+    std::vector< MonteCarloSampleResult< double > > sampleResults;
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        std::shared_ptr< MonteCarloPropagationSettings< double > > monteCarloSettings =
+                std::make_shared< MonteCarloPropagationSettings< double > >(
+                    numberOfSamples,
+                    statistics::createGaussianRandomSampleFunction( seed, sampleMean, sampleStandardDeviation ),
+                    createInitialStatePerturbationFunction< double, double >( nominalInitialState ),
+                    outputEpochs, quantileProbabilities, numberOfThreads );
+        if( numberOfThreads == 1 )
+        {
+            monteCarloSettings->setSampleResultFunction(
+                        [ & ]( const MonteCarloSampleResult< double >& sampleResult )
+            {
+                sampleResults.push_back( sampleResult );
+            } );
+        }
+        monteCarloResults.push_back( performMonteCarloPropagation< double, double >(
+                                         bodies, propagatorSettings, monteCarloSettings ) );
+    }
+
+    // Check that results are identical for different numbers of threads
+    for( unsigned int i = 0; i < monteCarloResults.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( monteCarloResults.at( i )->getNumberOfSamples( ), numberOfSamples );
+        BOOST_CHECK_EQUAL( monteCarloResults.at( i )->getTerminationReasonCounts( ).size( ), 1 );
+        BOOST_CHECK_EQUAL( monteCarloResults.at( i )->getTerminationReasonCounts( ).at( termination_condition_reached ),
+                           numberOfSamples );
+        BOOST_CHECK_EQUAL( monteCarloResults.at( i )->getEpochStateStatistics( 3 ).getNumberOfSamples( ), 0 );
+    }
+
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_EQUAL( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getNumberOfSamples( ), numberOfSamples );
+        BOOST_CHECK( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getMean( ) ==
+                     monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getMean( ) );
+        BOOST_CHECK( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getCovariance( ) ==
+                     monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getCovariance( ) );
+        BOOST_CHECK( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getQuantiles( ) ==
+                     monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getQuantiles( ) );
+    }
+    BOOST_CHECK( monteCarloResults.at( 0 )->getFinalStateStatistics( ).getMean( ) ==
+                 monteCarloResults.at( 1 )->getFinalStateStatistics( ).getMean( ) );
+
+    // Check per-sample results against individual propagations, and interpolated states against analytical solution
+    std::vector< Eigen::VectorXd > samples = statistics::generateGaussianRandomSample(
+                seed, numberOfSamples, sampleMean, sampleStandardDeviation );
+    BOOST_CHECK_EQUAL( sampleResults.size( ), numberOfSamples );
+    statistics::RunningMeanAndCovariance finalStateStatistics( 6 );
+    for( unsigned int i = 0; i < numberOfSamples; i++ )
+    {
+        BOOST_CHECK_EQUAL( sampleResults.at( i ).sampleIndex, i );
+        BOOST_CHECK( sampleResults.at( i ).sample == samples.at( i ) );
+        BOOST_CHECK_EQUAL( sampleResults.at( i ).finalTime, finalTime );
+
+        Eigen::VectorXd perturbedInitialState = nominalInitialState + samples.at( i );
+        if( i % 6 == 0 )
+        {
+            propagatorSettings->resetInitialStates( perturbedInitialState );
+            SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+            Eigen::VectorXd directFinalState =
+                    dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).rbegin( )->second;
+            for( unsigned int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( sampleResults.at( i ).finalState( k ), directFinalState( k ) );
+            }
+        }
+
+        Eigen::Vector6d perturbedInitialKeplerianState = orbital_element_conversions::convertCartesianToKeplerianElements(
+                    Eigen::Vector6d( perturbedInitialState ), earthGravitationalParameter );
+        for( unsigned int j = 0; j < outputEpochs.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( sampleResults.at( i ).isEpochStateAvailable.at( j ), ( j < 3 ) );
+            if( j < 3 )
+            {
+                Eigen::Vector6d analyticalState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                            orbital_element_conversions::propagateKeplerOrbit(
+                                perturbedInitialKeplerianState, outputEpochs.at( j ) - initialTime,
+                                earthGravitationalParameter ), earthGravitationalParameter );
+                for( unsigned int k = 0; k < 3; k++ )
+                {
+                    BOOST_CHECK_SMALL( sampleResults.at( i ).epochStates.at( j )( k ) - analyticalState( k ), 1.0E-3 );
+                    BOOST_CHECK_SMALL( sampleResults.at( i ).epochStates.at( j )( k + 3 ) - analyticalState( k + 3 ), 1.0E-6 );
+                }
+            }
+        }
+        finalStateStatistics.addSample( sampleResults.at( i ).finalState );
+    }
+
+    for( unsigned int k = 0; k < 6; k++ )
+    {
+        BOOST_CHECK_EQUAL( monteCarloResults.at( 0 )->getFinalStateStatistics( ).getMean( )( k ),
+                           finalStateStatistics.getMean( )( k ) );
+        BOOST_CHECK_EQUAL( monteCarloResults.at( 0 )->getFinalStateStatistics( ).getCovariance( )( k, k ),
+                           finalStateStatistics.getCovariance( )( k, k ) );
+    }
+    BOOST_CHECK_EQUAL( monteCarloResults.at( 0 )->getFinalTimeStatistics( ).getMean( )( 0 ), finalTime );
+
+    // Check that nominal bodies have not been modified by Monte Carlo propagation
+    BOOST_CHECK_EQUAL( bodies.at( "Vehicle" )->getBodyMass( ), 500.0 );
+}
+
+//! Test if Monte Carlo propagation results are independent of the number of threads when the environment contains a
+//! tabulated ephemeris, the interpolator of which is shared by the cloned bodies of all threads
+BOOST_AUTO_TEST_CASE( testMonteCarloPropagationWithTabulatedEphemeris )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+    const double moonGravitationalParameter = 4.9028E12;
+
+    // Create tabulated (Keplerian) ephemeris of Moon w.r.t. Earth
+    Eigen::Vector6d moonKeplerianState;
+    moonKeplerianState << 3.844E8, 0.055, 0.09, 0.2, 2.1, 1.0;
+    std::map< double, Eigen::Vector6d > moonStateMap;
+    for( double time = -1.0E4; time <= 2.0E4; time += 600.0 )
+    {
+        moonStateMap[ time ] = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    orbital_element_conversions::propagateKeplerOrbit(
+                        moonKeplerianState, time, earthGravitationalParameter + moonGravitationalParameter ),
+                    earthGravitationalParameter + moonGravitationalParameter );
+    }
+
+    // Create environment with point-mass Earth and Moon, and vehicle
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+    bodies.createEmptyBody( "Moon", false );
+    bodies.at( "Moon" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                           std::make_shared< interpolators::LagrangeInterpolator<
+                                           double, Eigen::Vector6d > >( moonStateMap, 8 ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Moon" )->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( moonGravitationalParameter ) );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+    bodies.processBodyFrameDefinitions( );
+
+    // Define nominal propagation settings
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    accelerationSettingsMap[ "Vehicle" ][ "Moon" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    Eigen::Vector6d nominalKeplerianState;
+    nominalKeplerianState << 2.0E7, 0.3, 0.8, 0.3, 1.2, 0.4;
+    Eigen::VectorXd nominalInitialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                nominalKeplerianState, earthGravitationalParameter );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, basic_astrodynamics::AccelerationMap( ), bodiesToPropagate, nominalInitialState,
+                0.0, rungeKuttaVariableStepSettingsScalarTolerances( 10.0, rungeKuttaFehlberg78, 1.0E-4,
+                                                                     1.0E4, 1.0E-12, 1.0E-12 ),
+                propagationTimeTerminationSettings( 1.5E4 ) );
+    propagatorSettings->resetAccelerationModelsMap( accelerationSettingsMap, bodies );
+
+    // Perform Monte Carlo propagation with different numbers of threads
+    const unsigned int numberOfSamples = 32;
+    Eigen::VectorXd sampleStandardDeviation = ( Eigen::VectorXd( 6 ) << 100.0, 100.0, 100.0, 0.1, 0.1, 0.1 ).finished( );
+    std::vector< double > outputEpochs = { 3000.0, 12000.0 };
+    std::vector< std::shared_ptr< MonteCarloPropagationResults< double > > > monteCarloResults;
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        std::shared_ptr< MonteCarloPropagationSettings< double > > monteCarloSettings =
+                std::make_shared< MonteCarloPropagationSettings< double > >(
+                    numberOfSamples,
+                    statistics::createGaussianRandomSampleFunction(
+                        7, Eigen::VectorXd::Zero( 6 ), sampleStandardDeviation ),
+                    createInitialStatePerturbationFunction< double, double >( nominalInitialState ),
+                    outputEpochs, std::vector< double >( { 0.5 } ), numberOfThreads );
+        monteCarloResults.push_back( performMonteCarloPropagation< double, double >(
+                                         bodies, propagatorSettings, monteCarloSettings ) );
+    }
+
+    // Check that results are identical for different numbers of threads
+    for( unsigned int j = 0; j < outputEpochs.size( ); j++ )
+    {
+        BOOST_CHECK_EQUAL( monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getNumberOfSamples( ), numberOfSamples );
+        BOOST_CHECK( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getMean( ) ==
+                     monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getMean( ) );
+        BOOST_CHECK( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getCovariance( ) ==
+                     monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getCovariance( ) );
+    }
+    BOOST_CHECK( monteCarloResults.at( 0 )->getFinalStateStatistics( ).getMean( ) ==
+                 monteCarloResults.at( 1 )->getFinalStateStatistics( ).getMean( ) );
+}
+
+
+//! Test if Monte Carlo propagation with aerodynamic, thrust and radiation pressure accelerations, the coefficients of
+//! which are perturbed per sample, is independent of the number of threads, and matches individual propagations
+BOOST_AUTO_TEST_CASE( testMonteCarloPropagationWithDragThrustAndRadiationPressure )
+{
+    // Load Spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    const double initialTime = 0.0;
+    const double finalTime = 3.0 * 3600.0;
+
+    // Create environment with Sun, Earth (including atmosphere) and Moon
+    std::vector< std::string > bodiesToCreate = { "Sun", "Earth", "Moon" };
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( bodiesToCreate, initialTime - 300.0, finalTime + 300.0, "SSB", "J2000" );
+    for( unsigned int i = 0; i < bodiesToCreate.size( ); i++ )
+    {
+        bodySettings.at( bodiesToCreate.at( i ) )->ephemerisSettings->resetFrameOrientation( "J2000" );
+        bodySettings.at( bodiesToCreate.at( i ) )->rotationModelSettings->resetOriginalFrame( "J2000" );
+    }
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    // Create vehicle with aerodynamic coefficients, radiation pressure interface and engine
+    const double nominalDragCoefficient = 1.2;
+    const double nominalRadiationPressureCoefficient = 1.2;
+    const double nominalThrustMagnitude = 0.1;
+    bodies.createEmptyBody( "Asterix" );
+    bodies.at( "Asterix" )->setConstantBodyMass( 400.0 );
+    bodies.at( "Asterix" )->setAerodynamicCoefficientInterface(
+                createAerodynamicCoefficientInterface(
+                    std::make_shared< ConstantAerodynamicCoefficientSettings >(
+                        4.0, nominalDragCoefficient * Eigen::Vector3d::UnitX( ), 1, 1 ), "Asterix" ) );
+    bodies.at( "Asterix" )->setRadiationPressureInterface(
+                "Sun", createRadiationPressureInterface(
+                    std::make_shared< CannonBallRadiationPressureInterfaceSettings >(
+                        "Sun", 4.0, nominalRadiationPressureCoefficient, std::vector< std::string >( { "Earth" } ) ),
+                    "Asterix", bodies ) );
+    bodies.at( "Asterix" )->setRotationalEphemeris(
+                std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                    Eigen::Quaterniond::Identity( ), 1.0E-3, 0.0, "J2000", "Asterix_Fixed" ) );
+    addEngineModel( "Asterix", "MainEngine",
+                    std::make_shared< ConstantThrustMagnitudeSettings >( nominalThrustMagnitude, 300.0 ), bodies );
+
+    // Define nominal propagation settings
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Asterix" ][ "Earth" ].push_back(
+                std::make_shared< SphericalHarmonicAccelerationSettings >( 5, 5 ) );
+    accelerationSettingsMap[ "Asterix" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::aerodynamic ) );
+    accelerationSettingsMap[ "Asterix" ][ "Sun" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    accelerationSettingsMap[ "Asterix" ][ "Sun" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::cannon_ball_radiation_pressure ) );
+    accelerationSettingsMap[ "Asterix" ][ "Moon" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    accelerationSettingsMap[ "Asterix" ][ "Asterix" ].push_back( thrustAccelerationFromAllEngines( ) );
+    std::vector< std::string > bodiesToPropagate = { "Asterix" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    const double earthGravitationalParameter =
+            bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+    Eigen::Vector6d nominalKeplerianState;
+    nominalKeplerianState << 6.83E6, 0.002, 1.5, 4.1, 0.4, 2.4;
+    Eigen::VectorXd nominalInitialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                nominalKeplerianState, earthGravitationalParameter );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, basic_astrodynamics::AccelerationMap( ), bodiesToPropagate, nominalInitialState,
+                initialTime, rungeKuttaVariableStepSettingsScalarTolerances( 10.0, rungeKuttaFehlberg78, 1.0E-3,
+                                                                             300.0, 1.0E-10, 1.0E-10 ),
+                propagationTimeTerminationSettings( finalTime ) );
+    propagatorSettings->resetAccelerationModelsMap( accelerationSettingsMap, bodies );
+
+    // Define samples as perturbations of the initial state, and relative perturbations of the drag coefficient,
+    // radiation pressure coefficient and thrust magnitude, which are applied to the bodies of the propagation
+    std::function< void( const Eigen::VectorXd&, const SystemOfBodies& ) > applyCoefficientPerturbations =
+            [ = ]( const Eigen::VectorXd& sample, const SystemOfBodies& sampleBodies )
+    {
+        std::dynamic_pointer_cast< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                    sampleBodies.at( "Asterix" )->getAerodynamicCoefficientInterface( ) )->resetConstantCoefficients(
+                    ( Eigen::Vector6d( ) << nominalDragCoefficient * ( 1.0 + sample( 6 ) ),
+                      0.0, 0.0, 0.0, 0.0, 0.0 ).finished( ) );
+        sampleBodies.at( "Asterix" )->getRadiationPressureInterfaces( ).at( "Sun" )->resetRadiationPressureCoefficient(
+                    nominalRadiationPressureCoefficient * ( 1.0 + sample( 7 ) ) );
+        std::dynamic_pointer_cast< propulsion::ConstantThrustMagnitudeWrapper >(
+                    sampleBodies.at( "Asterix" )->getVehicleSystems( )->getEngineModels( ).at( "MainEngine" )->
+                    getThrustMagnitudeWrapper( ) )->resetConstantThrustForceMagnitude(
+                    nominalThrustMagnitude * ( 1.0 + sample( 8 ) ) );
+    };
+    MonteCarloPropagationSettings< double >::SampleApplicationFunction initialStatePerturbationFunction =
+            createInitialStatePerturbationFunction< double, double >( nominalInitialState );
+    MonteCarloPropagationSettings< double >::SampleApplicationFunction sampleApplicationFunction =
+            [ = ]( const Eigen::VectorXd& sample, const SystemOfBodies& sampleBodies,
+            const std::shared_ptr< SingleArcPropagatorSettings< double, double > > sampleSettings )
+    {
+        initialStatePerturbationFunction( sample, sampleBodies, sampleSettings );
+        applyCoefficientPerturbations( sample, sampleBodies );
+    };
+
+    const unsigned int numberOfSamples = 8;
+    const int seed = 11;
+    Eigen::VectorXd sampleStandardDeviation =
+            ( Eigen::VectorXd( 9 ) << 10.0, 10.0, 10.0, 0.01, 0.01, 0.01, 0.1, 0.1, 0.1 ).finished( );
+    std::vector< double > outputEpochs = { 3600.0, 7200.0 };
+
+    // Perform Monte Carlo propagation with different numbers of threads
+    std::vector< std::shared_ptr< MonteCarloPropagationResults< double > > > monteCarloResults;
+    std::vector< MonteCarloSampleResult< double > > sampleResults;
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        std::shared_ptr< MonteCarloPropagationSettings< double > > monteCarloSettings =
+                std::make_shared< MonteCarloPropagationSettings< double > >(
+                    numberOfSamples,
+                    statistics::createGaussianRandomSampleFunction(
+                        seed, Eigen::VectorXd::Zero( 9 ), sampleStandardDeviation ),
+                    sampleApplicationFunction, outputEpochs, std::vector< double >( { 0.5 } ), numberOfThreads );
+        if( numberOfThreads == 4 )
+        {
+            monteCarloSettings->setSampleResultFunction(
+                        [ & ]( const MonteCarloSampleResult< double >& sampleResult )
+            {
+                sampleResults.push_back( sampleResult );
+            } );
+        }
+        monteCarloResults.push_back( performMonteCarloPropagation< double, double >(
+                                         bodies, propagatorSettings, monteCarloSettings ) );
+    }
+
+    // Check that results are identical for different numbers of threads
+    for( unsigned int j = 0; j < outputEpochs.size( ); j++ )
+    {
+        BOOST_CHECK_EQUAL( monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getNumberOfSamples( ), numberOfSamples );
+        BOOST_CHECK( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getMean( ) ==
+                     monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getMean( ) );
+        BOOST_CHECK( monteCarloResults.at( 0 )->getEpochStateStatistics( j ).getCovariance( ) ==
+                     monteCarloResults.at( 1 )->getEpochStateStatistics( j ).getCovariance( ) );
+    }
+    BOOST_CHECK( monteCarloResults.at( 0 )->getFinalStateStatistics( ).getMean( ) ==
+                 monteCarloResults.at( 1 )->getFinalStateStatistics( ).getMean( ) );
+
+    // Check that nominal bodies have not been modified by Monte Carlo propagation
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                           bodies.at( "Asterix" )->getAerodynamicCoefficientInterface( ) )->getConstantCoefficients( )( 0 ),
+                       nominalDragCoefficient );
+    BOOST_CHECK_EQUAL( bodies.at( "Asterix" )->getRadiationPressureInterfaces( ).at( "Sun" )->
+                       getRadiationPressureCoefficient( ), nominalRadiationPressureCoefficient );
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< propulsion::ConstantThrustMagnitudeWrapper >(
+                           bodies.at( "Asterix" )->getVehicleSystems( )->getEngineModels( ).at( "MainEngine" )->
+                           getThrustMagnitudeWrapper( ) )->getConstantThrustForceMagnitude( ), nominalThrustMagnitude );
+
+    // Check per-sample results (from multi-threaded run) against individual propagations with the nominal bodies
+    std::vector< Eigen::VectorXd > samples = statistics::generateGaussianRandomSample(
+                seed, numberOfSamples, Eigen::VectorXd::Zero( 9 ), sampleStandardDeviation );
+    BOOST_CHECK_EQUAL( sampleResults.size( ), numberOfSamples );
+    for( unsigned int i = 0; i < numberOfSamples; i += 3 )
+    {
+        BOOST_CHECK( sampleResults.at( i ).sample == samples.at( i ) );
+
+        propagatorSettings->resetInitialStates( nominalInitialState + samples.at( i ).segment( 0, 6 ) );
+        applyCoefficientPerturbations( samples.at( i ), bodies );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        Eigen::VectorXd directFinalState = dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).rbegin( )->second;
+        for( unsigned int k = 0; k < 3; k++ )
+        {
+            BOOST_CHECK_SMALL( sampleResults.at( i ).finalState( k ) - directFinalState( k ), 1.0E-6 );
+            BOOST_CHECK_SMALL( sampleResults.at( i ).finalState( k + 3 ) - directFinalState( k + 3 ), 1.0E-9 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
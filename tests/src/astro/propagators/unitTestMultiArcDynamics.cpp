@@ -256,6 +256,126 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     }
 }
 
+//! Test whether concurrent propagation of arcs gives results identical to sequential propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcDynamics )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 1.6E7;
+    double buffer = 5.0 * 3600.0;
+
+    // Define arcs
+    std::vector< double > integrationArcStarts, integrationArcEnds;
+    double arcDuration = 1.0E6;
+    double currentStartTime = initialEphemerisTime + 1.0E4;
+    while( currentStartTime + arcDuration < finalEphemerisTime )
+    {
+        integrationArcStarts.push_back( currentStartTime );
+        integrationArcEnds.push_back( currentStartTime + arcDuration );
+        currentStartTime += arcDuration - 1.0E4;
+    }
+    unsigned int numberOfIntegrationArcs = integrationArcStarts.size( );
+
+    // Create a shared environment, and a separate environment for each arc
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+    std::dynamic_pointer_cast< InterpolatedSpiceEphemerisSettings >( bodySettings.at( "Moon" )->ephemerisSettings )->
+            resetFrameOrigin( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ) );
+
+    SystemOfBodies sharedBodies = createSystemOfBodies( bodySettings );
+    std::vector< SystemOfBodies > arcWiseBodies;
+    for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+    {
+        arcWiseBodies.push_back( createSystemOfBodies( bodySettings ) );
+    }
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    std::vector< Eigen::VectorXd > systemInitialStates;
+    for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+    {
+        systemInitialStates.push_back( spice_interface::getBodyCartesianStateAtEpoch(
+                                           "Moon", "Earth", "ECLIPJ2000", "NONE", integrationArcStarts.at( i ) ) );
+    }
+
+    // Create multi-arc propagator settings, using the given environment for each arc
+    auto createMultiArcSettings = [ & ]( const std::vector< SystemOfBodies >& environments,
+            const unsigned int numberOfThreads )
+    {
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            arcPropagationSettingsList.push_back(
+                        std::make_shared< TranslationalStatePropagatorSettings< double > >
+                        ( centralBodies, createAccelerationModelsMap(
+                              environments.at( i ), accelerationMap, bodiesToIntegrate, centralBodies ),
+                          bodiesToIntegrate, systemInitialStates.at( i ), integrationArcEnds.at( i ) ) );
+        }
+
+        std::shared_ptr< MultiArcPropagatorSettings< double > > multiArcPropagatorSettings =
+                validateDeprecatedMultiArcSettings< double, double >(
+                    std::make_shared< IntegratorSettings< > >( rungeKutta4, initialEphemerisTime, 120.0 ),
+                    std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagationSettingsList ),
+                    integrationArcStarts, false, false );
+        multiArcPropagatorSettings->getOutputSettings( )->setNumberOfArcPropagationThreads( numberOfThreads );
+        return multiArcPropagatorSettings;
+    };
+
+    // Propagate sequentially in shared environment, and concurrently in shared and separate environments
+    std::vector< SystemOfBodies > sharedBodiesList( numberOfIntegrationArcs, sharedBodies );
+    MultiArcDynamicsSimulator< > serialSimulator(
+                sharedBodies, createMultiArcSettings( sharedBodiesList, 1 ) );
+    MultiArcDynamicsSimulator< > sharedEnvironmentSimulator(
+                sharedBodies, createMultiArcSettings( sharedBodiesList, 4 ) );
+    MultiArcDynamicsSimulator< > parallelSimulator(
+                arcWiseBodies, createMultiArcSettings( arcWiseBodies, 4 ) );
+
+    for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+    {
+        std::map< double, Eigen::VectorXd > serialSolution = serialSimulator.getMultiArcPropagationResults( )->
+                getSingleArcResults( ).at( i )->getEquationsOfMotionNumericalSolution( );
+        std::vector< std::map< double, Eigen::VectorXd > > comparisonSolutions =
+        { sharedEnvironmentSimulator.getMultiArcPropagationResults( )->
+          getSingleArcResults( ).at( i )->getEquationsOfMotionNumericalSolution( ),
+          parallelSimulator.getMultiArcPropagationResults( )->
+          getSingleArcResults( ).at( i )->getEquationsOfMotionNumericalSolution( ) };
+
+        BOOST_CHECK( serialSolution.size( ) > 0 );
+        for( unsigned int j = 0; j < comparisonSolutions.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( serialSolution.size( ), comparisonSolutions.at( j ).size( ) );
+            auto comparisonIterator = comparisonSolutions.at( j ).begin( );
+            for( auto serialIterator: serialSolution )
+            {
+                BOOST_CHECK_EQUAL( serialIterator.first, comparisonIterator->first );
+                BOOST_CHECK_EQUAL( ( serialIterator.second - comparisonIterator->second ).cwiseAbs( ).maxCoeff( ), 0.0 );
+                comparisonIterator++;
+            }
+        }
+    }
+
+    // Check that arcs sharing an environment are grouped, and arcs with separate environments are not
+    BOOST_CHECK_EQUAL( sharedEnvironmentSimulator.getSequentialArcGroups(
+                           std::vector< bool >( numberOfIntegrationArcs, false ) ).size( ), 1 );
+    BOOST_CHECK_EQUAL( parallelSimulator.getSequentialArcGroups(
+                           std::vector< bool >( numberOfIntegrationArcs, false ) ).size( ), numberOfIntegrationArcs );
+    std::vector< bool > initialStatesFromPreviousArc( numberOfIntegrationArcs, false );
+    initialStatesFromPreviousArc.at( 1 ) = true;
+    BOOST_CHECK_EQUAL( parallelSimulator.getSequentialArcGroups( initialStatesFromPreviousArc ).size( ),
+                       numberOfIntegrationArcs - 1 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -424,6 +424,135 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
 }
 
 
+//! Test whether concurrent propagation of variational equations, using a separate environment per arc, gives results
+//! identical to sequential propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcVariationalEquationCalculation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames = { "Earth", "Sun", "Moon" };
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 1.5E7;
+    double buffer = 10.0 * 3600.0;
+
+    // Create bodies, and a copy of the bodies for each arc
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+    bodySettings.at( "Moon" )->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    std::vector< double > arcStartTimes, arcEndTimes;
+    double arcDuration = 5.0E5;
+    double currentStartTime = initialEphemerisTime;
+    while( currentStartTime + arcDuration < finalEphemerisTime )
+    {
+        arcStartTimes.push_back( currentStartTime );
+        arcEndTimes.push_back( currentStartTime + arcDuration );
+        currentStartTime += arcDuration;
+    }
+    unsigned int numberOfArcs = arcStartTimes.size( );
+
+    std::vector< SystemOfBodies > arcWiseBodies;
+    for( unsigned int i = 0; i < numberOfArcs; i++ )
+    {
+        arcWiseBodies.push_back( cloneSystemOfBodies( bodies ) );
+    }
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    std::vector< Eigen::VectorXd > systemInitialStates;
+    for( unsigned int i = 0; i < numberOfArcs; i++ )
+    {
+        systemInitialStates.push_back( getInitialStatesOfBodies(
+                                           bodiesToIntegrate, centralBodies, bodies, arcStartTimes.at( i ) ) );
+    }
+
+    // Create multi-arc propagator settings, using the given environment for each arc
+    auto createMultiArcSettings = [ & ]( const std::vector< SystemOfBodies >& environments,
+            const unsigned int numberOfThreads )
+    {
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+        for( unsigned int i = 0; i < numberOfArcs; i++ )
+        {
+            propagatorSettingsList.push_back(
+                        std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                            centralBodies, createAccelerationModelsMap(
+                                environments.at( i ), accelerationMap, bodiesToIntegrate, centralBodies ),
+                            bodiesToIntegrate, systemInitialStates.at( i ), arcEndTimes.at( i ) ) );
+        }
+        std::shared_ptr< MultiArcPropagatorSettings< double > > multiArcPropagatorSettings =
+                validateDeprecatedMultiArcSettings< double, double >(
+                    std::make_shared< IntegratorSettings< > >( rungeKutta4, initialEphemerisTime, 1800.0 ),
+                    std::make_shared< MultiArcPropagatorSettings< double > >( propagatorSettingsList ),
+                    arcStartTimes, false, true );
+        multiArcPropagatorSettings->getOutputSettings( )->setNumberOfArcPropagationThreads( numberOfThreads );
+        return multiArcPropagatorSettings;
+    };
+
+    std::shared_ptr< MultiArcPropagatorSettings< double > > serialPropagatorSettings =
+            createMultiArcSettings( std::vector< SystemOfBodies >( numberOfArcs, bodies ), 1 );
+    std::shared_ptr< MultiArcPropagatorSettings< double > > parallelPropagatorSettings =
+            createMultiArcSettings( arcWiseBodies, 4 );
+
+    // Propagate variational equations sequentially in single environment, and concurrently in arc-wise environments
+    MultiArcVariationalEquationsSolver< > serialVariationalEquations(
+                bodies, serialPropagatorSettings, createParametersToEstimate< double >(
+                    getInitialMultiArcParameterSettings< double >( serialPropagatorSettings, bodies, arcStartTimes ),
+                    bodies ) );
+    serialVariationalEquations.integrateVariationalAndDynamicalEquations( serialPropagatorSettings->getInitialStateList( ), 1 );
+
+    MultiArcVariationalEquationsSolver< > parallelVariationalEquations(
+                bodies, arcWiseBodies, parallelPropagatorSettings, createParametersToEstimate< double >(
+                    getInitialMultiArcParameterSettings< double >( parallelPropagatorSettings, bodies, arcStartTimes ),
+                    bodies ) );
+    parallelVariationalEquations.integrateVariationalAndDynamicalEquations( parallelPropagatorSettings->getInitialStateList( ), 1 );
+
+    // Check that arcs are propagated independently
+    BOOST_CHECK_EQUAL( parallelVariationalEquations.getDynamicsSimulator( )->getSequentialArcGroups(
+                           std::vector< bool >( numberOfArcs, false ) ).size( ), numberOfArcs );
+    BOOST_CHECK_EQUAL( serialVariationalEquations.getDynamicsSimulator( )->getSequentialArcGroups(
+                           std::vector< bool >( numberOfArcs, false ) ).size( ), 1 );
+
+    // Check that results are identical
+    for( unsigned int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        std::map< double, Eigen::MatrixXd > serialStateTransitionMatrices =
+                serialVariationalEquations.getMultiArcVariationalPropagationResults( )->getSingleArcResults( ).at( arc )->
+                getStateTransitionSolution( );
+        std::map< double, Eigen::MatrixXd > parallelStateTransitionMatrices =
+                parallelVariationalEquations.getMultiArcVariationalPropagationResults( )->getSingleArcResults( ).at( arc )->
+                getStateTransitionSolution( );
+        BOOST_CHECK( serialStateTransitionMatrices.size( ) > 0 );
+        BOOST_CHECK_EQUAL( serialStateTransitionMatrices.size( ), parallelStateTransitionMatrices.size( ) );
+        for( auto matrixIterator: serialStateTransitionMatrices )
+        {
+            BOOST_CHECK_EQUAL( ( matrixIterator.second - parallelStateTransitionMatrices.at( matrixIterator.first ) ).
+                               cwiseAbs( ).maxCoeff( ), 0.0 );
+        }
+
+        double testEpoch = arcEndTimes.at( arc ) - 2.0E4;
+        BOOST_CHECK_EQUAL( ( serialVariationalEquations.getStateTransitionMatrixInterface( )->
+                             getCombinedStateTransitionAndSensitivityMatrix( testEpoch ) -
+                             parallelVariationalEquations.getStateTransitionMatrixInterface( )->
+                             getCombinedStateTransitionAndSensitivityMatrix( testEpoch ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+
+    // Check that physical parameters cannot be estimated with arc-wise environments
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+            getInitialMultiArcParameterSettings< double >( parallelPropagatorSettings, bodies, arcStartTimes );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    BOOST_CHECK_THROW( MultiArcVariationalEquationsSolver< >(
+                           bodies, arcWiseBodies, parallelPropagatorSettings,
+                           createParametersToEstimate< double >( parameterNames, bodies ) ), std::runtime_error );
+}
+
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,174 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+#include "tudat/simulation/propagation_setup/propagationOutputSink.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_output_sink )
+
+//! Function to create propagator settings for a point-mass orbit around the Earth
+std::shared_ptr< TranslationalStatePropagatorSettings< double > > getPropagatorSettings(
+        const SystemOfBodies& bodies, const bool propagateBackwards, const bool terminateExactly )
+{
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettingsMap, bodiesToPropagate, centralBodies );
+
+    Eigen::Vector6d keplerianState;
+    keplerianState << 7.0E6, 0.05, 0.8, 0.3, 1.2, 0.4;
+    Eigen::VectorXd initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                keplerianState, bodies.at( "Earth" )->getGravitationalParameter( ) );
+
+    double initialTime = propagateBackwards ? 8000.0 : 0.0;
+    double finalTime = propagateBackwards ? 0.0 : 8000.0;
+    double initialTimeStep = propagateBackwards ? -10.0 : 10.0;
+    return translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, initialTime,
+                rungeKuttaVariableStepSettingsScalarTolerances( initialTimeStep, rungeKuttaFehlberg78, 1.0E-4,
+                                                                1.0E4, 1.0E-12, 1.0E-12 ),
+                propagationTimeTerminationSettings( finalTime, terminateExactly ), cowell,
+                { relativeDistanceDependentVariable( "Vehicle", "Earth" ) } );
+}
+
+//! Test if results written to output sinks during propagation are equal to the results retained in memory
+BOOST_AUTO_TEST_CASE( testPropagationOutputSink )
+{
+    // Create environment with point-mass Earth and vehicle
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.processBodyFrameDefinitions( );
+
+    std::string outputFile = ( boost::filesystem::temp_directory_path( ) /
+                               boost::filesystem::unique_path( "tudat_propagation_output_%%%%%%%%.dat" ) ).string( );
+
+    for( unsigned int testCase = 0; testCase < 4; testCase++ )
+    {
+        bool propagateBackwards = ( testCase % 2 == 1 );
+        bool terminateExactly = ( testCase >= 2 );
+
+        // Propagate with binary file output, retaining results in memory
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                getPropagatorSettings( bodies, propagateBackwards, terminateExactly );
+        std::shared_ptr< BinaryFilePropagationOutputSink > fileOutputSink =
+                std::make_shared< BinaryFilePropagationOutputSink >( outputFile, 1000 );
+        propagatorSettings->getOutputSettings( )->setOutputSink( fileOutputSink );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+
+        std::map< double, Eigen::VectorXd > stateHistory =
+                dynamicsSimulator.getSingleArcPropagationResults( )->getEquationsOfMotionNumericalSolutionRaw( );
+        std::map< double, Eigen::VectorXd > dependentVariableHistory =
+                dynamicsSimulator.getSingleArcPropagationResults( )->getDependentVariableHistory( );
+
+        // Check file contents against results in memory
+        std::map< double, Eigen::MatrixXd > fileStateHistory;
+        std::map< double, Eigen::VectorXd > fileDependentVariableHistory;
+        readBinaryPropagationOutputFile( outputFile, fileStateHistory, fileDependentVariableHistory );
+
+        BOOST_CHECK_EQUAL( fileStateHistory.size( ), stateHistory.size( ) );
+        BOOST_CHECK_EQUAL( fileDependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+        for( auto stateIterator : stateHistory )
+        {
+            BOOST_CHECK_EQUAL( fileStateHistory.count( stateIterator.first ), 1 );
+            BOOST_CHECK( fileStateHistory.at( stateIterator.first ) == Eigen::MatrixXd( stateIterator.second ) );
+        }
+        for( auto dependentVariableIterator : dependentVariableHistory )
+        {
+            BOOST_CHECK_EQUAL( fileDependentVariableHistory.count( dependentVariableIterator.first ), 1 );
+            BOOST_CHECK( fileDependentVariableHistory.at( dependentVariableIterator.first ) ==
+                         dependentVariableIterator.second );
+        }
+        if( terminateExactly )
+        {
+            BOOST_CHECK_EQUAL( ( propagateBackwards ? fileStateHistory.begin( )->first :
+                                                      fileStateHistory.rbegin( )->first ),
+                               ( propagateBackwards ? 0.0 : 8000.0 ) );
+        }
+
+        // Propagate with ring buffer output, without retaining results in memory
+        const int ringBufferCapacity = 5;
+        propagatorSettings = getPropagatorSettings( bodies, propagateBackwards, terminateExactly );
+        std::shared_ptr< RingBufferPropagationOutputSink > ringBufferOutputSink =
+                std::make_shared< RingBufferPropagationOutputSink >( ringBufferCapacity );
+        propagatorSettings->getOutputSettings( )->setOutputSink( ringBufferOutputSink );
+        propagatorSettings->getOutputSettings( )->setRetainResultsInMemory( false );
+        SingleArcDynamicsSimulator< > boundedMemoryDynamicsSimulator( bodies, propagatorSettings );
+
+        // Check that only the final state is retained in memory
+        std::map< double, Eigen::VectorXd > retainedStateHistory =
+                boundedMemoryDynamicsSimulator.getSingleArcPropagationResults( )->getEquationsOfMotionNumericalSolutionRaw( );
+        BOOST_CHECK_EQUAL( retainedStateHistory.size( ), 1 );
+        std::pair< double, Eigen::VectorXd > finalEntry =
+                propagateBackwards ? *stateHistory.begin( ) : *stateHistory.rbegin( );
+        BOOST_CHECK_EQUAL( retainedStateHistory.begin( )->first, finalEntry.first );
+        BOOST_CHECK( retainedStateHistory.begin( )->second == finalEntry.second );
+
+        // Check that ring buffer contains last entries of the propagation
+        BOOST_CHECK_EQUAL( ringBufferOutputSink->getNumberOfAddedStateEntries( ), stateHistory.size( ) );
+        BOOST_CHECK_EQUAL( ringBufferOutputSink->getNumberOfAddedDependentVariableEntries( ),
+                           dependentVariableHistory.size( ) );
+        std::map< double, Eigen::MatrixXd > ringBufferStateHistory = ringBufferOutputSink->getStateHistory( );
+        std::map< double, Eigen::VectorXd > ringBufferDependentVariableHistory =
+                ringBufferOutputSink->getDependentVariableHistory( );
+        BOOST_CHECK_EQUAL( ringBufferStateHistory.size( ), ringBufferCapacity );
+        BOOST_CHECK_EQUAL( ringBufferDependentVariableHistory.size( ), ringBufferCapacity );
+
+        auto stateIterator = stateHistory.begin( );
+        if( !propagateBackwards )
+        {
+            std::advance( stateIterator, stateHistory.size( ) - ringBufferCapacity );
+        }
+        for( auto ringBufferIterator : ringBufferStateHistory )
+        {
+            BOOST_CHECK_EQUAL( ringBufferIterator.first, stateIterator->first );
+            BOOST_CHECK( ringBufferIterator.second == Eigen::MatrixXd( stateIterator->second ) );
+            BOOST_CHECK( ringBufferDependentVariableHistory.at( ringBufferIterator.first ) ==
+                         dependentVariableHistory.at( ringBufferIterator.first ) );
+            stateIterator++;
+        }
+    }
+
+    std::remove( outputFile.c_str( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
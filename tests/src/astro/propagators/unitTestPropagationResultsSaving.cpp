@@ -20,6 +20,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/basics/testMacros.h"
+#include "tudat/astro/basic_astro/keplerPropagator.h"
 #include "tudat/simulation/estimation.h"
 #include "tudat/astro/orbit_determination/estimatable_parameters/directTidalTimeLag.h"
 
@@ -216,6 +217,112 @@ namespace tudat
                 }
             }
 
+//! Unit test to check if states are correctly saved at output epochs, using the dense output of the integrator
+            BOOST_AUTO_TEST_CASE( test_StateSaveAtOutputEpochs )
+            {
+                //Load spice kernels.
+                spice_interface::loadStandardSpiceKernels( );
+
+                // Create bodies needed in simulation
+                std::vector< std::string > bodyNames = { "Earth", "Sun" };
+                SystemOfBodies bodies = createSystemOfBodies( getDefaultBodySettings( bodyNames ) );
+                bodies.createEmptyBody( "Vehicle" );
+
+                double initialEphemerisTime = double( 1.0E7 );
+                double finalEphemerisTime = initialEphemerisTime + 1.0 * 86400.0;
+
+                // Create point-mass acceleration of Earth, so that an analytical solution is available
+                SelectedAccelerationMap accelerationMap;
+                accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >(
+                        basic_astrodynamics::point_mass_gravity ) );
+                std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+                std::vector< std::string > centralBodies = { "Earth" };
+                AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        bodies, accelerationMap, bodiesToIntegrate, centralBodies );
+
+                // Set highly eccentric initial orbit
+                Eigen::Vector6d initialKeplerianState;
+                initialKeplerianState << 15000.0E3, 0.9, unit_conversions::convertDegreesToRadians( 85.3 ),
+                        unit_conversions::convertDegreesToRadians( 235.7 ), unit_conversions::convertDegreesToRadians( 23.4 ),
+                        unit_conversions::convertDegreesToRadians( 139.87 );
+                double earthGravitationalParameter = bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+                Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                        initialKeplerianState, earthGravitationalParameter );
+
+                // Define output epochs (last epoch is after the end of the propagation, and should be discarded)
+                std::vector< double > outputEpochs;
+                for( double outputEpoch = initialEphemerisTime + 500.0; outputEpoch < finalEphemerisTime + 1000.0;
+                     outputEpoch += 1000.0 )
+                {
+                    outputEpochs.push_back( outputEpoch );
+                }
+                const int numberOfStages = RungeKuttaCoefficients::get( rungeKuttaFehlberg78 ).cCoefficients.rows( );
+
+                // Propagate without output epochs, and with output epochs for each type of dense output
+                std::vector< RungeKuttaDenseOutputTypes > denseOutputTypes =
+                        { multi_step_hermite_dense_output, multi_step_hermite_dense_output, quintic_hermite_dense_output };
+                std::vector< double > maximumPositionErrors;
+                std::vector< unsigned int > numberOfFunctionEvaluations;
+                for( unsigned int i = 0; i < denseOutputTypes.size( ); i++ )
+                {
+                    std::shared_ptr< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > > integratorSettings =
+                            std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                                    double( initialEphemerisTime ), 70.0, rungeKuttaFehlberg78, 0.01, 3600.0, 1.0E-12, 1.0E-12 );
+                    integratorSettings->denseOutputType_ = denseOutputTypes.at( i );
+
+                    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                                    centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState,
+                                    initialEphemerisTime, integratorSettings,
+                                    std::make_shared< PropagationTimeTerminationSettings >( finalEphemerisTime ) );
+                    if( i > 0 )
+                    {
+                        propagatorSettings->getOutputSettings( )->setResultsOutputEpochs( outputEpochs );
+                    }
+
+                    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                    std::map< double, Eigen::VectorXd > numericalResults =
+                            dynamicsSimulator.getSingleArcPropagationResults( )->getEquationsOfMotionNumericalSolution( );
+                    numberOfFunctionEvaluations.push_back(
+                                dynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( ).rbegin( )->second );
+
+                    // Check that states are saved at initial time, output epochs in propagation interval, and final time
+                    if( i > 0 )
+                    {
+                        BOOST_CHECK_EQUAL( numericalResults.size( ), outputEpochs.size( ) + 1 );
+                        auto resultIterator = numericalResults.begin( );
+                        BOOST_CHECK_EQUAL( resultIterator->first, initialEphemerisTime );
+                        for( unsigned int j = 0; j < outputEpochs.size( ) - 1; j++ )
+                        {
+                            resultIterator++;
+                            BOOST_CHECK_EQUAL( resultIterator->first, outputEpochs.at( j ) );
+                        }
+                        BOOST_CHECK_EQUAL( numericalResults.rbegin( )->first, finalEphemerisTime );
+                    }
+
+                    // Compare saved states with analytical solution
+                    double maximumPositionError = 0.0;
+                    for( const auto& resultIterator : numericalResults )
+                    {
+                        Eigen::Vector6d analyticalState = convertKeplerianToCartesianElements(
+                                propagateKeplerOrbit( initialKeplerianState, resultIterator.first - initialEphemerisTime,
+                                                      earthGravitationalParameter ), earthGravitationalParameter );
+                        maximumPositionError = std::max(
+                                maximumPositionError, ( resultIterator.second.segment( 0, 3 ) - analyticalState.segment( 0, 3 ) ).norm( ) );
+                    }
+                    maximumPositionErrors.push_back( maximumPositionError );
+                }
+
+                // Check that the error at the output epochs is consistent with the integration error at the integrator steps
+                BOOST_CHECK( maximumPositionErrors.at( 1 ) < 2.0 * maximumPositionErrors.at( 0 ) + 1.0E-4 );
+                BOOST_CHECK( maximumPositionErrors.at( 2 ) < 2.0 * maximumPositionErrors.at( 0 ) + 1.0E-4 );
+
+                // Check that multi-step dense output only requires additional state derivative evaluations for the midpoints
+                // of the first two steps in which it is used (and the end of the final step), unlike quintic dense output
+                BOOST_CHECK( numberOfFunctionEvaluations.at( 1 ) <= numberOfFunctionEvaluations.at( 0 ) + 2 * numberOfStages + 1 );
+                BOOST_CHECK( numberOfFunctionEvaluations.at( 2 ) > numberOfFunctionEvaluations.at( 1 ) + 2 * numberOfStages );
+            }
+
         BOOST_AUTO_TEST_SUITE_END( )
 
     }
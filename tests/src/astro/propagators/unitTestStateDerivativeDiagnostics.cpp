@@ -0,0 +1,203 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_state_derivative_diagnostics )
+
+//! Test if number of function evaluations is recorded consistently for each level of state derivative diagnostics
+BOOST_AUTO_TEST_CASE( testStateDerivativeDiagnosticsLevel )
+{
+    // Create environment with point-mass Earth and vehicle
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.processBodyFrameDefinitions( );
+
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettingsMap, bodiesToPropagate, centralBodies );
+
+    Eigen::Vector6d keplerianState;
+    keplerianState << 7.0E6, 0.05, 0.8, 0.3, 1.2, 0.4;
+    Eigen::VectorXd initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                keplerianState, bodies.at( "Earth" )->getGravitationalParameter( ) );
+
+    std::map< double, Eigen::VectorXd > nominalStateHistory;
+    unsigned int nominalNumberOfEvaluations = 0;
+    std::vector< StateDerivativeDiagnosticsLevel > diagnosticsLevels =
+    { full_state_derivative_diagnostics, state_derivative_evaluation_counters, no_state_derivative_diagnostics };
+    for( StateDerivativeDiagnosticsLevel diagnosticsLevel : diagnosticsLevels )
+    {
+        // Propagate orbit with given diagnostics level
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                translationalStatePropagatorSettings< double >(
+                    centralBodies, accelerationModelMap, bodiesToPropagate, initialState, 0.0,
+                    rungeKuttaVariableStepSettingsScalarTolerances( 10.0, rungeKuttaFehlberg78, 1.0E-4,
+                                                                    1.0E4, 1.0E-12, 1.0E-12 ),
+                    propagationTimeTerminationSettings( 8000.0 ) );
+        propagatorSettings->getOutputSettings( )->setStateDerivativeDiagnosticsLevel( diagnosticsLevel );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        BOOST_CHECK_EQUAL( dynamicsSimulator.getDynamicsStateDerivative( )->getDiagnosticsLevel( ), diagnosticsLevel );
+
+        std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                dynamicsSimulator.getSingleArcPropagationResults( );
+        std::map< double, Eigen::VectorXd > stateHistory = propagationResults->getEquationsOfMotionNumericalSolution( );
+        std::map< double, unsigned int > cumulativeNumberOfEvaluations =
+                dynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( );
+
+        if( diagnosticsLevel == full_state_derivative_diagnostics )
+        {
+            // Check that number of evaluations is stored for each evaluation time
+            nominalStateHistory = stateHistory;
+            nominalNumberOfEvaluations = dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( );
+            BOOST_CHECK( cumulativeNumberOfEvaluations.size( ) > stateHistory.size( ) );
+            BOOST_CHECK_EQUAL( propagationResults->getTotalNumberOfFunctionEvaluations( ), nominalNumberOfEvaluations );
+        }
+        else if( diagnosticsLevel == state_derivative_evaluation_counters )
+        {
+            // Check that only total number of evaluations is stored
+            BOOST_CHECK_EQUAL( cumulativeNumberOfEvaluations.size( ), 1 );
+            BOOST_CHECK_EQUAL( cumulativeNumberOfEvaluations.begin( )->second, nominalNumberOfEvaluations );
+            BOOST_CHECK_EQUAL( propagationResults->getTotalNumberOfFunctionEvaluations( ), nominalNumberOfEvaluations );
+        }
+        else
+        {
+            // Check that no evaluations are recorded
+            BOOST_CHECK_EQUAL( cumulativeNumberOfEvaluations.size( ), 0 );
+            BOOST_CHECK_EQUAL( dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( ), 0 );
+            BOOST_CHECK( !propagationResults->isNumberOfFunctionEvaluationsRecorded( ) );
+            BOOST_CHECK_THROW( propagationResults->getTotalNumberOfFunctionEvaluations( ), std::runtime_error );
+        }
+
+        // Check that propagation results are independent of diagnostics level
+        BOOST_CHECK_EQUAL( stateHistory.size( ), nominalStateHistory.size( ) );
+        for( auto stateIterator : nominalStateHistory )
+        {
+            BOOST_CHECK( stateHistory.at( stateIterator.first ) == stateIterator.second );
+        }
+    }
+}
+
+//! Test if number of calls of acceleration models and environment updates are recorded when profiling is requested
+BOOST_AUTO_TEST_CASE( testModelEvaluationProfiling )
+{
+    // Create environment with point-mass Earth and vehicle
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.processBodyFrameDefinitions( );
+
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettingsMap, bodiesToPropagate, centralBodies );
+
+    Eigen::Vector6d keplerianState;
+    keplerianState << 7.0E6, 0.05, 0.8, 0.3, 1.2, 0.4;
+    Eigen::VectorXd initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                keplerianState, bodies.at( "Earth" )->getGravitationalParameter( ) );
+
+    std::map< double, Eigen::VectorXd > nominalStateHistory;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Propagate orbit with and without profiling
+        bool profileModelEvaluations = ( test == 1 );
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                translationalStatePropagatorSettings< double >(
+                    centralBodies, accelerationModelMap, bodiesToPropagate, initialState, 0.0,
+                    rungeKuttaVariableStepSettingsScalarTolerances( 10.0, rungeKuttaFehlberg78, 1.0E-4,
+                                                                    1.0E4, 1.0E-12, 1.0E-12 ),
+                    propagationTimeTerminationSettings( 8000.0 ) );
+        propagatorSettings->getOutputSettings( )->setProfileModelEvaluations( profileModelEvaluations );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+
+        std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                dynamicsSimulator.getSingleArcPropagationResults( );
+        std::map< double, Eigen::VectorXd > stateHistory = propagationResults->getEquationsOfMotionNumericalSolution( );
+
+        if( !profileModelEvaluations )
+        {
+            nominalStateHistory = stateHistory;
+            BOOST_CHECK( !propagationResults->isModelEvaluationProfileRecorded( ) );
+            BOOST_CHECK_THROW( propagationResults->getModelEvaluationProfiler( ), std::runtime_error );
+        }
+        else
+        {
+            // Check that acceleration is evaluated once per state derivative evaluation
+            std::shared_ptr< utilities::ModelEvaluationProfiler > profiler = propagationResults->getModelEvaluationProfiler( );
+            unsigned int numberOfEvaluations = dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( );
+            const utilities::ModelEvaluationProfile& accelerationProfile =
+                    profiler->getProfile( "acceleration", "central gravity of Earth on Vehicle" );
+            BOOST_CHECK_EQUAL( accelerationProfile.numberOfCalls_, numberOfEvaluations );
+            BOOST_CHECK( accelerationProfile.totalEvaluationTime_ > 0.0 );
+            BOOST_CHECK_EQUAL( profiler->getProfilesOfCategory( "acceleration" ).size( ), 1 );
+
+            // Check that environment updates are evaluated at most once per state derivative evaluation
+            std::vector< utilities::ModelEvaluationProfile > environmentProfiles =
+                    profiler->getProfilesOfCategory( "environment update" );
+            for( unsigned int i = 0; i < environmentProfiles.size( ); i++ )
+            {
+                BOOST_CHECK( environmentProfiles.at( i ).numberOfCalls_ <= numberOfEvaluations );
+            }
+
+            // Check that the profile of each propagation is independent
+            dynamicsSimulator.integrateEquationsOfMotion( initialState );
+            BOOST_CHECK( propagationResults->getModelEvaluationProfiler( ) != profiler );
+            BOOST_CHECK_EQUAL( propagationResults->getModelEvaluationProfiler( )->getProfile(
+                                   "acceleration", "central gravity of Earth on Vehicle" ).numberOfCalls_,
+                               numberOfEvaluations );
+        }
+
+        // Check that propagation results are independent of profiling
+        BOOST_CHECK_EQUAL( stateHistory.size( ), nominalStateHistory.size( ) );
+        for( auto stateIterator : nominalStateHistory )
+        {
+            BOOST_CHECK( stateHistory.at( stateIterator.first ) == stateIterator.second );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
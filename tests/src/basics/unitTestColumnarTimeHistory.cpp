@@ -0,0 +1,169 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/columnarTimeHistory.h"
+#include "tudat/basics/timeType.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_columnar_time_history )
+
+//! Test storage and map conversion of vector entries
+BOOST_AUTO_TEST_CASE( testColumnarTimeHistoryVectorEntries )
+{
+    using namespace utilities;
+
+    // Create map and columnar history with same (forward) entries
+    std::map< double, Eigen::VectorXd > referenceMap;
+    ColumnarTimeHistory< double, double > history;
+    for( int i = 0; i < 100; i++ )
+    {
+        Eigen::VectorXd currentValue = Eigen::VectorXd::Constant( 4, static_cast< double >( i ) );
+        currentValue( 0 ) = -i;
+        referenceMap[ 10.0 * i ] = currentValue;
+        history.pushBack( 10.0 * i, currentValue );
+    }
+
+    BOOST_CHECK_EQUAL( history.size( ), 100 );
+    BOOST_CHECK_EQUAL( history.getEntryRows( ), 4 );
+    BOOST_CHECK_EQUAL( history.getEntryColumns( ), 1 );
+    BOOST_CHECK_EQUAL( history.getValues( ).cols( ), 100 );
+    BOOST_CHECK_EQUAL( history.getValues( )( 0, 42 ), -42.0 );
+    BOOST_CHECK_EQUAL( history.getValues( )( 3, 42 ), 42.0 );
+
+    // Entries are stored contiguously
+    BOOST_CHECK_EQUAL( history.getValue( 1 ).data( ) - history.getValue( 0 ).data( ), 4 );
+
+    // Check consistency with map
+    std::map< double, Eigen::VectorXd > convertedMap = history.toMap< Eigen::VectorXd >( );
+    BOOST_CHECK_EQUAL( convertedMap.size( ), referenceMap.size( ) );
+    for( auto it : referenceMap )
+    {
+        BOOST_CHECK( convertedMap.at( it.first ) == it.second );
+    }
+
+    ColumnarTimeHistory< double, double > historyFromMap( referenceMap );
+    BOOST_CHECK( historyFromMap.getTimes( ) == history.getTimes( ) );
+    BOOST_CHECK( historyFromMap.getValues( ) == history.getValues( ) );
+
+    // Check that entries of inconsistent size are rejected
+    BOOST_CHECK_THROW( history.pushBack( 1000.0, Eigen::VectorXd::Zero( 3 ) ), std::runtime_error );
+
+    // Check removal of last entry
+    history.popBack( );
+    BOOST_CHECK_EQUAL( history.size( ), 99 );
+    BOOST_CHECK_EQUAL( history.backTime( ), 980.0 );
+    BOOST_CHECK( history.backValue( ) == referenceMap.at( 980.0 ) );
+}
+
+//! Test sorting of entries by time
+BOOST_AUTO_TEST_CASE( testColumnarTimeHistorySorting )
+{
+    using namespace utilities;
+
+    // Backward propagation: entries are reversed
+    {
+        ColumnarTimeHistory< Time, long double > history;
+        for( int i = 0; i < 10; i++ )
+        {
+            history.pushBack( Time( -i, 0.5L ), Eigen::Matrix< long double, 2, 1 >::Constant( i ) );
+        }
+        history.sortByTime( );
+        BOOST_CHECK_EQUAL( history.size( ), 10 );
+        for( int i = 0; i < 10; i++ )
+        {
+            BOOST_CHECK( history.getTime( i ) == Time( i - 9, 0.5L ) );
+            BOOST_CHECK_EQUAL( history.getValue( i )( 1, 0 ), static_cast< long double >( 9 - i ) );
+        }
+    }
+
+    // Unordered entries with duplicate times: last-added entry is retained, as for a map
+    {
+        ColumnarTimeHistory< double, double > history;
+        std::map< double, Eigen::MatrixXd > referenceMap;
+        std::vector< double > times = { 0.0, 1.0, 5.0, 3.0, 2.0, 5.0, 4.0, 3.0 };
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            Eigen::MatrixXd currentValue = Eigen::MatrixXd::Constant( 2, 3, static_cast< double >( i ) );
+            currentValue( 1, 2 ) = times.at( i );
+            referenceMap[ times.at( i ) ] = currentValue;
+            history.pushBack( times.at( i ), currentValue );
+        }
+        history.sortByTime( );
+
+        BOOST_CHECK_EQUAL( history.size( ), static_cast< int >( referenceMap.size( ) ) );
+        int counter = 0;
+        for( auto it : referenceMap )
+        {
+            BOOST_CHECK_EQUAL( history.getTime( counter ), it.first );
+            BOOST_CHECK( Eigen::MatrixXd( history.getValue( counter ) ) == it.second );
+            counter++;
+        }
+        BOOST_CHECK( history.toMap< Eigen::MatrixXd >( ) == referenceMap );
+    }
+}
+
+//! Test scalar entries, and map adapter
+BOOST_AUTO_TEST_CASE( testMapAdaptedColumnarTimeHistory )
+{
+    using namespace utilities;
+
+    ColumnarTimeHistory< double, double > history;
+    history.reserve( 10 );
+    for( int i = 0; i < 10; i++ )
+    {
+        history.pushBack( static_cast< double >( i ), static_cast< double >( 2 * i ) );
+    }
+
+    MapAdaptedColumnarTimeHistory< double, double, unsigned int > adaptedHistory;
+    adaptedHistory.setHistory( history );
+    BOOST_CHECK_EQUAL( adaptedHistory.size( ), 10 );
+    BOOST_CHECK_EQUAL( adaptedHistory.getMap( ).size( ), 10 );
+    BOOST_CHECK_EQUAL( adaptedHistory.getMap( ).at( 7.0 ), 14 );
+
+    // Check that modifications of retrieved map do not affect the history
+    std::map< double, unsigned int > retrievedMap = adaptedHistory.getMap( );
+    retrievedMap[ 100.0 ] = 1;
+    BOOST_CHECK_EQUAL( adaptedHistory.size( ), 10 );
+    BOOST_CHECK_EQUAL( adaptedHistory.getMap( ).size( ), 10 );
+
+    // Check that map is recreated when history is reset
+    history.pushBack( 10.0, 20.0 );
+    adaptedHistory.setHistory( std::move( history ) );
+    BOOST_CHECK_EQUAL( adaptedHistory.getMap( ).size( ), 11 );
+
+    std::map< double, unsigned int > newMap = { { 1.0, 3 }, { 2.0, 5 } };
+    adaptedHistory.setHistory( newMap );
+    BOOST_CHECK_EQUAL( adaptedHistory.getHistory( ).size( ), 2 );
+    BOOST_CHECK_EQUAL( adaptedHistory.getHistory( ).getValue( 1 )( 0, 0 ), 5.0 );
+    BOOST_CHECK( adaptedHistory.getMap( ) == newMap );
+
+    adaptedHistory.clear( );
+    BOOST_CHECK_EQUAL( adaptedHistory.size( ), 0 );
+    BOOST_CHECK_EQUAL( adaptedHistory.getMap( ).size( ), 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,107 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <sstream>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/modelEvaluationProfiler.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_model_evaluation_profiler )
+
+//! Test registration of models, and recording of number of calls and evaluation time
+BOOST_AUTO_TEST_CASE( testModelEvaluationProfiler )
+{
+    using namespace utilities;
+
+    ModelEvaluationProfiler profiler;
+
+    // Register models, and check that registering an existing model returns the existing index
+    int firstIndex = profiler.registerModel( "acceleration", "central gravity of Earth on Vehicle" );
+    int secondIndex = profiler.registerModel( "environment update", "rotational state of Earth" );
+    BOOST_CHECK_EQUAL( firstIndex, 0 );
+    BOOST_CHECK_EQUAL( secondIndex, 1 );
+    BOOST_CHECK_EQUAL( profiler.registerModel( "acceleration", "central gravity of Earth on Vehicle" ), firstIndex );
+    BOOST_CHECK_EQUAL( profiler.registerModel( "acceleration", "rotational state of Earth" ), 2 );
+    BOOST_CHECK_EQUAL( profiler.getProfiles( ).size( ), 3 );
+
+    // Add evaluations manually and through timer object
+    profiler.addEvaluation( firstIndex, 1.0 );
+    profiler.addEvaluation( firstIndex, 2.0 );
+    {
+        ScopedModelEvaluationTimer timer( &profiler, secondIndex );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+    }
+
+    // Timer without profiler should have no effect
+    {
+        ScopedModelEvaluationTimer timer( nullptr, secondIndex );
+    }
+
+    BOOST_CHECK_EQUAL( profiler.getProfile( "acceleration", "central gravity of Earth on Vehicle" ).numberOfCalls_, 2 );
+    BOOST_CHECK_CLOSE_FRACTION(
+                profiler.getProfile( "acceleration", "central gravity of Earth on Vehicle" ).totalEvaluationTime_,
+                3.0, std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( profiler.getProfile( "environment update", "rotational state of Earth" ).numberOfCalls_, 1 );
+    BOOST_CHECK( profiler.getProfile( "environment update", "rotational state of Earth" ).totalEvaluationTime_ >= 2.0E-3 );
+    BOOST_CHECK_EQUAL( profiler.getProfile( "acceleration", "rotational state of Earth" ).numberOfCalls_, 0 );
+    BOOST_CHECK_THROW( profiler.getProfile( "acceleration", "aerodynamic of Earth on Vehicle" ), std::runtime_error );
+
+    // Check per-category retrieval
+    BOOST_CHECK_EQUAL( profiler.getProfilesOfCategory( "acceleration" ).size( ), 2 );
+    BOOST_CHECK_CLOSE_FRACTION( profiler.getTotalEvaluationTimeOfCategory( "acceleration" ), 3.0,
+                                std::numeric_limits< double >::epsilon( ) );
+
+    // Check delimited output
+    std::stringstream tableStream;
+    profiler.writeProfileTable( tableStream, ";" );
+    std::string headerLine, firstLine;
+    std::getline( tableStream, headerLine );
+    std::getline( tableStream, firstLine );
+    BOOST_CHECK_EQUAL( headerLine, "category;model;calls;total_time" );
+    BOOST_CHECK_EQUAL( firstLine, "acceleration;central gravity of Earth on Vehicle;2;3" );
+
+    // Check that printed table is sorted by evaluation time, and has one line per model (and a header)
+    std::stringstream printStream;
+    profiler.printProfileTable( printStream );
+    std::vector< std::string > printedLines;
+    std::string currentLine;
+    while( std::getline( printStream, currentLine ) )
+    {
+        printedLines.push_back( currentLine );
+    }
+    BOOST_CHECK_EQUAL( printedLines.size( ), 4 );
+    BOOST_CHECK( printedLines.at( 1 ).find( "central gravity of Earth on Vehicle" ) != std::string::npos );
+
+    // Check reset
+    profiler.resetProfiles( );
+    BOOST_CHECK_EQUAL( profiler.getProfiles( ).size( ), 3 );
+    for( unsigned int i = 0; i < profiler.getProfiles( ).size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( profiler.getProfiles( ).at( i ).numberOfCalls_, 0 );
+        BOOST_CHECK_EQUAL( profiler.getProfiles( ).at( i ).totalEvaluationTime_, 0.0 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
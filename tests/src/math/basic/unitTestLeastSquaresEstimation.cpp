@@ -0,0 +1,298 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/LU>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/blockArrowheadNormalEquations.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_least_squares_estimation )
+
+//! Test accumulation of normal equations per block of observations, and solution with Cholesky decomposition, against
+//! solution from full design matrix
+BOOST_AUTO_TEST_CASE( testNormalEquationAccumulation )
+{
+    // Create design matrix with columns of different scale, and associated weights and residuals
+    const int numberOfObservations = 500;
+    const int numberOfParameters = 8;
+    Eigen::MatrixXd designMatrix( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals( numberOfObservations );
+    Eigen::VectorXd weights( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double time = static_cast< double >( i ) / numberOfObservations;
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            designMatrix( i, j ) = std::cos( ( j + 1 ) * 7.0 * time + 0.3 * j ) + 0.1 * std::pow( time, j );
+        }
+        residuals( i ) = std::sin( 13.0 * time ) + 0.2 * time;
+        weights( i ) = 1.0 + 0.5 * ( i % 3 );
+    }
+
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance.diagonal( ) = Eigen::VectorXd::Constant( numberOfParameters, 0.1 );
+
+    // Accumulate normal equations, in blocks of varying size
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    Eigen::VectorXd normalRightHandSide = Eigen::VectorXd::Zero( numberOfParameters );
+    int currentStartIndex = 0;
+    int currentBlockSize = 1;
+    while( currentStartIndex < numberOfObservations )
+    {
+        currentBlockSize = std::min( currentBlockSize, numberOfObservations - currentStartIndex );
+        addObservationBlockToNormalEquations(
+                    designMatrix.block( currentStartIndex, 0, currentBlockSize, numberOfParameters ),
+                    residuals.segment( currentStartIndex, currentBlockSize ),
+                    weights.segment( currentStartIndex, currentBlockSize ),
+                    normalMatrix, normalRightHandSide );
+        currentStartIndex += currentBlockSize;
+        currentBlockSize *= 2;
+    }
+    symmetrizeNormalMatrix( normalMatrix );
+
+    // Compare normal equations with direct computation
+    Eigen::MatrixXd expectedNormalMatrix = designMatrix.transpose( ) * weights.asDiagonal( ) * designMatrix;
+    Eigen::VectorXd expectedRightHandSide = designMatrix.transpose( ) * weights.cwiseProduct( residuals );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalMatrix, expectedNormalMatrix, 1.0E-13 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalRightHandSide, expectedRightHandSide, 1.0E-13 );
+    BOOST_CHECK_EQUAL( ( normalMatrix - normalMatrix.transpose( ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    // Compare least squares solution with solution from design matrix
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > designMatrixOutput = performLeastSquaresAdjustmentFromDesignMatrix(
+                designMatrix, residuals, weights, inverseAprioriCovariance );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > normalEquationsOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalMatrix, normalRightHandSide, inverseAprioriCovariance );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalEquationsOutput.first, designMatrixOutput.first, 1.0E-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalEquationsOutput.second, designMatrixOutput.second, 1.0E-13 );
+
+    // Compare constrained least squares solution with solution from design matrix
+    Eigen::MatrixXd constraintMultiplier = Eigen::MatrixXd::Zero( 1, numberOfParameters );
+    constraintMultiplier( 0, 1 ) = 1.0;
+    constraintMultiplier( 0, 4 ) = -2.0;
+    Eigen::VectorXd constraintRightHandSide = Eigen::VectorXd::Constant( 1, 0.5 );
+    designMatrixOutput = performLeastSquaresAdjustmentFromDesignMatrix(
+                designMatrix, residuals, weights, inverseAprioriCovariance, true, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+    normalEquationsOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalMatrix, normalRightHandSide, inverseAprioriCovariance, true, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+    BOOST_CHECK_EQUAL( normalEquationsOutput.first.rows( ), numberOfParameters + 1 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalEquationsOutput.first, designMatrixOutput.first, 1.0E-10 );
+    BOOST_CHECK_SMALL( normalEquationsOutput.first( 1 ) - 2.0 * normalEquationsOutput.first( 4 ) - 0.5, 1.0E-12 );
+
+    // Check that inconsistent input is rejected
+    Eigen::VectorXd wrongSizeVector = Eigen::VectorXd::Zero( numberOfParameters + 1 );
+    BOOST_CHECK_THROW( addObservationBlockToNormalEquations(
+                           designMatrix, residuals, weights, normalMatrix, wrongSizeVector ), std::runtime_error );
+    BOOST_CHECK_THROW( performLeastSquaresAdjustmentFromNormalEquations(
+                           normalMatrix, wrongSizeVector, inverseAprioriCovariance ), std::runtime_error );
+}
+
+//! Test solution of symmetric systems with Cholesky decomposition, including fallback to SVD for singular systems
+BOOST_AUTO_TEST_CASE( testCholeskySolution )
+{
+    // Create well-conditioned symmetric positive definite system, and compare with SVD solution
+    Eigen::MatrixXd baseMatrix( 4, 3 );
+    baseMatrix << 1.0, 0.2, -0.3,
+            0.4, 2.0, 0.1,
+            -0.5, 0.3, 1.5,
+            0.1, -0.2, 0.7;
+    Eigen::MatrixXd positiveDefiniteMatrix = baseMatrix.transpose( ) * baseMatrix;
+    Eigen::VectorXd rightHandSide = Eigen::Vector3d( 1.0, -2.0, 0.5 );
+
+    Eigen::VectorXd choleskySolution = solveSystemOfEquationsWithCholesky( positiveDefiniteMatrix, rightHandSide );
+    Eigen::VectorXd svdSolution = solveSystemOfEquationsWithSvd( positiveDefiniteMatrix, rightHandSide, false );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( choleskySolution, svdSolution, 1.0E-13 );
+
+    // Check that indefinite system is rejected
+    Eigen::MatrixXd indefiniteMatrix = positiveDefiniteMatrix;
+    indefiniteMatrix( 1, 1 ) *= -1.0;
+    BOOST_CHECK_THROW( solveSystemOfEquationsWithCholesky( indefiniteMatrix, rightHandSide, false ),
+                       std::runtime_error );
+
+    // Create singular system (rank 2), which is solved with the SVD fallback
+    Eigen::MatrixXd singularMatrix = positiveDefiniteMatrix;
+    singularMatrix.row( 2 ) = singularMatrix.row( 0 ) + singularMatrix.row( 1 );
+    singularMatrix.col( 2 ) = singularMatrix.col( 0 ) + singularMatrix.col( 1 );
+    Eigen::VectorXd consistentRightHandSide = singularMatrix * Eigen::Vector3d( 0.3, 0.2, 0.0 );
+
+    choleskySolution = solveSystemOfEquationsWithCholesky(
+                singularMatrix, consistentRightHandSide, false, 1.0E8, true );
+    svdSolution = solveSystemOfEquationsWithSvd( singularMatrix, consistentRightHandSide, false );
+    BOOST_CHECK_SMALL( ( choleskySolution - svdSolution ).norm( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( singularMatrix * choleskySolution - consistentRightHandSide ).norm( ), 1.0E-12 );
+}
+
+//! Test accumulation and Schur complement solution of block-arrowhead normal equations, against dense normal equations
+BOOST_AUTO_TEST_CASE( testBlockArrowheadNormalEquations )
+{
+    // Define problem with 5 arcs of 4 local parameters each, and 3 global parameters, with the global parameters
+    // interleaved with the local ones
+    const int numberOfArcs = 5;
+    const int numberOfLocalParameters = 4;
+    const int numberOfGlobalParameters = 3;
+    const int numberOfParameters = numberOfArcs * numberOfLocalParameters + numberOfGlobalParameters;
+    std::vector< std::vector< int > > localParameterIndices( numberOfArcs );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( int j = 0; j < numberOfLocalParameters; j++ )
+        {
+            localParameterIndices[ i ].push_back( 1 + i * numberOfLocalParameters + j + ( i >= 3 ? 1 : 0 ) );
+        }
+    }
+    std::vector< int > globalParameterIndices = { 0, 13, numberOfParameters - 1 };
+
+    BlockArrowheadNormalEquations blockNormalEquations( numberOfParameters, localParameterIndices );
+    BOOST_CHECK_EQUAL( blockNormalEquations.getNumberOfLocalBlocks( ), numberOfArcs );
+    BOOST_CHECK( blockNormalEquations.getGlobalParameterIndices( ) == globalParameterIndices );
+
+    // Accumulate observations per arc (in two blocks per arc), in both block-arrowhead and dense normal equations
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    Eigen::VectorXd normalRightHandSide = Eigen::VectorXd::Zero( numberOfParameters );
+    const int numberOfObservationsPerBlock = 30;
+    for( int i = 0; i < 2 * numberOfArcs; i++ )
+    {
+        int arcIndex = i % numberOfArcs;
+        Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Zero( numberOfObservationsPerBlock, numberOfParameters );
+        Eigen::VectorXd residuals( numberOfObservationsPerBlock );
+        Eigen::VectorXd weights( numberOfObservationsPerBlock );
+        for( int j = 0; j < numberOfObservationsPerBlock; j++ )
+        {
+            double time = static_cast< double >( i * numberOfObservationsPerBlock + j ) / numberOfObservationsPerBlock;
+            for( int k = 0; k < numberOfLocalParameters; k++ )
+            {
+                designMatrix( j, localParameterIndices.at( arcIndex ).at( k ) ) =
+                        std::cos( ( k + 1 ) * 1.3 * time + 0.2 * k ) * std::pow( 10.0, k - 2 );
+            }
+            for( int k = 0; k < numberOfGlobalParameters; k++ )
+            {
+                designMatrix( j, globalParameterIndices.at( k ) ) = std::sin( ( k + 2 ) * 0.7 * time + 0.5 * k ) + 0.1 * k;
+            }
+            residuals( j ) = std::sin( 3.0 * time ) + 0.01 * time;
+            weights( j ) = 1.0 + 0.5 * ( j % 4 );
+        }
+
+        blockNormalEquations.addObservationBlock( designMatrix, residuals, weights );
+        addObservationBlockToNormalEquations( designMatrix, residuals, weights, normalMatrix, normalRightHandSide );
+
+        // Apply residual correction to righthandside only
+        if( i == 3 )
+        {
+            Eigen::VectorXd residualCorrection = Eigen::VectorXd::Constant( numberOfObservationsPerBlock, 0.1 );
+            blockNormalEquations.addObservationBlock( designMatrix, residualCorrection, weights, false );
+            normalRightHandSide += designMatrix.transpose( ) * weights.cwiseProduct( residualCorrection );
+        }
+    }
+    blockNormalEquations.symmetrize( );
+    symmetrizeNormalMatrix( normalMatrix );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockNormalEquations.getFullNormalMatrix( ), normalMatrix, 1.0E-14 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockNormalEquations.getFullRightHandSide( ), normalRightHandSide, 1.0E-14 );
+
+    // Normalize both sets of normal equations
+    Eigen::VectorXd normalizationTerms( numberOfParameters );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        normalizationTerms( i ) = std::sqrt( normalMatrix( i, i ) );
+    }
+    blockNormalEquations.normalize( normalizationTerms );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            normalMatrix( i, j ) /= ( normalizationTerms( i ) * normalizationTerms( j ) );
+        }
+        normalRightHandSide( i ) /= normalizationTerms( i );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockNormalEquations.getFullNormalMatrix( ), normalMatrix, 1.0E-14 );
+
+    // Compare Schur complement solution with dense solution, with a priori information coupling local and global
+    // parameters
+    Eigen::MatrixXd inverseAprioriCovariance = 1.0E-3 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance( 2, 13 ) = inverseAprioriCovariance( 13, 2 ) = 1.0E-4;
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > denseOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalMatrix, normalRightHandSide, inverseAprioriCovariance );
+    std::pair< Eigen::VectorXd, BlockArrowheadNormalEquations > blockOutput =
+            performLeastSquaresAdjustmentFromBlockArrowheadNormalEquations( blockNormalEquations, inverseAprioriCovariance );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockOutput.first, denseOutput.first, 1.0E-9 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockOutput.second.getFullNormalMatrix( ), denseOutput.second, 1.0E-14 );
+
+    // Compare blocks of covariance matrix with inverse of dense inverse covariance
+    Eigen::MatrixXd denseCovariance = denseOutput.second.inverse( );
+    std::vector< Eigen::MatrixXd > localCovarianceMatrices;
+    std::vector< Eigen::MatrixXd > localGlobalCovarianceMatrices;
+    Eigen::MatrixXd globalCovarianceMatrix;
+    blockOutput.second.getCovarianceBlocks( localCovarianceMatrices, localGlobalCovarianceMatrices, globalCovarianceMatrix );
+    BOOST_CHECK_EQUAL( static_cast< int >( localCovarianceMatrices.size( ) ), numberOfArcs );
+    BOOST_CHECK_EQUAL( static_cast< int >( localGlobalCovarianceMatrices.size( ) ), numberOfArcs );
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        for( int j = 0; j < numberOfGlobalParameters; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( globalCovarianceMatrix( i, j ),
+                                        denseCovariance( globalParameterIndices.at( i ), globalParameterIndices.at( j ) ),
+                                        1.0E-8 );
+        }
+    }
+    for( int k = 0; k < numberOfArcs; k++ )
+    {
+        for( int i = 0; i < numberOfLocalParameters; i++ )
+        {
+            for( int j = 0; j < numberOfLocalParameters; j++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION(
+                            localCovarianceMatrices.at( k )( i, j ),
+                            denseCovariance( localParameterIndices.at( k ).at( i ), localParameterIndices.at( k ).at( j ) ),
+                            1.0E-8 );
+            }
+            for( int j = 0; j < numberOfGlobalParameters; j++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION(
+                            localGlobalCovarianceMatrices.at( k )( i, j ),
+                            denseCovariance( localParameterIndices.at( k ).at( i ), globalParameterIndices.at( j ) ),
+                            1.0E-8 );
+            }
+        }
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockOutput.second.getCovarianceDiagonal( ), denseCovariance.diagonal( ), 1.0E-8 );
+
+    // Check that observations coupling different local blocks are rejected
+    Eigen::MatrixXd couplingDesignMatrix = Eigen::MatrixXd::Zero( 1, numberOfParameters );
+    couplingDesignMatrix( 0, localParameterIndices.at( 0 ).at( 0 ) ) = 1.0;
+    couplingDesignMatrix( 0, localParameterIndices.at( 4 ).at( 3 ) ) = 1.0;
+    BOOST_CHECK_THROW( blockNormalEquations.addObservationBlock(
+                           couplingDesignMatrix, Eigen::VectorXd::Ones( 1 ), Eigen::VectorXd::Ones( 1 ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( BlockArrowheadNormalEquations( numberOfParameters, { { 0, 1 }, { 1, 2 } } ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
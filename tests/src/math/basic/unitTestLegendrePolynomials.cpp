@@ -27,6 +27,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include <Eigen/Core>
 
 #include "tudat/basics/testMacros.h"
@@ -277,6 +281,144 @@ BOOST_AUTO_TEST_CASE( test_Legendre_GeodesyLegendrePolynomialDerivative )
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedValues, computedTestValues, 1.0e-14 );
 }
 
+//! Test if fused computation of geodesy-normalized polynomials and derivatives in cache is consistent with per-entry
+//! computation.
+BOOST_AUTO_TEST_CASE( test_GeodesyLegendreCacheFusedComputation )
+{
+    const int maximumDegree = 30;
+    const int maximumOrder = 20;
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumOrder, true );
+    legendreCache.setComputeSecondDerivatives( true );
+
+    std::vector< double > polynomialParameters = { -0.95, -0.3, 0.0, 0.1, 0.75, 0.999 };
+    for( unsigned int k = 0; k < polynomialParameters.size( ); k++ )
+    {
+        const double polynomialParameter = polynomialParameters.at( k );
+        legendreCache.update( polynomialParameter );
+
+        for( int i = 0; i <= maximumDegree; i++ )
+        {
+            for( int j = 0; ( j <= i ) && ( j <= maximumOrder ); j++ )
+            {
+                // Check values against direct computation
+                BOOST_CHECK_CLOSE_FRACTION(
+                            legendreCache.getLegendrePolynomial( i, j ),
+                            basic_mathematics::computeGeodesyLegendrePolynomial( i, j, polynomialParameter ), 1.0E-12 );
+
+                // Derivatives at maximum order are only computed if order is equal to degree
+                if( j < maximumOrder || j == i )
+                {
+                    double incrementedPolynomial = ( j < i ) ? legendreCache.getLegendrePolynomial( i, j + 1 ) : 0.0;
+                    BOOST_CHECK_CLOSE_FRACTION(
+                                legendreCache.getLegendrePolynomialDerivative( i, j ),
+                                basic_mathematics::computeGeodesyLegendrePolynomialDerivative(
+                                    i, j, polynomialParameter, legendreCache.getLegendrePolynomial( i, j ),
+                                    incrementedPolynomial ), 1.0E-14 );
+
+                    // Check second derivatives against per-entry computation
+                    double normalizationCorrection = std::sqrt(
+                                static_cast< double >( i + j + 1 ) * static_cast< double >( i - j ) );
+                    if( j == 0 )
+                    {
+                        normalizationCorrection *= std::sqrt( 0.5 );
+                    }
+                    double incrementedPolynomialDerivative =
+                            ( j < i ) ? legendreCache.getLegendrePolynomialDerivative( i, j + 1 ) : 0.0;
+                    BOOST_CHECK_CLOSE_FRACTION(
+                                legendreCache.getLegendrePolynomialSecondDerivative( i, j ),
+                                basic_mathematics::computeGeodesyLegendrePolynomialSecondDerivative(
+                                    j, polynomialParameter,
+                                    1.0 / std::sqrt( 1.0 - polynomialParameter * polynomialParameter ),
+                                    legendreCache.getLegendrePolynomial( i, j ), incrementedPolynomial,
+                                    legendreCache.getLegendrePolynomialDerivative( i, j ),
+                                    incrementedPolynomialDerivative, normalizationCorrection ), 1.0E-14 );
+                }
+            }
+        }
+    }
+}
+
+//! Test if second derivatives of geodesy-normalized polynomials in cache are consistent with numerical differentiation
+//! of first derivatives.
+BOOST_AUTO_TEST_CASE( test_GeodesyLegendreCacheSecondDerivatives )
+{
+    const int maximumDegree = 30;
+    const int maximumOrder = 21;
+    const double parameterPerturbation = 1.0E-5;
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumOrder, true );
+    legendreCache.setComputeSecondDerivatives( true );
+    basic_mathematics::LegendreCache upperLegendreCache( maximumDegree, maximumOrder, true );
+    basic_mathematics::LegendreCache lowerLegendreCache( maximumDegree, maximumOrder, true );
+
+    std::vector< double > polynomialParameters = { -0.8, -0.3, 0.0, 0.1, 0.75 };
+    for( unsigned int k = 0; k < polynomialParameters.size( ); k++ )
+    {
+        legendreCache.update( polynomialParameters.at( k ) );
+        upperLegendreCache.update( polynomialParameters.at( k ) + parameterPerturbation );
+        lowerLegendreCache.update( polynomialParameters.at( k ) - parameterPerturbation );
+
+        for( int i = 0; i <= maximumDegree; i++ )
+        {
+            // Second derivatives at one but maximum order require the (not computed) derivative at maximum order,
+            // unless the maximum order is not lower than the degree
+            for( int j = 0; ( j <= i ) && ( ( j < maximumOrder - 1 ) || ( i <= maximumOrder ) ); j++ )
+            {
+                double numericalSecondDerivative =
+                        ( upperLegendreCache.getLegendrePolynomialDerivative( i, j ) -
+                          lowerLegendreCache.getLegendrePolynomialDerivative( i, j ) ) / ( 2.0 * parameterPerturbation );
+                double secondDerivative = legendreCache.getLegendrePolynomialSecondDerivative( i, j );
+                BOOST_CHECK_SMALL( secondDerivative - numericalSecondDerivative,
+                                   1.0E-5 * std::max( 1.0, std::fabs( secondDerivative ) ) );
+            }
+        }
+    }
+}
+
+//! Test if fixed-degree Legendre cache is consistent with run-time sized Legendre cache.
+BOOST_AUTO_TEST_CASE( test_FixedDegreeLegendreCache )
+{
+    const int maximumDegree = 30;
+    const int maximumOrder = 20;
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumOrder, true );
+    legendreCache.setComputeSecondDerivatives( true );
+
+    basic_mathematics::FixedDegreeLegendreCache< maximumDegree, maximumOrder > fixedDegreeLegendreCache( true );
+
+    // Check that packed layout is shared between caches
+    BOOST_CHECK_EQUAL( legendreCache.getLegendreValues( ).size( ),
+                       ( basic_mathematics::FixedDegreeLegendreCache< maximumDegree, maximumOrder >::numberOfEntries ) );
+
+    std::vector< double > polynomialParameters = { -0.95, -0.3, 0.0, 0.1, 0.75, 0.999 };
+    for( unsigned int k = 0; k < polynomialParameters.size( ); k++ )
+    {
+        legendreCache.update( polynomialParameters.at( k ) );
+        fixedDegreeLegendreCache.update( polynomialParameters.at( k ) );
+
+        for( int i = 0; i <= maximumDegree; i++ )
+        {
+            BOOST_CHECK_EQUAL( legendreCache.getDegreeOffset( i ), fixedDegreeLegendreCache.getDegreeOffset( i ) );
+            for( int j = 0; ( j <= i ) && ( j <= maximumOrder ); j++ )
+            {
+                // Values should be identical, as the same recurrence (and operation order) is used
+                BOOST_CHECK_EQUAL( legendreCache.getLegendrePolynomial( i, j ),
+                                   fixedDegreeLegendreCache.getLegendrePolynomial( i, j ) );
+
+                // Derivatives at maximum order are only computed if order is equal to degree
+                if( j < maximumOrder || j == i )
+                {
+                    BOOST_CHECK_EQUAL( legendreCache.getLegendrePolynomialDerivative( i, j ),
+                                       fixedDegreeLegendreCache.getLegendrePolynomialDerivative( i, j ) );
+                    BOOST_CHECK_EQUAL( legendreCache.getLegendrePolynomialSecondDerivative( i, j ),
+                                       fixedDegreeLegendreCache.getLegendrePolynomialSecondDerivative( i, j ) );
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -35,10 +35,91 @@
 #include "tudat/basics/testMacros.h"
 #include "tudat/math/integrators/numericalIntegratorTestFunctions.h"
 
+#include <atomic>
+#include <cstdlib>
 #include <limits>
 #include <string>
 #include <typeinfo>
 
+#if defined( __GLIBC__ ) && !defined( __SANITIZE_ADDRESS__ ) && !defined( __SANITIZE_THREAD__ )
+// Count heap allocations, by interposing the allocation functions of the C library (also used by Eigen and operator
+// new), so that allocation-free integration steps can be verified. Allocations are only counted while a
+// ScopedHeapAllocationCounter exists.
+extern "C"
+{
+void* __libc_malloc( std::size_t size );
+void* __libc_calloc( std::size_t numberOfElements, std::size_t size );
+void* __libc_realloc( void* pointer, std::size_t size );
+}
+
+namespace
+{
+
+//! Boolean denoting whether heap allocations are currently counted
+std::atomic< bool > isHeapAllocationCountActive( false );
+
+//! Number of heap allocations since creation of the active ScopedHeapAllocationCounter
+std::atomic< int > numberOfHeapAllocations( 0 );
+
+//! Function to increment the number of heap allocations, if counting is active
+inline void countHeapAllocation( )
+{
+    if( isHeapAllocationCountActive.load( std::memory_order_relaxed ) )
+    {
+        numberOfHeapAllocations.fetch_add( 1, std::memory_order_relaxed );
+    }
+}
+
+//! Class that counts heap allocations during its lifetime
+class ScopedHeapAllocationCounter
+{
+public:
+
+    //! Constructor, starts counting
+    ScopedHeapAllocationCounter( )
+    {
+        numberOfHeapAllocations.store( 0 );
+        isHeapAllocationCountActive.store( true );
+    }
+
+    //! Destructor, stops counting
+    ~ScopedHeapAllocationCounter( )
+    {
+        isHeapAllocationCountActive.store( false );
+    }
+
+    //! Function to retrieve the number of heap allocations since creation of this object
+    int getNumberOfHeapAllocations( ) const
+    {
+        return numberOfHeapAllocations.load( );
+    }
+};
+
+} // namespace
+
+extern "C"
+{
+void* malloc( std::size_t size )
+{
+    countHeapAllocation( );
+    return __libc_malloc( size );
+}
+
+void* calloc( std::size_t numberOfElements, std::size_t size )
+{
+    countHeapAllocation( );
+    return __libc_calloc( numberOfElements, size );
+}
+
+void* realloc( void* pointer, std::size_t size )
+{
+    countHeapAllocation( );
+    return __libc_realloc( pointer, size );
+}
+}
+#define TUDAT_COUNT_HEAP_ALLOCATIONS
+#endif
+
 namespace tudat
 {
 namespace unit_tests
@@ -318,6 +399,232 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Test if integration steps are free of heap allocations, once the stage buffers are sized.
+BOOST_AUTO_TEST_CASE( testAllocationFreeIntegrationStep )
+{
+    using namespace numerical_integrators;
+
+    // Define harmonic oscillator, for fixed-size state.
+    std::function< Eigen::Vector6d( const double, const Eigen::Vector6d& ) > fixedSizeStateDerivativeFunction =
+            [ ]( const double, const Eigen::Vector6d& state )
+    {
+        Eigen::Vector6d stateDerivative;
+        stateDerivative << state.segment< 3 >( 3 ), -state.segment< 3 >( 0 );
+        return stateDerivative;
+    };
+
+    // Define harmonic oscillator with state transition matrix, for dynamic-size state (6x7 matrix).
+    int numberOfStateDerivativeEvaluations = 0;
+    std::function< Eigen::MatrixXd( const double, const Eigen::MatrixXd& ) > dynamicSizeStateDerivativeFunction =
+            [ & ]( const double, const Eigen::MatrixXd& state )
+    {
+        numberOfStateDerivativeEvaluations++;
+        Eigen::MatrixXd stateDerivative( state.rows( ), state.cols( ) );
+        stateDerivative.topRows( 3 ) = state.bottomRows( 3 );
+        stateDerivative.bottomRows( 3 ) = -state.topRows( 3 );
+        return stateDerivative;
+    };
+
+    // Define same function, writing the state derivative into a preallocated matrix
+    std::function< void( const double, const Eigen::MatrixXd&, Eigen::MatrixXd& ) > inPlaceStateDerivativeFunction =
+            [ ]( const double, const Eigen::MatrixXd& state, Eigen::MatrixXd& stateDerivative )
+    {
+        stateDerivative.topRows( 3 ) = state.bottomRows( 3 );
+        stateDerivative.bottomRows( 3 ) = -state.topRows( 3 );
+    };
+
+    Eigen::Vector6d initialState = ( Eigen::Vector6d( ) << 1.0, 0.0, 0.0, 0.0, 1.0, 0.5 ).finished( );
+    Eigen::MatrixXd initialVariationalState = Eigen::MatrixXd::Zero( 6, 7 );
+    initialVariationalState.col( 0 ) = initialState;
+    initialVariationalState.rightCols( 6 ).setIdentity( );
+
+    for( CoefficientSets coefficientSet : { rungeKuttaFehlberg45, rungeKuttaFehlberg78, rungeKutta87DormandPrince } )
+    {
+        RungeKuttaVariableStepSizeIntegrator< double, Eigen::Vector6d, Eigen::Vector6d > fixedSizeIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), fixedSizeStateDerivativeFunction,
+                    0.0, initialState, 1.0E-6, 1.0, 0.01, 1.0E-10, 1.0E-10 );
+        RungeKuttaVariableStepSizeIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > dynamicSizeIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), dynamicSizeStateDerivativeFunction,
+                    0.0, initialVariationalState, 1.0E-6, 1.0, 0.01, 1.0E-10, 1.0E-10 );
+        RungeKuttaVariableStepSizeIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > inPlaceIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), dynamicSizeStateDerivativeFunction,
+                    0.0, initialVariationalState, 1.0E-6, 1.0, 0.01, 1.0E-10, 1.0E-10 );
+        inPlaceIntegrator.setInPlaceStateDerivativeFunction( inPlaceStateDerivativeFunction );
+        RungeKuttaVariableStepSizeIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > referenceIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), dynamicSizeStateDerivativeFunction,
+                    0.0, initialVariationalState, 1.0E-6, 1.0, 0.01, 1.0E-10, 1.0E-10 );
+
+        // Perform first step, in which buffers are sized
+        fixedSizeIntegrator.performIntegrationStepInPlace( fixedSizeIntegrator.getNextStepSize( ) );
+        dynamicSizeIntegrator.performIntegrationStepInPlace( dynamicSizeIntegrator.getNextStepSize( ) );
+        inPlaceIntegrator.performIntegrationStepInPlace( inPlaceIntegrator.getNextStepSize( ) );
+
+        // Perform subsequent steps
+        const int numberOfSteps = 100;
+        {
+#if defined( TUDAT_COUNT_HEAP_ALLOCATIONS )
+            ScopedHeapAllocationCounter heapAllocationCounter;
+#endif
+            for( int i = 0; i < numberOfSteps; i++ )
+            {
+                fixedSizeIntegrator.performIntegrationStepInPlace( fixedSizeIntegrator.getNextStepSize( ) );
+            }
+#if defined( TUDAT_COUNT_HEAP_ALLOCATIONS )
+            // No allocations should occur for fixed-size states
+            BOOST_CHECK_EQUAL( heapAllocationCounter.getNumberOfHeapAllocations( ), 0 );
+#endif
+        }
+
+        numberOfStateDerivativeEvaluations = 0;
+        {
+#if defined( TUDAT_COUNT_HEAP_ALLOCATIONS )
+            ScopedHeapAllocationCounter heapAllocationCounter;
+#endif
+            for( int i = 0; i < numberOfSteps; i++ )
+            {
+                dynamicSizeIntegrator.performIntegrationStepInPlace( dynamicSizeIntegrator.getNextStepSize( ) );
+            }
+#if defined( TUDAT_COUNT_HEAP_ALLOCATIONS )
+            // For dynamic-size states, only the state derivative function (which returns a new matrix) should allocate
+            BOOST_CHECK_EQUAL( heapAllocationCounter.getNumberOfHeapAllocations( ), numberOfStateDerivativeEvaluations );
+#endif
+        }
+
+        {
+#if defined( TUDAT_COUNT_HEAP_ALLOCATIONS )
+            ScopedHeapAllocationCounter heapAllocationCounter;
+#endif
+            for( int i = 0; i < numberOfSteps; i++ )
+            {
+                inPlaceIntegrator.performIntegrationStepInPlace( inPlaceIntegrator.getNextStepSize( ) );
+            }
+#if defined( TUDAT_COUNT_HEAP_ALLOCATIONS )
+            // For dynamic-size states with in-place state derivative function, no allocations should occur
+            BOOST_CHECK_EQUAL( heapAllocationCounter.getNumberOfHeapAllocations( ), 0 );
+#endif
+        }
+        BOOST_CHECK_EQUAL( fixedSizeIntegrator.getNumberOfStageBufferAllocations( ), 1 );
+        BOOST_CHECK_EQUAL( dynamicSizeIntegrator.getNumberOfStageBufferAllocations( ), 1 );
+        BOOST_CHECK_EQUAL( inPlaceIntegrator.getNumberOfStageBufferAllocations( ), 1 );
+
+        // Check that results are identical to those of the regular step function
+        for( int i = 0; i < numberOfSteps + 1; i++ )
+        {
+            referenceIntegrator.performIntegrationStep( referenceIntegrator.getNextStepSize( ) );
+        }
+        BOOST_CHECK_EQUAL( referenceIntegrator.getCurrentIndependentVariable( ),
+                           dynamicSizeIntegrator.getCurrentIndependentVariable( ) );
+        BOOST_CHECK( referenceIntegrator.getCurrentState( ) == dynamicSizeIntegrator.getCurrentState( ) );
+        BOOST_CHECK_EQUAL( referenceIntegrator.getCurrentIndependentVariable( ),
+                           inPlaceIntegrator.getCurrentIndependentVariable( ) );
+        BOOST_CHECK( referenceIntegrator.getCurrentState( ) == inPlaceIntegrator.getCurrentState( ) );
+    }
+}
+
+//! Test dense output of variable step size Runge-Kutta integrators, using harmonic oscillator with analytical solution.
+BOOST_AUTO_TEST_CASE( testDenseOutput )
+{
+    using namespace numerical_integrators;
+
+    int numberOfStateDerivativeEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        numberOfStateDerivativeEvaluations++;
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    };
+    Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+
+    for( CoefficientSets coefficientSet : { rungeKuttaFehlberg45, rungeKuttaFehlberg78, rungeKutta87DormandPrince } )
+    {
+        const int numberOfStages = RungeKuttaCoefficients::get( coefficientSet ).cCoefficients.rows( );
+        double maximumError[ 3 ] = { 0.0, 0.0, 0.0 };
+        int numberOfEvaluations[ 3 ] = { 0, 0, 0 };
+        for( RungeKuttaDenseOutputTypes denseOutputType :
+             { cubic_hermite_dense_output, quintic_hermite_dense_output, multi_step_hermite_dense_output } )
+        {
+            RungeKuttaVariableStepSizeIntegratorXd integrator(
+                        RungeKuttaCoefficients::get( coefficientSet ), stateDerivativeFunction,
+                        0.0, initialState, 1.0E-6, 1.0E2, 0.1, 1.0E-10, 1.0E-10 );
+            integrator.setDenseOutputType( denseOutputType );
+            BOOST_CHECK_EQUAL( integrator.getDenseOutputType( ), denseOutputType );
+            BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+
+            numberOfStateDerivativeEvaluations = 0;
+            for( int i = 0; i < 20; i++ )
+            {
+                integrator.performIntegrationStep( integrator.getNextStepSize( ) );
+                BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+
+                // Check that dense output reproduces states at start and end of step
+                const double previousTime = integrator.getPreviousIndependentVariable( );
+                const double currentTime = integrator.getCurrentIndependentVariable( );
+                BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( previousTime ) -
+                                     integrator.getPreviousState( ) ).norm( ), 1.0E-14 );
+                BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( currentTime ) -
+                                     integrator.getCurrentState( ) ).norm( ), 1.0E-14 );
+
+                // Compare dense output in step with analytical solution
+                for( int j = 1; j < 10; j++ )
+                {
+                    const double outputTime = previousTime + ( currentTime - previousTime ) * static_cast< double >( j ) / 10.0;
+                    const Eigen::VectorXd denseOutputState = integrator.getDenseOutputState( outputTime );
+                    maximumError[ denseOutputType ] = std::max(
+                                maximumError[ denseOutputType ],
+                                std::fabs( denseOutputState( 0 ) - std::cos( outputTime ) ) );
+                }
+            }
+            numberOfEvaluations[ denseOutputType ] = numberOfStateDerivativeEvaluations;
+
+            // Check that no dense output is available outside of last step, or after rollback
+            const double stepSize = integrator.getCurrentIndependentVariable( ) - integrator.getPreviousIndependentVariable( );
+            BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) + 0.1 * stepSize ),
+                               std::runtime_error );
+            integrator.rollbackToPreviousState( );
+            BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+            BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) ),
+                               std::runtime_error );
+
+            // Check that cubic dense output requires no additional state derivative evaluations, and multi-step dense
+            // output only requires the midpoints of the first two steps
+            if( denseOutputType == cubic_hermite_dense_output )
+            {
+                BOOST_CHECK_EQUAL( integrator.getNumberOfDenseOutputStateDerivativeEvaluations( ), 0 );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( integrator.getNumberOfDenseOutputStateDerivativeEvaluations( ),
+                                   numberOfEvaluations[ denseOutputType ] -
+                                   numberOfEvaluations[ cubic_hermite_dense_output ] );
+            }
+            if( denseOutputType == multi_step_hermite_dense_output )
+            {
+                BOOST_CHECK_EQUAL( integrator.getNumberOfDenseOutputStateDerivativeEvaluations( ), 2 * numberOfStages );
+            }
+        }
+
+        // Check that quintic and multi-step dense output are close to the integration accuracy, and better than cubic
+        // dense output
+        BOOST_CHECK_SMALL( maximumError[ quintic_hermite_dense_output ], 1.0E-8 );
+        BOOST_CHECK( maximumError[ quintic_hermite_dense_output ] < 0.25 * maximumError[ cubic_hermite_dense_output ] );
+        BOOST_CHECK_SMALL( maximumError[ multi_step_hermite_dense_output ], 1.0E-8 );
+        BOOST_CHECK( maximumError[ multi_step_hermite_dense_output ] < 0.25 * maximumError[ cubic_hermite_dense_output ] );
+
+        // Check that cubic dense output does not add state derivative evaluations w.r.t. regular integration
+        RungeKuttaVariableStepSizeIntegratorXd referenceIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), stateDerivativeFunction,
+                    0.0, initialState, 1.0E-6, 1.0E2, 0.1, 1.0E-10, 1.0E-10 );
+        numberOfStateDerivativeEvaluations = 0;
+        for( int i = 0; i < 20; i++ )
+        {
+            referenceIntegrator.performIntegrationStep( referenceIntegrator.getNextStepSize( ) );
+        }
+
+        // Only the state derivative at the end of the last step (not yet reused) is additional
+        BOOST_CHECK_EQUAL( numberOfEvaluations[ cubic_hermite_dense_output ], numberOfStateDerivativeEvaluations + 1 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,138 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/math/statistics/basicStatistics.h"
+#include "tudat/math/statistics/randomSampling.h"
+#include "tudat/math/statistics/streamingStatistics.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_streaming_statistics )
+
+//! Test if running mean and covariance match batch computation, also when merging subsamples
+BOOST_AUTO_TEST_CASE( testRunningMeanAndCovariance )
+{
+    std::vector< Eigen::VectorXd > sample = statistics::generateGaussianRandomSample(
+                42, 1000, ( Eigen::VectorXd( 3 ) << 1.0E3, -2.0, 0.5 ).finished( ),
+                ( Eigen::VectorXd( 3 ) << 10.0, 0.1, 3.0 ).finished( ) );
+
+    // Compute batch statistics
+    Eigen::VectorXd batchMean = statistics::computeSampleMean( sample );
+    Eigen::MatrixXd batchCovariance = Eigen::MatrixXd::Zero( 3, 3 );
+    for( unsigned int i = 0; i < sample.size( ); i++ )
+    {
+        batchCovariance += ( sample.at( i ) - batchMean ) * ( sample.at( i ) - batchMean ).transpose( );
+    }
+    batchCovariance /= static_cast< double >( sample.size( ) - 1 );
+
+    // Compute running statistics, in full and from two merged subsamples
+    statistics::RunningMeanAndCovariance fullStatistics( 3 );
+    statistics::RunningMeanAndCovariance firstStatistics( 3 );
+    statistics::RunningMeanAndCovariance secondStatistics( 3 );
+    for( unsigned int i = 0; i < sample.size( ); i++ )
+    {
+        fullStatistics.addSample( sample.at( i ) );
+        if( i < 317 )
+        {
+            firstStatistics.addSample( sample.at( i ) );
+        }
+        else
+        {
+            secondStatistics.addSample( sample.at( i ) );
+        }
+    }
+    firstStatistics.merge( secondStatistics );
+
+    BOOST_CHECK_EQUAL( fullStatistics.getNumberOfSamples( ), sample.size( ) );
+    BOOST_CHECK_EQUAL( firstStatistics.getNumberOfSamples( ), sample.size( ) );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( fullStatistics.getMean( )( i ), batchMean( i ), 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( firstStatistics.getMean( )( i ), batchMean( i ), 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( fullStatistics.getStandardDeviation( )( i ),
+                                    std::sqrt( batchCovariance( i, i ) ), 1.0E-12 );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            double scale = std::sqrt( batchCovariance( i, i ) * batchCovariance( j, j ) );
+            BOOST_CHECK_SMALL( ( fullStatistics.getCovariance( )( i, j ) - batchCovariance( i, j ) ) / scale, 1.0E-12 );
+            BOOST_CHECK_SMALL( ( firstStatistics.getCovariance( )( i, j ) - batchCovariance( i, j ) ) / scale, 1.0E-12 );
+        }
+    }
+
+    // Check that inconsistent input is rejected
+    BOOST_CHECK_THROW( fullStatistics.addSample( Eigen::VectorXd::Zero( 2 ) ), std::runtime_error );
+}
+
+//! Test if P-squared quantile estimates are close to exact sample quantiles
+BOOST_AUTO_TEST_CASE( testP2QuantileEstimator )
+{
+    // Check exact result for small sample
+    statistics::P2QuantileEstimator smallSampleMedian( 0.5 );
+    BOOST_CHECK( smallSampleMedian.getQuantile( ) != smallSampleMedian.getQuantile( ) );
+    smallSampleMedian.addSample( 3.0 );
+    smallSampleMedian.addSample( 1.0 );
+    smallSampleMedian.addSample( 2.0 );
+    smallSampleMedian.addSample( 10.0 );
+    BOOST_CHECK_CLOSE_FRACTION( smallSampleMedian.getQuantile( ), 2.5, std::numeric_limits< double >::epsilon( ) );
+
+    // Check estimates for large Gaussian sample
+    std::vector< Eigen::VectorXd > sample = statistics::generateGaussianRandomSample( 1, 20000, 1, 0.0, 1.0 );
+    std::vector< double > scalarSample;
+    for( unsigned int i = 0; i < sample.size( ); i++ )
+    {
+        scalarSample.push_back( sample.at( i )( 0 ) );
+    }
+    std::vector< double > sortedSample = scalarSample;
+    std::sort( sortedSample.begin( ), sortedSample.end( ) );
+
+    std::vector< double > probabilities = { 0.05, 0.25, 0.5, 0.75, 0.95 };
+    statistics::StreamingVectorStatistics vectorStatistics( 1, probabilities );
+    for( unsigned int i = 0; i < sample.size( ); i++ )
+    {
+        vectorStatistics.addSample( sample.at( i ) );
+    }
+
+    for( unsigned int j = 0; j < probabilities.size( ); j++ )
+    {
+        statistics::P2QuantileEstimator quantileEstimator( probabilities.at( j ) );
+        for( unsigned int i = 0; i < scalarSample.size( ); i++ )
+        {
+            quantileEstimator.addSample( scalarSample.at( i ) );
+        }
+
+        double exactQuantile = sortedSample.at(
+                    static_cast< int >( probabilities.at( j ) * static_cast< double >( sortedSample.size( ) - 1 ) ) );
+        BOOST_CHECK_SMALL( quantileEstimator.getQuantile( ) - exactQuantile, 0.02 );
+        BOOST_CHECK_EQUAL( vectorStatistics.getQuantiles( )( 0, j ), quantileEstimator.getQuantile( ) );
+    }
+
+    BOOST_CHECK_THROW( statistics::P2QuantileEstimator( 1.5 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
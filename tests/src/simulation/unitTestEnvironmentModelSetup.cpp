@@ -12,12 +12,14 @@
 #define BOOST_TEST_MAIN
 
 #include <limits>
+#include <thread>
 
 #include <boost/test/unit_test.hpp>
 
 
 #include <Eigen/Core>
 
+#include "tudat/astro/aerodynamics/customAerodynamicCoefficientInterface.h"
 #include "tudat/astro/aerodynamics/exponentialAtmosphere.h"
 
 #if TUDAT_BUILD_WITH_NRLMSISE
@@ -28,13 +30,20 @@
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/basic_astro/geodeticCoordinateConversions.h"
+#include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
+#include "tudat/astro/electromagnetism/radiationPressureInterface.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/itrsToGcrsRotationModel.h"
 #include "tudat/astro/gravitation/centralGravityModel.h"
 #include "tudat/astro/gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "tudat/astro/gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+#include "tudat/astro/propulsion/thrustMagnitudeWrapper.h"
+#include "tudat/astro/system_models/vehicleSystems.h"
 #include "tudat/basics/testMacros.h"
 #include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
 
@@ -2044,6 +2053,253 @@ BOOST_AUTO_TEST_CASE( test_panelledRadiationPressureInterfaceSetup )
 
 }
 
+//! Test copying of system of bodies for concurrent use
+BOOST_AUTO_TEST_CASE( test_systemOfBodiesCloning )
+{
+    using namespace ephemerides;
+    using namespace interpolators;
+
+    // Create environment with constant Earth ephemeris and tabulated vehicle ephemeris
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.createEmptyBody( "Vehicle", false );
+
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.at( "Earth" )->setRotationalEphemeris( std::make_shared< SimpleRotationalEphemeris >(
+                                                      0.0, 1.5, 0.0, 7.292115E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+
+    std::map< double, Eigen::Vector6d > vehicleStates;
+    for( int i = 0; i < 1000; i++ )
+    {
+        vehicleStates[ 10.0 * i ] = ( Eigen::Vector6d( ) << 7.0E6 + i, 0.0, 1.0E3 * i, 0.0, 7.5E3, 1.0E3 ).finished( );
+    }
+    std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector6d > > vehicleStateInterpolator =
+            std::make_shared< LagrangeInterpolator< double, Eigen::Vector6d > >( vehicleStates, 8 );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< TabulatedCartesianEphemeris< > >(
+                                              vehicleStateInterpolator, "Earth", "ECLIPJ2000" ) );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+    bodies.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                    [ ]( const std::vector< double >& ){ return Eigen::Vector3d( 1.2, 0.0, 0.3 ); },
+                    [ ]( const std::vector< double >& ){ return Eigen::Vector3d::Zero( ); },
+                    1.0, 2.0, 1.0, Eigen::Vector3d::Zero( ),
+                    std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables >( ) ) );
+    bodies.processBodyFrameDefinitions( );
+
+    SystemOfBodies clonedBodies = cloneSystemOfBodies( bodies );
+
+    // Check which objects are duplicated, and which are shared
+    BOOST_CHECK_EQUAL( clonedBodies.getNumberOfBodies( ), 2 );
+    BOOST_CHECK_EQUAL( clonedBodies.getFrameOrigin( ), "SSB" );
+    for( auto bodyIterator: bodies.getMap( ) )
+    {
+        std::shared_ptr< Body > clonedBody = clonedBodies.at( bodyIterator.first );
+        BOOST_CHECK( clonedBody != bodyIterator.second );
+        BOOST_CHECK_EQUAL( clonedBody->getBodyName( ), bodyIterator.first );
+        BOOST_CHECK( clonedBody->getEphemeris( ) != bodyIterator.second->getEphemeris( ) );
+    }
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getGravityFieldModel( ) != bodies.at( "Earth" )->getGravityFieldModel( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ), 3.986004418E14 );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getRotationalEphemeris( ) != bodies.at( "Earth" )->getRotationalEphemeris( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getRotationalEphemeris( )->getRotationToBaseFrame( 1.0E4 ).isApprox(
+                     bodies.at( "Earth" )->getRotationalEphemeris( )->getRotationToBaseFrame( 1.0E4 ) ) );
+    BOOST_CHECK( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< > >(
+                     clonedBodies.at( "Vehicle" )->getEphemeris( ) )->getInterpolator( ) == vehicleStateInterpolator );
+    BOOST_CHECK( clonedBodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( ) !=
+            bodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Vehicle" )->getBodyMass( ), 500.0 );
+
+    // Check that current states are independent
+    bodies.at( "Vehicle" )->setStateFromEphemeris( 105.0 );
+    clonedBodies.at( "Vehicle" )->setStateFromEphemeris( 5005.0 );
+    BOOST_CHECK_EQUAL( bodies.at( "Vehicle" )->getState( )( 0 ), vehicleStateInterpolator->interpolate( 105.0 )( 0 ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Vehicle" )->getState( )( 0 ), vehicleStateInterpolator->interpolate( 5005.0 )( 0 ) );
+
+    clonedBodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( )->updateCurrentCoefficients(
+                std::vector< double >( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( )->
+                       getCurrentForceCoefficients( )( 0 ), 1.2 );
+
+    // Check that original and copy can be evaluated concurrently, giving results identical to serial evaluation
+    std::vector< SystemOfBodies > systemsToEvaluate = { bodies, clonedBodies, cloneSystemOfBodies( bodies ) };
+    std::vector< std::vector< Eigen::Vector6d > > concurrentStates( systemsToEvaluate.size( ) );
+    std::vector< std::thread > evaluationThreads;
+    for( unsigned int i = 0; i < systemsToEvaluate.size( ); i++ )
+    {
+        evaluationThreads.push_back( std::thread( [ &, i ]( )
+        {
+            for( int j = 0; j < 5000; j++ )
+            {
+                double currentTime = ( i % 2 == 0 ) ? 1.9 * j : 9980.0 - 1.9 * j;
+                systemsToEvaluate.at( i ).at( "Vehicle" )->setStateFromEphemeris( currentTime );
+                concurrentStates.at( i ).push_back( systemsToEvaluate.at( i ).at( "Vehicle" )->getState( ) );
+            }
+        } ) );
+    }
+    for( unsigned int i = 0; i < evaluationThreads.size( ); i++ )
+    {
+        evaluationThreads.at( i ).join( );
+    }
+
+    for( unsigned int i = 0; i < systemsToEvaluate.size( ); i++ )
+    {
+        for( int j = 0; j < 5000; j++ )
+        {
+            double currentTime = ( i % 2 == 0 ) ? 1.9 * j : 9980.0 - 1.9 * j;
+            Eigen::Vector6d expectedState = vehicleStateInterpolator->interpolate( currentTime );
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( concurrentStates.at( i ).at( j )( k ), expectedState( k ) );
+            }
+        }
+    }
+
+    // Check that bodies with models that cannot be copied are rejected
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ApproximateJplEphemeris >( "Mars" ) );
+    BOOST_CHECK_THROW( cloneSystemOfBodies( bodies ), std::runtime_error );
+}
+
+//! Test copying of models with evaluation state (and models linked to other bodies) when copying a system of bodies
+BOOST_AUTO_TEST_CASE( test_systemOfBodiesCloningStatefulModels )
+{
+    using namespace ephemerides;
+
+    // Create environment with spherical harmonic Earth gravity field and exponential atmosphere
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Sun", false );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.createEmptyBody( "Vehicle", false );
+
+    bodies.at( "Sun" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                          Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                            ( Eigen::Vector6d( ) << 1.496E11, 0.0167, 0.0, 0.0, 0.0, 0.0 ).finished( ),
+                                            0.0, 1.32712440018E20, "SSB", "ECLIPJ2000" ) );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 6, 6 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 6, 6 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165E-4;
+    cosineCoefficients( 2, 2 ) = 2.43938E-6;
+    sineCoefficients( 2, 2 ) = -1.40027E-6;
+    cosineCoefficients( 4, 3 ) = 5.7E-7;
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                                                    3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients,
+                                                    "IAU_Earth" ) );
+    bodies.at( "Earth" )->setAtmosphereModel( std::make_shared< aerodynamics::ExponentialAtmosphere >(
+                                                  aerodynamics::earth ) );
+    bodies.at( "Earth" )->setShapeModel( std::make_shared< basic_astrodynamics::SphericalBodyShapeModel >( 6378137.0 ) );
+
+    // Create vehicle with engine and cannonball radiation pressure interface, occulted by the Earth
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                              ( Eigen::Vector6d( ) << 7.0E6, 0.01, 0.1, 0.0, 0.0, 0.0 ).finished( ),
+                                              0.0, 3.986004418E14, "Earth", "ECLIPJ2000" ) );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+    std::shared_ptr< system_models::VehicleSystems > vehicleSystems = std::make_shared< system_models::VehicleSystems >( );
+    vehicleSystems->setEngineModel( std::make_shared< system_models::EngineModel >(
+                                        std::make_shared< propulsion::CustomThrustMagnitudeWrapper >(
+                                            [ ]( const double time ){ return 1.0 + time; },
+                                            [ ]( const double ){ return 300.0; } ), "MainEngine" ) );
+    bodies.at( "Vehicle" )->setVehicleSystems( vehicleSystems );
+    bodies.at( "Vehicle" )->setRadiationPressureInterface(
+                "Sun", std::make_shared< electromagnetism::RadiationPressureInterface >(
+                    [ ]( ){ return 3.839E26; },
+                    std::bind( &Body::getPosition, bodies.at( "Sun" ) ),
+                    std::bind( &Body::getPosition, bodies.at( "Vehicle" ) ), 1.2, 4.0,
+                    std::vector< std::function< Eigen::Vector3d( ) > >{ std::bind( &Body::getPosition, bodies.at( "Earth" ) ) },
+                    std::vector< double >{ 6378137.0 }, 6.96E8, std::vector< std::string >{ "Earth" } ) );
+    bodies.processBodyFrameDefinitions( );
+
+    // Radiation pressure interfaces can only be copied with the system of bodies to which they are linked
+    BOOST_CHECK_THROW( bodies.at( "Vehicle" )->clone( ), std::runtime_error );
+
+    SystemOfBodies clonedBodies = cloneSystemOfBodies( bodies );
+
+    // Check that ephemerides give identical results
+    for( auto bodyIterator: bodies.getMap( ) )
+    {
+        BOOST_CHECK( clonedBodies.at( bodyIterator.first )->getEphemeris( ) != bodyIterator.second->getEphemeris( ) );
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_EQUAL( clonedBodies.at( bodyIterator.first )->getEphemeris( )->getCartesianState( 3.0E4 )( i ),
+                               bodyIterator.second->getEphemeris( )->getCartesianState( 3.0E4 )( i ) );
+        }
+    }
+
+    // Check that gravity field and atmosphere are copied, and give identical results
+    std::shared_ptr< gravitation::SphericalHarmonicsGravityField > originalField =
+            std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                bodies.at( "Earth" )->getGravityFieldModel( ) );
+    std::shared_ptr< gravitation::SphericalHarmonicsGravityField > clonedField =
+            std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                clonedBodies.at( "Earth" )->getGravityFieldModel( ) );
+    BOOST_CHECK( clonedField != nullptr );
+    BOOST_CHECK( clonedField != originalField );
+    Eigen::Vector3d testPosition( 5.0E6, -4.0E6, 2.0E6 );
+    Eigen::Vector3d originalGradient = originalField->getGradientOfPotential( testPosition );
+    Eigen::Vector3d clonedGradient = clonedField->getGradientOfPotential( testPosition );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( originalGradient( i ), clonedGradient( i ) );
+    }
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getAtmosphereModel( ) != bodies.at( "Earth" )->getAtmosphereModel( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Earth" )->getAtmosphereModel( )->getDensity( 4.0E5, 0.1, 0.2, 0.0 ),
+                       bodies.at( "Earth" )->getAtmosphereModel( )->getDensity( 4.0E5, 0.1, 0.2, 0.0 ) );
+
+    // Check that engine models are copied, and updated independently
+    std::shared_ptr< system_models::EngineModel > originalEngine =
+            bodies.at( "Vehicle" )->getVehicleSystems( )->getEngineModel( "MainEngine" );
+    std::shared_ptr< system_models::EngineModel > clonedEngine =
+            clonedBodies.at( "Vehicle" )->getVehicleSystems( )->getEngineModel( "MainEngine" );
+    BOOST_CHECK( clonedEngine != originalEngine );
+    BOOST_CHECK( clonedEngine->getThrustMagnitudeWrapper( ) != originalEngine->getThrustMagnitudeWrapper( ) );
+    originalEngine->updateEngineModel( 1.0 );
+    clonedEngine->updateEngineModel( 2.0 );
+    BOOST_CHECK_EQUAL( originalEngine->getCurrentThrust( ), 2.0 );
+    BOOST_CHECK_EQUAL( clonedEngine->getCurrentThrust( ), 3.0 );
+
+    // Check that radiation pressure interface of copy is linked to the copied bodies
+    std::shared_ptr< electromagnetism::RadiationPressureInterface > originalInterface =
+            bodies.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" );
+    std::shared_ptr< electromagnetism::RadiationPressureInterface > clonedInterface =
+            clonedBodies.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" );
+    BOOST_CHECK( clonedInterface != originalInterface );
+    BOOST_CHECK_EQUAL( clonedInterface->getOccultingBodies( ).at( 0 ), "Earth" );
+    BOOST_CHECK_EQUAL( clonedInterface->getRadiationPressureCoefficient( ), 1.2 );
+
+    for( auto bodyIterator: bodies.getMap( ) )
+    {
+        bodyIterator.second->setStateFromEphemeris( 1.0E3 );
+        clonedBodies.at( bodyIterator.first )->setStateFromEphemeris( 2.0E3 );
+    }
+    originalInterface->updateInterface( 1.0E3 );
+    clonedInterface->updateInterface( 2.0E3 );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( clonedInterface->getTargetPositionFunction( )( )( i ),
+                           clonedBodies.at( "Vehicle" )->getPosition( )( i ) );
+        BOOST_CHECK_EQUAL( originalInterface->getTargetPositionFunction( )( )( i ),
+                           bodies.at( "Vehicle" )->getPosition( )( i ) );
+    }
+    BOOST_CHECK( clonedInterface->getCurrentSolarVector( ) != originalInterface->getCurrentSolarVector( ) );
+    BOOST_CHECK_CLOSE_FRACTION(
+                clonedInterface->getCurrentSolarVector( ).norm( ),
+                ( clonedBodies.at( "Sun" )->getPosition( ) - clonedBodies.at( "Vehicle" )->getPosition( ) ).norm( ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    // Check that unsupported thrust models are rejected
+    vehicleSystems->setEngineModel( std::make_shared< system_models::EngineModel >(
+                                        std::make_shared< propulsion::ParameterizedThrustMagnitudeWrapper >(
+                                            [ ]( const std::vector< double >& ){ return 1.0; },
+                                            [ ]( const std::vector< double >& ){ return 300.0; },
+                                            std::vector< std::function< double( ) > >( ),
+                                            std::vector< std::function< double( ) > >( ),
+                                            std::vector< propulsion::ThrustIndependentVariables >( ),
+                                            std::vector< propulsion::ThrustIndependentVariables >( ) ), "MainEngine" ) );
+    BOOST_CHECK_THROW( cloneSystemOfBodies( bodies ), std::runtime_error );
+}
+
 
 BOOST_AUTO_TEST_SUITE_END( )
 